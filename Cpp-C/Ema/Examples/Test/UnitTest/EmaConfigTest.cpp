@@ -381,6 +381,7 @@ TEST_F(EmaConfigTest, testLoadingCfgFromProgrammaticConfigHttp)
 			.addUInt("RequestTimeout", 2400)
 			.addUInt("MaxOutstandingPosts", 9999)
 			.addInt("DispatchTimeoutApiThread", 60)
+			.addInt("DispatchSpinTimeApiThread", 25)
 			.addUInt("CatchUnhandledException", 1)
 			.addUInt("MaxDispatchCountApiThread", 300)
 			.addInt("MaxEventsInPool", 100)
@@ -477,6 +478,7 @@ TEST_F(EmaConfigTest, testLoadingCfgFromProgrammaticConfigHttp)
 		EXPECT_TRUE( activeConfig.requestTimeout == 2400) << "requestTimeout , 2400";
 		EXPECT_TRUE( activeConfig.maxOutstandingPosts == 9999) << "maxOutstandingPosts , 9999";
 		EXPECT_TRUE( activeConfig.dispatchTimeoutApiThread == 60) << "dispatchTimeoutApiThread , 60";
+		EXPECT_TRUE( activeConfig.dispatchSpinTimeApiThread == 25) << "dispatchSpinTimeApiThread , 25";
 		EXPECT_TRUE( activeConfig.catchUnhandledException == 1) << "catchUnhandledException , 1";
 		EXPECT_TRUE( activeConfig.maxDispatchCountApiThread == 300) << "maxDispatchCountApiThread , 300";
 		EXPECT_TRUE( activeConfig.maxDispatchCountUserThread == 700) << "maxDispatchCountUserThread , 700";
@@ -4230,3 +4232,266 @@ TEST_F(EmaConfigTest, testServerSharedSocketProgrammaticConfigForIProv)
 		}
 	}
 }
+
+TEST_F(EmaConfigTest, testServerShardCountProgrammaticConfigForIProv)
+{
+	//test case 0: section "ServerShardCount" is absent
+	//test case 1: section "ServerShardCount" is equal 0 (ignored)
+	//test case 2: section "ServerShardCount" is equal 4
+	//test case 3: section "ServerShardCount" is above MAX_SERVER_SHARD_COUNT
+	//test case 4: section "ServerShardCount" is equal 4 with the UserDispatch operation model
+	UInt32 expectedShardCount[] = { 1, 1, 4, MAX_SERVER_SHARD_COUNT, 1 };
+
+	for (int testCase = 0; testCase < 5; testCase++)
+	{
+		std::cout << std::endl << " #####Now it is running test case " << testCase << std::endl;
+
+		Map outermostMap, innerMap;
+		ElementList elementList, providerList;
+		try
+		{
+			elementList.addAscii("DefaultIProvider", "Provider_1");
+
+			providerList.addAscii("Server", "Server_1")
+				.addAscii("Logger", "Logger_1")
+				.addAscii("Directory", "Directory_1");
+
+			switch (testCase)
+			{
+			case 1:
+				providerList.addUInt("ServerShardCount", 0);
+				break;
+			case 2:
+			case 4:
+				providerList.addUInt("ServerShardCount", 4);
+				break;
+			case 3:
+				providerList.addUInt("ServerShardCount", MAX_SERVER_SHARD_COUNT + 1);
+				break;
+			}
+
+			innerMap.addKeyAscii("Provider_1", MapEntry::AddEnum, providerList.complete()).complete();
+
+			elementList.addMap("IProviderList", innerMap);
+
+			elementList.complete();
+			innerMap.clear();
+
+			outermostMap.addKeyAscii("IProviderGroup", MapEntry::AddEnum, elementList);
+
+			elementList.clear();
+
+			innerMap.addKeyAscii("Server_1", MapEntry::AddEnum, ElementList()
+				.addEnum("ServerType", 0)
+				.addAscii("Port", "14010").complete()).complete();
+
+			elementList.addMap("ServerList", innerMap);
+
+			elementList.complete();
+			innerMap.clear();
+
+			outermostMap.addKeyAscii("ServerGroup", MapEntry::AddEnum, elementList);
+
+			elementList.clear();
+
+			innerMap.addKeyAscii("Logger_1", MapEntry::AddEnum,
+				ElementList()
+				.addEnum("LoggerType", 0)
+				.addAscii("FileName", "logFile")
+				.addEnum("LoggerSeverity", 3).complete()).complete();
+
+			elementList.addMap("LoggerList", innerMap);
+
+			elementList.complete();
+			innerMap.clear();
+
+			outermostMap.addKeyAscii("LoggerGroup", MapEntry::AddEnum, elementList);
+			elementList.clear();
+
+			EmaString localConfigPath;
+			OmmIProviderConfig iprovConfig(localConfigPath);
+			iprovConfig.config(outermostMap);
+			if (testCase == 4)
+				iprovConfig.operationModel(OmmIProviderConfig::UserDispatchEnum);
+
+			OmmIProviderImpl ommIProviderImpl(iprovConfig, appClient);
+
+			OmmIProviderActiveConfig& activeConfig = static_cast<OmmIProviderActiveConfig&>(ommIProviderImpl.getActiveConfig());
+#ifdef WIN32
+			EXPECT_EQ(activeConfig.serverShardCount, 1) << "ServerShardCount is not supported on Windows";
+#else
+			EXPECT_EQ(activeConfig.serverShardCount, expectedShardCount[testCase]) << "OmmIProviderActiveConfig::serverShardCount";
+#endif
+		}
+		catch (const OmmException& excp)
+		{
+			std::cout << "Caught unexpected exception!!!" << std::endl << excp << std::endl;
+			EXPECT_TRUE(false) << "Unexpected exception in testServerShardCountProgrammaticConfigForIProv()";
+		}
+	}
+}
+
+#ifndef WIN32
+/* Accepts logins and records the market price requests each shard of a sharded provider receives */
+class ShardProviderClient : public AppClient
+{
+public:
+	struct Request
+	{
+		UInt64 handle;
+		UInt64 clientHandle;
+		EmaString name;
+	};
+
+	EmaVector<Request> requests;
+	Mutex lock;
+
+protected:
+	void onReqMsg(const ReqMsg& reqMsg, const OmmProviderEvent& event)
+	{
+		if (reqMsg.getDomainType() == MMT_LOGIN)
+		{
+			processLoginRequest(reqMsg, event);
+			return;
+		}
+
+		Request request;
+		request.handle = event.getHandle();
+		request.clientHandle = event.getClientHandle();
+		request.name = reqMsg.getName();
+
+		MutexLocker locker(lock);
+		requests.push_back(request);
+	}
+};
+
+class ShardConsumerClient : public OmmConsumerClient
+{
+public:
+	ShardConsumerClient() : refreshCount(0) {}
+
+	UInt32 refreshCount;
+	EmaString refreshName;
+	Mutex lock;
+
+protected:
+	void onRefreshMsg(const RefreshMsg& refreshMsg, const OmmConsumerEvent&)
+	{
+		MutexLocker locker(lock);
+		refreshName = refreshMsg.getName();
+		refreshCount++;
+	}
+};
+
+TEST_F(EmaConfigTest, testServerShardHandlesForIProv)
+{
+	const UInt32 maxConsumers = 16;
+	ShardProviderClient providerClient;
+	ShardConsumerClient consumerClients[maxConsumers];
+	OmmConsumer* consumers[maxConsumers] = { 0 };
+	OmmProvider* provider = 0;
+	UInt32 consumerCount = 0;
+	bool shardSeen[2] = { false, false };
+
+	try
+	{
+		Map outermostMap, innerMap;
+		ElementList elementList;
+
+		innerMap.addKeyAscii("Provider_S", MapEntry::AddEnum, ElementList()
+			.addAscii("Directory", "Directory_2")
+			.addUInt("ServerShardCount", 2).complete()).complete();
+		elementList.addMap("IProviderList", innerMap).complete();
+		innerMap.clear();
+		outermostMap.addKeyAscii("IProviderGroup", MapEntry::AddEnum, elementList);
+		elementList.clear();
+
+		provider = new OmmProvider(OmmIProviderConfig(configPath).config(outermostMap).providerName("Provider_S").port("14060"), providerClient);
+
+		/* The kernel picks the shard for each connection, so connect until both have served one */
+		while (consumerCount < maxConsumers && !(shardSeen[0] && shardSeen[1]))
+		{
+			EmaString itemName("SHARD_ITEM_");
+			itemName.append(consumerCount);
+
+			consumers[consumerCount] = new OmmConsumer(OmmConsumerConfig(configPath).consumerName("Consumer_5").host("localhost:14060"));
+			consumers[consumerCount]->registerClient(ReqMsg().serviceName("DIRECT_FEED").name(itemName), consumerClients[consumerCount]);
+			consumerCount++;
+
+			for (int wait = 0; wait < 100; ++wait)
+			{
+				{
+					MutexLocker locker(providerClient.lock);
+					if (providerClient.requests.size() == consumerCount)
+						break;
+				}
+				OmmBaseImplMap<OmmConsumerImpl>::sleep(50);
+			}
+
+			MutexLocker locker(providerClient.lock);
+			if (providerClient.requests.size() != consumerCount)
+			{
+				EXPECT_TRUE(false) << "Request for " << itemName << " was not received";
+				break;
+			}
+
+			UInt64 shardIndex = providerClient.requests[consumerCount - 1].handle >> EMA_SHARD_HANDLE_SHIFT;
+			if (shardIndex >= 2)
+			{
+				EXPECT_TRUE(false) << "Handle from an unknown shard";
+				break;
+			}
+			shardSeen[shardIndex] = true;
+		}
+
+		EXPECT_TRUE(shardSeen[0] && shardSeen[1]) << "Connections were not spread across both shards";
+
+		for (UInt32 idx = 0; idx < providerClient.requests.size(); ++idx)
+		{
+			const ShardProviderClient::Request& request = providerClient.requests[idx];
+
+			/* An item handle is tagged with the same shard as the client session it arrived on */
+			EXPECT_EQ(request.handle >> EMA_SHARD_HANDLE_SHIFT, request.clientHandle >> EMA_SHARD_HANDLE_SHIFT);
+
+			for (UInt32 other = 0; other < idx; ++other)
+			{
+				EXPECT_NE(request.handle, providerClient.requests[other].handle) << "Item handles are not unique";
+				EXPECT_NE(request.clientHandle, providerClient.requests[other].clientHandle) << "Client handles are not unique";
+			}
+
+			provider->submit(RefreshMsg().name(request.name).serviceName("DIRECT_FEED").solicited(true)
+				.state(OmmState::OpenEnum, OmmState::OkEnum, OmmState::NoneEnum, "Refresh Completed").complete(), request.handle);
+		}
+
+		/* Each refresh is delivered only if submit() passed it to the shard that owns the handle */
+		for (UInt32 idx = 0; idx < providerClient.requests.size(); ++idx)
+		{
+			EmaString itemName("SHARD_ITEM_");
+			itemName.append(idx);
+
+			for (int wait = 0; wait < 100; ++wait)
+			{
+				{
+					MutexLocker locker(consumerClients[idx].lock);
+					if (consumerClients[idx].refreshCount)
+						break;
+				}
+				OmmBaseImplMap<OmmConsumerImpl>::sleep(50);
+			}
+
+			MutexLocker locker(consumerClients[idx].lock);
+			EXPECT_EQ(consumerClients[idx].refreshCount, 1u) << "Refresh for " << itemName << " was not received";
+			EXPECT_TRUE(consumerClients[idx].refreshName == itemName) << "Refresh for " << itemName << " carried " << consumerClients[idx].refreshName;
+		}
+	}
+	catch (const OmmException& excp)
+	{
+		std::cout << "Caught unexpected exception!!!" << std::endl << excp << std::endl;
+		EXPECT_TRUE(false) << "Unexpected exception in testServerShardHandlesForIProv()";
+	}
+
+	for (UInt32 idx = 0; idx < consumerCount; ++idx)
+		delete consumers[idx];
+	delete provider;
+}
+#endif
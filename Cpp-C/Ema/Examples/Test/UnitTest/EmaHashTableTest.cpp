@@ -0,0 +1,169 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+#include "FlatHashTable.h"
+#include "rtr/rsslGetTime.h"
+
+using namespace thomsonreuters::ema::access;
+using namespace std;
+
+class HandleHasher
+{
+public:
+	size_t operator()( const UInt64& value ) const { return static_cast<size_t>( value ); }
+};
+
+class HandleEqual_To
+{
+public:
+	bool operator()( const UInt64& x, const UInt64& y ) const { return x == y; }
+};
+
+// every key hashes to the same slot
+class CollidingHasher
+{
+public:
+	size_t operator()( const UInt64& ) const { return 7; }
+};
+
+typedef FlatHashTable< UInt64, UInt64, HandleHasher, HandleEqual_To > FlatHandleTable;
+
+TEST(EmaHashTableTest, flatInsertFindErase)
+{
+	const UInt64 count = 10000;
+	FlatHandleTable table( 10 );
+
+	EXPECT_TRUE( table.empty() ) << "New table is empty";
+
+	// handles are item addresses, so use keys that are multiples of 16
+	for ( UInt64 key = 1; key <= count; ++key )
+		ASSERT_TRUE( table.insert( key * 16, key ) ) << "New key is inserted";
+
+	EXPECT_EQ( table.size(), count ) << "Table grows to hold every key";
+	EXPECT_FALSE( table.insert( 16, 0 ) ) << "Existing key is not inserted again";
+	EXPECT_EQ( *table.find( 16 ), 1 ) << "Existing value is kept";
+
+	for ( UInt64 key = 1; key <= count; ++key )
+	{
+		UInt64* value = table.find( key * 16 );
+		ASSERT_TRUE( value != 0 ) << "Inserted key is found";
+		ASSERT_EQ( *value, key );
+	}
+
+	EXPECT_TRUE( table.find( 8 ) == 0 ) << "Missing key is not found";
+
+	for ( UInt64 key = 1; key <= count; key += 2 )
+		ASSERT_EQ( table.erase( key * 16 ), 1 ) << "Present key is erased";
+
+	EXPECT_EQ( table.erase( 16 ), 0 ) << "Erased key is not erased again";
+	EXPECT_EQ( table.size(), count / 2 );
+
+	for ( UInt64 key = 1; key <= count; ++key )
+		ASSERT_EQ( table.find( key * 16 ) != 0, key % 2 == 0 ) << "Only erased keys are missing";
+
+	table.clear();
+	EXPECT_TRUE( table.empty() ) << "clear() removes every key";
+	EXPECT_TRUE( table.find( 32 ) == 0 );
+}
+
+TEST(EmaHashTableTest, flatSubscriptOperator)
+{
+	FlatHandleTable table;
+
+	EXPECT_EQ( table[ 5 ], 0 ) << "operator[] inserts a default value";
+	EXPECT_EQ( table.size(), 1 );
+
+	table[ 5 ] = 50;
+	table[ 6 ] = 60;
+	EXPECT_EQ( *table.find( 5 ), 50 ) << "operator[] returns the stored value";
+	EXPECT_EQ( *table.find( 6 ), 60 );
+	EXPECT_EQ( table.size(), 2 );
+}
+
+TEST(EmaHashTableTest, flatCollidingKeys)
+{
+	FlatHashTable< UInt64, UInt64, CollidingHasher, HandleEqual_To > table( 8 );
+
+	for ( UInt64 key = 0; key < 200; ++key )
+		ASSERT_TRUE( table.insert( key, key + 1 ) );
+
+	for ( UInt64 key = 0; key < 200; key += 3 )
+		ASSERT_EQ( table.erase( key ), 1 );
+
+	for ( UInt64 key = 0; key < 200; ++key )
+	{
+		UInt64* value = table.find( key );
+		if ( key % 3 )
+		{
+			ASSERT_TRUE( value != 0 ) << "Keys after an erased key are still found";
+			ASSERT_EQ( *value, key + 1 );
+		}
+		else
+			ASSERT_TRUE( value == 0 );
+	}
+}
+
+TEST(EmaHashTableTest, flatPresized)
+{
+	FlatHandleTable table( 1000 );
+	const UInt64* first;
+
+	table.insert( 1, 1 );
+	first = table.find( 1 );
+
+	for ( UInt64 key = 2; key <= 1000; ++key )
+		table.insert( key * 16, key );
+
+	// a table that did not grow keeps its slots
+	EXPECT_EQ( table.find( 1 ), first ) << "Table sized for 1000 keys does not grow while filling up";
+}
+
+// Compares lookups of 500,000 open item handles in HashTable and FlatHashTable.
+// Not run by default; use --gtest_also_run_disabled_tests --gtest_filter=EmaHashTableTest.DISABLED_*
+TEST(EmaHashTableTest, DISABLED_lookupLatency)
+{
+	const UInt32 itemCount = 500000, lookupCount = 10000000;
+	HashTable< UInt64, UInt64, HandleHasher, HandleEqual_To > chained( itemCount );
+	FlatHandleTable flat( itemCount );
+	UInt64* handles = new UInt64[ itemCount ];
+	UInt32* order = new UInt32[ lookupCount ];
+	UInt64 startTime, endTime, found;
+	UInt32 idx;
+
+	// handles are the addresses of heap allocated items
+	for ( idx = 0; idx < itemCount; ++idx )
+	{
+		handles[ idx ] = ( (UInt64)idx * 7919 % itemCount ) * 176 + 0x10000;
+		chained.insert( handles[ idx ], idx );
+		flat.insert( handles[ idx ], idx );
+	}
+
+	srand( 1 );
+	for ( idx = 0; idx < lookupCount; ++idx )
+		order[ idx ] = (UInt32)( ( (UInt64)rand() * ( RAND_MAX + 1ULL ) + rand() ) % itemCount );
+
+	found = 0;
+	startTime = rsslGetTimeNano();
+	for ( idx = 0; idx < lookupCount; ++idx )
+		found += *chained.find( handles[ order[ idx ] ] );
+	endTime = rsslGetTimeNano();
+	printf( "  HashTable       %6.1f ns/lookup\n", (double)( endTime - startTime ) / lookupCount );
+
+	UInt64 flatFound = 0;
+	startTime = rsslGetTimeNano();
+	for ( idx = 0; idx < lookupCount; ++idx )
+		flatFound += *flat.find( handles[ order[ idx ] ] );
+	endTime = rsslGetTimeNano();
+	printf( "  FlatHashTable   %6.1f ns/lookup\n", (double)( endTime - startTime ) / lookupCount );
+
+	EXPECT_EQ( found, flatFound ) << "Both tables find the same values";
+
+	delete [] order;
+	delete [] handles;
+}
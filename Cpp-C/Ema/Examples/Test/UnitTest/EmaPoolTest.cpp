@@ -0,0 +1,170 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "TestUtilities.h"
+#include "EmaPool.h"
+#include "rtr/rsslThread.h"
+
+using namespace thomsonreuters::ema::access;
+using namespace std;
+
+class PoolTestItem
+{
+public :
+
+	PoolTestItem() : _cleared( false ), _atExit( false ) {}
+
+	void clear() { _cleared = true; }
+
+	void setAtExit() { _atExit = true; ++_atExitCount; }
+
+	bool	_cleared;
+	bool	_atExit;
+
+	static int	_atExitCount;
+};
+
+int PoolTestItem::_atExitCount = 0;
+
+TEST(EmaPoolTest, threadCacheHitsAndMisses)
+{
+	EncoderPool< PoolTestItem > pool( 5 );
+	PoolStatistics statistics;
+
+	PoolTestItem* item = pool.getItem();
+	EXPECT_EQ( pool.count(), 0 ) << "Pool is empty after creating an item";
+
+	pool.returnItem( item );
+	EXPECT_TRUE( item->_cleared ) << "EncoderPool clears returned items";
+	EXPECT_EQ( pool.count(), 1 ) << "Returned item is counted";
+
+	EXPECT_EQ( pool.getItem(), item ) << "Returned item is reused by the same thread";
+	pool.returnItem( item );
+
+	pool.getStatistics( statistics );
+	EXPECT_EQ( statistics.getHitCount(), 1 ) << "Second getItem() was served from the thread cache";
+	EXPECT_EQ( statistics.getMissCount(), 1 ) << "First getItem() missed the thread cache";
+	EXPECT_EQ( statistics.getCreateCount(), 1 ) << "First getItem() created an item";
+	EXPECT_EQ( statistics.getHitRate(), 0.5 ) << "Hit rate is hits over getItem() calls";
+	EXPECT_EQ( statistics.getMissRate(), 0.5 ) << "Miss rate is misses over getItem() calls";
+}
+
+TEST(EmaPoolTest, threadCacheSpill)
+{
+	const UInt32 itemCount = EMA_POOL_THREAD_CACHE_SIZE + EMA_POOL_FREE_LIST_SIZE + 10;
+	EncoderPool< PoolTestItem > pool( 5 );
+	PoolStatistics statistics;
+	PoolTestItem* items[ itemCount ];
+	UInt32 idx;
+
+	for ( idx = 0; idx < itemCount; ++idx )
+		items[ idx ] = pool.getItem();
+
+	// overfills the thread cache and the shared free list, so the locked vector is used as well
+	for ( idx = 0; idx < itemCount; ++idx )
+		pool.returnItem( items[ idx ] );
+
+	EXPECT_EQ( pool.count(), itemCount ) << "All returned items are counted";
+
+	pool.getStatistics( statistics );
+	EXPECT_EQ( statistics.getCreateCount(), itemCount ) << "Each getItem() created an item";
+	EXPECT_EQ( statistics.getSpillCount() % ( EMA_POOL_THREAD_CACHE_SIZE / 2 ), 0 ) << "Full thread cache spills half of its items";
+	EXPECT_GE( statistics.getSpillCount(), itemCount - EMA_POOL_THREAD_CACHE_SIZE ) << "Thread cache keeps at most its capacity";
+	EXPECT_LT( statistics.getSpillCount(), itemCount - EMA_POOL_THREAD_CACHE_SIZE / 2 ) << "Thread cache is left more than half full";
+
+	// takes everything back out, from the thread cache, then the free list, then the locked vector
+	for ( idx = 0; idx < itemCount; ++idx )
+		items[ idx ] = pool.getItem();
+
+	EXPECT_EQ( pool.count(), 0 ) << "Pool is empty";
+
+	pool.getStatistics( statistics );
+	EXPECT_EQ( statistics.getCreateCount(), itemCount ) << "No item was created while the pool had free items";
+
+	for ( idx = 0; idx < itemCount; ++idx )
+		for ( UInt32 other = idx + 1; other < itemCount; ++other )
+			ASSERT_NE( items[ idx ], items[ other ] ) << "Pool never hands out the same item twice";
+
+	for ( idx = 0; idx < itemCount; ++idx )
+		pool.returnItem( items[ idx ] );
+
+	pool.clear();
+	EXPECT_EQ( pool.count(), 0 ) << "clear() destroys items from the thread cache as well";
+}
+
+TEST(EmaPoolTest, decoderPoolClear)
+{
+	PoolTestItem::_atExitCount = 0;
+
+	{
+		DecoderPool< PoolTestItem > pool( 5 );
+
+		PoolTestItem* item1 = pool.getItem();
+		PoolTestItem* item2 = pool.getItem();
+
+		pool.returnItem( item1 );
+		pool.returnItem( item2 );
+		EXPECT_FALSE( item1->_cleared ) << "DecoderPool does not clear returned items";
+
+		pool.clear();
+		EXPECT_EQ( PoolTestItem::_atExitCount, 2 ) << "DecoderPool sets at exit on destroyed items";
+	}
+
+	EXPECT_EQ( PoolTestItem::_atExitCount, 2 ) << "Destroying an empty pool destroys nothing";
+}
+
+struct PoolTestThread
+{
+	EncoderPool< PoolTestItem >*	pPool;
+	int								iterations;
+};
+
+RSSL_THREAD_DECLARE( poolTestThread, pArg )
+{
+	PoolTestThread* pThread = (PoolTestThread*)pArg;
+	PoolTestItem* items[ 8 ];
+
+	for ( int i = 0; i < pThread->iterations; ++i )
+	{
+		int count = 1 + i % 8;
+
+		for ( int idx = 0; idx < count; ++idx )
+			items[ idx ] = pThread->pPool->getItem();
+
+		for ( int idx = 0; idx < count; ++idx )
+			pThread->pPool->returnItem( items[ idx ] );
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+TEST(EmaPoolTest, multipleThreads)
+{
+	EncoderPool< PoolTestItem > pool( 5 );
+	PoolStatistics statistics;
+	PoolTestThread threadArgs[ 4 ];
+	RsslThreadId threadIds[ 4 ];
+	int idx;
+
+	for ( idx = 0; idx < 4; ++idx )
+	{
+		threadArgs[ idx ].pPool = &pool;
+		threadArgs[ idx ].iterations = 100000;
+		RSSL_THREAD_START( &threadIds[ idx ], poolTestThread, &threadArgs[ idx ] );
+	}
+
+	for ( idx = 0; idx < 4; ++idx )
+		RSSL_THREAD_JOIN( threadIds[ idx ] );
+
+	pool.getStatistics( statistics );
+
+	// each thread returns its cached items to the pool when it exits
+	EXPECT_EQ( pool.count(), statistics.getCreateCount() ) << "Every created item is back in the pool";
+	EXPECT_LE( statistics.getCreateCount(), 4 * 8 ) << "Each thread reuses its own items";
+	EXPECT_GT( statistics.getHitRate(), 0.9 ) << "Most getItem() calls are served from the thread caches";
+}
@@ -4336,4 +4336,202 @@ TEST(FieldListTests, testFieldListClear_Encode_Decode)
 	{
 		EXPECT_FALSE(true) << "Fails to encode and decode FieldList - exception not expected with text" << exp.getText().c_str();
 	}
-}
\ No newline at end of file
+}
+TEST(FieldListTests, testFieldListForthFieldId)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE(loadDictionaryFromFile(&dictionary)) << "Failed to load dictionary";
+
+	try
+	{
+		// BID, ASK, BID, BIDSIZE, ASK; the mantissa records the entry position
+		FieldList flEnc;
+		flEnc.addReal(22, 0, OmmReal::ExponentNeg2Enum)
+			.addReal(25, 1, OmmReal::ExponentNeg2Enum)
+			.addReal(22, 2, OmmReal::ExponentNeg2Enum)
+			.addReal(30, 3, OmmReal::Exponent0Enum)
+			.addReal(25, 4, OmmReal::ExponentNeg2Enum)
+			.complete();
+
+		StaticDecoder::setData(&flEnc, &dictionary);
+
+		// Duplicate field ids are found in order, then the list is exhausted
+		EXPECT_TRUE(flEnc.forth(22)) << "FieldList::forth(22) - first BID";
+		EXPECT_EQ(flEnc.getEntry().getFieldId(), 22) << "FieldEntry::getFieldId()";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 0) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(flEnc.forth(22)) << "FieldList::forth(22) - second BID";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 2) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_FALSE(flEnc.forth(22)) << "FieldList::forth(22) - no third BID";
+		EXPECT_FALSE(flEnc.forth()) << "FieldList::forth() after a failed forth(22)";
+
+		// After reset() lookups start again from the beginning
+		flEnc.reset();
+		EXPECT_TRUE(flEnc.forth(30)) << "FieldList::forth(30) after reset()";
+		EXPECT_EQ(flEnc.getEntry().getFieldId(), 30) << "FieldEntry::getFieldId()";
+		EXPECT_STREQ(flEnc.getEntry().getName(), "BIDSIZE") << "FieldEntry::getName()";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 3) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(flEnc.forth()) << "FieldList::forth() after forth(30)";
+		EXPECT_EQ(flEnc.getEntry().getFieldId(), 25) << "FieldEntry::getFieldId()";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 4) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_FALSE(flEnc.forth(22)) << "FieldList::forth(22) past the last BID";
+
+		// Mixed forth() and forth(fid) move through the same entries
+		flEnc.reset();
+		EXPECT_TRUE(flEnc.forth()) << "FieldList::forth() - first entry";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 0) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(flEnc.forth(25)) << "FieldList::forth(25) - first ASK";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 1) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(flEnc.forth()) << "FieldList::forth() - entry after the first ASK";
+		EXPECT_EQ(flEnc.getEntry().getFieldId(), 22) << "FieldEntry::getFieldId()";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 2) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(flEnc.forth(25)) << "FieldList::forth(25) - second ASK";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 4) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_FALSE(flEnc.forth()) << "FieldList::forth() - end of list";
+
+		// A field id that is not present exhausts the list
+		flEnc.reset();
+		EXPECT_FALSE(flEnc.forth(6)) << "FieldList::forth(6) - TRDPRC_1 not present";
+		EXPECT_FALSE(flEnc.forth()) << "FieldList::forth() after a failed forth(6)";
+
+		// A view list selects any of its field ids, in list order
+		flEnc.reset();
+		ElementList view;
+		view.addArray(":ViewData", OmmArray().addInt(30).addInt(25).complete()).complete();
+		EXPECT_TRUE(flEnc.forth(view)) << "FieldList::forth(view) - first match";
+		EXPECT_EQ(flEnc.getEntry().getFieldId(), 25) << "FieldEntry::getFieldId()";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 1) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(flEnc.forth(view)) << "FieldList::forth(view) - second match";
+		EXPECT_EQ(flEnc.getEntry().getFieldId(), 30) << "FieldEntry::getFieldId()";
+		EXPECT_TRUE(flEnc.forth(view)) << "FieldList::forth(view) - third match";
+		EXPECT_EQ(flEnc.getEntry().getFieldId(), 25) << "FieldEntry::getFieldId()";
+		EXPECT_EQ(flEnc.getEntry().getReal().getMantissa(), 4) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_FALSE(flEnc.forth(view)) << "FieldList::forth(view) - no more matches";
+
+		// The view list is honoured after mixing with forth()
+		flEnc.reset();
+		EXPECT_TRUE(flEnc.forth()) << "FieldList::forth() - first entry";
+		EXPECT_TRUE(flEnc.forth()) << "FieldList::forth() - second entry";
+		EXPECT_TRUE(flEnc.forth(view)) << "FieldList::forth(view) - after two entries";
+		EXPECT_EQ(flEnc.getEntry().getFieldId(), 30) << "FieldEntry::getFieldId()";
+
+		// Decoding a different list does not reuse the previous index
+		FieldList flOther;
+		flOther.addReal(25, 7, OmmReal::ExponentNeg2Enum).addReal(22, 8, OmmReal::ExponentNeg2Enum).complete();
+		StaticDecoder::setData(&flOther, &dictionary);
+		EXPECT_TRUE(flOther.forth(22)) << "FieldList::forth(22) in another list";
+		EXPECT_EQ(flOther.getEntry().getReal().getMantissa(), 8) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_FALSE(flOther.forth(25)) << "FieldList::forth(25) behind the current entry";
+	}
+	catch (const OmmException& excp)
+	{
+		EXPECT_FALSE(true) << "FieldList::forth(fid) - exception not expected" << excp << endl;
+	}
+
+	rsslDeleteDataDictionary(&dictionary);
+}
+
+TEST(FieldListTests, testFieldListForthFieldIdSetDefined)
+{
+	RsslDataDictionary dictionary;
+
+	ASSERT_TRUE(loadDictionaryFromFile(&dictionary)) << "Failed to load dictionary";
+
+	RsslEncodeIterator encodeIter;
+	rsslClearEncodeIterator(&encodeIter);
+	rsslSetEncodeIteratorRWFVersion(&encodeIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+
+	char mapData[1024];
+	RsslBuffer mapBuffer;
+	mapBuffer.length = sizeof(mapData);
+	mapBuffer.data = mapData;
+	rsslSetEncodeIteratorBuffer(&encodeIter, &mapBuffer);
+
+	RsslMap rsslMap;
+	rsslClearMap(&rsslMap);
+	rsslMap.flags = RSSL_MPF_HAS_SET_DEFS;
+	rsslMap.containerType = RSSL_DT_FIELD_LIST;
+	rsslMap.keyPrimitiveType = RSSL_DT_UINT;
+	rsslEncodeMapInit(&encodeIter, &rsslMap, 0, 0);
+
+	// Set entries BID and ASK, then standard entries BIDSIZE and BID
+	RsslFieldSetDefEntry fieldSetDefEntries[2] =
+	{
+		{ 22, RSSL_DT_REAL },
+		{ 25, RSSL_DT_REAL }
+	};
+	RsslLocalFieldSetDefDb fieldSetDefDb;
+	RsslFieldSetDef fieldSetDef;
+	fieldSetDef.setId = 5;
+	fieldSetDef.count = 2;
+	fieldSetDef.pEntries = fieldSetDefEntries;
+	rsslClearLocalFieldSetDefDb(&fieldSetDefDb);
+	fieldSetDefDb.definitions[5] = fieldSetDef;
+
+	rsslEncodeLocalFieldSetDefDb(&encodeIter, &fieldSetDefDb);
+	rsslEncodeMapSetDefsComplete(&encodeIter, RSSL_TRUE);
+
+	RsslMapEntry mapEntry;
+	rsslClearMapEntry(&mapEntry);
+	mapEntry.action = RSSL_MPEA_ADD_ENTRY;
+	const RsslUInt rsslUInt = 1;
+	rsslEncodeMapEntryInit(&encodeIter, &mapEntry, &rsslUInt, 0);
+
+	RsslFieldList fieldList;
+	rsslClearFieldList(&fieldList);
+	fieldList.setId = 5;
+	fieldList.flags = RSSL_FLF_HAS_SET_ID | RSSL_FLF_HAS_SET_DATA | RSSL_FLF_HAS_STANDARD_DATA;
+	rsslEncodeFieldListInit(&encodeIter, &fieldList, &fieldSetDefDb, 0);
+
+	const RsslFieldId fids[4] = { 22, 25, 30, 22 };
+	for (int i = 0; i < 4; ++i)
+	{
+		RsslFieldEntry fieldEntry;
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = fids[i];
+		fieldEntry.dataType = RSSL_DT_REAL;
+		RsslReal rsslReal;
+		rsslClearReal(&rsslReal);
+		rsslReal.hint = RSSL_RH_EXPONENT_2;
+		rsslReal.value = i;
+		rsslEncodeFieldEntry(&encodeIter, &fieldEntry, &rsslReal);
+	}
+
+	rsslEncodeFieldListComplete(&encodeIter, RSSL_TRUE);
+	rsslEncodeMapEntryComplete(&encodeIter, RSSL_TRUE);
+	rsslEncodeMapComplete(&encodeIter, RSSL_TRUE);
+	mapBuffer.length = rsslGetEncodedBufferLength(&encodeIter);
+
+	try
+	{
+		Map map;
+		StaticDecoder::setRsslData(&map, &mapBuffer, RSSL_DT_MAP, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION, &dictionary);
+
+		EXPECT_TRUE(map.forth()) << "Map::forth() - first entry";
+		const FieldList& fl = map.getEntry().getFieldList();
+
+		EXPECT_TRUE(fl.forth(25)) << "FieldList::forth(25) - set entry";
+		EXPECT_EQ(fl.getEntry().getReal().getMantissa(), 1) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(fl.forth(22)) << "FieldList::forth(22) - standard entry after the set entries";
+		EXPECT_EQ(fl.getEntry().getReal().getMantissa(), 3) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_FALSE(fl.forth(30)) << "FieldList::forth(30) - behind the current entry";
+
+		fl.reset();
+		EXPECT_TRUE(fl.forth(22)) << "FieldList::forth(22) after reset() - set entry";
+		EXPECT_EQ(fl.getEntry().getReal().getMantissa(), 0) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(fl.forth()) << "FieldList::forth() - second set entry";
+		EXPECT_EQ(fl.getEntry().getFieldId(), 25) << "FieldEntry::getFieldId()";
+		EXPECT_TRUE(fl.forth()) << "FieldList::forth() - first standard entry";
+		EXPECT_EQ(fl.getEntry().getFieldId(), 30) << "FieldEntry::getFieldId()";
+		EXPECT_EQ(fl.getEntry().getReal().getMantissa(), 2) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_TRUE(fl.forth(22)) << "FieldList::forth(22) - standard entry";
+		EXPECT_EQ(fl.getEntry().getReal().getMantissa(), 3) << "FieldEntry::getReal().getMantissa()";
+		EXPECT_FALSE(fl.forth()) << "FieldList::forth() - end of list";
+	}
+	catch (const OmmException& excp)
+	{
+		EXPECT_FALSE(true) << "FieldList::forth(fid) on set defined data - exception not expected" << excp << endl;
+	}
+
+	rsslDeleteDataDictionary(&dictionary);
+}
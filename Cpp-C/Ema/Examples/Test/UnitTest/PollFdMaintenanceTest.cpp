@@ -8,12 +8,17 @@
 
 #include "TestUtilities.h"
 #include "Access/Impl/OmmBaseImplMap.h"
+#include "GetTime.h"
 #include <vector>
 
+#ifdef USING_EPOLL
+#include <unistd.h>
+#endif
+
 using namespace thomsonreuters::ema::access;
 using namespace std;
 
-#ifdef USING_POLL
+#if defined( USING_POLL ) && !defined( USING_EPOLL )
 class EventFds : public OmmCommonImpl {
 public:
   EventFds() {
@@ -109,3 +114,116 @@ TEST(PollFdMaintenanceTest, eventFds)
   EventFds eventFds;
 }
 #endif
+
+#ifdef USING_EPOLL
+class EpollEventFds : public OmmCommonImpl {
+public:
+  EpollEventFds() {
+	EXPECT_TRUE(createEventFds());
+  }
+
+  ~EpollEventFds() {
+	destroyEventFds();
+  }
+
+  using OmmCommonImpl::addFd;
+  using OmmCommonImpl::removeFd;
+  using OmmCommonImpl::waitEventFds;
+  using OmmCommonImpl::getNotifiedEvents;
+
+  nfds_t getEventFdsCount() const { return _eventFdsCount; }
+
+private:
+  // all needed because of pure virtual functions
+  ImplementationType getImplType() { return ConsumerEnum; }
+  void handleIue(const EmaString&, Int32) {}
+  void handleIue(const char*, Int32) {}
+  void handleIhe(UInt64, const EmaString&) {}
+  void handleIhe(UInt64, const char*) {}
+  void handleMee(const char*) {}
+  LoggerConfig& getActiveLoggerConfig() {}
+  OmmLoggerClient& getOmmLoggerClient() {}
+  ErrorClientHandler& getErrorClientHandler() {}
+  bool hasErrorClientHandler() const {}
+  EmaString& getInstanceName() const {}
+  void msgDispatched(bool value = true) {}
+  Mutex& getUserMutex() {}
+  bool isAtExit() {}
+};
+
+TEST(PollFdMaintenanceTest, epollEventFds)
+{
+  EpollEventFds eventFds;
+  char byte = 'x';
+  int pipes[20][2];
+
+  for (int i = 0; i < 20; ++i)
+	ASSERT_EQ(pipe(pipes[i]), 0);
+
+  // more descriptors than the initial capacity of the event buffer
+  for (int i = 0; i < 20; ++i)
+	EXPECT_EQ(eventFds.addFd(pipes[i][0], POLLIN | POLLERR | POLLHUP), i);
+  EXPECT_EQ(eventFds.getEventFdsCount(), 20);
+
+  // adding a descriptor again only updates it
+  EXPECT_EQ(eventFds.addFd(pipes[0][0]), 19);
+  EXPECT_EQ(eventFds.getEventFdsCount(), 20);
+
+  EXPECT_EQ(eventFds.waitEventFds(0, 0), 0);
+
+  for (int i = 0; i < 20; ++i)
+	ASSERT_EQ(write(pipes[i][1], &byte, 1), 1);
+
+  EXPECT_EQ(eventFds.waitEventFds(0, 0), 20);
+  for (int i = 0; i < 20; ++i)
+	EXPECT_TRUE((eventFds.getNotifiedEvents(pipes[i][0]) & EPOLLIN) != 0);
+
+  // removed descriptors are neither reported by the last wait nor by the next one
+  for (int i = 10; i < 20; ++i)
+	eventFds.removeFd(pipes[i][0]);
+  EXPECT_EQ(eventFds.getEventFdsCount(), 10);
+  EXPECT_EQ(eventFds.getNotifiedEvents(pipes[15][0]), 0);
+  EXPECT_EQ(eventFds.waitEventFds(0, 0), 10);
+
+  // removing a descriptor that is not there
+  eventFds.removeFd(pipes[15][0]);
+  EXPECT_EQ(eventFds.getEventFdsCount(), 10);
+
+  for (int i = 0; i < 10; ++i)
+	ASSERT_EQ(read(pipes[i][0], &byte, 1), 1);
+  EXPECT_EQ(eventFds.waitEventFds(0, 0), 0);
+  EXPECT_EQ(eventFds.getNotifiedEvents(pipes[0][0]), 0);
+
+  // microsecond timeouts are honored and spinning does not extend them
+  UInt64 startTime = GetTime::getMicros();
+  EXPECT_EQ(eventFds.waitEventFds(1500, 0), 0);
+  EXPECT_GE(GetTime::getMicros() - startTime, 1500);
+
+  startTime = GetTime::getMicros();
+  EXPECT_EQ(eventFds.waitEventFds(1500, 500), 0);
+  EXPECT_GE(GetTime::getMicros() - startTime, 1500);
+
+  startTime = GetTime::getMicros();
+  EXPECT_EQ(eventFds.waitEventFds(500, 100000), 0);
+  EXPECT_LT(GetTime::getMicros() - startTime, 100000);
+
+  // a ready descriptor is found while spinning
+  ASSERT_EQ(write(pipes[3][1], &byte, 1), 1);
+  EXPECT_EQ(eventFds.waitEventFds(-1, 1000), 1);
+  EXPECT_TRUE((eventFds.getNotifiedEvents(pipes[3][0]) & EPOLLIN) != 0);
+
+  // a closed descriptor has already left the epoll set
+  close(pipes[3][0]);
+  close(pipes[3][1]);
+  eventFds.removeFd(pipes[3][0]);
+  EXPECT_EQ(eventFds.getEventFdsCount(), 9);
+  EXPECT_EQ(eventFds.waitEventFds(0, 0), 0);
+
+  for (int i = 0; i < 20; ++i)
+	if (i != 3)
+	{
+	  close(pipes[i][0]);
+	  close(pipes[i][1]);
+	}
+}
+#endif
@@ -145,6 +145,7 @@ BaseConfig::BaseConfig() :
 	itemCountHint(DEFAULT_ITEM_COUNT_HINT),
 	serviceCountHint(DEFAULT_SERVICE_COUNT_HINT),
 	dispatchTimeoutApiThread(DEFAULT_DISPATCH_TIMEOUT_API_THREAD),
+	dispatchSpinTimeApiThread(DEFAULT_DISPATCH_SPIN_TIME_API_THREAD),
 	maxDispatchCountApiThread(DEFAULT_MAX_DISPATCH_COUNT_API_THREAD),
 	maxDispatchCountUserThread(DEFAULT_MAX_DISPATCH_COUNT_USER_THREAD),
 	maxEventsInPool(DEFAULT_MAX_EVENT_IN_POOL),
@@ -187,6 +188,7 @@ void BaseConfig::clear()
 	itemCountHint = DEFAULT_ITEM_COUNT_HINT;
 	serviceCountHint = DEFAULT_SERVICE_COUNT_HINT;
 	dispatchTimeoutApiThread = DEFAULT_DISPATCH_TIMEOUT_API_THREAD;
+	dispatchSpinTimeApiThread = DEFAULT_DISPATCH_SPIN_TIME_API_THREAD;
 	maxDispatchCountApiThread = DEFAULT_MAX_DISPATCH_COUNT_API_THREAD;
 	maxDispatchCountUserThread = DEFAULT_MAX_DISPATCH_COUNT_USER_THREAD;
 	maxEventsInPool = DEFAULT_MAX_EVENT_IN_POOL;
@@ -224,6 +226,7 @@ EmaString BaseConfig::configTrace()
 		.append("\n\t itemCountHint: ").append(itemCountHint)
 		.append("\n\t serviceCountHint: ").append(serviceCountHint)
 		.append("\n\t dispatchTimeoutApiThread: ").append(dispatchTimeoutApiThread)
+		.append("\n\t dispatchSpinTimeApiThread: ").append(dispatchSpinTimeApiThread)
 		.append("\n\t maxDispatchCountApiThread: ").append(maxDispatchCountApiThread)
 		.append("\n\t maxDispatchCountUserThread : ").append(maxDispatchCountUserThread)
 		.append("\n\t maxEventsInPool : ").append(maxEventsInPool)
@@ -524,6 +527,7 @@ bool ActiveConfig::findChannelConfig( EmaVector< ChannelConfig* >& cfgChannelSet
 
 ActiveServerConfig::ActiveServerConfig(const EmaString& defaultServiceName) :
 	pipePort(DEFAULT_SERVER_PIPE_PORT),
+	serverShardCount(DEFAULT_SERVER_SHARD_COUNT),
 	acceptMessageWithoutBeingLogin(DEFAULT_ACCEPT_MSG_WITHOUT_BEING_LOGIN),
 	acceptMessageWithoutAcceptingRequests(DEFAULT_ACCEPT_MSG_WITHOUT_ACCEPTING_REQUESTS),
 	acceptDirMessageWithoutMinFilters(DEFAULT_ACCEPT_DIR_MSG_WITHOUT_MIN_FILTERS),
@@ -553,6 +557,7 @@ ActiveServerConfig::~ActiveServerConfig()
 void ActiveServerConfig::clear()
 {
 	pipePort = DEFAULT_SERVER_PIPE_PORT;
+	serverShardCount = DEFAULT_SERVER_SHARD_COUNT;
 	acceptMessageWithoutBeingLogin = DEFAULT_ACCEPT_MSG_WITHOUT_BEING_LOGIN;
 	acceptMessageWithoutAcceptingRequests = DEFAULT_ACCEPT_MSG_WITHOUT_ACCEPTING_REQUESTS;
 	acceptDirMessageWithoutMinFilters = DEFAULT_ACCEPT_DIR_MSG_WITHOUT_MIN_FILTERS;
@@ -569,6 +574,7 @@ EmaString ActiveServerConfig::configTrace()
 {
 	BaseConfig::configTrace();
 	traceStr.append("\n\t pipePort: ").append(pipePort)
+		.append("\n\t serverShardCount: ").append(serverShardCount)
 		.append("\n\t acceptMessageWithoutBeingLogin: ").append(acceptMessageWithoutBeingLogin)
 		.append("\n\t acceptMessageWithoutAcceptingRequests: ").append(acceptMessageWithoutAcceptingRequests)
 		.append("\n\t acceptDirMessageWithoutMinFilters: ").append(acceptDirMessageWithoutMinFilters)
@@ -579,6 +585,15 @@ EmaString ActiveServerConfig::configTrace()
 	return traceStr;
 }
 
+void ActiveServerConfig::setServerShardCount(UInt64 value)
+{
+	if (value <= 0) {}
+	else if (value > MAX_SERVER_SHARD_COUNT)
+		serverShardCount = MAX_SERVER_SHARD_COUNT;
+	else
+		serverShardCount = (UInt32)value;
+}
+
 ServiceDictionaryConfig*	ActiveServerConfig::getServiceDictionaryConfig(UInt16 serviceId)
 {
 	ServiceDictionaryConfig** serviceDictionaryConfigPtr = _serviceDictionaryConfigHash.find(serviceId);
@@ -644,6 +659,8 @@ ChannelConfig::ChannelConfig( RsslConnectionTypes type ) :
 	sysSendBufSize( DEFAULT_SYS_SEND_BUFFER_SIZE ),
 	sysRecvBufSize( DEFAULT_SYS_RECEIVE_BUFFER_SIZE ),
 	highWaterMark( DEFAULT_HIGH_WATER_MARK ),
+	autoPackSize( DEFAULT_AUTO_PACK_SIZE ),
+	autoPackDelay( DEFAULT_AUTO_PACK_DELAY ),
 	pChannel( 0 ),
 	compressionThresholdSet(false)
 {
@@ -662,6 +679,8 @@ void ChannelConfig::clear()
 	sysSendBufSize = DEFAULT_SYS_SEND_BUFFER_SIZE;
 	sysRecvBufSize = DEFAULT_SYS_RECEIVE_BUFFER_SIZE;
 	highWaterMark = DEFAULT_HIGH_WATER_MARK;
+	autoPackSize = DEFAULT_AUTO_PACK_SIZE;
+	autoPackDelay = DEFAULT_AUTO_PACK_DELAY;
 	pChannel = 0;
 	compressionThresholdSet = false;
 }
@@ -702,6 +721,8 @@ ServerConfig::ServerConfig( RsslConnectionTypes type ) :
 	sysSendBufSize(DEFAULT_PROVIDER_SYS_SEND_BUFFER_SIZE),
 	sysRecvBufSize(DEFAULT_PROVIDER_SYS_RECEIVE_BUFFER_SIZE),
 	highWaterMark(DEFAULT_HIGH_WATER_MARK),
+	autoPackSize(DEFAULT_AUTO_PACK_SIZE),
+	autoPackDelay(DEFAULT_AUTO_PACK_DELAY),
 	compressionThresholdSet(false)
 {
 
@@ -727,6 +748,8 @@ void ServerConfig::clear()
 	sysRecvBufSize = DEFAULT_PROVIDER_SYS_RECEIVE_BUFFER_SIZE;
 	sysSendBufSize = DEFAULT_PROVIDER_SYS_SEND_BUFFER_SIZE;
 	highWaterMark = DEFAULT_HIGH_WATER_MARK;
+	autoPackSize = DEFAULT_AUTO_PACK_SIZE;
+	autoPackDelay = DEFAULT_AUTO_PACK_DELAY;
 	compressionThresholdSet = false;
 }
 
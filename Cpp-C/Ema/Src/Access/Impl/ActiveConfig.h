@@ -36,6 +36,7 @@
 #define DEFAULT_DICTIONARY_TYPE							Dictionary::FileDictionaryEnum
 #define DEFAULT_DIRECTORY_REQUEST_TIMEOUT				45000
 #define DEFAULT_DISPATCH_TIMEOUT_API_THREAD				-1
+#define DEFAULT_DISPATCH_SPIN_TIME_API_THREAD			0
 #define DEFAULT_EDP_RT_LOCATION							EmaString( "us-east" )
 #define DEFAULT_REISSUE_TOKEN_ATTEMP_LIMIT				-1
 #define DEFAULT_REISSUE_TOKEN_ATTEMP_INTERVAL			5000
@@ -47,6 +48,8 @@
 #define DEFAULT_PROVIDER_SYS_SEND_BUFFER_SIZE	        65535	
 #define DEFAULT_PROVIDER_SYS_RECEIVE_BUFFER_SIZE        65535	
 #define DEFAULT_HIGH_WATER_MARK						    0
+#define DEFAULT_AUTO_PACK_SIZE						    0
+#define DEFAULT_AUTO_PACK_DELAY						    0
 #define DEFAULT_HANDLE_EXCEPTION					    true
 #define DEFAULT_HOST_NAME							    EmaString( "localhost" )
 #define DEFAULT_CHANNEL_SET_NAME					    EmaString( "" )
@@ -78,6 +81,8 @@
 #define DEFAULT_SSL_CA_STORE						   EmaString( "" )
 #define DEFAULT_TCP_NODELAY							   RSSL_TRUE
 #define DEFAULT_SERVER_SHAREDSOCKET					   RSSL_FALSE
+#define DEFAULT_SERVER_SHARD_COUNT					   1
+#define MAX_SERVER_SHARD_COUNT						   256
 #define DEFAULT_CONS_MCAST_CFGSTRING				   EmaString( "" )
 #define DEFAULT_PACKET_TTL							  5
 #define DEFAULT_NDATA								  7
@@ -166,6 +171,8 @@ public :
 	UInt32					sysRecvBufSize;
 	UInt32					sysSendBufSize;
 	UInt32					highWaterMark;
+	UInt32					autoPackSize;
+	UInt32					autoPackDelay;
 	Channel*				pChannel;
 
 private :
@@ -207,6 +214,8 @@ public:
 	UInt32					sysRecvBufSize;
 	UInt32					sysSendBufSize;
 	UInt32					highWaterMark;
+	UInt32					autoPackSize;
+	UInt32					autoPackDelay;
 
 private:
 
@@ -428,6 +437,7 @@ public:
 	UInt32					itemCountHint;
 	UInt32					serviceCountHint;
 	Int64					dispatchTimeoutApiThread;
+	Int64					dispatchSpinTimeApiThread;
 	UInt32					maxDispatchCountApiThread;
 	UInt32					maxDispatchCountUserThread;
 	Int32					maxEventsInPool;
@@ -535,9 +545,13 @@ public:
 
 	virtual OmmIProviderConfig::AdminControl getDirectoryAdminControl() = 0;
 
+	void setServerShardCount(UInt64 value);
+
 	Int64						pipePort;
 	AdminRefreshMsg*			pDirectoryRefreshMsg;
 
+	UInt32						serverShardCount;
+
 	ServerConfig*				pServerConfig;
 
 	bool                        acceptMessageWithoutBeingLogin;
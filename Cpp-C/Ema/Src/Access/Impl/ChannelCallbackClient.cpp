@@ -398,6 +398,13 @@ void ChannelCallbackClient::channelParametersToString(ActiveConfig& activeConfig
 		.append( "tcpNodelay " ).append( ( pTempChannelCfg->tcpNodelay ? "true" : "false" ) ).append( CR );
 		break;
 	}
+	case RSSL_CONN_TYPE_BIDIR_SHMEM:
+	{
+		SocketChannelConfig* pTempChannelCfg = static_cast<SocketChannelConfig*>( pChannelCfg );
+		strConnectionType = "RSSL_CONN_TYPE_BIDIR_SHMEM";
+		cfgParameters.append( "port " ).append( pTempChannelCfg->serviceName ).append( CR );
+		break;
+	}
 	case RSSL_CONN_TYPE_HTTP:
 	case RSSL_CONN_TYPE_WEBSOCKET:
 	{
@@ -562,7 +569,8 @@ void ChannelCallbackClient::initialize( RsslRDMLoginRequest* loginRequest, RsslR
 		     activeConfigChannelSet[i]->connectionType == RSSL_CONN_TYPE_HTTP ||
 		     activeConfigChannelSet[i]->connectionType == RSSL_CONN_TYPE_ENCRYPTED ||
 		     activeConfigChannelSet[i]->connectionType == RSSL_CONN_TYPE_RELIABLE_MCAST ||
-		     activeConfigChannelSet[i]->connectionType == RSSL_CONN_TYPE_WEBSOCKET )
+		     activeConfigChannelSet[i]->connectionType == RSSL_CONN_TYPE_WEBSOCKET ||
+		     activeConfigChannelSet[i]->connectionType == RSSL_CONN_TYPE_BIDIR_SHMEM )
 		{
 			Channel* pChannel = Channel::create( _ommBaseImpl, activeConfigChannelSet[i]->name, _pRsslReactor );
 
@@ -604,6 +612,7 @@ void ChannelCallbackClient::initialize( RsslRDMLoginRequest* loginRequest, RsslR
 			case RSSL_CONN_TYPE_SOCKET:
 			case RSSL_CONN_TYPE_HTTP:
 			case RSSL_CONN_TYPE_WEBSOCKET:
+			case RSSL_CONN_TYPE_BIDIR_SHMEM:
 			{
 				reactorConnectInfo[i].rsslConnectOptions.compressionType = activeConfigChannelSet[i]->compressionType;
 				reactorConnectInfo[i].rsslConnectOptions.connectionInfo.unified.address = ( char* )(static_cast<SocketChannelConfig*>( activeConfigChannelSet[i] )->hostName.c_str());
@@ -926,6 +935,37 @@ RsslReactorCallbackRet ChannelCallbackClient::processCallback( RsslReactor* pRss
 			}
 		}
 
+		// set the auto-pack size and delay if configured
+		if ( pChannelConfig->autoPackSize > 0 )
+		{
+			if ( rsslReactorChannelIoctl( pRsslReactorChannel, RSSL_AUTO_PACK_DELAY, &pChannelConfig->autoPackDelay, &rsslErrorInfo ) != RSSL_RET_SUCCESS ||
+				rsslReactorChannelIoctl( pRsslReactorChannel, RSSL_AUTO_PACK_SIZE, &pChannelConfig->autoPackSize, &rsslErrorInfo ) != RSSL_RET_SUCCESS )
+			{
+				if ( OmmLoggerClient::ErrorEnum >= _ommBaseImpl.getActiveConfig().loggerConfig.minLoggerSeverity )
+				{
+					EmaString temp( "Failed to set auto-packing on channel " );
+					temp.append( pChannel->getName() ).append( CR )
+						.append( "Instance Name " ).append( _ommBaseImpl.getInstanceName() ).append( CR )
+						.append( "RsslReactor " ).append( ptrToStringAsHex( pRsslReactor ) ).append( CR )
+						.append( "RsslChannel " ).append( ptrToStringAsHex( rsslErrorInfo.rsslError.channel ) ).append( CR )
+						.append( "Error Id " ).append( rsslErrorInfo.rsslError.rsslErrorId ).append( CR )
+						.append( "Internal sysError " ).append( rsslErrorInfo.rsslError.sysError ).append( CR )
+						.append( "Error Location " ).append( rsslErrorInfo.errorLocation ).append( CR )
+						.append( "Error Text " ).append( rsslErrorInfo.rsslError.text );
+					_ommBaseImpl.getOmmLoggerClient().log( _clientName, OmmLoggerClient::ErrorEnum, temp.trimWhitespace() );
+				}
+			}
+			else if ( OmmLoggerClient::VerboseEnum >= _ommBaseImpl.getActiveConfig().loggerConfig.minLoggerSeverity )
+			{
+				EmaString temp( "auto-packing set on channel " );
+				temp.append( pChannel->getName() ).append( CR )
+					.append( "Instance Name " ).append( _ommBaseImpl.getInstanceName() ).append( CR )
+					.append( "AutoPackSize " ).append( pChannelConfig->autoPackSize ).append( CR )
+					.append( "AutoPackDelay " ).append( pChannelConfig->autoPackDelay );
+				_ommBaseImpl.getOmmLoggerClient().log( _clientName, OmmLoggerClient::VerboseEnum, temp );
+			}
+		}
+
 		ActiveConfig& activeConfig = _ommBaseImpl.getActiveConfig();
 		if ( activeConfig.xmlTraceToFile || activeConfig.xmlTraceToStdout )
 		{
@@ -63,6 +63,7 @@ const EmaString& ChannelInformation::toString() const {
 	case Ext_Line_SocketEnum: _toString.append( "extended line socket" ); break;
 	case Seq_McastEnum: _toString.append( "seqMCast" ); break;
 	case WebSocketEnum: _toString.append("websocket"); break;
+	case Bidir_ShmemEnum: _toString.append("bidirShmem"); break;
 	default: _toString.append( "unknown"); break;
   }
   _toString.append( "\n\tprotocol type: " );
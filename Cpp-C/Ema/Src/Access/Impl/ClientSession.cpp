@@ -26,11 +26,10 @@ ClientSession::ClientSession(OmmServerBaseImpl* ommServerBaseImpl) :
 	_isADHSession(false),
 	_loginHandle(0)
 {
-	_streamIdToItemInfoHash.rehash(_pOmmServerBaseImpl->getActiveConfig().itemCountHint);
-
+	/* ItemCountHint covers the whole server, so a session's own tables start small and grow with it */
 	if (!_pOmmServerBaseImpl->getActiveConfig().acceptMessageSameKeyButDiffStream)
 	{
-		_pItemInfoItemInfoHash = new ItemInfoToItemInfoHash(_pOmmServerBaseImpl->getActiveConfig().itemCountHint);
+		_pItemInfoItemInfoHash = new ItemInfoToItemInfoHash();
 	}
 	else
 	{
@@ -83,7 +82,7 @@ void ClientSession::destroy(ClientSession*& pClientSession)
 
 UInt64 ClientSession::getClientHandle() const
 {
-	return (UInt64)_pChannel;
+	return (UInt64)_pChannel | _pOmmServerBaseImpl->getHandleTag();
 }
 
 UInt64 ClientSession::getLoginHandle() const
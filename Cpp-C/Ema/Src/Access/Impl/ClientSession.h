@@ -10,7 +10,7 @@
 #define __thomsonreuters_ema_access_ClientSession_h
 
 #include "Common.h"
-#include "HashTable.h"
+#include "FlatHashTable.h"
 #include "ItemInfo.h"
 #include "EmaList.h"
 #include "EmaVector.h"
@@ -92,7 +92,7 @@ public:
 
 	typedef HashTable< EmaBuffer, EmaVector<ItemInfo*>*, EmaBufferHasher, EmaBufferEqual_To > GroupIdToInfoHash;
 
-	typedef HashTable< UInt64, GroupIdToInfoHash*, UInt64rHasher, UInt64Equal_To > ServiceGroupToItemInfoHash;
+	typedef FlatHashTable< UInt64, GroupIdToInfoHash*, UInt64rHasher, UInt64Equal_To > ServiceGroupToItemInfoHash;
 
 	EmaVector<GroupIdToInfoHash*>&		getServiceGroupToItemInfoList();
 
@@ -118,7 +118,7 @@ private:
 		bool operator()(const Int32&, const Int32&) const;
 	};
 
-	typedef HashTable< Int32, ItemInfo*, Int32rHasher, Int32Equal_To > StreamIdToItemInfoHash;
+	typedef FlatHashTable< Int32, ItemInfo*, Int32rHasher, Int32Equal_To > StreamIdToItemInfoHash;
 
 	class ItemInfoHasher
 	{
@@ -132,7 +132,7 @@ private:
 		bool operator()(const ItemInfo*, const ItemInfo*) const;
 	};
 
-	typedef HashTable< ItemInfo*, ItemInfo*, ItemInfoHasher, ItemInfoEqual_To > ItemInfoToItemInfoHash;
+	typedef FlatHashTable< ItemInfo*, ItemInfo*, ItemInfoHasher, ItemInfoEqual_To > ItemInfoToItemInfoHash;
 
 	EmaVector<GroupIdToInfoHash*>		_serviceGroupToItemInfoList;
 	ServiceGroupToItemInfoHash			_serviceGroupToItemInfoHash;
@@ -80,6 +80,7 @@ thomsonreuters::ema::access::EmaString EnumeratedValues[] = {
 
 thomsonreuters::ema::access::EmaString Int64Values[] = {
 	"DictionaryID",
+	"DispatchSpinTimeApiThread",
 	"DispatchTimeoutApiThread",
 	"PipePort",
 	"ReconnectAttemptLimit",
@@ -100,6 +101,8 @@ thomsonreuters::ema::access::EmaString UInt64Values[] = {
 	"AcceptMessageWithoutAcceptingRequests",
 	"AcceptMessageWithoutBeingLogin",
 	"AcceptMessageWithoutQosInRange",
+	"AutoPackDelay",
+	"AutoPackSize",
 	"CatchUnhandledException",
 	"CatchUnknownJsonFids",
 	"CatchUnknownJsonKeys",
@@ -140,6 +143,7 @@ thomsonreuters::ema::access::EmaString UInt64Values[] = {
 	"RemoveItemsOnDisconnect",
 	"RequestTimeout",
 	"RestRequestTimeOut",
+	"ServerShardCount",
 	"ServerSharedSocket",
 	"ServiceCountHint",
 	"ServiceId",
@@ -233,7 +233,7 @@ RsslReactorCallbackRet DictionaryHandler::dictionaryCallback(RsslReactor* pReact
 
 				if (ommServerBaseImpl->getDictionaryHandler()._apiAdminControl == false)
 				{
-					ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+					ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 					ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 					ommServerBaseImpl->_pOmmProviderClient->onReqMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 				}
@@ -255,7 +255,7 @@ RsslReactorCallbackRet DictionaryHandler::dictionaryCallback(RsslReactor* pReact
 
 				if (ommServerBaseImpl->getDictionaryHandler()._apiAdminControl == false)
 				{
-					ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+					ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 					ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 					ommServerBaseImpl->_pOmmProviderClient->onReissue(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 				}
@@ -326,7 +326,7 @@ RsslReactorCallbackRet DictionaryHandler::dictionaryCallback(RsslReactor* pReact
 					ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 					ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 					ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-					ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+					ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 					ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 					ommServerBaseImpl->_pOmmProviderClient->onClose(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
@@ -103,7 +103,7 @@ RsslReactorCallbackRet DirectoryHandler::directoryCallback(RsslReactor* pReactor
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onGenericMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
@@ -198,7 +198,7 @@ RsslReactorCallbackRet DirectoryHandler::directoryCallback(RsslReactor* pReactor
 							}
 						}
 
-						ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+						ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 						ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 						ommServerBaseImpl->_pOmmProviderClient->onReqMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 					}
@@ -216,7 +216,7 @@ RsslReactorCallbackRet DirectoryHandler::directoryCallback(RsslReactor* pReactor
 
 					if (ommServerBaseImpl->getDirectoryHandler()._apiAdminControl == false)
 					{
-						ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+						ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 						ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 						ommServerBaseImpl->_pOmmProviderClient->onReissue(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 					}
@@ -279,7 +279,7 @@ RsslReactorCallbackRet DirectoryHandler::directoryCallback(RsslReactor* pReactor
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onGenericMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
@@ -368,7 +368,7 @@ void DirectoryHandler::notifyOnClose(RsslMsg* pRsslMsg, ItemInfo* itemInfo)
 	_pOmmServerBaseImpl->ommProviderEvent._clientHandle = itemInfo->getClientSession()->getClientHandle();
 	_pOmmServerBaseImpl->ommProviderEvent._closure = _pOmmServerBaseImpl->_pClosure;
 	_pOmmServerBaseImpl->ommProviderEvent._provider = _pOmmServerBaseImpl->getProvider();
-	_pOmmServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+	_pOmmServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 	_pOmmServerBaseImpl->_pOmmProviderClient->onAllMsg(_pOmmServerBaseImpl->_reqMsg, _pOmmServerBaseImpl->ommProviderEvent);
 	_pOmmServerBaseImpl->_pOmmProviderClient->onClose(_pOmmServerBaseImpl->_reqMsg, _pOmmServerBaseImpl->ommProviderEvent);
@@ -640,6 +640,7 @@ ConfigElement* EmaConfigBaseImpl::convertEnum(const char* name, XMLnode* parent,
 			{ "RSSL_ENCRYPTED", RSSL_CONN_TYPE_ENCRYPTED },
 			{ "RSSL_RELIABLE_MCAST", RSSL_CONN_TYPE_RELIABLE_MCAST },
 			{ "RSSL_WEBSOCKET", RSSL_CONN_TYPE_WEBSOCKET },
+			{ "RSSL_BIDIR_SHMEM", RSSL_CONN_TYPE_BIDIR_SHMEM },
 		};
 
 		for (int i = 0; i < sizeof converter / sizeof converter[0]; i++)
@@ -673,7 +674,8 @@ ConfigElement* EmaConfigBaseImpl::convertEnum(const char* name, XMLnode* parent,
 		{
 			{ "RSSL_SOCKET", RSSL_CONN_TYPE_SOCKET },
 			{ "RSSL_ENCRYPTED", RSSL_CONN_TYPE_ENCRYPTED },
-			{ "RSSL_WEBSOCKET", RSSL_CONN_TYPE_WEBSOCKET }
+			{ "RSSL_WEBSOCKET", RSSL_CONN_TYPE_WEBSOCKET },
+			{ "RSSL_BIDIR_SHMEM", RSSL_CONN_TYPE_BIDIR_SHMEM }
 		};
 
 		for (int i = 0; i < sizeof converter / sizeof converter[0]; i++)
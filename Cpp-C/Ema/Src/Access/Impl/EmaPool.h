@@ -12,6 +12,7 @@
 #include "Mutex.h"
 #include "EmaVector.h"
 #include "ExceptionTranslator.h"
+#include "rtr/rtratomic.h"
 
 #include <new>
 
@@ -45,128 +46,227 @@ O* Factory< O >::create()
 	return 0;
 }
 
-template < class I >
-class EncoderPool 
+// number of free items each thread keeps for itself in front of a ThreadCachedPool
+#define EMA_POOL_THREAD_CACHE_SIZE 16
+
+// number of free items a ThreadCachedPool shares between threads without locking;
+// further items are kept in a locked vector
+#define EMA_POOL_FREE_LIST_SIZE 256
+
+// number of cache hits a thread counts before adding them to the pool statistics
+#define EMA_POOL_STATISTICS_INTERVAL 1024
+
+#ifdef WIN32
+#define EMA_POOL_COMPILER_BARRIER() _ReadWriteBarrier()
+#else
+#define EMA_POOL_COMPILER_BARRIER() __asm__ __volatile__ ( "" ::: "memory" )
+#endif
+
+class PoolStatistics
 {
 public :
 
-	EncoderPool( UInt32 size );
+	PoolStatistics() :
+	 _hitCount( 0 ),
+	 _missCount( 0 ),
+	 _createCount( 0 ),
+	 _spillCount( 0 )
+	{
+	}
 
-	virtual ~EncoderPool();
+	// number of getItem() calls served from the calling thread's cache
+	UInt64 getHitCount() const { return _hitCount; }
 
-	void clear();
+	// number of getItem() calls that had to use the shared free items or create an item
+	UInt64 getMissCount() const { return _missCount; }
 
-	I* getItem();
+	// number of items created since no free item was available
+	UInt64 getCreateCount() const { return _createCount; }
 
-	void returnItem( I* );
+	// number of items moved from a full thread cache to the shared free items
+	UInt64 getSpillCount() const { return _spillCount; }
 
-	UInt32 count();
+	// fraction of getItem() calls served from the calling thread's cache
+	double getHitRate() const { return _hitCount + _missCount ? (double)_hitCount / (double)( _hitCount + _missCount ) : 0; }
 
-private :
+	// fraction of getItem() calls not served from the calling thread's cache
+	double getMissRate() const { return _hitCount + _missCount ? (double)_missCount / (double)( _hitCount + _missCount ) : 0; }
 
-	Mutex				_lock;
-
-	EmaVector< I* >		_vector;
+private :
 
-	UInt32				_count;
+	template< class I > friend class ThreadCachedPool;
 
-	EncoderPool();
-	EncoderPool( const EncoderPool& );
-	EncoderPool& operator=( const EncoderPool& );
+	UInt64		_hitCount;
+	UInt64		_missCount;
+	UInt64		_createCount;
+	UInt64		_spillCount;
 };
 
+// bounded free list shared by all threads; items are pushed and popped without locking
+// each cell carries a sequence number telling whether it is free or filled for a given position
 template< class I >
-EncoderPool< I >::EncoderPool( UInt32 size ) :
- _count( 0 )
+class FreeList
 {
-	for ( UInt32 idx = 0; idx < size; ++idx )
-		_vector.push_back( 0 );
-}
+public :
 
-template< class I >
-EncoderPool< I >::~EncoderPool()
-{
-	clear();
-}
+	FreeList( UInt32 size );
+
+	virtual ~FreeList();
+
+	// returns false if the list is full
+	bool push( I* );
+
+	// returns 0 if the list is empty
+	I* pop();
+
+	UInt32 count() const;
+
+private :
+
+	struct Cell
+	{
+		rtr_atomic_val		_sequence;
+		I*					_item;
+	};
+
+	Cell*				_cells;
+
+	rtr_atomic_val		_mask;
+
+	char				_pad0[64];
+
+	rtr_atomic_val		_pushPos;
+
+	char				_pad1[64];
+
+	rtr_atomic_val		_popPos;
+
+	char				_pad2[64];
+
+	static rtr_atomic_val load( const rtr_atomic_val& value ) { return *(const volatile rtr_atomic_val*)&value; }
+
+	FreeList();
+	FreeList( const FreeList& );
+	FreeList& operator=( const FreeList& );
+};
 
 template< class I >
-void EncoderPool< I >::clear()
+FreeList< I >::FreeList( UInt32 size ) :
+ _cells( 0 ),
+ _mask( 0 ),
+ _pushPos( 0 ),
+ _popPos( 0 )
 {
-	_lock.lock();
+	UInt32 capacity = 2;
 
-	if ( !_count )
+	while ( capacity < size )
+		capacity <<= 1;
+
+	try {
+		_cells = new Cell[ capacity ];
+	}
+	catch ( std::bad_alloc& )
 	{
-		_lock.unlock();
+		const char* temp = "Failed to create free list in FreeList< I >::FreeList(). Out of memory.";
+		throwMeeException( temp );
 		return;
 	}
 
-	for ( UInt32 idx = _vector.size(); idx != 0; --idx )
+	for ( UInt32 idx = 0; idx < capacity; ++idx )
 	{
-		I* temp = _vector[ idx - 1 ];
-		if ( temp )
-		{
-			Factory< I >::destroy( temp );
-			_vector[ idx - 1 ] = 0;
-		}
+		_cells[ idx ]._sequence = (rtr_atomic_val)idx;
+		_cells[ idx ]._item = 0;
 	}
 
-	_count = 0;
+	_mask = (rtr_atomic_val)( capacity - 1 );
+}
 
-	_lock.unlock();
+template< class I >
+FreeList< I >::~FreeList()
+{
+	delete [] _cells;
 }
 
 template< class I >
-I* EncoderPool< I >::getItem()
+bool FreeList< I >::push( I* item )
 {
-	_lock.lock();
+	Cell* cell;
+	rtr_atomic_val pos = load( _pushPos );
 
-	if ( !_count )
+	while ( true )
 	{
-		_lock.unlock();
+		cell = &_cells[ pos & _mask ];
+		Int32 diff = (Int32)( (UInt32)load( cell->_sequence ) - (UInt32)pos );
 
-		return Factory< I >::create();
+		if ( diff == 0 )
+		{
+			rtr_atomic_val prevPos = RTR_ATOMIC_COMPARE_AND_SWAP( _pushPos, pos, (rtr_atomic_val)( (UInt32)pos + 1 ) );
+			if ( prevPos == pos )
+				break;
+			pos = prevPos;
+		}
+		else if ( diff < 0 )
+			return false;
+		else
+			pos = load( _pushPos );
 	}
 
-	I*& itemRef = _vector[ --_count ];
-
-	I* item = itemRef;
-
-	itemRef = 0;
-	
-	_lock.unlock();
+	cell->_item = item;
+	EMA_POOL_COMPILER_BARRIER();
+	*(volatile rtr_atomic_val*)&cell->_sequence = (rtr_atomic_val)( (UInt32)pos + 1 );
 
-	return item;
+	return true;
 }
 
 template< class I >
-void EncoderPool< I >::returnItem( I* item )
+I* FreeList< I >::pop()
 {
-	item->clear();
+	Cell* cell;
+	rtr_atomic_val pos = load( _popPos );
 
-	_lock.lock();
+	while ( true )
+	{
+		cell = &_cells[ pos & _mask ];
+		Int32 diff = (Int32)( (UInt32)load( cell->_sequence ) - ( (UInt32)pos + 1 ) );
 
-	if ( _count == _vector.capacity() )
-		do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() );
+		if ( diff == 0 )
+		{
+			rtr_atomic_val prevPos = RTR_ATOMIC_COMPARE_AND_SWAP( _popPos, pos, (rtr_atomic_val)( (UInt32)pos + 1 ) );
+			if ( prevPos == pos )
+				break;
+			pos = prevPos;
+		}
+		else if ( diff < 0 )
+			return 0;
+		else
+			pos = load( _popPos );
+	}
 
-	_vector[ _count++ ] = item;
+	I* item = cell->_item;
+	EMA_POOL_COMPILER_BARRIER();
+	*(volatile rtr_atomic_val*)&cell->_sequence = (rtr_atomic_val)( (UInt32)pos + (UInt32)_mask + 1 );
 
-	_lock.unlock();
+	return item;
 }
 
 template< class I >
-UInt32 EncoderPool< I >::count()
+UInt32 FreeList< I >::count() const
 {
-	return _count;
+	Int32 count = (Int32)( (UInt32)load( _pushPos ) - (UInt32)load( _popPos ) );
+	return count > 0 ? (UInt32)count : 0;
 }
 
+// pool where each thread keeps a few free items for itself, so that most getItem() and returnItem() calls
+// do not touch memory shared with other threads; a thread cache that fills up spills half of its items
+// to a FreeList shared by all threads, and items that do not fit there go to a locked vector
 template < class I >
-class DecoderPool 
+class ThreadCachedPool
 {
 public :
 
-	DecoderPool( UInt32 size );
+	ThreadCachedPool( UInt32 size );
 
-	virtual ~DecoderPool();
+	virtual ~ThreadCachedPool();
 
 	void clear();
 
@@ -176,36 +276,189 @@ public :
 
 	UInt32 count();
 
+	void getStatistics( PoolStatistics& );
+
+protected :
+
+	virtual void destroyItem( I* item ) { Factory< I >::destroy( item ); }
+
 private :
 
+	struct ThreadCache
+	{
+		ThreadCachedPool< I >*	_pool;
+		I*						_items[ EMA_POOL_THREAD_CACHE_SIZE ];
+		UInt32					_count;
+
+		// statistics not yet added to the pool
+		UInt64					_hitCount;
+		UInt64					_missCount;
+		UInt64					_createCount;
+		UInt64					_spillCount;
+	};
+
+	ThreadCache* getThreadCache( bool create );
+
+	void releaseItem( I* );
+
+	void spill( ThreadCache*, UInt32 );
+
+	void addStatistics( ThreadCache* );
+
+#ifdef WIN32
+	static VOID WINAPI threadExit( PVOID );
+#else
+	static void threadExit( void* );
+#endif
+
+	ThreadLocal			_threadCache;
+
+	FreeList< I >		_freeList;
+
 	Mutex				_lock;
 
 	EmaVector< I* >		_vector;
 
-	UInt32				_count;
+	volatile UInt32		_count;
 
-	DecoderPool();
-	DecoderPool( const DecoderPool& );
-	DecoderPool& operator=( const DecoderPool& );
+	volatile bool		_atExit;
+
+	rtr_atomic_val64	_hitCount;
+	rtr_atomic_val64	_missCount;
+	rtr_atomic_val64	_createCount;
+	rtr_atomic_val64	_spillCount;
+
+	ThreadCachedPool();
+	ThreadCachedPool( const ThreadCachedPool& );
+	ThreadCachedPool& operator=( const ThreadCachedPool& );
 };
 
 template< class I >
-DecoderPool< I >::DecoderPool( UInt32 size ) :
- _count( 0 )
+ThreadCachedPool< I >::ThreadCachedPool( UInt32 size ) :
+ _threadCache( &ThreadCachedPool< I >::threadExit ),
+ _freeList( EMA_POOL_FREE_LIST_SIZE ),
+ _count( 0 ),
+ _atExit( false ),
+ _hitCount( 0 ),
+ _missCount( 0 ),
+ _createCount( 0 ),
+ _spillCount( 0 )
 {
 	for ( UInt32 idx = 0; idx < size; ++idx )
 		_vector.push_back( 0 );
 }
 
 template< class I >
-DecoderPool< I >::~DecoderPool()
+ThreadCachedPool< I >::~ThreadCachedPool()
 {
+	// items still cached by other threads are left to the process exit
+	_atExit = true;
+
 	clear();
+
+	ThreadCache* cache = getThreadCache( false );
+	if ( cache )
+	{
+		_threadCache.set( 0 );
+		delete cache;
+	}
+}
+
+#ifdef WIN32
+template< class I >
+VOID WINAPI ThreadCachedPool< I >::threadExit( PVOID value )
+#else
+template< class I >
+void ThreadCachedPool< I >::threadExit( void* value )
+#endif
+{
+	ThreadCache* cache = (ThreadCache*)value;
+
+	if ( !cache->_pool->_atExit )
+	{
+		cache->_pool->spill( cache, cache->_count );
+		cache->_pool->addStatistics( cache );
+	}
+
+	delete cache;
+}
+
+template< class I >
+typename ThreadCachedPool< I >::ThreadCache* ThreadCachedPool< I >::getThreadCache( bool create )
+{
+	ThreadCache* cache = (ThreadCache*)_threadCache.get();
+
+	if ( cache || !create || !_threadCache.isValid() || _atExit )
+		return cache;
+
+	cache = new ( std::nothrow ) ThreadCache;
+
+	if ( cache )
+	{
+		cache->_pool = this;
+		cache->_count = 0;
+		cache->_hitCount = cache->_missCount = cache->_createCount = cache->_spillCount = 0;
+		_threadCache.set( cache );
+	}
+
+	return cache;
 }
 
 template< class I >
-void DecoderPool< I >::clear()
+void ThreadCachedPool< I >::releaseItem( I* item )
 {
+	if ( _freeList.push( item ) )
+		return;
+
+	_lock.lock();
+
+	if ( _count == _vector.capacity() )
+		do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() );
+
+	_vector[ _count++ ] = item;
+
+	_lock.unlock();
+}
+
+template< class I >
+void ThreadCachedPool< I >::spill( ThreadCache* cache, UInt32 spillCount )
+{
+	for ( UInt32 idx = 0; idx < spillCount; ++idx )
+		releaseItem( cache->_items[ --cache->_count ] );
+
+	cache->_spillCount += spillCount;
+}
+
+template< class I >
+void ThreadCachedPool< I >::addStatistics( ThreadCache* cache )
+{
+	if ( cache->_hitCount )
+		RTR_ATOMIC_ADD64( _hitCount, cache->_hitCount );
+	if ( cache->_missCount )
+		RTR_ATOMIC_ADD64( _missCount, cache->_missCount );
+	if ( cache->_createCount )
+		RTR_ATOMIC_ADD64( _createCount, cache->_createCount );
+	if ( cache->_spillCount )
+		RTR_ATOMIC_ADD64( _spillCount, cache->_spillCount );
+
+	cache->_hitCount = cache->_missCount = cache->_createCount = cache->_spillCount = 0;
+}
+
+template< class I >
+void ThreadCachedPool< I >::clear()
+{
+	ThreadCache* cache = getThreadCache( false );
+
+	if ( cache )
+	{
+		spill( cache, cache->_count );
+		addStatistics( cache );
+	}
+
+	I* item;
+	while ( ( item = _freeList.pop() ) != 0 )
+		destroyItem( item );
+
 	_lock.lock();
 
 	if ( !_count )
@@ -219,8 +472,7 @@ void DecoderPool< I >::clear()
 		I* temp = _vector[ idx - 1 ];
 		if ( temp )
 		{
-			temp->setAtExit();
-			Factory< I >::destroy( temp );
+			destroyItem( temp );
 			_vector[ idx - 1 ] = 0;
 		}
 	}
@@ -231,47 +483,142 @@ void DecoderPool< I >::clear()
 }
 
 template< class I >
-I* DecoderPool< I >::getItem()
+I* ThreadCachedPool< I >::getItem()
 {
-	_lock.lock();
+	ThreadCache* cache = getThreadCache( true );
 
-	if ( !_count )
+	if ( cache && cache->_count )
 	{
-		_lock.unlock();
+		if ( ++cache->_hitCount == EMA_POOL_STATISTICS_INTERVAL )
+			addStatistics( cache );
 
-		return Factory< I >::create();
+		return cache->_items[ --cache->_count ];
 	}
 
-	I*& itemRef = _vector[ --_count ];
+	I* item = _freeList.pop();
 
-	I* item = itemRef;
+	if ( !item && _count )
+	{
+		_lock.lock();
 
-	itemRef = 0;
-	
-	_lock.unlock();
+		if ( _count )
+		{
+			I*& itemRef = _vector[ --_count ];
+			item = itemRef;
+			itemRef = 0;
+		}
 
-	return item;
+		_lock.unlock();
+	}
+
+	if ( cache )
+	{
+		++cache->_missCount;
+		if ( !item )
+			++cache->_createCount;
+		addStatistics( cache );
+	}
+	else
+	{
+		RTR_ATOMIC_INCREMENT64( _missCount );
+		if ( !item )
+			RTR_ATOMIC_INCREMENT64( _createCount );
+	}
+
+	return item ? item : Factory< I >::create();
 }
 
 template< class I >
-void DecoderPool< I >::returnItem( I* item )
+void ThreadCachedPool< I >::returnItem( I* item )
 {
-	_lock.lock();
+	ThreadCache* cache = getThreadCache( true );
 
-	if ( _count == _vector.capacity() )
-		do { _vector.push_back( 0 ); } while ( _vector.size() < _vector.capacity() );
+	if ( !cache )
+	{
+		releaseItem( item );
+		return;
+	}
 
-	_vector[ _count++ ] = item;
+	if ( cache->_count == EMA_POOL_THREAD_CACHE_SIZE )
+	{
+		spill( cache, EMA_POOL_THREAD_CACHE_SIZE / 2 );
+		addStatistics( cache );
+	}
 
-	_lock.unlock();
+	cache->_items[ cache->_count++ ] = item;
 }
 
 template< class I >
-UInt32 DecoderPool< I >::count()
+UInt32 ThreadCachedPool< I >::count()
 {
-	return _count;
+	ThreadCache* cache = getThreadCache( false );
+
+	return _freeList.count() + _count + ( cache ? cache->_count : 0 );
 }
 
+template< class I >
+void ThreadCachedPool< I >::getStatistics( PoolStatistics& statistics )
+{
+	ThreadCache* cache = getThreadCache( false );
+
+	if ( cache )
+		addStatistics( cache );
+
+	statistics._hitCount = (UInt64)RTR_ATOMIC_READ64( &_hitCount );
+	statistics._missCount = (UInt64)RTR_ATOMIC_READ64( &_missCount );
+	statistics._createCount = (UInt64)RTR_ATOMIC_READ64( &_createCount );
+	statistics._spillCount = (UInt64)RTR_ATOMIC_READ64( &_spillCount );
+}
+
+template < class I >
+class EncoderPool : public ThreadCachedPool< I >
+{
+public :
+
+	EncoderPool( UInt32 size ) : ThreadCachedPool< I >( size ) {}
+
+	virtual ~EncoderPool() {}
+
+	void returnItem( I* item )
+	{
+		item->clear();
+
+		ThreadCachedPool< I >::returnItem( item );
+	}
+
+private :
+
+	EncoderPool();
+	EncoderPool( const EncoderPool& );
+	EncoderPool& operator=( const EncoderPool& );
+};
+
+template < class I >
+class DecoderPool : public ThreadCachedPool< I >
+{
+public :
+
+	DecoderPool( UInt32 size ) : ThreadCachedPool< I >( size ) {}
+
+	virtual ~DecoderPool()
+	{
+		ThreadCachedPool< I >::clear();
+	}
+
+protected :
+
+	void destroyItem( I* item )
+	{
+		item->setAtExit();
+		Factory< I >::destroy( item );
+	}
+
+private :
+
+	DecoderPool();
+	DecoderPool( const DecoderPool& );
+	DecoderPool& operator=( const DecoderPool& );
+};
 
 template < class I, class T = I >
 class Pool
@@ -28,13 +28,17 @@ FieldListDecoder::FieldListDecoder() :
  _pRsslDictionary( 0 ),
  _rsslDictionaryEntry( 0 ),
  _rsslLocalFLSetDefDb( 0 ),
+ _rsslFieldListIndex(),
+ _nextEntryNum( 0 ),
  _name(),
  _hexBuffer(),
  _rsslMajVer( RSSL_RWF_MAJOR_VERSION ),
  _rsslMinVer( RSSL_RWF_MINOR_VERSION ),
  _errorCode( OmmError::NoErrorEnum ),
  _decodingStarted( false ),
- _atEnd( false )
+ _atEnd( false ),
+ _indexChecked( false ),
+ _indexBuilt( false )
 {
 	createLoadPool( _pLoadPool );
 
@@ -52,6 +56,9 @@ FieldListDecoder::~FieldListDecoder()
 {
 	destroyLoadPool( _pLoadPool );
 
+	delete [] _rsslFieldListIndex.entries;
+	delete [] _rsslFieldListIndex.buckets;
+
 	if (_pDataDictionary)
 	{
 		delete _pDataDictionary;
@@ -97,6 +104,8 @@ void FieldListDecoder::clone( const FieldListDecoder& other )
 {
 	_decodingStarted = false;
 
+	clearIndex();
+
 	_rsslMajVer = other._rsslMajVer;
 
 	_rsslMinVer = other._rsslMinVer;
@@ -173,6 +182,8 @@ void FieldListDecoder::reset()
 {
 	_decodingStarted = false;
 
+	_nextEntryNum = 0;
+
 	if ( !_pRsslDictionary )
 	{
 		_atEnd = false;
@@ -241,6 +252,8 @@ bool FieldListDecoder::setRsslData( UInt8 majVer, UInt8 minVer, RsslBuffer* rssl
 {
 	_decodingStarted = false;
 
+	clearIndex();
+
 	_rsslMajVer = majVer;
 
 	_rsslMinVer = minVer;
@@ -309,6 +322,55 @@ bool FieldListDecoder::setRsslData( UInt8 majVer, UInt8 minVer, RsslBuffer* rssl
 	}
 }
 
+void FieldListDecoder::clearIndex()
+{
+	_nextEntryNum = 0;
+	_indexChecked = false;
+	_indexBuilt = false;
+}
+
+bool FieldListDecoder::buildIndex()
+{
+	if ( _indexChecked ) return _indexBuilt;
+
+	_indexChecked = true;
+
+	if ( _errorCode != OmmError::NoErrorEnum ) return false;
+
+	/* The index storage is kept across field lists and grown to fit; it is first allocated here. */
+	RsslRet retCode = _rsslFieldListIndex.bucketCount ? rsslIndexFieldList( &_decodeIter, &_rsslFieldListIndex ) : RSSL_RET_BUFFER_TOO_SMALL;
+
+	while ( retCode == RSSL_RET_BUFFER_TOO_SMALL )
+	{
+		UInt32 bucketCount = 16;
+		while ( bucketCount < 2 * _rsslFieldListIndex.entryCount )
+			bucketCount <<= 1;
+
+		delete [] _rsslFieldListIndex.entries;
+		delete [] _rsslFieldListIndex.buckets;
+		rsslClearFieldListIndex( &_rsslFieldListIndex );
+
+		try
+		{
+			_rsslFieldListIndex.entries = new RsslFieldIndexEntry[bucketCount / 2];
+			_rsslFieldListIndex.maxEntries = bucketCount / 2;
+			_rsslFieldListIndex.buckets = new RsslUInt32[bucketCount];
+			_rsslFieldListIndex.bucketCount = bucketCount;
+		}
+		catch ( std::bad_alloc& )
+		{
+			throwMeeException( "Failed to allocate memory in FieldListDecoder::buildIndex()." );
+			return false;
+		}
+
+		retCode = rsslIndexFieldList( &_decodeIter, &_rsslFieldListIndex );
+	}
+
+	_indexBuilt = ( retCode == RSSL_RET_SUCCESS );
+
+	return _indexBuilt;
+}
+
 bool FieldListDecoder::getNextData()
 {
 	if ( _atEnd ) return true;
@@ -321,6 +383,8 @@ bool FieldListDecoder::getNextData()
 	{
 	case RSSL_RET_SUCCESS :
 	{
+		++_nextEntryNum;
+
 		_rsslDictionaryEntry = _pRsslDictionary->entriesArray[_rsslFieldEntry.fieldId];
 
 		if ( !_rsslDictionaryEntry )
@@ -351,20 +415,44 @@ bool FieldListDecoder::getNextData( Int16 fieldId )
 {
 	RsslRet retCode = RSSL_RET_SUCCESS;
 
-	do {
-		if ( _atEnd ) return true;
+	if ( _atEnd ) return true;
 
+	if ( buildIndex() )
+	{
 		_decodingStarted = true;
 
-		retCode = rsslDecodeFieldEntry( &_decodeIter, &_rsslFieldEntry );
+		RsslInt32 entryNum = rsslFindFieldIndexEntry( &_rsslFieldListIndex, fieldId, _nextEntryNum );
 
-		if ( retCode == RSSL_RET_END_OF_CONTAINER )
+		if ( entryNum < 0 )
 		{
 			_atEnd = true;
 			return true;
 		}
+
+		_nextEntryNum = entryNum + 1;
+
+		retCode = rsslDecodeFieldEntryFromIndex( &_decodeIter, &_rsslFieldListIndex, entryNum, &_rsslFieldEntry );
+	}
+	else
+	{
+		do {
+			if ( _atEnd ) return true;
+
+			_decodingStarted = true;
+
+			retCode = rsslDecodeFieldEntry( &_decodeIter, &_rsslFieldEntry );
+
+			if ( retCode == RSSL_RET_END_OF_CONTAINER )
+			{
+				_atEnd = true;
+				return true;
+			}
+
+			if ( retCode == RSSL_RET_SUCCESS )
+				++_nextEntryNum;
+		}
+		while (	_rsslFieldEntry.fieldId != fieldId );
 	}
-	while (	_rsslFieldEntry.fieldId != fieldId );
 
 	switch ( retCode )
 	{
@@ -415,6 +503,9 @@ bool FieldListDecoder::getNextData( const EmaString& name )
 			return true;
 		}
 
+		if ( retCode == RSSL_RET_SUCCESS )
+			++_nextEntryNum;
+
 		_rsslDictionaryEntry = _pRsslDictionary->entriesArray[_rsslFieldEntry.fieldId];
 
 		if ( _rsslDictionaryEntry )
@@ -459,38 +550,69 @@ bool FieldListDecoder::getNextData( const EmaVector< Int16 >& intList )
 	RsslRet retCode = RSSL_RET_SUCCESS;
 	bool match = false;
 
-	do {
-		if ( _atEnd ) return true;
+	if ( !_atEnd && buildIndex() )
+	{
+		_decodingStarted = true;
 
-		if ( !_decodingStarted && _errorCode != OmmError::NoErrorEnum )
-		{
-			_atEnd = true;
-			_decodingStarted = true;
-			_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], _errorCode, &_decodeIter, &_rsslFieldListBuffer );
-			return false;
-		}
+		RsslInt32 entryNum = -1;
 
-		_decodingStarted = true;
+		UInt32 size = intList.size();
+		for ( UInt32 idx = 0; idx < size; ++idx )
+		{
+			RsslInt32 fidEntryNum = rsslFindFieldIndexEntry( &_rsslFieldListIndex, intList[idx], _nextEntryNum );
 
-		retCode = rsslDecodeFieldEntry( &_decodeIter, &_rsslFieldEntry );
+			if ( fidEntryNum >= 0 && ( entryNum < 0 || fidEntryNum < entryNum ) )
+				entryNum = fidEntryNum;
+		}
 
-		if ( retCode == RSSL_RET_END_OF_CONTAINER )
+		if ( entryNum < 0 )
 		{
 			_atEnd = true;
 			return true;
 		}
 
-		UInt32 size = intList.size();
-		for ( UInt32 idx = 0; idx < size; ++idx )
-		{
-			if ( _rsslFieldEntry.fieldId == intList[idx] )
+		_nextEntryNum = entryNum + 1;
+
+		retCode = rsslDecodeFieldEntryFromIndex( &_decodeIter, &_rsslFieldListIndex, entryNum, &_rsslFieldEntry );
+	}
+	else
+	{
+		do {
+			if ( _atEnd ) return true;
+
+			if ( !_decodingStarted && _errorCode != OmmError::NoErrorEnum )
+			{
+				_atEnd = true;
+				_decodingStarted = true;
+				_pLoad = Decoder::setRsslData( _pLoadPool[DataType::ErrorEnum], _errorCode, &_decodeIter, &_rsslFieldListBuffer );
+				return false;
+			}
+
+			_decodingStarted = true;
+
+			retCode = rsslDecodeFieldEntry( &_decodeIter, &_rsslFieldEntry );
+
+			if ( retCode == RSSL_RET_END_OF_CONTAINER )
 			{
-				match = true;
-				break;
+				_atEnd = true;
+				return true;
+			}
+
+			if ( retCode == RSSL_RET_SUCCESS )
+				++_nextEntryNum;
+
+			UInt32 size = intList.size();
+			for ( UInt32 idx = 0; idx < size; ++idx )
+			{
+				if ( _rsslFieldEntry.fieldId == intList[idx] )
+				{
+					match = true;
+					break;
+				}
 			}
 		}
+		while (	!match );
 	}
-	while (	!match );
 
 	switch ( retCode )
 	{
@@ -549,6 +671,9 @@ bool FieldListDecoder::getNextData( const EmaVector< EmaString >& stringList )
 			return true;
 		}
 
+		if ( retCode == RSSL_RET_SUCCESS )
+			++_nextEntryNum;
+
 		_rsslDictionaryEntry = _pRsslDictionary->entriesArray[_rsslFieldEntry.fieldId];
 
 		if ( _rsslDictionaryEntry )
@@ -92,6 +92,10 @@ private :
 
 	void decodeViewList( RsslBuffer* , RsslDataType& , EmaVector< Int16 >& , EmaVector< EmaString >& );
 
+	bool buildIndex();
+
+	void clearIndex();
+
 	RsslFieldList				_rsslFieldList;
 
 	mutable RsslBuffer			_rsslFieldListBuffer;
@@ -110,6 +114,10 @@ private :
 
 	RsslLocalFieldSetDefDb*		_rsslLocalFLSetDefDb;
 
+	RsslFieldListIndex			_rsslFieldListIndex;
+
+	UInt32						_nextEntryNum;
+
 	EmaStringInt				_name;
 
 	mutable EmaStringInt		_rippleToName;
@@ -128,6 +136,10 @@ private :
 
 	bool						_atEnd;
 
+	bool						_indexChecked;
+
+	bool						_indexBuilt;
+
 	thomsonreuters::ema::rdm::DataDictionary*				_pDataDictionary;
 };
 
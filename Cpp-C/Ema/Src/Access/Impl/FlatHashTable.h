@@ -0,0 +1,282 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __thomsonreuters_ema_access_FlatHashTable_h
+#define __thomsonreuters_ema_access_FlatHashTable_h
+
+/*
+	FlatHashTable has the interface of HashTable, but keeps its keys and values in a single
+	array of slots (open addressing with Robin Hood probing and backward-shift deletion),
+	so insert() and erase() do not allocate and find() walks adjacent slots instead of a chain.
+
+	The constructor and rehash() take the number of elements to make room for, so a table
+	sized from ItemCountHint does not grow until it holds more than that many elements.
+
+	Keys and values are moved between slots by assignment, so both must be cheap to copy
+	(handles, stream ids, pointers). A pointer returned by find() or operator[] is only valid
+	until the next insert(), operator[] of a new key, erase() or clear().
+*/
+
+#include "HashTable.h"
+
+namespace thomsonreuters {
+
+namespace ema {
+
+namespace access {
+
+template<class KeyType, class ValueType, class Hasher = Hasher<KeyType>, class Equal_To = Equal_To<KeyType> >
+class FlatHashTable
+{
+public:
+
+	FlatHashTable( UInt32 size = 513, double loadFactor = 0.7 );
+
+	~FlatHashTable();
+
+	bool insert( const KeyType&, const ValueType& );
+
+	ValueType& operator[]( const KeyType& );
+
+	int erase( const KeyType& );
+
+	void clear();
+
+	bool empty() const { return elementCount == 0 ? true : false; }
+
+	size_t size() const { return elementCount; }
+
+	ValueType* find( const KeyType& ) const;
+
+	void rehash( UInt32 );
+
+private:
+
+	struct Slot
+	{
+		Slot() : probeLength( 0 ), key(), value() {}
+
+		UInt32 probeLength;		// distance from the key's home slot plus one, 0 if the slot is empty
+		KeyType key;
+		ValueType value;
+	};
+
+	Slot* theTable;
+	UInt32 tableSize;			// always a power of two
+	UInt32 tableShift;			// 64 minus log2 of tableSize
+	Hasher hashFn;
+	Equal_To keyEqual;
+	UInt32 elementCount;
+
+	UInt32 rehashWhen;
+	double loadFactor;
+
+	FlatHashTable( const FlatHashTable& );
+	FlatHashTable& operator=( const FlatHashTable& );
+
+	// scrambles the hash, so hashers that return the key itself (handles, stream ids) still spread across the table
+	UInt32 home( const KeyType& key ) const
+	{
+		return static_cast<UInt32>( ( static_cast<UInt64>( hashFn( key ) ) * 0x9E3779B97F4A7C15ULL ) >> tableShift );
+	}
+
+	void allocate( UInt32 newSize );
+
+	Slot* place( const KeyType& key, const ValueType& value );
+};
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::FlatHashTable( UInt32 size, double loadFactor ) :
+	theTable( 0 ), tableSize( 0 ), tableShift( 64 ), elementCount( 0 ), rehashWhen( 0 ),
+	loadFactor( loadFactor > 0.1 && loadFactor < 0.9 ? loadFactor : 0.7 )
+{
+	rehash( size == 0 ? 513 : size );
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::~FlatHashTable()
+{
+	delete [] theTable;
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+void
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::allocate( UInt32 newSize )
+{
+	theTable = new Slot[newSize];
+	tableSize = newSize;
+	tableShift = 64;
+	for ( UInt32 i = newSize; i > 1; i >>= 1 )
+		--tableShift;
+	rehashWhen = static_cast<UInt32>( tableSize * loadFactor );
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+typename FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::Slot*
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::place( const KeyType& key, const ValueType& value )
+{
+	UInt32 mask = tableSize - 1;
+	UInt32 index = home( key );
+	Slot entry;
+	Slot* placed = 0;
+
+	entry.probeLength = 1;
+	entry.key = key;
+	entry.value = value;
+
+	while ( true )
+	{
+		Slot& slot = theTable[index];
+
+		if ( slot.probeLength == 0 )
+		{
+			slot = entry;
+			++elementCount;
+			return placed ? placed : &slot;
+		}
+
+		// takes the slot from an element that is closer to its home slot, and carries that element on instead
+		if ( slot.probeLength < entry.probeLength )
+		{
+			Slot displaced( slot );
+			slot = entry;
+			entry = displaced;
+			if ( !placed )
+				placed = &slot;
+		}
+
+		index = ( index + 1 ) & mask;
+		++entry.probeLength;
+	}
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+bool
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::insert( const KeyType& key, const ValueType& value )
+{
+	if ( find( key ) )
+		return false;
+
+	if ( elementCount >= rehashWhen )
+		rehash( tableSize );
+
+	place( key, value );
+	return true;
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+ValueType&
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::operator[]( const KeyType& key )
+{
+	ValueType* found = find( key );
+	if ( found )
+		return *found;
+
+	if ( elementCount >= rehashWhen )
+		rehash( tableSize );
+
+	return place( key, ValueType() )->value;
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+int
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::erase( const KeyType& key )
+{
+	UInt32 mask = tableSize - 1;
+	UInt32 index = home( key );
+
+	for ( UInt32 probeLength = 1; theTable[index].probeLength >= probeLength; ++probeLength )
+	{
+		if ( keyEqual( theTable[index].key, key ) )
+		{
+			// moves the following elements back a slot, until one is empty or already in its home slot
+			UInt32 next = ( index + 1 ) & mask;
+			while ( theTable[next].probeLength > 1 )
+			{
+				theTable[index] = theTable[next];
+				--theTable[index].probeLength;
+				index = next;
+				next = ( next + 1 ) & mask;
+			}
+
+			theTable[index] = Slot();
+			--elementCount;
+			return 1;
+		}
+
+		index = ( index + 1 ) & mask;
+	}
+
+	return 0;
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+void
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::clear()
+{
+	if ( elementCount == 0 )
+		return;
+
+	for ( UInt32 i = 0; i < tableSize; ++i )
+		if ( theTable[i].probeLength )
+			theTable[i] = Slot();
+
+	elementCount = 0;
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+ValueType*
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::find( const KeyType& key ) const
+{
+	UInt32 mask = tableSize - 1;
+	UInt32 index = home( key );
+
+	// with Robin Hood ordering, the key cannot be past an element that is closer to its home slot
+	for ( UInt32 probeLength = 1; theTable[index].probeLength >= probeLength; ++probeLength )
+	{
+		if ( keyEqual( theTable[index].key, key ) )
+			return &( theTable[index].value );
+
+		index = ( index + 1 ) & mask;
+	}
+
+	return 0;
+}
+
+template<class KeyType, class ValueType, class Hasher, class Equal_To>
+void
+FlatHashTable<KeyType, ValueType, Hasher, Equal_To>::rehash( UInt32 newSize )
+{
+	UInt32 newTableSize = 8;
+
+	while ( newTableSize < 0x40000000 && static_cast<UInt32>( newTableSize * loadFactor ) <= newSize )
+		newTableSize <<= 1;
+
+	if ( newTableSize <= tableSize )
+		return;
+
+	Slot* oldHashTable = theTable;
+	UInt32 oldHashTableSize( tableSize );
+
+	allocate( newTableSize );
+	elementCount = 0;
+
+	for ( UInt32 i = 0; i < oldHashTableSize; ++i )
+		if ( oldHashTable[i].probeLength )
+			place( oldHashTable[i].key, oldHashTable[i].value );
+
+	delete [] oldHashTable;
+}
+
+}
+
+}
+
+}
+
+#endif // __thomsonreuters_ema_access_FlatHashTable_h
@@ -2531,8 +2531,9 @@ ItemCallbackClient::ItemCallbackClient( OmmServerBaseImpl& ommServerBaseImpl ) :
 	_genericMsg(),
 	_ackMsg(),
 	_ommCommonImpl( ommServerBaseImpl ),
-	_itemMap( ommServerBaseImpl.getActiveConfig().itemCountHint ),
-	_streamIdMap( ommServerBaseImpl.getActiveConfig().itemCountHint ),
+	// only the requests the provider application makes itself, such as for dictionaries
+	_itemMap(),
+	_streamIdMap(),
 	_nextStreamIdWrapAround( false ),
 	_streamIdAccessMutex()
 {
@@ -3637,6 +3638,11 @@ void ItemCallbackClient::unregister( UInt64 handle )
 	((Item*)handle)->close();
 }
 
+bool ItemCallbackClient::hasItem( UInt64 handle )
+{
+	return _itemMap.find( handle ) ? true : false;
+}
+
 void ItemCallbackClient::submit( const PostMsg& postMsg, UInt64 handle )
 {
 	if ( !_itemMap.find( handle ) )
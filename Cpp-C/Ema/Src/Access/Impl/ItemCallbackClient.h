@@ -10,7 +10,7 @@
 #define __thomsonreuters_ema_access_ItemCallbackClient_h
 
 #include "rtr/rsslReactor.h"
-#include "HashTable.h"
+#include "FlatHashTable.h"
 #include "EmaList.h"
 #include "OmmState.h"
 #include "AckMsg.h"
@@ -549,6 +549,8 @@ public :
 
 	void unregister( UInt64 );
 
+	bool hasItem( UInt64 );
+
 	void submit( const PostMsg& , UInt64 );
 
 	void submit( const GenericMsg& , UInt64 );
@@ -607,7 +609,7 @@ private :
 		bool operator()( const UInt64 & , const UInt64 & ) const;
 	};
 
-	typedef HashTable< UInt64 , ItemPtr , UInt64rHasher , UInt64Equal_To > ItemMap;
+	typedef FlatHashTable< UInt64 , ItemPtr , UInt64rHasher , UInt64Equal_To > ItemMap;
 
 	ItemMap							_itemMap;
 
@@ -621,7 +623,7 @@ private :
 		bool operator()(const Int32 &, const Int32 &) const;
 	};
 
-	typedef HashTable< Int32, ItemPtr, Int32rHasher, Int32Equal_To > StreamIdMap;
+	typedef FlatHashTable< Int32, ItemPtr, Int32rHasher, Int32Equal_To > StreamIdMap;
 
 	StreamIdMap						_streamIdMap;
 
@@ -141,7 +141,7 @@ const RsslMsgKey& ItemInfo::getRsslMsgKey() const
 
 UInt64 ItemInfo::getHandle() const
 {
-	return (UInt64)this;
+	return (UInt64)this | _ommServerBaseimpl.getHandleTag();
 }
 
 Int32 ItemInfo::getStreamId() const
@@ -122,7 +122,7 @@ RsslReactorCallbackRet LoginHandler::loginCallback(RsslReactor* pReactor, RsslRe
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onGenericMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
@@ -181,12 +181,12 @@ RsslReactorCallbackRet LoginHandler::loginCallback(RsslReactor* pReactor, RsslRe
 					return RSSL_RC_CRET_SUCCESS;
 
 				itemInfo->setClientSession(clientSession);
-				clientSession->setLoginHandle((UInt64)itemInfo);
+				clientSession->setLoginHandle(itemInfo->getHandle());
 
 				ommServerBaseImpl->getLoginHandler().addItemInfo(itemInfo);
 				ommServerBaseImpl->addItemInfo(itemInfo);
 
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onReqMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
@@ -196,7 +196,7 @@ RsslReactorCallbackRet LoginHandler::loginCallback(RsslReactor* pReactor, RsslRe
 				if ( !itemInfo->setRsslRequestMsg(pRDMLoginMsgEvent->baseMsgEvent.pRsslMsg->requestMsg) )
 					return RSSL_RC_CRET_SUCCESS;
 
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onReissue(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 			}
@@ -227,7 +227,7 @@ RsslReactorCallbackRet LoginHandler::loginCallback(RsslReactor* pReactor, RsslRe
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onGenericMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
@@ -295,7 +295,7 @@ RsslReactorCallbackRet LoginHandler::loginCallback(RsslReactor* pReactor, RsslRe
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				if (static_cast<OmmIProviderActiveConfig&>(ommServerBaseImpl->getActiveConfig()).getEnforceAckIDValidation())
 				{
@@ -350,7 +350,7 @@ RsslReactorCallbackRet LoginHandler::loginCallback(RsslReactor* pReactor, RsslRe
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onClose(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
@@ -398,7 +398,7 @@ RsslReactorCallbackRet LoginHandler::loginCallback(RsslReactor* pReactor, RsslRe
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onGenericMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
@@ -663,7 +663,7 @@ void LoginHandler::notifyChannelDown(ClientSession* clientSession)
 			_pOmmServerBaseImpl->ommProviderEvent._clientHandle = itemInfo->getClientSession()->getClientHandle();
 			_pOmmServerBaseImpl->ommProviderEvent._closure = _pOmmServerBaseImpl->_pClosure;
 			_pOmmServerBaseImpl->ommProviderEvent._provider = _pOmmServerBaseImpl->getProvider();
-			_pOmmServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+			_pOmmServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 			_pOmmServerBaseImpl->_pOmmProviderClient->onAllMsg(_pOmmServerBaseImpl->_reqMsg, _pOmmServerBaseImpl->ommProviderEvent);
 			_pOmmServerBaseImpl->_pOmmProviderClient->onClose(_pOmmServerBaseImpl->_reqMsg, _pOmmServerBaseImpl->ommProviderEvent);
@@ -296,7 +296,7 @@ RsslReactorCallbackRet MarketItemHandler::itemCallback(RsslReactor* pReactor, Rs
 
 				ommServerBaseImpl->addItemInfo(itemInfo);
 
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onReqMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 			}
@@ -355,7 +355,7 @@ RsslReactorCallbackRet MarketItemHandler::itemCallback(RsslReactor* pReactor, Rs
 				if (!setMessageKey && !itemInfo->setRsslRequestMsg(pRsslMsg->requestMsg))
 					return RSSL_RC_CRET_SUCCESS;
 
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onReissue(ommServerBaseImpl->_reqMsg, ommServerBaseImpl->ommProviderEvent);
 			}
@@ -442,7 +442,7 @@ RsslReactorCallbackRet MarketItemHandler::itemCallback(RsslReactor* pReactor, Rs
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				if (static_cast<OmmIProviderActiveConfig&>(ommServerBaseImpl->getActiveConfig()).getEnforceAckIDValidation())
 				{
@@ -494,7 +494,7 @@ RsslReactorCallbackRet MarketItemHandler::itemCallback(RsslReactor* pReactor, Rs
 				ommServerBaseImpl->ommProviderEvent._clientHandle = clientSession->getClientHandle();
 				ommServerBaseImpl->ommProviderEvent._closure = ommServerBaseImpl->_pClosure;
 				ommServerBaseImpl->ommProviderEvent._provider = ommServerBaseImpl->getProvider();
-				ommServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+				ommServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 				ommServerBaseImpl->_pOmmProviderClient->onAllMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
 				ommServerBaseImpl->_pOmmProviderClient->onGenericMsg(ommServerBaseImpl->_genericMsg, ommServerBaseImpl->ommProviderEvent);
@@ -567,7 +567,7 @@ void MarketItemHandler::notifyOnClose(RsslMsg* pRsslMsg, ItemInfo* itemInfo)
 	_pOmmServerBaseImpl->ommProviderEvent._clientHandle = itemInfo->getClientSession()->getClientHandle();
 	_pOmmServerBaseImpl->ommProviderEvent._closure = _pOmmServerBaseImpl->_pClosure;
 	_pOmmServerBaseImpl->ommProviderEvent._provider = _pOmmServerBaseImpl->getProvider();
-	_pOmmServerBaseImpl->ommProviderEvent._handle = (UInt64)itemInfo;
+	_pOmmServerBaseImpl->ommProviderEvent._handle = itemInfo->getHandle();
 
 	_pOmmServerBaseImpl->_pOmmProviderClient->onAllMsg(_pOmmServerBaseImpl->_reqMsg, _pOmmServerBaseImpl->ommProviderEvent);
 	_pOmmServerBaseImpl->_pOmmProviderClient->onClose(_pOmmServerBaseImpl->_reqMsg, _pOmmServerBaseImpl->ommProviderEvent);
@@ -32,6 +32,29 @@ void Mutex::unlock()
 	LeaveCriticalSection( &m_cs );
 }
 
+ThreadLocal::ThreadLocal( ThreadExitCallback callback )
+{
+	m_index = FlsAlloc( callback );
+	m_valid = m_index != FLS_OUT_OF_INDEXES;
+}
+
+ThreadLocal::~ThreadLocal()
+{
+	if ( m_valid )
+		FlsFree( m_index );
+}
+
+void* ThreadLocal::get() const
+{
+	return m_valid ? FlsGetValue( m_index ) : 0;
+}
+
+void ThreadLocal::set( void* value )
+{
+	if ( m_valid )
+		FlsSetValue( m_index, value );
+}
+
 #else
 
 Mutex::Mutex()
@@ -58,4 +81,31 @@ void Mutex::unlock()
 	pthread_mutex_unlock( &m_mutex );
 }
 
+ThreadLocal::ThreadLocal( ThreadExitCallback callback )
+{
+	m_valid = pthread_key_create( &m_key, callback ) == 0;
+}
+
+ThreadLocal::~ThreadLocal()
+{
+	if ( m_valid )
+		pthread_key_delete( m_key );
+}
+
+void* ThreadLocal::get() const
+{
+	return m_valid ? pthread_getspecific( m_key ) : 0;
+}
+
+void ThreadLocal::set( void* value )
+{
+	if ( m_valid )
+		pthread_setspecific( m_key, value );
+}
+
 #endif // WIN32
+
+bool ThreadLocal::isValid() const
+{
+	return m_valid;
+}
@@ -54,6 +54,44 @@ private :
 	Mutex & operator=( const Mutex & );
 };
 
+// Holds one pointer per thread. When a thread that set a non null pointer exits,
+// the callback given at construction is called on that thread with the pointer.
+class ThreadLocal
+{
+public :
+
+#ifdef WIN32
+	typedef VOID ( WINAPI *ThreadExitCallback )( PVOID );
+#else
+	typedef void ( *ThreadExitCallback )( void* );
+#endif
+
+	ThreadLocal( ThreadExitCallback );
+
+	virtual ~ThreadLocal();
+
+	void* get() const;
+
+	void set( void* );
+
+	bool isValid() const;
+
+private :
+
+#ifdef WIN32
+	DWORD					m_index;
+#else
+	pthread_key_t			m_key;
+#endif
+
+	bool					m_valid;
+
+private :
+
+	ThreadLocal( const ThreadLocal & );
+	ThreadLocal & operator=( const ThreadLocal & );
+};
+
 class MutexLocker
 {
 public:
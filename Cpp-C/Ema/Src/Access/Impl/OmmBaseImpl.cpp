@@ -346,6 +346,8 @@ void OmmBaseImpl::readConfig(EmaConfigImpl* pConfigImpl)
 
 	pConfigImpl->get<Int64>(instanceNodeName + "DispatchTimeoutApiThread", _activeConfig.dispatchTimeoutApiThread);
 
+	pConfigImpl->get<Int64>(instanceNodeName + "DispatchSpinTimeApiThread", _activeConfig.dispatchSpinTimeApiThread);
+
 	pConfigImpl->get<Double>(instanceNodeName + "TokenReissueRatio", _activeConfig.tokenReissueRatio);
 
 	if (pConfigImpl->get<UInt64>(instanceNodeName + "CatchUnhandledException", tmp))
@@ -782,6 +784,7 @@ ChannelConfig* OmmBaseImpl::readChannelConfig(EmaConfigImpl* pConfigImpl, const
 	case RSSL_CONN_TYPE_SOCKET:
 	case RSSL_CONN_TYPE_HTTP:
 	case RSSL_CONN_TYPE_WEBSOCKET:
+	case RSSL_CONN_TYPE_BIDIR_SHMEM:
 	{
 		if (socketChannelCfg == 0)
 		{
@@ -955,6 +958,14 @@ ChannelConfig* OmmBaseImpl::readChannelConfig(EmaConfigImpl* pConfigImpl, const
 	if ( pConfigImpl->get<UInt64>( channelNodeName + "HighWaterMark", tempUInt ) )
 		newChannelConfig->highWaterMark = tempUInt > maxUInt32 ? maxUInt32 : (UInt32) tempUInt;
 
+	tempUInt = 0;
+	if ( pConfigImpl->get<UInt64>( channelNodeName + "AutoPackSize", tempUInt ) )
+		newChannelConfig->autoPackSize = tempUInt > maxUInt32 ? maxUInt32 : (UInt32) tempUInt;
+
+	tempUInt = 0;
+	if ( pConfigImpl->get<UInt64>( channelNodeName + "AutoPackDelay", tempUInt ) )
+		newChannelConfig->autoPackDelay = tempUInt > maxUInt32 ? maxUInt32 : (UInt32) tempUInt;
+
 	/* @deprecated DEPRECATED:
 	 *ReconnectAttemptLimit,ReconnectMinDelay,ReconnectMaxDelay,MsgKeyInUpdates,XmlTrace is per consumer/niprov/iprov instance based now. 
 	  The following code will be removed in the future.
@@ -1313,6 +1324,16 @@ void OmmBaseImpl::initialize( EmaConfigImpl* configImpl )
 		FD_SET( _pipe.readFD(), &_exceptFds );
 		FD_SET( _pRsslReactor->eventFd, &_readFds );
 		FD_SET( _pRsslReactor->eventFd, &_exceptFds );
+#elif defined( USING_EPOLL )
+		if ( !createEventFds() || addFd( _pipe.readFD() ) < 0 || addFd( _pRsslReactor->eventFd ) < 0 )
+		{
+			EmaString temp( "Failed to initialize OmmBaseImpl (epoll). System errno='" );
+			temp.append( errno ).append( "'. " );
+			if ( OmmLoggerClient::ErrorEnum >= _activeConfig.loggerConfig.minLoggerSeverity )
+				_pLoggerClient->log( _activeConfig.instanceName, OmmLoggerClient::ErrorEnum, temp );
+			throwIueException( temp, OmmInvalidUsageException::InternalErrorEnum );
+			return;
+		}
 #else
 		_eventFdsCapacity = 8;
 		_eventFds = new pollfd[ _eventFdsCapacity ];
@@ -1624,6 +1645,8 @@ void OmmBaseImpl::uninitialize( bool caughtExcep, bool calledFromInit )
 #ifdef USING_SELECT
 	FD_CLR( _pipe.readFD(), &_readFds );
 	FD_CLR( _pipe.readFD(), &_exceptFds );
+#elif defined( USING_EPOLL )
+	removeFd( _pipe.readFD() );
 #else
 	removeFd( _pipe.readFD() );
 	_pipeReadEventFdsIdx = -1;
@@ -1636,7 +1659,9 @@ void OmmBaseImpl::uninitialize( bool caughtExcep, bool calledFromInit )
 
 	if ( !calledFromInit ) _userLock.unlock();
 
-#ifdef USING_POLL
+#if defined( USING_EPOLL )
+	destroyEventFds();
+#elif defined( USING_POLL )
 	delete[] _eventFds;
 #endif
 }
@@ -1734,6 +1759,16 @@ Int64 OmmBaseImpl::rsslReactorDispatchLoop( Int64 timeOut, UInt32 count, bool& b
 			--selectRetCode;
 		}
 
+#elif defined( USING_EPOLL )
+
+		selectRetCode = waitEventFds( timeOut, isApiDispatching() ? _activeConfig.dispatchSpinTimeApiThread : 0 );
+
+		if ( selectRetCode > 0 && ( getNotifiedEvents( _pipe.readFD() ) & EPOLLIN ) )
+		{
+			pipeRead();
+			--selectRetCode;
+		}
+
 #elif defined( USING_PPOLL )
 
 		struct timespec ppollTime;
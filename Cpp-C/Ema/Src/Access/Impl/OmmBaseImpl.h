@@ -13,7 +13,7 @@
 #define USING_SELECT
 #else
 #define USING_POLL
-#define USING_PPOLL
+#define USING_EPOLL
 #endif
 
 #include "rtr/rsslReactor.h"
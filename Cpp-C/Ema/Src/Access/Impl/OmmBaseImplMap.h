@@ -24,10 +24,13 @@
 #define USING_SELECT
 #else
 #define USING_POLL
-#define USING_PPOLL
+#define USING_EPOLL
 #endif
 
-#ifdef USING_PPOLL
+#if defined( USING_EPOLL )
+#include <sys/epoll.h>
+#include <poll.h>
+#elif defined( USING_PPOLL )
 #include <poll.h>
 #endif
 
@@ -84,8 +87,30 @@ public:
   int addFd( int, short events = POLLIN );
 #endif
 
+#ifdef USING_EPOLL
+  // creates and releases the epoll instance that addFd() and removeFd() register descriptors with
+  bool createEventFds();
+  void destroyEventFds();
+
+  // waits up to timeOut microseconds ( -1 means infinitely ) for registered descriptors to become ready;
+  // the first spinTime microseconds are spent polling without blocking
+  // returns the number of ready descriptors, 0 on timeout, -1 on error
+  int waitEventFds( Int64 timeOut, Int64 spinTime );
+
+  // returns the events reported for the given descriptor by the last waitEventFds() call
+  UInt32 getNotifiedEvents( int fd ) const;
+#endif
+
 protected:
-#ifdef USING_POLL
+#if defined( USING_EPOLL )
+  OmmCommonImpl();
+
+  int				_epollFd;
+  epoll_event*		_epollEvents;
+  int				_epollEventsCapacity;
+  int				_epollEventsCount;
+  nfds_t			_eventFdsCount;
+#elif defined( USING_POLL )
   pollfd*			_eventFds;
   nfds_t			_eventFdsCount;
   nfds_t			_eventFdsCapacity;
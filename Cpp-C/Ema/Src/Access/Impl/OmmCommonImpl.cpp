@@ -7,10 +7,170 @@
 */
 
 #include "OmmBaseImplMap.h"
+#include "GetTime.h"
+
+#ifdef USING_EPOLL
+#include <unistd.h>
+#include <errno.h>
+#endif
 
 using namespace thomsonreuters::ema::access;
 
-#ifdef USING_POLL
+#if defined( USING_EPOLL )
+OmmCommonImpl::OmmCommonImpl() :
+	_epollFd( -1 ),
+	_epollEvents( 0 ),
+	_epollEventsCapacity( 0 ),
+	_epollEventsCount( 0 ),
+	_eventFdsCount( 0 )
+{
+}
+
+bool OmmCommonImpl::createEventFds()
+{
+	destroyEventFds();
+
+	_epollFd = epoll_create1( EPOLL_CLOEXEC );
+	if ( _epollFd < 0 )
+		return false;
+
+	_epollEventsCapacity = 8;
+	_epollEvents = new epoll_event[ _epollEventsCapacity ];
+	_epollEventsCount = 0;
+	_eventFdsCount = 0;
+	return true;
+}
+
+void OmmCommonImpl::destroyEventFds()
+{
+	if ( _epollFd >= 0 )
+	{
+		close( _epollFd );
+		_epollFd = -1;
+	}
+
+	delete [] _epollEvents;
+	_epollEvents = 0;
+	_epollEventsCapacity = 0;
+	_epollEventsCount = 0;
+	_eventFdsCount = 0;
+}
+
+int OmmCommonImpl::addFd( int fd, short events )
+{
+	if ( _epollFd < 0 )
+		return -1;
+
+	// poll and epoll flags share the same values; errors and hangups are always reported
+	epoll_event event;
+	event.events = static_cast< UInt32 >( events ) & ( EPOLLIN | EPOLLOUT | EPOLLPRI );
+	event.data.fd = fd;
+
+	if ( epoll_ctl( _epollFd, EPOLL_CTL_ADD, fd, &event ) < 0 )
+	{
+		if ( errno != EEXIST || epoll_ctl( _epollFd, EPOLL_CTL_MOD, fd, &event ) < 0 )
+			return -1;
+
+		return static_cast< int >( _eventFdsCount ) - 1;
+	}
+
+	// keep room to report every registered descriptor from a single wait
+	if ( static_cast< int >( ++_eventFdsCount ) > _epollEventsCapacity )
+	{
+		_epollEventsCapacity *= 2;
+		delete [] _epollEvents;
+		_epollEvents = new epoll_event[ _epollEventsCapacity ];
+		_epollEventsCount = 0;
+	}
+
+	return static_cast< int >( _eventFdsCount ) - 1;
+}
+
+void OmmCommonImpl::removeFd( int fd )
+{
+	if ( _epollFd < 0 )
+		return;
+
+	// a closed descriptor has already left the epoll set and fails with EBADF or ENOENT
+	epoll_event event;
+	if ( epoll_ctl( _epollFd, EPOLL_CTL_DEL, fd, &event ) == 0 || errno == EBADF )
+	{
+		if ( _eventFdsCount > 0 )
+			--_eventFdsCount;
+	}
+
+	// do not report events of the removed descriptor from the last wait
+	for ( int i = 0; i < _epollEventsCount; ++i )
+		if ( _epollEvents[i].data.fd == fd )
+			_epollEvents[i].events = 0;
+}
+
+int OmmCommonImpl::waitEventFds( Int64 timeOut, Int64 spinTime )
+{
+	_epollEventsCount = 0;
+
+	if ( spinTime > 0 && timeOut != 0 )
+	{
+		UInt64 startTime = GetTime::getMicros();
+		UInt64 spinEndTime = startTime + ( ( timeOut > 0 && timeOut < spinTime ) ? timeOut : spinTime );
+		UInt64 currentTime = startTime;
+
+		do
+		{
+			int retCode = epoll_wait( _epollFd, _epollEvents, _epollEventsCapacity, 0 );
+			if ( retCode != 0 )
+			{
+				_epollEventsCount = retCode > 0 ? retCode : 0;
+				return retCode;
+			}
+
+			currentTime = GetTime::getMicros();
+		}
+		while ( currentTime < spinEndTime );
+
+		if ( timeOut > 0 )
+		{
+			timeOut -= static_cast< Int64 >( currentTime - startTime );
+			if ( timeOut <= 0 )
+				return 0;
+		}
+	}
+
+	int retCode;
+
+	if ( timeOut < 0 )
+		retCode = epoll_wait( _epollFd, _epollEvents, _epollEventsCapacity, -1 );
+	else if ( timeOut % 1000 == 0 )
+		retCode = epoll_wait( _epollFd, _epollEvents, _epollEventsCapacity, static_cast< int >( timeOut / 1000 ) );
+	else
+	{
+		// epoll_wait() has millisecond resolution; wait on the epoll descriptor itself to keep microsecond timeouts
+		pollfd epollPollFd;
+		epollPollFd.fd = _epollFd;
+		epollPollFd.events = POLLIN;
+
+		struct timespec ppollTime;
+		ppollTime.tv_sec = timeOut / static_cast<long long>( 1e6 );
+		ppollTime.tv_nsec = timeOut % static_cast<long long>( 1e6 ) * static_cast<long long>( 1e3 );
+
+		retCode = ppoll( &epollPollFd, 1, &ppollTime, 0 );
+		if ( retCode > 0 )
+			retCode = epoll_wait( _epollFd, _epollEvents, _epollEventsCapacity, 0 );
+	}
+
+	_epollEventsCount = retCode > 0 ? retCode : 0;
+	return retCode;
+}
+
+UInt32 OmmCommonImpl::getNotifiedEvents( int fd ) const
+{
+	for ( int i = 0; i < _epollEventsCount; ++i )
+		if ( _epollEvents[i].data.fd == fd )
+			return _epollEvents[i].events;
+
+	return 0;
+}
+#elif defined( USING_POLL )
 int OmmCommonImpl::addFd( int fd, short events )
 {
 	if ( _eventFdsCount == _eventFdsCapacity )
@@ -58,6 +58,8 @@ OmmIProviderImpl::OmmIProviderImpl(OmmProvider* ommProvider, const OmmIProviderC
 		handleMee("Failed to allocate memory in OmmIProviderImpl::OmmIProviderImpl()");
 		return;
 	}
+
+	createShards(ommIProviderConfig, ommProviderClient, 0, closure);
 }
 
 OmmIProviderImpl::OmmIProviderImpl(OmmProvider* ommProvider, const OmmIProviderConfig& ommIProviderConfig, OmmProviderClient& ommProviderClient, OmmProviderErrorClient& ommProviderErrorClient, void* closure) :
@@ -85,6 +87,50 @@ OmmIProviderImpl::OmmIProviderImpl(OmmProvider* ommProvider, const OmmIProviderC
 		handleMee("Failed to allocate memory in OmmIProviderImpl::OmmIProviderImpl()");
 		return;
 	}
+
+	createShards(ommIProviderConfig, ommProviderClient, &ommProviderErrorClient, closure);
+}
+
+//one of the additional shards created by createShards()
+OmmIProviderImpl::OmmIProviderImpl(OmmProvider* ommProvider, const OmmIProviderConfig& ommIProviderConfig, OmmProviderClient& ommProviderClient, OmmProviderErrorClient* pOmmProviderErrorClient, void* closure, UInt32 shardIndex) :
+	OmmProviderImpl(ommProvider),
+	OmmServerBaseImpl(_ommIProviderActiveConfig, ommProviderClient, closure),
+	_ommIProviderActiveConfig(),
+	_ommIProviderDirectoryStore(*this, _ommIProviderActiveConfig),
+	_storeUserSubmitted(false),
+	_itemWatchList()
+{
+	if (pOmmProviderErrorClient)
+	{
+		try
+		{
+			_pErrorClientHandler = new ErrorClientHandler(*pOmmProviderErrorClient);
+		}
+		catch (std::bad_alloc&)
+		{
+			pOmmProviderErrorClient->onMemoryExhaustion("Failed to allocate memory in OmmIProviderImpl::OmmIProviderImpl()");
+		}
+	}
+
+	_handleTag = (UInt64)shardIndex << EMA_SHARD_HANDLE_SHIFT;
+
+	_ommIProviderActiveConfig.operationModel = ommIProviderConfig._pImpl->getOperationModel();
+	_ommIProviderActiveConfig.dictionaryAdminControl = ommIProviderConfig._pImpl->getAdminControlDictionary();
+	_ommIProviderActiveConfig.directoryAdminControl = ommIProviderConfig._pImpl->getAdminControlDirectory();
+
+	_storeUserSubmitted = _ommIProviderActiveConfig.directoryAdminControl == OmmIProviderConfig::ApiControlEnum ? true : false;
+
+	_ommIProviderDirectoryStore.setClient(this);
+
+	initialize(ommIProviderConfig._pImpl);
+
+	_rsslDirectoryMsgBuffer.length = 2048;
+	_rsslDirectoryMsgBuffer.data = (char*)malloc(_rsslDirectoryMsgBuffer.length * sizeof(char));
+	if (!_rsslDirectoryMsgBuffer.data)
+	{
+		handleMee("Failed to allocate memory in OmmIProviderImpl::OmmIProviderImpl()");
+		return;
+	}
 }
 //only for unit test, internal use
 OmmIProviderImpl::OmmIProviderImpl(const OmmIProviderConfig& ommIProviderConfig, OmmProviderClient& ommProviderClient) :
@@ -116,11 +162,84 @@ OmmIProviderImpl::OmmIProviderImpl(const OmmIProviderConfig& ommIProviderConfig,
 
 OmmIProviderImpl::~OmmIProviderImpl()
 {
+	destroyShards();
+
 	free(_rsslDirectoryMsgBuffer.data);
 
 	OmmServerBaseImpl::uninitialize(false, false);
 }
 
+void OmmIProviderImpl::createShards(const OmmIProviderConfig& ommIProviderConfig, OmmProviderClient& ommProviderClient, OmmProviderErrorClient* pOmmProviderErrorClient, void* closure)
+{
+	if (_activeServerConfig.serverShardCount < 2 || _state != ReactorInitializedEnum)
+		return;
+
+	try
+	{
+		for (UInt32 shardIndex = 1; shardIndex < _activeServerConfig.serverShardCount; ++shardIndex)
+		{
+			OmmIProviderImpl* pShard = new OmmIProviderImpl(_pOmmProvider, ommIProviderConfig, ommProviderClient, pOmmProviderErrorClient, closure, shardIndex);
+
+			/* The failure was already passed to the error client */
+			if (pShard->getState() != ReactorInitializedEnum)
+			{
+				delete pShard;
+				break;
+			}
+
+			_shards.push_back(pShard);
+		}
+	}
+	catch (...)
+	{
+		destroyShards();
+		free(_rsslDirectoryMsgBuffer.data);
+		OmmServerBaseImpl::uninitialize(false, false);
+		throw;
+	}
+
+	if (OmmLoggerClient::VerboseEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+	{
+		EmaString temp("Serving clients from ");
+		temp.append(_shards.size() + 1).append(" reactors.");
+		_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::VerboseEnum, temp);
+	}
+}
+
+void OmmIProviderImpl::destroyShards()
+{
+	for (UInt32 idx = 0; idx < _shards.size(); ++idx)
+		delete _shards[idx];
+
+	_shards.clear();
+}
+
+OmmIProviderImpl* OmmIProviderImpl::getShard(UInt64 handle)
+{
+	UInt64 shardIndex = handle >> EMA_SHARD_HANDLE_SHIFT;
+
+	return shardIndex > 0 && shardIndex <= _shards.size() ? _shards[(UInt32)shardIndex - 1] : this;
+}
+
+bool OmmIProviderImpl::isShardFanOut(const RsslMsg* pRsslMsg, UInt64 handle) const
+{
+	return handle == 0 && (pRsslMsg->msgBase.domainType == ema::rdm::MMT_LOGIN || pRsslMsg->msgBase.domainType == ema::rdm::MMT_DIRECTORY);
+}
+
+bool OmmIProviderImpl::hasClientSession()
+{
+	MutexLocker lock(_userLock);
+
+	return _pServerChannelHandler && _pServerChannelHandler->getClientSessionList().size() > 0;
+}
+
+bool OmmIProviderImpl::hasItemCallbackHandle(UInt64 handle)
+{
+	MutexLocker lock(_userLock);
+
+	return _pItemCallbackClient && _pItemCallbackClient->hasItem(handle);
+}
+
 bool OmmIProviderImpl::isApiDispatching() const
 {
 	return _ommIProviderActiveConfig.operationModel == OmmIProviderConfig::ApiDispatchEnum ? true : false;
@@ -223,6 +342,15 @@ void OmmIProviderImpl::readCustomConfig(EmaConfigServerImpl* pConfigImpl)
 
 UInt64 OmmIProviderImpl::registerClient(const ReqMsg& reqMsg, OmmProviderClient& client, void* closure, UInt64 parentHandle)
 {
+	if (_shards.size() && !hasClientSession())
+	{
+		for (UInt32 idx = 0; idx < _shards.size(); ++idx)
+		{
+			if (_shards[idx]->hasClientSession())
+				return _shards[idx]->registerClient(reqMsg, client, closure, parentHandle);
+		}
+	}
+
 	_userLock.lock();
 
 	const ReqMsgEncoder& reqMsgEncoder = static_cast<const ReqMsgEncoder&>( reqMsg.getEncoder() );
@@ -250,6 +378,18 @@ UInt64 OmmIProviderImpl::registerClient(const ReqMsg& reqMsg, OmmProviderClient&
 
 void OmmIProviderImpl::reissue(const ReqMsg& reqMsg, UInt64 handle)
 {
+	if (_shards.size() && !hasItemCallbackHandle(handle))
+	{
+		for (UInt32 idx = 0; idx < _shards.size(); ++idx)
+		{
+			if (_shards[idx]->hasItemCallbackHandle(handle))
+			{
+				_shards[idx]->reissue(reqMsg, handle);
+				return;
+			}
+		}
+	}
+
 	_userLock.lock();
 
 	const ReqMsgEncoder& reqMsgEncoder = static_cast<const ReqMsgEncoder&>(reqMsg.getEncoder());
@@ -273,6 +413,12 @@ void OmmIProviderImpl::submit(const GenericMsg& genericMsg, UInt64 handle)
 	const GenericMsgEncoder& genericMsgEncoder = static_cast<const GenericMsgEncoder&>(genericMsg.getEncoder());
 	submitMsgOpts.pRsslMsg = (RsslMsg*)genericMsgEncoder.getRsslGenericMsg();
 
+	if (_shards.size() && getShard(handle) != this)
+	{
+		getShard(handle)->submit(genericMsg, handle);
+		return;
+	}
+
 	_userLock.lock();
 
 	ItemInfoPtr itemInfo = getItemInfo(handle);
@@ -328,6 +474,20 @@ void OmmIProviderImpl::submit(const RefreshMsg& refreshMsg, UInt64 handle)
 	const RefreshMsgEncoder& refreshMsgEncoder = static_cast<const RefreshMsgEncoder&>(refreshMsg.getEncoder());
 	submitMsgOpts.pRsslMsg = (RsslMsg*)refreshMsgEncoder.getRsslRefreshMsg();
 
+	if (_shards.size())
+	{
+		if (isShardFanOut(submitMsgOpts.pRsslMsg, handle))
+		{
+			for (UInt32 idx = 0; idx < _shards.size(); ++idx)
+				_shards[idx]->submit(refreshMsg, handle);
+		}
+		else if (getShard(handle) != this)
+		{
+			getShard(handle)->submit(refreshMsg, handle);
+			return;
+		}
+	}
+
 	_userLock.lock();
 
 	ItemInfoPtr itemInfo = getItemInfo(handle);
@@ -584,6 +744,20 @@ void OmmIProviderImpl::submit(const UpdateMsg& updateMsg, UInt64 handle)
 	const UpdateMsgEncoder& updateMsgEncoder = static_cast<const UpdateMsgEncoder&>(updateMsg.getEncoder());
 	submitMsgOpts.pRsslMsg = (RsslMsg*)updateMsgEncoder.getRsslUpdateMsg();
 
+	if (_shards.size())
+	{
+		if (isShardFanOut(submitMsgOpts.pRsslMsg, handle))
+		{
+			for (UInt32 idx = 0; idx < _shards.size(); ++idx)
+				_shards[idx]->submit(updateMsg, handle);
+		}
+		else if (getShard(handle) != this)
+		{
+			getShard(handle)->submit(updateMsg, handle);
+			return;
+		}
+	}
+
 	_userLock.lock();
 
 	ItemInfoPtr itemInfo = getItemInfo(handle);
@@ -762,6 +936,20 @@ void OmmIProviderImpl::submit(const StatusMsg& stausMsg, UInt64 handle)
 	const StatusMsgEncoder& statusMsgEncoder = static_cast<const StatusMsgEncoder&>(stausMsg.getEncoder());
 	submitMsgOpts.pRsslMsg = (RsslMsg*)statusMsgEncoder.getRsslStatusMsg();
 
+	if (_shards.size())
+	{
+		if (isShardFanOut(submitMsgOpts.pRsslMsg, handle))
+		{
+			for (UInt32 idx = 0; idx < _shards.size(); ++idx)
+				_shards[idx]->submit(stausMsg, handle);
+		}
+		else if (getShard(handle) != this)
+		{
+			getShard(handle)->submit(stausMsg, handle);
+			return;
+		}
+	}
+
 	_userLock.lock();
 
 	ItemInfoPtr itemInfo = getItemInfo(handle);
@@ -1192,6 +1380,9 @@ Int64 OmmIProviderImpl::dispatch(Int64 timeOut)
 
 void OmmIProviderImpl::unregister(UInt64 handle)
 {
+	for (UInt32 idx = 0; idx < _shards.size(); ++idx)
+		_shards[idx]->unregister(handle);
+
 	_userLock.lock();
 
 	if ( _pItemCallbackClient ) _pItemCallbackClient->unregister( handle );
@@ -1205,11 +1396,17 @@ void OmmIProviderImpl::submit(const AckMsg& ackMsg, UInt64 handle)
 	rsslClearReactorSubmitMsgOptions(&submitMsgOpts);
 	const AckMsgEncoder& ackMsgEncoder = static_cast<const AckMsgEncoder&>(ackMsg.getEncoder());
 	submitMsgOpts.pRsslMsg = (RsslMsg*)ackMsgEncoder.getRsslAckMsg();
-
-	_userLock.lock();
-
-	ItemInfoPtr itemInfo = getItemInfo(handle);
-
+
+	if (_shards.size() && getShard(handle) != this)
+	{
+		getShard(handle)->submit(ackMsg, handle);
+		return;
+	}
+
+	_userLock.lock();
+
+	ItemInfoPtr itemInfo = getItemInfo(handle);
+
 	if ((itemInfo == 0))
 	{
 		_userLock.unlock();
@@ -1534,11 +1731,18 @@ UInt32 OmmIProviderImpl::getRequestTimeout()
 }
 
 void OmmIProviderImpl::getConnectedClientChannelInfo(EmaVector<ChannelInformation> & ci) {
-  return getConnectedClientChannelInfoImpl(ci);
+  getConnectedClientChannelInfoImpl(ci);
+
+  EmaVector<ChannelInformation> shardCi;
+  for (UInt32 idx = 0; idx < _shards.size(); ++idx) {
+	_shards[idx]->getConnectedClientChannelInfoImpl(shardCi);
+	for (UInt32 index = 0; index < shardCi.size(); ++index)
+		ci.push_back(shardCi[index]);
+  }
 }
 
 void OmmIProviderImpl::getConnectedClientChannelStats(UInt64 clientHandle, ChannelStatistics & cs) {
-	return getConnectedClientChannelStatsImpl(clientHandle, cs);
+	return getShard(clientHandle)->getConnectedClientChannelStatsImpl(clientHandle, cs);
 }
 
 /* method getChannelInfo not supported for IProvider objects. Function is defined
@@ -1550,6 +1754,20 @@ void OmmIProviderImpl::getChannelInformation(ChannelInformation&) {
 
 void OmmIProviderImpl::modifyIOCtl(Int32 code, Int32 value, UInt64 handle)
 {
+	if (_shards.size())
+	{
+		if ((RsslIoctlCodes)code == RSSL_SERVER_NUM_POOL_BUFFERS)
+		{
+			for (UInt32 idx = 0; idx < _shards.size(); ++idx)
+				_shards[idx]->modifyIOCtl(code, value, handle);
+		}
+		else if (getShard(handle) != this)
+		{
+			getShard(handle)->modifyIOCtl(code, value, handle);
+			return;
+		}
+	}
+
 	_userLock.lock();
 
 	RsslError rsslError;
@@ -1595,6 +1813,12 @@ void OmmIProviderImpl::modifyIOCtl(Int32 code, Int32 value, UInt64 handle)
 
 void OmmIProviderImpl::closeChannel(UInt64 clientHandle)
 {
+	if (_shards.size() && getShard(clientHandle) != this)
+	{
+		getShard(clientHandle)->closeChannel(clientHandle);
+		return;
+	}
+
 	_userLock.lock();
 
 	ClientSessionPtr pClientSession = _pServerChannelHandler->getClientSession(clientHandle);
@@ -88,6 +88,20 @@ public:
 
 private:
 
+	OmmIProviderImpl(OmmProvider* ommProvider, const OmmIProviderConfig&, OmmProviderClient&, OmmProviderErrorClient*, void* closure, UInt32 shardIndex);
+
+	void createShards(const OmmIProviderConfig&, OmmProviderClient&, OmmProviderErrorClient*, void* closure);
+
+	void destroyShards();
+
+	OmmIProviderImpl* getShard(UInt64 handle);
+
+	bool isShardFanOut(const RsslMsg*, UInt64 handle) const;
+
+	bool hasClientSession();
+
+	bool hasItemCallbackHandle(UInt64 handle);
+
 	bool encodeServiceIdFromName(const EmaString& serviceName, RsslUInt16& serviceId, RsslMsgBase& rsslMsgBase );
 
 	bool validateServiceId(RsslUInt16 serviceId, RsslMsgBase& rsslMsgBase);
@@ -104,6 +118,7 @@ private:
 	RsslRDMDirectoryMsg								_rsslDirectoryMsg;
 	RsslBuffer										_rsslDirectoryMsgBuffer;
 	ItemWatchList									_itemWatchList;
+	EmaVector< OmmIProviderImpl* >					_shards;
 
 	OmmIProviderImpl();
 	OmmIProviderImpl(const OmmIProviderImpl&);
@@ -67,6 +67,7 @@ OmmServerBaseImpl::OmmServerBaseImpl(ActiveServerConfig& activeServerConfig, Omm
 	_pErrorClientHandler(0),
 	_theTimeOuts(),
 	_pRsslServer(0),
+	_handleTag(0),
 	_pClosure(closure),
 	_bApiDispatchThreadStarted(false)
 {
@@ -98,6 +99,7 @@ OmmServerBaseImpl::OmmServerBaseImpl(ActiveServerConfig& activeServerConfig, Omm
 	_pErrorClientHandler(0),
 	_theTimeOuts(),
 	_pRsslServer(0),
+	_handleTag(0),
 	_pClosure(closure),
 	_bApiDispatchThreadStarted(false)
 {
@@ -144,6 +146,8 @@ void OmmServerBaseImpl::readConfig(EmaConfigServerImpl* pConfigServerImpl)
 
 	pConfigServerImpl->get<Int64>(instanceNodeName + "DispatchTimeoutApiThread", _activeServerConfig.dispatchTimeoutApiThread);
 
+	pConfigServerImpl->get<Int64>(instanceNodeName + "DispatchSpinTimeApiThread", _activeServerConfig.dispatchSpinTimeApiThread);
+
 	if (pConfigServerImpl->get<UInt64>(instanceNodeName + "CatchUnhandledException", tmp))
 		_activeServerConfig.catchUnhandledException = static_cast<UInt32>(tmp > 0 ? true : false);
 
@@ -152,6 +156,9 @@ void OmmServerBaseImpl::readConfig(EmaConfigServerImpl* pConfigServerImpl)
 
 	if (pConfigServerImpl->get<UInt64>(instanceNodeName + "MaxDispatchCountUserThread", tmp))
 		_activeServerConfig.maxDispatchCountUserThread = static_cast<UInt32>(tmp > maxUInt32 ? maxUInt32 : tmp);
+
+	if (pConfigServerImpl->get<UInt64>(instanceNodeName + "ServerShardCount", tmp))
+		_activeServerConfig.setServerShardCount(tmp);
 	
 	Int64 tmp1;
 	
@@ -327,6 +334,29 @@ void OmmServerBaseImpl::readConfig(EmaConfigServerImpl* pConfigServerImpl)
 		
 	}
 
+	if (_activeServerConfig.serverShardCount > 1)
+	{
+		EmaString errorMsg;
+
+#ifdef WIN32
+		errorMsg.set("ServerShardCount is not supported on this platform");
+#else
+		if (!isApiDispatching())
+			errorMsg.set("ServerShardCount requires the ApiDispatch operation model");
+		else if (_activeServerConfig.pServerConfig->connectionType != RSSL_CONN_TYPE_SOCKET &&
+			_activeServerConfig.pServerConfig->connectionType != RSSL_CONN_TYPE_ENCRYPTED &&
+			_activeServerConfig.pServerConfig->connectionType != RSSL_CONN_TYPE_WEBSOCKET)
+			errorMsg.set("ServerShardCount is not supported for server type ").append(_activeServerConfig.pServerConfig->getType());
+#endif
+
+		if (errorMsg.length())
+		{
+			errorMsg.append("; will use a single reactor");
+			pConfigServerImpl->appendConfigError(errorMsg, OmmLoggerClient::WarningEnum);
+			_activeServerConfig.serverShardCount = 1;
+		}
+	}
+
 	catchUnhandledException(_activeServerConfig.catchUnhandledException);
 }
 
@@ -430,6 +460,7 @@ ServerConfig* OmmServerBaseImpl::readServerConfig( EmaConfigServerImpl* pConfigS
 		/* Socket's a superset of Encrypted for servers */
 		case RSSL_CONN_TYPE_SOCKET:
 		case RSSL_CONN_TYPE_WEBSOCKET:
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
 		{
 			if (socketServerConfig == 0)
 			{
@@ -551,6 +582,14 @@ ServerConfig* OmmServerBaseImpl::readServerConfig( EmaConfigServerImpl* pConfigS
 	if (pConfigServerImpl->get<UInt64>(serverNodeName + "HighWaterMark", tempUInt))
 		newServerConfig->highWaterMark = tempUInt > maxUInt32 ? maxUInt32 : (UInt32)tempUInt;
 
+	tempUInt = 0;
+	if (pConfigServerImpl->get<UInt64>(serverNodeName + "AutoPackSize", tempUInt))
+		newServerConfig->autoPackSize = tempUInt > maxUInt32 ? maxUInt32 : (UInt32)tempUInt;
+
+	tempUInt = 0;
+	if (pConfigServerImpl->get<UInt64>(serverNodeName + "AutoPackDelay", tempUInt))
+		newServerConfig->autoPackDelay = tempUInt > maxUInt32 ? maxUInt32 : (UInt32)tempUInt;
+
 	EmaString instanceNodeName(pConfigServerImpl->getInstanceNodeName());
 	instanceNodeName.append(_activeServerConfig.configuredName).append("|");
 
@@ -648,6 +687,9 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 
 		readConfig(serverConfigImpl);
 
+		/* each shard serves its share of the connections, and so of the items */
+		_itemInfoHash.rehash(_activeServerConfig.itemCountHint / _activeServerConfig.serverShardCount);
+
 		_pLoggerClient = OmmLoggerClient::create(_activeServerConfig.loggerConfig.loggerType, _activeServerConfig.loggerConfig.includeDateInLoggerOutput,
 			_activeServerConfig.loggerConfig.minLoggerSeverity, _activeServerConfig.loggerConfig.loggerFileName);
 
@@ -742,6 +784,16 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 		FD_SET(_pipe.readFD(), &_exceptFds);
 		FD_SET(_pRsslReactor->eventFd, &_readFds);
 		FD_SET(_pRsslReactor->eventFd, &_exceptFds);
+#elif defined( USING_EPOLL )
+		if (!createEventFds() || addFd(_pipe.readFD()) < 0 || addFd(_pRsslReactor->eventFd) < 0)
+		{
+			EmaString temp("Failed to initialize OmmServerBaseImpl (epoll). System errno='");
+			temp.append(errno).append("'. ");
+			if (OmmLoggerClient::ErrorEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+				_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::ErrorEnum, temp);
+			throwIueException(temp, OmmInvalidUsageException::InternalErrorEnum);
+			return;
+		}
 #else
 		_eventFdsCapacity = 8;
 		_eventFds = new pollfd[_eventFdsCapacity];
@@ -853,8 +905,10 @@ void OmmServerBaseImpl::initialize(EmaConfigServerImpl* serverConfigImpl)
 			_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::VerboseEnum, temp);
 		}
 
-#ifdef USING_SELECT
+#if defined( USING_SELECT )
 		FD_SET(_pRsslServer->socketId, &_readFds);
+#elif defined( USING_EPOLL )
+		addFd(_pRsslServer->socketId);
 #else
 		_serverReadEventFdsIdx = addFd(_pRsslServer->socketId);
 #endif
@@ -946,12 +1000,13 @@ void OmmServerBaseImpl::bindServerOptions(RsslBindOptions& bindOptions, const Em
 		}
 		case RSSL_CONN_TYPE_SOCKET:
 		case RSSL_CONN_TYPE_WEBSOCKET:
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
 		{
 			SocketServerConfig *socketServerConfig = static_cast<SocketServerConfig *>(_activeServerConfig.pServerConfig);
 			bindOptions.tcpOpts.tcp_nodelay = socketServerConfig->tcpNodelay;
 			bindOptions.serviceName = const_cast<char *>(socketServerConfig->serviceName.c_str());
 			bindOptions.maxFragmentSize = (RsslUInt32)socketServerConfig->maxFragmentSize;
-			bindOptions.serverSharedSocket = socketServerConfig->serverSharedSocket;
+			bindOptions.serverSharedSocket = _activeServerConfig.serverShardCount > 1 ? RSSL_TRUE : socketServerConfig->serverSharedSocket;
 
 			if (RSSL_CONN_TYPE_WEBSOCKET == _activeServerConfig.pServerConfig->connectionType)
 			{
@@ -1008,6 +1063,11 @@ RsslReactor* OmmServerBaseImpl::getRsslReactor()
 	return _pRsslReactor;
 }
 
+UInt64 OmmServerBaseImpl::getHandleTag() const
+{
+	return _handleTag;
+}
+
 bool OmmServerBaseImpl::isPipeWritten()
 {
 	MutexLocker lock(_pipeLock);
@@ -1049,7 +1109,7 @@ void OmmServerBaseImpl::addItemInfo(ItemInfo* itemInfo)
 {
 	_userLock.lock();
 
-	UInt64 handle = (UInt64)itemInfo;
+	UInt64 handle = itemInfo->getHandle();
 
 	ItemInfoPtr* itemInfoPtr = _itemInfoHash.find(handle);
 
@@ -1084,7 +1144,7 @@ void OmmServerBaseImpl::removeItemInfo(ItemInfo* itemInfo, bool eraseItemGroup)
 		_pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::VerboseEnum, temp);
 	}
 
-	_itemInfoHash.erase((UInt64)itemInfo);
+	_itemInfoHash.erase(itemInfo->getHandle());
 	itemInfo->getClientSession()->removeItemInfo(itemInfo);
 
 	if (eraseItemGroup && itemInfo->hasItemGroup() )
@@ -1205,8 +1265,10 @@ void OmmServerBaseImpl::uninitialize(bool caughtException, bool calledFromInit)
 		removeFd(_pRsslServer->socketId);
 	}
 
+#ifndef USING_EPOLL
 	_pipeReadEventFdsIdx = -1;
 	_serverReadEventFdsIdx = -1;
+#endif
 #endif
 
 	OmmLoggerClient::destroy(_pLoggerClient);
@@ -1215,7 +1277,9 @@ void OmmServerBaseImpl::uninitialize(bool caughtException, bool calledFromInit)
 
 	if (!calledFromInit) _userLock.unlock();
 
-#ifdef USING_POLL
+#if defined( USING_EPOLL )
+	destroyEventFds();
+#elif defined( USING_POLL )
 	delete[] _eventFds;
 #endif
 }
@@ -1339,6 +1403,47 @@ Int64 OmmServerBaseImpl::rsslReactorDispatchLoop(Int64 timeOut, UInt32 count, bo
 			--selectRetCode;
 		}
 
+#elif defined( USING_EPOLL )
+
+		selectRetCode = waitEventFds(timeOut, isApiDispatching() ? _activeServerConfig.dispatchSpinTimeApiThread : 0);
+
+		if (selectRetCode > 0 && (getNotifiedEvents(_pRsslServer->socketId) & EPOLLIN))
+		{
+			rsslClearReactorAcceptOptions(&_reactorAcceptOptions);
+			clearRsslErrorInfo(&_reactorDispatchErrorInfo);
+
+			ClientSession* clientSession = ClientSession::create(this);
+
+			_reactorAcceptOptions.rsslAcceptOptions.userSpecPtr = clientSession;
+			_reactorAcceptOptions.initializationTimeout = _activeServerConfig.pServerConfig->initializationTimeout;
+
+			if (rsslReactorAccept(_pRsslReactor, _pRsslServer, &_reactorAcceptOptions, (RsslReactorChannelRole*)&_providerRole, &_reactorDispatchErrorInfo) != RSSL_RET_SUCCESS)
+			{
+				ClientSession::destroy(clientSession);
+
+				if (OmmLoggerClient::ErrorEnum >= _activeServerConfig.loggerConfig.minLoggerSeverity)
+				{
+					EmaString temp("Call to rsslReactorAccept() failed. Internal sysError='");
+					temp.append(_reactorDispatchErrorInfo.rsslError.sysError)
+						.append("' Error Id ").append(_reactorDispatchErrorInfo.rsslError.rsslErrorId).append("' ")
+						.append("' Error Location='").append(_reactorDispatchErrorInfo.errorLocation).append("' ")
+						.append("' Error text='").append(_reactorDispatchErrorInfo.rsslError.text).append("'. ");
+
+					_userLock.lock();
+					if (_pLoggerClient) _pLoggerClient->log(_activeServerConfig.instanceName, OmmLoggerClient::ErrorEnum, temp);
+					_userLock.unlock();
+				}
+			}
+
+			--selectRetCode;
+		}
+
+		if (selectRetCode > 0 && (getNotifiedEvents(_pipe.readFD()) & EPOLLIN))
+		{
+			pipeRead();
+			--selectRetCode;
+		}
+
 #elif defined( USING_PPOLL )
 
 		struct timespec ppollTime;
@@ -2076,7 +2181,7 @@ void OmmServerBaseImpl::getConnectedClientChannelStatsImpl(UInt64 clientHandle,
 	_userLock.lock();
 
 	for (UInt32 index = 0; index < connectedChannels.size(); ++index) {
-		if ((UInt64)connectedChannels[index] == clientHandle) {
+		if (((UInt64)connectedChannels[index] | _handleTag) == clientHandle) {
 
 			RsslReactorChannel* rrc = connectedChannels[index];
 
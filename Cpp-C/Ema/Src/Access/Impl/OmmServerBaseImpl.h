@@ -13,10 +13,13 @@
 #define USING_SELECT
 #else
 #define USING_POLL
-#define USING_PPOLL
+#define USING_EPOLL
 #endif
 
-#ifdef USING_PPOLL
+#if defined( USING_EPOLL )
+#include <sys/epoll.h>
+#include <poll.h>
+#elif defined( USING_PPOLL )
 #include <poll.h>
 #endif
 #include <iostream>
@@ -36,6 +39,11 @@
 #include "ReqMsg.h"
 #include "PostMsg.h"
 #include "ChannelInformation.h"
+#include "FlatHashTable.h"
+
+// Item and client handles of a sharded interactive provider carry the index of the owning
+// shard in their top bits, which user space addresses leave clear.
+#define EMA_SHARD_HANDLE_SHIFT 56
 
 namespace thomsonreuters {
 
@@ -123,6 +131,8 @@ public:
 
 	RsslReactor* getRsslReactor();
 
+	UInt64 getHandleTag() const;
+
 	void installTimeOut();
 
 	void handleIue(const EmaString&, Int32 errorCode);
@@ -258,6 +268,7 @@ protected:
 	GenericMsg					_genericMsg;
 	PostMsg						_postMsg;
 	RsslServer*					_pRsslServer;
+	UInt64						_handleTag;
 
 
 private:
@@ -284,7 +295,7 @@ private:
 		bool operator()(const UInt64&, const UInt64&) const;
 	};
 
-	typedef HashTable< UInt64, ItemInfoPtr, UInt64rHasher, UInt64Equal_To > ItemInfoHash;
+	typedef FlatHashTable< UInt64, ItemInfoPtr, UInt64rHasher, UInt64Equal_To > ItemInfoHash;
 
 	ItemInfoHash _itemInfoHash;
 
@@ -694,6 +694,7 @@ int  ProgrammaticConfigure::retrieveChannelTypeConfig(const EmaString& channelNa
 										case RSSL_CONN_TYPE_HTTP:
 										case RSSL_CONN_TYPE_ENCRYPTED:
 										case RSSL_CONN_TYPE_WEBSOCKET:
+										case RSSL_CONN_TYPE_BIDIR_SHMEM:
 											return channType;
 										default:
 											return -1;
@@ -1154,6 +1155,10 @@ void ProgrammaticConfigure::retrieveInstanceCommonConfig( const Map& map, const
 												{
 													activeConfig.dispatchTimeoutApiThread = eentry.getInt();
 												}
+												else if ( eentry.getName() == "DispatchSpinTimeApiThread" )
+												{
+													activeConfig.dispatchSpinTimeApiThread = eentry.getInt();
+												}
 												else if (eentry.getName() == "XmlTraceMaxFileSize")
 												{
 													activeConfig.xmlTraceMaxFileSize = eentry.getInt();
@@ -1286,6 +1291,10 @@ void ProgrammaticConfigure::retrieveInstanceCommonConfig(const Map& map, const E
 									{
 										activeConfig.setMaxDispatchCountUserThread(eentry.getUInt());
 									}
+									else if (eentry.getName() == "ServerShardCount")
+									{
+										activeConfig.setServerShardCount(eentry.getUInt());
+									}
 									else if (eentry.getName() == "XmlTraceToFile")
 									{
 										activeConfig.xmlTraceToFile = eentry.getUInt() ? true : false;
@@ -1351,6 +1360,10 @@ void ProgrammaticConfigure::retrieveInstanceCommonConfig(const Map& map, const E
 									{
 										activeConfig.dispatchTimeoutApiThread = eentry.getInt();
 									}
+									else if (eentry.getName() == "DispatchSpinTimeApiThread")
+									{
+										activeConfig.dispatchSpinTimeApiThread = eentry.getInt();
+									}
 									else if (eentry.getName() == "XmlTraceMaxFileSize")
 									{
 										activeConfig.xmlTraceMaxFileSize = eentry.getInt();
@@ -1694,7 +1707,7 @@ void ProgrammaticConfigure::retrieveChannelInfo( const MapEntry& mapEntry, const
 	EmaString name, interfaceName, host, port, objectName, tunnelingProxyHost, tunnelingProxyPort, location, sslCAStore, wsProtocols;
 	UInt16 channelType, compressionType, encryptedProtocolType;
 	UInt64 guaranteedOutputBuffers, compressionThreshold, connectionPingTimeout, numInputBuffers, sysSendBufSize, sysRecvBufSize, highWaterMark,
-	       tcpNodelay, enableSessionMgnt, encryptedSslProtocolVer, initializationTimeout, wsMaxMsgSize;
+	       autoPackSize, autoPackDelay, tcpNodelay, enableSessionMgnt, encryptedSslProtocolVer, initializationTimeout, wsMaxMsgSize;
 
 	UInt64 flags = 0;
 	UInt64 mcastFlags = 0;
@@ -1813,6 +1826,7 @@ void ProgrammaticConfigure::retrieveChannelInfo( const MapEntry& mapEntry, const
 				case RSSL_CONN_TYPE_HTTP:
 				case RSSL_CONN_TYPE_ENCRYPTED:
 				case RSSL_CONN_TYPE_WEBSOCKET:
+				case RSSL_CONN_TYPE_BIDIR_SHMEM:
 					flags |= 0x10;
 					break;
 				default:
@@ -1893,6 +1907,16 @@ void ProgrammaticConfigure::retrieveChannelInfo( const MapEntry& mapEntry, const
 				highWaterMark = channelEntry.getUInt();
 				flags |= 0x8000000;
 			}
+			else if ( channelEntry.getName() == "AutoPackSize" )
+			{
+				autoPackSize = channelEntry.getUInt();
+				flags |= 0x10000000;
+			}
+			else if ( channelEntry.getName() == "AutoPackDelay" )
+			{
+				autoPackDelay = channelEntry.getUInt();
+				flags |= 0x20000000;
+			}
 			else if ( channelEntry.getName() == "TcpNodelay" )
 			{
 				tcpNodelay = channelEntry.getUInt();
@@ -2029,7 +2053,7 @@ void ProgrammaticConfigure::retrieveChannelInfo( const MapEntry& mapEntry, const
 					return;
 				}
 			}
-			else if (channelType == RSSL_CONN_TYPE_SOCKET || channelType == RSSL_CONN_TYPE_ENCRYPTED || channelType == RSSL_CONN_TYPE_HTTP || channelType == RSSL_CONN_TYPE_WEBSOCKET)
+			else if (channelType == RSSL_CONN_TYPE_SOCKET || channelType == RSSL_CONN_TYPE_ENCRYPTED || channelType == RSSL_CONN_TYPE_HTTP || channelType == RSSL_CONN_TYPE_WEBSOCKET || channelType == RSSL_CONN_TYPE_BIDIR_SHMEM)
 			{
 				SocketChannelConfig* socketChannelConfig;
 
@@ -2050,7 +2074,7 @@ void ProgrammaticConfigure::retrieveChannelInfo( const MapEntry& mapEntry, const
 				activeConfig.configChannelSet.push_back(pCurrentChannelConfig);
 
 				SocketChannelConfig* fileCfgSocket = NULL;
-				if (fileCfg && ((fileCfg->connectionType == RSSL_CONN_TYPE_SOCKET) || (fileCfg->connectionType == RSSL_CONN_TYPE_ENCRYPTED) || (fileCfg->connectionType == RSSL_CONN_TYPE_HTTP) || (fileCfg->connectionType == RSSL_CONN_TYPE_WEBSOCKET)))
+				if (fileCfg && ((fileCfg->connectionType == RSSL_CONN_TYPE_SOCKET) || (fileCfg->connectionType == RSSL_CONN_TYPE_ENCRYPTED) || (fileCfg->connectionType == RSSL_CONN_TYPE_HTTP) || (fileCfg->connectionType == RSSL_CONN_TYPE_WEBSOCKET) || (fileCfg->connectionType == RSSL_CONN_TYPE_BIDIR_SHMEM)))
 					fileCfgSocket = static_cast<SocketChannelConfig*>(fileCfg);
 
 				if (flags & 0x80)
@@ -2208,6 +2232,16 @@ void ProgrammaticConfigure::retrieveChannelInfo( const MapEntry& mapEntry, const
 		else if ( useFileCfg )
 			pCurrentChannelConfig->highWaterMark = fileCfg->highWaterMark;
 
+		if ( flags & 0x10000000 )
+			pCurrentChannelConfig->autoPackSize = autoPackSize > MAX_UNSIGNED_INT32 ? MAX_UNSIGNED_INT32 : (UInt32) autoPackSize;
+		else if ( useFileCfg )
+			pCurrentChannelConfig->autoPackSize = fileCfg->autoPackSize;
+
+		if ( flags & 0x20000000 )
+			pCurrentChannelConfig->autoPackDelay = autoPackDelay > MAX_UNSIGNED_INT32 ? MAX_UNSIGNED_INT32 : (UInt32) autoPackDelay;
+		else if ( useFileCfg )
+			pCurrentChannelConfig->autoPackDelay = fileCfg->autoPackDelay;
+
 		if ( flags & 0x8000 )
 			pCurrentChannelConfig->connectionPingTimeout = connectionPingTimeout > MAX_UNSIGNED_INT32  ? MAX_UNSIGNED_INT32 : ( UInt32 )connectionPingTimeout;
 		else if ( useFileCfg )
@@ -2229,7 +2263,7 @@ void ProgrammaticConfigure::retrieveServerInfo(const MapEntry& mapEntry, const E
 	EmaString name, interfaceName, port, serverCert, serverPrivateKey, dhParams, cipherSuite, libSslName, libCryptoName, libCurlName, wsProtocols;
 	UInt16 serverType, compressionType;
 	UInt64 guaranteedOutputBuffers, compressionThreshold, connectionMinPingTimeout, connectionPingTimeout, numInputBuffers, sysSendBufSize, sysRecvBufSize, highWaterMark,
-		tcpNodelay, initializationTimeout, maxFragmentSize, serverSharedSocket;
+		autoPackSize, autoPackDelay, tcpNodelay, initializationTimeout, maxFragmentSize, serverSharedSocket;
 
 	UInt64 flags = 0;
 	UInt64 mcastFlags = 0;
@@ -2314,6 +2348,10 @@ void ProgrammaticConfigure::retrieveServerInfo(const MapEntry& mapEntry, const E
 				case RSSL_CONN_TYPE_ENCRYPTED:
 					flags |= ServerTypeFlagEnum;
 					break;
+
+				case RSSL_CONN_TYPE_BIDIR_SHMEM:
+					flags |= ServerTypeFlagEnum;
+					break;
 				default:
 					EmaString text("Invalid ServerType [");
 					text.append(serverType);
@@ -2373,6 +2411,16 @@ void ProgrammaticConfigure::retrieveServerInfo(const MapEntry& mapEntry, const E
 				highWaterMark = serverEntry.getUInt();
 				flags |= HighWaterMarkFlagEnum;
 			}
+			else if (serverEntry.getName() == "AutoPackSize")
+			{
+				autoPackSize = serverEntry.getUInt();
+				flags |= AutoPackSizeFlagEnum;
+			}
+			else if (serverEntry.getName() == "AutoPackDelay")
+			{
+				autoPackDelay = serverEntry.getUInt();
+				flags |= AutoPackDelayFlagEnum;
+			}
 			else if (serverEntry.getName() == "TcpNodelay")
 			{
 				tcpNodelay = serverEntry.getUInt();
@@ -2497,6 +2545,16 @@ void ProgrammaticConfigure::retrieveServerInfo(const MapEntry& mapEntry, const E
 			else if (fileCfgSocket)
 				pCurrentServerConfig->highWaterMark = fileCfg->highWaterMark;
 
+			if (flags & AutoPackSizeFlagEnum)
+				pCurrentServerConfig->autoPackSize = autoPackSize > MAX_UNSIGNED_INT32 ? MAX_UNSIGNED_INT32 : (UInt32)autoPackSize;
+			else if (fileCfgSocket)
+				pCurrentServerConfig->autoPackSize = fileCfg->autoPackSize;
+
+			if (flags & AutoPackDelayFlagEnum)
+				pCurrentServerConfig->autoPackDelay = autoPackDelay > MAX_UNSIGNED_INT32 ? MAX_UNSIGNED_INT32 : (UInt32)autoPackDelay;
+			else if (fileCfgSocket)
+				pCurrentServerConfig->autoPackDelay = fileCfg->autoPackDelay;
+
 			if (flags & ConnPingTimeoutFlagEnum)
 				pCurrentServerConfig->connectionPingTimeout = connectionPingTimeout > MAX_UNSIGNED_INT32 ? MAX_UNSIGNED_INT32 : (UInt32)connectionPingTimeout;
 			else if (fileCfgSocket)
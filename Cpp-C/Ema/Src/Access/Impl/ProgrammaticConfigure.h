@@ -77,6 +77,8 @@ public:
 		LibCurlNameEnum =				0x100000,
 		MaxFragmentSizeFlagEnum =		0x200000,
 		ServerSharedSocketEnum =		0x400000,
+		AutoPackSizeFlagEnum =			0x800000,
+		AutoPackDelayFlagEnum =			0x1000000,
 
 	};
 
@@ -170,6 +170,38 @@ RsslReactorCallbackRet ServerChannelHandler::channelEventCallback(RsslReactor* p
 				}
 			}
 
+			if ( ommServerBase->getActiveConfig().pServerConfig->autoPackSize )
+			{
+				ServerConfig* pServerConfig = ommServerBase->getActiveConfig().pServerConfig;
+
+				if (rsslReactorChannelIoctl(pRsslReactorChannel, RSSL_AUTO_PACK_DELAY, &pServerConfig->autoPackDelay, &rsslErrorInfo) != RSSL_RET_SUCCESS ||
+					rsslReactorChannelIoctl(pRsslReactorChannel, RSSL_AUTO_PACK_SIZE, &pServerConfig->autoPackSize, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+				{
+					if (OmmLoggerClient::ErrorEnum >= ommServerBase->getActiveConfig().loggerConfig.minLoggerSeverity)
+					{
+						EmaString temp("Failed to set auto-packing on client handle ");
+						temp.append(clientSession->getClientHandle()).append(CR)
+							.append("Instance Name ").append(ommServerBase->getInstanceName()).append(CR)
+							.append("RsslReactor ").append(ptrToStringAsHex(pRsslReactor)).append(CR)
+							.append("RsslChannel ").append(ptrToStringAsHex(rsslErrorInfo.rsslError.channel)).append(CR)
+							.append("Error Id ").append(rsslErrorInfo.rsslError.rsslErrorId).append(CR)
+							.append("Internal sysError ").append(rsslErrorInfo.rsslError.sysError).append(CR)
+							.append("Error Location ").append(rsslErrorInfo.errorLocation).append(CR)
+							.append("Error Text ").append(rsslErrorInfo.rsslError.text);
+						ommServerBase->getOmmLoggerClient().log(_clientName, OmmLoggerClient::ErrorEnum, temp.trimWhitespace());
+					}
+				}
+				else if (OmmLoggerClient::VerboseEnum >= ommServerBase->getActiveConfig().loggerConfig.minLoggerSeverity)
+				{
+					EmaString temp("auto-packing set on client handle ");
+					temp.append(clientSession->getClientHandle()).append(CR)
+						.append("Instance Name ").append(ommServerBase->getInstanceName()).append(CR)
+						.append("AutoPackSize ").append(pServerConfig->autoPackSize).append(CR)
+						.append("AutoPackDelay ").append(pServerConfig->autoPackDelay);
+					ommServerBase->getOmmLoggerClient().log(_clientName, OmmLoggerClient::VerboseEnum, temp);
+				}
+			}
+
 			ActiveServerConfig& activeConfig = ommServerBase->getActiveConfig();
 			if (activeConfig.xmlTraceToFile || activeConfig.xmlTraceToStdout)
 			{
@@ -71,6 +71,8 @@ public:
 								client-only, read-only transport. This transport is supported on
 								Linux only. */
 	WebSocketEnum = 7,        /*!< (7) Channel is a WebSocket connection based tunneling type */
+	Bidir_ShmemEnum = 8,      /*!< (8) Channel is a two-way shared memory connection between processes
+								on the same host. This transport is supported on Linux only. */
   };
 
   /** @enum ProtocolType
@@ -512,6 +512,7 @@ static void readFromChannel(RsslChannel* chnl)
 	}
 	if(chnl->socketId != -1 && chnl->state == RSSL_CH_STATE_ACTIVE)
 	{
+		rsslClearReadInArgs(&readInArgs);
 		readret = 1;
 		while (readret > 0) /* read until no more to read */
 		{
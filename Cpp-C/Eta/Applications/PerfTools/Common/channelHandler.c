@@ -113,6 +113,15 @@ ChannelInfo *channelHandlerAddChannel(ChannelHandler *pHandler, RsslChannel *pCh
 	rsslQueueAddLinkToBack(&pHandler->initializingChannelList, &pChannelInfo->queueLink);
 	channelHandlerRequestFlush(pHandler, pChannelInfo);
 
+	if (pHandler->pIoUring && pChannel->state != RSSL_CH_STATE_ACTIVE
+			&& (pChannel->connectionType == RSSL_CONN_TYPE_SOCKET || pChannel->connectionType == RSSL_CONN_TYPE_WEBSOCKET))
+	{
+		RsslError error;
+
+		if (rsslIoctl(pChannel, RSSL_IO_URING, &pHandler->pIoUring, &error) != RSSL_RET_SUCCESS)
+			printf("rsslIoctl(RSSL_IO_URING) failed: %s\n", error.text);
+	}
+
 	if (pChannel->state == RSSL_CH_STATE_ACTIVE)
 	{
 		/* Channel is already active */
@@ -147,6 +156,8 @@ RsslRet channelHandlerReadChannel(ChannelHandler *pHandler, ChannelInfo *pChanne
 	RsslBool channelClosed = RSSL_FALSE;
 	RsslReadInArgs readInArgs;
 
+	rsslClearReadInArgs(&readInArgs);
+
 	/* Read until rsslRead() indicates that no more bytes are available in the queue. */
 	do
 	{
@@ -275,7 +286,8 @@ void channelHandlerReadChannels(ChannelHandler *pHandler, RsslTimeValue stopTime
 	/* Loop on select(), looking for channels with available data, until stopTimeNsec is reached. */
 	do
 	{
-
+		/* Send everything written since the last pass before waiting. */
+		channelHandlerSubmit(pHandler);
 
 #ifdef WIN32
 		/* Windows does not allow select() to be called with empty file descriptor sets. */
@@ -458,6 +470,14 @@ void channelHandlerCheckPings(ChannelHandler *pHandler)
 	}
 }
 
+void channelHandlerSubmit(ChannelHandler *pHandler)
+{
+	RsslError error;
+
+	if (pHandler->pIoUring && rsslIoUringSubmit(pHandler->pIoUring, &error) < 0)
+		printf("rsslIoUringSubmit() failed: %s\n", error.text);
+}
+
 void channelHandlerCleanup(ChannelHandler *pHandler)
 {
 	RsslQueueLink *pLink;
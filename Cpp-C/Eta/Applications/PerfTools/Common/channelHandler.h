@@ -71,6 +71,8 @@ struct _ChannelHandler {
 	ChannelActiveCallback	*channelActiveCallback;		/* Function to be called when a channel finishes initializing and becomes active. */
 	ChannelInactiveCallback	*channelInactiveCallback;	/* Function to be called when a channel is closed. */
 	MsgConverterCallback	*convCallback;				/* Function to be called when a channel needs to call Json protocol converter. */
+	RsslIoUring				*pIoUring;					/* If set, socket channels added before they are active share this io_uring, 
+														 * which is submitted once per pass of channelHandlerReadChannels(). */
 };
 
 /* Requests that the ChannelHandler begin calling rsslFlush() for a channel.  Used when a call to rsslWrite()
@@ -95,6 +97,7 @@ RTR_C_INLINE void initChannelHandler(ChannelHandler *pHandler,
 	pHandler->msgCallback = msgCallback;
 	pHandler->convCallback = convCallback;
 	pHandler->pUserSpec = pUserSpec;
+	pHandler->pIoUring = NULL;
 }
 
 /* Cleans up a ChannelHandler. */
@@ -123,6 +126,9 @@ RsslRet channelHandlerReadChannel(ChannelHandler *pHandler, ChannelInfo *pChanne
 /* Write a buffer to a channel. */
 RsslRet channelHandlerWriteChannel(ChannelHandler *pHandler, ChannelInfo *pChannelInfo, RsslBuffer *pBuffer, RsslUInt8 writeFlags);
 
+/* Sends what was written to channels on the ChannelHandler's io_uring, if it has one. */
+void channelHandlerSubmit(ChannelHandler *pHandler);
+
 /* Performs ping timeout checks for channels in the given ChannelHandler. */
 void channelHandlerCheckPings(ChannelHandler *pHandler);
 
@@ -127,6 +127,137 @@ RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpM
 	return RSSL_RET_SUCCESS;
 }
 
+/* Int, UInt and Real fields can be encoded at a fixed width and patched in a template. */
+RTR_C_INLINE RsslBool isTemplateSlotField(MarketField *pField)
+{
+	if (pField->isBlank)
+		return RSSL_FALSE;
+
+	switch(pField->fieldEntry.dataType)
+	{
+		case RSSL_DT_INT:
+		case RSSL_DT_UINT:
+		case RSSL_DT_REAL:
+			return RSSL_TRUE;
+		default:
+			return RSSL_FALSE;
+	}
+}
+
+RsslRet createMarketPriceUpdateTemplate(RsslChannel *chnl, MarketPriceMsg *mpMsg, MarketPriceUpdateTemplate *pTemplate)
+{
+	RsslUpdateMsg updateMsg;
+	RsslEncodeIterator encodeIter;
+	RsslFieldList fList;
+	RsslBuffer encMsg;
+	RsslUInt32 slotCount = 0;
+	RsslInt32 i;
+	RsslRet ret;
+
+	for(i = 0; i < mpMsg->fieldEntriesCount; ++i)
+		if (isTemplateSlotField(&mpMsg->fieldEntries[i]))
+			++slotCount;
+
+	/* Slots may be wider than the field's usual encoding: up to eight bytes for the value and one for the length. */
+	encMsg.length = 128 + mpMsg->estimatedContentLength + 9 * slotCount;
+	encMsg.data = (char*)malloc(encMsg.length); assert(encMsg.data);
+	pTemplate->msgTemplate.slots = (RsslMsgTemplateSlot*)malloc((slotCount + 1) * sizeof(RsslMsgTemplateSlot)); assert(pTemplate->msgTemplate.slots);
+	pTemplate->slotFields = (RsslInt32*)malloc((slotCount + 1) * sizeof(RsslInt32)); assert(pTemplate->slotFields);
+	pTemplate->msgTemplate.encMsg = encMsg;
+	pTemplate->msgTemplate.slotCount = 0;
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+
+	rsslClearEncodeIterator(&encodeIter);
+	rsslSetEncodeIteratorRWFVersion(&encodeIter, chnl->majorVersion, chnl->minorVersion);
+	if ((ret = rsslSetEncodeIteratorBuffer(&encodeIter, &encMsg)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslEncodeMsgInit(&encodeIter, (RsslMsg*)&updateMsg, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	rsslClearFieldList(&fList);
+	fList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if ((ret = rsslEncodeFieldListInit(&encodeIter, &fList, 0, 0)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	for(i = 0; i < mpMsg->fieldEntriesCount; ++i)
+	{
+		MarketField *pField = &mpMsg->fieldEntries[i];
+
+		if (isTemplateSlotField(pField))
+		{
+			RsslMsgTemplateSlot *pSlot = &pTemplate->msgTemplate.slots[pTemplate->msgTemplate.slotCount];
+
+			pSlot->fieldId = pField->fieldEntry.fieldId;
+			pSlot->dataType = pField->fieldEntry.dataType;
+			pTemplate->slotFields[pTemplate->msgTemplate.slotCount++] = i;
+			ret = rsslEncodeFieldEntrySlot(&encodeIter, &pField->fieldEntry, &pField->primitive);
+		}
+		else
+			ret = rsslEncodeFieldEntry(&encodeIter, &pField->fieldEntry, (!pField->isBlank) ? &pField->primitive : NULL);
+
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rsslEncodeFieldListComplete(&encodeIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslEncodeMsgComplete(&encodeIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	encMsg.length = rsslGetEncodedBufferLength(&encodeIter);
+
+	return rsslInitMsgTemplate(&pTemplate->msgTemplate, &encMsg, chnl->majorVersion, chnl->minorVersion, NULL);
+}
+
+RsslRet patchMarketPriceUpdateTemplate(MarketPriceUpdateTemplate *pTemplate, MarketPriceMsg *mpMsg,
+		RsslBuffer *pMsgBuf, RsslInt32 streamId)
+{
+	RsslMsgTemplate *pMsgTemplate = &pTemplate->msgTemplate;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	if ((ret = rsslMsgTemplateCopy(pMsgTemplate, pMsgBuf)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	rsslMsgTemplateSetStreamId(pMsgTemplate, pMsgBuf, streamId);
+
+	for(i = 0; i < pMsgTemplate->slotCount; ++i)
+	{
+		RsslPrimitive *pValue = &mpMsg->fieldEntries[pTemplate->slotFields[i]].primitive;
+
+		switch(pMsgTemplate->slots[i].dataType)
+		{
+			case RSSL_DT_INT:
+				ret = rsslMsgTemplateSetInt(pMsgTemplate, pMsgBuf, i, pValue->intType);
+				break;
+			case RSSL_DT_UINT:
+				ret = rsslMsgTemplateSetUInt(pMsgTemplate, pMsgBuf, i, pValue->uintType);
+				break;
+			case RSSL_DT_REAL:
+				ret = rsslMsgTemplateSetReal(pMsgTemplate, pMsgBuf, i, &pValue->realType);
+				break;
+		}
+
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+void freeMarketPriceUpdateTemplate(MarketPriceUpdateTemplate *pTemplate)
+{
+	free(pTemplate->msgTemplate.encMsg.data);
+	free(pTemplate->msgTemplate.slots);
+	free(pTemplate->slotFields);
+	clearMarketPriceUpdateTemplate(pTemplate);
+}
+
 MarketPriceItem *createMarketPriceItem()
 {
 	MarketPriceItem* pMpItem = (MarketPriceItem*)malloc(sizeof(MarketPriceItem));
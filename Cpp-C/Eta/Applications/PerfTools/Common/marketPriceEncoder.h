@@ -30,6 +30,13 @@ typedef struct {
 RsslRet encodeMarketPriceDataBody(RsslEncodeIterator *pIter, MarketPriceMsg *mpMsg,
 		RsslMsgClasses msgClass, RsslUInt encodeStartTime);
 
+/* A message template for one of the MarketPrice update payloads.  Each Int, UInt and Real
+ * field of the payload is a slot, patched with the field's value when sending. */
+typedef struct {
+	RsslMsgTemplate	msgTemplate;
+	RsslInt32		*slotFields;	/* Index in MarketPriceMsg::fieldEntries of each slot's field */
+} MarketPriceUpdateTemplate;
+
 /* Clears a MarketPriceItem. */
 RTR_C_INLINE void clearMarketPriceItem(MarketPriceItem* itemInfo)
 {
@@ -52,6 +59,23 @@ MarketPriceMsg *getNextMarketPriceUpdate(MarketPriceItem *mpItem);
 /* Get the total number of sample update payloads available from the message file. */
 RsslInt32 getMarketPriceUpdateMsgCount();
 
+/* Clears a MarketPriceUpdateTemplate. */
+RTR_C_INLINE void clearMarketPriceUpdateTemplate(MarketPriceUpdateTemplate *pTemplate)
+{
+	rsslClearMsgTemplate(&pTemplate->msgTemplate);
+	pTemplate->slotFields = 0;
+}
+
+/* Encodes a MarketPrice update into a cleared message template. */
+RsslRet createMarketPriceUpdateTemplate(RsslChannel *chnl, MarketPriceMsg *mpMsg, MarketPriceUpdateTemplate *pTemplate);
+
+/* Copies a MarketPrice update template into a buffer, setting its stream ID and field values. */
+RsslRet patchMarketPriceUpdateTemplate(MarketPriceUpdateTemplate *pTemplate, MarketPriceMsg *mpMsg,
+		RsslBuffer *pMsgBuf, RsslInt32 streamId);
+
+/* Cleans up a MarketPriceUpdateTemplate. */
+void freeMarketPriceUpdateTemplate(MarketPriceUpdateTemplate *pTemplate);
+
 /* Estimate the size of the next MarketPrice post payload. */
 RsslUInt32 getNextMarketPricePostEstimatedContentLength(MarketPriceItem *mpItem);
 
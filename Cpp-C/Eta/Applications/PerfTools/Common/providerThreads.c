@@ -43,6 +43,7 @@ void clearProviderThreadConfig()
 	providerThreadConfig.latencyUpdatesPerSec = 10;
 	providerThreadConfig.latencyGenMsgsPerSec = 0;
 	providerThreadConfig.writeFlags = 0;
+	providerThreadConfig.writeBatchSize = 0;
 	snprintf(providerThreadConfig.itemFilename, sizeof(providerThreadConfig.itemFilename), "350k.xml");
 	snprintf(providerThreadConfig.msgFilename, sizeof(providerThreadConfig.msgFilename), "MsgData.xml");
 	providerThreadConfig.threadBindList = defaultThreadBindList;
@@ -52,6 +53,7 @@ void clearProviderThreadConfig()
 	providerThreadConfig.logLatencyToFile = RSSL_FALSE;
 
 	providerThreadConfig.preEncItems = RSSL_FALSE;
+	providerThreadConfig.msgTemplates = RSSL_FALSE;
 	providerThreadConfig.takeMCastStats = RSSL_FALSE;
 	providerThreadConfig.nanoTime = RSSL_FALSE;
 	providerThreadConfig.measureEncode = RSSL_FALSE;
@@ -90,6 +92,19 @@ void providerThreadConfigInit()
 		printf("Config Error: -preEnc has no effect when always sending latency update, since it must be encoded.\n\n");
 		exit(-1);
 		}
+	if (providerThreadConfig.preEncItems == RSSL_TRUE && providerThreadConfig.msgTemplates == RSSL_TRUE)
+	{
+		printf("Config Error: -preEnc and -msgTemplate cannot both be used.\n\n");
+		exit(-1);
+	}
+
+	if (providerThreadConfig.latencyUpdatesPerSec == ALWAYS_SEND_LATENCY_UPDATE
+		&& providerThreadConfig.msgTemplates == RSSL_TRUE)
+	{
+		printf("Config Error: -msgTemplate has no effect when always sending latency update, since it must be encoded.\n\n");
+		exit(-1);
+	}
+
 	if (providerThreadConfig.latencyUpdatesPerSec == 0 && providerThreadConfig.measureEncode)
 	{
 		printf("Config Error: Measuring message encoding time when latency update rate is zero. Message encoding time is only recorded for latency updates.\n\n");
@@ -235,6 +250,7 @@ void providerThreadInit(ProviderThread *pProvThread,
 	if (providerThreadConfig.measureEncode)
 		timeRecordQueueInit(&pProvThread->messageEncodeTimeRecords);
 	memset(&pProvThread->prevMCastStats, 0, sizeof(pProvThread->prevMCastStats));
+	memset(&pProvThread->prevTcpStats, 0, sizeof(pProvThread->prevTcpStats));
 
 	snprintf(tmpFilename, sizeof(tmpFilename), "%s%d.csv", 
 			providerThreadConfig.statsFilename, providerIndex + 1);
@@ -322,6 +338,7 @@ ProviderSession *providerSessionCreate(ProviderThread *pProvThread, RsslChannel
 
 	pSession->preEncMarketPriceMsgs = 0;
 	pSession->preEncMarketByOrderMsgs = 0;
+	pSession->marketPriceTemplates = 0;
 
 	pSession->openItemsCount = 0;
 	pSession->pWritingBuffer = 0;
@@ -329,6 +346,8 @@ ProviderSession *providerSessionCreate(ProviderThread *pProvThread, RsslChannel
 	pSession->timeActivated = 0;
 	pSession->lastWriteRet = 0;
 	pSession->remaingPackedBufferLength = 0;
+	pSession->pBatchBuffers = 0;
+	pSession->batchBufferCount = 0;
 
 
 	hashTableInit(&pSession->itemAttributesTable, 
@@ -404,6 +423,39 @@ ProviderSession *providerSessionCreate(ProviderThread *pProvThread, RsslChannel
 		assert(mboItem.iMsg == 0); /* encode function increments iMsg. If we've done everything right this should be 0 */
 	}
 
+	if (providerThreadConfig.msgTemplates)
+	{
+		RsslInt32 i;
+		RsslInt32 updateCount = getMarketPriceUpdateMsgCount();
+		RsslRet ret;
+
+		/* Encode each update into a template once.  Updates will copy the template and patch
+		 * the StreamID and field values into it. */
+		pSession->marketPriceTemplates = (MarketPriceUpdateTemplate*)malloc(updateCount * sizeof(MarketPriceUpdateTemplate)); assert(pSession->marketPriceTemplates);
+
+		for(i = 0; i < updateCount; ++i)
+			clearMarketPriceUpdateTemplate(&pSession->marketPriceTemplates[i]);
+
+		for(i = 0; i < updateCount; ++i)
+		{
+			if ((ret = createMarketPriceUpdateTemplate(pChannel, &xmlMarketPriceMsgs.updateMsgs[i], &pSession->marketPriceTemplates[i])) < RSSL_RET_SUCCESS)
+			{
+				printf("Encoding message template: createMarketPriceUpdateTemplate() failed: %d\n", ret);
+				for(i = 0; i < updateCount; ++i)
+					freeMarketPriceUpdateTemplate(&pSession->marketPriceTemplates[i]);
+				free(pSession->marketPriceTemplates);
+				free(pSession);
+				return NULL;
+			}
+		}
+	}
+
+	if (providerThreadConfig.writeBatchSize > 1)
+	{
+		pSession->pBatchBuffers = (RsslBuffer**)malloc(providerThreadConfig.writeBatchSize * sizeof(RsslBuffer*));
+		assert(pSession->pBatchBuffers);
+	}
+
 	if (niProvPerfConfig.useReactor == RSSL_FALSE && provPerfConfig.useReactor == RSSL_FALSE) // use UPA Channel
 	{
 		pSession->pChannelInfo = channelHandlerAddChannel(&pProvThread->channelHandler, pChannel, 
@@ -604,6 +656,15 @@ void providerSessionDestroy(ProviderThread *pProvThread, ProviderSession *pSessi
 		pSession->preEncMarketByOrderMsgs = 0;
 	}
 
+	if (pSession->marketPriceTemplates)
+	{
+		int i;
+		for (i = 0; i < getMarketPriceUpdateMsgCount(); ++i)
+			freeMarketPriceUpdateTemplate(&pSession->marketPriceTemplates[i]);
+		free(pSession->marketPriceTemplates);
+		pSession->marketPriceTemplates = 0;
+	}
+
 	/* Free any items in the watchlist. */
 	while(pLink = rotatingQueuePeekFrontAsList(&pSession->refreshItemList))
 		freeItemInfo(pProvThread, pSession, RSSL_QUEUE_LINK_TO_OBJECT(ItemInfo, watchlistLink, pLink));
@@ -614,6 +675,9 @@ void providerSessionDestroy(ProviderThread *pProvThread, ProviderSession *pSessi
 	if (niProvPerfConfig.useReactor || provPerfConfig.useReactor) // Reactor used
 		free(pSession->pChannelInfo);
 
+	if (pSession->pBatchBuffers)
+		free(pSession->pBatchBuffers);
+
 	hashTableCleanup(&pSession->itemAttributesTable);
 	hashTableCleanup(&pSession->itemStreamIdTable);
 	free(pSession);
@@ -852,7 +916,21 @@ RsslRet sendUpdateBurst(ProviderThread *pProvThread, ProviderSession *pSession)
 		if (providerThreadConfig.measureEncode)
 			measureEncodeStartTime = rsslGetTimeNano();
 
-		if (!providerThreadConfig.preEncItems || latencyStartTime /* Latency item should always be fully encoded so we can send proper time information */)
+		if (providerThreadConfig.msgTemplates && !latencyStartTime && nextItem->attributes.domainType == RSSL_DMT_MARKET_PRICE)
+		{
+			/* Copy the template of the next update and patch the StreamID and values into it. */
+			MarketPriceItem *mpItem = (MarketPriceItem*)nextItem->itemData;
+			MarketPriceUpdateTemplate *pTemplate = &pSession->marketPriceTemplates[mpItem->iMsg];
+
+			ret = patchMarketPriceUpdateTemplate(pTemplate, getNextMarketPriceUpdate(mpItem), pSession->pWritingBuffer, nextItem->StreamId);
+
+			if (rtrUnlikely(ret < RSSL_RET_SUCCESS))
+			{
+				printf("patchMarketPriceUpdateTemplate failed: %d\n", ret);
+				return ret;
+			}
+		}
+		else if (!providerThreadConfig.preEncItems || latencyStartTime /* Latency item should always be fully encoded so we can send proper time information */)
 		{
 			if (pSession->pWritingBuffer && 
 				(ret = encodeItemUpdate(pSession->pChannelInfo->pChannel, nextItem, pSession->pWritingBuffer, NULL, latencyStartTime) < RSSL_RET_SUCCESS))
@@ -1041,6 +1119,87 @@ RsslRet sendGenMsgBurst(ProviderThread *pProvThread, ProviderSession *pSession)
 	return ret >= RSSL_RET_SUCCESS ? pSession->lastWriteRet : ret;
 }
 
+/* Writes the buffers queued in pBatchBuffers with a single rsslWriteBatch()/rsslReactorSubmitBatch() call. */
+static RsslRet writeBatchBuffers(ProviderThread *pProvThread, ProviderSession *pSession, RsslError *pError)
+{
+	RsslChannel *pChannel = pSession->pChannelInfo->pChannel;
+	RsslUInt32 buffersWritten;
+	RsslUInt32 batchOffset = 0;
+	RsslRet ret;
+
+	do
+	{
+		buffersWritten = 0;
+
+		if (niProvPerfConfig.useReactor == RSSL_FALSE && provPerfConfig.useReactor == RSSL_FALSE) // use UPA Channel
+		{
+			RsslWriteInArgs writeInArgs;
+			RsslWriteOutArgs writeOutArgs;
+			rsslClearWriteInArgs(&writeInArgs);
+			rsslClearWriteOutArgs(&writeOutArgs);
+			writeInArgs.rsslPriority = RSSL_HIGH_PRIORITY;
+			writeInArgs.writeInFlags = providerThreadConfig.writeFlags;
+
+			ret = rsslWriteBatch(pChannel, pSession->pBatchBuffers + batchOffset, pSession->batchBufferCount - batchOffset,
+					&writeInArgs, &writeOutArgs, &buffersWritten, pError);
+		}
+		else // use UPA VA Reactor
+		{
+			RsslErrorInfo errorInfo;
+			RsslReactorSubmitOptions submitOpts;
+			rsslClearReactorSubmitOptions(&submitOpts);
+			submitOpts.priority = RSSL_HIGH_PRIORITY;
+			submitOpts.writeFlags = providerThreadConfig.writeFlags;
+
+			ret = rsslReactorSubmitBatch(pProvThread->pReactor, pSession->pChannelInfo->pReactorChannel,
+					pSession->pBatchBuffers + batchOffset, pSession->batchBufferCount - batchOffset, &submitOpts, &buffersWritten, &errorInfo);
+			if (ret < RSSL_RET_SUCCESS)
+				*pError = errorInfo.rsslError;
+		}
+
+		batchOffset += buffersWritten;
+
+		/* call flush and write the rest again */
+		if (rtrUnlikely(ret == RSSL_RET_WRITE_CALL_AGAIN)
+				&& niProvPerfConfig.useReactor == RSSL_FALSE && provPerfConfig.useReactor == RSSL_FALSE)
+		{
+			if (rtrUnlikely((ret = rsslFlush(pChannel, pError)) < RSSL_RET_SUCCESS))
+			{
+				printf("rsslFlush() failed with return code %d - <%s>\n", ret, pError->text);
+				pSession->batchBufferCount = 0;
+				return ret;
+			}
+			ret = RSSL_RET_WRITE_CALL_AGAIN;
+		}
+	} while (rtrUnlikely(ret == RSSL_RET_WRITE_CALL_AGAIN));
+
+	pSession->batchBufferCount = 0;
+	pSession->lastWriteRet = ret;
+
+	if (ret >= RSSL_RET_SUCCESS)
+		return ret;
+
+	switch(ret)
+	{
+		case RSSL_RET_WRITE_FLUSH_FAILED:
+			/* If FLUSH_FAILED is received, check the channel state.
+			 * if it is still active, it's okay, just need to flush. */
+			if (pChannel->state == RSSL_CH_STATE_ACTIVE)
+			{
+				pSession->lastWriteRet = 1;
+				return 1;
+			}
+			/* Otherwise treat as error, fall through to default. */
+		default:
+			if (pChannel->state == RSSL_CH_STATE_ACTIVE)
+			{
+				printf("rsslWriteBatch() failed: %s(%s)\n", rsslRetCodeToString(pError->rsslErrorId), 
+						pError->text);
+			}
+			return ret;
+	}
+}
+
 static RsslRet writeCurrentBuffer(ProviderThread *pProvThread, ProviderSession *pSession, RsslError *pError)
 {
 	RsslChannel *pChannel = pSession->pChannelInfo->pChannel;
@@ -1054,6 +1213,19 @@ static RsslRet writeCurrentBuffer(ProviderThread *pProvThread, ProviderSession *
 
 	pSession->packedBufferCount = 0;
 
+	/* If batching writes, queue the buffer instead of writing it now (JSON buffers are converted and written individually). */
+	if (pSession->pBatchBuffers && pChannel->protocolType != RSSL_JSON_PROTOCOL_TYPE)
+	{
+		pSession->pBatchBuffers[pSession->batchBufferCount++] = pSession->pWritingBuffer;
+		pSession->pWritingBuffer = 0;
+		countStatIncr(&pProvThread->bufferSentCount);
+
+		if (pSession->batchBufferCount == (RsslUInt32)providerThreadConfig.writeBatchSize)
+			return writeBatchBuffers(pProvThread, pSession, pError);
+
+		return RSSL_RET_SUCCESS;
+	}
+
 	if (niProvPerfConfig.useReactor == RSSL_FALSE && provPerfConfig.useReactor == RSSL_FALSE) // use UPA Channel
 	{
 		pMsgBuffer = 0;
@@ -1206,6 +1378,15 @@ static RsslRet getNewBuffer(ProviderThread *pProvThread, ProviderSession *pSessi
 		pSession->pWritingBuffer = rsslGetBuffer(pSession->pChannelInfo->pChannel, length, packedBuffer, pError);
 		if (!pSession->pWritingBuffer)
 		{
+			/* Buffers queued for a batch write may be holding the channel's output buffers. */
+			if (pError->rsslErrorId == RSSL_RET_BUFFER_NO_BUFFERS && pSession->batchBufferCount > 0)
+			{
+				RsslRet ret;
+				if ((ret = writeBatchBuffers(pProvThread, pSession, pError)) < RSSL_RET_SUCCESS)
+					return ret;
+				return getNewBuffer(pProvThread, pSession, length, pError);
+			}
+
 			if (pError->rsslErrorId != RSSL_RET_BUFFER_NO_BUFFERS)
 				printf("rsslGetBuffer() failed: (%d) %s \n", pError->rsslErrorId, pError->text);
 			return pError->rsslErrorId;
@@ -1222,6 +1403,15 @@ static RsslRet getNewBuffer(ProviderThread *pProvThread, ProviderSession *pSessi
 		pSession->pWritingBuffer = rsslReactorGetBuffer(pSession->pChannelInfo->pReactorChannel, length, providerThreadConfig.totalBuffersPerPack > 1 ? RSSL_TRUE : RSSL_FALSE , &errorInfo);
 		if (!pSession->pWritingBuffer)
 		{
+			/* Buffers queued for a batch write may be holding the channel's output buffers. */
+			if (errorInfo.rsslError.rsslErrorId == RSSL_RET_BUFFER_NO_BUFFERS && pSession->batchBufferCount > 0)
+			{
+				RsslRet ret;
+				if ((ret = writeBatchBuffers(pProvThread, pSession, pError)) < RSSL_RET_SUCCESS)
+					return ret;
+				return getNewBuffer(pProvThread, pSession, length, pError);
+			}
+
 			if (errorInfo.rsslError.rsslErrorId != RSSL_RET_BUFFER_NO_BUFFERS)
 				printf("rsslReactorGetBuffer() failed: (%d) %s \n", errorInfo.rsslError.rsslErrorId, errorInfo.rsslError.text);
 			return errorInfo.rsslError.rsslErrorId;
@@ -1307,6 +1497,10 @@ RsslRet sendItemMsgBuffer(ProviderThread *pProvThread, ProviderSession *pSession
 	if (pSession->packedBufferCount == (providerThreadConfig.totalBuffersPerPack - 1) || !allowPack)
 	{
 		ret = writeCurrentBuffer(pProvThread, pSession, &error);
+
+		/* Write any batched buffers at the end of the burst. */
+		if (ret >= RSSL_RET_SUCCESS && !allowPack && pSession->batchBufferCount > 0)
+			ret = writeBatchBuffers(pProvThread, pSession, &error);
 		return ret;
 	}
 	else
@@ -1832,6 +2026,51 @@ void providerCollectStats(Provider *pProvider, RsslBool writeStats, RsslBool dis
 			}
 		}
 
+		if (displayStats)
+		{
+			/* Print auto-packing stats, if any of this thread's channels auto-pack. */
+			RsslTCPStats tcpTotals;
+			RsslQueueLink *pLink;
+
+			memset(&tcpTotals, 0, sizeof(tcpTotals));
+
+			RSSL_QUEUE_FOR_EACH_LINK(&pProviderThread->channelHandler.activeChannelList, pLink)
+			{
+				RsslError error;
+				RsslChannelStats chnlStats;
+				ChannelInfo *pChannelInfo = RSSL_QUEUE_LINK_TO_OBJECT(ChannelInfo, queueLink, pLink);
+
+				if (pChannelInfo->pChannel == NULL || pChannelInfo->pChannel->state != RSSL_CH_STATE_ACTIVE)
+					continue;
+
+				if (rsslGetChannelStats(pChannelInfo->pChannel, &chnlStats, &error) != RSSL_RET_SUCCESS
+						|| !(chnlStats.tcpStats.flags & RSSL_TCP_STATS_WRITE))
+					continue;
+
+				tcpTotals.writeCallCount += chnlStats.tcpStats.writeCallCount;
+				tcpTotals.autoPackedMsgCount += chnlStats.tcpStats.autoPackedMsgCount;
+				tcpTotals.autoPackedBufferCount += chnlStats.tcpStats.autoPackedBufferCount;
+				tcpTotals.autoPackDelayUsec += chnlStats.tcpStats.autoPackDelayUsec;
+			}
+
+			/* Counters restart when channels come and go, so skip intervals where they went backwards. */
+			if (tcpTotals.autoPackedBufferCount > pProviderThread->prevTcpStats.autoPackedBufferCount
+					&& tcpTotals.autoPackedMsgCount > pProviderThread->prevTcpStats.autoPackedMsgCount
+					&& tcpTotals.writeCallCount > pProviderThread->prevTcpStats.writeCallCount
+					&& tcpTotals.autoPackDelayUsec >= pProviderThread->prevTcpStats.autoPackDelayUsec)
+			{
+				RsslUInt64 packedMsgs = tcpTotals.autoPackedMsgCount - pProviderThread->prevTcpStats.autoPackedMsgCount;
+
+				printf("  - Auto-pack: %.1f msgs per write call, %.1f msgs per buffer, avg added latency %.1f usec\n",
+						(double)(refreshCount + updateCount + genMsgSentCount)
+							/ (double)(tcpTotals.writeCallCount - pProviderThread->prevTcpStats.writeCallCount),
+						(double)packedMsgs / (double)(tcpTotals.autoPackedBufferCount - pProviderThread->prevTcpStats.autoPackedBufferCount),
+						(double)(tcpTotals.autoPackDelayUsec - pProviderThread->prevTcpStats.autoPackDelayUsec) / (double)packedMsgs);
+			}
+
+			pProviderThread->prevTcpStats = tcpTotals;
+		}
+
 		if (providerThreadConfig.measureEncode)
 		{
 			RsslQueueLink *pLink;
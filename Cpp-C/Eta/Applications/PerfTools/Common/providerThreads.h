@@ -67,6 +67,7 @@ typedef struct
 		_latencyGenMsgRandomArray;				/* Determines when to send latency gen msgs. */
 
 	RsslBool	preEncItems;				/* Whether to use pre-encoded data rather than fully encoding. */
+	RsslBool	msgTemplates;				/* Whether to patch MarketPrice updates into message templates rather than fully encoding(-msgTemplate). */
 	RsslBool	takeMCastStats;				/* Running a multicast connection and we want stats. */
 	RsslBool	nanoTime;   				/* Configures timestamp format. */
 	RsslBool	measureEncode;				/* Measure time to encode messages(-measureEncode) */
@@ -76,6 +77,7 @@ typedef struct
 	RsslInt32	threadCount;				/* Number of provider threads to create. */
 	char		statsFilename[128];			/* Name of the statistics log file*/
 	RsslUInt8	writeFlags;
+	RsslInt32	writeBatchSize;				/* How many buffers are queued before writing them with rsslWriteBatch()(-writeBatch). */
 } ProviderThreadConfig;
 
 /* Contains the global ProviderThread configuration. */
@@ -158,6 +160,7 @@ typedef struct
 	fd_set					wrtfds;					/* Write file descriptor set. Used for when application uses VA Reactor instead of UPA Channel. */
 
 	RsslMCastStats prevMCastStats;
+	RsslTCPStats prevTcpStats;					/* Write/auto-pack counters from the previous stats interval. */
 	TimeRecordQueue messageEncodeTimeRecords;	/* Measurement of encoding time */
 	TimeRecordQueue	updateDecodeTimeRecords;	/* Time spent decoding msgs. */
 
@@ -181,8 +184,12 @@ typedef struct {
 
 	RsslBuffer		*preEncMarketPriceMsgs;		/* Buffer of a pre-encoded market price message, if sending pre-encoded items;  This is allocated per-channel in case the versions are different */
 	RsslBuffer		*preEncMarketByOrderMsgs;	/* Buffer of a pre-encoded market by order message, if sending pre-encoded items;  This is allocated per-channel in case the versions are different */
+	MarketPriceUpdateTemplate	*marketPriceTemplates;	/* Message templates of the market price updates, if sending with templates;  This is allocated per-channel in case the versions are different */
 
 	RsslUInt32		remaingPackedBufferLength; /* Keep track of the remaining packed buffer for handling JSON protocol */
+
+	RsslBuffer		**pBatchBuffers;		/* Buffers waiting to be written by rsslWriteBatch(), if batching writes. */
+	RsslUInt32		batchBufferCount;		/* Total number of buffers currently in pBatchBuffers. */
 } ProviderSession;
 
 /* Clears providerThreadConfig to defaults. */
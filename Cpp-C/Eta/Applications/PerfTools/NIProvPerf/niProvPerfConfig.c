@@ -308,6 +308,10 @@ void initNIProvPerfConfig(int argc, char **argv)
 		{
 			providerThreadConfig.preEncItems = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-msgTemplate", argv[iargs]))
+		{
+			providerThreadConfig.msgTemplates = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-mcastStats", argv[iargs]))
 		{
 			providerThreadConfig.takeMCastStats = RSSL_TRUE;
@@ -496,10 +500,12 @@ void printNIProvPerfConfig(FILE *file)
 
 	fprintf(file,
 			"  Pre-Encoded Updates: %s\n" 
+			"    Message Templates: %s\n" 
 			"      Nanosecond Time: %s\n" 
 			"       Measure Encode: %s\n"
             "      Multicast Stats: %s\n\n",
 			providerThreadConfig.preEncItems ? "Yes" : "No",
+			providerThreadConfig.msgTemplates ? "Yes" : "No",
 			providerThreadConfig.nanoTime ? "Yes" : "No",
 			providerThreadConfig.measureEncode ? "Yes" : "No",
             providerThreadConfig.takeMCastStats ? "Yes" : "No");
@@ -558,6 +564,7 @@ void exitWithUsage()
 			" \n"
 			"  -nanoTime                        Use nanosecond precision for latency information instead of microsecond.\n"
 			"  -preEnc                          Use Pre-Encoded updates\n"
+			"  -msgTemplate                     Send MarketPrice updates by patching values into message templates, encoded once at startup.\n"
 			"  -takeMCastStats                  Take Multicast Statistics(Warning: This enables the per-channel lock).\n"
 			"  -measureEncode                   Measure encoding time of messages.\n"
 			"\n"
@@ -34,6 +34,8 @@ static void clearProvPerfConfig()
 	provPerfConfig.recvBufSize = 0;
 	provPerfConfig.tcpNoDelay = RSSL_TRUE;
 	provPerfConfig.highWaterMark = 0;
+	provPerfConfig.autoPackSize = 0;
+	provPerfConfig.autoPackDelay = 0;
 	snprintf(provPerfConfig.interfaceName, sizeof(provPerfConfig.interfaceName), "");
 	snprintf(provPerfConfig.portNo, sizeof(provPerfConfig.portNo), "%s", "14002");
 	snprintf(provPerfConfig.summaryFilename, sizeof(provPerfConfig.summaryFilename), "ProvSummary.out");
@@ -235,6 +237,16 @@ void initProvPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			sscanf(argv[iargs], "%d", &provPerfConfig.highWaterMark);
 		}
+		else if (0 == strcmp("-autoPackSize", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &provPerfConfig.autoPackSize);
+		}
+		else if (0 == strcmp("-autoPackDelay", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%u", &provPerfConfig.autoPackDelay);
+		}
 		else if (0 == strcmp("-sendBufSize", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -261,10 +273,19 @@ void initProvPerfConfig(int argc, char **argv)
 		{
 			providerThreadConfig.writeFlags |= RSSL_WRITE_DIRECT_SOCKET_WRITE;
 		}
+		else if (0 == strcmp("-writeBatch", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			sscanf(argv[iargs], "%d", &providerThreadConfig.writeBatchSize);
+		}
 		else if (0 == strcmp("-reactor", argv[iargs]))
 		{
 			provPerfConfig.useReactor = RSSL_TRUE;
 		}
+		else if (0 == strcmp("-epoll", argv[iargs]))
+		{
+			provPerfConfig.useEpollNotifier = RSSL_TRUE;
+		}
 		else if (strcmp("-connType", argv[iargs]) == 0)
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -359,6 +380,8 @@ void printProvPerfConfig(FILE *file)
 			"               Tick Rate: %u\n"
 			"       Use Direct Writes: %s\n"
 			"         High Water Mark: %d%s\n"
+			"          Auto-Pack Size: %u%s\n"
+			"         Auto-Pack Delay: %u%s\n"
 			"            Summary File: %s\n"
 			"              Stats File: %s\n"
 			"            Latency File: %s\n"
@@ -382,6 +405,8 @@ void printProvPerfConfig(FILE *file)
 			providerThreadConfig.ticksPerSec,
 			(providerThreadConfig.writeFlags & RSSL_WRITE_DIRECT_SOCKET_WRITE) ? "Yes" : "No",
 			provPerfConfig.highWaterMark, (provPerfConfig.highWaterMark > 0 ?  " bytes" : "(use default)"),
+			provPerfConfig.autoPackSize, (provPerfConfig.autoPackSize > 0 ?  " bytes" : "(disabled)"),
+			provPerfConfig.autoPackDelay, (provPerfConfig.autoPackDelay > 0 ?  " usec" : "(until full or flushed)"),
 			provPerfConfig.summaryFilename,
 			providerThreadConfig.statsFilename,
 			providerThreadConfig.latencyLogFilename,
@@ -417,6 +442,14 @@ void printProvPerfConfig(FILE *file)
 		fprintf(file,
 			"                 Packing: No\n");
 
+	if (providerThreadConfig.writeBatchSize > 1)
+		fprintf(file,
+			"          Batched Writes: Yes(max %d per batch)\n",
+			providerThreadConfig.writeBatchSize);
+	else
+		fprintf(file,
+			"          Batched Writes: No\n");
+
 
 
 	fprintf(file, 
@@ -437,8 +470,10 @@ void printProvPerfConfig(FILE *file)
 			providerThreadConfig.measureEncode ? "Yes" : "No");
 
 	fprintf(file,
-			"             Use Reactor: %s\n\n",
-			(provPerfConfig.useReactor ? "Yes" : "No")
+			"             Use Reactor: %s\n"
+			"      Use epoll Notifier: %s\n\n",
+			(provPerfConfig.useReactor ? "Yes" : "No"),
+			(provPerfConfig.useEpollNotifier ? "Yes" : "No")
 		  );
 }
 
@@ -457,6 +492,8 @@ void exitWithUsage()
 			"  -recvBufSize <size>                  System Receive Buffer Size(configures sysRecvBufSize in RsslBindOptions)\n"
 			"  -tcpDelay                            Turns off tcp_nodelay in RsslBindOptions, enabling Nagle's\n"
 			"  -highWaterMark                       Sets the number of buffered bytes that will cause UPA to automatically flush\n"
+			"  -autoPackSize <bytes>                Packs small messages written by the provider into buffers of this size\n"
+			"  -autoPackDelay <usec>                Longest time a message waits in a packed buffer before it is sent\n"
 			"  -if <interface name>                 Name of network interface to use\n"
 			"\n"
 			"  -tickRate <ticks per second>         Ticks per second\n"
@@ -468,6 +505,7 @@ void exitWithUsage()
 			"  -packBufSize <length>                If packing, sets size of buffer to use\n"
 			"  -refreshBurstSize <count>            Number of refreshes to send in a burst(controls granularity of time-checking)\n"
 			"  -directWrite                         Sets direct socket write flag when using rsslWrite()\n"
+			"  -writeBatch <count>                  Maximum number of buffers written together(when count > 1, rsslWriteBatch() is used)\n"
 			"\n"
 			"  -serviceName <name>                  Service Name\n"
 			"  -serviceId <num>                     Service ID\n"
@@ -489,6 +527,7 @@ void exitWithUsage()
 			"  -measureEncode                       Measure encoding time of messages.\n"
 			"\n"
 			"  -reactor                             Use the VA Reactor instead of the UPA Channel for sending and receiving.\n"
+			"  -epoll                               Use epoll for the VA Reactor's channel notification(Linux only; requires -reactor).\n"
 			"\n"
 			"  -pl \"<list>\"                         List of supported WS sub-protocols in order of preference(',' | white space delineated)\n"
 			"\n"
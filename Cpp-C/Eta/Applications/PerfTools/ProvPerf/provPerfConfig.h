@@ -28,12 +28,15 @@ typedef struct
 	RsslUInt32			maxOutputBuffers;		/* Max Output Buffers. See -maxOutputBufs */
 	RsslUInt32			maxFragmentSize;			/* Maximum Fragment Size. See -maxFragmentSize */
 	RsslUInt32			highWaterMark;				/* sets the point which will cause UPA to automatically flush */
+	RsslUInt32			autoPackSize;				/* Size of the buffers small writes are packed into. See -autoPackSize */
+	RsslUInt32			autoPackDelay;				/* Longest time (usec) a message waits in a packed buffer. See -autoPackDelay */
 	RsslUInt32			sendBufSize;				/* System Send Buffer Size. See -sendBufSize */
 	RsslUInt32			recvBufSize;				/* System Send Buffer Size. See -recvBufSize */
 	char				summaryFilename[128];		/* Name of the summary log file. See -summaryFile */
 	RsslUInt32			writeStatsInterval;			/* Controls how often statistics are written. */
 	RsslBool			displayStats;				/* Controls whether stats appear on the screen. */
 	RsslBool			useReactor;					/* Use the VA Reactor instead of the UPA Channel for sending and receiving. */
+	RsslBool			useEpollNotifier;			/* Use epoll for the VA Reactor's channel notification. See -epoll */
 	RsslConnectionTypes connType;					/* Connection type for this provider */
 	char				serverCert[255];			/* Server certificate file location */
 	char				serverKey[255];				/* Server private key file location */
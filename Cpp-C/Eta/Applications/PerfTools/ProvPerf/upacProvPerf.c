@@ -168,6 +168,9 @@ RSSL_THREAD_DECLARE(runReactorConnectionHandler, pArg)
 	// create reactor
 	rsslClearCreateReactorOptions(&reactorOpts);
 
+	if (provPerfConfig.useEpollNotifier)
+		reactorOpts.notifierType = RSSL_RC_NT_EPOLL;
+
 	if (!(pProvThread->pReactor = rsslCreateReactor(&reactorOpts, &rsslErrorInfo)))
 	{
 		printf("Reactor creation failed: %s\n", rsslErrorInfo.rsslError.text);
@@ -294,6 +297,16 @@ RsslReactorCallbackRet channelEventCallback(RsslReactor *pReactor, RsslReactorCh
                 }
 			}
 
+			if (provPerfConfig.autoPackSize > 0)
+			{
+				if (rsslReactorChannelIoctl(pReactorChannel, RSSL_AUTO_PACK_DELAY, &provPerfConfig.autoPackDelay, &rsslErrorInfo) != RSSL_RET_SUCCESS
+						|| rsslReactorChannelIoctl(pReactorChannel, RSSL_AUTO_PACK_SIZE, &provPerfConfig.autoPackSize, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+				{
+					printf("rsslReactorChannelIoctl() of auto-pack settings failed <%s>\n", rsslErrorInfo.rsslError.text);
+					exit(-1);
+				}
+			}
+
 			if ((ret = rsslReactorGetChannelInfo(pReactorChannel, &reactorChannelInfo, &rsslErrorInfo)) != RSSL_RET_SUCCESS)
 			{
 				printf("rsslReactorGetChannelInfo() failed: %d\n", ret);
@@ -805,6 +818,16 @@ RsslRet processActiveChannel(ChannelHandler *pChanHandler, ChannelInfo *pChannel
 		}
 	}
 
+	if (provPerfConfig.autoPackSize > 0)
+	{
+		if (rsslIoctl(pChannelInfo->pChannel, RSSL_AUTO_PACK_DELAY, &provPerfConfig.autoPackDelay, &error) != RSSL_RET_SUCCESS
+				|| rsslIoctl(pChannelInfo->pChannel, RSSL_AUTO_PACK_SIZE, &provPerfConfig.autoPackSize, &error) != RSSL_RET_SUCCESS)
+		{
+			printf("rsslIoctl() of auto-pack settings failed <%s>\n", error.text);
+			exit(-1);
+		}
+	}
+
 	if ((ret = rsslGetChannelInfo(pChannelInfo->pChannel, &channelInfo, &error)) != RSSL_RET_SUCCESS)
 	{
 		printf("rsslGetChannelInfo() failed: %d\n", ret);
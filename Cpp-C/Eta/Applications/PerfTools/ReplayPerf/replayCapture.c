@@ -0,0 +1,671 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+/* replayCapture.c
+ * Reads classic pcap files (not pcapng) without depending on libpcap, and
+ * undoes the RIPC framing of socket connections.  See the readme for the
+ * limits on what can be extracted. */
+
+#include "replayCapture.h"
+#include "rtr/rsslTransport.h"
+#include "rtr/rsslIterators.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+/* Link layer types from the pcap file header */
+#define LINKTYPE_NULL		0
+#define LINKTYPE_ETHERNET	1
+#define LINKTYPE_RAW		101
+#define LINKTYPE_LINUX_SLL	113
+#define LINKTYPE_IPV4		228
+#define LINKTYPE_LINUX_SLL2	276
+
+#define IP_PROTO_TCP		6
+#define IP_PROTO_UDP		17
+
+#define TCP_FLAG_SYN		0x02
+#define TCP_FLAG_ACK		0x10
+
+/* RIPC header flags, as written by the socket transport */
+#define RIPC_EXTENDED_FLAGS	0x1
+#define RIPC_DATA			0x2
+#define RIPC_COMP_DATA		0x4
+#define RIPC_COMP_FRAG		0x8
+#define RIPC_PACKING		0x10
+
+/* RIPC extended header flags */
+#define RIPC_CONNACK		0x1
+#define RIPC_CONNNAK		0x2
+#define RIPC_FRAG			0x4
+#define RIPC_FRAG_HEADER	0x8
+
+/* RIPC version numbers sent in the ConnectAck.  Versions 13 and later use 2-byte fragment ids. */
+#define RIPC_VERSION_13		8
+#define RIPC_VERSION_14		9
+
+/* Sequenced multicast header fields */
+#define SEQ_MCAST_VERSION			1
+#define SEQ_MCAST_PING_LEN			12
+
+#define MAX_PACKET_LENGTH	(1024 * 1024)
+
+typedef struct
+{
+	FILE			*file;
+	RsslBool		bigEndian;
+	RsslBool		nanosec;
+	RsslUInt32		linkType;
+	unsigned char	*packet;
+} PcapReader;
+
+/* Undoes the RIPC framing of a byte stream, one piece of the stream at a time. */
+typedef struct
+{
+	ReplayCapture	*pCapture;
+	char			*pending;			/* Bytes not yet making up a whole RIPC message */
+	size_t			pendingLength;
+	size_t			pendingCapacity;
+	RsslUInt32		ripcVersion;
+
+	char			*fragment;			/* Fragmented message being reassembled */
+	RsslUInt32		fragmentLength;
+	RsslUInt32		fragmentTotal;
+	RsslUInt16		fragmentId;
+	RsslBool		inFragment;
+} RipcParser;
+
+static RsslUInt16 getU16(const unsigned char *p, RsslBool bigEndian)
+{
+	return bigEndian ? (RsslUInt16)((p[0] << 8) | p[1]) : (RsslUInt16)((p[1] << 8) | p[0]);
+}
+
+static RsslUInt32 getU32(const unsigned char *p, RsslBool bigEndian)
+{
+	return bigEndian ? ((RsslUInt32)p[0] << 24) | ((RsslUInt32)p[1] << 16) | ((RsslUInt32)p[2] << 8) | p[3]
+		: ((RsslUInt32)p[3] << 24) | ((RsslUInt32)p[2] << 16) | ((RsslUInt32)p[1] << 8) | p[0];
+}
+
+static void addRecord(ReplayCapture *pCapture, const char *data, RsslUInt32 length, RsslUInt64 timeNsec)
+{
+	while (pCapture->dataSize + length > pCapture->dataCapacity)
+	{
+		pCapture->dataCapacity = pCapture->dataCapacity ? pCapture->dataCapacity * 2 : 1048576;
+		pCapture->data = (char*)realloc(pCapture->data, pCapture->dataCapacity);
+		assert(pCapture->data);
+	}
+
+	if (pCapture->recordCount == pCapture->recordCapacity)
+	{
+		pCapture->recordCapacity = pCapture->recordCapacity ? pCapture->recordCapacity * 2 : 4096;
+		pCapture->records = (ReplayRecord*)realloc(pCapture->records, pCapture->recordCapacity * sizeof(ReplayRecord));
+		assert(pCapture->records);
+	}
+
+	memcpy(pCapture->data + pCapture->dataSize, data, length);
+	pCapture->records[pCapture->recordCount].offset = pCapture->dataSize;
+	pCapture->records[pCapture->recordCount].length = length;
+	pCapture->records[pCapture->recordCount].timeNsec = timeNsec;
+	pCapture->dataSize += length;
+	++pCapture->recordCount;
+}
+
+/* Makes record times relative to the first record. */
+static void finishCapture(ReplayCapture *pCapture)
+{
+	RsslUInt32 i;
+	RsslUInt64 firstTime;
+
+	if (!pCapture->recordCount)
+		return;
+
+	firstTime = pCapture->records[0].timeNsec;
+	for (i = 0; i < pCapture->recordCount; ++i)
+		pCapture->records[i].timeNsec = pCapture->records[i].timeNsec > firstTime ? pCapture->records[i].timeNsec - firstTime : 0;
+}
+
+static int pcapOpen(PcapReader *pReader, const char *fileName)
+{
+	unsigned char header[24];
+
+	memset(pReader, 0, sizeof(PcapReader));
+
+	if (!(pReader->file = fopen(fileName, "rb")))
+	{
+		printf("Error: Could not open capture file %s.\n", fileName);
+		return -1;
+	}
+
+	if (fread(header, 1, sizeof(header), pReader->file) != sizeof(header))
+	{
+		printf("Error: %s is too short to be a pcap file.\n", fileName);
+		fclose(pReader->file);
+		return -1;
+	}
+
+	if (header[0] == 0xa1 && header[1] == 0xb2 && header[2] == 0xc3 && header[3] == 0xd4)
+		pReader->bigEndian = RSSL_TRUE;
+	else if (header[0] == 0xa1 && header[1] == 0xb2 && header[2] == 0x3c && header[3] == 0x4d)
+		pReader->bigEndian = pReader->nanosec = RSSL_TRUE;
+	else if (header[0] == 0x4d && header[1] == 0x3c && header[2] == 0xb2 && header[3] == 0xa1)
+		pReader->nanosec = RSSL_TRUE;
+	else if (!(header[0] == 0xd4 && header[1] == 0xc3 && header[2] == 0xb2 && header[3] == 0xa1))
+	{
+		if (header[0] == 0x0a && header[1] == 0x0d && header[2] == 0x0d && header[3] == 0x0a)
+			printf("Error: %s is a pcapng file; convert it with \"editcap -F pcap\" first.\n", fileName);
+		else
+			printf("Error: %s is not a pcap file.\n", fileName);
+		fclose(pReader->file);
+		return -1;
+	}
+
+	pReader->linkType = getU32(header + 20, pReader->bigEndian) & 0xffff;
+	switch (pReader->linkType)
+	{
+		case LINKTYPE_NULL:
+		case LINKTYPE_ETHERNET:
+		case LINKTYPE_RAW:
+		case LINKTYPE_LINUX_SLL:
+		case LINKTYPE_IPV4:
+		case LINKTYPE_LINUX_SLL2:
+			break;
+		default:
+			printf("Error: %s has unsupported link type %u.\n", fileName, pReader->linkType);
+			fclose(pReader->file);
+			return -1;
+	}
+
+	pReader->packet = (unsigned char*)malloc(MAX_PACKET_LENGTH);
+	assert(pReader->packet);
+	return 0;
+}
+
+/* Reads the next packet.  Returns 1 when a packet was read, 0 at the end of the file, -1 on error. */
+static int pcapNext(PcapReader *pReader, RsslUInt32 *pLength, RsslUInt32 *pOrigLength, RsslUInt64 *pTimeNsec)
+{
+	unsigned char header[16];
+	RsslUInt32 fraction;
+
+	if (fread(header, 1, sizeof(header), pReader->file) != sizeof(header))
+		return 0;
+
+	*pTimeNsec = (RsslUInt64)getU32(header, pReader->bigEndian) * 1000000000ULL;
+	fraction = getU32(header + 4, pReader->bigEndian);
+	*pTimeNsec += pReader->nanosec ? fraction : (RsslUInt64)fraction * 1000;
+	*pLength = getU32(header + 8, pReader->bigEndian);
+	*pOrigLength = getU32(header + 12, pReader->bigEndian);
+
+	if (*pLength > MAX_PACKET_LENGTH)
+	{
+		printf("Error: Capture file is corrupt (packet of %u bytes).\n", *pLength);
+		return -1;
+	}
+
+	if (fread(pReader->packet, 1, *pLength, pReader->file) != *pLength)
+	{
+		printf("Warning: Capture file ends in the middle of a packet; ignoring it.\n");
+		return 0;
+	}
+
+	return 1;
+}
+
+static void pcapClose(PcapReader *pReader)
+{
+	free(pReader->packet);
+	fclose(pReader->file);
+}
+
+/* Finds the IPv4 header of a packet.  Returns NULL for anything else. */
+static const unsigned char *getIpHeader(PcapReader *pReader, const unsigned char *packet, RsslUInt32 *pLength)
+{
+	RsslUInt32 offset;
+	RsslUInt16 etherType;
+
+	switch (pReader->linkType)
+	{
+		case LINKTYPE_NULL:
+			/* Address family, in the byte order of the capturing host */
+			if (*pLength < 4 || (getU32(packet, RSSL_FALSE) != 2 && getU32(packet, RSSL_TRUE) != 2))
+				return NULL;
+			offset = 4;
+			break;
+		case LINKTYPE_ETHERNET:
+			offset = 12;
+			if (*pLength < offset + 2)
+				return NULL;
+			etherType = getU16(packet + offset, RSSL_TRUE);
+			while (etherType == 0x8100 || etherType == 0x88a8)
+			{
+				/* VLAN tag */
+				offset += 4;
+				if (*pLength < offset + 2)
+					return NULL;
+				etherType = getU16(packet + offset, RSSL_TRUE);
+			}
+			if (etherType != 0x0800)
+				return NULL;
+			offset += 2;
+			break;
+		case LINKTYPE_LINUX_SLL:
+			if (*pLength < 16 || getU16(packet + 14, RSSL_TRUE) != 0x0800)
+				return NULL;
+			offset = 16;
+			break;
+		case LINKTYPE_LINUX_SLL2:
+			if (*pLength < 20 || getU16(packet, RSSL_TRUE) != 0x0800)
+				return NULL;
+			offset = 20;
+			break;
+		default:
+			offset = 0;
+			break;
+	}
+
+	if (*pLength < offset + 20 || (packet[offset] >> 4) != 4)
+		return NULL;
+
+	*pLength -= offset;
+	return packet + offset;
+}
+
+/* Finds the UDP or TCP header of a packet, and the length of the IP payload.
+ * Returns NULL for other protocols, fragments and truncated packets. */
+static const unsigned char *getTransportHeader(ReplayCapture *pCapture, PcapReader *pReader, RsslUInt8 protocol,
+		RsslUInt32 length, RsslUInt32 origLength, RsslUInt32 *pIpAddrs, RsslUInt32 *pPayloadLength)
+{
+	const unsigned char *ip;
+	RsslUInt32 headerLength, totalLength;
+	RsslUInt16 fragment;
+
+	if (!(ip = getIpHeader(pReader, pReader->packet, &length)) || ip[9] != protocol)
+	{
+		pCapture->otherPackets++;
+		return NULL;
+	}
+
+	fragment = getU16(ip + 6, RSSL_TRUE);
+	if (fragment & 0x3fff)
+	{
+		/* Count each fragmented datagram once, by its first fragment */
+		if ((fragment & 0x1fff) == 0)
+			pCapture->ipFragments++;
+		return NULL;
+	}
+
+	headerLength = (ip[0] & 0x0f) * 4;
+	totalLength = getU16(ip + 2, RSSL_TRUE);
+	if (totalLength > length || headerLength + 8 > totalLength)
+	{
+		if (length < origLength)
+			pCapture->truncatedPackets++;
+		else
+			pCapture->otherPackets++;
+		return NULL;
+	}
+
+	pIpAddrs[0] = getU32(ip + 12, RSSL_TRUE);
+	pIpAddrs[1] = getU32(ip + 16, RSSL_TRUE);
+	*pPayloadLength = totalLength - headerLength;
+	return ip + headerLength;
+}
+
+int replayLoadMcastPcap(ReplayCapture *pCapture, const char *fileName, ReplayFilter *pFilter)
+{
+	PcapReader reader;
+	RsslUInt32 length, origLength, payloadLength, ipAddrs[2];
+	RsslUInt64 timeNsec;
+	const unsigned char *udp, *payload;
+	RsslUInt16 port = pFilter->port;
+	RsslUInt32 address = pFilter->address;
+	RsslBool started = RSSL_FALSE;
+	int ret;
+
+	if (pcapOpen(&reader, fileName) < 0)
+		return -1;
+
+	pCapture->hasTimestamps = RSSL_TRUE;
+
+	while ((ret = pcapNext(&reader, &length, &origLength, &timeNsec)) > 0)
+	{
+		if (!(udp = getTransportHeader(pCapture, &reader, IP_PROTO_UDP, length, origLength, ipAddrs, &payloadLength)))
+			continue;
+
+		payload = udp + 8;
+		payloadLength = getU16(udp + 4, RSSL_TRUE);
+		if (payloadLength < 8)
+		{
+			pCapture->otherPackets++;
+			continue;
+		}
+		payloadLength -= 8;
+
+		/* Only take datagrams that look like sequenced multicast, for one group. */
+		if ((port && getU16(udp + 2, RSSL_TRUE) != port) || (address && ipAddrs[1] != address)
+				|| payloadLength < SEQ_MCAST_PING_LEN || payload[0] != SEQ_MCAST_VERSION || payload[3] > payloadLength
+				|| (started && payload[2] != pCapture->protocolType))
+		{
+			pCapture->otherPackets++;
+			continue;
+		}
+
+		if (!started)
+		{
+			port = getU16(udp + 2, RSSL_TRUE);
+			address = ipAddrs[1];
+			pCapture->protocolType = payload[2];
+			pCapture->majorVersion = payload[6];
+			pCapture->minorVersion = payload[7];
+			started = RSSL_TRUE;
+			printf("Replaying datagrams sent to %u.%u.%u.%u:%u.\n", address >> 24, (address >> 16) & 0xff,
+					(address >> 8) & 0xff, address & 0xff, port);
+		}
+
+		addRecord(pCapture, (const char*)payload, payloadLength, timeNsec);
+	}
+
+	pcapClose(&reader);
+	finishCapture(pCapture);
+	return ret < 0 ? -1 : 0;
+}
+
+static void ripcAppendFragment(RipcParser *pParser, const unsigned char *data, RsslUInt32 length, RsslUInt64 timeNsec)
+{
+	if (length > pParser->fragmentTotal - pParser->fragmentLength)
+		length = pParser->fragmentTotal - pParser->fragmentLength;
+
+	memcpy(pParser->fragment + pParser->fragmentLength, data, length);
+	pParser->fragmentLength += length;
+
+	if (pParser->fragmentLength == pParser->fragmentTotal)
+	{
+		addRecord(pParser->pCapture, pParser->fragment, pParser->fragmentTotal, timeNsec);
+		pParser->inFragment = RSSL_FALSE;
+	}
+}
+
+/* Handles one whole RIPC message. */
+static void ripcParseMessage(RipcParser *pParser, const unsigned char *msg, RsslUInt32 msgLength, RsslUInt64 timeNsec)
+{
+	RsslUInt8 flags = msg[2], extFlags = 0;
+	RsslUInt32 headerLength = 3, fragIdLength = pParser->ripcVersion >= RIPC_VERSION_13 ? 2 : 1;
+	RsslUInt16 fragId = 0;
+	const unsigned char *payload;
+	RsslUInt32 payloadLength, packedLength;
+
+	if (flags & RIPC_EXTENDED_FLAGS)
+	{
+		if (msgLength < 4)
+			return;
+		extFlags = msg[3];
+		headerLength = 4;
+
+		if (!(flags & (RIPC_DATA | RIPC_COMP_DATA | RIPC_COMP_FRAG)) && (extFlags & RIPC_CONNACK))
+		{
+			/* ConnectAck: RIPC version, then the RWF version and compression negotiated */
+			if (msgLength >= 18)
+			{
+				pParser->ripcVersion = getU32(msg + 6, RSSL_TRUE);
+				pParser->pCapture->majorVersion = msg[14];
+				pParser->pCapture->minorVersion = msg[15];
+				if (getU16(msg + 16, RSSL_TRUE) != RSSL_COMP_NONE)
+					printf("Warning: The connection negotiated compression; compressed messages will be skipped.\n");
+			}
+			return;
+		}
+
+		if (extFlags & RIPC_FRAG_HEADER)
+		{
+			headerLength += 4 + fragIdLength;
+			if (msgLength < headerLength)
+				return;
+			fragId = fragIdLength == 2 ? getU16(msg + 8, RSSL_TRUE) : msg[8];
+		}
+		else if (extFlags & RIPC_FRAG)
+		{
+			headerLength += fragIdLength;
+			if (msgLength < headerLength)
+				return;
+			fragId = fragIdLength == 2 ? getU16(msg + 4, RSSL_TRUE) : msg[4];
+		}
+	}
+
+	if (flags & (RIPC_COMP_DATA | RIPC_COMP_FRAG))
+	{
+		pParser->pCapture->compressedMsgs++;
+		return;
+	}
+
+	if (!(flags & RIPC_DATA))
+		return;
+
+	payload = msg + headerLength;
+	payloadLength = msgLength - headerLength;
+
+	if (extFlags & RIPC_FRAG_HEADER)
+	{
+		pParser->fragmentTotal = getU32(msg + 4, RSSL_TRUE);
+		pParser->fragmentLength = 0;
+		pParser->fragmentId = fragId;
+		pParser->inFragment = RSSL_TRUE;
+		pParser->fragment = (char*)realloc(pParser->fragment, pParser->fragmentTotal ? pParser->fragmentTotal : 1);
+		assert(pParser->fragment);
+		ripcAppendFragment(pParser, payload, payloadLength, timeNsec);
+	}
+	else if (extFlags & RIPC_FRAG)
+	{
+		if (pParser->inFragment && fragId == pParser->fragmentId)
+			ripcAppendFragment(pParser, payload, payloadLength, timeNsec);
+	}
+	else if (flags & RIPC_PACKING)
+	{
+		/* Each packed message is preceded by its 2-byte length */
+		while (payloadLength >= 2)
+		{
+			packedLength = getU16(payload, RSSL_TRUE);
+			if (packedLength > payloadLength - 2)
+				break;
+			if (packedLength)
+				addRecord(pParser->pCapture, (const char*)payload + 2, packedLength, timeNsec);
+			payload += 2 + packedLength;
+			payloadLength -= 2 + packedLength;
+		}
+	}
+	else if (payloadLength)
+		addRecord(pParser->pCapture, (const char*)payload, payloadLength, timeNsec);
+	/* else a ping */
+}
+
+/* Adds the next piece of the stream, and handles each RIPC message it completes. */
+static void ripcParse(RipcParser *pParser, const unsigned char *data, size_t length, RsslUInt64 timeNsec)
+{
+	size_t offset = 0;
+	RsslUInt16 msgLength;
+
+	while (pParser->pendingLength + length > pParser->pendingCapacity)
+	{
+		pParser->pendingCapacity = pParser->pendingCapacity ? pParser->pendingCapacity * 2 : 131072;
+		pParser->pending = (char*)realloc(pParser->pending, pParser->pendingCapacity);
+		assert(pParser->pending);
+	}
+
+	memcpy(pParser->pending + pParser->pendingLength, data, length);
+	pParser->pendingLength += length;
+
+	while (pParser->pendingLength - offset >= 3)
+	{
+		msgLength = getU16((unsigned char*)pParser->pending + offset, RSSL_TRUE);
+		if (msgLength < 3)
+		{
+			printf("Warning: Invalid RIPC message length %u; ignoring the rest of the stream.\n", msgLength);
+			offset = pParser->pendingLength;
+			break;
+		}
+
+		if (pParser->pendingLength - offset < msgLength)
+			break;
+
+		ripcParseMessage(pParser, (unsigned char*)pParser->pending + offset, msgLength, timeNsec);
+		offset += msgLength;
+	}
+
+	memmove(pParser->pending, pParser->pending + offset, pParser->pendingLength - offset);
+	pParser->pendingLength -= offset;
+}
+
+static void ripcInitParser(RipcParser *pParser, ReplayCapture *pCapture)
+{
+	memset(pParser, 0, sizeof(RipcParser));
+	pParser->pCapture = pCapture;
+
+	/* Without a ConnectAck, assume the current versions */
+	pParser->ripcVersion = RIPC_VERSION_14;
+	pCapture->protocolType = RSSL_RWF_PROTOCOL_TYPE;
+	pCapture->majorVersion = RSSL_RWF_MAJOR_VERSION;
+	pCapture->minorVersion = RSSL_RWF_MINOR_VERSION;
+}
+
+static void ripcFreeParser(RipcParser *pParser)
+{
+	if (pParser->pendingLength)
+		printf("Warning: Stream ends in the middle of a RIPC message; ignoring it.\n");
+	free(pParser->pending);
+	free(pParser->fragment);
+}
+
+int replayLoadSocketPcap(ReplayCapture *pCapture, const char *fileName, ReplayFilter *pFilter)
+{
+	PcapReader reader;
+	RipcParser parser;
+	RsslUInt32 length, origLength, payloadLength, ipAddrs[2], seqNum, headerLength, skip;
+	RsslUInt32 serverAddr = 0, clientAddr = 0, nextSeqNum = 0;
+	RsslUInt16 serverPort = pFilter->port, clientPort = 0, srcPort, dstPort;
+	RsslUInt64 timeNsec;
+	const unsigned char *tcp;
+	RsslBool connected = RSSL_FALSE, seqKnown = RSSL_FALSE;
+	int ret;
+
+	if (pcapOpen(&reader, fileName) < 0)
+		return -1;
+
+	ripcInitParser(&parser, pCapture);
+	pCapture->hasTimestamps = RSSL_TRUE;
+
+	while ((ret = pcapNext(&reader, &length, &origLength, &timeNsec)) > 0)
+	{
+		if (!(tcp = getTransportHeader(pCapture, &reader, IP_PROTO_TCP, length, origLength, ipAddrs, &payloadLength)))
+			continue;
+
+		srcPort = getU16(tcp, RSSL_TRUE);
+		dstPort = getU16(tcp + 2, RSSL_TRUE);
+		seqNum = getU32(tcp + 4, RSSL_TRUE);
+		headerLength = (tcp[12] >> 4) * 4;
+		if (headerLength < 20 || headerLength > payloadLength)
+		{
+			pCapture->otherPackets++;
+			continue;
+		}
+		payloadLength -= headerLength;
+
+		if (!connected)
+		{
+			/* Take the first connection to the server port, or the first connection whose
+			 * SYN-ACK is captured, or else the first data sent from the lower port. */
+			if (serverPort ? srcPort != serverPort
+					: !((tcp[13] & (TCP_FLAG_SYN | TCP_FLAG_ACK)) == (TCP_FLAG_SYN | TCP_FLAG_ACK) || (payloadLength && srcPort < dstPort)))
+			{
+				pCapture->otherPackets++;
+				continue;
+			}
+
+			serverAddr = ipAddrs[0];
+			serverPort = srcPort;
+			clientAddr = ipAddrs[1];
+			clientPort = dstPort;
+			connected = RSSL_TRUE;
+			printf("Replaying the connection from %u.%u.%u.%u:%u to %u.%u.%u.%u:%u.\n",
+					serverAddr >> 24, (serverAddr >> 16) & 0xff, (serverAddr >> 8) & 0xff, serverAddr & 0xff, serverPort,
+					clientAddr >> 24, (clientAddr >> 16) & 0xff, (clientAddr >> 8) & 0xff, clientAddr & 0xff, clientPort);
+		}
+
+		if (ipAddrs[0] != serverAddr || srcPort != serverPort || ipAddrs[1] != clientAddr || dstPort != clientPort)
+		{
+			pCapture->otherPackets++;
+			continue;
+		}
+
+		if (tcp[13] & TCP_FLAG_SYN)
+		{
+			nextSeqNum = seqNum + 1;
+			seqKnown = RSSL_TRUE;
+			continue;
+		}
+
+		if (!payloadLength)
+			continue;
+
+		if (!seqKnown)
+		{
+			nextSeqNum = seqNum;
+			seqKnown = RSSL_TRUE;
+		}
+
+		/* The RIPC framing cannot be found again after missing bytes. */
+		if ((RsslInt32)(seqNum - nextSeqNum) > 0)
+		{
+			printf("Warning: %u bytes of the stream were not captured; ignoring the rest of the connection.\n", seqNum - nextSeqNum);
+			break;
+		}
+
+		/* Skip what was already seen in a retransmitted segment. */
+		skip = nextSeqNum - seqNum;
+		if (skip >= payloadLength)
+			continue;
+
+		ripcParse(&parser, tcp + headerLength + skip, payloadLength - skip, timeNsec);
+		nextSeqNum += payloadLength - skip;
+	}
+
+	if (!connected)
+		printf("Warning: No TCP connection found in %s.\n", fileName);
+
+	ripcFreeParser(&parser);
+	pcapClose(&reader);
+	finishCapture(pCapture);
+	return ret < 0 ? -1 : 0;
+}
+
+int replayLoadRipcStream(ReplayCapture *pCapture, const char *fileName)
+{
+	FILE *file;
+	RipcParser parser;
+	unsigned char chunk[65536];
+	size_t length;
+
+	if (!(file = fopen(fileName, "rb")))
+	{
+		printf("Error: Could not open stream file %s.\n", fileName);
+		return -1;
+	}
+
+	ripcInitParser(&parser, pCapture);
+
+	while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+		ripcParse(&parser, chunk, length, 0);
+
+	ripcFreeParser(&parser);
+	fclose(file);
+	return 0;
+}
+
+void replayFreeCapture(ReplayCapture *pCapture)
+{
+	free(pCapture->data);
+	free(pCapture->records);
+	memset(pCapture, 0, sizeof(ReplayCapture));
+}
@@ -0,0 +1,74 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+/* replayCapture.h
+ * Loads captured traffic into memory for ReplayPerf.  Sequenced multicast
+ * datagrams are taken from UDP packets in a pcap file.  RWF messages are
+ * taken from the RIPC framing of a TCP connection in a pcap file, or of a
+ * recorded RIPC byte stream. */
+
+#ifndef _REPLAY_CAPTURE_H
+#define _REPLAY_CAPTURE_H
+
+#include "rtr/rsslTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One captured datagram or message. */
+typedef struct
+{
+	size_t		offset;			/* Offset of the data in ReplayCapture::data */
+	RsslUInt32	length;			/* Length of the data */
+	RsslUInt64	timeNsec;		/* Capture time, relative to the first record (0 when unknown) */
+} ReplayRecord;
+
+typedef struct
+{
+	char			*data;				/* Records, stored back to back */
+	size_t			dataSize;
+	size_t			dataCapacity;
+	ReplayRecord	*records;
+	RsslUInt32		recordCount;
+	RsslUInt32		recordCapacity;
+
+	RsslBool		hasTimestamps;		/* Records carry capture times (pcap input) */
+	RsslUInt8		protocolType;		/* Protocol type in the sequenced multicast headers */
+	RsslUInt8		majorVersion;		/* RWF version from the multicast headers or the RIPC ConnectAck */
+	RsslUInt8		minorVersion;
+
+	/* Counts of captured data that could not be replayed */
+	RsslUInt32		ipFragments;		/* Datagrams split into IP fragments, which are not reassembled */
+	RsslUInt32		truncatedPackets;	/* Packets cut short by the capture's snapshot length */
+	RsslUInt32		compressedMsgs;		/* RIPC messages sent compressed */
+	RsslUInt32		otherPackets;		/* Packets that did not match the filter */
+} ReplayCapture;
+
+/* Filters for choosing packets out of a pcap file. */
+typedef struct
+{
+	RsslUInt16	port;			/* UDP destination port, or TCP server port; 0 chooses one automatically */
+	RsslUInt32	address;		/* UDP destination address, in host byte order; 0 accepts any */
+} ReplayFilter;
+
+/* Loads sequenced multicast datagrams from the UDP packets of a pcap file. */
+int replayLoadMcastPcap(ReplayCapture *pCapture, const char *fileName, ReplayFilter *pFilter);
+
+/* Loads RWF messages from the server side of a TCP connection in a pcap file. */
+int replayLoadSocketPcap(ReplayCapture *pCapture, const char *fileName, ReplayFilter *pFilter);
+
+/* Loads RWF messages from a file holding the bytes a client read from a RIPC connection. */
+int replayLoadRipcStream(ReplayCapture *pCapture, const char *fileName);
+
+void replayFreeCapture(ReplayCapture *pCapture);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
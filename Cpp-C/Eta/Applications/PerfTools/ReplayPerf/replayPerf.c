@@ -0,0 +1,737 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+/*
+ * ReplayPerf replays captured traffic into a local channel, and measures how
+ * quickly the channel reads it and rsslDecodeMsg() decodes it.  Sequenced
+ * multicast datagrams are sent over loopback multicast to an
+ * RSSL_CONN_TYPE_SEQ_MCAST channel.  Messages from a socket connection are
+ * written by a local server to an RSSL_CONN_TYPE_SOCKET channel.  See the
+ * readme for the capture formats.
+ */
+
+#include "replayCapture.h"
+#include "testUtils.h"
+#include "rtr/rsslTransport.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslGetTime.h"
+#include "rtr/rsslThread.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#ifdef WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#endif
+
+typedef enum
+{
+	REPLAY_NONE,
+	REPLAY_SEQ_MCAST,
+	REPLAY_SOCKET
+} ReplayType;
+
+/* Options */
+static ReplayType replayType = REPLAY_NONE;
+static char *pcapFile = NULL;
+static char *ripcStreamFile = NULL;
+static double speed = 1.0;					/* 0 replays as fast as possible */
+static RsslUInt32 repeatCount = 1;
+static char groupAddress[128] = "239.255.100.1";
+static char servicePort[32] = "14099";
+static char interfaceName[128] = "127.0.0.1";
+static RsslUInt32 readBatchSize = 0;
+static RsslUInt32 recvBufSize = 16 * 1024 * 1024;
+static RsslUInt32 idleTimeoutMsec = 1000;
+static RsslBool decodePayload = RSSL_FALSE;
+static char statsFile[255] = "";
+static ReplayFilter filter;
+
+static ReplayCapture capture;
+
+/* Set by the replaying thread once everything was sent */
+static volatile RsslBool replayDone = RSSL_FALSE;
+static RsslUInt64 replayStartTime = 0, replayEndTime = 0;
+static RsslUInt64 recordsSent = 0;
+
+static RsslServer *pServer = NULL;
+
+/* Counts kept by the reading side */
+typedef struct
+{
+	RsslUInt64	msgs;
+	RsslUInt64	bytes;
+	RsslUInt64	pings;
+	RsslUInt64	readNsec;			/* Time spent in rsslRead() calls that returned something */
+	RsslUInt64	decodeNsec;			/* Time spent decoding */
+	RsslUInt64	decodeErrors;
+	RsslUInt64	firstMsgTime;
+	RsslUInt64	lastMsgTime;
+	RsslUInt64	datagramsRead;
+	RsslUInt64	gapsDetected;
+} ReadStats;
+
+static ReadStats readStats;
+
+static void exitWithUsage()
+{
+	printf(	"Usage: ReplayPerf -seqMcast|-socket [options]\n"
+			"Options:\n"
+			"  -?                         Shows this usage\n"
+			"  -seqMcast                  Replays sequenced multicast datagrams over loopback multicast\n"
+			"  -socket                    Replays a socket connection through a local server\n"
+			"  -pcap <filename>           Classic pcap capture to replay\n"
+			"  -ripcStream <filename>     Bytes a client read from a RIPC connection (-socket only)\n"
+			"  -capturePort <port>        UDP destination port, or TCP server port, to take from the pcap (default: first found)\n"
+			"  -captureGroup <address>    UDP destination address to take from the pcap (default: first found)\n"
+			"  -speed <original|max|n>    Replays at the captured rate, as fast as possible, or n times the captured rate (default original)\n"
+			"  -repeat <count>            Number of times to replay the capture (default 1)\n"
+			"  -group <address>           Multicast group to replay to (default 239.255.100.1)\n"
+			"  -port <port>               Multicast port, or local server port (default 14099)\n"
+			"  -if <address>              Interface to replay over (default 127.0.0.1)\n"
+			"  -readBatchSize <count>     Datagrams the multicast channel reads per system call (default 0)\n"
+			"  -recvBufSize <bytes>       System receive buffer size of the reading channel (default 16777216)\n"
+			"  -idleTimeout <msec>        Time to wait for more data after the replay ends (default 1000)\n"
+			"  -decodePayload             Also decodes the field list or map payload of each message\n"
+			"  -statsFile <filename>      Appends a line of comma separated results to this file\n");
+	exit(-1);
+}
+
+static void sleepUntil(RsslUInt64 wakeTime)
+{
+	RsslUInt64 currentTime;
+
+	while ((currentTime = rsslGetTimeNano()) < wakeTime)
+	{
+		/* Spin for the last couple of milliseconds, for accurate pacing. */
+		if (wakeTime - currentTime > 2000000)
+		{
+#ifdef WIN32
+			Sleep(1);
+#else
+			usleep(1000);
+#endif
+		}
+	}
+}
+
+/* Returns the time, from the start of the replay, when the record should be sent. */
+RTR_C_INLINE RsslUInt64 replayTime(RsslUInt32 pass, RsslUInt32 index)
+{
+	RsslUInt64 captureDuration = capture.records[capture.recordCount - 1].timeNsec;
+
+	return (RsslUInt64)((double)(pass * captureDuration + capture.records[index].timeNsec) / speed);
+}
+
+static RSSL_THREAD_DECLARE(runMcastReplay, pArg)
+{
+	int sock;
+	struct sockaddr_in groupAddr;
+	struct in_addr ifAddr;
+	unsigned char loop = 1;
+	int sendBufSize = 4 * 1024 * 1024;
+	RsslUInt32 pass, i;
+	ReplayRecord *pRecord;
+
+	if ((sock = (int)socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+	{
+		printf("Error: Could not create the sending socket.  System errno: (%d)\n", errno);
+		exit(-1);
+	}
+
+	memset(&groupAddr, 0, sizeof(groupAddr));
+	groupAddr.sin_family = AF_INET;
+	groupAddr.sin_addr.s_addr = inet_addr(groupAddress);
+	groupAddr.sin_port = htons((unsigned short)atoi(servicePort));
+	ifAddr.s_addr = inet_addr(interfaceName);
+
+	if (setsockopt(sock, IPPROTO_IP, IP_MULTICAST_IF, (char*)&ifAddr, sizeof(ifAddr)) < 0
+			|| setsockopt(sock, IPPROTO_IP, IP_MULTICAST_LOOP, (char*)&loop, sizeof(loop)) < 0)
+	{
+		printf("Error: Could not set up multicast on interface %s.  System errno: (%d)\n", interfaceName, errno);
+		exit(-1);
+	}
+	setsockopt(sock, SOL_SOCKET, SO_SNDBUF, (char*)&sendBufSize, sizeof(sendBufSize));
+
+	replayStartTime = rsslGetTimeNano();
+	for (pass = 0; pass < repeatCount; ++pass)
+	{
+		for (i = 0; i < capture.recordCount; ++i)
+		{
+			pRecord = &capture.records[i];
+
+			if (speed > 0)
+				sleepUntil(replayStartTime + replayTime(pass, i));
+
+			while (sendto(sock, capture.data + pRecord->offset, pRecord->length, 0, (struct sockaddr*)&groupAddr, sizeof(groupAddr)) < 0)
+			{
+				if (errno != ENOBUFS && errno != EAGAIN && errno != EINTR)
+				{
+					printf("Error: sendto() failed.  System errno: (%d)\n", errno);
+					exit(-1);
+				}
+			}
+			++recordsSent;
+		}
+	}
+	replayEndTime = rsslGetTimeNano();
+
+#ifdef WIN32
+	closesocket(sock);
+#else
+	close(sock);
+#endif
+
+	replayDone = RSSL_TRUE;
+	return RSSL_THREAD_RETURN();
+}
+
+/* Flushes until everything queued on the channel was written. */
+static void flushAll(RsslChannel *pChannel)
+{
+	RsslError error;
+	RsslRet ret;
+
+	while ((ret = rsslFlush(pChannel, &error)) > 0)
+		;
+
+	if (ret < RSSL_RET_SUCCESS)
+	{
+		printf("Error: rsslFlush() failed: %s (%d)\n", error.text, error.rsslErrorId);
+		exit(-1);
+	}
+}
+
+static void writeRecord(RsslChannel *pChannel, ReplayRecord *pRecord)
+{
+	RsslBuffer *pBuffer;
+	RsslError error;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslRet ret;
+
+	while (!(pBuffer = rsslGetBuffer(pChannel, pRecord->length, RSSL_FALSE, &error)))
+	{
+		if (error.rsslErrorId != RSSL_RET_BUFFER_NO_BUFFERS)
+		{
+			printf("Error: rsslGetBuffer() failed: %s (%d)\n", error.text, error.rsslErrorId);
+			exit(-1);
+		}
+		flushAll(pChannel);
+	}
+
+	memcpy(pBuffer->data, capture.data + pRecord->offset, pRecord->length);
+	pBuffer->length = pRecord->length;
+
+	while ((ret = rsslWrite(pChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &error)) == RSSL_RET_WRITE_CALL_AGAIN)
+		flushAll(pChannel);
+
+	if (ret < RSSL_RET_SUCCESS)
+	{
+		printf("Error: rsslWrite() failed: %s (%d)\n", error.text, error.rsslErrorId);
+		exit(-1);
+	}
+}
+
+static RSSL_THREAD_DECLARE(runSocketReplay, pArg)
+{
+	RsslChannel *pChannel;
+	RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+	RsslInProgInfo inProg = RSSL_INIT_IN_PROG_INFO;
+	RsslError error;
+	RsslRet ret;
+	fd_set readFds;
+	RsslUInt32 pass, i;
+
+	FD_ZERO(&readFds);
+	FD_SET(pServer->socketId, &readFds);
+	if (select(FD_SETSIZE, &readFds, NULL, NULL, NULL) <= 0)
+	{
+		printf("Error: select() failed while accepting.  System errno: (%d)\n", errno);
+		exit(-1);
+	}
+
+	if (!(pChannel = rsslAccept(pServer, &acceptOpts, &error)))
+	{
+		printf("Error: rsslAccept() failed: %s (%d)\n", error.text, error.rsslErrorId);
+		exit(-1);
+	}
+
+	while (pChannel->state != RSSL_CH_STATE_ACTIVE)
+	{
+		if ((ret = rsslInitChannel(pChannel, &inProg, &error)) < RSSL_RET_SUCCESS)
+		{
+			printf("Error: rsslInitChannel() failed on the server channel: %s (%d)\n", error.text, error.rsslErrorId);
+			exit(-1);
+		}
+	}
+
+	replayStartTime = rsslGetTimeNano();
+	for (pass = 0; pass < repeatCount; ++pass)
+	{
+		for (i = 0; i < capture.recordCount; ++i)
+		{
+			if (speed > 0)
+			{
+				RsslUInt64 sendTime = replayStartTime + replayTime(pass, i);
+
+				/* Send what is queued before waiting, so it is not held back. */
+				if (rsslGetTimeNano() < sendTime)
+				{
+					flushAll(pChannel);
+					sleepUntil(sendTime);
+				}
+			}
+
+			writeRecord(pChannel, &capture.records[i]);
+			++recordsSent;
+		}
+	}
+	flushAll(pChannel);
+	replayEndTime = rsslGetTimeNano();
+
+	replayDone = RSSL_TRUE;
+
+	/* Keep the channel open until the reader is done with it. */
+	FD_ZERO(&readFds);
+	FD_SET(pChannel->socketId, &readFds);
+	select(FD_SETSIZE, &readFds, NULL, NULL, NULL);
+
+	rsslCloseChannel(pChannel, &error);
+	return RSSL_THREAD_RETURN();
+}
+
+/* Decodes the entries of a field list. */
+static RsslRet decodeFieldList(RsslDecodeIterator *pIter)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeFieldList(pIter, &fieldList, NULL)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeFieldEntry(pIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Decodes the entries of a map, and their field lists. */
+static RsslRet decodeMap(RsslDecodeIterator *pIter)
+{
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeMap(pIter, &map)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (map.flags & RSSL_MPF_HAS_SUMMARY_DATA && map.containerType == RSSL_DT_FIELD_LIST
+			&& (ret = decodeFieldList(pIter)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeMapEntry(pIter, &mapEntry, NULL)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+
+		if (mapEntry.action != RSSL_MPEA_DELETE_ENTRY && map.containerType == RSSL_DT_FIELD_LIST
+				&& (ret = decodeFieldList(pIter)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE void decodeMessage(RsslChannel *pChannel, RsslBuffer *pBuffer)
+{
+	RsslDecodeIterator iter;
+	RsslMsg msg;
+	RsslRet ret;
+	RsslUInt64 startTime = rsslGetTimeNano();
+
+	rsslClearDecodeIterator(&iter);
+	rsslSetDecodeIteratorRWFVersion(&iter, pChannel->majorVersion, pChannel->minorVersion);
+	rsslSetDecodeIteratorBuffer(&iter, pBuffer);
+
+	ret = rsslDecodeMsg(&iter, &msg);
+
+	if (ret >= RSSL_RET_SUCCESS && decodePayload && msg.msgBase.encDataBody.length)
+	{
+		if (msg.msgBase.containerType == RSSL_DT_FIELD_LIST)
+			ret = decodeFieldList(&iter);
+		else if (msg.msgBase.containerType == RSSL_DT_MAP)
+			ret = decodeMap(&iter);
+	}
+
+	readStats.decodeNsec += rsslGetTimeNano() - startTime;
+
+	if (ret < RSSL_RET_SUCCESS)
+		readStats.decodeErrors++;
+}
+
+/* Reads and decodes until the replay is done and nothing more arrives. */
+static void readChannel(RsslChannel *pChannel)
+{
+	RsslReadInArgs readInArgs;
+	RsslReadOutArgs readOutArgs;
+	RsslBuffer *pBuffer;
+	RsslError error;
+	RsslRet ret;
+	RsslUInt64 startTime, endTime, idleSince = 0;
+	fd_set readFds;
+	struct timeval selectTime;
+
+	for (;;)
+	{
+		rsslClearReadInArgs(&readInArgs);
+		rsslClearReadOutArgs(&readOutArgs);
+
+		startTime = rsslGetTimeNano();
+		pBuffer = rsslReadEx(pChannel, &readInArgs, &readOutArgs, &ret, &error);
+		endTime = rsslGetTimeNano();
+
+		if (pBuffer)
+		{
+			readStats.readNsec += endTime - startTime;
+			if (!readStats.firstMsgTime)
+				readStats.firstMsgTime = startTime;
+			readStats.lastMsgTime = endTime;
+			readStats.msgs++;
+			readStats.bytes += pBuffer->length;
+			decodeMessage(pChannel, pBuffer);
+			idleSince = 0;
+			continue;
+		}
+
+		if (ret == RSSL_RET_READ_PING)
+		{
+			readStats.readNsec += endTime - startTime;
+			readStats.pings++;
+			continue;
+		}
+
+		if (ret > RSSL_RET_SUCCESS)
+			continue;
+
+		if (ret == RSSL_RET_READ_FD_CHANGE)
+			continue;
+
+		if (ret != RSSL_RET_READ_WOULD_BLOCK && ret != RSSL_RET_SUCCESS)
+		{
+			if (!replayDone || ret != RSSL_RET_FAILURE)
+				printf("Error: rsslRead() failed: %s (%d)\n", error.text, error.rsslErrorId);
+			break;
+		}
+
+		if (replayDone)
+		{
+			if (!idleSince)
+				idleSince = endTime;
+			else if (endTime - idleSince >= (RsslUInt64)idleTimeoutMsec * 1000000)
+				break;
+		}
+
+		FD_ZERO(&readFds);
+		FD_SET(pChannel->socketId, &readFds);
+		selectTime.tv_sec = 0;
+		selectTime.tv_usec = 100000;
+		select(FD_SETSIZE, &readFds, NULL, NULL, &selectTime);
+	}
+}
+
+static RsslChannel *connectChannel()
+{
+	RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+	RsslInProgInfo inProg = RSSL_INIT_IN_PROG_INFO;
+	RsslChannel *pChannel;
+	RsslError error;
+	RsslRet ret;
+
+	connectOpts.protocolType = capture.protocolType;
+	connectOpts.majorVersion = capture.majorVersion;
+	connectOpts.minorVersion = capture.minorVersion;
+	connectOpts.sysRecvBufSize = recvBufSize;
+
+	if (replayType == REPLAY_SEQ_MCAST)
+	{
+		connectOpts.connectionType = RSSL_CONN_TYPE_SEQ_MCAST;
+		connectOpts.connectionInfo.segmented.recvAddress = groupAddress;
+		connectOpts.connectionInfo.segmented.recvServiceName = servicePort;
+		connectOpts.connectionInfo.segmented.interfaceName = interfaceName;
+		connectOpts.seqMulticastOpts.maxMsgSize = 65493;
+		connectOpts.seqMulticastOpts.readBatchSize = readBatchSize;
+	}
+	else
+	{
+		connectOpts.connectionType = RSSL_CONN_TYPE_SOCKET;
+		connectOpts.connectionInfo.unified.address = "localhost";
+		connectOpts.connectionInfo.unified.serviceName = servicePort;
+	}
+
+	if (!(pChannel = rsslConnect(&connectOpts, &error)))
+	{
+		printf("Error: rsslConnect() failed: %s (%d)\n", error.text, error.rsslErrorId);
+		exit(-1);
+	}
+
+	while (pChannel->state != RSSL_CH_STATE_ACTIVE)
+	{
+		if ((ret = rsslInitChannel(pChannel, &inProg, &error)) < RSSL_RET_SUCCESS)
+		{
+			printf("Error: rsslInitChannel() failed: %s (%d)\n", error.text, error.rsslErrorId);
+			exit(-1);
+		}
+	}
+
+	return pChannel;
+}
+
+static void bindServer()
+{
+	RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+	RsslError error;
+
+	bindOpts.serviceName = servicePort;
+	bindOpts.interfaceName = "localhost";
+	bindOpts.protocolType = capture.protocolType;
+	bindOpts.majorVersion = capture.majorVersion;
+	bindOpts.minorVersion = capture.minorVersion;
+	bindOpts.guaranteedOutputBuffers = 5000;
+	bindOpts.sysSendBufSize = recvBufSize;
+
+	if (!(pServer = rsslBind(&bindOpts, &error)))
+	{
+		printf("Error: rsslBind() failed: %s (%d)\n", error.text, error.rsslErrorId);
+		exit(-1);
+	}
+}
+
+static void printResults(FILE *file, RsslUInt64 replayNsec)
+{
+	double readSec = (double)readStats.readNsec / 1000000000.0;
+	double decodeSec = (double)readStats.decodeNsec / 1000000000.0;
+	double wallSec = (double)(readStats.lastMsgTime - readStats.firstMsgTime) / 1000000000.0;
+
+	fprintf(file, "\n--- REPLAY SUMMARY ---\n\n");
+	fprintf(file, "Replayed %llu %s in %.3f sec (%.0f per sec), capture spans %.3f sec\n",
+			(unsigned long long)recordsSent, replayType == REPLAY_SEQ_MCAST ? "datagrams" : "messages",
+			(double)replayNsec / 1000000000.0, replayNsec ? (double)recordsSent * 1000000000.0 / (double)replayNsec : 0.0,
+			(double)capture.records[capture.recordCount - 1].timeNsec * repeatCount / 1000000000.0);
+
+	if (replayType == REPLAY_SEQ_MCAST)
+		fprintf(file, "Datagrams read: %llu (%llu pings), lost: %lld, gaps detected: %llu\n",
+				(unsigned long long)readStats.datagramsRead, (unsigned long long)readStats.pings,
+				(long long)(recordsSent - readStats.datagramsRead), (unsigned long long)readStats.gapsDetected);
+
+	fprintf(file, "Messages read: %llu, bytes read: %llu, decode errors: %llu\n",
+			(unsigned long long)readStats.msgs, (unsigned long long)readStats.bytes, (unsigned long long)readStats.decodeErrors);
+
+	if (!readStats.msgs)
+		return;
+
+	fprintf(file, "rsslRead():      %8.1f nsec/msg  %12.0f msgs/sec\n",
+			(double)readStats.readNsec / readStats.msgs, readSec > 0 ? readStats.msgs / readSec : 0.0);
+	fprintf(file, "%-16s %8.1f nsec/msg  %12.0f msgs/sec\n", decodePayload ? "Decode (payload):" : "rsslDecodeMsg():",
+			(double)readStats.decodeNsec / readStats.msgs, decodeSec > 0 ? readStats.msgs / decodeSec : 0.0);
+	fprintf(file, "Read and decode: %8.1f nsec/msg  %12.0f msgs/sec\n",
+			(double)(readStats.readNsec + readStats.decodeNsec) / readStats.msgs,
+			readSec + decodeSec > 0 ? readStats.msgs / (readSec + decodeSec) : 0.0);
+	fprintf(file, "First to last message: %.3f sec, %.0f msgs/sec, %.3f MB/sec\n",
+			wallSec, wallSec > 0 ? readStats.msgs / wallSec : 0.0, wallSec > 0 ? readStats.bytes / wallSec / 1048576.0 : 0.0);
+}
+
+/* Appends the results as a line of comma separated values, for tracking them across builds. */
+static void writeStatsFile(RsslUInt64 replayNsec)
+{
+	FILE *file;
+	long fileLength;
+
+	if (!(file = fopen(statsFile, "a")))
+	{
+		printf("Error: Could not open stats file %s.\n", statsFile);
+		return;
+	}
+
+	fseek(file, 0, SEEK_END);
+	fileLength = ftell(file);
+	if (fileLength == 0)
+		fprintf(file, "Type, Capture, Speed, Repeat, Read Batch, Decode Payload, Replayed, Replay Sec, "
+				"Msgs Read, Bytes Read, Lost Datagrams, Decode Errors, Read nsec/msg, Decode nsec/msg, Read and Decode msgs/sec\n");
+
+	fprintf(file, "%s, %s, %g, %u, %u, %s, %llu, %.3f, %llu, %llu, %lld, %llu, %.1f, %.1f, %.0f\n",
+			replayType == REPLAY_SEQ_MCAST ? "seqMcast" : "socket", pcapFile ? pcapFile : ripcStreamFile,
+			speed, repeatCount, readBatchSize, decodePayload ? "yes" : "no",
+			(unsigned long long)recordsSent, (double)replayNsec / 1000000000.0,
+			(unsigned long long)readStats.msgs, (unsigned long long)readStats.bytes,
+			replayType == REPLAY_SEQ_MCAST ? (long long)(recordsSent - readStats.datagramsRead) : 0LL,
+			(unsigned long long)readStats.decodeErrors,
+			readStats.msgs ? (double)readStats.readNsec / readStats.msgs : 0.0,
+			readStats.msgs ? (double)readStats.decodeNsec / readStats.msgs : 0.0,
+			readStats.readNsec + readStats.decodeNsec ? readStats.msgs * 1000000000.0 / (double)(readStats.readNsec + readStats.decodeNsec) : 0.0);
+
+	fclose(file);
+}
+
+int main(int argc, char **argv)
+{
+	int iargs;
+	RsslError error;
+	RsslChannel *pChannel;
+	RsslChannelInfo channelInfo;
+	RsslThreadId replayThreadId;
+	RsslUInt32 ioctlValue;
+	int ret;
+
+	for (iargs = 1; iargs < argc; ++iargs)
+	{
+		if (0 == strcmp("-?", argv[iargs]))
+			exitWithUsage();
+		else if (0 == strcmp("-seqMcast", argv[iargs]))
+			replayType = REPLAY_SEQ_MCAST;
+		else if (0 == strcmp("-socket", argv[iargs]))
+			replayType = REPLAY_SOCKET;
+		else if (0 == strcmp("-pcap", argv[iargs]) && iargs + 1 < argc)
+			pcapFile = argv[++iargs];
+		else if (0 == strcmp("-ripcStream", argv[iargs]) && iargs + 1 < argc)
+			ripcStreamFile = argv[++iargs];
+		else if (0 == strcmp("-capturePort", argv[iargs]) && iargs + 1 < argc)
+			filter.port = (RsslUInt16)atoi(argv[++iargs]);
+		else if (0 == strcmp("-captureGroup", argv[iargs]) && iargs + 1 < argc)
+			filter.address = ntohl(inet_addr(argv[++iargs]));
+		else if (0 == strcmp("-speed", argv[iargs]) && iargs + 1 < argc)
+		{
+			++iargs;
+			if (0 == strcmp("original", argv[iargs]))
+				speed = 1.0;
+			else if (0 == strcmp("max", argv[iargs]))
+				speed = 0;
+			else if ((speed = atof(argv[iargs])) <= 0)
+			{
+				printf("Config Error: -speed must be original, max, or a positive rate.\n");
+				exitWithUsage();
+			}
+		}
+		else if (0 == strcmp("-repeat", argv[iargs]) && iargs + 1 < argc)
+			repeatCount = (RsslUInt32)atoi(argv[++iargs]);
+		else if (0 == strcmp("-group", argv[iargs]) && iargs + 1 < argc)
+			snprintf(groupAddress, sizeof(groupAddress), "%s", argv[++iargs]);
+		else if (0 == strcmp("-port", argv[iargs]) && iargs + 1 < argc)
+			snprintf(servicePort, sizeof(servicePort), "%s", argv[++iargs]);
+		else if (0 == strcmp("-if", argv[iargs]) && iargs + 1 < argc)
+			snprintf(interfaceName, sizeof(interfaceName), "%s", argv[++iargs]);
+		else if (0 == strcmp("-readBatchSize", argv[iargs]) && iargs + 1 < argc)
+			readBatchSize = (RsslUInt32)atoi(argv[++iargs]);
+		else if (0 == strcmp("-recvBufSize", argv[iargs]) && iargs + 1 < argc)
+			recvBufSize = (RsslUInt32)atoi(argv[++iargs]);
+		else if (0 == strcmp("-idleTimeout", argv[iargs]) && iargs + 1 < argc)
+			idleTimeoutMsec = (RsslUInt32)atoi(argv[++iargs]);
+		else if (0 == strcmp("-decodePayload", argv[iargs]))
+			decodePayload = RSSL_TRUE;
+		else if (0 == strcmp("-statsFile", argv[iargs]) && iargs + 1 < argc)
+			snprintf(statsFile, sizeof(statsFile), "%s", argv[++iargs]);
+		else
+		{
+			printf("Config Error: Unrecognized option: %s\n", argv[iargs]);
+			exitWithUsage();
+		}
+	}
+
+	if (replayType == REPLAY_NONE || repeatCount == 0 || (pcapFile == NULL) == (ripcStreamFile == NULL)
+			|| (replayType == REPLAY_SEQ_MCAST && ripcStreamFile))
+		exitWithUsage();
+
+	if (replayType == REPLAY_SEQ_MCAST)
+		ret = replayLoadMcastPcap(&capture, pcapFile, &filter);
+	else if (pcapFile)
+		ret = replayLoadSocketPcap(&capture, pcapFile, &filter);
+	else
+		ret = replayLoadRipcStream(&capture, ripcStreamFile);
+
+	if (ret < 0)
+		exit(-1);
+
+	printf("Loaded %u %s (%llu bytes).\n", capture.recordCount, replayType == REPLAY_SEQ_MCAST ? "datagrams" : "messages",
+			(unsigned long long)capture.dataSize);
+	if (capture.otherPackets || capture.ipFragments || capture.truncatedPackets || capture.compressedMsgs)
+		printf("Skipped %u other packets, %u IP-fragmented datagrams, %u truncated packets, %u compressed messages.\n",
+				capture.otherPackets, capture.ipFragments, capture.truncatedPackets, capture.compressedMsgs);
+
+	if (!capture.recordCount)
+	{
+		printf("Error: Nothing to replay.\n");
+		exit(-1);
+	}
+
+	if (!capture.hasTimestamps && speed > 0)
+	{
+		printf("The capture has no timestamps; replaying as fast as possible.\n");
+		speed = 0;
+	}
+
+	if (rsslInitialize(RSSL_LOCK_GLOBAL, &error) != RSSL_RET_SUCCESS)
+	{
+		printf("Error: rsslInitialize() failed: %s\n", error.text);
+		exit(-1);
+	}
+
+	/* The server accepts the connection, and starts replaying once it is up.  Multicast
+	 * replay starts once the channel has joined the group. */
+	if (replayType == REPLAY_SOCKET)
+	{
+		bindServer();
+		if (!CHECK(RSSL_THREAD_START(&replayThreadId, runSocketReplay, NULL) >= 0))
+			exit(-1);
+	}
+
+	pChannel = connectChannel();
+
+	if (replayType == REPLAY_SEQ_MCAST)
+	{
+		ioctlValue = recvBufSize;
+		rsslIoctl(pChannel, RSSL_SYSTEM_READ_BUFFERS, &ioctlValue, &error);
+		if (!CHECK(RSSL_THREAD_START(&replayThreadId, runMcastReplay, NULL) >= 0))
+			exit(-1);
+	}
+
+	printf("Replaying %u time%s at %s.\n", repeatCount, repeatCount == 1 ? "" : "s",
+			speed == 0 ? "maximum speed" : speed == 1.0 ? "the captured rate" : "a scaled rate");
+
+	readChannel(pChannel);
+
+	if (replayType == REPLAY_SEQ_MCAST && rsslGetChannelInfo(pChannel, &channelInfo, &error) == RSSL_RET_SUCCESS)
+	{
+		readStats.datagramsRead = channelInfo.multicastStats.mcastRcvd;
+		readStats.gapsDetected = channelInfo.multicastStats.gapsDetected;
+	}
+
+	rsslCloseChannel(pChannel, &error);
+	RSSL_THREAD_JOIN(replayThreadId);
+
+	if (pServer)
+		rsslCloseServer(pServer, &error);
+
+	printResults(stdout, replayEndTime - replayStartTime);
+	if (statsFile[0])
+		writeStatsFile(replayEndTime - replayStartTime);
+
+	replayFreeCapture(&capture);
+	rsslUninitialize();
+	return 0;
+}
@@ -42,11 +42,13 @@ static void clearTransportPerfConfig()
 	transportPerfConfig.recvBufSize = 0;
 	transportPerfConfig.compressionType = RSSL_COMP_NONE;
 	transportPerfConfig.compressionLevel = 5;
+	snprintf(transportPerfConfig.compressionDictionary, sizeof(transportPerfConfig.compressionDictionary), "");
 	transportPerfConfig.highWaterMark = 0;
 	snprintf(transportPerfConfig.interfaceName, sizeof(transportPerfConfig.interfaceName), "");
 	snprintf(transportPerfConfig.hostName, sizeof(transportPerfConfig.hostName), "%s", "localhost");
 	snprintf(transportPerfConfig.portNo, sizeof(transportPerfConfig.portNo), "%s", "14002");
 	transportPerfConfig.tcpNoDelay = RSSL_TRUE;
+	transportPerfConfig.ioUring = RSSL_FALSE;
 	snprintf(transportPerfConfig.sendAddr, sizeof(transportPerfConfig.sendAddr), "");
 	snprintf(transportPerfConfig.recvAddr, sizeof(transportPerfConfig.recvAddr), "");
 	snprintf(transportPerfConfig.sendPort, sizeof(transportPerfConfig.sendPort), "");
@@ -169,6 +171,8 @@ void initTransportPerfConfig(int argc, char **argv)
 				transportPerfConfig.connectionType = RSSL_CONN_TYPE_RELIABLE_MCAST;
 			else if (0 == strcmp(argv[iargs], "shmem"))
 				transportPerfConfig.connectionType = RSSL_CONN_TYPE_UNIDIR_SHMEM;
+			else if (0 == strcmp(argv[iargs], "bidirShmem"))
+				transportPerfConfig.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
 			else if(0 == strcmp(argv[iargs], "seqMCast"))
 				transportPerfConfig.connectionType = RSSL_CONN_TYPE_SEQ_MCAST;
 			else
@@ -260,6 +264,8 @@ void initTransportPerfConfig(int argc, char **argv)
 				transportPerfConfig.compressionType = RSSL_COMP_ZLIB;
 			else if (0 == strcmp(argv[iargs], "lz4"))
 				transportPerfConfig.compressionType = RSSL_COMP_LZ4;
+			else if (0 == strcmp(argv[iargs], "zstd"))
+				transportPerfConfig.compressionType = RSSL_COMP_ZSTD;
 			else
 			{
 				/* Read it as a number. */
@@ -276,6 +282,11 @@ void initTransportPerfConfig(int argc, char **argv)
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
 			sscanf(argv[iargs], "%u", &transportPerfConfig.compressionLevel);
 		}
+		else if (0 == strcmp("-compressionDictionary", argv[iargs]))
+		{
+			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
+			snprintf(transportPerfConfig.compressionDictionary, sizeof(transportPerfConfig.compressionDictionary), "%s", argv[iargs]);
+		}
 		else if (0 == strcmp("-if", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -322,6 +333,10 @@ void initTransportPerfConfig(int argc, char **argv)
 		{
 			transportPerfConfig.tcpNoDelay = RSSL_FALSE;
 		}
+		else if (0 == strcmp("-ioUring", argv[iargs]))
+		{
+			transportPerfConfig.ioUring = RSSL_TRUE;
+		}
 		else if (0 == strcmp("-msgRate", argv[iargs]))
 		{
 			++iargs; if (iargs == argc) exitMissingArgument(argv, iargs - 1);
@@ -426,7 +441,7 @@ void initTransportPerfConfig(int argc, char **argv)
 
 	if (transportPerfConfig.connectionType == RSSL_CONN_TYPE_INIT)
 	{
-		printf("Config Error: Unknown connectionType. Valid types are \"socket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"seqMCast\" \n");
+		printf("Config Error: Unknown connectionType. Valid types are \"socket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"bidirShmem\", \"seqMCast\" \n");
 		exitConfigError(argv);
 	} 
 
@@ -456,6 +471,8 @@ static const char *connectionTypeToString(RsslConnectionTypes connType)
 			return "reliableMCast";
 		case RSSL_CONN_TYPE_UNIDIR_SHMEM:
 			return "shmem";
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
+			return "bidirShmem";
 		case RSSL_CONN_TYPE_SEQ_MCAST:
 			return "seqMCast";
 		default:
@@ -474,6 +491,8 @@ const char *compressionTypeToString(RsslCompTypes compType)
 			return "zlib";
 		case RSSL_COMP_LZ4:
 			return "lz4";
+		case RSSL_COMP_ZSTD:
+			return "zstd";
 		default:
 			return "unknown";
 	}
@@ -556,8 +575,10 @@ void printTransportPerfConfig(FILE *file)
 			"       High Water Mark: %u%s\n"
 			"      Compression Type: %s(%u)\n"
 			"     Compression Level: %u\n"
+			"Compression Dictionary: %s\n"
 			"        Interface Name: %s\n"
 			"           Tcp_NoDelay: %s\n"
+			"              io_uring: %s\n"
 			"             Tick Rate: %u\n"
 			"     Use Direct Writes: %s\n"
 			"      Latency Log File: %s\n"
@@ -581,8 +602,10 @@ void printTransportPerfConfig(FILE *file)
 			compressionTypeToString(transportPerfConfig.compressionType),
 			transportPerfConfig.compressionType,
 			transportPerfConfig.compressionLevel,
+			strlen(transportPerfConfig.compressionDictionary) ? transportPerfConfig.compressionDictionary : "(none)",
 			strlen(transportPerfConfig.interfaceName) ? transportPerfConfig.interfaceName : "(use default)",
 			(transportPerfConfig.tcpNoDelay ? "Yes" : "No"),
+			(transportPerfConfig.ioUring ? "Yes" : "No"),
 			transportThreadConfig.ticksPerSec,
 			(transportThreadConfig.writeFlags & RSSL_WRITE_DIRECT_SOCKET_WRITE) ? "Yes" : "No",
 			transportThreadConfig.logLatencyToFile ? transportThreadConfig.latencyLogFilename : "(none)",
@@ -622,7 +645,7 @@ void exitWithUsage()
 			"  -appType <type>            Type of application(server, client)\n"
 			"\n"
 			"  -connType <type>           Type of connection:\n"
-			"                                   (\"socket\",\"websocket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"seqMCast\")\n"
+			"                                   (\"socket\",\"websocket\", \"http\", \"encrypted\", \"reliableMCast\", \"shmem\", \"bidirShmem\", \"seqMCast\")\n"
 			"  -encryptedConnType <type>  Encrypted connection protocol for a client connection only. Only used if the \"encrypted\" connection\n"
 			"                             type is selected. \"http\" type is only supported on Windows. (\"socket\",\"websocket\", \"http\")\n"
 			"\n"
@@ -636,10 +659,14 @@ void exitWithUsage()
 			"  -sendBufSize <size>        System Send Buffer Size(configures sysSendBufSize in the RSSL bind/connection options)\n"
 			"  -recvBufSize <size>        System Receive Buffer Size(configures sysRecvBufSize in the RSSL bind/connection options)\n"
 			"  -highWaterMark <bytes>     Number of queued bytes at which rsslWrite() internally flushes.\n"
-			"  -compressionType <type>    Type of compression to use(\"none\", \"zlib\", \"lz4\")\n"
+			"  -compressionType <type>    Type of compression to use(\"none\", \"zlib\", \"lz4\", \"zstd\")\n"
 			"  -compressionLevel <num>    Level of compression.\n"
+			"  -compressionDictionary <filename>\n"
+			"                             Dictionary for zstd compression, such as one made by ZstdDictTrainer.\n"
+			"                             Both sides must use the same dictionary.\n"
 			"  -if <interface name>       Name of network interface to use\n"
 			"  -tcpDelay                  Turns off tcp_nodelay in RsslBindOpts, enabling Nagle's\n"
+			"  -ioUring                   Moves socket and websocket channels onto io_uring once active, one ring per thread(Linux only).\n"
 			"\n"
 			"  -tickRate <ticks/sec>      Ticks per second\n"
 			"  -msgRate <msgs/second>     Message rate per second\n"
@@ -42,6 +42,7 @@ typedef struct
 	char 				portNo[32];					/* Port number. See -p */
 	char				interfaceName[128];			/* Name of interface.  See -if */
 	RsslBool			tcpNoDelay;					/* Enable/Disable Nagle's algorithm. See -tcpDelay */
+	RsslBool			ioUring;					/* Move socket channels onto io_uring. See -ioUring */
 	RsslUInt32			guaranteedOutputBuffers;	/* Guaranteed Output Buffers. See -outputBufs */
 	RsslUInt32			maxFragmentSize;			/* Maximum Fragment Size. See -maxFragmentSize */
 	RsslUInt32			sendBufSize;				/* System Send Buffer Size(-sendBufSize) */
@@ -54,6 +55,7 @@ typedef struct
 
 	RsslCompTypes		compressionType;			/* Type of compression to use, if any. */
 	int					compressionLevel;			/* Compression level, optional depending on compression algorithm used */
+	char				compressionDictionary[255];	/* File containing a zstd compression dictionary. See -compressionDictionary */
 	char				hostName[128];				/* hostName, if using rsslConnect(). See -hostname */
 	char				sendAddr[128];				/* Outbound address, if using a multicast connection. See -sa */
 	char				recvAddr[128];				/* Inbound address, if using a multicast connection. See -ra */
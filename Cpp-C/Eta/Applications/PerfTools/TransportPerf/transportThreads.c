@@ -105,6 +105,7 @@ void transportThreadInit(TransportThread *pThread,
 
 	initCountStat(&pThread->msgsSent);
 	initCountStat(&pThread->bytesSent);
+	initCountStat(&pThread->uncompBytesSent);
 	initCountStat(&pThread->msgsReceived);
 	initCountStat(&pThread->bytesReceived);
 	initCountStat(&pThread->outOfBuffersCount);
@@ -333,6 +334,7 @@ RsslRet writeMsgBuffer(TransportThread *pHandler, TransportSession *pSession, Rs
 		{
 			pSession->pWritingBuffer = 0;
 			countStatAdd(&pHandler->bytesSent, outBytes);
+			countStatAdd(&pHandler->uncompBytesSent, uncompOutBytes);
 			countStatIncr(&pHandler->msgsSent);
 			return ret;
 		}
@@ -344,6 +346,7 @@ RsslRet writeMsgBuffer(TransportThread *pHandler, TransportSession *pSession, Rs
 				{
 					pSession->pWritingBuffer = 0;
 					countStatAdd(&pHandler->bytesSent, outBytes);
+					countStatAdd(&pHandler->uncompBytesSent, uncompOutBytes);
 					countStatIncr(&pHandler->msgsSent);
 					return 1;
 				}
@@ -87,6 +87,7 @@ typedef struct
 	RsslTimeValue				disconnectTime; 	/* Time of last disconnection. */
 	CountStat				msgsSent;			/* Total messages sent. */
 	CountStat				bytesSent;			/* Total bytes sent(counting any compression) */
+	CountStat				uncompBytesSent;	/* Total bytes sent, before any compression */
 	CountStat				msgsReceived;		/* Total messages received. */
 	CountStat				bytesReceived;		/* Total bytes received. */
 	CountStat				outOfBuffersCount;	/* Messages not sent for lack of output buffers. */
@@ -53,6 +53,7 @@ static RsslUInt32 currentRuntimeSec = 0, intervalSeconds = 0;
 
 RsslUInt64 totalMsgSentCount = 0;
 RsslUInt64 totalBytesSent = 0;
+RsslUInt64 totalUncompBytesSent = 0;
 RsslUInt64 totalMsgReceivedCount = 0;
 RsslUInt64 totalBytesReceived = 0;
 
@@ -71,6 +72,7 @@ static void signal_handler(int sig)
 
 
 static void printSummaryStats(FILE *file);
+static RsslRet loadCompressionDictionary(const char *filename);
 
 #define _BUFFER_DUMP(__buf, __len)\
 	   { int i=0; fprintf(stderr, "%15s (%u) : '", "Buffer Hex Dump", __len);\
@@ -211,6 +213,7 @@ RsslRet processMsgReflect(ChannelHandler *pChanHandler, ChannelInfo *pChannelInf
 	if (ret >= RSSL_RET_SUCCESS)
 	{
 		countStatAdd(&pHandler->transportThread.bytesSent, outBytes);
+		countStatAdd(&pHandler->transportThread.uncompBytesSent, uncompOutBytes);
 		countStatIncr(&pHandler->transportThread.msgsSent);
 		if(ret > 0)
 			channelHandlerRequestFlush(pChanHandler, pSession->pChannelInfo);
@@ -223,6 +226,7 @@ RsslRet processMsgReflect(ChannelHandler *pChanHandler, ChannelInfo *pChannelInf
 			if (chnl->state == RSSL_CH_STATE_ACTIVE)
 			{
 				countStatAdd(&pHandler->transportThread.bytesSent, outBytes);
+				countStatAdd(&pHandler->transportThread.uncompBytesSent, uncompOutBytes);
 				countStatIncr(&pHandler->transportThread.msgsSent);
 				channelHandlerRequestFlush(pChanHandler, pSession->pChannelInfo);
 				return 1;
@@ -482,6 +486,8 @@ RSSL_THREAD_DECLARE(runConnectionHandler, pArg)
 					pChannelInfo = RSSL_QUEUE_LINK_TO_OBJECT(ChannelInfo, queueLink, pLink);
 					channelHandlerInitializeChannel(&pTransportThread->channelHandler, pChannelInfo);
 				}
+
+				channelHandlerSubmit(&pTransportThread->channelHandler);
 			}
 
 
@@ -520,6 +526,13 @@ RSSL_THREAD_DECLARE(runConnectionHandler, pArg)
 		channelHandlerCloseChannel(&pTransportThread->channelHandler, pChannelInfo, NULL);
 	}
 
+	if (pTransportThread->channelHandler.pIoUring)
+	{
+		RsslError error;
+		rsslDestroyIoUring(pTransportThread->channelHandler.pIoUring, &error);
+		pTransportThread->channelHandler.pIoUring = NULL;
+	}
+
 	return RSSL_THREAD_RETURN();
 }
 #ifdef __cplusplus
@@ -576,6 +589,10 @@ int main(int argc, char **argv)
 		printf("RsslInitialize failed: %s\n", error.text);
 		exit(-1);
 	}
+
+	if (strlen(transportPerfConfig.compressionDictionary) && loadCompressionDictionary(transportPerfConfig.compressionDictionary) != RSSL_RET_SUCCESS)
+		exit(-1);
+
 	/* Initialize run-time */
 	initRuntime();
 
@@ -604,6 +621,10 @@ int main(int argc, char **argv)
 
 		sessionHandlerList[i].transportThread.channelHandler.pUserSpec = &sessionHandlerList[i];
 
+		/* Each thread's channels share one io_uring, so a tick's writes go out in one system call. */
+		if (transportPerfConfig.ioUring)
+			sessionHandlerList[i].transportThread.channelHandler.pIoUring = rsslCreateIoUring(&error);
+
 			
 		
 		if (!CHECK(RSSL_THREAD_START(&sessionHandlerList[i].threadId, runConnectionHandler, &sessionHandlerList[i]) >= 0))
@@ -789,6 +810,7 @@ void collectStats(RsslBool writeStats, RsslBool displayStats, RsslUInt32 current
 
 		totalMsgSentCount += intervalMsgSentCount;
 		totalBytesSent += intervalBytesSent;
+		totalUncompBytesSent += countStatGetChange(&sessionHandlerList[i].transportThread.uncompBytesSent);
 		totalMsgReceivedCount += intervalMsgReceivedCount;
 		totalBytesReceived += intervalBytesReceived;
 
@@ -900,6 +922,7 @@ static RsslServer* bindRsslServer(RsslError* error)
 	sopts.minorVersion = 0;
 	sopts.protocolType = TEST_PROTOCOL_TYPE;
 	sopts.tcp_nodelay = transportPerfConfig.tcpNoDelay;
+	sopts.tcpOpts.io_uring = transportPerfConfig.ioUring;
 	sopts.connectionType = transportPerfConfig.connectionType;
 	sopts.maxFragmentSize = transportPerfConfig.maxFragmentSize;
 	sopts.compressionType = transportPerfConfig.compressionType;
@@ -997,6 +1020,7 @@ static RsslChannel* startConnection()
 	copts.protocolType = TEST_PROTOCOL_TYPE;
 	copts.connectionType = transportPerfConfig.connectionType;
 	copts.tcp_nodelay = transportPerfConfig.tcpNoDelay;
+	copts.tcpOpts.io_uring = transportPerfConfig.ioUring;
 	copts.compressionType = transportPerfConfig.compressionType;
 	if (transportPerfConfig.connectionType == RSSL_CONN_TYPE_ENCRYPTED)
 	{
@@ -1096,6 +1120,39 @@ void cleanUpAndExit()
 	exit(0);
 }
 
+/* Reads a dictionary file and sets it as the zstd compression dictionary. */
+static RsslRet loadCompressionDictionary(const char *filename)
+{
+	FILE *dictFile;
+	RsslBuffer dictionary;
+	RsslError error;
+	long fileSize;
+	RsslRet ret;
+
+	if (!(dictFile = fopen(filename, "rb")))
+	{
+		printf("Error: Could not open compression dictionary file %s.\n", filename);
+		return RSSL_RET_FAILURE;
+	}
+
+	fseek(dictFile, 0, SEEK_END);
+	fileSize = ftell(dictFile);
+	fseek(dictFile, 0, SEEK_SET);
+
+	dictionary.data = (char*)malloc(fileSize > 0 ? fileSize : 1);
+	assert(dictionary.data);
+	dictionary.length = (RsslUInt32)fread(dictionary.data, 1, fileSize > 0 ? fileSize : 0, dictFile);
+	fclose(dictFile);
+
+	if ((ret = rsslSetCompressionDictionary(&dictionary, &error)) != RSSL_RET_SUCCESS)
+		printf("rsslSetCompressionDictionary() failed: %s\n", error.text);
+	else
+		printf("Using compression dictionary %s (%u bytes).\n", filename, dictionary.length);
+
+	free(dictionary.data);
+	return ret;
+}
+
 static void printSummaryStats(FILE *file)
 {
 	RsslInt32 i;
@@ -1232,5 +1289,14 @@ static void printSummaryStats(FILE *file)
 	else
 		printf("No CPU/Mem statistics taken.\n\n");
 
+	/* For comparing compression types: how much each one saves, and what it costs in CPU time per message handled */
+	if (transportPerfConfig.compressionType != RSSL_COMP_NONE && totalBytesSent)
+		fprintf(file, "  Compression ratio (uncompressed/sent): %.2f\n",
+				(double)totalUncompBytesSent / (double)totalBytesSent);
+
+	if (cpuUsageStats.count && (totalMsgSentCount + totalMsgReceivedCount))
+		fprintf(file, "  CPU time per msg sent or received (usec): %.3f\n",
+				cpuUsageStats.average * connectedTime * 1000000.0 / (double)(totalMsgSentCount + totalMsgReceivedCount));
+
 	fprintf(file, "  Process ID: %d\n", getpid());
 }
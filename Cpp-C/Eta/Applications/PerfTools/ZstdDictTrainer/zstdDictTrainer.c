@@ -0,0 +1,258 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's 
+ * LICENSE.md for details. 
+ * Copyright (C) 2020 Refinitiv. All rights reserved.
+*/
+
+/*
+ * ZstdDictTrainer trains a dictionary for RSSL_COMP_ZSTD compression from
+ * captured RWF messages, and reports how well the captured messages compress
+ * with and without it.  See the readme for the capture file format.
+ */
+
+#include "rtr/rsslGetTime.h"
+#include "zstd.h"
+#include "zdict.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define MAX_INPUT_FILES 64
+
+static char *inputFiles[MAX_INPUT_FILES];
+static int inputFileCount = 0;
+static char outputFile[255] = "rwf.zdict";
+static size_t dictionarySize = 16384;
+static int compressionLevel = 5;
+static int evaluateEvery = 10;
+
+/* Captured messages, stored back to back. */
+static char *samples = NULL;
+static size_t samplesSize = 0, samplesCapacity = 0;
+static size_t *sampleSizes = NULL;
+static unsigned sampleCount = 0, sampleSizesCapacity = 0;
+
+static void exitWithUsage()
+{
+	printf(	"Usage: ZstdDictTrainer [options] <capture file> [<capture file> ...]\n"
+			"Options:\n"
+			"  -?                         Shows this usage\n"
+			"  -o <filename>              Name of the dictionary file to write (default rwf.zdict)\n"
+			"  -size <bytes>              Maximum size of the dictionary (default 16384)\n"
+			"  -level <num>               Compression level used to compare results, 1 to 9 (default 5)\n"
+			"  -evaluateEvery <count>     Holds back every count'th message from training, to compare\n"
+			"                             results on messages the dictionary has not seen (default 10, 0 uses all)\n"
+			"\n"
+			"Each capture file holds RWF messages, each preceded by its length as a\n"
+			"4-byte big-endian integer.\n");
+	exit(-1);
+}
+
+static void addSample(const char *data, size_t length)
+{
+	while (samplesSize + length > samplesCapacity)
+	{
+		samplesCapacity = samplesCapacity ? samplesCapacity * 2 : 1048576;
+		samples = (char*)realloc(samples, samplesCapacity);
+		assert(samples);
+	}
+
+	if (sampleCount == sampleSizesCapacity)
+	{
+		sampleSizesCapacity = sampleSizesCapacity ? sampleSizesCapacity * 2 : 4096;
+		sampleSizes = (size_t*)realloc(sampleSizes, sampleSizesCapacity * sizeof(size_t));
+		assert(sampleSizes);
+	}
+
+	memcpy(samples + samplesSize, data, length);
+	samplesSize += length;
+	sampleSizes[sampleCount++] = length;
+}
+
+static int readCaptureFile(const char *filename)
+{
+	FILE *file;
+	unsigned char lengthBytes[4];
+	char *message = NULL;
+	size_t messageCapacity = 0, length;
+	unsigned count = 0;
+
+	if (!(file = fopen(filename, "rb")))
+	{
+		printf("Error: Could not open capture file %s.\n", filename);
+		return -1;
+	}
+
+	while (fread(lengthBytes, 1, 4, file) == 4)
+	{
+		length = ((size_t)lengthBytes[0] << 24) | ((size_t)lengthBytes[1] << 16) | ((size_t)lengthBytes[2] << 8) | lengthBytes[3];
+
+		if (length > messageCapacity)
+		{
+			messageCapacity = length;
+			message = (char*)realloc(message, messageCapacity);
+			assert(message);
+		}
+
+		if (fread(message, 1, length, file) != length)
+		{
+			printf("Warning: %s ends in the middle of a message; ignoring it.\n", filename);
+			break;
+		}
+
+		if (length)
+		{
+			addSample(message, length);
+			++count;
+		}
+	}
+
+	printf("Read %u messages from %s.\n", count, filename);
+
+	free(message);
+	fclose(file);
+	return 0;
+}
+
+/* Compresses each held back message on its own, as a channel using the dictionary would, and prints the results. */
+static void evaluate(const char *label, ZSTD_CCtx *cctx, ZSTD_CDict *cdict)
+{
+	char *compressed = (char*)malloc(ZSTD_compressBound(samplesSize));
+	size_t offset = 0, inBytes = 0, outBytes = 0, ret;
+	unsigned i, count = 0;
+	RsslUInt64 startTime, endTime;
+
+	assert(compressed);
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < sampleCount; offset += sampleSizes[i], ++i)
+	{
+		if (evaluateEvery && i % evaluateEvery != evaluateEvery - 1)
+			continue;
+
+		if (cdict)
+			ret = ZSTD_compress_usingCDict(cctx, compressed, ZSTD_compressBound(sampleSizes[i]), samples + offset, sampleSizes[i], cdict);
+		else
+			ret = ZSTD_compressCCtx(cctx, compressed, ZSTD_compressBound(sampleSizes[i]), samples + offset, sampleSizes[i], compressionLevel);
+
+		if (ZSTD_isError(ret))
+		{
+			printf("Error: compression failed: %s\n", ZSTD_getErrorName(ret));
+			break;
+		}
+
+		inBytes += sampleSizes[i];
+		outBytes += ret;
+		++count;
+	}
+	endTime = rsslGetTimeNano();
+
+	if (count)
+		printf("  %-20s %8u msgs  %12llu -> %12llu bytes  ratio %6.2f  %8.3f usec/msg\n",
+				label, count, (unsigned long long)inBytes, (unsigned long long)outBytes,
+				outBytes ? (double)inBytes / (double)outBytes : 0.0,
+				(double)(endTime - startTime) / 1000.0 / count);
+
+	free(compressed);
+}
+
+int main(int argc, char **argv)
+{
+	int iargs;
+	char *dictionary;
+	size_t dictionaryLength;
+	FILE *file;
+	ZSTD_CCtx *cctx;
+	ZSTD_CDict *cdict;
+	unsigned i, trainingCount = 0;
+	size_t offset = 0, trainingSize = 0;
+	char *trainingSamples;
+	size_t *trainingSizes;
+
+	for (iargs = 1; iargs < argc; ++iargs)
+	{
+		if (0 == strcmp("-?", argv[iargs]))
+			exitWithUsage();
+		else if (0 == strcmp("-o", argv[iargs]) && iargs + 1 < argc)
+			snprintf(outputFile, sizeof(outputFile), "%s", argv[++iargs]);
+		else if (0 == strcmp("-size", argv[iargs]) && iargs + 1 < argc)
+			dictionarySize = (size_t)strtoul(argv[++iargs], NULL, 10);
+		else if (0 == strcmp("-level", argv[iargs]) && iargs + 1 < argc)
+			compressionLevel = atoi(argv[++iargs]);
+		else if (0 == strcmp("-evaluateEvery", argv[iargs]) && iargs + 1 < argc)
+			evaluateEvery = atoi(argv[++iargs]);
+		else if (argv[iargs][0] == '-')
+		{
+			printf("Config Error: Unrecognized option: %s\n", argv[iargs]);
+			exitWithUsage();
+		}
+		else if (inputFileCount < MAX_INPUT_FILES)
+			inputFiles[inputFileCount++] = argv[iargs];
+	}
+
+	if (inputFileCount == 0 || dictionarySize < 256 || compressionLevel < 1 || compressionLevel > 9 || evaluateEvery < 0 || evaluateEvery == 1)
+		exitWithUsage();
+
+	for (iargs = 0; iargs < inputFileCount; ++iargs)
+	{
+		if (readCaptureFile(inputFiles[iargs]) != 0)
+			exit(-1);
+	}
+
+	/* Train on the messages that are not held back. */
+	trainingSamples = (char*)malloc(samplesSize ? samplesSize : 1);
+	trainingSizes = (size_t*)malloc((sampleCount ? sampleCount : 1) * sizeof(size_t));
+	assert(trainingSamples && trainingSizes);
+
+	for (i = 0; i < sampleCount; offset += sampleSizes[i], ++i)
+	{
+		if (evaluateEvery && i % evaluateEvery == evaluateEvery - 1)
+			continue;
+
+		memcpy(trainingSamples + trainingSize, samples + offset, sampleSizes[i]);
+		trainingSize += sampleSizes[i];
+		trainingSizes[trainingCount++] = sampleSizes[i];
+	}
+
+	printf("Training a %lu byte dictionary on %u messages (%lu bytes).\n", (unsigned long)dictionarySize, trainingCount, (unsigned long)trainingSize);
+
+	dictionary = (char*)malloc(dictionarySize);
+	assert(dictionary);
+
+	dictionaryLength = ZDICT_trainFromBuffer(dictionary, dictionarySize, trainingSamples, trainingSizes, trainingCount);
+	if (ZDICT_isError(dictionaryLength))
+	{
+		printf("Error: Training failed: %s\n", ZDICT_getErrorName(dictionaryLength));
+		printf("Training needs many small messages; try capturing more traffic or asking for a smaller dictionary.\n");
+		exit(-1);
+	}
+
+	if (!(file = fopen(outputFile, "wb")) || fwrite(dictionary, 1, dictionaryLength, file) != dictionaryLength)
+	{
+		printf("Error: Could not write dictionary file %s.\n", outputFile);
+		exit(-1);
+	}
+	fclose(file);
+
+	printf("Wrote %s: %lu bytes, dictionary id %u.\n\n", outputFile, (unsigned long)dictionaryLength, ZDICT_getDictID(dictionary, dictionaryLength));
+
+	cctx = ZSTD_createCCtx();
+	cdict = ZSTD_createCDict(dictionary, dictionaryLength, compressionLevel);
+	assert(cctx && cdict);
+
+	printf("Each %s message compressed on its own at level %d:\n", evaluateEvery ? "held back" : "captured", compressionLevel);
+	evaluate("without dictionary", cctx, NULL);
+	evaluate("with dictionary", cctx, cdict);
+
+	ZSTD_freeCDict(cdict);
+	ZSTD_freeCCtx(cctx);
+	free(dictionary);
+	free(trainingSizes);
+	free(trainingSamples);
+	free(sampleSizes);
+	free(samples);
+
+	return 0;
+}
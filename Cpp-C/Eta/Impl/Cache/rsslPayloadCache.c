@@ -0,0 +1,354 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/rsslPayloadCacheImpl.h"
+#include "rtr/rsslThread.h"
+
+/* Entries and map entries are allocated from per-cache slabs of this many objects. */
+#define RSSL_CACHE_ENTRIES_PER_SLAB 256
+#define RSSL_CACHE_MAP_ENTRIES_PER_SLAB 1024
+
+static RSSL_STATIC_MUTEX_DECL(cacheStaticMutex);
+
+static RsslUInt32 cacheInitCount = 0;
+static RsslQueue cacheList;
+static RsslQueue fieldDbList;
+
+static void _rsslPayloadCacheDestroy(RsslPayloadCacheImpl *pCache)
+{
+	RsslQueueLink *pLink;
+
+	while ((pLink = rsslQueuePeekFront(&pCache->entryList)))
+		rsslPayloadEntryImplDestroy(RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadEntryImpl, cacheLink, pLink));
+
+	rsslCachePoolCleanup(&pCache->entryPool);
+	rsslCachePoolCleanup(&pCache->mapEntryPool);
+	free(pCache->pScratch);
+	free(pCache);
+}
+
+static void _rsslCacheFieldDbDestroy(RsslCacheFieldDb *pFieldDb)
+{
+	free(pFieldDb->dictionaryKey);
+	free(pFieldDb->rwfTypes);
+	free(pFieldDb);
+}
+
+static RsslCacheFieldDb *_rsslCacheFieldDbFind(const char *dictionaryKey)
+{
+	RsslQueueLink *pLink;
+
+	RSSL_QUEUE_FOR_EACH_LINK(&fieldDbList, pLink)
+	{
+		RsslCacheFieldDb *pFieldDb = RSSL_QUEUE_LINK_TO_OBJECT(RsslCacheFieldDb, dbLink, pLink);
+		if (strcmp(pFieldDb->dictionaryKey, dictionaryKey) == 0)
+			return pFieldDb;
+	}
+
+	return NULL;
+}
+
+/* Adds the fields of the dictionary to the field database. If the database already has fields, the
+ * dictionary must be an extension of them: no field may be removed or change type. */
+static RsslRet _rsslCacheFieldDbSetDictionary(RsslCacheFieldDb *pFieldDb, const RsslDataDictionary *pDictionary, RsslCacheError *pError)
+{
+	RsslInt32 fid, minFid, maxFid;
+	RsslUInt8 *rwfTypes;
+
+	if (pFieldDb->rwfTypes)
+	{
+		for (fid = pFieldDb->minFid; fid <= pFieldDb->maxFid; ++fid)
+		{
+			RsslUInt8 rwfType = pFieldDb->rwfTypes[fid - pFieldDb->minFid];
+			RsslDictionaryEntry *pDictEntry;
+
+			if (rwfType == RSSL_DT_UNKNOWN)
+				continue;
+
+			pDictEntry = (fid >= pDictionary->minFid && fid <= pDictionary->maxFid) ? pDictionary->entriesArray[fid] : NULL;
+			if (!pDictEntry || pDictEntry->rwfType != rwfType)
+			{
+				RSSL_CACHE_SET_ERROR(pError, RSSL_RET_INVALID_DATA,
+						"Dictionary is not a valid extension of dictionary key %s: field %d was removed or changed type.",
+						pFieldDb->dictionaryKey, fid);
+				return RSSL_RET_INVALID_DATA;
+			}
+		}
+
+		minFid = pDictionary->minFid < pFieldDb->minFid ? pDictionary->minFid : pFieldDb->minFid;
+		maxFid = pDictionary->maxFid > pFieldDb->maxFid ? pDictionary->maxFid : pFieldDb->maxFid;
+	}
+	else
+	{
+		minFid = pDictionary->minFid;
+		maxFid = pDictionary->maxFid;
+	}
+
+	if (!(rwfTypes = (RsslUInt8*)calloc((size_t)(maxFid - minFid + 1), sizeof(RsslUInt8))))
+	{
+		RSSL_CACHE_SET_ERROR(pError, RSSL_RET_FAILURE, "Failed to allocate field database.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (pFieldDb->rwfTypes)
+		memcpy(rwfTypes + (pFieldDb->minFid - minFid), pFieldDb->rwfTypes, (size_t)(pFieldDb->maxFid - pFieldDb->minFid + 1));
+
+	for (fid = pDictionary->minFid; fid <= pDictionary->maxFid; ++fid)
+	{
+		if (pDictionary->entriesArray[fid])
+			rwfTypes[fid - minFid] = pDictionary->entriesArray[fid]->rwfType;
+	}
+
+	free(pFieldDb->rwfTypes);
+	pFieldDb->rwfTypes = rwfTypes;
+	pFieldDb->minFid = minFid;
+	pFieldDb->maxFid = maxFid;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheInitialize()
+{
+	RSSL_STATIC_MUTEX_LOCK(cacheStaticMutex);
+
+	if (cacheInitCount++ == 0)
+	{
+		rsslInitQueue(&cacheList);
+		rsslInitQueue(&fieldDbList);
+	}
+
+	RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API void rsslPayloadCacheUninitialize()
+{
+	RsslQueueLink *pLink;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheStaticMutex);
+
+	if (cacheInitCount > 0 && --cacheInitCount == 0)
+	{
+		while ((pLink = rsslQueueRemoveFirstLink(&cacheList)))
+			_rsslPayloadCacheDestroy(RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadCacheImpl, cacheLink, pLink));
+
+		while ((pLink = rsslQueueRemoveFirstLink(&fieldDbList)))
+			_rsslCacheFieldDbDestroy(RSSL_QUEUE_LINK_TO_OBJECT(RsslCacheFieldDb, dbLink, pLink));
+	}
+
+	RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+}
+
+RSSL_VA_API RsslBool rsslPayloadCacheIsInitialized()
+{
+	RsslBool initialized;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheStaticMutex);
+	initialized = (cacheInitCount > 0) ? RSSL_TRUE : RSSL_FALSE;
+	RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+
+	return initialized;
+}
+
+RSSL_VA_API RsslPayloadCacheHandle rsslPayloadCacheCreate(const RsslPayloadCacheConfigOptions* configOptions, RsslCacheError* error)
+{
+	RsslPayloadCacheImpl *pCache;
+
+	if (!configOptions)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_INVALID_ARGUMENT, "rsslPayloadCacheCreate() Error: configOptions is NULL.");
+		return NULL;
+	}
+
+	if (!(pCache = (RsslPayloadCacheImpl*)malloc(sizeof(RsslPayloadCacheImpl))))
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_FAILURE, "rsslPayloadCacheCreate() Error: Failed to allocate cache.");
+		return NULL;
+	}
+
+	memset(pCache, 0, sizeof(RsslPayloadCacheImpl));
+	pCache->config = *configOptions;
+	rsslInitQueueLink(&pCache->cacheLink);
+	rsslInitQueue(&pCache->entryList);
+	rsslCachePoolInit(&pCache->entryPool, sizeof(RsslPayloadEntryImpl), RSSL_CACHE_ENTRIES_PER_SLAB);
+	rsslCachePoolInit(&pCache->mapEntryPool, sizeof(RsslCacheMapEntry), RSSL_CACHE_MAP_ENTRIES_PER_SLAB);
+
+	RSSL_STATIC_MUTEX_LOCK(cacheStaticMutex);
+
+	if (cacheInitCount == 0)
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+		free(pCache);
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_INIT_NOT_INITIALIZED, "rsslPayloadCacheCreate() Error: Cache is not initialized.");
+		return NULL;
+	}
+
+	rsslQueueAddLinkToBack(&cacheList, &pCache->cacheLink);
+
+	RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+
+	return (RsslPayloadCacheHandle)pCache;
+}
+
+RSSL_VA_API void rsslPayloadCacheDestroy(RsslPayloadCacheHandle handle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)handle;
+
+	if (!pCache)
+		return;
+
+	RSSL_STATIC_MUTEX_LOCK(cacheStaticMutex);
+	if (rsslQueueLinkInAList(&pCache->cacheLink))
+		rsslQueueRemoveLink(&cacheList, &pCache->cacheLink);
+	RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+
+	_rsslPayloadCacheDestroy(pCache);
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheSetDictionary(RsslPayloadCacheHandle cacheHandle, const RsslDataDictionary *rsslDictionary,
+		const char* dictionaryKey, RsslCacheError* error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslCacheFieldDb *pFieldDb;
+	RsslRet ret;
+
+	if (!pCache || !rsslDictionary || !dictionaryKey)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_INVALID_ARGUMENT, "rsslPayloadCacheSetDictionary() Error: Invalid argument.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (!rsslDictionary->isInitialized || rsslDictionary->numberOfEntries == 0)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_INVALID_ARGUMENT, "rsslPayloadCacheSetDictionary() Error: Dictionary has no field definitions.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pCache->pFieldDb && strcmp(pCache->pFieldDb->dictionaryKey, dictionaryKey) != 0)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_FAILURE, "rsslPayloadCacheSetDictionary() Error: Cache already has dictionary key %s.",
+				pCache->pFieldDb->dictionaryKey);
+		return RSSL_RET_FAILURE;
+	}
+
+	RSSL_STATIC_MUTEX_LOCK(cacheStaticMutex);
+
+	if (!(pFieldDb = _rsslCacheFieldDbFind(dictionaryKey)))
+	{
+		if (!(pFieldDb = (RsslCacheFieldDb*)calloc(1, sizeof(RsslCacheFieldDb)))
+				|| !(pFieldDb->dictionaryKey = (char*)malloc(strlen(dictionaryKey) + 1)))
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+			free(pFieldDb);
+			RSSL_CACHE_SET_ERROR(error, RSSL_RET_FAILURE, "rsslPayloadCacheSetDictionary() Error: Failed to allocate field database.");
+			return RSSL_RET_FAILURE;
+		}
+
+		strcpy(pFieldDb->dictionaryKey, dictionaryKey);
+
+		if ((ret = _rsslCacheFieldDbSetDictionary(pFieldDb, rsslDictionary, error)) != RSSL_RET_SUCCESS)
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+			_rsslCacheFieldDbDestroy(pFieldDb);
+			return ret;
+		}
+
+		rsslQueueAddLinkToBack(&fieldDbList, &pFieldDb->dbLink);
+	}
+	else if ((ret = _rsslCacheFieldDbSetDictionary(pFieldDb, rsslDictionary, error)) != RSSL_RET_SUCCESS)
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+		return ret;
+	}
+
+	pCache->pFieldDb = pFieldDb;
+
+	RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheBindDictionary(RsslPayloadCacheHandle cacheHandle, const RsslDataDictionary *rsslDictionary,
+		const char* dictionaryKey, RsslCacheError* error)
+{
+	return rsslPayloadCacheSetDictionary(cacheHandle, rsslDictionary, dictionaryKey, error);
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheSetSharedDictionaryKey(RsslPayloadCacheHandle cacheHandle, const char* dictionaryKey, RsslCacheError *error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslCacheFieldDb *pFieldDb;
+
+	if (!pCache || !dictionaryKey)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_INVALID_ARGUMENT, "rsslPayloadCacheSetSharedDictionaryKey() Error: Invalid argument.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	RSSL_STATIC_MUTEX_LOCK(cacheStaticMutex);
+	pFieldDb = _rsslCacheFieldDbFind(dictionaryKey);
+	RSSL_STATIC_MUTEX_UNLOCK(cacheStaticMutex);
+
+	if (!pFieldDb)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_FAILURE, "rsslPayloadCacheSetSharedDictionaryKey() Error: Unknown dictionary key %s.", dictionaryKey);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (pCache->pFieldDb && pCache->pFieldDb != pFieldDb)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_FAILURE, "rsslPayloadCacheSetSharedDictionaryKey() Error: Cache already has dictionary key %s.",
+				pCache->pFieldDb->dictionaryKey);
+		return RSSL_RET_FAILURE;
+	}
+
+	pCache->pFieldDb = pFieldDb;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadCacheBindSharedDictionaryKey(RsslPayloadCacheHandle cacheHandle, const char* dictionaryKey, RsslCacheError *error)
+{
+	return rsslPayloadCacheSetSharedDictionaryKey(cacheHandle, dictionaryKey, error);
+}
+
+RSSL_VA_API RsslUInt rsslPayloadCacheGetEntryCount(RsslPayloadCacheHandle cacheHandle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+
+	return pCache ? rsslQueueGetElementCount(&pCache->entryList) : 0;
+}
+
+RSSL_VA_API RsslUInt rsslPayloadCacheGetEntryList(RsslPayloadCacheHandle cacheHandle, RsslPayloadEntryHandle arrHandles[], RsslUInt arrSize)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslQueueLink *pLink;
+	RsslUInt count = 0;
+
+	if (!pCache || !arrHandles)
+		return 0;
+
+	RSSL_QUEUE_FOR_EACH_LINK(&pCache->entryList, pLink)
+	{
+		if (count == arrSize)
+			break;
+		arrHandles[count++] = (RsslPayloadEntryHandle)RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadEntryImpl, cacheLink, pLink);
+	}
+
+	return count;
+}
+
+RSSL_VA_API void rsslPayloadCacheClearAll(RsslPayloadCacheHandle cacheHandle)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslQueueLink *pLink;
+
+	if (!pCache)
+		return;
+
+	while ((pLink = rsslQueuePeekFront(&pCache->entryList)))
+		rsslPayloadEntryImplDestroy(RSSL_QUEUE_LINK_TO_OBJECT(RsslPayloadEntryImpl, cacheLink, pLink));
+}
@@ -0,0 +1,34 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/rsslPayloadCacheImpl.h"
+
+RSSL_VA_API RsslPayloadCursorHandle rsslPayloadCursorCreate()
+{
+	RsslPayloadCursorImpl *pCursor = (RsslPayloadCursorImpl*)malloc(sizeof(RsslPayloadCursorImpl));
+
+	if (pCursor)
+		memset(pCursor, 0, sizeof(RsslPayloadCursorImpl));
+
+	return (RsslPayloadCursorHandle)pCursor;
+}
+
+RSSL_VA_API void rsslPayloadCursorDestroy(RsslPayloadCursorHandle cursorHandle)
+{
+	free(cursorHandle);
+}
+
+RSSL_VA_API void rsslPayloadCursorClear(RsslPayloadCursorHandle cursorHandle)
+{
+	if (cursorHandle)
+		memset(cursorHandle, 0, sizeof(RsslPayloadCursorImpl));
+}
+
+RSSL_VA_API RsslBool rsslPayloadCursorIsComplete(RsslPayloadCursorHandle cursorHandle)
+{
+	return cursorHandle ? ((RsslPayloadCursorImpl*)cursorHandle)->isComplete : RSSL_TRUE;
+}
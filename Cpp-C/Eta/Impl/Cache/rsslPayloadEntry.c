@@ -0,0 +1,900 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/rsslPayloadCacheImpl.h"
+#include "rtr/rsslRmtes.h"
+#include "decodeRoutines.h"
+
+#define RSSL_CACHE_INITIAL_FIELD_COUNT 32
+#define RSSL_CACHE_INITIAL_DATA_SIZE 512
+#define RSSL_CACHE_INITIAL_MAP_ENTRY_COUNT 64
+#define RSSL_CACHE_MAP_HASH_SIZE 64
+
+/* Returns the position of the field in the store, or the position where it would be inserted. */
+static RsslUInt32 _rsslCacheFieldStoreFind(RsslCacheFieldStore *pStore, RsslFieldId fieldId, RsslBool *pFound)
+{
+	RsslUInt32 low = 0, high = pStore->fieldCount;
+
+	while (low < high)
+	{
+		RsslUInt32 mid = (low + high) / 2;
+		RsslFieldId midFieldId = pStore->pFields[mid].fieldId;
+
+		if (midFieldId == fieldId)
+		{
+			*pFound = RSSL_TRUE;
+			return mid;
+		}
+		else if (midFieldId < fieldId)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	*pFound = RSSL_FALSE;
+	return low;
+}
+
+/* Packs the data of all fields to the start of a new buffer, dropping space that is no longer in use. */
+static RsslRet _rsslCacheFieldStoreCompact(RsslCacheFieldStore *pStore, RsslUInt32 newSize)
+{
+	char *pNewData;
+	RsslUInt32 i, offset = 0;
+
+	if (!(pNewData = (char*)malloc(newSize)))
+		return RSSL_RET_FAILURE;
+
+	for (i = 0; i < pStore->fieldCount; ++i)
+	{
+		RsslCacheField *pField = &pStore->pFields[i];
+
+		if (pField->length)
+			memcpy(pNewData + offset, pStore->pData + pField->offset, pField->length);
+		pField->offset = offset;
+		pField->capacity = pField->length;
+		offset += pField->length;
+	}
+
+	free(pStore->pData);
+	pStore->pData = pNewData;
+	pStore->dataSize = newSize;
+	pStore->dataLength = offset;
+	pStore->unusedLength = 0;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Reserves space for data of the given length at the end of the data area. */
+static RsslRet _rsslCacheFieldStoreReserve(RsslCacheFieldStore *pStore, RsslUInt32 length, RsslUInt32 *pOffset)
+{
+	if (pStore->dataLength + length > pStore->dataSize)
+	{
+		RsslUInt32 usedLength = pStore->dataLength - pStore->unusedLength;
+		RsslUInt32 newSize = pStore->dataSize ? pStore->dataSize : RSSL_CACHE_INITIAL_DATA_SIZE;
+
+		/* Only grow if compacting would not leave at least half of the buffer free. */
+		while (newSize < (usedLength + length) * 2)
+			newSize *= 2;
+
+		if (_rsslCacheFieldStoreCompact(pStore, newSize) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+	}
+
+	*pOffset = pStore->dataLength;
+	pStore->dataLength += length;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Sets the encoded data of a field, adding the field if it is not already present. */
+static RsslRet _rsslCacheFieldStoreSet(RsslCacheFieldStore *pStore, RsslFieldId fieldId, const RsslBuffer *pData)
+{
+	RsslBool found;
+	RsslUInt32 index = _rsslCacheFieldStoreFind(pStore, fieldId, &found);
+	RsslCacheField *pField;
+	RsslUInt32 offset;
+
+	if (found)
+	{
+		pField = &pStore->pFields[index];
+
+		if (pData->length <= pField->capacity)
+		{
+			if (pData->length)
+				memmove(pStore->pData + pField->offset, pData->data, pData->length);
+			pField->length = pData->length;
+			return RSSL_RET_SUCCESS;
+		}
+
+		/* Doesn't fit; release the old space so it can be reclaimed. */
+		pStore->unusedLength += pField->capacity;
+		pField->length = 0;
+		pField->capacity = 0;
+	}
+	else
+	{
+		if (pStore->fieldCount == pStore->maxFields)
+		{
+			RsslUInt32 newMax = pStore->maxFields ? pStore->maxFields * 2 : RSSL_CACHE_INITIAL_FIELD_COUNT;
+			RsslCacheField *pNewFields = (RsslCacheField*)realloc(pStore->pFields, newMax * sizeof(RsslCacheField));
+
+			if (!pNewFields)
+				return RSSL_RET_FAILURE;
+
+			pStore->pFields = pNewFields;
+			pStore->maxFields = newMax;
+		}
+
+		memmove(&pStore->pFields[index + 1], &pStore->pFields[index], (pStore->fieldCount - index) * sizeof(RsslCacheField));
+		++pStore->fieldCount;
+
+		pField = &pStore->pFields[index];
+		pField->fieldId = fieldId;
+		pField->offset = 0;
+		pField->length = 0;
+		pField->capacity = 0;
+	}
+
+	if (pData->length == 0)
+		return RSSL_RET_SUCCESS;
+
+	if (_rsslCacheFieldStoreReserve(pStore, pData->length, &offset) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	memcpy(pStore->pData + offset, pData->data, pData->length);
+	pField->offset = offset;
+	pField->length = pData->length;
+	pField->capacity = pData->length;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Applies a partial RMTES update to the cached value of a field. */
+static RsslRet _rsslCacheFieldStoreApplyRmtes(RsslPayloadCacheImpl *pCache, RsslCacheFieldStore *pStore, RsslFieldId fieldId,
+		RsslBuffer *pUpdate)
+{
+	RsslBool found;
+	RsslUInt32 index = _rsslCacheFieldStoreFind(pStore, fieldId, &found);
+	RsslUInt32 currentLength = found ? pStore->pFields[index].length : 0;
+	RsslUInt32 requiredSize = (currentLength + pUpdate->length) * 2;
+	RsslRmtesCacheBuffer rmtesBuffer;
+	RsslBuffer newValue;
+	RsslRet ret;
+
+	for(;;)
+	{
+		if (pCache->scratchSize < requiredSize)
+		{
+			char *pNewScratch = (char*)realloc(pCache->pScratch, requiredSize);
+
+			if (!pNewScratch)
+				return RSSL_RET_FAILURE;
+
+			pCache->pScratch = pNewScratch;
+			pCache->scratchSize = requiredSize;
+		}
+
+		if (currentLength)
+			memcpy(pCache->pScratch, pStore->pData + pStore->pFields[index].offset, currentLength);
+
+		rmtesBuffer.data = pCache->pScratch;
+		rmtesBuffer.length = currentLength;
+		rmtesBuffer.allocatedLength = pCache->scratchSize;
+
+		if ((ret = rsslRMTESApplyToCache(pUpdate, &rmtesBuffer)) != RSSL_RET_BUFFER_TOO_SMALL)
+			break;
+
+		requiredSize = pCache->scratchSize * 2;
+	}
+
+	if (ret < RSSL_RET_SUCCESS)
+		return ret;
+
+	newValue.data = rmtesBuffer.data;
+	newValue.length = rmtesBuffer.length;
+	return _rsslCacheFieldStoreSet(pStore, fieldId, &newValue);
+}
+
+/* Decodes a field list from the iterator and merges its fields into the store. */
+static RsslRet _rsslCacheFieldStoreApply(RsslPayloadCacheImpl *pCache, RsslCacheFieldStore *pStore, RsslDecodeIterator *dIter,
+		RsslUInt32 *pSkippedCount, RsslCacheError *pError)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslRet ret;
+
+	rsslClearFieldList(&fieldList);
+	if ((ret = rsslDecodeFieldList(dIter, &fieldList, NULL)) == RSSL_RET_NO_DATA)
+		return RSSL_RET_SUCCESS;
+	else if (ret < RSSL_RET_SUCCESS)
+	{
+		RSSL_CACHE_SET_ERROR(pError, ret, "Failed to decode field list: %d.", ret);
+		return ret;
+	}
+
+	if (fieldList.flags & RSSL_FLF_HAS_SET_DATA)
+	{
+		RSSL_CACHE_SET_ERROR(pError, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Set-defined field list data is not supported by the cache.");
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	if (fieldList.flags & RSSL_FLF_HAS_FIELD_LIST_INFO)
+	{
+		pStore->hasInfo = RSSL_TRUE;
+		pStore->dictionaryId = fieldList.dictionaryId;
+		pStore->fieldListNum = fieldList.fieldListNum;
+	}
+
+	rsslClearFieldEntry(&fieldEntry);
+	while ((ret = rsslDecodeFieldEntry(dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RsslUInt8 rwfType;
+
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			RSSL_CACHE_SET_ERROR(pError, ret, "Failed to decode field entry: %d.", ret);
+			return ret;
+		}
+
+		if ((rwfType = rsslCacheFieldDbGetType(pCache->pFieldDb, fieldEntry.fieldId)) == RSSL_DT_UNKNOWN)
+		{
+			++*pSkippedCount;
+			continue;
+		}
+
+		if (rwfType == RSSL_DT_RMTES_STRING && rsslHasPartialRMTESUpdate(&fieldEntry.encData))
+			ret = _rsslCacheFieldStoreApplyRmtes(pCache, pStore, fieldEntry.fieldId, &fieldEntry.encData);
+		else
+			ret = _rsslCacheFieldStoreSet(pStore, fieldEntry.fieldId, &fieldEntry.encData);
+
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			RSSL_CACHE_SET_ERROR(pError, ret, "Failed to store field %d.", fieldEntry.fieldId);
+			return ret;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Encodes the fields of the store as a field list.  On failure, the field list is rolled back. */
+static RsslRet _rsslCacheFieldStoreEncode(RsslCacheFieldStore *pStore, RsslEncodeIterator *eIter)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	if (pStore->hasInfo)
+	{
+		fieldList.flags |= RSSL_FLF_HAS_FIELD_LIST_INFO;
+		fieldList.dictionaryId = pStore->dictionaryId;
+		fieldList.fieldListNum = pStore->fieldListNum;
+	}
+
+	if ((ret = rsslEncodeFieldListInit(eIter, &fieldList, NULL, 0)) < RSSL_RET_SUCCESS)
+	{
+		rsslEncodeFieldListComplete(eIter, RSSL_FALSE);
+		return ret;
+	}
+
+	rsslClearFieldEntry(&fieldEntry);
+	for (i = 0; i < pStore->fieldCount; ++i)
+	{
+		RsslCacheField *pField = &pStore->pFields[i];
+
+		fieldEntry.fieldId = pField->fieldId;
+		fieldEntry.dataType = RSSL_DT_UNKNOWN;
+		fieldEntry.encData.data = pField->length ? pStore->pData + pField->offset : NULL;
+		fieldEntry.encData.length = pField->length;
+
+		if ((ret = rsslEncodeFieldEntry(eIter, &fieldEntry, NULL)) < RSSL_RET_SUCCESS)
+		{
+			rsslEncodeFieldListComplete(eIter, RSSL_FALSE);
+			return ret;
+		}
+	}
+
+	return rsslEncodeFieldListComplete(eIter, RSSL_TRUE);
+}
+
+static void _rsslCacheMapEntryDestroy(RsslPayloadEntryImpl *pEntry, RsslCacheMapEntry *pMapEntry)
+{
+	if (pMapEntry->key.data != pMapEntry->keyStorage)
+		free(pMapEntry->key.data);
+	if (pMapEntry->permData.data)
+	{
+		free(pMapEntry->permData.data);
+		--pEntry->permDataCount;
+	}
+	rsslCacheFieldStoreCleanup(&pMapEntry->fields);
+	rsslCachePoolPut(&pEntry->pCache->mapEntryPool, pMapEntry);
+}
+
+/* Returns the position of the first map entry with a sequence number of at least seqNum. */
+static RsslUInt32 _rsslPayloadEntryFindSeqNum(RsslPayloadEntryImpl *pEntry, RsslUInt64 seqNum)
+{
+	RsslUInt32 low = 0, high = pEntry->mapEntryCount;
+
+	while (low < high)
+	{
+		RsslUInt32 mid = (low + high) / 2;
+
+		if (pEntry->pMapEntries[mid]->seqNum < seqNum)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
+static RsslCacheMapEntry *_rsslPayloadEntryAddMapEntry(RsslPayloadEntryImpl *pEntry, RsslBuffer *pKey)
+{
+	RsslCacheMapEntry *pMapEntry;
+
+	if (pEntry->mapEntryCount == pEntry->maxMapEntries)
+	{
+		RsslUInt32 newMax = pEntry->maxMapEntries ? pEntry->maxMapEntries * 2 : RSSL_CACHE_INITIAL_MAP_ENTRY_COUNT;
+		RsslCacheMapEntry **pNewEntries = (RsslCacheMapEntry**)realloc(pEntry->pMapEntries, newMax * sizeof(RsslCacheMapEntry*));
+
+		if (!pNewEntries)
+			return NULL;
+
+		pEntry->pMapEntries = pNewEntries;
+		pEntry->maxMapEntries = newMax;
+	}
+
+	if (!(pMapEntry = (RsslCacheMapEntry*)rsslCachePoolGet(&pEntry->pCache->mapEntryPool)))
+		return NULL;
+
+	memset(pMapEntry, 0, sizeof(RsslCacheMapEntry));
+
+	if (pKey->length <= RSSL_CACHE_MAP_KEY_STORAGE)
+		pMapEntry->key.data = pMapEntry->keyStorage;
+	else if (!(pMapEntry->key.data = (char*)malloc(pKey->length)))
+	{
+		rsslCachePoolPut(&pEntry->pCache->mapEntryPool, pMapEntry);
+		return NULL;
+	}
+
+	memcpy(pMapEntry->key.data, pKey->data, pKey->length);
+	pMapEntry->key.length = pKey->length;
+	pMapEntry->seqNum = pEntry->nextSeqNum++;
+	rsslCacheFieldStoreInit(&pMapEntry->fields);
+
+	rsslHashLinkInit(&pMapEntry->hashLink);
+	rsslHashTableInsertLink(&pEntry->mapEntryTable, &pMapEntry->hashLink, &pMapEntry->key, NULL);
+	pEntry->pMapEntries[pEntry->mapEntryCount++] = pMapEntry;
+
+	return pMapEntry;
+}
+
+static void _rsslPayloadEntryRemoveMapEntry(RsslPayloadEntryImpl *pEntry, RsslCacheMapEntry *pMapEntry)
+{
+	RsslUInt32 index = _rsslPayloadEntryFindSeqNum(pEntry, pMapEntry->seqNum);
+
+	memmove(&pEntry->pMapEntries[index], &pEntry->pMapEntries[index + 1],
+			(pEntry->mapEntryCount - index - 1) * sizeof(RsslCacheMapEntry*));
+	--pEntry->mapEntryCount;
+
+	rsslHashTableRemoveLink(&pEntry->mapEntryTable, &pMapEntry->hashLink);
+	_rsslCacheMapEntryDestroy(pEntry, pMapEntry);
+}
+
+static RsslRet _rsslCacheMapEntrySetPermData(RsslPayloadEntryImpl *pEntry, RsslCacheMapEntry *pMapEntry, RsslBuffer *pPermData)
+{
+	if (pMapEntry->permData.data && pMapEntry->permData.length >= pPermData->length)
+	{
+		memcpy(pMapEntry->permData.data, pPermData->data, pPermData->length);
+		pMapEntry->permData.length = pPermData->length;
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (pMapEntry->permData.data)
+		free(pMapEntry->permData.data);
+	else
+		++pEntry->permDataCount;
+
+	if (!(pMapEntry->permData.data = (char*)malloc(pPermData->length ? pPermData->length : 1)))
+	{
+		pMapEntry->permData.length = 0;
+		--pEntry->permDataCount;
+		return RSSL_RET_FAILURE;
+	}
+
+	memcpy(pMapEntry->permData.data, pPermData->data, pPermData->length);
+	pMapEntry->permData.length = pPermData->length;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Removes all data from the entry, keeping allocated memory for reuse. */
+static void _rsslPayloadEntryClear(RsslPayloadEntryImpl *pEntry)
+{
+	RsslUInt32 i;
+
+	for (i = 0; i < pEntry->mapEntryCount; ++i)
+	{
+		rsslHashTableRemoveLink(&pEntry->mapEntryTable, &pEntry->pMapEntries[i]->hashLink);
+		_rsslCacheMapEntryDestroy(pEntry, pEntry->pMapEntries[i]);
+	}
+
+	pEntry->mapEntryCount = 0;
+	pEntry->nextSeqNum = 0;
+	pEntry->mapFlags = 0;
+	pEntry->keyPrimitiveType = 0;
+	pEntry->keyFieldId = 0;
+	rsslCacheFieldStoreClear(&pEntry->fields);
+	pEntry->dataType = RSSL_DT_UNKNOWN;
+}
+
+static RsslRet _rsslPayloadEntryApplyMap(RsslPayloadEntryImpl *pEntry, RsslDecodeIterator *dIter, RsslUInt32 *pSkippedCount,
+		RsslCacheError *pError)
+{
+	RsslPayloadCacheImpl *pCache = pEntry->pCache;
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslRet ret;
+
+	rsslClearMap(&map);
+	if ((ret = rsslDecodeMap(dIter, &map)) == RSSL_RET_NO_DATA)
+		return RSSL_RET_SUCCESS;
+	else if (ret < RSSL_RET_SUCCESS)
+	{
+		RSSL_CACHE_SET_ERROR(pError, ret, "Failed to decode map: %d.", ret);
+		return ret;
+	}
+
+	if (map.containerType != RSSL_DT_FIELD_LIST)
+	{
+		RSSL_CACHE_SET_ERROR(pError, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Map entries of container type %d are not supported by the cache.",
+				map.containerType);
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_SET_DEFS)
+	{
+		RSSL_CACHE_SET_ERROR(pError, RSSL_RET_UNSUPPORTED_DATA_TYPE, "Set-defined map data is not supported by the cache.");
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	if (!pEntry->mapEntryTableInit)
+	{
+		RsslErrorInfo errorInfo;
+
+		if (rsslHashTableInit(&pEntry->mapEntryTable, RSSL_CACHE_MAP_HASH_SIZE, rsslHashBufferSum, rsslHashBufferCompare,
+					RSSL_TRUE, &errorInfo) != RSSL_RET_SUCCESS)
+		{
+			RSSL_CACHE_SET_ERROR(pError, RSSL_RET_FAILURE, "Failed to create map entry table.");
+			return RSSL_RET_FAILURE;
+		}
+		pEntry->mapEntryTableInit = RSSL_TRUE;
+	}
+
+	pEntry->keyPrimitiveType = map.keyPrimitiveType;
+	if (map.flags & RSSL_MPF_HAS_KEY_FIELD_ID)
+	{
+		pEntry->mapFlags |= RSSL_MPF_HAS_KEY_FIELD_ID;
+		pEntry->keyFieldId = map.keyFieldId;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_SUMMARY_DATA)
+	{
+		pEntry->mapFlags |= RSSL_MPF_HAS_SUMMARY_DATA;
+		if ((ret = _rsslCacheFieldStoreApply(pCache, &pEntry->fields, dIter, pSkippedCount, pError)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	rsslClearMapEntry(&mapEntry);
+	while ((ret = rsslDecodeMapEntry(dIter, &mapEntry, NULL)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		RsslHashLink *pHashLink;
+		RsslCacheMapEntry *pMapEntry;
+
+		if (ret < RSSL_RET_SUCCESS)
+		{
+			RSSL_CACHE_SET_ERROR(pError, ret, "Failed to decode map entry: %d.", ret);
+			return ret;
+		}
+
+		pHashLink = rsslHashTableFind(&pEntry->mapEntryTable, &mapEntry.encKey, NULL);
+		pMapEntry = pHashLink ? RSSL_HASH_LINK_TO_OBJECT(RsslCacheMapEntry, hashLink, pHashLink) : NULL;
+
+		switch(mapEntry.action)
+		{
+			case RSSL_MPEA_DELETE_ENTRY:
+				if (pMapEntry)
+					_rsslPayloadEntryRemoveMapEntry(pEntry, pMapEntry);
+				continue;
+
+			case RSSL_MPEA_ADD_ENTRY:
+				if (pMapEntry)
+					rsslCacheFieldStoreClear(&pMapEntry->fields);
+				break;
+
+			case RSSL_MPEA_UPDATE_ENTRY:
+				break;
+
+			default:
+				RSSL_CACHE_SET_ERROR(pError, RSSL_RET_INVALID_DATA, "Unknown map entry action %u.", mapEntry.action);
+				return RSSL_RET_INVALID_DATA;
+		}
+
+		if (!pMapEntry && !(pMapEntry = _rsslPayloadEntryAddMapEntry(pEntry, &mapEntry.encKey)))
+		{
+			RSSL_CACHE_SET_ERROR(pError, RSSL_RET_FAILURE, "Failed to allocate map entry.");
+			return RSSL_RET_FAILURE;
+		}
+
+		if ((mapEntry.flags & RSSL_MPEF_HAS_PERM_DATA)
+				&& _rsslCacheMapEntrySetPermData(pEntry, pMapEntry, &mapEntry.permData) != RSSL_RET_SUCCESS)
+		{
+			RSSL_CACHE_SET_ERROR(pError, RSSL_RET_FAILURE, "Failed to allocate map entry permission data.");
+			return RSSL_RET_FAILURE;
+		}
+
+		if ((ret = _rsslCacheFieldStoreApply(pCache, &pMapEntry->fields, dIter, pSkippedCount, pError)) < RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Encodes the map entries of the payload, starting from the cursor position, until all are encoded or the
+ * buffer is full. */
+static RsslRet _rsslPayloadEntryRetrieveMap(RsslPayloadEntryImpl *pEntry, RsslEncodeIterator *eIter,
+		RsslPayloadCursorImpl *pCursor, RsslCacheError *pError)
+{
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	RsslBool firstPart = (!pCursor || pCursor->partCount == 0);
+	RsslUInt32 index = firstPart ? 0 : _rsslPayloadEntryFindSeqNum(pEntry, pCursor->nextSeqNum);
+	RsslUInt32 startIndex = index;
+	RsslRet ret;
+
+	rsslClearMap(&map);
+	map.containerType = RSSL_DT_FIELD_LIST;
+	map.keyPrimitiveType = pEntry->keyPrimitiveType;
+
+	if (pEntry->mapFlags & RSSL_MPF_HAS_KEY_FIELD_ID)
+	{
+		map.flags |= RSSL_MPF_HAS_KEY_FIELD_ID;
+		map.keyFieldId = pEntry->keyFieldId;
+	}
+
+	if (pEntry->permDataCount)
+		map.flags |= RSSL_MPF_HAS_PER_ENTRY_PERM_DATA;
+
+	/* Summary data and the total count are sent on the first part only. */
+	if (firstPart)
+	{
+		map.flags |= RSSL_MPF_HAS_TOTAL_COUNT_HINT;
+		map.totalCountHint = pEntry->mapEntryCount;
+
+		if (pEntry->mapFlags & RSSL_MPF_HAS_SUMMARY_DATA)
+			map.flags |= RSSL_MPF_HAS_SUMMARY_DATA;
+	}
+
+	if ((ret = rsslEncodeMapInit(eIter, &map, 0, 0)) < RSSL_RET_SUCCESS)
+	{
+		rsslEncodeMapComplete(eIter, RSSL_FALSE);
+		RSSL_CACHE_SET_ERROR(pError, ret, "Failed to encode map: %d.", ret);
+		return ret;
+	}
+
+	if (map.flags & RSSL_MPF_HAS_SUMMARY_DATA)
+	{
+		if ((ret = _rsslCacheFieldStoreEncode(&pEntry->fields, eIter)) < RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeMapSummaryDataComplete(eIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		{
+			rsslEncodeMapSummaryDataComplete(eIter, RSSL_FALSE);
+			rsslEncodeMapComplete(eIter, RSSL_FALSE);
+			RSSL_CACHE_SET_ERROR(pError, ret, "Failed to encode map summary data: %d.", ret);
+			return ret;
+		}
+	}
+
+	rsslClearMapEntry(&mapEntry);
+	mapEntry.action = RSSL_MPEA_ADD_ENTRY;
+
+	for (; index < pEntry->mapEntryCount; ++index)
+	{
+		RsslCacheMapEntry *pMapEntry = pEntry->pMapEntries[index];
+
+		mapEntry.encKey = pMapEntry->key;
+		if (pMapEntry->permData.data)
+		{
+			mapEntry.flags = RSSL_MPEF_HAS_PERM_DATA;
+			mapEntry.permData = pMapEntry->permData;
+		}
+		else
+			mapEntry.flags = RSSL_MPEF_NONE;
+
+		if ((ret = rsslEncodeMapEntryInit(eIter, &mapEntry, NULL, 0)) < RSSL_RET_SUCCESS
+				|| (ret = _rsslCacheFieldStoreEncode(&pMapEntry->fields, eIter)) < RSSL_RET_SUCCESS
+				|| (ret = rsslEncodeMapEntryComplete(eIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+		{
+			rsslEncodeMapEntryComplete(eIter, RSSL_FALSE);
+
+			if (ret != RSSL_RET_BUFFER_TOO_SMALL)
+			{
+				rsslEncodeMapComplete(eIter, RSSL_FALSE);
+				RSSL_CACHE_SET_ERROR(pError, ret, "Failed to encode map entry: %d.", ret);
+				return ret;
+			}
+
+			break;
+		}
+	}
+
+	/* Fail if the buffer did not hold any new entries, or the whole map was needed but did not fit. */
+	if (index < pEntry->mapEntryCount && (index == startIndex || !pCursor))
+	{
+		rsslEncodeMapComplete(eIter, RSSL_FALSE);
+		RSSL_CACHE_SET_ERROR(pError, RSSL_RET_BUFFER_TOO_SMALL, "Buffer too small to retrieve map entries.");
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+
+	if ((ret = rsslEncodeMapComplete(eIter, RSSL_TRUE)) < RSSL_RET_SUCCESS)
+	{
+		RSSL_CACHE_SET_ERROR(pError, ret, "Failed to complete map encoding: %d.", ret);
+		return ret;
+	}
+
+	if (pCursor)
+	{
+		++pCursor->partCount;
+		if (index < pEntry->mapEntryCount)
+			pCursor->nextSeqNum = pEntry->pMapEntries[index]->seqNum;
+		else
+			pCursor->isComplete = RSSL_TRUE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+void rsslPayloadEntryImplDestroy(RsslPayloadEntryImpl *pEntry)
+{
+	RsslPayloadCacheImpl *pCache = pEntry->pCache;
+
+	_rsslPayloadEntryClear(pEntry);
+	rsslCacheFieldStoreCleanup(&pEntry->fields);
+	free(pEntry->pMapEntries);
+	if (pEntry->mapEntryTableInit)
+		rsslHashTableCleanup(&pEntry->mapEntryTable);
+
+	rsslQueueRemoveLink(&pCache->entryList, &pEntry->cacheLink);
+	rsslCachePoolPut(&pCache->entryPool, pEntry);
+}
+
+RSSL_VA_API RsslPayloadEntryHandle rsslPayloadEntryCreate(RsslPayloadCacheHandle cacheHandle, RsslCacheError *error)
+{
+	RsslPayloadCacheImpl *pCache = (RsslPayloadCacheImpl*)cacheHandle;
+	RsslPayloadEntryImpl *pEntry;
+
+	if (!pCache)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_INVALID_ARGUMENT, "rsslPayloadEntryCreate() Error: Invalid cache handle.");
+		return NULL;
+	}
+
+	if (pCache->config.maxItems && rsslQueueGetElementCount(&pCache->entryList) >= pCache->config.maxItems)
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_FAILURE, "rsslPayloadEntryCreate() Error: Cache has reached its limit of " RTR_LLU " entries.",
+				pCache->config.maxItems);
+		return NULL;
+	}
+
+	if (!(pEntry = (RsslPayloadEntryImpl*)rsslCachePoolGet(&pCache->entryPool)))
+	{
+		RSSL_CACHE_SET_ERROR(error, RSSL_RET_FAILURE, "rsslPayloadEntryCreate() Error: Failed to allocate entry.");
+		return NULL;
+	}
+
+	memset(pEntry, 0, sizeof(RsslPayloadEntryImpl));
+	pEntry->pCache = pCache;
+	pEntry->dataType = RSSL_DT_UNKNOWN;
+	rsslCacheFieldStoreInit(&pEntry->fields);
+	rsslInitQueueLink(&pEntry->cacheLink);
+	rsslQueueAddLinkToBack(&pCache->entryList, &pEntry->cacheLink);
+
+	return (RsslPayloadEntryHandle)pEntry;
+}
+
+RSSL_VA_API void rsslPayloadEntryDestroy(RsslPayloadEntryHandle handle)
+{
+	if (handle)
+		rsslPayloadEntryImplDestroy((RsslPayloadEntryImpl*)handle);
+}
+
+RSSL_VA_API void rsslPayloadEntryClear(RsslPayloadEntryHandle handle)
+{
+	if (handle)
+		_rsslPayloadEntryClear((RsslPayloadEntryImpl*)handle);
+}
+
+RSSL_VA_API RsslContainerType rsslPayloadEntryGetDataType(RsslPayloadEntryHandle handle)
+{
+	return handle ? ((RsslPayloadEntryImpl*)handle)->dataType : RSSL_DT_UNKNOWN;
+}
+
+RSSL_VA_API RsslRet rsslPayloadEntryApply(RsslPayloadEntryHandle handle, RsslDecodeIterator *dIter, RsslMsg *msg,
+		RsslCacheError *errorInfo)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	RsslUInt32 skippedCount = 0;
+	RsslRet ret;
+
+	if (!pEntry || !dIter || !msg)
+	{
+		RSSL_CACHE_SET_ERROR(errorInfo, RSSL_RET_INVALID_ARGUMENT, "rsslPayloadEntryApply() Error: Invalid argument.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	switch(msg->msgBase.msgClass)
+	{
+		case RSSL_MC_REFRESH:
+			if (msg->refreshMsg.flags & RSSL_RFMF_CLEAR_CACHE)
+				_rsslPayloadEntryClear(pEntry);
+			break;
+
+		case RSSL_MC_STATUS:
+			if (msg->statusMsg.flags & RSSL_STMF_CLEAR_CACHE)
+				_rsslPayloadEntryClear(pEntry);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_MC_UPDATE:
+			break;
+
+		default:
+			return RSSL_RET_SUCCESS;
+	}
+
+	if (msg->msgBase.containerType == RSSL_DT_NO_DATA)
+		return RSSL_RET_SUCCESS;
+
+	if (!pEntry->pCache->pFieldDb)
+	{
+		RSSL_CACHE_SET_ERROR(errorInfo, RSSL_RET_FAILURE, "rsslPayloadEntryApply() Error: No dictionary has been set for the cache.");
+		return RSSL_RET_FAILURE;
+	}
+
+	if (pEntry->dataType != RSSL_DT_UNKNOWN && pEntry->dataType != msg->msgBase.containerType)
+	{
+		RSSL_CACHE_SET_ERROR(errorInfo, RSSL_RET_INVALID_DATA,
+				"rsslPayloadEntryApply() Error: Container type %u does not match the cached type %u.",
+				msg->msgBase.containerType, pEntry->dataType);
+		return RSSL_RET_INVALID_DATA;
+	}
+
+	switch(msg->msgBase.containerType)
+	{
+		case RSSL_DT_FIELD_LIST:
+			ret = _rsslCacheFieldStoreApply(pEntry->pCache, &pEntry->fields, dIter, &skippedCount, errorInfo);
+			break;
+
+		case RSSL_DT_MAP:
+			ret = _rsslPayloadEntryApplyMap(pEntry, dIter, &skippedCount, errorInfo);
+			break;
+
+		default:
+			RSSL_CACHE_SET_ERROR(errorInfo, RSSL_RET_UNSUPPORTED_DATA_TYPE,
+					"rsslPayloadEntryApply() Error: Container type %u is not supported by the cache.", msg->msgBase.containerType);
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	if (ret < RSSL_RET_SUCCESS)
+		return ret;
+
+	pEntry->dataType = msg->msgBase.containerType;
+
+	if (skippedCount)
+	{
+		/* Warning: the data was applied, but not all of it could be cached. */
+		RSSL_CACHE_SET_ERROR(errorInfo, RSSL_RET_SUCCESS,
+				"rsslPayloadEntryApply() Warning: %u field(s) not in the dictionary were not cached.", skippedCount);
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadEntryRetrieve(RsslPayloadEntryHandle handle, RsslEncodeIterator *eIter,
+		RsslPayloadCursorHandle cursorHandle, RsslCacheError *errorInfo)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	RsslPayloadCursorImpl *pCursor = (RsslPayloadCursorImpl*)cursorHandle;
+	RsslRet ret;
+
+	if (!pEntry || !eIter)
+	{
+		RSSL_CACHE_SET_ERROR(errorInfo, RSSL_RET_INVALID_ARGUMENT, "rsslPayloadEntryRetrieve() Error: Invalid argument.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pCursor && pCursor->isComplete)
+	{
+		RSSL_CACHE_SET_ERROR(errorInfo, RSSL_RET_INVALID_ARGUMENT, "rsslPayloadEntryRetrieve() Error: Cursor is already complete.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	switch(pEntry->dataType)
+	{
+		case RSSL_DT_FIELD_LIST:
+			if ((ret = _rsslCacheFieldStoreEncode(&pEntry->fields, eIter)) < RSSL_RET_SUCCESS)
+			{
+				RSSL_CACHE_SET_ERROR(errorInfo, ret, "rsslPayloadEntryRetrieve() Error: Failed to encode field list: %d.", ret);
+				return ret;
+			}
+			break;
+
+		case RSSL_DT_MAP:
+			return _rsslPayloadEntryRetrieveMap(pEntry, eIter, pCursor, errorInfo);
+
+		default:
+			/* Nothing cached. */
+			break;
+	}
+
+	if (pCursor)
+	{
+		++pCursor->partCount;
+		pCursor->isComplete = RSSL_TRUE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_VA_API RsslRet rsslPayloadEntryTrace(RsslPayloadEntryHandle handle, RsslInt traceFormat, FILE *file,
+		RsslDataDictionary *dictionary)
+{
+	RsslPayloadEntryImpl *pEntry = (RsslPayloadEntryImpl*)handle;
+	RsslEncodeIterator eIter;
+	RsslDecodeIterator dIter;
+	RsslBuffer buffer;
+	RsslUInt32 bufferSize = 1024;
+	RsslRet ret;
+
+	if (!pEntry || !file || traceFormat != PAYLOAD_ENTRY_TRACE_OPTION_XML)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (pEntry->dataType == RSSL_DT_UNKNOWN)
+	{
+		fprintf(file, "<!-- Payload entry has no data -->\n");
+		return RSSL_RET_SUCCESS;
+	}
+
+	/* Retrieve the entry as a single part, growing the buffer until it fits. */
+	for(;;)
+	{
+		if (!(buffer.data = (char*)malloc(bufferSize)))
+			return RSSL_RET_FAILURE;
+		buffer.length = bufferSize;
+
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorRWFVersion(&eIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+
+		if ((ret = rsslPayloadEntryRetrieve(handle, &eIter, NULL, NULL)) != RSSL_RET_BUFFER_TOO_SMALL)
+			break;
+
+		free(buffer.data);
+		bufferSize *= 2;
+	}
+
+	if (ret == RSSL_RET_SUCCESS)
+	{
+		buffer.length = rsslGetEncodedBufferLength(&eIter);
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetDecodeIteratorBuffer(&dIter, &buffer);
+		decodeDataTypeToXML(file, pEntry->dataType, &buffer, dictionary, NULL, &dIter);
+	}
+
+	free(buffer.data);
+	return ret;
+}
@@ -0,0 +1,236 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#ifndef RSSL_PAYLOAD_CACHE_IMPL_H
+#define RSSL_PAYLOAD_CACHE_IMPL_H
+
+#include "rtr/rsslPayloadCache.h"
+#include "rtr/rsslPayloadEntry.h"
+#include "rtr/rsslPayloadCursor.h"
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslHashTable.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Sets the error ID and text of an RsslCacheError, if one was provided. */
+#define RSSL_CACHE_SET_ERROR(__pError, __ret, ...) \
+	do { \
+		if (__pError) \
+		{ \
+			(__pError)->rsslErrorId = (__ret); \
+			snprintf((__pError)->text, MAX_OMM_CACHE_ERROR_TEXT, __VA_ARGS__); \
+		} \
+	} while (0)
+
+/* Pool of fixed-size objects, carved out of larger slabs.  Released objects go on a free list
+ * and are reused; the slabs themselves are only freed when the pool is cleaned up. */
+typedef struct
+{
+	size_t		objectSize;
+	RsslUInt32	objectsPerSlab;
+	void		*pSlabs;		/* Allocated slabs, linked through their first pointer. */
+	void		*pFreeList;		/* Free objects, linked through their first pointer. */
+} RsslCachePool;
+
+/* Leaves room at the start of each slab for the slab link while keeping objects aligned. */
+#define RSSL_CACHE_POOL_SLAB_HEADER 16
+
+RTR_C_INLINE void rsslCachePoolInit(RsslCachePool *pPool, size_t objectSize, RsslUInt32 objectsPerSlab)
+{
+	/* Keep objects pointer-aligned, and large enough to hold the free list link. */
+	objectSize = (objectSize + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+	pPool->objectSize = objectSize < sizeof(void*) ? sizeof(void*) : objectSize;
+	pPool->objectsPerSlab = objectsPerSlab;
+	pPool->pSlabs = NULL;
+	pPool->pFreeList = NULL;
+}
+
+RTR_C_INLINE void *rsslCachePoolGet(RsslCachePool *pPool)
+{
+	void *pObject;
+
+	if (!pPool->pFreeList)
+	{
+		RsslUInt32 i;
+		char *pSlab = (char*)malloc(RSSL_CACHE_POOL_SLAB_HEADER + pPool->objectSize * pPool->objectsPerSlab);
+
+		if (!pSlab)
+			return NULL;
+
+		*(void**)pSlab = pPool->pSlabs;
+		pPool->pSlabs = pSlab;
+
+		/* Thread the new objects onto the free list, so they are handed out in address order. */
+		for (i = pPool->objectsPerSlab; i > 0; --i)
+		{
+			void *pNew = pSlab + RSSL_CACHE_POOL_SLAB_HEADER + pPool->objectSize * (i - 1);
+			*(void**)pNew = pPool->pFreeList;
+			pPool->pFreeList = pNew;
+		}
+	}
+
+	pObject = pPool->pFreeList;
+	pPool->pFreeList = *(void**)pObject;
+	return pObject;
+}
+
+RTR_C_INLINE void rsslCachePoolPut(RsslCachePool *pPool, void *pObject)
+{
+	*(void**)pObject = pPool->pFreeList;
+	pPool->pFreeList = pObject;
+}
+
+RTR_C_INLINE void rsslCachePoolCleanup(RsslCachePool *pPool)
+{
+	while (pPool->pSlabs)
+	{
+		void *pSlab = pPool->pSlabs;
+		pPool->pSlabs = *(void**)pSlab;
+		free(pSlab);
+	}
+	pPool->pFreeList = NULL;
+}
+
+/* Field types from an RDM Field Dictionary, indexed by FieldId.  Field databases are
+ * named by their dictionary key so they can be shared between caches. */
+typedef struct
+{
+	RsslQueueLink	dbLink;			/* Link for the list of field databases. */
+	char			*dictionaryKey;
+	RsslInt32		minFid;
+	RsslInt32		maxFid;
+	RsslUInt8		*rwfTypes;		/* RWF type of each field, indexed by fieldId - minFid.  RSSL_DT_UNKNOWN if not in the dictionary. */
+} RsslCacheFieldDb;
+
+/* Returns the RWF type of a field, or RSSL_DT_UNKNOWN if the dictionary does not define it. */
+RTR_C_INLINE RsslUInt8 rsslCacheFieldDbGetType(RsslCacheFieldDb *pFieldDb, RsslFieldId fieldId)
+{
+	if (fieldId < pFieldDb->minFid || fieldId > pFieldDb->maxFid)
+		return RSSL_DT_UNKNOWN;
+	return pFieldDb->rwfTypes[fieldId - pFieldDb->minFid];
+}
+
+/* A cached field.  The encoded data is kept in the data area of its RsslCacheFieldStore. */
+typedef struct
+{
+	RsslFieldId		fieldId;
+	RsslUInt32		offset;			/* Offset of the encoded data in RsslCacheFieldStore::pData. */
+	RsslUInt32		length;			/* Length of the encoded data. Zero for blank. */
+	RsslUInt32		capacity;		/* Space reserved for the data, so updates of the same size or smaller are done in place. */
+} RsslCacheField;
+
+/* Compact store for the contents of a field list.  Fields are kept sorted by FieldId for lookup
+ * by binary search, with their encoded data packed into a single growable buffer. */
+typedef struct
+{
+	RsslCacheField	*pFields;
+	RsslUInt32		fieldCount;
+	RsslUInt32		maxFields;
+	char			*pData;
+	RsslUInt32		dataLength;		/* Bytes of pData in use, including space no longer referenced by any field. */
+	RsslUInt32		dataSize;		/* Allocated size of pData. */
+	RsslUInt32		unusedLength;	/* Bytes of pData no longer referenced by any field.  Reclaimed by compacting. */
+	RsslBool		hasInfo;		/* Whether the field list carried dictionaryId and fieldListNum. */
+	RsslInt16		dictionaryId;
+	RsslInt16		fieldListNum;
+} RsslCacheFieldStore;
+
+RTR_C_INLINE void rsslCacheFieldStoreInit(RsslCacheFieldStore *pStore)
+{
+	memset(pStore, 0, sizeof(RsslCacheFieldStore));
+}
+
+/* Removes all fields, keeping the allocated memory for reuse. */
+RTR_C_INLINE void rsslCacheFieldStoreClear(RsslCacheFieldStore *pStore)
+{
+	pStore->fieldCount = 0;
+	pStore->dataLength = 0;
+	pStore->unusedLength = 0;
+	pStore->hasInfo = RSSL_FALSE;
+}
+
+RTR_C_INLINE void rsslCacheFieldStoreCleanup(RsslCacheFieldStore *pStore)
+{
+	free(pStore->pFields);
+	free(pStore->pData);
+	rsslCacheFieldStoreInit(pStore);
+}
+
+/* Map keys up to this length are stored in the map entry itself. */
+#define RSSL_CACHE_MAP_KEY_STORAGE 32
+
+/* A cached map entry. */
+typedef struct
+{
+	RsslHashLink		hashLink;		/* Link for RsslPayloadEntryImpl::mapEntryTable, keyed by the encoded key. */
+	RsslBuffer			key;			/* Encoded key. Points to keyStorage when the key fits there. */
+	RsslBuffer			permData;
+	RsslUInt64			seqNum;			/* Order in which the entry was added.  Used to resume multi-part retrieval. */
+	RsslCacheFieldStore	fields;
+	char				keyStorage[RSSL_CACHE_MAP_KEY_STORAGE];
+} RsslCacheMapEntry;
+
+typedef struct _RsslPayloadCacheImpl RsslPayloadCacheImpl;
+
+/* A payload entry. */
+typedef struct
+{
+	RsslQueueLink		cacheLink;			/* Link for RsslPayloadCacheImpl::entryList. */
+	RsslPayloadCacheImpl *pCache;
+	RsslContainerType	dataType;
+
+	RsslCacheFieldStore	fields;				/* Field list payload, or the summary data of a map payload. */
+
+	/* Map payload */
+	RsslUInt8			mapFlags;			/* RSSL_MPF_HAS_KEY_FIELD_ID and RSSL_MPF_HAS_SUMMARY_DATA, if present. */
+	RsslUInt8			keyPrimitiveType;
+	RsslFieldId			keyFieldId;
+	RsslHashTable		mapEntryTable;
+	RsslBool			mapEntryTableInit;
+	RsslCacheMapEntry	**pMapEntries;		/* Map entries in the order they were added. */
+	RsslUInt32			mapEntryCount;
+	RsslUInt32			maxMapEntries;
+	RsslUInt32			permDataCount;		/* Number of map entries with permission data. */
+	RsslUInt64			nextSeqNum;
+} RsslPayloadEntryImpl;
+
+/* A payload cache instance. */
+struct _RsslPayloadCacheImpl
+{
+	RsslQueueLink		cacheLink;			/* Link for the list of caches. */
+	RsslPayloadCacheConfigOptions config;
+	RsslCacheFieldDb	*pFieldDb;
+	RsslQueue			entryList;
+	RsslCachePool		entryPool;
+	RsslCachePool		mapEntryPool;
+
+	char				*pScratch;			/* Working space for applying partial RMTES updates. */
+	RsslUInt32			scratchSize;
+};
+
+/* Multi-part retrieval state. */
+typedef struct
+{
+	RsslUInt32			partCount;			/* Number of parts retrieved so far. */
+	RsslUInt64			nextSeqNum;			/* Map entries with a lower seqNum have already been retrieved. */
+	RsslBool			isComplete;
+} RsslPayloadCursorImpl;
+
+/* Releases the resources of an entry and returns it to its cache's pool. Used when destroying caches. */
+void rsslPayloadEntryImplDestroy(RsslPayloadEntryImpl *pEntry);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
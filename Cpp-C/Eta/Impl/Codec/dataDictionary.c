@@ -27,7 +27,7 @@ extern "C" {
 #include "rtr/rsslPrimitiveDecoders.h"
 #include "rtr/encoderTools.h"
 #include "rtr/textFileReader.h"
-#include "rtr/rsslHashTable.h"
+#include "rtr/rsslOpenHashTable.h"
 
 #define DICTIONARY_MAX_ENTRIES 65535
 
@@ -37,7 +37,7 @@ typedef struct {
 } FieldsByNameLink;
 
 typedef struct {
-	RsslHashTable	fieldsByName;	/* Table of fields by acronym. */
+	RsslOpenHashTable	fieldsByName;	/* Table of fields by acronym. */
 
 	/* Indicate whether the entries in this dictionary are linked by another one, so we don't delete them on cleanup. */
 	RsslBool isLinked;
@@ -718,7 +718,7 @@ RsslRet _initDictionary(RsslDataDictionary *dictionary, RsslBuffer *errorText)
 
 	dictionary->_internal = pDictionaryInternal;
 
-	if ( rsslHashTableInit(&pDictionaryInternal->fieldsByName, DICTIONARY_MAX_ENTRIES, rsslHashBufferSum, rsslHashBufferCompare,
+	if ( rsslOpenHashTableInit(&pDictionaryInternal->fieldsByName, DICTIONARY_MAX_ENTRIES, rsslHashBufferSum, rsslHashBufferCompare,
 				RSSL_TRUE, &rsslErrorInfo) != RSSL_RET_SUCCESS )
 	{
 		_setError(errorText, "Failed to initailize fields-by-name table.");
@@ -814,7 +814,7 @@ RsslRet _addFieldToDictionary(RsslDataDictionary *dictionary, RsslDictionaryEntr
 	hashSum = rsslHashBufferSum(&pEntry->acronym);
 
 	/* Check if this acronym is already present. */
-	if ((rsslHashLink = rsslHashTableFind(&pDictionaryInternal->fieldsByName, &pEntry->acronym, &hashSum)) != NULL)
+	if ((rsslHashLink = rsslOpenHashTableFind(&pDictionaryInternal->fieldsByName, &pEntry->acronym, &hashSum)) != NULL)
 	{
 		pFieldsByNameLink = RSSL_HASH_LINK_TO_OBJECT(FieldsByNameLink, nameTableLink, rsslHashLink);
 		RSSL_ASSERT(pFieldsByNameLink->pDictionaryEntry != NULL, Link in fieldsByName table does not have an associated entry);
@@ -849,7 +849,7 @@ RsslRet _addFieldToDictionary(RsslDataDictionary *dictionary, RsslDictionaryEntr
 	}
 
 	pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].pDictionaryEntry = pEntry;
-	rsslHashTableInsertLink(&pDictionaryInternal->fieldsByName, &pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].nameTableLink, 
+	rsslOpenHashTableInsertLink(&pDictionaryInternal->fieldsByName, &pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].nameTableLink, 
 		&pEntry->acronym, &hashSum);
 
 	dictionary->numberOfEntries++;
@@ -1775,7 +1775,7 @@ RSSL_API RsslRet rsslDeleteDataDictionary( RsslDataDictionary *dictionary )
 		free(dictionary->enumTables);
 	}
 
-	rsslHashTableCleanup(&pDictionaryInternal->fieldsByName);
+	rsslOpenHashTableCleanup(&pDictionaryInternal->fieldsByName);
 	free(pDictionaryInternal);
 
 	dictionary->isInitialized = RSSL_FALSE;
@@ -3116,7 +3116,7 @@ RSSL_API RsslRet rsslExtractDictionaryType(RsslDecodeIterator *dIter,
 RSSL_API RsslDictionaryEntry *rsslDictionaryGetEntryByFieldName(RsslDataDictionary *pDictionary, const RsslBuffer *pFieldName)
 {
 	FieldsByNameLink *pFieldsByNameLink;
-	RsslHashLink *rsslHashLink = rsslHashTableFind(&((RsslDictionaryInternal*)pDictionary->_internal)->fieldsByName, (RsslBuffer*)pFieldName, NULL);
+	RsslHashLink *rsslHashLink = rsslOpenHashTableFind(&((RsslDictionaryInternal*)pDictionary->_internal)->fieldsByName, (RsslBuffer*)pFieldName, NULL);
 	
 	if (rsslHashLink == NULL)
 		return NULL;
@@ -3330,7 +3330,7 @@ RSSL_API RsslRet rsslLinkDataDictionary(RsslDataDictionary *pNewDictionary, Rssl
 		{
 			/* Update the entry key of FieldsByNameLink.nameTableLink as the existing key 
 			   in pNewDictionary will be replaced with the entry from pOldDictionary */
-			if ((rsslHashLink = rsslHashTableFind(&pNewDictionaryInternal->fieldsByName, &pOldEntry->acronym, NULL)) != NULL)
+			if ((rsslHashLink = rsslOpenHashTableFind(&pNewDictionaryInternal->fieldsByName, &pOldEntry->acronym, NULL)) != NULL)
 			{
 				rsslHashLink->pKey = &pOldEntry->acronym;
 			}
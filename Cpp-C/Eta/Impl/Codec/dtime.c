@@ -77,56 +77,69 @@ RsslBool timeIsBlankToStr(RsslBuffer * oBuffer, RsslBool isTime, RsslTime * iTim
 		return RSSL_FALSE; /* time not blank*/
 }
 
+/* Length of 'value' printed right aligned in at least 'width' characters, as with "%0*d" or "%*d". */
+RTR_C_INLINE int _rsslUIntFieldLength(RsslUInt32 value, int width)
+{
+	int digits = rwfUI64Digits(value);
+	return (digits > width) ? digits : width;
+}
+
+/* Writes 'value' right aligned in at least 'width' characters, padded on the left with 'padChar'.
+ * Returns the position after the field. */
+RTR_C_INLINE char* _rsslPutUIntField(char *pos, RsslUInt32 value, int width, char padChar)
+{
+	int digits = rwfUI64Digits(value);
+
+	while (width-- > digits)
+		*pos++ = padChar;
+	pos += digits;
+	rwfPutUI64Digits(pos, value, digits);
+	return pos;
+}
+
 /* Converts RsslDate to string in ISO8601 'YYYY-MM-DD' format (e.g. 2003-06-01). */
 RsslRet dateToStringIso8601(RsslBuffer * oBuffer, int *bufOffset, int *remainingLength, RsslDate *iDate )
 {
 	/* Iso8601 date */
-	RsslRet ret = 0;
-	int i;
+	int length, i;
+	char *pos = oBuffer->data + *bufOffset;
+
+	length = (iDate->year ? _rsslUIntFieldLength(iDate->year, 4) + 1 : 2)
+		+ (iDate->month ? _rsslUIntFieldLength(iDate->month, 2) + 1 : 3)
+		+ (iDate->day ? _rsslUIntFieldLength(iDate->day, 2) : 2);
+	if (length >= *remainingLength)
+		return RSSL_RET_FAILURE;
+
 	if (iDate->year)
 	{
-		ret = snprintf(oBuffer->data, *remainingLength, "%04d-", iDate->year);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;	
+		pos = _rsslPutUIntField(pos, iDate->year, 4, '0');
+		*pos++ = '-';
 	}
 	else
 	{
-		ret = snprintf(oBuffer->data, *remainingLength, "--");
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
+		*pos++ = '-'; *pos++ = '-';
 	}
-	*bufOffset += ret;
-	*remainingLength -= ret;
 
 	if (iDate->month)
 	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d-", iDate->month);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;	
+		pos = _rsslPutUIntField(pos, iDate->month, 2, '0');
+		*pos++ = '-';
 	}
 	else
 	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "  -");
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
+		*pos++ = ' '; *pos++ = ' '; *pos++ = '-';
 	}
 
-	*bufOffset += ret;
-	*remainingLength -= ret;
 	if (iDate->day)
-	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d", iDate->day);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;	
-	}
+		pos = _rsslPutUIntField(pos, iDate->day, 2, '0');
 	else
 	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "  ");
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
+		*pos++ = ' '; *pos++ = ' ';
 	}
-	*bufOffset += ret;
-	*remainingLength -= ret;
+	*pos = '\0';
+
+	*bufOffset += length;
+	*remainingLength -= length;
 	i = *bufOffset -1;
 	for(; i >= 0; --i, (*bufOffset)--, (*remainingLength)++)
 	{ /* Trim trailing non digits */
@@ -145,52 +158,46 @@ RsslRet dateToStringRssl(RsslBuffer * oBuffer, int *bufOffset, int *remainingLen
 	/* normal date */
 	/* put this into the same format as marketfeed uses where if any portion is blank, it is 
 				   represented as spaces */
-	RsslRet ret = 0;
+	int length;
+	char *pos = oBuffer->data + *bufOffset;
+
+	length = (iDate->day ? _rsslUIntFieldLength(iDate->day, 2) + 1 : 3)
+		+ 4
+		+ (iDate->year ? _rsslUIntFieldLength(iDate->year, 4) : 4);
+	if (length >= *remainingLength)
+		return RSSL_RET_FAILURE;
+
 	if (iDate->day)
 	{
-		ret = snprintf(oBuffer->data, *remainingLength, "%02d ", iDate->day);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
-
+		pos = _rsslPutUIntField(pos, iDate->day, 2, '0');
+		*pos++ = ' ';
 	}
 	else
 	{
-		ret = snprintf(oBuffer->data, *remainingLength, "   ");
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
+		memset(pos, ' ', 3);
+		pos += 3;
 	}
-	*bufOffset += ret;
-	*remainingLength -= ret;
-				
+
 	if (iDate->month)
 	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%s ", months[iDate->month - 1]);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE; 
+		memcpy(pos, months[iDate->month - 1], 3);
+		pos[3] = ' ';
 	}
 	else
-	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "    ");
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
-	}
-	*bufOffset += ret;
-	*remainingLength -= ret;
+		memset(pos, ' ', 4);
+	pos += 4;
 
 	if (iDate->year)
-	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%4d", iDate->year);
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
-	}
+		pos = _rsslPutUIntField(pos, iDate->year, 4, ' ');
 	else
 	{
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "    ");
-		if (ret < 0 || ret >= *remainingLength)
-			return RSSL_RET_FAILURE;
+		memset(pos, ' ', 4);
+		pos += 4;
 	}
-	*bufOffset += ret;
-	*remainingLength -= ret;
+	*pos = '\0';
+
+	*bufOffset += length;
+	*remainingLength -= length;
 
 	return RSSL_RET_SUCCESS;
 }
@@ -199,42 +206,57 @@ RsslRet dateToStringRssl(RsslBuffer * oBuffer, int *bufOffset, int *remainingLen
 RsslRet timeToStringIso8601Time(RsslBuffer * oBuffer, int *bufOffset, int *remainingLength, RsslTime *iTime )
 {
 	/* hour is always present */
-	RsslRet ret = 0;
+	int length = 0;
 	int i = 0;
+	char *pos = oBuffer->data + *bufOffset;
 
+	/* Sum up the portions present: hour, :minute, :second, .millisecond, microsecond, nanosecond */
+	length = _rsslUIntFieldLength(iTime->hour, 2);
 	if (iTime->minute != 255)
 	{
+		length += 1 + _rsslUIntFieldLength(iTime->minute, 2);
 		if (iTime->second != 255)
 		{
+			length += 1 + _rsslUIntFieldLength(iTime->second, 2);
 			if (iTime->millisecond != 65535)
 			{
+				length += 1 + _rsslUIntFieldLength(iTime->millisecond, 3);
 				if (iTime->microsecond != 2047)
 				{
+					length += _rsslUIntFieldLength(iTime->microsecond, 3);
 					if (iTime->nanosecond != 2047)
-					{
-						/* Second, millisecond, microsecond, nanosecond */
-						ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d:%02d:%02d.%03d%03d%03d", iTime->hour, iTime->minute, iTime->second,
-								iTime->millisecond, iTime->microsecond, iTime->nanosecond);
-					}
-					else
-					{
-						/* Second, millisecond, microsecond */
-						ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d:%02d:%02d.%03d%03d", iTime->hour, iTime->minute, iTime->second,
-								iTime->millisecond, iTime->microsecond);
-					}
+						length += _rsslUIntFieldLength(iTime->nanosecond, 3);
 				}
-				else
+			}
+		}
+	}
+
+	if (length >= *remainingLength)
+		return RSSL_RET_FAILURE;
+
+	pos = _rsslPutUIntField(pos, iTime->hour, 2, '0');
+	if (iTime->minute != 255)
+	{
+		*pos++ = ':';
+		pos = _rsslPutUIntField(pos, iTime->minute, 2, '0');
+		if (iTime->second != 255)
+		{
+			*pos++ = ':';
+			pos = _rsslPutUIntField(pos, iTime->second, 2, '0');
+			if (iTime->millisecond != 65535)
+			{
+				*pos++ = '.';
+				pos = _rsslPutUIntField(pos, iTime->millisecond, 3, '0');
+				if (iTime->microsecond != 2047)
 				{
-					/* Second, millisecond */
-					ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d:%02d:%02d.%03d", iTime->hour, iTime->minute, iTime->second,
-							iTime->millisecond);
+					pos = _rsslPutUIntField(pos, iTime->microsecond, 3, '0');
+					if (iTime->nanosecond != 2047)
+						pos = _rsslPutUIntField(pos, iTime->nanosecond, 3, '0');
 				}
+				*pos = '\0';
 
-				if (ret < 0 || ret >= *remainingLength)
-					return RSSL_RET_FAILURE;
-
-				*bufOffset += ret;
-				*remainingLength -= ret;
+				*bufOffset += length;
+				*remainingLength -= length;
 
 				i = *bufOffset -1;
 				for(; i >= 0; --i)
@@ -253,29 +275,12 @@ RsslRet timeToStringIso8601Time(RsslBuffer * oBuffer, int *bufOffset, int *remai
 
 				return RSSL_RET_SUCCESS;
 			}
-			else
-			{
-				/* Second */
-				ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d:%02d:%02d", iTime->hour, iTime->minute, iTime->second);
-			}
-		}
-		else
-		{
-			/* No seconds */
-			ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d:%02d", iTime->hour, iTime->minute);
 		}
 	}
-	else
-	{
-		/* No minutes */
-		ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d", iTime->hour);
-	}
+	*pos = '\0';
 
-	if (ret < 0 || ret >= *remainingLength)
-		return RSSL_RET_FAILURE;
-
-	*bufOffset += ret;
-	*remainingLength -= ret;
+	*bufOffset += length;
+	*remainingLength -= length;
 
 	return RSSL_RET_SUCCESS;
 }
@@ -285,67 +290,67 @@ RsslRet timeToStringRssltime(RsslBuffer * oBuffer, int *bufOffset, int *remainin
 {
 	/* have to do this piece by piece to handle the various trailing portions being blank */
 	/* hour is always present */
-	RsslRet ret = 0;
-	ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, "%02d", 
-				iTime->hour);
-	if (ret < 0 || ret >= *remainingLength)
-		return RSSL_RET_FAILURE;
-
-	*bufOffset += ret;
-	*remainingLength -= ret;
-	/* minute */
-	if (iTime->minute == 255)
-		return RSSL_RET_SUCCESS;				
-	ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, ":%02d", 
-				iTime->minute);
-	if (ret < 0 || ret >= *remainingLength)
-		return RSSL_RET_FAILURE;
+	int length;
+	char *pos = oBuffer->data + *bufOffset;
 
-	*bufOffset += ret;
-	*remainingLength -= ret;
-	/* second */
-	if (iTime->second == 255)
-		return RSSL_RET_SUCCESS;				
-	ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, ":%02d", 
-				iTime->second);
-	if (ret < 0 || ret >= *remainingLength)
-		return RSSL_RET_FAILURE;
-
-	*bufOffset += ret;
-	*remainingLength -= ret;
-	/* millisecond */
-	if (iTime->millisecond == 65535)
-		return RSSL_RET_SUCCESS;
-				
-	ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, ":%03d", 
-				iTime->millisecond);
-	if (ret < 0 || ret >= *remainingLength)
-		return RSSL_RET_FAILURE;
+	length = _rsslUIntFieldLength(iTime->hour, 2);
+	if (iTime->minute != 255)
+	{
+		length += 1 + _rsslUIntFieldLength(iTime->minute, 2);
+		if (iTime->second != 255)
+		{
+			length += 1 + _rsslUIntFieldLength(iTime->second, 2);
+			if (iTime->millisecond != 65535)
+			{
+				length += 1 + _rsslUIntFieldLength(iTime->millisecond, 3);
+				if (iTime->microsecond != 2047)
+				{
+					length += 1 + _rsslUIntFieldLength(iTime->microsecond, 3);
+					if (iTime->nanosecond != 2047)
+						length += 1 + _rsslUIntFieldLength(iTime->nanosecond, 3);
+				}
+			}
+		}
+	}
 
-	*bufOffset += ret;
-	*remainingLength -= ret;
-	/* microsecond */
-	if (iTime->microsecond == 2047)
-		return RSSL_RET_SUCCESS;
-				
-	ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, ":%03d", 
-				iTime->microsecond);
-	if (ret < 0 || ret >= *remainingLength)
+	if (length >= *remainingLength)
 		return RSSL_RET_FAILURE;
 
-	*bufOffset += ret;
-	*remainingLength -= ret;
-	/* nanosecond */
-	if (iTime->nanosecond == 2047)
-		return RSSL_RET_SUCCESS;
-				
-	ret = snprintf((oBuffer->data + *bufOffset), *remainingLength, ":%03d", 
-				iTime->nanosecond);
-	if (ret < 0 || ret >= *remainingLength)
-		return RSSL_RET_FAILURE;
+	pos = _rsslPutUIntField(pos, iTime->hour, 2, '0');
+	/* minute */
+	if (iTime->minute != 255)
+	{
+		*pos++ = ':';
+		pos = _rsslPutUIntField(pos, iTime->minute, 2, '0');
+		/* second */
+		if (iTime->second != 255)
+		{
+			*pos++ = ':';
+			pos = _rsslPutUIntField(pos, iTime->second, 2, '0');
+			/* millisecond */
+			if (iTime->millisecond != 65535)
+			{
+				*pos++ = ':';
+				pos = _rsslPutUIntField(pos, iTime->millisecond, 3, '0');
+				/* microsecond */
+				if (iTime->microsecond != 2047)
+				{
+					*pos++ = ':';
+					pos = _rsslPutUIntField(pos, iTime->microsecond, 3, '0');
+					/* nanosecond */
+					if (iTime->nanosecond != 2047)
+					{
+						*pos++ = ':';
+						pos = _rsslPutUIntField(pos, iTime->nanosecond, 3, '0');
+					}
+				}
+			}
+		}
+	}
+	*pos = '\0';
 
-	*bufOffset += ret;
-	*remainingLength -= ret;
+	*bufOffset += length;
+	*remainingLength -= length;
 
 	return RSSL_RET_SUCCESS;
 }
@@ -1771,9 +1776,11 @@ RSSL_API RsslRet rsslDateTimeToStringFormat(RsslBuffer * oBuffer, RsslUInt8 data
 					return RSSL_RET_SUCCESS;
 
 				/* Put in Time delimiter 'T' for ISO8601 first */
-				ret = snprintf((oBuffer->data + bufOffset), remainingLength, "T");
-				if (ret < 0 || ret >= remainingLength)
+				ret = 1;
+				if (ret >= remainingLength)
 					return RSSL_RET_FAILURE;
+				oBuffer->data[bufOffset] = 'T';
+				oBuffer->data[bufOffset + 1] = '\0';
 
 				bufOffset += ret;
 				remainingLength -= ret;
@@ -1784,9 +1791,11 @@ RSSL_API RsslRet rsslDateTimeToStringFormat(RsslBuffer * oBuffer, RsslUInt8 data
 			else if( format == RSSL_STR_DATETIME_RSSL )
 			{
 				/* Put in a space first */
-				ret = snprintf((oBuffer->data + bufOffset), remainingLength, " "); 
-				if (ret < 0 || ret >= remainingLength)
+				ret = 1;
+				if (ret >= remainingLength)
 					return RSSL_RET_FAILURE;
+				oBuffer->data[bufOffset] = ' ';
+				oBuffer->data[bufOffset + 1] = '\0';
 
 				bufOffset += ret;
 				remainingLength -= ret;
@@ -0,0 +1,224 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslFieldList.h"
+#include "rtr/rsslPrimitiveDecoders.h"
+#include "rtr/decoderTools.h"
+
+/* Decodes the content of a standard entry into a column's row.  Content is length specified, so the value is read
+ * directly from the entry; this mirrors the Int, UInt and Real primitive decoders. */
+RTR_C_INLINE RsslUInt8 _rsslDecodeColumnValue(RsslFieldColumn *pColumn, RsslUInt32 row, char *data, RsslUInt32 length)
+{
+	RsslUInt8 format;
+	RsslUInt8 hint;
+
+	switch (pColumn->dataType)
+	{
+		case RSSL_DT_INT:
+			if (length > 8)
+				return RSSL_FCS_INVALID;
+			rwfGetLenSpecI64Size(&pColumn->intValues[row], data, (rtrUInt8)length);
+			return (length == 0) ? RSSL_FCS_BLANK : RSSL_FCS_PRESENT;
+
+		case RSSL_DT_UINT:
+			if (length > 8)
+				return RSSL_FCS_INVALID;
+			rwfGetLenSpecU64Size(&pColumn->uintValues[row], data, (rtrUInt8)length);
+			return (length == 0) ? RSSL_FCS_BLANK : RSSL_FCS_PRESENT;
+
+		case RSSL_DT_REAL:
+			if (length <= 1)
+			{
+				/* Empty, blank, or one of the special values, which have no mantissa. */
+				format = (length == 1) ? (RsslUInt8)(*data & 0x3F) : 0;
+				pColumn->intValues[row] = 0;
+				hint = (format >= RSSL_RH_INFINITY && format <= RSSL_RH_NOT_A_NUMBER) ? format : 0;
+				if (pColumn->hints)
+					pColumn->hints[row] = hint;
+				return hint ? RSSL_FCS_PRESENT : RSSL_FCS_BLANK;
+			}
+
+			if (length > 9 || rwfGetReal64(&pColumn->intValues[row], &format, (rtrUInt16)length, data) <= 0)
+				return RSSL_FCS_INVALID;
+
+			hint = format & 0x3F;
+			if (hint < RSSL_RH_INFINITY || hint > RSSL_RH_NOT_A_NUMBER)
+			{
+				if (format & 0x20)
+				{
+					pColumn->intValues[row] = 0;
+					if (pColumn->hints)
+						pColumn->hints[row] = 0;
+					return RSSL_FCS_BLANK;
+				}
+				hint &= 0x1F;
+			}
+			if (pColumn->hints)
+				pColumn->hints[row] = hint;
+			return RSSL_FCS_PRESENT;
+
+		default:
+			return RSSL_FCS_INVALID;
+	}
+}
+
+/* Decodes a field list with set defined data into a row, using the iterator functions so that set encodings are handled. */
+static RsslRet _rsslDecodeColumnsWithIterator(RsslFieldColumnBatch *pBatch, RsslUInt32 row, const RsslBuffer *pEncFieldList, RsslLocalFieldSetDefDb *pLocalSetDb)
+{
+	RsslDecodeIterator	iter;
+	RsslBuffer			encFieldList = *pEncFieldList;
+	RsslFieldList		fieldList;
+	RsslFieldEntry		fieldEntry;
+	RsslReal			real;
+	RsslUInt32			c;
+	RsslRet				ret;
+
+	rsslClearDecodeIterator(&iter);
+	rsslSetDecodeIteratorBuffer(&iter, &encFieldList);
+
+	if ((ret = rsslDecodeFieldList(&iter, &fieldList, pLocalSetDb)) < RSSL_RET_SUCCESS)
+		return ret;
+	if (ret == RSSL_RET_NO_DATA)
+		return RSSL_RET_SUCCESS;
+
+	while ((ret = rsslDecodeFieldEntry(&iter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+
+		for (c = 0; c < pBatch->columnCount; ++c)
+		{
+			RsslFieldColumn *pColumn = &pBatch->columns[c];
+
+			if (pColumn->fieldId != fieldEntry.fieldId)
+				continue;
+
+			switch (pColumn->dataType)
+			{
+				case RSSL_DT_INT:
+					ret = rsslDecodeInt(&iter, &pColumn->intValues[row]);
+					break;
+				case RSSL_DT_UINT:
+					ret = rsslDecodeUInt(&iter, &pColumn->uintValues[row]);
+					break;
+				case RSSL_DT_REAL:
+					if ((ret = rsslDecodeReal(&iter, &real)) == RSSL_RET_SUCCESS && real.isBlank)
+						ret = RSSL_RET_BLANK_DATA;
+					pColumn->intValues[row] = real.value;
+					if (pColumn->hints)
+						pColumn->hints[row] = real.hint;
+					break;
+				default:
+					ret = RSSL_RET_UNSUPPORTED_DATA_TYPE;
+					break;
+			}
+
+			pColumn->status[row] = (ret == RSSL_RET_SUCCESS) ? RSSL_FCS_PRESENT : (ret == RSSL_RET_BLANK_DATA) ? RSSL_FCS_BLANK : RSSL_FCS_INVALID;
+			break;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Bit for a field id in the filter that lets most entries skip the search of the columns. */
+#define _rsslColumnFilterBit(fieldId) (RTR_ULL(1) << ((RsslUInt16)(fieldId) & 0x3F))
+
+static RsslRet _rsslDecodeColumnsRow(RsslFieldColumnBatch *pBatch, RsslUInt64 columnFilter, RsslUInt32 row, const RsslBuffer *pEncFieldList, RsslLocalFieldSetDefDb *pLocalSetDb)
+{
+	char		*position = pEncFieldList->data;
+	char		*endPtr = position + pEncFieldList->length;
+	RsslUInt8	flags;
+	RsslUInt16	count;
+	RsslUInt32	c;
+
+	if (pEncFieldList->length == 0)
+		return RSSL_RET_SUCCESS;
+
+	position += rwfGet8(flags, position);
+
+	if (flags & RSSL_FLF_HAS_SET_DATA)
+		return _rsslDecodeColumnsWithIterator(pBatch, row, pEncFieldList, pLocalSetDb);
+
+	if (flags & RSSL_FLF_HAS_FIELD_LIST_INFO)
+	{
+		RsslUInt8 infoLen;
+		position += rwfGet8(infoLen, position);
+		position += infoLen;
+	}
+
+	if (!(flags & RSSL_FLF_HAS_STANDARD_DATA))
+		return RSSL_RET_SUCCESS;
+
+	if (endPtr - position < 2)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	position += rwfGet16(count, position);
+
+	for (; count > 0; --count)
+	{
+		RsslFieldId	fieldId;
+		RsslBuffer	encData;
+
+		if (endPtr - position < 3)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		position += rwfGet16(fieldId, position);
+		position += rwfGetBuffer16(&encData, position);
+		if (position > endPtr)
+			return RSSL_RET_INCOMPLETE_DATA;
+
+		if (!(columnFilter & _rsslColumnFilterBit(fieldId)))
+			continue;
+
+		for (c = 0; c < pBatch->columnCount; ++c)
+		{
+			if (pBatch->columns[c].fieldId == fieldId)
+			{
+				pBatch->columns[c].status[row] = _rsslDecodeColumnValue(&pBatch->columns[c], row, encData.data, encData.length);
+				break;
+			}
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslDecodeFieldListColumns(
+				RsslFieldColumnBatch	*pBatch,
+				const RsslBuffer		*pEncFieldLists,
+				RsslUInt32				fieldListCount,
+				RsslLocalFieldSetDefDb	*pLocalSetDb )
+{
+	RsslUInt32	i, c;
+	RsslUInt64	columnFilter = 0;
+	RsslRet		ret;
+
+	RSSL_ASSERT(pBatch && (pEncFieldLists || fieldListCount == 0), Invalid parameters or parameters passed in as NULL);
+
+	if (pBatch->rowCount > pBatch->maxRows || fieldListCount > pBatch->maxRows - pBatch->rowCount)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	for (c = 0; c < pBatch->columnCount; ++c)
+		columnFilter |= _rsslColumnFilterBit(pBatch->columns[c].fieldId);
+
+	for (i = 0; i < fieldListCount; ++i)
+	{
+		RsslUInt32 row = pBatch->rowCount;
+
+		for (c = 0; c < pBatch->columnCount; ++c)
+			pBatch->columns[c].status[row] = RSSL_FCS_ABSENT;
+
+		if ((ret = _rsslDecodeColumnsRow(pBatch, columnFilter, row, &pEncFieldLists[i], pLocalSetDb)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		++pBatch->rowCount;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
@@ -134,7 +134,9 @@ RSSL_API RsslRet rsslDecodeFieldList(
 		else
 		{
 			_levelInfo->_setCount = 0;
-			_levelInfo->_nextEntryPtr = /* oIter->_curBufPtr = */ position + oFieldList->encSetData.length;
+			/* When standard data follows, position is already past the set data. */
+			_levelInfo->_nextEntryPtr = /* oIter->_curBufPtr = */ 
+				oFieldList->encEntries.data ? oFieldList->encEntries.data : position + oFieldList->encSetData.length;
 			return RSSL_RET_SET_SKIPPED;
 		}
 	}
@@ -241,6 +243,169 @@ RSSL_API RsslRet rsslDecodeFieldEntry(
 	return RSSL_RET_SUCCESS;
 }
 
+/* Start of the entries of the field list at this level: the set data when the set definition is known, otherwise the standard entries. */
+RTR_C_INLINE char *_rsslFieldListIndexBase(RsslDecodingLevel *_levelInfo)
+{
+	RsslFieldList *fieldList = (RsslFieldList*)_levelInfo->_listType;
+	return (_levelInfo->_setCount > 0) ? fieldList->encSetData.data : fieldList->encEntries.data;
+}
+
+RTR_C_INLINE RsslUInt32 _rsslFieldIndexBucket(const RsslFieldListIndex *pIndex, RsslFieldId fieldId)
+{
+	return ((((RsslUInt32)(RsslUInt16)fieldId * 2654435761U) >> 16) & (pIndex->bucketCount - 1));
+}
+
+RSSL_API RsslRet rsslIndexFieldList(
+				RsslDecodeIterator	*iIter,
+				RsslFieldListIndex	*oIndex )
+{
+	RsslDecodingLevel	*_levelInfo;
+	RsslDecodingLevel	savedLevel;
+	char				*savedCurBufPtr;
+	char				*savedEntryEndPtr;
+	char				*base;
+	RsslFieldEntry		fieldEntry;
+	RsslUInt32			i;
+	RsslRet				ret = RSSL_RET_SUCCESS;
+
+	RSSL_ASSERT(iIter && oIndex, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(iIter->_decodingLevel > -1 && iIter->_decodingLevel < RSSL_ITER_MAX_LEVELS - 1, Invalid or incorrect iterator used);
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+
+	if (_levelInfo->_containerType != RSSL_DT_FIELD_LIST || !_levelInfo->_listType
+			|| oIndex->bucketCount == 0 || (oIndex->bucketCount & (oIndex->bucketCount - 1)) != 0)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	oIndex->entryCount = _levelInfo->_itemCount;
+	oIndex->_base = base = _rsslFieldListIndexBase(_levelInfo);
+
+	if (_levelInfo->_itemCount > oIndex->maxEntries)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	memset(oIndex->buckets, 0, oIndex->bucketCount * sizeof(RsslUInt32));
+
+	/* Walk the list from its first entry with the normal entry decoder, then put the iterator back where the application left it. */
+	savedLevel = *_levelInfo;
+	savedCurBufPtr = iIter->_curBufPtr;
+	savedEntryEndPtr = iIter->_levelInfo[iIter->_decodingLevel+1]._endBufPtr;
+
+	_levelInfo->_nextItemPosition = 0;
+	_levelInfo->_nextSetPosition = 0;
+	_levelInfo->_nextEntryPtr = base;
+
+	for (i = 0; i < oIndex->entryCount; ++i)
+	{
+		RsslFieldIndexEntry *pEntry = &oIndex->entries[i];
+
+		if ((ret = rsslDecodeFieldEntry(iIter, &fieldEntry)) != RSSL_RET_SUCCESS)
+			break;
+
+		pEntry->fieldId = fieldEntry.fieldId;
+		pEntry->dataType = fieldEntry.dataType;
+		pEntry->_offset = (RsslUInt32)(iIter->_curBufPtr - base);
+		pEntry->_length = (RsslUInt32)(iIter->_levelInfo[iIter->_decodingLevel+1]._endBufPtr - iIter->_curBufPtr);
+		pEntry->_nextOffset = (RsslUInt32)(_levelInfo->_nextEntryPtr - base);
+	}
+
+	*_levelInfo = savedLevel;
+	iIter->_curBufPtr = savedCurBufPtr;
+	iIter->_levelInfo[iIter->_decodingLevel+1]._endBufPtr = savedEntryEndPtr;
+
+	if (ret != RSSL_RET_SUCCESS)
+	{
+		oIndex->entryCount = 0;
+		return ret;
+	}
+
+	/* Chain the entries from the back, so each bucket lists its entries in the order of the list. */
+	for (i = oIndex->entryCount; i > 0; --i)
+	{
+		RsslUInt32 bucket = _rsslFieldIndexBucket(oIndex, oIndex->entries[i-1].fieldId);
+		oIndex->entries[i-1]._nextInBucket = oIndex->buckets[bucket];
+		oIndex->buckets[bucket] = i;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslInt32 rsslFindFieldIndexEntry(
+				const RsslFieldListIndex	*iIndex,
+				RsslFieldId					fieldId,
+				RsslUInt32					startEntry )
+{
+	RsslUInt32 entryNum;
+
+	RSSL_ASSERT(iIndex, Invalid parameters or parameters passed in as NULL);
+
+	if (iIndex->entryCount == 0)
+		return -1;
+
+	for (entryNum = iIndex->buckets[_rsslFieldIndexBucket(iIndex, fieldId)]; entryNum != 0; entryNum = iIndex->entries[entryNum-1]._nextInBucket)
+	{
+		if (entryNum > startEntry && iIndex->entries[entryNum-1].fieldId == fieldId)
+			return (RsslInt32)(entryNum - 1);
+	}
+
+	return -1;
+}
+
+RSSL_API RsslRet rsslDecodeFieldEntryFromIndex(
+				RsslDecodeIterator			*iIter,
+				const RsslFieldListIndex	*iIndex,
+				RsslUInt32					entryNum,
+				RsslFieldEntry				*oField )
+{
+	RsslDecodingLevel			*_levelInfo;
+	const RsslFieldIndexEntry	*pEntry;
+	char						*base;
+
+	RSSL_ASSERT(iIter && iIndex && oField, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(iIter->_decodingLevel < RSSL_ITER_MAX_LEVELS - 1, Invalid or incorrect iterator used);
+
+	/* The field list may already have been decoded to its end, which pops the level. */
+	if (iIter->_decodingLevel < 0)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+
+	if (_levelInfo->_containerType != RSSL_DT_FIELD_LIST || !_levelInfo->_listType
+			|| entryNum >= iIndex->entryCount || iIndex->entryCount != _levelInfo->_itemCount
+			|| (base = _rsslFieldListIndexBase(_levelInfo)) != iIndex->_base)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	pEntry = &iIndex->entries[entryNum];
+
+	oField->fieldId = pEntry->fieldId;
+	oField->dataType = pEntry->dataType;
+	oField->encData.length = pEntry->_length;
+	/* Set entries report empty content with no data pointer, as their decoders do. */
+	oField->encData.data = (entryNum < _levelInfo->_setCount && pEntry->_length == 0) ? 0 : base + pEntry->_offset;
+
+	/* Leave the iterator as rsslDecodeFieldEntry() would after this entry. */
+	iIter->_curBufPtr = base + pEntry->_offset;
+	iIter->_levelInfo[iIter->_decodingLevel+1]._endBufPtr = base + pEntry->_offset + pEntry->_length;
+	_levelInfo->_nextEntryPtr = base + pEntry->_nextOffset;
+	_levelInfo->_nextItemPosition = (RsslUInt16)(entryNum + 1);
+	_levelInfo->_nextSetPosition = (entryNum + 1 < _levelInfo->_setCount) ? (RsslUInt16)(entryNum + 1) : _levelInfo->_setCount;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslDecodeFieldEntryByFid(
+				RsslDecodeIterator			*iIter,
+				const RsslFieldListIndex	*iIndex,
+				RsslFieldId					fieldId,
+				RsslFieldEntry				*oField )
+{
+	RsslInt32 entryNum;
+
+	if ((entryNum = rsslFindFieldIndexEntry(iIndex, fieldId, 0)) < 0)
+		return RSSL_RET_END_OF_CONTAINER;
+
+	return rsslDecodeFieldEntryFromIndex(iIter, iIndex, (RsslUInt32)entryNum, oField);
+}
+
 RSSL_API RsslRet rsslDecodeLocalFieldSetDefDb(
 				RsslDecodeIterator				*pIter,
 				RsslLocalFieldSetDefDb			*oLocalSetDb )
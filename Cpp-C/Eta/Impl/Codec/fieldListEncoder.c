@@ -447,6 +447,53 @@ RSSL_API RsslRet rsslEncodeFieldEntry(
 	}
 }
 
+/* Fixed-width field entry encoding, for message templates */
+
+RSSL_API RsslRet rsslEncodeFieldEntrySlot(
+				RsslEncodeIterator	*pIter,
+				RsslFieldEntry		*pField,
+				const void			*pData )
+{
+	RsslFieldEntry slotEntry;
+	char content[9];
+	const RsslReal *pReal;
+
+	RSSL_ASSERT(pIter && pField && pData, Invalid parameters or parameters passed in as NULL);
+
+	/* Set types are already fixed or variable width, so encode as usual. */
+	if (pIter->_levelInfo[pIter->_encodingLevel]._encodingState == RSSL_EIS_SET_DATA)
+		return rsslEncodeFieldEntry(pIter, pField, pData);
+
+	slotEntry = *pField;
+	slotEntry.encData.data = content;
+
+	switch (pField->dataType)
+	{
+		case RSSL_DT_INT:
+			rwfPut64(content, *(const RsslInt*)pData);
+			slotEntry.encData.length = 8;
+			break;
+
+		case RSSL_DT_UINT:
+			rwfPut64(content, *(const RsslUInt*)pData);
+			slotEntry.encData.length = 8;
+			break;
+
+		case RSSL_DT_REAL:
+			/* Format byte, then the mantissa at full width; a blank Real keeps its width so it can be patched. */
+			pReal = (const RsslReal*)pData;
+			rwfPut8(content, (pReal->isBlank ? 0x20 : pReal->hint));
+			rwfPut64((content + 1), (pReal->isBlank ? 0 : pReal->value));
+			slotEntry.encData.length = 9;
+			break;
+
+		default:
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+
+	return rsslEncodeFieldEntry(pIter, &slotEntry, NULL);
+}
+
 /* Multi-step field list encoding */
 
 RSSL_API RsslRet rsslEncodeFieldEntryInit( 
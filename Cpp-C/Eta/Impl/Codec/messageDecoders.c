@@ -113,31 +113,10 @@ RsslRet RTR_FASTCALL rsslDecodeBaseKey(RsslMsgKey * key, const char * data)
 	return (RsslRet)(position - data);
 }
 
-RSSL_API RsslRet rsslDecodeMsg(RsslDecodeIterator * dIter, RsslMsg * msg)
+/* Positions the iterator on the payload of a message whose header has been consumed. */
+RTR_C_INLINE RsslRet _rsslDecodeMsgDataBody(RsslDecodeIterator * dIter, RsslMsg * msg, RsslDecodingLevel *_levelInfo)
 {
-	RsslRet ret = 0;
-	char * position;
-	RsslDecodingLevel *_levelInfo;
-
-	RSSL_ASSERT(dIter, Invalid parameters or parameters passed in as NULL);
-	RSSL_ASSERT(msg, Invalid parameters or parameters passed in as NULL);
-	RSSL_ASSERT(dIter->_pBuffer, Invalid parameters or parameters passed in as NULL);
-
-	if (++dIter->_decodingLevel >= RSSL_ITER_MAX_LEVELS) return RSSL_RET_ITERATOR_OVERRUN;
- 	_levelInfo = &dIter->_levelInfo[dIter->_decodingLevel];
-	_levelInfo->_containerType = RSSL_DT_MSG;
-
-	if (_levelInfo->_endBufPtr - dIter->_curBufPtr == 0)
-	{
-		return RSSL_RET_INCOMPLETE_DATA;
-	}
-
-	if ((ret = rsslDecodeMsgHeader(dIter, msg)) < 0)
-		return(RSSL_RET_FAILURE);
-
-	/* Maintain this use of the position variable for now, in case there is public use of this function. */
-	dIter->_curBufPtr += ret;
-	position = dIter->_curBufPtr;
+	char * position = dIter->_curBufPtr;
 
 	if(position > _levelInfo->_endBufPtr)
 		return RSSL_RET_INCOMPLETE_DATA;
@@ -171,6 +150,117 @@ RSSL_API RsslRet rsslDecodeMsg(RsslDecodeIterator * dIter, RsslMsg * msg)
 	}
 }
 
+RSSL_API RsslRet rsslDecodeMsg(RsslDecodeIterator * dIter, RsslMsg * msg)
+{
+	RsslRet ret = 0;
+	RsslDecodingLevel *_levelInfo;
+
+	RSSL_ASSERT(dIter, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(msg, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(dIter->_pBuffer, Invalid parameters or parameters passed in as NULL);
+
+	if (++dIter->_decodingLevel >= RSSL_ITER_MAX_LEVELS) return RSSL_RET_ITERATOR_OVERRUN;
+ 	_levelInfo = &dIter->_levelInfo[dIter->_decodingLevel];
+	_levelInfo->_containerType = RSSL_DT_MSG;
+
+	if (_levelInfo->_endBufPtr - dIter->_curBufPtr == 0)
+	{
+		return RSSL_RET_INCOMPLETE_DATA;
+	}
+
+	if ((ret = rsslDecodeMsgHeader(dIter, msg)) < 0)
+		return(RSSL_RET_FAILURE);
+
+	/* move past the header */
+	dIter->_curBufPtr += ret;
+
+	return _rsslDecodeMsgDataBody(dIter, msg, _levelInfo);
+}
+
+RSSL_API RsslRet rsslDecodeMsgLazy(RsslDecodeIterator * dIter, RsslMsg * msg)
+{
+	char *position;
+	RsslUInt16 headerSize = 0;
+	RsslUInt16 flags = 0;
+	RsslDecodingLevel *_levelInfo;
+
+	RSSL_ASSERT(dIter, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(msg, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(dIter->_pBuffer, Invalid parameters or parameters passed in as NULL);
+
+	if (++dIter->_decodingLevel >= RSSL_ITER_MAX_LEVELS) return RSSL_RET_ITERATOR_OVERRUN;
+ 	_levelInfo = &dIter->_levelInfo[dIter->_decodingLevel];
+	_levelInfo->_containerType = RSSL_DT_MSG;
+
+	if (_levelInfo->_endBufPtr - dIter->_curBufPtr == 0)
+	{
+		return RSSL_RET_INCOMPLETE_DATA;
+	}
+
+	position = dIter->_curBufPtr;
+
+	/* header size */
+	position += rwfGet16(headerSize, position);
+
+	/* ensure there is enough data to decode the header */
+	if ((position + headerSize) > _levelInfo->_endBufPtr)
+		return RSSL_RET_FAILURE;
+
+	/* Every message class starts with the same fixed prefix. */
+	position += rwfGet8(msg->msgBase.msgClass, position);
+	msg->msgBase.msgClass &= 0x1F;
+	position += rwfGet8(msg->msgBase.domainType, position);
+	position += rwfGet32(msg->msgBase.streamId, position);
+	position += rwfGetResBitU15(&flags, position);
+	position += rwfGet8(msg->msgBase.containerType, position);
+	msg->msgBase.containerType += RSSL_DT_CONTAINER_TYPE_MIN;
+
+	switch (msg->msgBase.msgClass)
+	{
+	case RSSL_MC_UPDATE:
+		msg->updateMsg.flags = flags;
+		rwfGet8(msg->updateMsg.updateType, position);
+		break;
+	case RSSL_MC_GENERIC: msg->genericMsg.flags = flags; break;
+	case RSSL_MC_REFRESH: msg->refreshMsg.flags = flags; break;
+	case RSSL_MC_POST: msg->postMsg.flags = flags; break;
+	case RSSL_MC_REQUEST: msg->requestMsg.flags = flags; break;
+	case RSSL_MC_STATUS: msg->statusMsg.flags = flags; break;
+	case RSSL_MC_CLOSE: msg->closeMsg.flags = flags; break;
+	case RSSL_MC_ACK: msg->ackMsg.flags = flags; break;
+	default:
+		return RSSL_RET_FAILURE;
+	}
+
+	msg->msgBase.encMsgBuffer.data = dIter->_curBufPtr;
+	msg->msgBase.encMsgBuffer.length = (rtrUInt32)(_levelInfo->_endBufPtr - dIter->_curBufPtr);
+
+	/* move past the header */
+	dIter->_curBufPtr += headerSize + 2;
+
+	return _rsslDecodeMsgDataBody(dIter, msg, _levelInfo);
+}
+
+RSSL_API RsslRet rsslCompleteLazyMsg(RsslMsg * msg)
+{
+	RsslDecodeIterator dIter;
+
+	RSSL_ASSERT(msg, Invalid parameters or parameters passed in as NULL);
+
+	if (msg->msgBase.encMsgBuffer.length < 2)
+		return RSSL_RET_INCOMPLETE_DATA;
+
+	/* rsslDecodeMsgHeader() only reads the current position and the end of the outermost level. */
+	dIter._curBufPtr = msg->msgBase.encMsgBuffer.data;
+	dIter._decodingLevel = 0;
+	dIter._levelInfo[0]._endBufPtr = msg->msgBase.encMsgBuffer.data + msg->msgBase.encMsgBuffer.length;
+
+	if (rsslDecodeMsgHeader(&dIter, msg) < 0)
+		return RSSL_RET_FAILURE;
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslDecodeDataSection(RsslMsg * msg, const RsslBuffer * buffer)
 {
 	msg->msgBase.encDataBody.length = buffer->length;
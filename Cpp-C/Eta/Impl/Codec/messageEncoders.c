@@ -2385,14 +2385,14 @@ RSSL_API RsslRet rsslReplaceGroupId(
 	return RSSL_RET_SUCCESS;
 }
 
-RSSL_API RsslRet rsslReplaceSeqNum(
-                     RsslEncodeIterator		*pIter,
-                     RsslUInt32 			seqNum )
+/* Finds the position of the sequence number in an encoded message. */
+RTR_C_INLINE RsslRet		_rsslSeqNumPos(
+					char **					pos,
+					RsslBuffer *			pEncodedMessageBuffer )
 {
 	RsslUInt8 msgClass;
 	RsslUInt16 mFlags;
 	RsslBuffer tempBuf;
-	RsslBuffer *pEncodedMessageBuffer = pIter->_pBuffer;
 
 	char * position;
 
@@ -2475,6 +2475,20 @@ RSSL_API RsslRet rsslReplaceSeqNum(
 			return RSSL_RET_FAILURE;
 	}
 
+	*pos = position;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslReplaceSeqNum(
+                     RsslEncodeIterator		*pIter,
+                     RsslUInt32 			seqNum )
+{
+	RsslRet ret;
+	char * position;
+
+	if ((ret = _rsslSeqNumPos(&position, pIter->_pBuffer)) < 0)
+		return ret;
+
 	/* at correct position, replace seqNum */
 	rwfPut32(position, seqNum);
 
@@ -2822,3 +2836,171 @@ RSSL_API RsslRet rsslUnsetGenericCompleteFlag( RsslEncodeIterator		*pIter )
 }
 
 
+
+RSSL_API RsslRet rsslInitMsgTemplate(
+                     RsslMsgTemplate		*pTemplate,
+                     RsslBuffer				*pEncMsg,
+                     RsslUInt8				majorVersion,
+                     RsslUInt8				minorVersion,
+                     RsslLocalFieldSetDefDb	*pLocalSetDb )
+{
+	RsslDecodeIterator dIter;
+	RsslMsg msg;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt32 i, slotsFound = 0;
+	char * position;
+	RsslRet ret;
+
+	RSSL_ASSERT(pTemplate && pEncMsg && pEncMsg->data, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(pTemplate->slots || pTemplate->slotCount == 0, Invalid parameters or parameters passed in as NULL);
+
+	pTemplate->encMsg = *pEncMsg;
+	pTemplate->_seqNumOffset = (_rsslSeqNumPos(&position, pEncMsg) == RSSL_RET_SUCCESS) ? (RsslInt32)(position - pEncMsg->data) : -1;
+
+	/* An offset of zero marks a slot that has not been found; content always follows the message header. */
+	for (i = 0; i < pTemplate->slotCount; ++i)
+		pTemplate->slots[i]._offset = 0;
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, majorVersion, minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, pEncMsg);
+
+	if ((ret = rsslDecodeMsg(&dIter, &msg)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if (msg.msgBase.containerType != RSSL_DT_FIELD_LIST)
+		return RSSL_RET_INVALID_DATA;
+
+	if ((ret = rsslDecodeFieldList(&dIter, &fieldList, pLocalSetDb)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	while (ret != RSSL_RET_NO_DATA && (ret = rsslDecodeFieldEntry(&dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+
+		for (i = 0; i < pTemplate->slotCount; ++i)
+		{
+			RsslMsgTemplateSlot *pSlot = &pTemplate->slots[i];
+
+			if (pSlot->fieldId != fieldEntry.fieldId || pSlot->_offset)
+				continue;
+
+			/* Set defined entries report their type; standard entries do not, so only the width can be checked. */
+			if (fieldEntry.dataType != RSSL_DT_UNKNOWN && (fieldEntry.dataType != pSlot->dataType || pSlot->dataType == RSSL_DT_REAL))
+				return RSSL_RET_INVALID_DATA;
+
+			switch (pSlot->dataType)
+			{
+				case RSSL_DT_INT:
+				case RSSL_DT_UINT:
+					if (fieldEntry.encData.length != 8)
+						return RSSL_RET_INVALID_DATA;
+					break;
+				case RSSL_DT_REAL:
+					if (fieldEntry.encData.length != 9)
+						return RSSL_RET_INVALID_DATA;
+					break;
+				default:
+					return RSSL_RET_INVALID_DATA;
+			}
+
+			pSlot->_offset = (RsslUInt32)(fieldEntry.encData.data - pEncMsg->data);
+			++slotsFound;
+			break;
+		}
+	}
+
+	return (slotsFound == pTemplate->slotCount) ? RSSL_RET_SUCCESS : RSSL_RET_INVALID_DATA;
+}
+
+RSSL_API RsslRet rsslMsgTemplateCopy(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer )
+{
+	RSSL_ASSERT(pTemplate && pMsgBuffer && pMsgBuffer->data, Invalid parameters or parameters passed in as NULL);
+
+	if (pMsgBuffer->length < pTemplate->encMsg.length)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	memcpy(pMsgBuffer->data, pTemplate->encMsg.data, pTemplate->encMsg.length);
+	pMsgBuffer->length = pTemplate->encMsg.length;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMsgTemplateSetStreamId(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslInt32				streamId )
+{
+	RSSL_ASSERT(pTemplate && pMsgBuffer && pMsgBuffer->data, Invalid parameters or parameters passed in as NULL);
+
+	rwfPut32((pMsgBuffer->data + _RSSL_MSG_STREAMID_POS), streamId);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMsgTemplateSetSeqNum(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslUInt32				seqNum )
+{
+	RSSL_ASSERT(pTemplate && pMsgBuffer && pMsgBuffer->data, Invalid parameters or parameters passed in as NULL);
+
+	if (pTemplate->_seqNumOffset < 0)
+		return RSSL_RET_FAILURE;
+
+	rwfPut32((pMsgBuffer->data + pTemplate->_seqNumOffset), seqNum);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMsgTemplateSetInt(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslUInt32				slot,
+                     RsslInt64				value )
+{
+	RSSL_ASSERT(pTemplate && pMsgBuffer && pMsgBuffer->data, Invalid parameters or parameters passed in as NULL);
+
+	if (slot >= pTemplate->slotCount || pTemplate->slots[slot].dataType != RSSL_DT_INT)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	rwfPut64((pMsgBuffer->data + pTemplate->slots[slot]._offset), value);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMsgTemplateSetUInt(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslUInt32				slot,
+                     RsslUInt64				value )
+{
+	RSSL_ASSERT(pTemplate && pMsgBuffer && pMsgBuffer->data, Invalid parameters or parameters passed in as NULL);
+
+	if (slot >= pTemplate->slotCount || pTemplate->slots[slot].dataType != RSSL_DT_UINT)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	rwfPut64((pMsgBuffer->data + pTemplate->slots[slot]._offset), value);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslMsgTemplateSetReal(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslUInt32				slot,
+                     const RsslReal			*pReal )
+{
+	char * position;
+
+	RSSL_ASSERT(pTemplate && pMsgBuffer && pMsgBuffer->data && pReal, Invalid parameters or parameters passed in as NULL);
+
+	if (slot >= pTemplate->slotCount || pTemplate->slots[slot].dataType != RSSL_DT_REAL)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	/* Format byte, then the full width mantissa, as written by rsslEncodeFieldEntrySlot(). */
+	position = pMsgBuffer->data + pTemplate->slots[slot]._offset;
+	rwfPut8(position, (pReal->isBlank ? 0x20 : pReal->hint));
+	rwfPut64((position + 1), (pReal->isBlank ? 0 : pReal->value));
+	return RSSL_RET_SUCCESS;
+}
@@ -196,9 +196,7 @@ RSSL_API RsslRet rsslFloatToReal(RsslReal * oReal, RsslFloat * iValue, RsslUInt8
 
 RSSL_API RsslRet rsslRealToString(RsslBuffer * buffer, RsslReal * iReal)
 {
-	char tbuf[64];
-	char *ret;
-	RsslUInt32 length;
+	int length;
 
 	RSSL_ASSERT(buffer, Invalid parameters or parameters passed in as NULL);
 	if (!iReal)
@@ -206,21 +204,18 @@ RSSL_API RsslRet rsslRealToString(RsslBuffer * buffer, RsslReal * iReal)
 		buffer->length = 0;
 		if (buffer->data)
 			buffer->data[0] = '\0';
+		return RSSL_RET_INVALID_ARGUMENT;
 	}
-		
-	ret = rwfReal64tosOpts( tbuf, 64, iReal, 0 );
-	if (ret == 0)
+
+	/* Formats straight into the caller's buffer. */
+	length = rwfReal64ToBuf(buffer->data, buffer->length, iReal);
+	if (length == -2)
 		return RSSL_RET_INVALID_DATA;
+	if (length < 0)
+		return RSSL_RET_FAILURE;
 
-	length = (RsslUInt32)strlen(ret);
-	if (length < buffer->length)
-	{
-		memcpy(buffer->data, ret, length);
-		buffer->data[length] = '\0';
-		buffer->length = length;
-		return RSSL_RET_SUCCESS;
-	}
-	return RSSL_RET_FAILURE;
+	buffer->length = (RsslUInt32)length;
+	return RSSL_RET_SUCCESS;
 }
 
 RSSL_API const char* rsslRealHintToOmmString(RsslUInt8 hint)
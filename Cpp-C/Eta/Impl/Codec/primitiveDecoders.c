@@ -11,6 +11,7 @@
 #include "rtr/intDataTypes.h"
 #include "rtr/decoderTools.h"
 #include "rtr/rsslIteratorUtilsInt.h"
+#include "rtr/rwfConvert.h"
 
 
 #include <string.h>
@@ -596,18 +597,20 @@ RsslRet RTR_FASTCALL _rsslIntAsString(RsslDecodeIterator *pIter, RsslBuffer *oBu
 
 RsslRet RTR_FASTCALL _rsslIntToString(void *pInt, RsslBuffer *oBuffer)
 {
-	int length = 0;
+	RsslInt64 value = *(RsslInt64*)pInt;
+	RsslUInt64 magnitude = (value < 0) ? (RsslUInt64)0 - (RsslUInt64)value : (RsslUInt64)value;
+	int digits = rwfUI64Digits(magnitude);
+	int length = digits + (value < 0);
 
-	length = snprintf(oBuffer->data, oBuffer->length, RTR_LONGLONG_SPEC, *(RsslInt64*)pInt);
-	if (length >= 0 && length < (int)oBuffer->length)
-	{
-		oBuffer->length = length;
-		return RSSL_RET_SUCCESS;
-	}
-	else
-	{
+	if (length >= (int)oBuffer->length)
 		return RSSL_RET_FAILURE;
-	}
+
+	if (value < 0)
+		oBuffer->data[0] = '-';
+	rwfPutUI64Digits(oBuffer->data + length, magnitude, digits);
+	oBuffer->data[length] = '\0';
+	oBuffer->length = length;
+	return RSSL_RET_SUCCESS;
 }
 
 RsslRet RTR_FASTCALL _rsslUIntAsString(RsslDecodeIterator *pIter, RsslBuffer *oBuffer)
@@ -626,18 +629,16 @@ RsslRet RTR_FASTCALL _rsslUIntAsString(RsslDecodeIterator *pIter, RsslBuffer *oB
 
 RsslRet RTR_FASTCALL _rsslUIntToString(void *pUInt, RsslBuffer *oBuffer)
 {
-	int length = 0;
+	RsslUInt64 value = *(RsslUInt64*)pUInt;
+	int length = rwfUI64Digits(value);
 
-	length = snprintf(oBuffer->data, oBuffer->length, RTR_ULONGLONG_SPEC, *(RsslUInt64*)pUInt);
-	if (length >= 0 && length < (int)oBuffer->length)
-	{
-		oBuffer->length = length;
-		return RSSL_RET_SUCCESS;
-	}
-	else
-	{
+	if (length >= (int)oBuffer->length)
 		return RSSL_RET_FAILURE;
-	}
+
+	rwfPutUI64Digits(oBuffer->data + length, value, length);
+	oBuffer->data[length] = '\0';
+	oBuffer->length = length;
+	return RSSL_RET_SUCCESS;
 }
 
 RsslRet RTR_FASTCALL _rsslFloatAsString(RsslDecodeIterator *pIter, RsslBuffer *oBuffer)
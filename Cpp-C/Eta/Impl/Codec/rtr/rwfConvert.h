@@ -75,6 +75,63 @@ extern char * rwfReal64tosOpts(	char *str,
 								RsslReal *iVal,
 								rwfTosOptions *opts);
 
+/* Writes an real64 forwards from the start of 'str', null terminated, producing the
+ * same text as rwfReal64tosOpts() with default options. Returns the string length,
+ * -1 if it does not fit in 'strlen' bytes, or -2 for an unknown hint. */
+extern int rwfReal64ToBuf(		char *str,
+								RsslUInt32 strlen,
+								RsslReal *iVal);
+
+/* "00" through "99", for writing two digits per division. */
+extern const char rwfDigitPairs[200];
+
+/* Returns the number of decimal digits needed to print 'value' (1 for zero). */
+RTR_C_INLINE int rwfUI64Digits(RsslUInt64 value)
+{
+	int digits = 1;
+
+	while (value >= 10000)
+	{
+		value /= 10000;
+		digits += 4;
+	}
+
+	if (value >= 1000) return digits + 3;
+	if (value >= 100) return digits + 2;
+	if (value >= 10) return digits + 1;
+	return digits;
+}
+
+/* Writes the low 'digits' decimal digits of 'value' ending just before 'pEnd',
+ * zero filled on the left. Like the functions above, this works backwards. */
+RTR_C_INLINE void rwfPutUI64Digits(char *pEnd, RsslUInt64 value, int digits)
+{
+	RsslUInt32 pair, tval;
+
+	/* Stay in 64 bits only while the value needs it. */
+	while (value > 0xFFFFFFFF && digits >= 2)
+	{
+		pair = (RsslUInt32)(value % 100) * 2;
+		value /= 100;
+		*(--pEnd) = rwfDigitPairs[pair + 1];
+		*(--pEnd) = rwfDigitPairs[pair];
+		digits -= 2;
+	}
+
+	tval = (RsslUInt32)value;
+	while (digits >= 2)
+	{
+		pair = (tval % 100) * 2;
+		tval /= 100;
+		*(--pEnd) = rwfDigitPairs[pair + 1];
+		*(--pEnd) = rwfDigitPairs[pair];
+		digits -= 2;
+	}
+
+	if (digits)
+		*(--pEnd) = (char)('0' + tval % 10);
+}
+
 /* These functions convert a date time to an ascii string. */
 extern char * rwfDateTimetos(	char *str,
 								RsslUInt32 strlen,
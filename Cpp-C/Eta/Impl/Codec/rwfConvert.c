@@ -30,6 +30,25 @@ static rwfTosOptions rwfDfltOpts = RWF_INIT_TOS_OPTS;
 static const char* _rwf_denominator[] = {"1/", "2/", "4/", "8/", "61/", "23/", "46/", "821/", "652/"};
 static const int _rwf_numeratorMask[] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
 
+const char rwfDigitPairs[200] = {
+	'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+	'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+	'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+	'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+	'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+	'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+	'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+	'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+	'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+	'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+static const RsslUInt64 _rwf_powersOf10[] = {
+	RTR_ULL(1), RTR_ULL(10), RTR_ULL(100), RTR_ULL(1000), RTR_ULL(10000), RTR_ULL(100000), RTR_ULL(1000000),
+	RTR_ULL(10000000), RTR_ULL(100000000), RTR_ULL(1000000000), RTR_ULL(10000000000), RTR_ULL(100000000000),
+	RTR_ULL(1000000000000), RTR_ULL(10000000000000), RTR_ULL(100000000000000)
+};
+
 rtrInt32	MAX_INT32DIV10 = INT_MAX/10;
 rtrInt8		MAX_INT8DIV10 = SCHAR_MAX/10;
 rtrInt16	MAX_INT16DIV10 = SHRT_MAX/10;
@@ -800,6 +819,146 @@ char * rwfReal64tosOpts(char *str, RsslUInt32 strlen, RsslReal *iVal, rwfTosOpti
 	return(psz);
 }
 
+int rwfReal64ToBuf(char *str, RsslUInt32 strlen, RsslReal *iVal)
+{
+	RsslUInt64	value;
+	RsslUInt64	whole;
+	RsslUInt64	remainder = 0;
+	int			isNegative;
+	int			wholeDigits;
+	int			fracDigits = 0;
+	int			padZeros = 0;
+	int			length;
+	char		*psz = str;
+	const char	*special;
+	int			specialLength = 0;
+
+	if (iVal->isBlank)
+	{
+		if (strlen < 1)
+			return -1;
+		*str = 0;
+		return 0;
+	}
+
+	switch(iVal->hint)
+	{
+		case RSSL_RH_INFINITY:		special = "Inf"; specialLength = 3; break;
+		case RSSL_RH_NEG_INFINITY:	special = "-Inf"; specialLength = 4; break;
+		case RSSL_RH_NOT_A_NUMBER:	special = "NaN"; specialLength = 3; break;
+		default:					special = 0; break;
+	}
+
+	if (special)
+	{
+		if ((RsslUInt32)specialLength >= strlen)
+			return -1;
+		memcpy(str, special, specialLength + 1);
+		return specialLength;
+	}
+
+	if (iVal->hint > RSSL_RH_FRACTION_256)
+		return -2;
+
+	/* Negate in unsigned arithmetic so the most negative value is handled. */
+	isNegative = (iVal->value < 0);
+	value = isNegative ? (RsslUInt64)0 - (RsslUInt64)iVal->value : (RsslUInt64)iVal->value;
+
+	/* Work out the layout and total length first, then write each digit once. */
+	if (iVal->hint >= RSSL_RH_FRACTION_1)
+	{
+		int frachint = iVal->hint - RSSL_RH_FRACTION_1;
+
+		whole = value >> frachint;
+		remainder = value & _rwf_numeratorMask[frachint];
+		wholeDigits = rwfUI64Digits(whole);
+		if (remainder)
+		{
+			/* "[whole ]remainder/denominator" */
+			fracDigits = rwfUI64Digits(remainder);
+			length = (whole ? wholeDigits + 1 : 0) + fracDigits + 1 + rwfUI64Digits((RsslUInt64)1 << frachint);
+		}
+		else
+			length = wholeDigits;
+	}
+	else
+	{
+		int exponent = iVal->hint - RSSL_RH_EXPONENT0;
+
+		if (exponent >= 0)
+		{
+			/* "value" followed by 'exponent' zeros, or just "0" */
+			whole = value;
+			wholeDigits = rwfUI64Digits(whole);
+			padZeros = value ? exponent : 0;
+			length = wholeDigits + padZeros;
+		}
+		else
+		{
+			/* "whole.fraction", with the fraction zero filled to 'exponent' places */
+			fracDigits = -exponent;
+			whole = value / _rwf_powersOf10[fracDigits];
+			remainder = value - whole * _rwf_powersOf10[fracDigits];
+			wholeDigits = rwfUI64Digits(whole);
+			length = wholeDigits + 1 + fracDigits;
+		}
+	}
+
+	length += isNegative;
+	if ((RsslUInt32)length >= strlen)
+		return -1;
+
+	if (isNegative)
+		*psz++ = '-';
+
+	if (iVal->hint >= RSSL_RH_FRACTION_1)
+	{
+		if (remainder)
+		{
+			int denomDigits;
+			RsslUInt64 denominator = (RsslUInt64)1 << (iVal->hint - RSSL_RH_FRACTION_1);
+
+			if (whole)
+			{
+				psz += wholeDigits;
+				rwfPutUI64Digits(psz, whole, wholeDigits);
+				*psz++ = ' ';
+			}
+			psz += fracDigits;
+			rwfPutUI64Digits(psz, remainder, fracDigits);
+			*psz++ = '/';
+			denomDigits = rwfUI64Digits(denominator);
+			psz += denomDigits;
+			rwfPutUI64Digits(psz, denominator, denomDigits);
+		}
+		else
+		{
+			psz += wholeDigits;
+			rwfPutUI64Digits(psz, whole, wholeDigits);
+		}
+	}
+	else
+	{
+		psz += wholeDigits;
+		rwfPutUI64Digits(psz, whole, wholeDigits);
+
+		if (padZeros)
+		{
+			memset(psz, '0', padZeros);
+			psz += padZeros;
+		}
+		else if (fracDigits)
+		{
+			*psz++ = '.';
+			psz += fracDigits;
+			rwfPutUI64Digits(psz, remainder, fracDigits);
+		}
+	}
+
+	*psz = 0;
+	return length;
+}
+
 #define __rtr_removewhitespace_null(ptr) \
 	while ((*ptr != '\0') && (*ptr == ' ')) \
 	ptr++;
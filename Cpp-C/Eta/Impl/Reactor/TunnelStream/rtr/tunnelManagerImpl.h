@@ -10,7 +10,7 @@
 
 #include "rtr/tunnelManager.h"
 #include "rtr/tunnelSubstream.h"
-#include "rtr/rsslHashTable.h"
+#include "rtr/rsslOpenHashTable.h"
 #include "rtr/bufferPool.h"
 #include "rtr/persistFile.h"
 #include <stdlib.h>
@@ -29,7 +29,7 @@ typedef struct
 	RsslQueue							_tunnelStreamDispatchList;
 	RsslQueue							_tunnelStreamTimeoutList;
 	RsslQueue							_tunnelBufferPool;
-	RsslHashTable 						_streamIdToTunnelStreamTable;
+	RsslOpenHashTable					_streamIdToTunnelStreamTable;
 	RsslReactor							*_pParentReactor;
 	RsslInt64							_nextExpireTime;
 	RsslTunnelStreamListenerCallback	*_listenerCallback;
@@ -160,7 +160,7 @@ typedef struct
 	RsslUInt32							_lastInSeqNumAccepted;
 	RsslUInt32							_lastInAckedSeqNum;
 	RsslQueue							_substreams;
-	RsslHashTable						_substreamsById;
+	RsslOpenHashTable					_substreamsById;
 	RsslBool							_persistLocally;
 	RsslBool							_needsDispatch;
 	RsslBool							_queuedFirstMsg;
@@ -52,7 +52,7 @@ TunnelManager *tunnelManagerOpen(RsslReactor *pReactor, RsslReactorChannel *pRea
 
 	pManagerImpl->_pParentReactor = pReactor;
 
-	if (rsslHashTableInit(&pManagerImpl->_streamIdToTunnelStreamTable, 13, rsslHashU32Sum, rsslHashU32Compare, RSSL_FALSE, pErrorInfo)
+	if (rsslOpenHashTableInit(&pManagerImpl->_streamIdToTunnelStreamTable, 13, rsslHashU32Sum, rsslHashU32Compare, RSSL_FALSE, pErrorInfo)
 			!= RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfoLocation(pErrorInfo, __FILE__, __LINE__);
@@ -186,7 +186,7 @@ RsslRet tunnelManagerReadMsg(TunnelManager *pManager, RsslMsg *pMsg, RsslErrorIn
 	RsslHashLink *pHashLink;
 	RsslTunnelStream *pTunnelStream;
 
-	if ((pHashLink = rsslHashTableFind(&pManagerImpl->_streamIdToTunnelStreamTable, &pMsg->msgBase.streamId, NULL)) != NULL)
+	if ((pHashLink = rsslOpenHashTableFind(&pManagerImpl->_streamIdToTunnelStreamTable, &pMsg->msgBase.streamId, NULL)) != NULL)
 	{
 		pTunnelStream = (RsslTunnelStream*)RSSL_HASH_LINK_TO_OBJECT(TunnelStreamImpl, _managerHashLink, pHashLink);
 
@@ -440,7 +440,7 @@ RsslRet tunnelManagerClose(TunnelManager *pManager, RsslErrorInfo *pErrorInfo)
 		free(pBufferImpl);
 	}
 	
-	rsslHashTableCleanup(&pManagerImpl->_streamIdToTunnelStreamTable);
+	rsslOpenHashTableCleanup(&pManagerImpl->_streamIdToTunnelStreamTable);
 	free(pManagerImpl);
 	return RSSL_RET_SUCCESS;
 }
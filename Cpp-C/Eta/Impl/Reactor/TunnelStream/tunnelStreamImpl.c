@@ -167,7 +167,7 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 		return NULL;
 	}
 
-	if (rsslHashTableFind(&pManagerImpl->_streamIdToTunnelStreamTable, &pOpts->streamId, NULL)
+	if (rsslOpenHashTableFind(&pManagerImpl->_streamIdToTunnelStreamTable, &pOpts->streamId, NULL)
 		!= NULL)
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
@@ -242,7 +242,7 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 	if (pOpts->classOfService.guarantee.type == RDM_COS_GU_PERSISTENT_QUEUE)
 	{
 		rsslInitQueue(&pTunnelImpl->_substreams);
-		if (rsslHashTableInit(&pTunnelImpl->_substreamsById, 101, rsslHashU32Sum, rsslHashU32Compare,
+		if (rsslOpenHashTableInit(&pTunnelImpl->_substreamsById, 101, rsslHashU32Sum, rsslHashU32Compare,
 					RSSL_TRUE, pErrorInfo) != RSSL_RET_SUCCESS)
 		{
 			tunnelStreamDestroy((RsslTunnelStream*)pTunnelImpl);
@@ -344,7 +344,7 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 		else
 			pTunnelImpl->base.classOfService.flowControl.sendWindowSize = TS_USE_DEFAULT_RECV_WINDOW_SIZE;
 
-		if (rsslHashTableFind(&pTunnelImpl->_manager->_streamIdToTunnelStreamTable, &pTunnelImpl->base.streamId, NULL)
+		if (rsslOpenHashTableFind(&pTunnelImpl->_manager->_streamIdToTunnelStreamTable, &pTunnelImpl->base.streamId, NULL)
 				!= NULL)
 		{
 			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
@@ -413,7 +413,7 @@ RsslTunnelStream* tunnelStreamOpen(TunnelManager *pManager, RsslTunnelStreamOpen
 	}
 
 	rsslHashLinkInit(&pTunnelImpl->_managerHashLink);
-	rsslHashTableInsertLink(&pTunnelImpl->_manager->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink, &pTunnelImpl->base.streamId, NULL);
+	rsslOpenHashTableInsertLink(&pTunnelImpl->_manager->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink, &pTunnelImpl->base.streamId, NULL);
 	rsslQueueAddLinkToBack(&pTunnelImpl->_manager->_tunnelStreamsOpen, &pTunnelImpl->_managerOpenLink);
 	pTunnelImpl->_flags |= TSF_ACTIVE;
 	pTunnelImpl->_streamVersion = streamVersion;
@@ -520,7 +520,7 @@ RsslRet tunnelStreamSubmitMsg(RsslTunnelStream *pTunnel,
 			RsslHashLink *pHashLink;
 			TunnelSubstream *pSubstream;
 
-			if ((pHashLink = rsslHashTableFind(&pTunnelImpl->_substreamsById,
+			if ((pHashLink = rsslOpenHashTableFind(&pTunnelImpl->_substreamsById,
 							&pRdmMsg->rdmMsgBase.streamId, NULL)) != NULL)
 				pSubstream = RSSL_HASH_LINK_TO_OBJECT(TunnelSubstream,
 						_tunnelTableLink, pHashLink);
@@ -581,7 +581,7 @@ RsslRet tunnelStreamSubmitMsg(RsslTunnelStream *pTunnel,
 									pErrorInfo)) == NULL)
 						return pErrorInfo->rsslError.rsslErrorId;
 
-					rsslHashTableInsertLink(&pTunnelImpl->_substreamsById, &pSubstream->_tunnelTableLink, &pSubstream->_streamId, NULL);
+					rsslOpenHashTableInsertLink(&pTunnelImpl->_substreamsById, &pSubstream->_tunnelTableLink, &pSubstream->_streamId, NULL);
 					rsslQueueAddLinkToBack(&pTunnelImpl->_substreams, &pSubstream->_tunnelQueueLink);
 					break;
 
@@ -596,7 +596,7 @@ RsslRet tunnelStreamSubmitMsg(RsslTunnelStream *pTunnel,
 					if ((ret = tunnelSubstreamClose(pSubstream, pErrorInfo)) != RSSL_RET_SUCCESS)
 						return ret;
 
-					rsslHashTableRemoveLink(&pTunnelImpl->_substreamsById, &pSubstream->_tunnelTableLink);
+					rsslOpenHashTableRemoveLink(&pTunnelImpl->_substreamsById, &pSubstream->_tunnelTableLink);
 					rsslQueueRemoveLink(&pTunnelImpl->_substreams, &pSubstream->_tunnelQueueLink);
 
 					tunnelStreamSetNeedsDispatch(pTunnelImpl);
@@ -1305,7 +1305,7 @@ RsslRet tunnelStreamRead(RsslTunnelStream *pTunnel, RsslMsg *pMsg, RsslErrorInfo
 										if (pTunnelImpl->_state < TSS_OPEN)
 											break;
 
-										if ((pHashLink = rsslHashTableFind(&pTunnelImpl->_substreamsById,
+										if ((pHashLink = rsslOpenHashTableFind(&pTunnelImpl->_substreamsById,
 											&substreamMsg.msgBase.streamId, NULL)) != NULL)
 										{
 											pSubstream = RSSL_HASH_LINK_TO_OBJECT(TunnelSubstream,
@@ -1873,7 +1873,7 @@ RsslRet tunnelStreamDispatch(RsslTunnelStream *pTunnel,
 			state.text.length = 50;
 
 
-			rsslHashTableRemoveLink(&pTunnelImpl->_manager->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink);
+			rsslOpenHashTableRemoveLink(&pTunnelImpl->_manager->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink);
 			rsslQueueRemoveLink(&pTunnelImpl->_manager->_tunnelStreamsOpen, &pTunnelImpl->_managerOpenLink);
 			pTunnelImpl->_state = TSS_CLOSED;
 
@@ -2437,7 +2437,7 @@ RsslRet tunnelStreamHandleState(TunnelStreamImpl *pTunnelImpl, RsslState *pState
 					}
 					else if (!isInternalClose)
 					{
-						rsslHashTableRemoveLink(&pManagerImpl->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink);
+						rsslOpenHashTableRemoveLink(&pManagerImpl->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink);
 						rsslQueueRemoveLink(&pManagerImpl->_tunnelStreamsOpen, &pTunnelImpl->_managerOpenLink);
 						pTunnelImpl->_state = TSS_CLOSED;
 
@@ -2455,7 +2455,7 @@ RsslRet tunnelStreamHandleState(TunnelStreamImpl *pTunnelImpl, RsslState *pState
 							pTunnelImpl->base.state.streamState = state.streamState = RSSL_STREAM_CLOSED_RECOVER;
 							pTunnelImpl->base.state.dataState = state.dataState = RSSL_DATA_SUSPECT;
 
-							rsslHashTableRemoveLink(&pManagerImpl->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink);
+							rsslOpenHashTableRemoveLink(&pManagerImpl->_streamIdToTunnelStreamTable, &pTunnelImpl->_managerHashLink);
 							rsslQueueRemoveLink(&pManagerImpl->_tunnelStreamsOpen, &pTunnelImpl->_managerOpenLink);
 							pTunnelImpl->_state = TSS_CLOSED;
 
@@ -2703,7 +2703,7 @@ void tunnelStreamDestroy(RsslTunnelStream *pTunnel)
 		TunnelSubstream *pSubstream = RSSL_QUEUE_LINK_TO_OBJECT(TunnelSubstream,
 				_tunnelQueueLink, pLink);
 
-		rsslHashTableRemoveLink(&pTunnelImpl->_substreamsById, &pSubstream->_tunnelTableLink);
+		rsslOpenHashTableRemoveLink(&pTunnelImpl->_substreamsById, &pSubstream->_tunnelTableLink);
 		rsslQueueRemoveLink(&pTunnelImpl->_substreams, &pSubstream->_tunnelQueueLink);
 		tunnelSubstreamDestroy(pSubstream);
 	}
@@ -2726,7 +2726,7 @@ void tunnelStreamDestroy(RsslTunnelStream *pTunnel)
 	bufferPoolCleanup(&pTunnelImpl->_memoryBufferPool);
 
 	rsslHeapBufferCleanup(&pTunnelImpl->_memoryBuffer);
-	rsslHashTableCleanup(&pTunnelImpl->_substreamsById);
+	rsslOpenHashTableCleanup(&pTunnelImpl->_substreamsById);
 
 	for (pLink = rsslQueueStart(&pTunnelImpl->_fragmentationProgressQueue); pLink != NULL;
 		 pLink = rsslQueueForth(&pTunnelImpl->_fragmentationProgressQueue))
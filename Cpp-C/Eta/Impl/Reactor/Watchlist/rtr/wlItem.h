@@ -9,6 +9,7 @@
 #define WL_ITEM_H
 
 #include "rtr/wlBase.h"
+#include "rtr/rsslOpenHashTable.h"
 #include "rtr/wlView.h" 
 #include "rtr/rsslRequestMsg.h"
 #include "rtr/wlService.h"
@@ -235,7 +236,7 @@ void wlFTGroupRemove(WlItems *pItems, WlFTGroup *pGroup);
 #define WL_FTGROUP_TABLE_SIZE 256
 struct WlItems
 {
-	RsslHashTable	providerRequestsByAttrib;	/* Provider-driven streams. */
+	RsslOpenHashTable	providerRequestsByAttrib;	/* Provider-driven streams. */
 	WlFTGroup*		ftGroupTable[WL_FTGROUP_TABLE_SIZE];
 												/* FTGroup table. */
 	RsslQueue		ftGroupTimerQueue;			/* FTGroup list. Should be ordered
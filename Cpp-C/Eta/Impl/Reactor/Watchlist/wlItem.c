@@ -83,7 +83,7 @@ RsslRet wlItemsInit(WlItems *pItems, RsslErrorInfo *pErrorInfo)
 {
 	RsslRet ret;
 
-	if ((ret = rsslHashTableInit(&pItems->providerRequestsByAttrib, 100003, 
+	if ((ret = rsslOpenHashTableInit(&pItems->providerRequestsByAttrib, 100003, 
 			wlProviderRequestHashSum, wlProviderRequestHashCompare, RSSL_TRUE, pErrorInfo))
 			!= RSSL_RET_SUCCESS)
 		return ret;
@@ -101,7 +101,7 @@ RsslRet wlItemsInit(WlItems *pItems, RsslErrorInfo *pErrorInfo)
 
 void wlItemsCleanup(WlItems *pItems)
 {
-	rsslHashTableCleanup(&pItems->providerRequestsByAttrib);
+	rsslOpenHashTableCleanup(&pItems->providerRequestsByAttrib);
 }
 
 RsslRet wlItemCopyKey(RsslMsgKey *pNewMsgKey, RsslMsgKey *pOldMsgKey, char **pMemoryBuffer,
@@ -923,7 +923,7 @@ RsslRet wlItemRequestCreate(WlBase *pBase, WlItems *pItems, WlItemRequestCreateO
 		if (!(pOpts->slDataStreamFlags & RDM_SYMBOL_LIST_DATA_SNAPSHOTS))
 		{
 			assert(pItemRequest->requestMsgFlags & RSSL_RQMF_STREAMING);
-			rsslHashTableInsertLink(&pItems->providerRequestsByAttrib,
+			rsslOpenHashTableInsertLink(&pItems->providerRequestsByAttrib,
 					&pItemRequest->hlProviderRequestsByAttrib, 
 					(void*)pItemRequest, NULL);
 		}
@@ -959,7 +959,7 @@ void wlItemRequestClose(WlBase *pBase, WlItems *pItems, WlItemRequest *pItemRequ
 	if (pItemRequest->flags & WL_IRQF_PROV_DRIVEN
 			&& pItemRequest->requestMsgFlags & RSSL_RQMF_STREAMING)
 	{
-		rsslHashTableRemoveLink(&pItems->providerRequestsByAttrib, 
+		rsslOpenHashTableRemoveLink(&pItems->providerRequestsByAttrib, 
 				&pItemRequest->hlProviderRequestsByAttrib);
 	}
 
@@ -304,7 +304,7 @@ RsslRet wlProcessSymbolListMsg(WlBase *pBase, WlItems *pItems, RsslMsg *pRsslMsg
 						 * stream is not already open before requesting. */
 						if (pRequest->flags & RDM_SYMBOL_LIST_DATA_STREAMS)
 						{
-							pHashLink = rsslHashTableFind(&pItems->providerRequestsByAttrib,
+							pHashLink = rsslOpenHashTableFind(&pItems->providerRequestsByAttrib,
 									(void*)&matchRequest, &hashSum);
 
 							if (pHashLink)
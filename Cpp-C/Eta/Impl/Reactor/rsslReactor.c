@@ -87,6 +87,7 @@ typedef struct
 	RsslStreamInfo			*pStreamInfo;	/* (Input) StreamInfo. */
 	RsslUInt8				*pFTGroupId;	/* (Input) FTGroupId from rsslReadEx */
 	RsslUInt32				*pSeqNum;		/* (Input) SeqNum from rsslReadEx. */
+	RsslBool				lazyMsg;		/* (Input) pRsslMsg was decoded by rsslDecodeMsgLazy(). */
 	RsslReactorCallbackRet	*pCret;			/* (Output) Return code from callback. */
 	RsslErrorInfo			*pError;		/* (Output) Error. */
 } ReactorProcessMsgOptions;
@@ -252,7 +253,7 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 
 		rsslClearReactorChannelImpl(pReactorImpl, pReactorChannel);
 		rsslInitQueueLink(&pReactorChannel->reactorQueueLink);
-		rsslInitReactorEventQueue(&pReactorChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
+		rsslInitReactorEventQueueEx(&pReactorChannel->eventQueue, 5, RSSL_REACTOR_CHANNEL_EVENT_RING_SIZE, &pReactorImpl->activeEventQueueGroup);
 
 		if ((pReactorChannel->pWorkerNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
@@ -578,6 +579,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	RsslReactorImpl *pReactorImpl;
 	RsslInt32 i;
 	char *memBuf;
+	RsslError rsslError;
 
 #ifdef WIN32
 	LARGE_INTEGER	perfFrequency;
@@ -629,6 +631,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	pReactorImpl->reissueTokenAttemptLimit = pReactorOpts->reissueTokenAttemptLimit;
 	pReactorImpl->reissueTokenAttemptInterval = pReactorOpts->reissueTokenAttemptInterval;
 	pReactorImpl->restRequestTimeout = pReactorOpts->restRequestTimeOut;
+	pReactorImpl->notifierType = (pReactorOpts->notifierType == RSSL_RC_NT_EPOLL) ? RSSL_NOTIFIER_TYPE_EPOLL : RSSL_NOTIFIER_TYPE_DEFAULT;
 
 	if (pReactorOpts->tokenServiceURL.data && pReactorOpts->tokenServiceURL.length)
 	{
@@ -693,7 +696,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 
 
 	/* Setup reactor */
-	if (rsslInitReactorEventQueue(&pReactorImpl->reactorEventQueue, 10, &pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
+	if (rsslInitReactorEventQueueEx(&pReactorImpl->reactorEventQueue, 10, RSSL_REACTOR_EVENT_RING_SIZE, &pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize event queue.");
@@ -740,7 +743,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		}
 		rsslClearReactorChannelImpl(pReactorImpl, pNewChannel);
 		rsslInitQueueLink(&pNewChannel->reactorQueueLink);
-		rsslInitReactorEventQueue(&pNewChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
+		rsslInitReactorEventQueueEx(&pNewChannel->eventQueue, 5, RSSL_REACTOR_CHANNEL_EVENT_RING_SIZE, &pReactorImpl->activeEventQueueGroup);
 
 		if ((pNewChannel->pNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
@@ -751,7 +754,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		_reactorMoveChannel(&pReactorImpl->channelPool, pNewChannel);
 	}
 
-	if ((pReactorImpl->pNotifier = rsslCreateNotifier(1024)) == NULL)
+	if ((pReactorImpl->pNotifier = rsslCreateNotifierEx(1024, pReactorImpl->notifierType)) == NULL)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor notifier.");
@@ -793,6 +796,10 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	pReactorImpl->memoryBuffer.data = memBuf;
 	pReactorImpl->memoryBuffer.length = pReactorImpl->dispatchDecodeMemoryBufferSize;
 
+	/* Not every platform has io_uring; channels then send on their own. Nothing is set
+	 * up in the kernel until a channel uses it. */
+	pReactorImpl->pIoUring = rsslCreateIoUring(&rsslError);
+
 	if (_reactorWorkerStart(pReactorImpl, pReactorOpts, pError) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
@@ -2384,6 +2391,120 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 	return (reactorUnlockInterface((RsslReactorImpl*)pReactor), ret);
 }
 
+RSSL_VA_API RsslRet rsslReactorSubmitBatch(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer **pBuffers, RsslUInt32 bufferCount, RsslReactorSubmitOptions *pSubmitOptions, RsslUInt32 *pBuffersSubmitted, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Since the application passed in this channel, make sure it is valid for this reactor and that it is active. */
+	if (!pReactorChannel || !rsslReactorChannelIsValid(pReactorImpl, pReactorChannel, pError))
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+
+	if (!pBuffers || !pBuffersSubmitted)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "pBuffers and pBuffersSubmitted must be specified.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	*pBuffersSubmitted = 0;
+
+	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+	}
+
+	if (pReactorChannel->reactorParentQueue != &pReactorImpl->activeChannels)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Channel is not active.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+	}
+
+	if (pReactorChannel->channelRole.base.roleType == RSSL_RC_RT_OMM_CONSUMER
+			&& pReactorChannel->channelRole.ommConsumerRole.watchlistOptions.enableWatchlist)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "rsslReactorSubmitBatch may not be used when watchlist is enabled.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	/* JSON channels convert each message as it is submitted, see rsslReactorSubmit */
+	if (pReactorChannel->reactorChannel.pRsslChannel->protocolType == RSSL_JSON_PROTOCOL_TYPE)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "rsslReactorSubmitBatch may not be used with the JSON protocol.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	rsslClearWriteInArgs(&writeInArgs);
+	rsslClearWriteOutArgs(&writeOutArgs);
+	writeInArgs.rsslPriority = pSubmitOptions->priority;
+	writeInArgs.writeInFlags = pSubmitOptions->writeFlags;
+
+	ret = rsslWriteBatch(pReactorChannel->reactorChannel.pRsslChannel, pBuffers, bufferCount, &writeInArgs, &writeOutArgs, pBuffersSubmitted, &pError->rsslError);
+
+	if (pSubmitOptions->pBytesWritten)
+		*pSubmitOptions->pBytesWritten = writeOutArgs.bytesWritten;
+
+	if (pSubmitOptions->pUncompressedBytesWritten)
+		*pSubmitOptions->pUncompressedBytesWritten = writeOutArgs.uncompressedBytesWritten;
+
+	/* Collects write statistics */
+	if ( (pReactorChannel->statisticFlags & RSSL_RC_ST_WRITE) && pReactorChannel->pChannelStatistic)
+	{
+		_cumulativeValue(&pReactorChannel->pChannelStatistic->bytesWritten, writeOutArgs.bytesWritten);
+		_cumulativeValue(&pReactorChannel->pChannelStatistic->uncompressedBytesWritten, writeOutArgs.uncompressedBytesWritten);
+	}
+
+	if (ret < RSSL_RET_SUCCESS)
+	{
+		switch (ret)
+		{
+			case RSSL_RET_WRITE_FLUSH_FAILED:
+				if (*pBuffersSubmitted == bufferCount)
+				{
+					/* rsslWriteBatch has the messages, but attempted to flush and failed.  This is okay, just need to keep flushing. */
+					ret = RSSL_RET_SUCCESS;
+					pReactorChannel->writeRet = 1;
+					break;
+				}
+
+				/* Part of the batch was not taken, so the application must not be told that it was sent. */
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Flush failed before the whole batch was written.");
+				return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+			case RSSL_RET_WRITE_CALL_AGAIN:
+				/* A fragmented message was only partially written because there were not enough output buffers in RSSL to send it.
+				 * We will request flushing to make the buffers available.
+				 * RSSL_RET_WRITE_CALL_AGAIN will still be returned to the application, which should submit the remaining buffers again later. */
+				pReactorChannel->writeRet = 1;
+				break;
+			default:
+				/* Failure */
+				rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+				return (reactorUnlockInterface(pReactorImpl), ret);
+		}
+	}
+	else if (ret > 0)
+	{
+		/* The messages were written to RSSL but have not yet been fully written to the network.  Flushing is needed to complete sending. */
+		pReactorChannel->writeRet = ret;
+		ret = RSSL_RET_SUCCESS;
+	}
+
+	if (pReactorChannel->writeRet > 0)
+	{
+		/* Returns the error when flush failed */
+		if (_reactorSendFlushRequest(pReactorImpl, pReactorChannel, pError) != RSSL_RET_SUCCESS)
+			return (reactorUnlockInterface(pReactorImpl), pError->rsslError.rsslErrorId);
+	}
+
+	return (reactorUnlockInterface(pReactorImpl), ret);
+}
+
 RsslUInt32 _reactorMsgEncodedSize(RsslMsg *pMsg)
 {
 	RsslUInt32 msgSize = 128;
@@ -3579,6 +3700,7 @@ static void _reactorCallDefaultCallback(RsslReactorImpl *pReactorImpl, RsslReact
 	msgEvent.pStreamInfo = (RsslStreamInfo*)pOpts->pStreamInfo;
 	msgEvent.pFTGroupId = pOpts->pFTGroupId;
 	msgEvent.pSeqNum = pOpts->pSeqNum;
+	msgEvent.lazyMsg = pOpts->lazyMsg;
 
 	_reactorSetInCallback(pReactorImpl, RSSL_TRUE);
 	*pOpts->pCret = (*pReactorChannel->channelRole.base.defaultMsgCallback)((RsslReactor*)pReactorImpl, (RsslReactorChannel*)pReactorChannel, &msgEvent);
@@ -3626,6 +3748,20 @@ static RsslRet _reactorProcessMsg(RsslReactorImpl *pReactorImpl, RsslReactorChan
 	RsslReactorCallbackRet	*pCret = pOpts->pCret;
 	RsslDecodeIterator		dIter;
 
+	/* Only the defaultMsgCallback accepts a lazily-decoded message; complete it for anything the reactor decodes itself. */
+	if (pOpts->lazyMsg && (pReactorChannel->pTunnelManager
+				|| pMsg->msgBase.domainType == RSSL_DMT_LOGIN
+				|| pMsg->msgBase.domainType == RSSL_DMT_SOURCE
+				|| pMsg->msgBase.domainType == RSSL_DMT_DICTIONARY))
+	{
+		if ((ret = rsslCompleteLazyMsg(pMsg)) != RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "rsslCompleteLazyMsg() failed: %d", ret);
+			return RSSL_RET_FAILURE;
+		}
+		pOpts->lazyMsg = RSSL_FALSE;
+	}
+
 	/* check for RsslTunnelStream message */
 	if (pReactorChannel->pTunnelManager && pMsg)
 	{
@@ -4405,6 +4541,7 @@ static RsslRet _reactorWatchlistMsgCallback(RsslWatchlist *pWatchlist, RsslWatch
 	processOpts.pError = pError;
 	processOpts.pSeqNum = pEvent->pSeqNum;
 	processOpts.pFTGroupId = pEvent->pFTGroupId;
+	processOpts.lazyMsg = RSSL_FALSE;
 
 	if (pEvent->pRdmMsg)
 	{
@@ -4428,13 +4565,15 @@ static RsslRet _processRsslRwfMessage(RsslReactorImpl *pReactorImpl, RsslReactor
 	RsslReactorCallbackRet cret;
 	RsslDecodeIterator dIter;
 	RsslMsg msg;
+	/* The watchlist inspects and rewrites most of the header, so it always gets a full decode. */
+	RsslBool lazyMsg = (pReactorChannel->channelRole.base.lazyMsgDecode && !pReactorChannel->pWatchlist);
 
 	/* Decode the message header. Call the appropriate callback function based on the domainType. */
 	rsslClearMsg(&msg);
 	rsslClearDecodeIterator(&dIter);
 	rsslSetDecodeIteratorRWFVersion(&dIter, pReactorChannel->reactorChannel.pRsslChannel->majorVersion, pReactorChannel->reactorChannel.pRsslChannel->minorVersion);
 	rsslSetDecodeIteratorBuffer(&dIter, pMsgBuf);
-	ret = rsslDecodeMsg(&dIter, &msg);
+	ret = lazyMsg ? rsslDecodeMsgLazy(&dIter, &msg) : rsslDecodeMsg(&dIter, &msg);
 
 	if (ret == RSSL_RET_SUCCESS)
 	{
@@ -4472,6 +4611,7 @@ static RsslRet _processRsslRwfMessage(RsslReactorImpl *pReactorImpl, RsslReactor
 			processOpts.pError = pError;
 			processOpts.pRsslMsg = &msg;
 			processOpts.pRdmMsg = NULL;
+			processOpts.lazyMsg = lazyMsg;
 
 			processOpts.pFTGroupId = 
 				(readOutArgs->readOutFlags & RSSL_READ_OUT_FTGROUP_ID) ? 
@@ -5522,8 +5662,29 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pChannel, Rssl
 	}
 }
 
+RSSL_VA_API RsslRet rsslReactorChannelIoctl(RsslReactorChannel *pReactorChannel, int code, void *value, RsslErrorInfo *pError)
+{
+	RsslRet ret = rsslIoctl(pReactorChannel->pRsslChannel, (RsslIoctlCodes)code, value, &pError->rsslError);
+	if (ret != RSSL_RET_SUCCESS)
+		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+	else if (code == RSSL_AUTO_PACK_DELAY)
+	{
+		/* The worker holds flush requests for this long, so that auto-packed buffers can fill. */
+		RTR_ATOMIC_SET(((RsslReactorChannelImpl*)pReactorChannel)->autoPackDelayUsec, (rtr_atomic_val)*(RsslUInt32*)value);
+	}
+	return ret;
+}
+
 RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl)
 {
+	RsslError rsslError;
+
+	/* Send what this call wrote to io_uring channels. Calls made from callbacks leave it to
+	 * the end of the dispatch, so everything it wrote goes in one system call. A failure
+	 * leaves the sends queued for the next submit. */
+	if (pReactorImpl->pIoUring && !pReactorImpl->inReactorFunction)
+		rsslIoUringSubmit(pReactorImpl->pIoUring, &rsslError);
+
 	RSSL_MUTEX_UNLOCK(&pReactorImpl->interfaceLock);
 	return RSSL_RET_SUCCESS;
 }
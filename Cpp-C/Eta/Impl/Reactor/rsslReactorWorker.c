@@ -92,7 +92,7 @@ RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOpti
 		return RSSL_RET_FAILURE;
 	}
 
-	if (rsslInitReactorEventQueue(&pReactorImpl->reactorWorker.workerQueue, 10, &pReactorImpl->reactorWorker.activeEventQueueGroup) != RSSL_RET_SUCCESS)
+	if (rsslInitReactorEventQueueEx(&pReactorImpl->reactorWorker.workerQueue, 10, RSSL_REACTOR_EVENT_RING_SIZE, &pReactorImpl->reactorWorker.activeEventQueueGroup) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to init worker event queue.");
 		return RSSL_RET_FAILURE;
@@ -125,7 +125,7 @@ RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOpti
 		rsslQueueAddLinkToBack(&pReactorImpl->reactorWorker.errorInfoPool, &pReactorErrorInfoImpl->poolLink);
 	}
 
-	pReactorImpl->reactorWorker.pNotifier = rsslCreateNotifier(1024);
+	pReactorImpl->reactorWorker.pNotifier = rsslCreateNotifierEx(1024, pReactorImpl->notifierType);
 	if (pReactorImpl->reactorWorker.pNotifier == NULL)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize notifier.");
@@ -289,6 +289,13 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 	if (pReactorImpl->memoryBuffer.data)
 		free(pReactorImpl->memoryBuffer.data);
 
+	/* freed once the last channel using it is closed */
+	if (pReactorImpl->pIoUring)
+	{
+		rsslDestroyIoUring(pReactorImpl->pIoUring, &pReactorWorker->workerCerr.rsslError);
+		pReactorImpl->pIoUring = NULL;
+	}
+
 	RSSL_MUTEX_DESTROY(&pReactorImpl->interfaceLock);
 
 	/* Ensure that the worker thread is started before cleaning up its resources */
@@ -560,8 +567,27 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 		RsslReactorChannelImpl *pReactorChannel;
 		RsslRestHandle *pRestHandle;
 		RsslQueueLink *pLink;
+		RsslUInt32 autoPackDelayUsec;
+
+		/* Send what the last pass flushed on io_uring channels, in one system call */
+		if (pReactorImpl->pIoUring)
+			rsslIoUringSubmit(pReactorImpl->pIoUring, &pReactorWorker->workerCerr.rsslError);
+
+		if (pReactorWorker->nextPackFlushUsec)
+		{
+			/* Wake in time to flush auto-packing channels, which can be sooner than a millisecond. */
+			RsslTimeValue currentTimeUsec = rsslGetTimeMicro();
+			long waitUsec = (long)pReactorWorker->sleepTimeMs * 1000;
+
+			if (pReactorWorker->nextPackFlushUsec <= currentTimeUsec)
+				waitUsec = 0;
+			else if (pReactorWorker->nextPackFlushUsec - currentTimeUsec < (RsslTimeValue)waitUsec)
+				waitUsec = (long)(pReactorWorker->nextPackFlushUsec - currentTimeUsec);
 
-		ret = rsslNotifierWait(pReactorWorker->pNotifier, pReactorWorker->sleepTimeMs * 1000);
+			ret = rsslNotifierWait(pReactorWorker->pNotifier, waitUsec);
+		}
+		else
+			ret = rsslNotifierWait(pReactorWorker->pNotifier, pReactorWorker->sleepTimeMs * 1000);
 
 		pReactorWorker->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
 
@@ -781,7 +807,14 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 									{
 										case RSSL_RCIMPL_FET_START_FLUSH:
 											pReactorChannel = (RsslReactorChannelImpl*)pFlushEvent->pReactorChannel;
-											if (pReactorChannel->reactorChannel.pRsslChannel != NULL && pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET)
+											autoPackDelayUsec = (RsslUInt32)pReactorChannel->autoPackDelayUsec;
+											if (autoPackDelayUsec > 0)
+											{
+												/* Let auto-packed buffers fill; the channel is flushed once the delay has passed. */
+												if (pReactorChannel->packFlushTimeUsec == 0)
+													pReactorChannel->packFlushTimeUsec = rsslGetTimeMicro() + autoPackDelayUsec;
+											}
+											else if (pReactorChannel->reactorChannel.pRsslChannel != NULL && pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET)
 											{
 												if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
 												{
@@ -1311,11 +1344,47 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 			}
 		}
 
+		pReactorWorker->nextPackFlushUsec = 0;
+
 		RSSL_QUEUE_FOR_EACH_LINK(&pReactorWorker->activeChannels, pLink)
 		{
 			RsslBool sendPingMessage = RSSL_TRUE;
 			pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, workerLink, pLink);
 
+			/* Start flushing an auto-packing channel once its delay has passed. */
+			if (pReactorChannel->packFlushTimeUsec)
+			{
+				if (pReactorChannel->packFlushTimeUsec <= rsslGetTimeMicro())
+				{
+					pReactorChannel->packFlushTimeUsec = 0;
+					if (pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET
+							&& rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
+					{
+						rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+								"Failed to register write notification for flushing channel.");
+						return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+					}
+				}
+				else if (pReactorWorker->nextPackFlushUsec == 0 || pReactorChannel->packFlushTimeUsec < pReactorWorker->nextPackFlushUsec)
+					pReactorWorker->nextPackFlushUsec = pReactorChannel->packFlushTimeUsec;
+			}
+
+			/* epoll silently drops descriptors that are closed, so it can't report the bad descriptor left behind when the 
+			 * Reactor thread receives an FD_CHANGE from rsslRead. Check for the change here instead. Write notification
+			 * is registered again in case a flush was pending on the old descriptor. */
+			if (pReactorImpl->notifierType != RSSL_NOTIFIER_TYPE_DEFAULT
+					&& pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET
+					&& rsslNotifierEventGetFd(pReactorChannel->pWorkerNotifierEvent) != pReactorChannel->reactorChannel.pRsslChannel->socketId)
+			{
+				if (rsslNotifierUpdateEventFd(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent, (int)pReactorChannel->reactorChannel.pRsslChannel->socketId) < 0
+						|| rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
+				{
+					rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+							"Failed to update file descriptor for channel.");
+					return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+				}
+			}
+
 			/* Checks whether to send a ping message for the JSON protocol. */
 			if (pReactorChannel->reactorChannel.pRsslChannel->protocolType == RSSL_JSON_PROTOCOL_TYPE)
 			{
@@ -2056,6 +2125,11 @@ RsslRet _reactorWorkerProcessNewChannel(RsslReactorImpl *pReactorImpl, RsslReact
 	switch (pReactorChannel->reactorChannel.pRsslChannel->state)
 	{
 		case RSSL_CH_STATE_INITIALIZING:
+			/* Channels that set RsslTcpOpts::io_uring send through the Reactor's ring once active; others ignore it */
+			if (pReactorImpl->pIoUring && (pReactorChannel->reactorChannel.pRsslChannel->connectionType == RSSL_CONN_TYPE_SOCKET ||
+					pReactorChannel->reactorChannel.pRsslChannel->connectionType == RSSL_CONN_TYPE_WEBSOCKET))
+				rsslIoctl(pReactorChannel->reactorChannel.pRsslChannel, RSSL_IO_URING, &pReactorImpl->pIoUring, &pReactorChannel->channelWorkerCerr.rsslError);
+
 			_reactorWorkerMoveChannel(&pReactorWorker->initializingChannels, pReactorChannel);
 			_reactorWorkerCalculateNextTimeout(pReactorImpl, pReactorChannel->initializationTimeout*1000);
 			pReactorChannel->initializationStartTimeMs = pReactorWorker->lastRecordedTimeMs;
@@ -12,6 +12,7 @@
 #include "rtr/rsslRDMMsg.h"
 #include "rtr/rsslEventSignal.h"
 #include "rtr/rsslThread.h"
+#include "rtr/rtratomic.h"
 
 #include <stdlib.h>
 
@@ -21,18 +22,181 @@
 #include <fcntl.h>
 #include <process.h>
 #include <math.h>
+#include <intrin.h>
 #endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Event Ring */
+
+#ifdef WIN32
+#define RSSL_REACTOR_EVENT_RING_BARRIER() _ReadWriteBarrier()
+#else
+#define RSSL_REACTOR_EVENT_RING_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+#endif
+
+/* Loads and stores of the ring positions and sequences. The atomic operations in rtratomic.h are
+ * full barriers and the supported platforms do not reorder stores with other stores or loads with other loads,
+ * so these only need to keep the compiler from reordering the accesses. */
+#define RSSL_REACTOR_EVENT_RING_LOAD(___var) (*(volatile rtr_atomic_val*)&(___var))
+#define RSSL_REACTOR_EVENT_RING_STORE(___var, ___val) \
+	do { RSSL_REACTOR_EVENT_RING_BARRIER(); *(volatile rtr_atomic_val*)&(___var) = (___val); } while(0)
+
+/* Keeps producer and consumer positions on separate cache lines. */
+#define RSSL_REACTOR_EVENT_RING_PAD 64
+
+/* Default ring sizes used by the reactor. Channel queues are smaller since there is one per channel;
+ * if a ring fills up, events overflow to the locked queue (see rsslReactorEventQueuePut). */
+#define RSSL_REACTOR_EVENT_RING_SIZE 1024
+#define RSSL_REACTOR_CHANNEL_EVENT_RING_SIZE 64
+
+typedef struct
+{
+	rtr_atomic_val sequence;
+	void *pData;
+} RsslReactorEventRingCell;
+
+/* RsslReactorEventRing
+ * Bounded multi-producer/multi-consumer ring of pointers.
+ * Each cell carries a sequence number that tells producers and consumers whether the cell is free or filled
+ * for their position, so each side only needs a compare-and-swap on its own position. */
+typedef struct
+{
+	RsslReactorEventRingCell *pCells;
+	rtr_atomic_val mask;
+	char pad0[RSSL_REACTOR_EVENT_RING_PAD];
+	rtr_atomic_val enqueuePos;
+	char pad1[RSSL_REACTOR_EVENT_RING_PAD];
+	rtr_atomic_val dequeuePos;
+	char pad2[RSSL_REACTOR_EVENT_RING_PAD];
+} RsslReactorEventRing;
+
+/* rsslInitReactorEventRing
+ * Initializes a ring that holds at least the given number of entries(rounded up to a power of two). */
+RTR_C_INLINE RsslRet rsslInitReactorEventRing(RsslReactorEventRing *pRing, RsslUInt32 size)
+{
+	RsslUInt32 capacity = 2, i;
+
+	while (capacity < size)
+		capacity <<= 1;
+
+	memset(pRing, 0, sizeof(RsslReactorEventRing));
+
+	if (!(pRing->pCells = (RsslReactorEventRingCell*)malloc(capacity * sizeof(RsslReactorEventRingCell))))
+		return RSSL_RET_FAILURE;
+
+	for (i = 0; i < capacity; ++i)
+	{
+		pRing->pCells[i].sequence = (rtr_atomic_val)i;
+		pRing->pCells[i].pData = NULL;
+	}
+
+	pRing->mask = (rtr_atomic_val)(capacity - 1);
+
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE void rsslCleanupReactorEventRing(RsslReactorEventRing *pRing)
+{
+	if (pRing->pCells)
+	{
+		free(pRing->pCells);
+		pRing->pCells = NULL;
+	}
+}
+
+/* rsslReactorEventRingPush
+ * Adds an entry to the ring. Returns RSSL_FALSE if the ring is full. */
+RTR_C_INLINE RsslBool rsslReactorEventRingPush(RsslReactorEventRing *pRing, void *pData)
+{
+	RsslReactorEventRingCell *pCell;
+	rtr_atomic_val pos, prevPos, seq;
+	
+	pos = RSSL_REACTOR_EVENT_RING_LOAD(pRing->enqueuePos);
+
+	while (RSSL_TRUE)
+	{
+		RsslInt32 diff;
+
+		pCell = &pRing->pCells[pos & pRing->mask];
+		seq = RSSL_REACTOR_EVENT_RING_LOAD(pCell->sequence);
+		diff = (RsslInt32)((RsslUInt32)seq - (RsslUInt32)pos);
+
+		if (diff == 0)
+		{
+			/* Cell is free for this position; try to claim it. */
+			prevPos = RTR_ATOMIC_COMPARE_AND_SWAP(pRing->enqueuePos, pos, (rtr_atomic_val)((RsslUInt32)pos + 1));
+			if (prevPos == pos)
+				break;
+			pos = prevPos;
+		}
+		else if (diff < 0)
+			return RSSL_FALSE; /* Cell still holds the entry from the previous lap; ring is full. */
+		else
+			pos = RSSL_REACTOR_EVENT_RING_LOAD(pRing->enqueuePos);
+	}
+
+	pCell->pData = pData;
+	RSSL_REACTOR_EVENT_RING_STORE(pCell->sequence, (rtr_atomic_val)((RsslUInt32)pos + 1));
+	return RSSL_TRUE;
+}
+
+/* rsslReactorEventRingPop
+ * Removes an entry from the ring. Returns NULL if the ring is empty. */
+RTR_C_INLINE void* rsslReactorEventRingPop(RsslReactorEventRing *pRing)
+{
+	RsslReactorEventRingCell *pCell;
+	rtr_atomic_val pos, prevPos, seq;
+	void *pData;
+
+	pos = RSSL_REACTOR_EVENT_RING_LOAD(pRing->dequeuePos);
+
+	while (RSSL_TRUE)
+	{
+		RsslInt32 diff;
+
+		pCell = &pRing->pCells[pos & pRing->mask];
+		seq = RSSL_REACTOR_EVENT_RING_LOAD(pCell->sequence);
+		diff = (RsslInt32)((RsslUInt32)seq - ((RsslUInt32)pos + 1));
+
+		if (diff == 0)
+		{
+			/* Cell is filled for this position; try to claim it. */
+			prevPos = RTR_ATOMIC_COMPARE_AND_SWAP(pRing->dequeuePos, pos, (rtr_atomic_val)((RsslUInt32)pos + 1));
+			if (prevPos == pos)
+				break;
+			pos = prevPos;
+		}
+		else if (diff < 0)
+			return NULL; /* Nothing has been published at this position yet; ring is empty. */
+		else
+			pos = RSSL_REACTOR_EVENT_RING_LOAD(pRing->dequeuePos);
+	}
+
+	pData = pCell->pData;
+	RSSL_REACTOR_EVENT_RING_STORE(pCell->sequence, (rtr_atomic_val)((RsslUInt32)pos + (RsslUInt32)pRing->mask + 1));
+	return pData;
+}
+
+/* rsslReactorEventRingGetCount
+ * Returns the number of entries in the ring. This is only a snapshot if other threads are using the ring. */
+RTR_C_INLINE RsslUInt32 rsslReactorEventRingGetCount(RsslReactorEventRing *pRing)
+{
+	RsslInt32 count = (RsslInt32)((RsslUInt32)RSSL_REACTOR_EVENT_RING_LOAD(pRing->enqueuePos) - (RsslUInt32)RSSL_REACTOR_EVENT_RING_LOAD(pRing->dequeuePos));
+	return count > 0 ? (RsslUInt32)count : 0;
+}
+
 /* Event Queue */
 
 typedef struct _RsslReactorEventQueueGroup RsslReactorEventQueueGroup;
 
 /* RsslReactorEventQueue
- * Queue of RsslReactorEvents */
+ * Queue of RsslReactorEvents.
+ * If initialized with a ring size, events and the pool of free events are kept in lock-free rings and
+ * eventQueue(with eventQueueLock) is only used to hold events when the ring is full. Otherwise, events and the pool
+ * are kept in eventQueue and eventPool, protected by their locks. */
 typedef struct
 {
 	RsslQueue eventPool;
@@ -44,6 +208,13 @@ typedef struct
 	RsslReactorEventQueueGroup *pParentGroup;
 	RsslQueueLink readyEventQueueLink;
 	RsslBool isInActiveEventQueueGroup;
+
+	RsslBool useRing;
+	RsslReactorEventRing eventRing;			/* Events waiting to be dispatched */
+	RsslReactorEventRing eventPoolRing;		/* Free events */
+	rtr_atomic_val pendingCount;			/* Number of events in eventRing and eventQueue */
+	volatile RsslBool overflowActive;		/* eventQueue holds events that did not fit in eventRing.
+											 * Events are added to eventQueue until it is emptied, to preserve ordering. */
 } RsslReactorEventQueue;
 
 /* RsslReactorEventQueueGroup
@@ -88,6 +259,30 @@ RTR_C_INLINE int rsslGetEventQueueGroupSignalFD(RsslReactorEventQueueGroup *pQue
 }
 
 
+/* Adds the event queue to its parent's event queue list if appropriate.
+ * Triggers the event queue list's signal if the list was empty. */
+RTR_C_INLINE RsslRet rsslReactorEventQueueSetActive(RsslReactorEventQueue *pQueue)
+{
+	RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+
+	if (pQueue->isInActiveEventQueueGroup) return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
+
+	/* Add to parent list of active queues */
+	rsslQueueAddLinkToBack(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+	pQueue->isInActiveEventQueueGroup = RSSL_TRUE;
+
+	if (rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup) == 1)
+	{
+		/* List was previously empty; Need to trigger queue list descriptor */
+		if (rsslSetEventSignal(&pQueue->pParentGroup->eventSignal) < 0)
+			return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_FAILURE);
+	}
+
+	RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+
+	return RSSL_RET_SUCCESS;
+}
+
 /* Removes the event queue from its parent's event queue list if appropriate.
  * Resets the event queue list's signal if appropriate. */
 /* Ownership of pQueue->eventQueueLock is assumed */
@@ -131,10 +326,11 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueueGroup(RsslReactorEventQueueGrou
 	return RSSL_RET_SUCCESS;
 }
 
-/* rsslInitReactorEventQueue 
+/* rsslInitReactorEventQueueEx
  * Initializes an RsslReactorEventQueue.
- */
-RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, int poolSize, RsslReactorEventQueueGroup *pParentGroup)
+ * If ringSize is nonzero, the queue and its pool of events are kept in lock-free rings of at least that size. 
+ * Otherwise, they are kept in locked RsslQueues. */
+RTR_C_INLINE RsslRet rsslInitReactorEventQueueEx(RsslReactorEventQueue *pQueue, int poolSize, RsslUInt32 ringSize, RsslReactorEventQueueGroup *pParentGroup)
 {
 	int i;
 
@@ -150,6 +346,23 @@ RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, in
 
 	pQueue->pParentGroup = pParentGroup;
 
+	if (ringSize)
+	{
+		if ((RsslUInt32)poolSize > ringSize)
+			ringSize = (RsslUInt32)poolSize;
+
+		if (rsslInitReactorEventRing(&pQueue->eventRing, ringSize) != RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;
+
+		if (rsslInitReactorEventRing(&pQueue->eventPoolRing, ringSize) != RSSL_RET_SUCCESS)
+		{
+			rsslCleanupReactorEventRing(&pQueue->eventRing);
+			return RSSL_RET_FAILURE;
+		}
+
+		pQueue->useRing = RSSL_TRUE;
+	}
+
 	for (i = 0; i < poolSize; ++i)
 	{
 		RsslReactorEventImpl *pNewEvent = (RsslReactorEventImpl*)malloc(sizeof(RsslReactorEventImpl));
@@ -157,13 +370,24 @@ RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, in
 		{
 			rsslClearReactorEventImpl(pNewEvent);
 			rsslInitQueueLink(&pNewEvent->base.eventQueueLink);
-			rsslQueueAddLinkToBack(&pQueue->eventPool, &pNewEvent->base.eventQueueLink);
+			if (pQueue->useRing)
+				rsslReactorEventRingPush(&pQueue->eventPoolRing, pNewEvent);
+			else
+				rsslQueueAddLinkToBack(&pQueue->eventPool, &pNewEvent->base.eventQueueLink);
 		}
 	}
 
 	return RSSL_RET_SUCCESS;
 }
 
+/* rsslInitReactorEventQueue 
+ * Initializes an RsslReactorEventQueue that uses locked RsslQueues.
+ */
+RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, int poolSize, RsslReactorEventQueueGroup *pParentGroup)
+{
+	return rsslInitReactorEventQueueEx(pQueue, poolSize, 0, pParentGroup);
+}
+
 /* rsslCleanupReactorEventQueue
  * Cleans up an RsslReactorEventQueue */
 RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
@@ -183,6 +407,19 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
 		free(pEvent);
 	}
 
+	if (pQueue->useRing)
+	{
+		while ((pEvent = (RsslReactorEventImpl*)rsslReactorEventRingPop(&pQueue->eventRing)))
+			free(pEvent);
+
+		while ((pEvent = (RsslReactorEventImpl*)rsslReactorEventRingPop(&pQueue->eventPoolRing)))
+			free(pEvent);
+
+		rsslCleanupReactorEventRing(&pQueue->eventRing);
+		rsslCleanupReactorEventRing(&pQueue->eventPoolRing);
+		pQueue->useRing = RSSL_FALSE;
+	}
+
 	if (pQueue->pLastEvent)
 	{
 		free(pQueue->pLastEvent);
@@ -200,6 +437,21 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 	RsslReactorEventImpl *pEvent;
 	RsslQueueLink *pLink;
 
+	if (pQueue->useRing)
+	{
+		if (!(pEvent = (RsslReactorEventImpl*)rsslReactorEventRingPop(&pQueue->eventPoolRing)))
+		{
+			pEvent = (RsslReactorEventImpl*)malloc(sizeof(RsslReactorEventImpl));
+			if (pEvent)
+			{
+				rsslClearReactorEventImpl(pEvent);
+				rsslInitQueueLink(&pEvent->base.eventQueueLink);
+			}
+		}
+
+		return pEvent;
+	}
+
 	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
 	if ( (pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
 		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
@@ -221,6 +473,14 @@ RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorE
 /* This should not be run if the event has alredy been placed into an event queue. */
 RTR_C_INLINE void rsslReactorEventQueueReturnToPool(RsslReactorEventImpl *pEvent, RsslReactorEventQueue *pQueue, RsslInt32 poolSize)
 {
+	if (pQueue->useRing)
+	{
+		if ((poolSize != -1 && (RsslInt32)rsslReactorEventRingGetCount(&pQueue->eventPoolRing) >= poolSize)
+				|| !rsslReactorEventRingPush(&pQueue->eventPoolRing, pEvent))
+			free(pEvent);
+		return;
+	}
+
 	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
 
 	if (poolSize == -1 || (RsslInt32)pQueue->eventPool.count < poolSize)
@@ -235,10 +495,113 @@ RTR_C_INLINE void rsslReactorEventQueueReturnToPool(RsslReactorEventImpl *pEvent
 	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
 }
 
+/* Returns the number of free events in the queue's pool. */
+RTR_C_INLINE RsslUInt32 rsslReactorEventQueueGetPoolCount(RsslReactorEventQueue *pQueue)
+{
+	RsslUInt32 count;
+
+	if (pQueue->useRing)
+		return rsslReactorEventRingGetCount(&pQueue->eventPoolRing);
+
+	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
+	count = rsslQueueGetElementCount(&pQueue->eventPool);
+	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
+	return count;
+}
+
+/* Adds to the pending event count of a ring queue and returns the previous count. */
+RTR_C_INLINE rtr_atomic_val rsslReactorEventQueueAddPending(RsslReactorEventQueue *pQueue, rtr_atomic_val value)
+{
+	rtr_atomic_val count = RSSL_REACTOR_EVENT_RING_LOAD(pQueue->pendingCount), prevCount;
+
+	while ((prevCount = RTR_ATOMIC_COMPARE_AND_SWAP(pQueue->pendingCount, count, count + value)) != count)
+		count = prevCount;
+
+	return count;
+}
+
+/* Puts an event on a ring queue. The parent group lock is only taken when the queue becomes non-empty. */
+RTR_C_INLINE RsslRet rsslReactorEventQueuePutRing(RsslReactorEventQueue *pQueue, RsslReactorEventImpl *pEvent)
+{
+	if (pQueue->overflowActive || !rsslReactorEventRingPush(&pQueue->eventRing, pEvent))
+	{
+		/* Ring is full, or earlier events are still waiting in the overflow queue. */
+		RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
+		pQueue->overflowActive = RSSL_TRUE;
+		rsslQueueAddLinkToBack(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
+		RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+	}
+
+	/* The event is visible before it is counted, so the consumer never sees a count without an event. */
+	if (rsslReactorEventQueueAddPending(pQueue, 1) == 0)
+		return rsslReactorEventQueueSetActive(pQueue);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Gets an event from a ring queue. The parent group lock is only taken when the queue appears empty. */
+RTR_C_INLINE RsslReactorEventImpl* rsslReactorEventQueueGetRing(RsslReactorEventQueue *pQueue, RsslRet *pRet)
+{
+	RsslReactorEventImpl *pEvent;
+	rtr_atomic_val count;
+
+	if (!(pEvent = (RsslReactorEventImpl*)rsslReactorEventRingPop(&pQueue->eventRing)) && pQueue->overflowActive)
+	{
+		RsslQueueLink *pLink;
+
+		RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
+		if ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue)))
+			pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+		if (rsslQueueGetElementCount(&pQueue->eventQueue) == 0)
+			pQueue->overflowActive = RSSL_FALSE;
+		RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+	}
+
+	if (pEvent)
+		count = rsslReactorEventQueueAddPending(pQueue, -1) - 1;
+	else
+		count = 0;
+
+	/* The count may briefly be negative if an event was taken before its producer counted it; 
+	 * that producer will not try to activate the queue. */
+	if (count <= 0 && pQueue->isInActiveEventQueueGroup)
+	{
+		/* May need to reset parent EventQueueGroup. Recheck the count under the group lock,
+		 * since a producer that adds an event activates the queue under the same lock. */
+		RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+
+		if (pQueue->isInActiveEventQueueGroup && RSSL_REACTOR_EVENT_RING_LOAD(pQueue->pendingCount) <= 0)
+		{
+			rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+			pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
+
+			if (rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup) == 0)
+			{
+				/* List is now empty; need to reset queue list descriptor */
+				if (rsslResetEventSignal(&pQueue->pParentGroup->eventSignal) < 0)
+				{
+					RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+					*pRet = RSSL_RET_FAILURE;
+					return NULL;
+				}
+			}
+		}
+
+		RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+	}
+
+	pQueue->pLastEvent = pEvent;
+	*pRet = count > 0 ? count : 0;
+	return pEvent;
+}
+
 RTR_C_INLINE RsslRet rsslReactorEventQueuePut(RsslReactorEventQueue *pQueue, RsslReactorEventImpl *pEvent)
 {
 	RsslUInt32 count;
 
+	if (pQueue->useRing)
+		return rsslReactorEventQueuePutRing(pQueue, pEvent);
+
 	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
 
 	rsslQueueAddLinkToBack(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
@@ -297,6 +660,9 @@ RTR_C_INLINE RsslReactorEventImpl* rsslReactorEventQueueGet(RsslReactorEventQueu
 		pQueue->pLastEvent = 0;
 	}
 
+	if (pQueue->useRing)
+		return rsslReactorEventQueueGetRing(pQueue, pRet);
+
 	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
 
 	count = rsslQueueGetElementCount(&pQueue->eventQueue);
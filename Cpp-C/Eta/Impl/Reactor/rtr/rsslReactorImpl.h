@@ -25,6 +25,7 @@
 #include "rtr/rsslReactorTokenMgntImpl.h"
 #include "rtr/rsslJsonConverter.h"
 #include "rtr/rsslHashTable.h"
+#include "rtr/rsslGetTime.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -123,6 +124,7 @@ typedef struct
 	RsslRet readRet;				/* Last return code from rsslRead on this channel. Helps determine whether data can still be read from this channel. */
 	RsslRet writeRet;				/* Last return from rsslWrite() for this channel. Helps determine whether we should request a flush. */
 	RsslBool requestedFlush;		/* Indicates whether flushing is signaled for this channel */
+	rtr_atomic_val autoPackDelayUsec;	/* RSSL_AUTO_PACK_DELAY set on this channel; the worker waits this long before flushing. Set by the application thread. */
 	RsslWatchlist *pWatchlist;
 	RsslBool	wlDispatchEventQueued;
 	RsslBool	tunnelDispatchEventQueued;
@@ -146,6 +148,7 @@ typedef struct
 	RsslErrorInfo channelWorkerCerr;
 	RsslInt64 lastRequestedExpireTime;
 	RsslInt64 nextExpireTime;
+	RsslTimeValue packFlushTimeUsec; /* When to start flushing an auto-packing channel, or 0 if it is not waiting */
 	RsslNotifierEvent *pWorkerNotifierEvent;
 
 	/* Reconnection logic */
@@ -395,6 +398,8 @@ RTR_C_INLINE RsslRet _rsslChannelFreeConnectionList(RsslReactorChannelImpl *pRea
 RTR_C_INLINE void rsslResetReactorChannelState(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel)
 {
 	pReactorChannel->requestedFlush = 0;
+	pReactorChannel->autoPackDelayUsec = 0;
+	pReactorChannel->packFlushTimeUsec = 0;
 	pReactorChannel->channelSetupState = RSSL_RC_CHST_INIT;
 	pReactorChannel->lastPingReadMs = 0;
 	pReactorChannel->readRet = 0;
@@ -487,6 +492,7 @@ typedef struct
 	RsslThreadId thread;
 	RsslReactorEventQueue workerQueue;
 	RsslUInt32 sleepTimeMs; /* Time to sleep when not flushing; should be equivalent to 1/3 of smallest ping timeout. */
+	RsslTimeValue nextPackFlushUsec; /* Earliest packFlushTimeUsec of the active channels, or 0 if none is waiting */
 
 	RsslErrorInfo workerCerr;
 	RsslReactorEventQueueGroup activeEventQueueGroup;
@@ -534,6 +540,8 @@ struct _RsslReactorImpl
 
 	RsslNotifier *pNotifier; /* Notifier for reactorEventQueue and channels */
 	RsslNotifierEvent *pQueueNotifierEvent; /* Notification for reactorEventQueue */
+	RsslNotifierType notifierType; /* Notification mechanism used by the reactor and worker notifiers */
+	RsslIoUring *pIoUring; /* Shared by channels that set RsslTcpOpts::io_uring, so each dispatch and worker pass sends their writes in one system call */
 
 	RsslBuffer memoryBuffer;
 
@@ -14,6 +14,7 @@
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslThread.h"
 #include "rtr/rtratomic.h"
+#include "rtr/rsslHashTable.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -8,15 +8,18 @@
 
 
 #include <stdio.h>
+#include <string.h>
 #include "rtr/rsslAlloc.h"
 #include "rtr/rsslErrors.h"
 #include "rtr/rsslSocketTransportImpl.h"
 #include "rtr/debugPrint.h"
+#include "rtr/rsslThread.h"
 
 #ifndef _RIPC_NO_ZLIB
 
 #include "zlib.h"
 #include "lz4.h"
+#include "zstd.h"
 
 //
 // zlib routines start here
@@ -203,31 +206,152 @@ RsslInt32 ripcInitZlibComp()
 //	LZ4 compression routines start here
 //
 static char lz4PlaceHolder;
-static void *lz4CompInit(RsslInt32 compressionLevel, int notUsed, RsslError *error)
+
+/* When both sides support it, each direction of an LZ4 channel is compressed as one stream, so a message can
+ * reference the previous 64KB of messages instead of being compressed on its own.  LZ4 references earlier data
+ * in place, so both sides copy messages through a ring buffer that holds the window plus the largest message. */
+#define LZ4_STREAM_WINDOW_SIZE 65536
+
+typedef struct
+{
+	LZ4_stream_t		*stream;
+	LZ4_streamDecode_t	*streamDecode;
+	char				*ring;
+	int					ringSize;
+	int					ringPos;
+	int					maxMsgSize;
+} ripcLz4Stream;
+
+static ripcLz4Stream *lz4StreamCreate(int maxMsgSize, RsslError *error)
+{
+	ripcLz4Stream *lz4Stream = (ripcLz4Stream*)_rsslMalloc(sizeof(ripcLz4Stream));
+
+	if (lz4Stream == 0 || (lz4Stream->ring = (char*)_rsslMalloc(LZ4_STREAM_WINDOW_SIZE + maxMsgSize + 8)) == 0)
+	{
+		if (lz4Stream)
+			_rsslFree(lz4Stream);
+
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 Could not allocate LZ4 stream buffer.\n", __FILE__, __LINE__);
+		return 0;
+	}
+
+	lz4Stream->stream = 0;
+	lz4Stream->streamDecode = 0;
+	lz4Stream->ringSize = LZ4_STREAM_WINDOW_SIZE + maxMsgSize + 8;
+	lz4Stream->ringPos = 0;
+	lz4Stream->maxMsgSize = maxMsgSize;
+	return lz4Stream;
+}
+
+/* Both sides wrap the ring the same way, at the point where the largest message might not fit */
+static void lz4StreamAdvance(ripcLz4Stream *lz4Stream, int length)
 {
-	return(&lz4PlaceHolder);	// returning NULL is considered a failure, so return a valid address as a fake zstream
+	lz4Stream->ringPos += length;
+	if (lz4Stream->ringPos + lz4Stream->maxMsgSize > lz4Stream->ringSize)
+		lz4Stream->ringPos = 0;
 }
 
-static void *lz4DecompInit(int notUsed, RsslError *error)
+/* A nonzero streamMaxMsgSize selects stream compression, and is the largest message that will be compressed */
+static void *lz4CompInit(RsslInt32 compressionLevel, int streamMaxMsgSize, RsslError *error)
 {
-	return(&lz4PlaceHolder);	// returning NULL is considered a failure, so return a valid address as a fake zstream
+	ripcLz4Stream *lz4Stream;
+
+	if (streamMaxMsgSize <= 0)
+		return(&lz4PlaceHolder);	// returning NULL is considered a failure, so return a valid address as a fake zstream
+
+	if ((lz4Stream = lz4StreamCreate(streamMaxMsgSize, error)) == 0)
+		return 0;
+
+	if ((lz4Stream->stream = LZ4_createStream()) == 0)
+	{
+		_rsslFree(lz4Stream->ring);
+		_rsslFree(lz4Stream);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 LZ4_createStream failed.\n", __FILE__, __LINE__);
+		return 0;
+	}
+
+	return lz4Stream;
+}
+
+static void *lz4DecompInit(int streamMaxMsgSize, RsslError *error)
+{
+	ripcLz4Stream *lz4Stream;
+
+	if (streamMaxMsgSize <= 0)
+		return(&lz4PlaceHolder);	// returning NULL is considered a failure, so return a valid address as a fake zstream
+
+	if ((lz4Stream = lz4StreamCreate(streamMaxMsgSize, error)) == 0)
+		return 0;
+
+	if ((lz4Stream->streamDecode = LZ4_createStreamDecode()) == 0)
+	{
+		_rsslFree(lz4Stream->ring);
+		_rsslFree(lz4Stream);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 LZ4_createStreamDecode failed.\n", __FILE__, __LINE__);
+		return 0;
+	}
+
+	return lz4Stream;
 }
 
 static void lz4CompEnd(void *zstream)
 {
-	// we do not need to do anything with the fake zstream that was returned by lz4CompInit()
+	ripcLz4Stream *lz4Stream = (ripcLz4Stream*)zstream;
+
+	// the fake zstream that was returned by lz4CompInit() needs no cleanup
+	if (zstream == &lz4PlaceHolder)
+		return;
+
+	LZ4_freeStream(lz4Stream->stream);
+	_rsslFree(lz4Stream->ring);
+	_rsslFree(lz4Stream);
 }
 
 static void lz4DecompEnd(void *zstream)
 {
-	// we do not need to do anything with the fake zstream that was returned by lz4DecompInit()
+	ripcLz4Stream *lz4Stream = (ripcLz4Stream*)zstream;
+
+	// the fake zstream that was returned by lz4DecompInit() needs no cleanup
+	if (zstream == &lz4PlaceHolder)
+		return;
+
+	LZ4_freeStreamDecode(lz4Stream->streamDecode);
+	_rsslFree(lz4Stream->ring);
+	_rsslFree(lz4Stream);
 }
 
 static RsslRet lz4Comp(void* stream, ripcCompBuffer *buf, int notUsed, RsslError *error)
 {
 	RsslInt32 err;
 
-	err = LZ4_compress_default(buf->next_in, buf->next_out, buf->avail_in, buf->avail_out);
+	if (stream != &lz4PlaceHolder)
+	{
+		ripcLz4Stream *lz4Stream = (ripcLz4Stream*)stream;
+		char *ringIn = lz4Stream->ring + lz4Stream->ringPos;
+
+		if ((int)buf->avail_in > lz4Stream->maxMsgSize)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 LZ4 stream cannot compress %u bytes (max = %d)\n", __FILE__, __LINE__, buf->avail_in, lz4Stream->maxMsgSize);
+			return -1;
+		}
+
+		memcpy(ringIn, buf->next_in, buf->avail_in);
+		err = LZ4_compress_fast_continue(lz4Stream->stream, ringIn, buf->next_out, buf->avail_in, (int)buf->avail_out, 1);
+		if (err <= 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 LZ4_compress_fast_continue failed. LZ4 error: %d\n", __FILE__, __LINE__, err);
+			return -1;
+		}
+
+		lz4StreamAdvance(lz4Stream, buf->avail_in);
+	}
+	else
+		err = LZ4_compress_default(buf->next_in, buf->next_out, buf->avail_in, buf->avail_out);
 
 	if(err < 0)
 	{
@@ -255,7 +379,22 @@ static RsslRet lz4Comp(void* stream, ripcCompBuffer *buf, int notUsed, RsslError
 static RsslRet lz4Decomp(void* stream, ripcCompBuffer *buf, int notUsed, RsslError *error)
 {
 	RsslInt32 err;
-	err = LZ4_decompress_safe(buf->next_in, buf->next_out, buf->avail_in, buf->avail_out);
+
+	if (stream != &lz4PlaceHolder)
+	{
+		ripcLz4Stream *lz4Stream = (ripcLz4Stream*)stream;
+		char *ringOut = lz4Stream->ring + lz4Stream->ringPos;
+		int maxOut = (buf->avail_out < (unsigned long)lz4Stream->maxMsgSize) ? (int)buf->avail_out : lz4Stream->maxMsgSize;
+
+		err = LZ4_decompress_safe_continue(lz4Stream->streamDecode, buf->next_in, ringOut, buf->avail_in, maxOut);
+		if (err >= 0)
+		{
+			memcpy(buf->next_out, ringOut, err);
+			lz4StreamAdvance(lz4Stream, err);
+		}
+	}
+	else
+		err = LZ4_decompress_safe(buf->next_in, buf->next_out, buf->avail_in, buf->avail_out);
 
 	if(err < 0)
 	{
@@ -290,4 +429,403 @@ int ripcInitLz4Comp()
 	return(ipcSetCompFunc(RSSL_COMP_LZ4,&funcs));
 }
 
+//
+//	Zstandard compression routines start here
+//
+
+/* Without a dictionary, a channel compresses one continuous stream and keeps this much history */
+#define ZSTD_STREAM_WINDOW_LOG 17
+
+/* A dictionary set with rsslSetCompressionDictionary.  Channels hold a reference to the dictionary
+ * they started with, so it can be replaced while they are open. */
+typedef struct
+{
+	char			*content;
+	size_t			length;
+	unsigned		dictId;
+	ZSTD_DDict		*ddict;
+	ZSTD_CDict		*cdicts[ZLIB_COMP_MAX_LEVEL + 1];	/* created when a channel first compresses at that level */
+	RsslInt32		refCount;
+} ripcZstdDict;
+
+typedef struct
+{
+	ZSTD_CCtx		*cctx;
+	ripcZstdDict	*dict;
+} ripcZstdCompStream;
+
+typedef struct
+{
+	ZSTD_DCtx		*dctx;
+	ripcZstdDict	*dict;
+} ripcZstdDecompStream;
+
+static RsslMutex		zstdDictMutex;
+static RsslBool			zstdDictMutexInit = RSSL_FALSE;
+static ripcZstdDict		*zstdDict = 0;
+
+static void zstdFreeDict(ripcZstdDict *dict)
+{
+	int i;
+
+	for (i = 0; i <= ZLIB_COMP_MAX_LEVEL; i++)
+		ZSTD_freeCDict(dict->cdicts[i]);
+	ZSTD_freeDDict(dict->ddict);
+	_rsslFree(dict->content);
+	_rsslFree(dict);
+}
+
+/* Returns the current dictionary with a reference added, or NULL if its id is not dictId.
+ * If compressionLevel is not -1, makes sure the dictionary is ready to compress at that level. */
+static ripcZstdDict *zstdGetDict(unsigned dictId, RsslInt32 compressionLevel, int zstdLevel)
+{
+	ripcZstdDict *dict;
+
+	RSSL_MUTEX_LOCK(&zstdDictMutex);
+	dict = zstdDict;
+	if (dict && dict->dictId != dictId)
+		dict = 0;
+	if (dict)
+	{
+		if (compressionLevel != -1 && dict->cdicts[compressionLevel] == 0)
+			dict->cdicts[compressionLevel] = ZSTD_createCDict(dict->content, dict->length, zstdLevel);
+
+		if (compressionLevel != -1 && dict->cdicts[compressionLevel] == 0)
+			dict = 0;
+		else
+			dict->refCount++;
+	}
+	RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+
+	return dict;
+}
+
+static void zstdDropDictRef(ripcZstdDict *dict)
+{
+	RsslInt32 refCount;
+
+	if (dict == 0)
+		return;
+
+	RSSL_MUTEX_LOCK(&zstdDictMutex);
+	refCount = --dict->refCount;
+	RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+
+	if (refCount == 0)
+		zstdFreeDict(dict);
+}
+
+static void zstdCompEnd(void *zstream)
+{
+	ripcZstdCompStream *zs = (ripcZstdCompStream*)zstream;
+	if (zs)
+	{
+		ZSTD_freeCCtx(zs->cctx);
+		zstdDropDictRef(zs->dict);
+		_rsslFree(zs);
+	}
+}
+
+static void zstdDecompEnd(void *zstream)
+{
+	ripcZstdDecompStream *zs = (ripcZstdDecompStream*)zstream;
+	if (zs)
+	{
+		ZSTD_freeDCtx(zs->dctx);
+		zstdDropDictRef(zs->dict);
+		_rsslFree(zs);
+	}
+}
+
+/* dictId is the dictionary the channel negotiated, or 0 to compress one stream without a dictionary */
+static void *zstdCompInit(RsslInt32 compressionLevel, int dictId, RsslError *error)
+{
+	ripcZstdCompStream *zs;
+	int zstdLevel;
+	size_t err;
+
+	if (compressionLevel < ZLIB_COMP_MIN_LEVEL || compressionLevel > ZLIB_COMP_MAX_LEVEL)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1004 Invalid zstd compression level %d.  Level must be between 0 and 9.\n",
+			__FILE__, __LINE__, compressionLevel);
+		return 0;
+	}
+
+	/* levels 1 to 9 are used as is, level 0 asks for the fastest */
+	zstdLevel = (compressionLevel == 0 ? 1 : compressionLevel);
+
+	if ((zs = (ripcZstdCompStream*)_rsslMalloc(sizeof(ripcZstdCompStream))) == 0)
+		return 0;
+
+	zs->cctx = 0;
+	zs->dict = 0;
+	if (dictId != 0 && (zs->dict = zstdGetDict((unsigned)dictId, compressionLevel, zstdLevel)) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1004 Compression dictionary %u is no longer available.\n",
+			__FILE__, __LINE__, (unsigned)dictId);
+		zstdCompEnd(zs);
+		return 0;
+	}
+
+	if ((zs->cctx = ZSTD_createCCtx()) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 ZSTD_createCCtx() failed.\n", __FILE__, __LINE__);
+		zstdCompEnd(zs);
+		return 0;
+	}
+
+	if (zs->dict)
+		err = ZSTD_CCtx_refCDict(zs->cctx, zs->dict->cdicts[compressionLevel]);
+	else
+	{
+		err = ZSTD_CCtx_setParameter(zs->cctx, ZSTD_c_compressionLevel, zstdLevel);
+		if (!ZSTD_isError(err))
+			err = ZSTD_CCtx_setParameter(zs->cctx, ZSTD_c_windowLog, ZSTD_STREAM_WINDOW_LOG);
+	}
+
+	if (ZSTD_isError(err))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 Zstd compression setup failed. Zstd error: %s\n",
+			__FILE__, __LINE__, ZSTD_getErrorName(err));
+		zstdCompEnd(zs);
+		return 0;
+	}
+
+	_DEBUG_TRACE_COMPRESSION("zstd using compression level=%d dictId=%u\n", zstdLevel, (zs->dict ? zs->dict->dictId : 0))
+
+	return zs;
+}
+
+static void *zstdDecompInit(int dictId, RsslError *error)
+{
+	ripcZstdDecompStream *zs;
+	size_t err = 0;
+
+	if ((zs = (ripcZstdDecompStream*)_rsslMalloc(sizeof(ripcZstdDecompStream))) == 0)
+		return 0;
+
+	zs->dctx = 0;
+	zs->dict = 0;
+	if (dictId != 0 && (zs->dict = zstdGetDict((unsigned)dictId, -1, 0)) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1004 Compression dictionary %u is no longer available.\n",
+			__FILE__, __LINE__, (unsigned)dictId);
+		zstdDecompEnd(zs);
+		return 0;
+	}
+
+	if ((zs->dctx = ZSTD_createDCtx()) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 ZSTD_createDCtx() failed.\n", __FILE__, __LINE__);
+		zstdDecompEnd(zs);
+		return 0;
+	}
+
+	if (zs->dict)
+		err = ZSTD_DCtx_refDDict(zs->dctx, zs->dict->ddict);
+
+	if (ZSTD_isError(err))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 Zstd decompression setup failed. Zstd error: %s\n",
+			__FILE__, __LINE__, ZSTD_getErrorName(err));
+		zstdDecompEnd(zs);
+		return 0;
+	}
+
+	return zs;
+}
+
+static RsslRet zstdComp(void *zstream, ripcCompBuffer *buf, int resetContext, RsslError *error)
+{
+	ripcZstdCompStream *zs = (ripcZstdCompStream*)zstream;
+	ZSTD_inBuffer in;
+	ZSTD_outBuffer out;
+	size_t err;
+
+	in.src = buf->next_in;
+	in.size = buf->avail_in;
+	in.pos = 0;
+	out.dst = buf->next_out;
+	out.size = buf->avail_out;
+	out.pos = 0;
+
+	/* With a dictionary, each message is its own frame, so it only refers back to the dictionary.
+	 * Otherwise, flush at the end of each message and keep the history, as zlib does. */
+	err = ZSTD_compressStream2(zs->cctx, &out, &in, (zs->dict || resetContext) ? ZSTD_e_end : ZSTD_e_flush);
+	if (ZSTD_isError(err))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_compressStream2() failed. Zstd error: %s\n",
+			__FILE__, __LINE__, ZSTD_getErrorName(err));
+		return -1;
+	}
+
+	buf->bytes_in_used = (RsslUInt32)in.pos;
+	buf->bytes_out_used = (RsslUInt32)out.pos;
+
+	buf->next_in = buf->next_in + in.pos;
+	buf->avail_in = buf->avail_in - (RsslUInt32)in.pos;
+	buf->next_out = buf->next_out + out.pos;
+	buf->avail_out = buf->avail_out - (unsigned long)out.pos;
+	_DEBUG_TRACE_COMPRESSION("zstd Compressed %d inbytes to %d outbytes (avail_out = %lu)\n", buf->bytes_in_used, buf->bytes_out_used, buf->avail_out)
+
+	return 1;
+}
+
+static RsslRet zstdDecomp(void *zstream, ripcCompBuffer *buf, int resetContext, RsslError *error)
+{
+	ripcZstdDecompStream *zs = (ripcZstdDecompStream*)zstream;
+	ZSTD_inBuffer in;
+	ZSTD_outBuffer out;
+	size_t err;
+
+	in.src = buf->next_in;
+	in.size = buf->avail_in;
+	in.pos = 0;
+	out.dst = buf->next_out;
+	out.size = buf->avail_out;
+	out.pos = 0;
+
+	if (resetContext)
+		ZSTD_DCtx_reset(zs->dctx, ZSTD_reset_session_only);
+
+	/* a buffer can hold the end of one frame and the start of the next */
+	do
+	{
+		err = ZSTD_decompressStream(zs->dctx, &out, &in);
+		if (ZSTD_isError(err))
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_decompressStream() failed. Zstd error: %s (dictId %u)\n",
+				__FILE__, __LINE__, ZSTD_getErrorName(err), (zs->dict ? zs->dict->dictId : 0));
+			return -1;
+		}
+	} while (in.pos < in.size && out.pos < out.size);
+
+	buf->bytes_in_used = (RsslUInt32)in.pos;
+	buf->bytes_out_used = (RsslUInt32)out.pos;
+
+	buf->next_in = buf->next_in + in.pos;
+	buf->avail_in = buf->avail_in - (RsslUInt32)in.pos;
+	buf->next_out = buf->next_out + out.pos;
+	buf->avail_out = buf->avail_out - (unsigned long)out.pos;
+	_DEBUG_TRACE_COMPRESSION("zstd Decompressed %d inbytes to %d outbytes\n", buf->bytes_in_used, buf->bytes_out_used)
+
+	return 1;
+}
+
+RsslRet ripcSetZstdDictionary(RsslBuffer *pDictionary, RsslError *error)
+{
+	ripcZstdDict *dict = 0, *oldDict;
+
+	if (pDictionary && pDictionary->length)
+	{
+		if ((dict = (ripcZstdDict*)_rsslMalloc(sizeof(ripcZstdDict))) != 0)
+		{
+			memset(dict, 0, sizeof(ripcZstdDict));
+			if ((dict->content = (char*)_rsslMalloc(pDictionary->length)) == 0)
+			{
+				_rsslFree(dict);
+				dict = 0;
+			}
+		}
+
+		if (dict == 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1001 Could not allocate memory for compression dictionary.\n", __FILE__, __LINE__);
+			return RSSL_RET_FAILURE;
+		}
+
+		memcpy(dict->content, pDictionary->data, pDictionary->length);
+		dict->length = pDictionary->length;
+		dict->dictId = ZSTD_getDictID_fromDict(dict->content, dict->length);
+		if (dict->dictId == 0)
+		{
+			/* raw content has no id of its own, so the handshake identifies it by an FNV-1a hash of the content */
+			size_t i;
+			dict->dictId = 2166136261U;
+			for (i = 0; i < dict->length; i++)
+				dict->dictId = (dict->dictId ^ (unsigned char)dict->content[i]) * 16777619U;
+			if (dict->dictId == 0)
+				dict->dictId = 1;
+		}
+		dict->refCount = 1;
+
+		if ((dict->ddict = ZSTD_createDDict(dict->content, dict->length)) == 0)
+		{
+			zstdFreeDict(dict);
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1004 Invalid compression dictionary.\n", __FILE__, __LINE__);
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	RSSL_MUTEX_LOCK(&zstdDictMutex);
+	oldDict = zstdDict;
+	zstdDict = dict;
+	RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+
+	zstdDropDictRef(oldDict);
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslUInt32 ripcZstdDictionaryId()
+{
+	RsslUInt32 dictId = 0;
+
+	if (!zstdDictMutexInit)
+		return 0;
+
+	RSSL_MUTEX_LOCK(&zstdDictMutex);
+	if (zstdDict)
+		dictId = zstdDict->dictId;
+	RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+
+	return dictId;
+}
+
+RsslRet ripcInitZstdComp()
+{
+	ripcCompFuncs funcs;
+	funcs.compressInit = zstdCompInit;
+	funcs.decompressInit = zstdDecompInit;
+	funcs.compressEnd = zstdCompEnd;
+	funcs.decompressEnd = zstdDecompEnd;
+	funcs.compress = zstdComp;
+	funcs.decompress = zstdDecomp;
+
+	if (!zstdDictMutexInit)
+	{
+		RSSL_MUTEX_INIT_ESDK(&zstdDictMutex);
+		zstdDictMutexInit = RSSL_TRUE;
+	}
+
+	return(ipcSetCompFunc(RSSL_COMP_ZSTD,&funcs));
+}
+
+void ripcUninitZstdComp()
+{
+	if (!zstdDictMutexInit)
+		return;
+
+	/* channels were closed first, so this is the last reference */
+	zstdDropDictRef(zstdDict);
+	zstdDict = 0;
+
+	RSSL_MUTEX_DESTROY(&zstdDictMutex);
+	zstdDictMutexInit = RSSL_FALSE;
+}
+
 #endif
@@ -0,0 +1,737 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/ripcplat.h"
+#include "rtr/ripcuring.h"
+
+#ifdef RIPC_URING_SUPPORTED
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#include "rtr/ripcutils.h"
+#include "rtr/rsslAlloc.h"
+#include "rtr/rsslThread.h"
+
+#define RIPC_URING_ENTRIES			256		/* submission queue entries */
+#define RIPC_URING_CQ_ENTRIES		1024
+#define RIPC_URING_MAX_BUFS			1024	/* registered send buffers, one per channel */
+#define RIPC_URING_MIN_SEND_BUF		65536
+#define RIPC_URING_MAX_SEND_BUF		262144	/* registered buffers count against the memory lock limit */
+#define RIPC_URING_ZC_MIN_SEND		16384	/* smaller sends are cheaper to copy than to pin */
+#define RIPC_URING_CLOSE_WAIT_MS	100		/* per wait for a cancelled send at shutdown */
+#define RIPC_URING_CLOSE_WAITS		10
+
+typedef struct ripcUringSession
+{
+	RsslIoUring				*ring;
+	RsslSocket				fd;				/* the TCP socket */
+
+	/* send buffer; count bytes from head are queued, and are all sent at once */
+	rtr_msgb_t				*sendBuf;
+	RsslUInt32				size;
+	RsslUInt32				head;
+	RsslUInt32				count;
+	RsslUInt32				inFlight;		/* bytes of the outstanding send, 0 if none */
+	RsslInt32				slot;			/* registered buffer index, -1 if not registered */
+	RsslBool				sentFixed;		/* the outstanding send is a zero-copy send from the registered buffer */
+	RsslInt32				sentRes;		/* its result, held until the kernel lets go of the buffer */
+	RsslInt32				status;			/* -1 once a send failed */
+
+	RsslBool				onReadyList;
+	RsslBool				closing;
+	RsslBool				zombie;			/* closed, but the kernel still has its send */
+	struct ripcUringSession	*nextReady;		/* also links the ring's zombies */
+} ripcUringSession;
+
+struct RsslIoUring
+{
+	RsslMutex				mutex;
+	int						ringFd;			/* -1 until the first session sets it up */
+	RsslBool				active;			/* set up, and safe to check without the mutex */
+	RsslBool				setupFailed;
+
+	void					*sqRingPtr;
+	size_t					sqRingSize;
+	void					*cqRingPtr;
+	size_t					cqRingSize;
+	struct io_uring_sqe		*sqes;
+	size_t					sqesSize;
+	unsigned				*sqHead;
+	unsigned				*sqTail;
+	unsigned				*sqArray;
+	unsigned				sqMask;
+	unsigned				sqEntries;
+	unsigned				sqPending;		/* queued but not yet taken by the kernel */
+	unsigned				*cqHead;
+	unsigned				*cqTail;
+	unsigned				cqMask;
+	struct io_uring_cqe		*cqes;
+
+	ripcUringSession		**slots;		/* owner of each registered buffer index */
+	RsslUInt32				slotCount;
+	RsslBool				fixedSend;		/* the kernel takes zero-copy sends from registered buffers */
+
+	ripcUringSession		*readyList;		/* sessions with queued data and no send outstanding */
+	ripcUringSession		*zombieList;
+	RsslUInt32				sessionCount;	/* including zombies */
+	RsslUInt32				zombieCount;
+	RsslBool				privateRing;	/* belongs to one channel and is submitted on each write */
+	RsslBool				freePending;	/* free once the last session is gone */
+};
+
+static int _ripcUringEnter(RsslIoUring *ring, unsigned toSubmit, unsigned minComplete, unsigned flags, void *arg, size_t argSize)
+{
+	return (int)syscall(__NR_io_uring_enter, ring->ringFd, toSubmit, minComplete, flags, arg, argSize);
+}
+
+/* Returns the next submission entry, cleared, or 0 if the queue is full. */
+static struct io_uring_sqe *_ripcUringGetSqe(RsslIoUring *ring)
+{
+	unsigned tail = *ring->sqTail;
+	struct io_uring_sqe *sqe;
+
+	if (tail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE) >= ring->sqEntries)
+		return 0;
+
+	sqe = &ring->sqes[tail & ring->sqMask];
+	memset(sqe, 0, sizeof(struct io_uring_sqe));
+	return sqe;
+}
+
+/* Publishes the entry returned by _ripcUringGetSqe */
+static void _ripcUringQueueSqe(RsslIoUring *ring)
+{
+	unsigned tail = *ring->sqTail;
+
+	ring->sqArray[tail & ring->sqMask] = tail & ring->sqMask;
+	__atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+	ring->sqPending++;
+}
+
+static void _ripcUringMarkReady(ripcUringSession *sess)
+{
+	if (sess->onReadyList || sess->inFlight || sess->count == 0 || sess->status < 0 || sess->closing)
+		return;
+
+	sess->nextReady = sess->ring->readyList;
+	sess->ring->readyList = sess;
+	sess->onReadyList = RSSL_TRUE;
+}
+
+static void _ripcUringUnlink(ripcUringSession **list, ripcUringSession *sess)
+{
+	ripcUringSession **link;
+
+	for (link = list; *link; link = &(*link)->nextReady)
+	{
+		if (*link == sess)
+		{
+			*link = sess->nextReady;
+			break;
+		}
+	}
+}
+
+/* Queues a send of everything in the buffer. Returns RSSL_FALSE if the submission queue is full. */
+static RsslBool _ripcUringStartSend(ripcUringSession *sess)
+{
+	RsslIoUring *ring = sess->ring;
+	struct io_uring_sqe *sqe;
+
+	if ((sqe = _ripcUringGetSqe(ring)) == 0)
+		return RSSL_FALSE;
+
+	/* MSG_WAITALL has the kernel finish a send the socket only took part of */
+	sqe->opcode = IORING_OP_SEND;
+	sqe->fd = sess->fd;
+	sqe->addr = (__u64)(uintptr_t)(sess->sendBuf->buffer + sess->head);
+	sqe->len = sess->count;
+	sqe->msg_flags = MSG_NOSIGNAL | MSG_WAITALL;
+	sqe->user_data = (__u64)(uintptr_t)sess;
+
+	/* The kernel only takes registered buffers for zero-copy sends, which hold on to the
+	 * buffer until a second completion says it is done with it. */
+	sess->sentFixed = (ring->fixedSend && sess->slot >= 0 && sess->count >= RIPC_URING_ZC_MIN_SEND) ? RSSL_TRUE : RSSL_FALSE;
+	if (sess->sentFixed)
+	{
+		sqe->opcode = IORING_OP_SEND_ZC;
+		sqe->ioprio = IORING_RECVSEND_FIXED_BUF;
+		sqe->buf_index = (__u16)sess->slot;
+	}
+
+	_ripcUringQueueSqe(ring);
+	sess->inFlight = sess->count;
+	return RSSL_TRUE;
+}
+
+/* Drops numBytes sent from the head of the buffer */
+static void _ripcUringConsume(ripcUringSession *sess, RsslUInt32 numBytes)
+{
+	sess->count -= numBytes;
+	sess->head += numBytes;
+	if (sess->count == 0)
+		sess->head = 0;
+}
+
+static void _ripcUringSendDone(ripcUringSession *sess, RsslInt32 res)
+{
+	sess->inFlight = 0;
+
+	if (res < 0)
+	{
+		if ((res == -EINVAL || res == -EOPNOTSUPP) && sess->sentFixed)
+			sess->ring->fixedSend = RSSL_FALSE;
+		else if (res != -EAGAIN && res != -EINTR && res != -ECANCELED)
+		{
+			sess->status = -1;
+			errno = -res;
+			return;
+		}
+	}
+	else
+		_ripcUringConsume(sess, (RsslUInt32)res);
+
+	/* the rest goes with the next submit */
+	_ripcUringMarkReady(sess);
+}
+
+static void _ripcUringFreeSession(ripcUringSession *sess)
+{
+	RsslIoUring *ring = sess->ring;
+	struct io_uring_rsrc_update2 update;
+	struct iovec iov;
+
+	if (sess->slot >= 0)
+	{
+		/* an empty buffer clears the index */
+		memset(&iov, 0, sizeof(iov));
+		memset(&update, 0, sizeof(update));
+		update.offset = (__u32)sess->slot;
+		update.data = (__u64)(uintptr_t)&iov;
+		update.nr = 1;
+		syscall(__NR_io_uring_register, ring->ringFd, IORING_REGISTER_BUFFERS_UPDATE, &update, sizeof(update));
+		ring->slots[sess->slot] = 0;
+	}
+
+	if (sess->sendBuf)
+		rtr_smplcFreeMsg(sess->sendBuf);
+
+	if (sess->zombie)
+	{
+		_ripcUringUnlink(&ring->zombieList, sess);
+		ring->zombieCount--;
+	}
+
+	ring->sessionCount--;
+	_rsslFree(sess);
+}
+
+/* Handles every completion waiting on the ring */
+static void _ripcUringReap(RsslIoUring *ring)
+{
+	unsigned head = *ring->cqHead;
+	unsigned tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+	struct io_uring_cqe *cqe;
+	ripcUringSession *sess;
+
+	for (; head != tail; head++)
+	{
+		cqe = &ring->cqes[head & ring->cqMask];
+
+		/* cancels are posted with no session */
+		if ((sess = (ripcUringSession*)(uintptr_t)cqe->user_data) == 0)
+			continue;
+
+		/* a zero-copy send is done once its notification arrives */
+		if (cqe->flags & IORING_CQE_F_MORE)
+		{
+			sess->sentRes = cqe->res;
+			continue;
+		}
+
+		_ripcUringSendDone(sess, (cqe->flags & IORING_CQE_F_NOTIF) ? sess->sentRes : cqe->res);
+		if (sess->zombie)
+			_ripcUringFreeSession(sess);
+	}
+
+	__atomic_store_n(ring->cqHead, head, __ATOMIC_RELEASE);
+}
+
+/* Starts a send for every session with queued data and hands them all to the kernel.
+ * Called with the ring's mutex held. */
+static int _ripcUringSubmit(RsslIoUring *ring)
+{
+	ripcUringSession *sess;
+	int sends = 0;
+	int passes;
+	int ret;
+
+	_ripcUringReap(ring);
+
+	/* A send the kernel refused outright (a zero-copy send it does not support, or one
+	 * interrupted before it began) is ready again after the reap, so it goes once more. */
+	for (passes = 0; passes < 2 && (ring->readyList || ring->sqPending); passes++)
+	{
+		do
+		{
+			while ((sess = ring->readyList) != 0)
+			{
+				if (!_ripcUringStartSend(sess))
+					break;
+
+				ring->readyList = sess->nextReady;
+				sess->onReadyList = RSSL_FALSE;
+				sends++;
+			}
+
+			if (ring->sqPending == 0)
+				break;
+
+			/* anything the kernel did not take stays queued for the next call */
+			if ((ret = _ripcUringEnter(ring, ring->sqPending, 0, 0, 0, 0)) < 0)
+			{
+				if (errno != EAGAIN && errno != EBUSY && errno != EINTR)
+					return -1;
+				break;
+			}
+
+			ring->sqPending -= (unsigned)ret;
+		} while (ring->readyList && ret > 0);
+
+		/* sends the socket took right away are already complete */
+		_ripcUringReap(ring);
+	}
+
+	return sends;
+}
+
+/* Releases the kernel's side of the ring */
+static void _ripcUringTeardown(RsslIoUring *ring)
+{
+	__atomic_store_n(&ring->active, RSSL_FALSE, __ATOMIC_RELEASE);
+
+	if (ring->ringFd >= 0)
+		close(ring->ringFd);
+	if (ring->sqes)
+		munmap(ring->sqes, ring->sqesSize);
+	if (ring->cqRingPtr && ring->cqRingPtr != ring->sqRingPtr)
+		munmap(ring->cqRingPtr, ring->cqRingSize);
+	if (ring->sqRingPtr)
+		munmap(ring->sqRingPtr, ring->sqRingSize);
+	if (ring->slots)
+		_rsslFree(ring->slots);
+
+	ring->ringFd = -1;
+	ring->sqes = 0;
+	ring->cqRingPtr = 0;
+	ring->sqRingPtr = 0;
+	ring->slots = 0;
+	ring->slotCount = 0;
+}
+
+static void _ripcUringFreeRing(RsslIoUring *ring)
+{
+	ripcUringSession *sess;
+
+	/* closing the ring cancels what the kernel still has, so the zombies can go with it */
+	_ripcUringTeardown(ring);
+
+	while ((sess = ring->zombieList) != 0)
+	{
+		ring->zombieList = sess->nextReady;
+		rtr_smplcFreeMsg(sess->sendBuf);
+		_rsslFree(sess);
+	}
+
+	RSSL_MUTEX_DESTROY(&ring->mutex);
+	_rsslFree(ring);
+}
+
+/* Called after unlocking a ring a session was just taken from */
+static void _ripcUringCheckFreeRing(RsslIoUring *ring)
+{
+	if (ring->sessionCount == ring->zombieCount && (ring->privateRing || ring->freePending))
+		_ripcUringFreeRing(ring);
+}
+
+/* Sets up the kernel's side of the ring. Called with the ring's mutex held. */
+static RsslBool _ripcUringSetup(RsslIoUring *ring)
+{
+	struct io_uring_params params;
+	struct io_uring_rsrc_register reg;
+
+	memset(&params, 0, sizeof(params));
+	params.flags = IORING_SETUP_CQSIZE;
+	params.cq_entries = RIPC_URING_CQ_ENTRIES;
+
+	if ((ring->ringFd = (int)syscall(__NR_io_uring_setup, RIPC_URING_ENTRIES, &params)) < 0)
+		return RSSL_FALSE;
+
+	ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	ring->cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+	{
+		if (ring->cqRingSize > ring->sqRingSize)
+			ring->sqRingSize = ring->cqRingSize;
+		ring->cqRingSize = ring->sqRingSize;
+	}
+
+	ring->sqRingPtr = mmap(0, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQ_RING);
+	if (ring->sqRingPtr == MAP_FAILED)
+	{
+		ring->sqRingPtr = 0;
+		return RSSL_FALSE;
+	}
+
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+		ring->cqRingPtr = ring->sqRingPtr;
+	else if ((ring->cqRingPtr = mmap(0, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_CQ_RING)) == MAP_FAILED)
+	{
+		ring->cqRingPtr = 0;
+		return RSSL_FALSE;
+	}
+
+	ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	if ((ring->sqes = (struct io_uring_sqe*)mmap(0, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQES)) == MAP_FAILED)
+	{
+		ring->sqes = 0;
+		return RSSL_FALSE;
+	}
+
+	ring->sqHead = (unsigned*)((char*)ring->sqRingPtr + params.sq_off.head);
+	ring->sqTail = (unsigned*)((char*)ring->sqRingPtr + params.sq_off.tail);
+	ring->sqArray = (unsigned*)((char*)ring->sqRingPtr + params.sq_off.array);
+	ring->sqMask = *(unsigned*)((char*)ring->sqRingPtr + params.sq_off.ring_mask);
+	ring->sqEntries = params.sq_entries;
+	ring->cqHead = (unsigned*)((char*)ring->cqRingPtr + params.cq_off.head);
+	ring->cqTail = (unsigned*)((char*)ring->cqRingPtr + params.cq_off.tail);
+	ring->cqMask = *(unsigned*)((char*)ring->cqRingPtr + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe*)((char*)ring->cqRingPtr + params.cq_off.cqes);
+
+	/* An empty table of registered buffers; each channel fills in its own send buffer.
+	 * Without it sends still work, from unregistered memory. */
+	memset(&reg, 0, sizeof(reg));
+	reg.nr = RIPC_URING_MAX_BUFS;
+	reg.flags = IORING_RSRC_REGISTER_SPARSE;
+	if (syscall(__NR_io_uring_register, ring->ringFd, IORING_REGISTER_BUFFERS2, &reg, sizeof(reg)) >= 0 &&
+		(ring->slots = (ripcUringSession**)_rsslMalloc(RIPC_URING_MAX_BUFS * sizeof(ripcUringSession*))) != 0)
+	{
+		memset(ring->slots, 0, RIPC_URING_MAX_BUFS * sizeof(ripcUringSession*));
+		ring->slotCount = RIPC_URING_MAX_BUFS;
+		ring->fixedSend = RSSL_TRUE;
+	}
+
+	__atomic_store_n(&ring->active, RSSL_TRUE, __ATOMIC_RELEASE);
+	return RSSL_TRUE;
+}
+
+RsslIoUring *ipcUringNewRing()
+{
+	RsslIoUring *ring;
+
+	if ((ring = (RsslIoUring*)_rsslMalloc(sizeof(RsslIoUring))) == 0)
+		return 0;
+
+	memset(ring, 0, sizeof(RsslIoUring));
+	RSSL_MUTEX_INIT(&ring->mutex);
+	ring->ringFd = -1;
+
+	return ring;
+}
+
+void ipcUringFreeRing(RsslIoUring *ring)
+{
+	RsslBool freeNow;
+
+	RSSL_MUTEX_LOCK(&ring->mutex);
+	if (ring->active)
+		_ripcUringReap(ring);
+	ring->freePending = RSSL_TRUE;
+	freeNow = (ring->sessionCount == ring->zombieCount) ? RSSL_TRUE : RSSL_FALSE;
+	RSSL_MUTEX_UNLOCK(&ring->mutex);
+
+	if (freeNow)
+		_ripcUringFreeRing(ring);
+}
+
+int ipcUringSubmit(RsslIoUring *ring)
+{
+	int ret;
+
+	/* nothing to do costs no system call */
+	if (!__atomic_load_n(&ring->active, __ATOMIC_ACQUIRE) || (__atomic_load_n(&ring->readyList, __ATOMIC_ACQUIRE) == 0 && *ring->cqHead == __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE)))
+		return 0;
+
+	RSSL_MUTEX_LOCK(&ring->mutex);
+	ret = _ripcUringSubmit(ring);
+	RSSL_MUTEX_UNLOCK(&ring->mutex);
+
+	return ret;
+}
+
+void *ipcUringNewSession(RsslIoUring *ring, RsslSocket fd)
+{
+	ripcUringSession *sess;
+	struct io_uring_rsrc_update2 update;
+	struct iovec iov;
+	int sndBuf = 0;
+	socklen_t len = sizeof(sndBuf);
+	RsslUInt32 i;
+
+	if (ring == 0)
+	{
+		if ((ring = ipcUringNewRing()) == 0)
+			return 0;
+		ring->privateRing = RSSL_TRUE;
+	}
+
+	if ((sess = (ripcUringSession*)_rsslMalloc(sizeof(ripcUringSession))) == 0)
+	{
+		if (ring->privateRing)
+			_ripcUringFreeRing(ring);
+		return 0;
+	}
+
+	memset(sess, 0, sizeof(ripcUringSession));
+	sess->ring = ring;
+	sess->fd = fd;
+	sess->slot = -1;
+
+	/* let the buffer hold about what the socket itself would */
+	if (getsockopt(fd, SOL_SOCKET, SO_SNDBUF, (char*)&sndBuf, &len) < 0 || sndBuf < RIPC_URING_MIN_SEND_BUF)
+		sndBuf = RIPC_URING_MIN_SEND_BUF;
+	else if (sndBuf > RIPC_URING_MAX_SEND_BUF)
+		sndBuf = RIPC_URING_MAX_SEND_BUF;
+	sess->size = (RsslUInt32)sndBuf;
+
+	if ((sess->sendBuf = ipcAllocGblMsg(sess->size)) == 0)
+	{
+		_rsslFree(sess);
+		if (ring->privateRing)
+			_ripcUringFreeRing(ring);
+		return 0;
+	}
+
+	RSSL_MUTEX_LOCK(&ring->mutex);
+
+	/* the kernel's ring waits for a channel that uses it */
+	if (ring->ringFd < 0 && (ring->setupFailed || !_ripcUringSetup(ring)))
+	{
+		_ripcUringTeardown(ring);
+		ring->setupFailed = RSSL_TRUE;
+		RSSL_MUTEX_UNLOCK(&ring->mutex);
+		rtr_smplcFreeMsg(sess->sendBuf);
+		_rsslFree(sess);
+		if (ring->privateRing)
+			_ripcUringFreeRing(ring);
+		return 0;
+	}
+
+	ring->sessionCount++;
+
+	/* Register the send buffer so the kernel need not map it for each send. This can
+	 * fail when the memory lock limit is reached; the channel then sends without it. */
+	for (i = 0; i < ring->slotCount; i++)
+	{
+		if (ring->slots[i] == 0)
+		{
+			iov.iov_base = sess->sendBuf->buffer;
+			iov.iov_len = sess->size;
+			memset(&update, 0, sizeof(update));
+			update.offset = i;
+			update.data = (__u64)(uintptr_t)&iov;
+			update.nr = 1;
+			if (syscall(__NR_io_uring_register, ring->ringFd, IORING_REGISTER_BUFFERS_UPDATE, &update, sizeof(update)) == 1)
+			{
+				ring->slots[i] = sess;
+				sess->slot = (RsslInt32)i;
+			}
+			break;
+		}
+	}
+
+	RSSL_MUTEX_UNLOCK(&ring->mutex);
+
+	return sess;
+}
+
+int ipcUringRead(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error)
+{
+	return ipcRead((void*)(intptr_t)((ripcUringSession*)transport)->fd, buf, max_len, flags, error);
+}
+
+int ipcUringWriteV(void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	ripcUringSession *sess = (ripcUringSession*)transport;
+	RsslIoUring *ring = sess->ring;
+	RsslUInt32 tail;
+	RsslUInt32 len;
+	RsslUInt32 space;
+	char *data;
+	int totOut = 0;
+	int i;
+
+	RSSL_MUTEX_LOCK(&ring->mutex);
+
+	_ripcUringReap(ring);
+
+	if (sess->status < 0)
+	{
+		RSSL_MUTEX_UNLOCK(&ring->mutex);
+		error->text[0] = '\0';
+		return -1;
+	}
+
+	/* A send the socket had no room for completes from the submitting thread's task work,
+	 * which only runs when that thread enters the kernel, so give it the chance. */
+	if (sess->inFlight && _ripcUringEnter(ring, 0, 0, IORING_ENTER_GETEVENTS, 0, 0) >= 0)
+		_ripcUringReap(ring);
+
+	/* Nothing more is taken while a send is outstanding, so the rest stays with the
+	 * channel and the caller waits for the socket to be writable, as it would on a
+	 * full socket. */
+	if (sess->inFlight)
+	{
+		RSSL_MUTEX_UNLOCK(&ring->mutex);
+		return 0;
+	}
+
+	for (i = 0; i < iovcnt; i++)
+	{
+		tail = sess->head + sess->count;
+		if ((space = sess->size - tail) == 0)
+			break;
+
+		data = RIPC_IOV_GETBUF(&iov[i]);
+		if ((len = (RsslUInt32)RIPC_IOV_GETLEN(&iov[i])) > space)
+			len = space;
+
+		memcpy(sess->sendBuf->buffer + tail, data, len);
+		sess->count += len;
+		totOut += (int)len;
+	}
+
+	_ripcUringMarkReady(sess);
+
+	if (ring->privateRing && _ripcUringSubmit(ring) < 0)
+		sess->status = -1;
+
+	RSSL_MUTEX_UNLOCK(&ring->mutex);
+
+	if (sess->status < 0 && totOut == 0)
+	{
+		error->text[0] = '\0';
+		return -1;
+	}
+
+	return totOut;
+}
+
+int ipcUringWrite(void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error)
+{
+	ripcIovType iov;
+
+	RIPC_IOV_SETBUF(&iov, buf);
+	RIPC_IOV_SETLEN(&iov, outLen);
+
+	return ipcUringWriteV(transport, &iov, 1, outLen, flags, error);
+}
+
+int ipcUringShutdown(void *transport)
+{
+	ripcUringSession *sess = (ripcUringSession*)transport;
+	RsslIoUring *ring;
+	struct io_uring_sqe *sqe;
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	ssize_t numBytes;
+	int waits;
+
+	if (sess == 0)
+		return 1;
+
+	ring = sess->ring;
+
+	RSSL_MUTEX_LOCK(&ring->mutex);
+
+	_ripcUringReap(ring);
+	if (sess->onReadyList)
+	{
+		_ripcUringUnlink(&ring->readyList, sess);
+		sess->onReadyList = RSSL_FALSE;
+	}
+	sess->closing = RSSL_TRUE;
+
+	/* Stop a send still waiting for room, and wait for the kernel to let go of it */
+	if (sess->inFlight && (sqe = _ripcUringGetSqe(ring)) != 0)
+	{
+		sqe->opcode = IORING_OP_ASYNC_CANCEL;
+		sqe->addr = (__u64)(uintptr_t)sess;
+		sqe->user_data = 0;
+		_ripcUringQueueSqe(ring);
+	}
+
+	memset(&ts, 0, sizeof(ts));
+	ts.tv_nsec = RIPC_URING_CLOSE_WAIT_MS * 1000000;
+	memset(&arg, 0, sizeof(arg));
+	arg.ts = (__u64)(uintptr_t)&ts;
+
+	for (waits = 0; sess->inFlight && waits < RIPC_URING_CLOSE_WAITS; waits++)
+	{
+		if (_ripcUringEnter(ring, ring->sqPending, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg)) >= 0)
+			ring->sqPending = 0;
+		_ripcUringReap(ring);
+	}
+
+	/* Hand what is still queued to the socket, as a plain socket would already have it */
+	while (!sess->inFlight && sess->count && sess->status == 0)
+	{
+		if ((numBytes = send(sess->fd, sess->sendBuf->buffer + sess->head, sess->count, MSG_NOSIGNAL | MSG_DONTWAIT)) <= 0)
+			break;
+		_ripcUringConsume(sess, (RsslUInt32)numBytes);
+	}
+
+	if (sess->fd != RIPC_INVALID_SOCKET)
+		sock_close(sess->fd);
+
+	/* If the kernel never confirmed the cancel it may still read the send buffer, so
+	 * the session is left for the ring to free when the send completes. */
+	if (sess->inFlight && !ring->privateRing)
+	{
+		sess->zombie = RSSL_TRUE;
+		sess->nextReady = ring->zombieList;
+		ring->zombieList = sess;
+		ring->zombieCount++;
+	}
+	else
+		_ripcUringFreeSession(sess);
+
+	RSSL_MUTEX_UNLOCK(&ring->mutex);
+
+	_ripcUringCheckFreeRing(ring);
+
+	return 1;
+}
+
+void ipcSetUringFuncs(ripcTransportFuncs *funcs)
+{
+	funcs->shutdownTransport = ipcUringShutdown;
+	funcs->readTransport = ipcUringRead;
+	funcs->writeTransport = ipcUringWrite;
+	funcs->writeVTransport = ipcUringWriteV;
+}
+
+#endif
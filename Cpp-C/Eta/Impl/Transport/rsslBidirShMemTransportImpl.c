@@ -0,0 +1,1347 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslBidirShMemTransport.h"
+#include "rtr/rsslBidirShMemTransportImpl.h"
+#include "rtr/rsslAlloc.h"
+#include "rtr/rsslErrors.h"
+
+#if defined(LINUX)
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stddef.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+#if defined(LINUX)
+
+/***************************
+ * START INLINE HELPER FUNCTIONS
+ ***************************/
+
+/* fills in the abstract Unix domain socket address that the server for shMemKey listens on */
+static socklen_t _rsslBidirShMemAddr(struct sockaddr_un *addr, const char *shMemKey)
+{
+	int nBytes;
+
+	memset(addr, 0, sizeof(struct sockaddr_un));
+	addr->sun_family = AF_UNIX;
+	/* a leading zero byte keeps the name out of the file system */
+	nBytes = snprintf(addr->sun_path + 1, sizeof(addr->sun_path) - 1, "rsslShm.%s", shMemKey);
+	if (nBytes < 0 || nBytes >= (int)sizeof(addr->sun_path) - 1)
+		return 0;
+	return (socklen_t)(offsetof(struct sockaddr_un, sun_path) + 1 + nBytes);
+}
+
+static int _rsslBidirShMemSetNonBlocking(RsslSocket fd)
+{
+	int flags = fcntl(fd, F_GETFL, 0);
+
+	return (flags < 0) ? -1 : fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+static rsslBidirShMemChannel *_rsslBidirShMemNewChannel()
+{
+	rsslBidirShMemChannel *shm = (rsslBidirShMemChannel*)_rsslMalloc(sizeof(rsslBidirShMemChannel));
+
+	if (shm)
+	{
+		memset(shm, 0, sizeof(rsslBidirShMemChannel));
+		shm->fd = RSSL_INVALID_SOCKET;
+	}
+	return shm;
+}
+
+static void _rsslBidirShMemFreeBlocks(rsslBidirShmBlock *block)
+{
+	rsslBidirShmBlock *next;
+
+	for (; block; block = next)
+	{
+		next = block->next;
+		_rsslFree(block);
+	}
+}
+
+static void _rsslBidirShMemFreeChannel(rsslBidirShMemChannel *shm)
+{
+	_rsslBidirShMemFreeBlocks(shm->freeBlocks);
+	_rsslBidirShMemFreeBlocks(shm->pendingHead);
+	if (shm->fragBuf)
+		_rsslFree(shm->fragBuf);
+
+	if (shm->shMemSeg.base)
+	{
+		if (shm->isServer)
+			rtrShmSegDestroy(&shm->shMemSeg);
+		else
+			rtrShmSegDetach(&shm->shMemSeg);
+	}
+
+	if (shm->fd != RSSL_INVALID_SOCKET)
+		close(shm->fd);
+
+	_rsslFree(shm);
+}
+
+/* takes an output buffer from the channel's pool, 0 when all of them are in use */
+RTR_C_ALWAYS_INLINE rsslBidirShmBlock *_rsslBidirShMemGetBlock(rsslBidirShMemChannel *shm, RsslUInt32 size)
+{
+	rsslBidirShmBlock *block;
+
+	if (rtrUnlikely(size > shm->maxMsgSize))
+	{
+		/* too big for the pool; freed again once it is in the ring */
+		if (shm->blocksInUse >= shm->maxBlocks ||
+			(block = (rsslBidirShmBlock*)_rsslMalloc(sizeof(rsslBidirShmBlock) + size)) == 0)
+			return 0;
+		block->capacity = size;
+	}
+	else if ((block = shm->freeBlocks) != 0)
+		shm->freeBlocks = block->next;
+	else if (shm->numBlocks < shm->maxBlocks &&
+		(block = (rsslBidirShmBlock*)_rsslMalloc(sizeof(rsslBidirShmBlock) + shm->maxMsgSize)) != 0)
+	{
+		block->capacity = shm->maxMsgSize;
+		++shm->numBlocks;
+	}
+	else
+		return 0;
+
+	if (++shm->blocksInUse > shm->peakBlocksInUse)
+		shm->peakBlocksInUse = shm->blocksInUse;
+	return block;
+}
+
+RTR_C_ALWAYS_INLINE void _rsslBidirShMemPutBlock(rsslBidirShMemChannel *shm, rsslBidirShmBlock *block)
+{
+	if (rtrUnlikely(block->capacity > shm->maxMsgSize))
+		_rsslFree(block);
+	else
+	{
+		block->next = shm->freeBlocks;
+		shm->freeBlocks = block;
+	}
+	--shm->blocksInUse;
+}
+
+/* copies a message into the outbound ring. Returns RSSL_FALSE when the reader has not left enough room. */
+RTR_C_ALWAYS_INLINE RsslBool _rsslBidirShMemPutRecord(rsslBidirShMemChannel *shm, const char *data, RsslUInt32 length, RsslUInt32 flags)
+{
+	rsslBidirShmMsgHdr *msgHdr;
+	RsslUInt32 recordLen = (RsslUInt32)sizeof(rsslBidirShmMsgHdr) + length;
+
+	if ((msgHdr = (rsslBidirShmMsgHdr*)RTRShmByteRingTryGetWriteBuf(shm->outRing, &shm->shMemSeg, recordLen)) == 0)
+		return RSSL_FALSE;
+
+	msgHdr->length = length;
+	msgHdr->flags = flags;
+	if (length)
+		memcpy(msgHdr + 1, data, length);
+	RTRShmByteRingWritten(shm->outRing, &shm->shMemSeg, recordLen);
+	return RSSL_TRUE;
+}
+
+/* copies as much of a message into the outbound ring as fits. Returns RSSL_TRUE once all of it is there. */
+RTR_C_ALWAYS_INLINE RsslBool _rsslBidirShMemPutMessage(rsslBidirShMemChannel *shm, rsslBidirShmBlock *block)
+{
+	RsslUInt32 length, flags;
+
+	do
+	{
+		length = block->length - block->sent;
+		flags = block->flags;
+		if (rtrUnlikely(length > shm->maxMsgSize))
+		{
+			length = shm->maxMsgSize;
+			flags |= RSSL_BIDIR_SHM_FRAGMENT;
+		}
+
+		if (!_rsslBidirShMemPutRecord(shm, block->data + block->sent, length, flags))
+			return RSSL_FALSE;
+		block->sent += length;
+		shm->pendingBytes -= length;
+	} while (block->sent < block->length);
+
+	return RSSL_TRUE;
+}
+
+/* moves queued messages into the outbound ring. Returns the number of bytes still queued. */
+RTR_C_ALWAYS_INLINE RsslUInt32 _rsslBidirShMemDrainPending(rsslBidirShMemChannel *shm)
+{
+	rsslBidirShmBlock *block;
+
+	while ((block = shm->pendingHead) != 0 && _rsslBidirShMemPutMessage(shm, block))
+	{
+		if ((shm->pendingHead = block->next) == 0)
+			shm->pendingTail = 0;
+		_rsslBidirShMemPutBlock(shm, block);
+	}
+	return shm->pendingBytes;
+}
+
+/* sends a byte to the other side if it is waiting for the ring to fill */
+RTR_C_ALWAYS_INLINE RsslRet _rsslBidirShMemNotify(rsslBidirShMemChannel *shm)
+{
+	/* the store to writePos must be visible before waiters is checked; rsslBidirShMemRead does the reverse */
+	__sync_synchronize();
+	if (rtrUnlikely(shm->outRing->waiters != 0))
+	{
+		shm->outRing->waiters = 0;
+		if (send(shm->fd, "1", 1, MSG_DONTWAIT | MSG_NOSIGNAL) != 1 && errno != EAGAIN && errno != EWOULDBLOCK)
+			return RSSL_RET_FAILURE;
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+/* finds the two rings and the control block in an attached or created segment */
+static void _rsslBidirShMemSetRings(rsslBidirShMemChannel *shm)
+{
+	rtrShmByteRing *toClient = (rtrShmByteRing*)RTR_SHM_MAKE_PTR(shm->shMemSeg.base, shm->ctrl->toClient);
+	rtrShmByteRing *toServer = (rtrShmByteRing*)RTR_SHM_MAKE_PTR(shm->shMemSeg.base, shm->ctrl->toServer);
+
+	shm->outRing = shm->isServer ? toClient : toServer;
+	shm->inRing = shm->isServer ? toServer : toClient;
+	shm->peerClosedFlag = shm->isServer ? RSSL_BIDIR_SHM_CLIENT_CLOSED : RSSL_BIDIR_SHM_SERVER_CLOSED;
+	shm->maxMsgSize = shm->ctrl->maxMsgSize;
+	shm->inReader.readPos = 0;
+	shm->inReader.readOffset = 0;
+}
+
+static RsslRet _rsslBidirShMemChannelDown(rsslChannelImpl *rsslChnlImpl, const char *reason, RsslError *error)
+{
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+	_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, errno);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> %s (errno = %d)\n", __FILE__, __LINE__, reason, errno);
+	return RSSL_RET_FAILURE;
+}
+
+/* creates the connection's segment and sends its key to the client */
+static RsslRet _rsslBidirShMemCreateSegment(rsslBidirShMemServer *shmServer, rsslBidirShMemChannel *shm, RsslError *error)
+{
+	RsslUInt32 maxRecordSize = (RsslUInt32)sizeof(rsslBidirShmMsgHdr) + shmServer->maxMsgSize;
+	size_t ringHdrSize = RTR_SHM_ALIGNBYTES(sizeof(rtrShmByteRing) + RTR_SHM_CACHE_LINE_SIZE);
+	size_t segSize;
+	rtrShmByteRing *toClient, *toServer;
+	int nBytes;
+
+	nBytes = snprintf(shm->handshake.segKey, sizeof(shm->handshake.segKey), "%s.%d.%u",
+		shmServer->shMemKey, (int)getpid(), ++shmServer->connectionCount);
+	if (nBytes < 0 || nBytes >= (int)sizeof(shm->handshake.segKey))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() shared memory key for %s is too long\n", __FILE__, __LINE__, shmServer->shMemKey);
+		return RSSL_RET_FAILURE;
+	}
+
+	segSize = RTR_SHM_ALIGNBYTES(sizeof(rsslBidirShmCtrl)) + 2 * ringHdrSize
+		+ (size_t)RTRShmByteRingSize(shmServer->numOutputBuffers, maxRecordSize)
+		+ (size_t)RTRShmByteRingSize(shmServer->numInputBuffers, maxRecordSize);
+
+	if (rtrShmSegCreate(&shm->shMemSeg, shm->handshake.segKey, segSize, error->text) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		return RSSL_RET_FAILURE;		/* rtrShmSegCreate() set the error text */
+	}
+
+	shm->ctrl = (rsslBidirShmCtrl*)rtrShmBytesReserve(&shm->shMemSeg, sizeof(rsslBidirShmCtrl));
+	toClient = RTRShmByteRingAlign(rtrShmBytesReserve(&shm->shMemSeg, ringHdrSize));
+	toServer = RTRShmByteRingAlign(rtrShmBytesReserve(&shm->shMemSeg, ringHdrSize));
+	RTRShmByteRingServerInit(toClient, shmServer->numOutputBuffers, maxRecordSize, &shm->shMemSeg);
+	RTRShmByteRingServerInit(toServer, shmServer->numInputBuffers, maxRecordSize, &shm->shMemSeg);
+
+	/* neither side has read yet, so the first message on each ring must wake its reader */
+	toClient->waiters = 1;
+	toServer->waiters = 1;
+
+	shm->ctrl->version = RSSL_BIDIR_SHM_VERSION;
+	shm->ctrl->maxMsgSize = shmServer->maxMsgSize;
+	shm->ctrl->pingTimeout = shmServer->pingTimeout;
+	shm->ctrl->majorVersion = shmServer->majorVersion;
+	shm->ctrl->minorVersion = shmServer->minorVersion;
+	shm->ctrl->protocolType = shmServer->protocolType;
+	shm->ctrl->toClient = RTR_SHM_MAKE_OFFSET(shm->shMemSeg.base, toClient);
+	shm->ctrl->toServer = RTR_SHM_MAKE_OFFSET(shm->shMemSeg.base, toServer);
+	shm->ctrl->magic = RSSL_BIDIR_SHM_MAGIC;
+	_rsslBidirShMemSetRings(shm);
+
+	shm->handshake.magic = RSSL_BIDIR_SHM_MAGIC;
+	shm->handshake.version = RSSL_BIDIR_SHM_VERSION;
+
+	/* the socket was just accepted, so its send buffer has room for the whole handshake */
+	if (send(shm->fd, &shm->handshake, sizeof(rsslBidirShmHandshake), MSG_NOSIGNAL) != sizeof(rsslBidirShmHandshake))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() could not send the shared memory key (errno = %d)\n", __FILE__, __LINE__, errno);
+		return RSSL_RET_FAILURE;
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+/* client side: reads the segment key and attaches to the segment */
+static RsslRet _rsslBidirShMemAttachSegment(rsslChannelImpl *rsslChnlImpl, rsslBidirShMemChannel *shm, RsslError *error)
+{
+	ssize_t ret;
+
+	while (shm->handshakeLen < sizeof(rsslBidirShmHandshake))
+	{
+		ret = recv(shm->fd, (char*)&shm->handshake + shm->handshakeLen, sizeof(rsslBidirShmHandshake) - shm->handshakeLen, 0);
+		if (ret == 0)
+			return _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslInitChannel() shared memory server closed the connection", error);
+		if (ret < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				return RSSL_RET_CHAN_INIT_IN_PROGRESS;
+			return _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslInitChannel() could not read the shared memory key", error);
+		}
+		shm->handshakeLen += (RsslUInt32)ret;
+	}
+
+	if (shm->handshake.magic != RSSL_BIDIR_SHM_MAGIC || shm->handshake.version != RSSL_BIDIR_SHM_VERSION)
+	{
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() unsupported shared memory server version %u\n", __FILE__, __LINE__, shm->handshake.version);
+		return RSSL_RET_FAILURE;
+	}
+	shm->handshake.segKey[sizeof(shm->handshake.segKey) - 1] = '\0';
+
+	if (rtrShmSegAttach(&shm->shMemSeg, shm->handshake.segKey, error->text) < 0)
+	{
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, errno);
+		return RSSL_RET_FAILURE;		/* rtrShmSegAttach() set the error text */
+	}
+
+	shm->ctrl = (rsslBidirShmCtrl*)(shm->shMemSeg.base + shm->shMemSeg.hdr->headerLen);
+	if (shm->ctrl->magic != RSSL_BIDIR_SHM_MAGIC)
+	{
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() shared memory segment %s is not a bidirectional shared memory connection\n", __FILE__, __LINE__, shm->handshake.segKey);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* the server dictates everything but the protocol, which has to match */
+	if (shm->ctrl->protocolType != rsslChnlImpl->Channel.protocolType)
+	{
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_CHAN_INIT_REFUSED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslInitChannel() protocol type %u does not match the server's protocol type %u\n", __FILE__, __LINE__, rsslChnlImpl->Channel.protocolType, shm->ctrl->protocolType);
+		return RSSL_RET_CHAN_INIT_REFUSED;
+	}
+
+	_rsslBidirShMemSetRings(shm);
+	rsslChnlImpl->maxMsgSize = shm->maxMsgSize;
+	rsslChnlImpl->Channel.pingTimeout = shm->ctrl->pingTimeout;
+	rsslChnlImpl->Channel.majorVersion = shm->ctrl->majorVersion;
+	rsslChnlImpl->Channel.minorVersion = shm->ctrl->minorVersion;
+
+	if (rsslChnlImpl->componentVer.componentVersion.length > 0)
+	{
+		RsslUInt32 len = rsslChnlImpl->componentVer.componentVersion.length;
+
+		if (len > RSSL_SHM_COMPONENT_VERSION_SIZE)
+			len = RSSL_SHM_COMPONENT_VERSION_SIZE;
+		memcpy(shm->ctrl->clientComponentVersion, rsslChnlImpl->componentVer.componentVersion.data, len);
+		shm->ctrl->clientComponentVersionLen = (RsslUInt8)len;
+	}
+
+	/* tell the server we are attached */
+	if (send(shm->fd, "1", 1, MSG_NOSIGNAL) != 1)
+		return _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslInitChannel() could not acknowledge the shared memory key", error);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* server side: waits for the client to attach */
+static RsslRet _rsslBidirShMemWaitForAck(rsslChannelImpl *rsslChnlImpl, rsslBidirShMemChannel *shm, RsslError *error)
+{
+	char ack;
+	ssize_t ret;
+
+	while ((ret = recv(shm->fd, &ack, 1, 0)) < 0 && errno == EINTR)
+		;
+	if (ret == 0)
+		return _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslInitChannel() shared memory client closed the connection", error);
+	if (ret < 0)
+	{
+		if (errno == EAGAIN || errno == EWOULDBLOCK)
+			return RSSL_RET_CHAN_INIT_IN_PROGRESS;
+		return _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslInitChannel() could not read the client acknowledgement", error);
+	}
+
+	/* both sides have the segment mapped, so nothing needs the name any more */
+	if (shm->shMemSeg.hdr->name)
+	{
+		shm_unlink(shm->shMemSeg.hdr->name);
+		free(shm->shMemSeg.hdr->name);
+		shm->shMemSeg.hdr->name = 0;
+	}
+
+	if (rsslChnlImpl->componentVer.componentVersion.length > 0)
+	{
+		RsslUInt32 len = rsslChnlImpl->componentVer.componentVersion.length;
+
+		if (len > RSSL_SHM_COMPONENT_VERSION_SIZE)
+			len = RSSL_SHM_COMPONENT_VERSION_SIZE;
+		memcpy(shm->ctrl->serverComponentVersion, rsslChnlImpl->componentVer.componentVersion.data, len);
+		shm->ctrl->serverComponentVersionLen = (RsslUInt8)len;
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+#endif
+
+/***************************
+ * START NON-PUBLIC ABSTRACTED FUNCTIONS
+ ***************************/
+
+/* rssl Bidirectional ShMem Bind call */
+RsslRet rsslBidirShMemBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, RsslError *error)
+{
+#if defined(LINUX)
+	rsslBidirShMemServer *shmServer;
+	struct sockaddr_un addr;
+	socklen_t addrLen;
+	RsslInt32 nBytes;
+
+	if ((shmServer = (rsslBidirShMemServer*)_rsslMalloc(sizeof(rsslBidirShMemServer))) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemBind() could not allocate memory for the server\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+	memset(shmServer, 0, sizeof(rsslBidirShMemServer));
+
+	if (opts->interfaceName)
+		nBytes = snprintf(shmServer->shMemKey, sizeof(shmServer->shMemKey), "%s%s", opts->interfaceName, opts->serviceName);
+	else
+		nBytes = snprintf(shmServer->shMemKey, sizeof(shmServer->shMemKey), "%s", opts->serviceName);
+
+	if ((nBytes >= (RsslInt32)sizeof(shmServer->shMemKey)) || nBytes < 0 || (addrLen = _rsslBidirShMemAddr(&addr, shmServer->shMemKey)) == 0)
+	{
+		_rsslFree(shmServer);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemBind() bad interface and/or service name\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	shmServer->maxMsgSize = opts->maxFragmentSize;
+	shmServer->numOutputBuffers = opts->guaranteedOutputBuffers;
+	shmServer->maxOutputBuffers = (opts->maxOutputBuffers < opts->guaranteedOutputBuffers) ? opts->guaranteedOutputBuffers : opts->maxOutputBuffers;
+	shmServer->numInputBuffers = opts->numInputBuffers;
+	shmServer->pingTimeout = opts->pingTimeout;
+	shmServer->majorVersion = opts->majorVersion;
+	shmServer->minorVersion = opts->minorVersion;
+	shmServer->protocolType = opts->protocolType;
+	shmServer->serverToClientPings = opts->serverToClientPings;
+	shmServer->clientToServerPings = opts->clientToServerPings;
+	shmServer->channelsBlocking = opts->channelsBlocking;
+
+	if ((shmServer->fd = socket(AF_UNIX, SOCK_STREAM, 0)) == RSSL_INVALID_SOCKET)
+	{
+		_rsslFree(shmServer);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemBind() socket() failed (errno = %d)\n", __FILE__, __LINE__, errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (bind(shmServer->fd, (struct sockaddr*)&addr, addrLen) < 0 || listen(shmServer->fd, 64) < 0 ||
+		(!opts->serverBlocking && _rsslBidirShMemSetNonBlocking(shmServer->fd) < 0))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemBind() could not listen for shared memory connections to %s (errno = %d)\n", __FILE__, __LINE__, shmServer->shMemKey, errno);
+		close(shmServer->fd);
+		_rsslFree(shmServer);
+		return RSSL_RET_FAILURE;
+	}
+
+	rsslSrvrImpl->connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+	rsslSrvrImpl->transportInfo = shmServer;
+	rsslSrvrImpl->isBlocking = opts->serverBlocking;
+	rsslSrvrImpl->Server.socketId = shmServer->fd;
+	rsslSrvrImpl->Server.userSpecPtr = opts->userSpecPtr;
+	rsslSrvrImpl->Server.state = RSSL_CH_STATE_ACTIVE;
+	rsslSrvrImpl->Server.portNumber = 0;
+	return RSSL_RET_SUCCESS;
+#else
+	_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBind() bidirectional shared memory connections are supported on Linux only\n", __FILE__, __LINE__);
+	return RSSL_RET_FAILURE;
+#endif
+}
+
+/* rssl Bidirectional ShMem Connect */
+RsslRet rsslBidirShMemConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opts, RsslError *error)
+{
+#if defined(LINUX)
+	rsslBidirShMemChannel *shm;
+	char shMemKey[SHMKEY_SIZE];
+	struct sockaddr_un addr;
+	socklen_t addrLen;
+	RsslRet ret;
+	RsslInt32 nBytes;
+
+	/* For all connection types we minimally need this value populated (unified.serviceName == segmented.recvPort) */
+	if (RSSL_NULL_PTR(opts->connectionInfo.unified.serviceName, "rsslConnect", "opts->connectionInfo.unified.serviceName", error))
+		return RSSL_RET_FAILURE;
+
+	if (opts->connectionInfo.unified.interfaceName)
+		nBytes = snprintf(shMemKey, sizeof(shMemKey), "%s%s",
+							opts->connectionInfo.unified.interfaceName, opts->connectionInfo.unified.serviceName);
+	else
+		nBytes = snprintf(shMemKey, sizeof(shMemKey), "%s", opts->connectionInfo.unified.serviceName);
+
+	if ((nBytes >= (RsslInt32)sizeof(shMemKey)) || nBytes < 0 || (addrLen = _rsslBidirShMemAddr(&addr, shMemKey)) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemConnect() bad interface and/or service name\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((shm = _rsslBidirShMemNewChannel()) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemConnect() could not allocate memory for new channel\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* connecting to a listening Unix domain socket completes immediately, so this never has to wait */
+	if ((shm->fd = socket(AF_UNIX, SOCK_STREAM, 0)) == RSSL_INVALID_SOCKET ||
+		connect(shm->fd, (struct sockaddr*)&addr, addrLen) < 0 ||
+		(!opts->blocking && _rsslBidirShMemSetNonBlocking(shm->fd) < 0))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemConnect() could not connect to shared memory server %s (errno = %d)\n", __FILE__, __LINE__, shMemKey, errno);
+		_rsslBidirShMemFreeChannel(shm);
+		return RSSL_RET_FAILURE;
+	}
+
+	shm->isServer = RSSL_FALSE;
+	shm->blocking = opts->blocking;
+	shm->initState = RSSL_BIDIR_SHM_WAIT_HANDSHAKE;
+	shm->maxBlocks = opts->guaranteedOutputBuffers ? opts->guaranteedOutputBuffers : 1;
+
+	rsslChnlImpl->transportInfo = shm;
+	rsslChnlImpl->maxGuarMsgs = shm->maxBlocks;
+	rsslChnlImpl->isBlocking = opts->blocking;
+	rsslChnlImpl->rsslFlags = CLIENT_TO_SERVER | SERVER_TO_CLIENT;
+
+	rsslChnlImpl->Channel.protocolType = opts->protocolType;
+	rsslChnlImpl->Channel.majorVersion = opts->majorVersion;
+	rsslChnlImpl->Channel.minorVersion = opts->minorVersion;
+	rsslChnlImpl->Channel.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+	rsslChnlImpl->Channel.socketId = shm->fd;
+	rsslChnlImpl->Channel.userSpecPtr = opts->userSpecPtr;
+	rsslChnlImpl->Channel.state	= RSSL_CH_STATE_INITIALIZING;
+
+	/* if its a nonblocking connect, we are done here */
+	if (opts->blocking == 0)
+		return RSSL_RET_SUCCESS;
+
+	while (rsslChnlImpl->Channel.state == RSSL_CH_STATE_INITIALIZING)
+	{
+		/* for a blocking connection, call rsslInitChannel (which will set state to active) for the user */
+		if ((ret = rsslBidirShMemInitChannel(rsslChnlImpl, NULL, error)) < RSSL_RET_SUCCESS)
+		{
+			_rsslBidirShMemFreeChannel(shm);
+			rsslChnlImpl->transportInfo = 0;
+			return RSSL_RET_FAILURE;	/* error will have been set by rsslBidirShMemInitChannel() */
+		}
+	}
+	return RSSL_RET_SUCCESS;
+#else
+	_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() bidirectional shared memory connections are supported on Linux only\n", __FILE__, __LINE__);
+	return RSSL_RET_FAILURE;
+#endif
+}
+
+#if defined(LINUX)
+
+/* rssl Bidirectional ShMem accept */
+rsslChannelImpl* rsslBidirShMemAccept(rsslServerImpl *rsslSrvrImpl, RsslAcceptOptions *opts, RsslError *error)
+{
+	rsslChannelImpl	*rsslChnlImpl;
+	rsslBidirShMemServer *shmServer = rsslSrvrImpl->transportInfo;
+	rsslBidirShMemChannel *shm;
+
+	if ((rsslChnlImpl = _rsslNewChannel()) == 0)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() could not allocate memory for new channel\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if ((shm = _rsslBidirShMemNewChannel()) == 0)
+	{
+		_rsslReleaseChannel(rsslChnlImpl);
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() could not allocate memory for new channel\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	shm->isServer = RSSL_TRUE;
+	shm->blocking = shmServer->channelsBlocking;
+	shm->initState = RSSL_BIDIR_SHM_WAIT_ACK;
+	shm->maxBlocks = shmServer->maxOutputBuffers ? shmServer->maxOutputBuffers : 1;
+
+	if ((shm->fd = accept(shmServer->fd, NULL, NULL)) == RSSL_INVALID_SOCKET ||
+		(!shm->blocking && _rsslBidirShMemSetNonBlocking(shm->fd) < 0))
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() accept() failed (errno = %d)\n", __FILE__, __LINE__, errno);
+		_rsslBidirShMemFreeChannel(shm);
+		_rsslReleaseChannel(rsslChnlImpl);
+		return NULL;
+	}
+
+	if (_rsslBidirShMemCreateSegment(shmServer, shm, error) < RSSL_RET_SUCCESS)
+	{
+		_rsslBidirShMemFreeChannel(shm);
+		_rsslReleaseChannel(rsslChnlImpl);
+		return NULL;
+	}
+
+	rsslChnlImpl->transportInfo = shm;
+	rsslChnlImpl->Channel.connectionType = rsslSrvrImpl->connectionType;
+	rsslChnlImpl->maxMsgSize = shm->maxMsgSize;
+	rsslChnlImpl->maxGuarMsgs = shmServer->numOutputBuffers;
+	rsslChnlImpl->isBlocking = shm->blocking;
+	rsslChnlImpl->Channel.pingTimeout = shmServer->pingTimeout;
+	rsslChnlImpl->Channel.majorVersion = shmServer->majorVersion;
+	rsslChnlImpl->Channel.minorVersion = shmServer->minorVersion;
+	rsslChnlImpl->Channel.protocolType = shmServer->protocolType;
+	rsslChnlImpl->rsslFlags = CLIENT_TO_SERVER | SERVER_TO_CLIENT;
+	rsslChnlImpl->Channel.socketId = shm->fd;
+
+	rsslChnlImpl->Channel.clientHostname = (char*)_rsslMalloc(32);
+	strncpy(rsslChnlImpl->Channel.clientHostname, "localhost", 32);
+	rsslChnlImpl->Channel.clientIP = (char*)_rsslMalloc(32);
+	strncpy(rsslChnlImpl->Channel.clientIP, "127.0.0.1", 32);
+	rsslChnlImpl->Channel.port = 0;
+
+	if (!opts->userSpecPtr)
+	{
+		rsslChnlImpl->Channel.userSpecPtr = rsslSrvrImpl->Server.userSpecPtr;
+	}
+	else
+	{
+		rsslChnlImpl->Channel.userSpecPtr = opts->userSpecPtr;
+	}
+
+	rsslChnlImpl->channelFuncs = rsslSrvrImpl->channelFuncs;
+	rsslChnlImpl->Channel.state	= RSSL_CH_STATE_INITIALIZING;
+
+	/* if its a nonblocking connect, then set to initializing and exit */
+	/* the user will need to call rsslInitChannel next */
+	if (!shm->blocking)
+		return rsslChnlImpl;
+
+	/* for a blocking connection, call rsslInitChannel for the user */
+	if (rsslBidirShMemInitChannel(rsslChnlImpl, NULL, error) < RSSL_RET_SUCCESS)
+	{
+		rsslBidirShMemCloseChannel(rsslChnlImpl, error);
+		_rsslReleaseChannel(rsslChnlImpl);
+		return NULL;
+	}
+
+	return rsslChnlImpl;
+}
+
+/* rssl Bidirectional ShMem ReConnect (for tunneling, basically a no-op) */
+RsslRet rsslBidirShMemReconnect(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl Bidirectional ShMem InitChannel */
+RsslRet rsslBidirShMemInitChannel(rsslChannelImpl *rsslChnlImpl, RsslInProgInfo *inProg, RsslError *error )
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+	RsslRet ret;
+
+	if (rsslChnlImpl->Channel.state == RSSL_CH_STATE_ACTIVE)
+		return RSSL_RET_SUCCESS;
+
+	if (rsslChnlImpl->Channel.state != RSSL_CH_STATE_INITIALIZING || !shm)
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemInitChannel failed. Unexpected Channel state(%d)\n", __FILE__, __LINE__, rsslChnlImpl->Channel.state);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (shm->isServer)
+		ret = _rsslBidirShMemWaitForAck(rsslChnlImpl, shm, error);
+	else
+		ret = _rsslBidirShMemAttachSegment(rsslChnlImpl, shm, error);
+
+	if (ret == RSSL_RET_CHAN_INIT_IN_PROGRESS)
+	{
+		if (inProg)
+		{
+			inProg->flags = RSSL_IP_NONE;
+			inProg->newSocket = 0;
+			inProg->oldSocket = 0;
+		}
+		return RSSL_RET_CHAN_INIT_IN_PROGRESS;
+	}
+	if (ret < RSSL_RET_SUCCESS)
+		return ret;
+
+	shm->initState = RSSL_BIDIR_SHM_ACTIVE;
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_ACTIVE;
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl Bidirectional ShMem CloseChannel */
+RsslRet rsslBidirShMemCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error)
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+
+	if (!shm)
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemCloseChannel failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_INACTIVE;
+
+	/* the other side sees this with whatever it has left to read, and the socket closing wakes it up */
+	if (shm->ctrl)
+		__sync_fetch_and_or(&shm->ctrl->closed, shm->isServer ? RSSL_BIDIR_SHM_SERVER_CLOSED : RSSL_BIDIR_SHM_CLIENT_CLOSED);
+
+	_rsslBidirShMemFreeChannel(shm);
+	rsslChnlImpl->transportInfo = 0;
+
+	if (rsslChnlImpl->componentInfo)
+	{
+		_rsslFree(rsslChnlImpl->componentInfo[0]);
+		_rsslFree(rsslChnlImpl->componentInfo);
+		rsslChnlImpl->componentInfo = 0;
+	}
+
+	/* Release memory allocated by rsslBidirShMemAccept */
+	if (rsslChnlImpl->Channel.clientHostname)
+	{
+		_rsslFree(rsslChnlImpl->Channel.clientHostname);
+		rsslChnlImpl->Channel.clientHostname = 0;
+	}
+
+	if (rsslChnlImpl->Channel.clientIP)
+	{
+		_rsslFree(rsslChnlImpl->Channel.clientIP);
+		rsslChnlImpl->Channel.clientIP = 0;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* waits for the next record in the inbound ring. On 0, readRet is set and the channel lock released. */
+static rtrShmRingHdr *_rsslBidirShMemNextRecord(rsslChannelImpl *rsslChnlImpl, rsslBidirShMemChannel *shm, RsslRet *readRet, RsslError *error)
+{
+	rtrShmRingHdr *ringHdr;
+	char temp[64];
+	ssize_t ret;
+	struct pollfd pfd;
+
+	while ((ringHdr = RTRShmByteRingPeekRecord(&shm->inReader, shm->inRing, &shm->shMemSeg)) == 0)
+	{
+		if (rtrUnlikely(shm->ctrl->closed & shm->peerClosedFlag))
+		{
+			*readRet = _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslRead() the other side closed the shared memory connection", error);
+			break;
+		}
+
+		/* take any wakeup bytes out of the socket, then ask the writer for one */
+		ret = recv(shm->fd, temp, sizeof(temp), MSG_DONTWAIT);
+		if (rtrUnlikely(ret == 0 || (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)))
+		{
+			*readRet = _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslRead() shared memory connection lost", error);
+			break;
+		}
+
+		shm->inRing->waiters = 1;
+		__sync_synchronize();
+		if ((ringHdr = RTRShmByteRingPeekRecord(&shm->inReader, shm->inRing, &shm->shMemSeg)) != 0)
+			return ringHdr;
+
+		if (!shm->blocking)
+		{
+			*readRet = RSSL_RET_READ_WOULD_BLOCK;
+			break;
+		}
+
+		/* blocking channels wait here for the writer's byte; writes can go ahead on other threads meanwhile */
+		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+		pfd.fd = shm->fd;
+		pfd.events = POLLIN;
+		(void) poll(&pfd, 1, -1);
+		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+	}
+
+	if (!ringHdr && multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+	return ringHdr;
+}
+
+/* appends a piece of a message larger than maxMsgSize to fragBuf */
+static RsslRet _rsslBidirShMemAddFragment(rsslChannelImpl *rsslChnlImpl, rsslBidirShMemChannel *shm, rsslBidirShmMsgHdr *msgHdr, RsslError *error)
+{
+	if (shm->fragLen + msgHdr->length > shm->fragBufSize)
+	{
+		RsslUInt32 newSize = shm->fragLen + msgHdr->length + shm->maxMsgSize;
+		char *newBuf = (char*)_rsslMalloc(newSize);
+
+		if (!newBuf)
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslRead() could not allocate %u bytes to reassemble a message\n", __FILE__, __LINE__, newSize);
+			return RSSL_RET_FAILURE;
+		}
+		if (shm->fragBuf)
+		{
+			memcpy(newBuf, shm->fragBuf, shm->fragLen);
+			_rsslFree(shm->fragBuf);
+		}
+		shm->fragBuf = newBuf;
+		shm->fragBufSize = newSize;
+	}
+
+	memcpy(shm->fragBuf + shm->fragLen, msgHdr + 1, msgHdr->length);
+	shm->fragLen += msgHdr->length;
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl Bidirectional ShMem read */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBidirShMemRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+	rtrShmRingHdr *ringHdr;
+	rsslBidirShmMsgHdr *msgHdr;
+	RsslUInt32 msgFlags;
+	RsslBuffer *msg = &rsslChnlImpl->returnBuffer;
+
+	if (rtrUnlikely(!shm))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemRead failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		*readRet = RSSL_RET_FAILURE;
+		return NULL;
+	}
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+	  if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex))
+	  {
+		*readRet = RSSL_RET_READ_IN_PROGRESS;
+		return NULL;
+	  }
+	}
+
+	/* the message returned by the last read is no longer needed */
+	RTRShmByteRingRelease(&shm->inReader, shm->inRing);
+
+	for (;;)
+	{
+		if ((ringHdr = _rsslBidirShMemNextRecord(rsslChnlImpl, shm, readRet, error)) == 0)
+			return NULL;	/* readRet is set and the lock released */
+
+		/* the writer may reuse the record as soon as it is released, so keep its flags */
+		msgHdr = (rsslBidirShmMsgHdr*)(ringHdr + 1);
+		msgFlags = msgHdr->flags;
+		if (rtrLikely(!(msgFlags & RSSL_BIDIR_SHM_FRAGMENT) && shm->fragLen == 0))
+		{
+			/* the message is returned where it is in the ring; the next read hands it back to the writer */
+			msg->length = msgHdr->length;
+			msg->data = (char*)(msgHdr + 1);
+			break;
+		}
+
+		/* a piece of a message larger than maxMsgSize; put it back together */
+		if (_rsslBidirShMemAddFragment(rsslChnlImpl, shm, msgHdr, error) < RSSL_RET_SUCCESS)
+		{
+			if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+			  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+			*readRet = RSSL_RET_FAILURE;
+			return NULL;
+		}
+		RTRShmByteRingRelease(&shm->inReader, shm->inRing);
+
+		if (!(msgFlags & RSSL_BIDIR_SHM_FRAGMENT))
+		{
+			/* the last piece; fragBuf holds the message until the next read */
+			msg->length = shm->fragLen;
+			msg->data = shm->fragBuf;
+			shm->fragLen = 0;
+			break;
+		}
+	}
+
+	/* more to read if the writer has published past this message. Otherwise ask for a wakeup first,
+	 * since an application selecting on the descriptor won't read again until it gets one. */
+	if (shm->inReader.readPos == shm->inRing->writePos)
+	{
+		shm->inRing->waiters = 1;
+		__sync_synchronize();
+	}
+	*readRet = (shm->inReader.readPos != shm->inRing->writePos) ? 1 : RSSL_RET_SUCCESS;
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	if (rtrUnlikely(msgFlags & RSSL_SHMBUF_PING))
+	{
+		*readRet = RSSL_RET_READ_PING;
+		return NULL;	/* we read a ping, but we return it as a NULL buffer */
+	}
+
+	if (readOutArgs != NULL)
+	{
+		readOutArgs->bytesRead = msg->length;
+		readOutArgs->uncompressedBytesRead = msg->length;
+	}
+
+	return msg;
+}
+
+/* rssl Bidirectional ShMem Write */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error)
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+	rsslBidirShmBlock *block = rsslBufImpl->bufferInfo;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	if (rtrUnlikely(!shm))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWrite() RSSL shared memory channel not available", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* make sure the length they gave us doesnt exceed the buffer */
+	if (rtrUnlikely(rsslBufImpl->buffer.length > block->capacity))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_TOO_SMALL, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "Buffer too small - %d bytes written into buffer of %d bytes\n", rsslBufImpl->buffer.length, block->capacity);
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+	block->length = rsslBufImpl->buffer.length;
+	block->sent = 0;
+	block->flags = 0;
+
+	writeOutArgs->bytesWritten = block->length;
+	writeOutArgs->uncompressedBytesWritten = block->length;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	/* copy it straight into the ring unless earlier messages are still waiting for room */
+	shm->pendingBytes += block->length;
+	if (rtrLikely(!shm->pendingHead) && _rsslBidirShMemPutMessage(shm, block))
+	{
+		_rsslBidirShMemPutBlock(shm, block);
+		ret = _rsslBidirShMemNotify(shm);
+	}
+	else
+	{
+		block->next = 0;
+		if (shm->pendingTail)
+			shm->pendingTail->next = block;
+		else
+			shm->pendingHead = block;
+		shm->pendingTail = block;
+
+		/* the reader may already be waiting on the first pieces of a large message */
+		if (block->sent)
+			ret = _rsslBidirShMemNotify(shm);
+	}
+
+	/* since it was a successful write, free the RsslBuffer */
+	/* remove it from the active buffer list and then add to free buffer list */
+	_rsslCleanBuffer(rsslBufImpl);
+	if (rtrUnlikely(memoryDebug)) printf("adding to freeBufferList and removing from activeBufferList\n");
+
+	if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
+		rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
+
+	rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	if (rtrUnlikely(ret < RSSL_RET_SUCCESS))
+		return _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslWrite() shared memory connection lost", error);
+
+	/* like a socket, a positive return is the number of bytes waiting for rsslFlush() */
+	return (RsslRet)shm->pendingBytes;
+}
+
+/* rssl Bidirectional ShMem GetBuffer */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(rsslBufferImpl*) rsslBidirShMemGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error)
+{
+	rsslBufferImpl *rsslBufImpl;
+	rsslBidirShmBlock *block;
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+
+	if (rtrUnlikely(!shm))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemGetBuffer failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if (rtrUnlikely(packedBuffer))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() packed messages are not supported for shared memory transport.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	/* try to make room before giving up */
+	if (rtrUnlikely((block = _rsslBidirShMemGetBlock(shm, size)) == 0) && shm->pendingHead)
+	{
+		_rsslBidirShMemDrainPending(shm);
+		block = _rsslBidirShMemGetBlock(shm, size);
+	}
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	if (rtrUnlikely(block == 0))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_NO_BUFFERS, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() all %u output buffers are in use.\n", __FILE__, __LINE__, shm->maxBlocks);
+		return NULL;
+	}
+
+	if (rtrUnlikely((rsslBufImpl = _rsslNewBuffer(rsslChnlImpl)) == NULL))
+	{
+		if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+		_rsslBidirShMemPutBlock(shm, block);
+		if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() could not allocate memory for an rsslBuffer.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	rsslBufImpl->buffer.data = block->data;
+	rsslBufImpl->buffer.length = size;
+	rsslBufImpl->bufferInfo = block;
+	rsslBufImpl->packingOffset = 0;
+	rsslBufImpl->totalLength = size;
+
+	return rsslBufImpl;
+}
+
+/* rssl Bidirectional ShMem ReleaseBuffer */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemReleaseBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error)
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+
+	if (rtrUnlikely(!shm))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemReleaseBuffer failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rsslBufImpl->bufferInfo)
+	{
+		if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+		_rsslBidirShMemPutBlock(shm, (rsslBidirShmBlock*)rsslBufImpl->bufferInfo);
+		if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+		rsslBufImpl->bufferInfo = 0;
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl Bidirectional ShMem PackBuffer */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBidirShMemPackBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error)
+{
+	_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslPackBuffer() packed messages currently not supported for shared memory transport.\n", __FILE__, __LINE__);
+
+	return NULL;
+}
+
+/* rssl Bidirectional ShMem Flush */
+/* Messages go straight into the ring unless it is full; flushing retries the ones that did not fit */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+	RsslUInt32 pendingBytes;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	if (rtrUnlikely(!shm))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemFlush failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (!shm->pendingHead)
+		return RSSL_RET_SUCCESS;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+	pendingBytes = shm->pendingBytes;
+	if (_rsslBidirShMemDrainPending(shm) != pendingBytes)
+		ret = _rsslBidirShMemNotify(shm);
+	pendingBytes = shm->pendingBytes;
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	if (rtrUnlikely(ret < RSSL_RET_SUCCESS))
+		return _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslFlush() shared memory connection lost", error);
+
+	return (RsslRet)pendingBytes;
+}
+
+/* rssl Bidirectional ShMem Ping */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemPing(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	if (rtrUnlikely(!shm))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemPing failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* queued messages do the job of a ping once they are flushed */
+	if (shm->pendingHead)
+		return rsslBidirShMemFlush(rsslChnlImpl, error);
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+	/* a full ring already tells the reader we are alive */
+	if (_rsslBidirShMemPutRecord(shm, 0, 0, RSSL_SHMBUF_PING))
+		ret = _rsslBidirShMemNotify(shm);
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	if (rtrUnlikely(ret < RSSL_RET_SUCCESS))
+		return _rsslBidirShMemChannelDown(rsslChnlImpl, "rsslPing() shared memory connection lost", error);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl Bidirectional ShMem GetChannelInfo */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemGetChannelInfo(rsslChannelImpl *rsslChnlImpl, RsslChannelInfo *info, RsslError *error)
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+	RsslInt32 i;
+
+	if (rtrUnlikely(!shm || !shm->ctrl))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemGetChannelInfo failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	info->maxFragmentSize = shm->maxMsgSize;
+	info->guaranteedOutputBuffers = rsslChnlImpl->maxGuarMsgs;
+	info->maxOutputBuffers = shm->maxBlocks;
+	info->numInputBuffers = shm->inRing->numBuffers;
+	info->pingTimeout = rsslChnlImpl->Channel.pingTimeout;
+	info->clientToServerPings = RSSL_TRUE;
+	info->serverToClientPings = RSSL_TRUE;
+	info->sysSendBufSize = (RsslUInt32)shm->outRing->size;
+	info->sysRecvBufSize = (RsslUInt32)shm->inRing->size;
+	info->tcpRecvBufSize = 0;
+	info->tcpSendBufSize = 0;
+	info->compressionType = RSSL_COMP_NONE;	/* we dont support compression with shmem connection */
+	info->compressionThreshold = 0;
+
+	/* the component info is the other side's */
+	if (!rsslChnlImpl->componentInfo)
+	{
+		rsslChnlImpl->componentInfo = (RsslComponentInfo **)_rsslMalloc(sizeof(void*));
+		rsslChnlImpl->componentInfo[0] = (RsslComponentInfo *)_rsslMalloc(sizeof(RsslComponentInfo));
+	}
+	if (shm->isServer)
+	{
+		rsslChnlImpl->componentInfo[0]->componentVersion.length = shm->ctrl->clientComponentVersionLen;
+		rsslChnlImpl->componentInfo[0]->componentVersion.data = shm->ctrl->clientComponentVersion;
+	}
+	else
+	{
+		rsslChnlImpl->componentInfo[0]->componentVersion.length = shm->ctrl->serverComponentVersionLen;
+		rsslChnlImpl->componentInfo[0]->componentVersion.data = shm->ctrl->serverComponentVersion;
+	}
+	info->componentInfoCount = 1;
+	info->componentInfo = rsslChnlImpl->componentInfo;
+
+	/* clear out other fields not used by shmem connection */
+	for (i=0; i < RSSL_RSSL_MAX_FLUSH_STRATEGY; i++)
+	{
+		info->priorityFlushStrategy[i] = 0;
+	}
+
+	info->encryptionProtocol = RSSL_ENC_NONE;
+
+	/* clear other stats types */
+	info->multicastStats.mcastRcvd = 0;
+	info->multicastStats.mcastSent = 0;
+	info->multicastStats.retransPktsRcvd = 0;
+	info->multicastStats.retransPktsSent = 0;
+	info->multicastStats.retransReqRcvd = 0;
+	info->multicastStats.retransReqSent = 0;
+	info->multicastStats.unicastRcvd = 0;
+	info->multicastStats.unicastSent = 0;
+	info->multicastStats.gapsDetected = 0;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl Bidirectional ShMem GetServerInfo */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemGetSrvrInfo(rsslServerImpl *rsslSrvrImpl, RsslServerInfo *info, RsslError *error)
+{
+	if (!rsslSrvrImpl->transportInfo)
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemGetSrvrInfo failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* each channel has its own buffers, there is no shared pool */
+	info->currentBufferUsage = 0;
+	info->peakBufferUsage = 0;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl Bidirectional ShMem Buffer Usage */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBidirShMemBufferUsage(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	rsslBidirShMemChannel *shm = rsslChnlImpl->transportInfo;
+
+	if (shm)
+		return (RsslInt32)shm->blocksInUse;
+
+	_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBidirShMemBufferUsage failed due to no shared memory transport.\n", __FILE__, __LINE__);
+	return RSSL_RET_FAILURE;
+}
+
+/* get info about the shared buffer pool. */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBidirShMemSrvrBufferUsage(rsslServerImpl *rsslSrvrImpl, RsslError *error)
+{
+	/* shmem doesnt used a shared buffer pool */
+	return 0;
+}
+
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemSrvrIoctl(rsslServerImpl *rsslSrvrImpl, RsslIoctlCodes code, void *value, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemCloseServer(rsslServerImpl *rsslSrvrImpl, RsslError *error)
+{
+	rsslBidirShMemServer *shmServer = rsslSrvrImpl->transportInfo;
+
+	/* accepted channels keep their own sockets and segments */
+	if (shmServer)
+	{
+		close(shmServer->fd);
+		_rsslFree(shmServer);
+		rsslSrvrImpl->transportInfo = 0;
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemIoctl(rsslChannelImpl *rsslChnlImpl, RsslIoctlCodes code, void *value, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+#endif
+
+
+/***************************
+ * START PUBLIC ABSTRACTED FUNCTIONS
+ ***************************/
+
+RsslRet rsslBidirShMemSetChannelFunctions()
+{
+	RsslTransportChannelFuncs funcs;
+
+	memset(&funcs, 0, sizeof(funcs));
+	funcs.channelConnect = rsslBidirShMemConnect;
+#if defined(LINUX)
+	funcs.channelBufferUsage = rsslBidirShMemBufferUsage;
+	funcs.channelClose = rsslBidirShMemCloseChannel;
+	funcs.channelFlush = rsslBidirShMemFlush;
+	funcs.channelGetBuffer = rsslBidirShMemGetBuffer;
+	funcs.channelGetInfo = rsslBidirShMemGetChannelInfo;
+	funcs.channelIoctl = rsslBidirShMemIoctl;
+	funcs.channelPackBuffer = rsslBidirShMemPackBuffer;
+	funcs.channelPing = rsslBidirShMemPing;
+	funcs.channelRead = rsslBidirShMemRead;
+	funcs.channelReconnect = rsslBidirShMemReconnect;
+	funcs.channelReleaseBuffer = rsslBidirShMemReleaseBuffer;
+	funcs.channelReleaseReadBuffers = 0;
+	funcs.channelWrite = rsslBidirShMemWrite;
+	funcs.channelWriteBatch = 0;
+	funcs.initChannel = rsslBidirShMemInitChannel;
+#endif
+
+	return(rsslSetTransportChannelFunc(RSSL_BIDIRECTION_SHMEM_TRANSPORT,&funcs));
+}
+
+RsslRet rsslBidirShMemSetServerFunctions()
+{
+	RsslTransportServerFuncs funcs;
+
+	memset(&funcs, 0, sizeof(funcs));
+	funcs.serverBind = rsslBidirShMemBind;
+#if defined(LINUX)
+	funcs.serverAccept = rsslBidirShMemAccept;
+	funcs.serverIoctl = rsslBidirShMemSrvrIoctl;
+	funcs.serverGetInfo = rsslBidirShMemGetSrvrInfo;
+	funcs.serverBufferUsage = rsslBidirShMemSrvrBufferUsage;
+	funcs.closeServer = rsslBidirShMemCloseServer;
+#endif
+
+	return(rsslSetTransportServerFunc(RSSL_BIDIRECTION_SHMEM_TRANSPORT,&funcs));
+}
+
+/* init, uninit, set function pointers */
+RsslRet rsslBidirShMemInitialize(RsslLockingTypes lockingType, RsslError *error)
+{
+	rsslBidirShMemSetServerFunctions();
+	rsslBidirShMemSetChannelFunctions();
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet rsslBidirShMemUninitialize()
+{
+	/* nothing to do for this function for now */
+
+	return RSSL_RET_SUCCESS;
+}
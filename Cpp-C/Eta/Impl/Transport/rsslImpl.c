@@ -10,6 +10,7 @@
 #include "rtr/rsslSocketTransport.h"
 #include "rtr/intDataTypes.h"
 #include "rtr/rsslUniShMemTransport.h"
+#include "rtr/rsslBidirShMemTransport.h"
 #include "rtr/rsslSeqMcastTransport.h"
 #include "rtr/rsslQueue.h"
 
@@ -42,7 +43,9 @@
 #include "rtr/rsslSeqMcastTransportImpl.h"
 #include "rtr/rsslSocketTransportImpl.h"
 #include "rtr/rsslUniShMemTransportImpl.h"
+#include "rtr/rsslBidirShMemTransportImpl.h"
 #include "rtr/rsslLoadInitTransport.h"
+#include "rtr/ripcuring.h"
 
 /* globals */
 static void(*rsslDumpInFunc)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId) = 0;
@@ -352,6 +355,11 @@ void RTR_FASTCALL _rsslReleaseServer(rsslServerImpl *srvr)
 			/* the variables will be set to null in CleanServer */
 			rtrShmTransDestroy(srvr->transportInfo, &error);
 		}
+		else if (srvr->connectionType == RSSL_CONN_TYPE_BIDIR_SHMEM)
+		{
+			/* frees the listening socket; accepted channels own their segments */
+			(*(srvr->serverFuncs->closeServer))(srvr, &error);
+		}
 		else 
 		{	/* This is used to release all socket connection types */
 			ipcShutdownServer(srvr->transportInfo, &error);
@@ -780,6 +788,15 @@ RsslRet rsslInitializeEx(RsslInitializeExOpts *rsslInitOpts, RsslError *error)
 			return retVal;
 		}
 
+		/* initialize bidirectional shmem transport */
+		retVal = rsslBidirShMemInitialize(rsslInitOpts->rsslLocking, error);
+
+		if (retVal < RSSL_RET_SUCCESS)
+		{
+			mutexFuncs.staticMutexUnlock();	
+			return retVal;
+		}
+
 		/* initialize SeqMcast transport */
 		retVal = rsslSeqMcastInitialize(rsslInitOpts->rsslLocking, error);
 
@@ -987,6 +1004,12 @@ RsslServer* rsslBind(RsslBindOptions *opts, RsslError *error)
 			rsslSrvrImpl->channelFuncs = &(channelTransFuncs[RSSL_UNIDIRECTION_SHMEM_TRANSPORT]);
 		}
 		break;
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
+		{
+			rsslSrvrImpl->serverFuncs = &(serverTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+			rsslSrvrImpl->channelFuncs = &(channelTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+		}
+		break;
 		case RSSL_CONN_TYPE_RELIABLE_MCAST:
 		{
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
@@ -1160,6 +1183,10 @@ RsslChannel* rsslConnect(RsslConnectOptions *opts, RsslError *error)
 			rsslChnlImpl->channelFuncs = &(channelTransFuncs[RSSL_UNIDIRECTION_SHMEM_TRANSPORT]);
 		break;
 
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
+			rsslChnlImpl->channelFuncs = &(channelTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+		break;
+
 	    case RSSL_CONN_TYPE_RELIABLE_MCAST:
 		{
 			if (rsslLoadInitRsslTransportChannel(&(channelTransFuncs[RSSL_RRCP_TRANSPORT]), DEFAULT_RRCP_LIB_NAME, (void*)(&multiThread)) < 0)
@@ -1656,6 +1683,7 @@ RSSL_API RsslBuffer* rsslReadEx(RsslChannel *chnl, RsslReadInArgs *readInArgs, R
 	/* lock the channel mutex so that only one read per channel can occur */
 	/* if its already locked, return read in progress */
 	rsslChnlImpl = (rsslChannelImpl*)chnl;
+	rsslChnlImpl->readInFlags = readInArgs->readInFlags;
 
 	retBuf = (*(rsslChnlImpl->channelFuncs->channelRead))(rsslChnlImpl, readOutArgs, readRet, error);
 
@@ -1688,6 +1716,37 @@ RSSL_API RsslBuffer* rsslReadEx(RsslChannel *chnl, RsslReadInArgs *readInArgs, R
 	return retBuf;
 }
 
+/* Releases buffers pinned by rsslReadEx */
+RSSL_API RsslRet rsslReleaseReadBuffers(RsslChannel *chnl, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl=0;
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReleaseReadBuffers() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(chnl, "rsslReleaseReadBuffers", "chnl", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(chnl->state != RSSL_CH_STATE_ACTIVE))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslReleaseReadBuffers() Error: 0007 Only Channels in RSSL_CH_STATE_ACTIVE state can release read buffers.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	rsslChnlImpl = (rsslChannelImpl*)chnl;
+
+	/* transports that never pin have nothing to release */
+	if (rsslChnlImpl->channelFuncs->channelReleaseReadBuffers == 0)
+		return RSSL_RET_SUCCESS;
+
+	return ((*(rsslChnlImpl->channelFuncs->channelReleaseReadBuffers))(rsslChnlImpl, error));
+}
+
 /* Write */
 RsslRet rsslWrite(RsslChannel *chnl, RsslBuffer *buffer, RsslWritePriorities rsslPriority, RsslUInt8 writeFlags, RsslUInt32 *bytesWritten, RsslUInt32 *uncompressedBytesWritten, RsslError *error)
 {
@@ -1897,6 +1956,136 @@ RsslRet rsslWriteEx(RsslChannel *chnl, RsslBuffer *buffer, RsslWriteInArgs *writ
 	}
 }
 
+/* Write an array of buffers, flushing once */
+RSSL_API RsslRet rsslWriteBatch(RsslChannel *chnl, RsslBuffer **buffers, RsslUInt32 bufferCount, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslUInt32 *buffersWritten, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl=0;
+	rsslBufferImpl *rsslBufImpl=0;
+	RsslWriteOutArgs bufWriteOutArgs;
+	RsslInt32 priority;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteBatch() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(chnl, "rsslWriteBatch", "chnl", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(buffers, "rsslWriteBatch", "buffers", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(writeOutArgs, "rsslWriteBatch", "writeOutArgs", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(writeInArgs, "rsslWriteBatch", "writeInArgs", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(buffersWritten, "rsslWriteBatch", "buffersWritten", error)))
+		return RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(chnl->state != RSSL_CH_STATE_ACTIVE))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteBatch() Error: 0007 Only Channels in RSSL_CH_STATE_ACTIVE state can write.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	rsslChnlImpl = (rsslChannelImpl*)chnl;
+	*buffersWritten = 0;
+	writeOutArgs->writeOutFlags = RSSL_WRITE_OUT_NO_FLAGS;
+	writeOutArgs->bytesWritten = 0;
+	writeOutArgs->uncompressedBytesWritten = 0;
+
+	/* get priority checked for valid range */
+	if (rtrUnlikely((writeInArgs->rsslPriority < RSSL_HIGH_PRIORITY) || (writeInArgs->rsslPriority > RSSL_LOW_PRIORITY)))
+		priority = RSSL_MEDIUM_PRIORITY;
+	else
+		priority = writeInArgs->rsslPriority;
+
+	/* check every buffer before any is written, so a bad buffer does not leave the batch half written */
+	for (i = 0; i < bufferCount; i++)
+	{
+		rsslBufImpl = (rsslBufferImpl*)buffers[i];
+
+		if (rtrUnlikely(RSSL_NULL_PTR(rsslBufImpl, "rsslWriteBatch", "buffers[i]", error)))
+			return RSSL_RET_FAILURE;
+
+		/* valid cases are a buffer with length was passed in, or it is a packed buffer and
+		   a 0 length buffer is passed in - this signifys that nothing is written into the last portion of the buffer */
+		if (rtrUnlikely((rsslBufImpl->buffer.length == 0) && (rsslBufImpl->packingOffset == 0)))
+		{
+			_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteBatch() Error: 0009 Buffer of length zero cannot be written\n", __FILE__, __LINE__);
+			return RSSL_RET_FAILURE;
+		}
+
+		/* make sure the integrity checks out */
+		if (rtrUnlikely(rsslBufImpl->integrity != 69))
+		{
+			/* the data has overwritten memory */
+			_rsslSetError(error, chnl, RSSL_RET_BUFFER_TOO_SMALL, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteBatch() Error: 0008 Data has overflowed the allocated buffer length or RSSL is not owner.\n", __FILE__, __LINE__);
+			return RSSL_RET_BUFFER_TOO_SMALL;
+		}
+
+		if (rtrUnlikely(rsslBufImpl->RsslChannel != rsslChnlImpl))
+		{
+			_rsslSetError(error, chnl, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteBatch() Error: 0018 Channel is not owner of buffer.\n", __FILE__, __LINE__);
+			return RSSL_RET_FAILURE;
+		}
+
+		/* if rsslBufImpl->priorty is greater than 0 (i.e. -1), then the priority has already been set once.
+		To prevent message fragments from having different priorities, we don't want to allow this to be changed again*/
+		if (rsslBufImpl->priority < 0)
+			rsslBufImpl->priority = priority;
+
+	}
+
+	/* Tracing is done per message, so it uses the per message write as do transports without batching */
+	if (rtrLikely(rsslChnlImpl->channelFuncs->channelWriteBatch && 
+		!(rsslChnlImpl->traceOptionsInfo.traceOptions.traceFlags & (RSSL_TRACE_TO_FILE_ENABLE | RSSL_TRACE_TO_STDOUT))))
+	{
+		/* do debugging if wanted */
+		if (rtrUnlikely(rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_OUT))
+		{
+			for (i = 0; i < bufferCount; i++)
+			{
+				if (buffers[i]->length > 0)
+					(*(rsslDumpOutFunc))((char*)__FUNCTION__, buffers[i]->data, buffers[i]->length, chnl->socketId);
+			}
+		}
+
+		return (*(rsslChnlImpl->channelFuncs->channelWriteBatch))(rsslChnlImpl, (rsslBufferImpl**)buffers, bufferCount, writeInArgs, writeOutArgs, buffersWritten, error);
+	}
+
+	for (i = 0; i < bufferCount; i++)
+	{
+		rsslClearWriteOutArgs(&bufWriteOutArgs);
+
+		/* When only the flush failed the buffer was taken, and the rest of the batch is still written.
+		 * If the failure closed the channel, the next write fails and leaves the remaining buffers with the caller. */
+		if ((ret = rsslWriteEx(chnl, buffers[i], writeInArgs, &bufWriteOutArgs, error)) < RSSL_RET_SUCCESS
+				&& ret != RSSL_RET_WRITE_FLUSH_FAILED)
+			return ret;
+
+		writeOutArgs->bytesWritten += bufWriteOutArgs.bytesWritten;
+		writeOutArgs->uncompressedBytesWritten += bufWriteOutArgs.uncompressedBytesWritten;
+		*buffersWritten = i + 1;
+	}
+
+	/* the buffers were all taken, but the flush failed */
+	if ((ret = rsslFlush(chnl, error)) < RSSL_RET_SUCCESS)
+		return RSSL_RET_WRITE_FLUSH_FAILED;
+
+	return ret;
+}
+
 /* Flush socket */
 RSSL_API RsslRet rsslFlush(RsslChannel *chnl, RsslError *error)
 {
@@ -2165,6 +2354,7 @@ RsslRet rsslUninitialize()
 		/* uninitialize various transports */
 		rsslSocketUninitialize();
 		rsslUniShMemUninitialize();
+		rsslBidirShMemUninitialize();
 
 		/* Unset the flag here as it is needed by rsslSocketUninitialize()*/
 		multiThread = 0;
@@ -2777,6 +2967,78 @@ RSSL_API RsslRet rsslBufferToRawHexDump(const RsslBuffer* bufferToHexDump, RsslB
 	return RSSL_RET_SUCCESS;
 }
 
+RSSL_API RsslRet rsslSetCompressionDictionary(RsslBuffer *pDictionary, RsslError *error)
+{
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslSetCompressionDictionary() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+	}
+
+	if (pDictionary && pDictionary->length && !pDictionary->data)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_INVALID_ARGUMENT, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslSetCompressionDictionary() Error: 0002 Dictionary has a length but no data.\n", __FILE__, __LINE__);
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	return ripcSetZstdDictionary(pDictionary, error);
+}
+
+RSSL_API RsslIoUring* rsslCreateIoUring(RsslError *error)
+{
+	RsslIoUring *pIoUring = NULL;
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCreateIoUring() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+#ifdef RIPC_URING_SUPPORTED
+	pIoUring = ipcUringNewRing();
+#endif
+
+	if (!pIoUring)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCreateIoUring() Error: 0002 io_uring is not available.\n", __FILE__, __LINE__);
+	}
+
+	return pIoUring;
+}
+
+RSSL_API RsslInt32 rsslIoUringSubmit(RsslIoUring *pIoUring, RsslError *error)
+{
+	RsslInt32 ret = RSSL_RET_FAILURE;
+
+	if (rtrUnlikely(RSSL_NULL_PTR(pIoUring, "rsslIoUringSubmit", "pIoUring", error)))
+		return RSSL_RET_FAILURE;
+
+#ifdef RIPC_URING_SUPPORTED
+	if ((ret = ipcUringSubmit(pIoUring)) >= 0)
+		return ret;
+#endif
+
+	_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoUringSubmit() Error: 0002 io_uring_enter failed. System errno: (%d)\n", __FILE__, __LINE__, errno);
+	return ret;
+}
+
+RSSL_API RsslRet rsslDestroyIoUring(RsslIoUring *pIoUring, RsslError *error)
+{
+	if (rtrUnlikely(RSSL_NULL_PTR(pIoUring, "rsslDestroyIoUring", "pIoUring", error)))
+		return RSSL_RET_FAILURE;
+
+#ifdef RIPC_URING_SUPPORTED
+	ipcUringFreeRing(pIoUring);
+#endif
+
+	return RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslDumpBuffer(RsslChannel *channel, RsslUInt32 protocolType, RsslBuffer* buffer, RsslError *error)
 {
 	rsslChannelImpl *rsslChnlImpl = 0;
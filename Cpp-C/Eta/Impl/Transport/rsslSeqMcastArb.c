@@ -0,0 +1,99 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslSeqMcastArb.h"
+#include <string.h>
+
+void rsslSeqMcastArbClear(RsslSeqMcastArb *pArb)
+{
+	memset(pArb, 0, sizeof(RsslSeqMcastArb));
+}
+
+RsslBool rsslSeqMcastArbitrate(RsslSeqMcastArb *pArb, RsslUInt32 lineIndex, RsslUInt32 seqNum)
+{
+	RsslSeqMcastArbLine *pLine = &pArb->lines[lineIndex];
+	RsslInt32 diff;
+
+	/* Gaps on a line are counted against that line's own sequence */
+	diff = (RsslInt32)(seqNum - pLine->lastSeqNum);
+	if (!pLine->seqStarted)
+	{
+		/* A line that starts late joins the sequence the other line is on */
+		pLine->seqStarted = RSSL_TRUE;
+		pLine->lastSeqNum = seqNum;
+		pLine->restartCount = pArb->restartCount;
+	}
+	else if (diff > 0)
+	{
+		pLine->stats.gaps += diff - 1;
+		pLine->lastSeqNum = seqNum;
+	}
+	else if (diff <= -RSSL_SEQ_MCAST_ARB_WINDOW)
+	{
+		/* Far behind what this line carried before, so its publisher started over */
+		pLine->restartCount++;
+		pLine->lastSeqNum = seqNum;
+	}
+
+	/* Still carrying the sequence from before a restart the other line has shown */
+	if (pLine->restartCount < pArb->restartCount)
+	{
+		pLine->stats.losses++;
+		return RSSL_FALSE;
+	}
+
+	diff = (RsslInt32)(seqNum - pArb->highestSeqNum);
+	if (!pArb->started || pLine->restartCount > pArb->restartCount)
+	{
+		pArb->restartCount = pLine->restartCount;
+		pArb->started = RSSL_TRUE;
+		pArb->highestSeqNum = seqNum;
+		pArb->delivered = 1;
+		pArb->span = 1;
+	}
+	else if (diff > 0)
+	{
+		RsslUInt32 shift = (RsslUInt32)diff;
+		RsslUInt32 bit;
+
+		/* Bits at or above RSSL_SEQ_MCAST_ARB_WINDOW - shift move out of the window */
+		for (bit = (shift < RSSL_SEQ_MCAST_ARB_WINDOW ? RSSL_SEQ_MCAST_ARB_WINDOW - shift : 0); bit < pArb->span; ++bit)
+		{
+			if (!(pArb->delivered & ((RsslUInt64)1 << bit)))
+				pArb->gaps++;
+		}
+		if (shift > RSSL_SEQ_MCAST_ARB_WINDOW)
+			pArb->gaps += shift - RSSL_SEQ_MCAST_ARB_WINDOW;
+
+		pArb->delivered = (shift < RSSL_SEQ_MCAST_ARB_WINDOW ? pArb->delivered << shift : 0) | 1;
+		pArb->span = (pArb->span + shift < RSSL_SEQ_MCAST_ARB_WINDOW ? pArb->span + shift : RSSL_SEQ_MCAST_ARB_WINDOW);
+		pArb->highestSeqNum = seqNum;
+	}
+	else if (diff > -RSSL_SEQ_MCAST_ARB_WINDOW)
+	{
+		RsslUInt64 mask = (RsslUInt64)1 << (RsslUInt32)(-diff);
+
+		if (pArb->delivered & mask)
+		{
+			pLine->stats.losses++;
+			return RSSL_FALSE;
+		}
+
+		pArb->delivered |= mask;
+		if ((RsslUInt32)(-diff) >= pArb->span)
+			pArb->span = (RsslUInt32)(-diff) + 1;
+	}
+	else
+	{
+		pLine->stats.losses++;
+		return RSSL_FALSE;
+	}
+
+	pLine->stats.wins++;
+	return RSSL_TRUE;
+}
@@ -8,6 +8,7 @@
 
 #include "rtr/rsslSeqMcastTransportImpl.h"
 #include "rtr/rsslSeqMcastTransport.h"
+#include "rtr/rsslSeqMcastArb.h"
 #include "rtr/rsslAlloc.h"
 #include "rtr/rsslErrors.h"
 #include "rtr/retmacros.h"
@@ -28,6 +29,14 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/* Linux can read a batch of datagrams with one recvmmsg() call, and can arbitrate
+ * between an A and a B line by polling both sockets through one epoll descriptor. */
+#if defined(LINUX) && defined(MSG_WAITFORONE)
+#include <sys/epoll.h>
+#define SEQ_MCAST_LINUX_READ
 #endif
 
 #if defined(_WIN16) || defined(_WIN32)
@@ -84,6 +93,30 @@
 /* Ping length is the total number of bytes in the header, minus the message length. */
 #define SEQ_MCAST_PING_LEN 12
 
+/* Offset of the sequence number in the header */
+#define SEQ_MCAST_SEQUENCE_NUM_OFFSET 8
+
+/* Upper bound on RsslSeqMCastOpts.readBatchSize */
+#define SEQ_MCAST_MAX_READ_BATCH 1024
+
+/* One multicast socket feeding the channel and the datagrams last read from it.
+ * An arbitrated channel has an A and a B line, any other channel has only the A line. */
+typedef struct
+{
+	RsslSocket			sock;
+	char*				ringMem;			/* ringSize datagram slots of slotSize bytes */
+	RsslUInt32			slotSize;
+	RsslUInt32			ringSize;
+	RsslUInt32			ringCount;			/* Number of datagrams read into the ring */
+	RsslUInt32			ringNext;			/* Next datagram in the ring to process */
+	RsslInt32*			ringLen;
+	struct sockaddr_in*	ringAddr;
+#ifdef SEQ_MCAST_LINUX_READ
+	struct mmsghdr*		ringMsgs;
+	struct iovec*		ringIov;
+#endif
+} RsslSeqMcastLine;
+
 typedef struct
 {
 	RsslMutex			lock;
@@ -107,6 +140,12 @@ typedef struct
 	struct sockaddr_in	sendAddr;
 	struct sockaddr_in	recvAddr;
 	rtrSeqMcastBuffer	writeBuffer;
+	RsslSeqMcastLine	lines[RSSL_SEQ_MCAST_MAX_LINES];
+	RsslUInt32			lineCount;
+	RsslUInt32			currentLine;		/* Line whose ring is read next */
+	RsslBool			blocking;
+	RsslSocket			epollFd;			/* Polls both lines of an arbitrated channel, and is its socketId */
+	RsslSeqMcastArb		arb;				/* Arbitrates between the lines of an arbitrated channel */
 } RsslSeqMcastChannel;
 
 
@@ -192,6 +231,310 @@ RTR_C_ALWAYS_INLINE RsslInt32 rsslSeqMcastWriteHdr(rsslChannelImpl *rsslChnlImpl
 	return 0;
 }
 
+/* Sets up the datagram ring of a line reading from sock. ringMem must hold ringSize slots of slotSize bytes. */
+static RsslRet rsslSeqMcastInitLine(RsslSeqMcastLine *pLine, RsslSocket sock, char *ringMem, RsslUInt32 ringSize, RsslUInt32 slotSize, RsslUInt32 recvLen)
+{
+	pLine->sock = sock;
+	pLine->ringMem = ringMem;
+	pLine->ringSize = ringSize;
+	pLine->slotSize = slotSize;
+	pLine->ringCount = 0;
+	pLine->ringNext = 0;
+
+	if (!(pLine->ringLen = (RsslInt32*)_rsslMalloc(ringSize * sizeof(RsslInt32)))
+			|| !(pLine->ringAddr = (struct sockaddr_in*)_rsslMalloc(ringSize * sizeof(struct sockaddr_in))))
+		return RSSL_RET_FAILURE;
+
+#ifdef SEQ_MCAST_LINUX_READ
+	if (ringSize > 1)
+	{
+		RsslUInt32 i;
+
+		if (!(pLine->ringMsgs = (struct mmsghdr*)_rsslMalloc(ringSize * sizeof(struct mmsghdr)))
+				|| !(pLine->ringIov = (struct iovec*)_rsslMalloc(ringSize * sizeof(struct iovec))))
+			return RSSL_RET_FAILURE;
+
+		memset(pLine->ringMsgs, 0, ringSize * sizeof(struct mmsghdr));
+		for (i = 0; i < ringSize; ++i)
+		{
+			pLine->ringIov[i].iov_base = ringMem + i * slotSize;
+			pLine->ringIov[i].iov_len = recvLen;
+			pLine->ringMsgs[i].msg_hdr.msg_iov = &pLine->ringIov[i];
+			pLine->ringMsgs[i].msg_hdr.msg_iovlen = 1;
+			pLine->ringMsgs[i].msg_hdr.msg_name = &pLine->ringAddr[i];
+		}
+	}
+#endif
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Closes the sockets of the channel's lines, and the descriptor polling them, and frees the lines' rings.
+ * The ring memory itself is the channel's inputBufferMem. */
+static void rsslSeqMcastCloseLines(RsslSeqMcastChannel *pSeqMcastChannel)
+{
+	RsslUInt32 i;
+
+	for (i = 0; i < RSSL_SEQ_MCAST_MAX_LINES; ++i)
+	{
+		RsslSeqMcastLine *pLine = &pSeqMcastChannel->lines[i];
+
+		if (pLine->sock != RSSL_INVALID_SOCKET)
+		{
+			sock_close(pLine->sock);
+			pLine->sock = RSSL_INVALID_SOCKET;
+		}
+
+		if (pLine->ringLen)
+			_rsslFree(pLine->ringLen);
+		if (pLine->ringAddr)
+			_rsslFree(pLine->ringAddr);
+		pLine->ringLen = 0;
+		pLine->ringAddr = 0;
+#ifdef SEQ_MCAST_LINUX_READ
+		if (pLine->ringMsgs)
+			_rsslFree(pLine->ringMsgs);
+		if (pLine->ringIov)
+			_rsslFree(pLine->ringIov);
+		pLine->ringMsgs = 0;
+		pLine->ringIov = 0;
+#endif
+	}
+
+	if (pSeqMcastChannel->epollFd != RSSL_INVALID_SOCKET)
+	{
+		sock_close(pSeqMcastChannel->epollFd);
+		pSeqMcastChannel->epollFd = RSSL_INVALID_SOCKET;
+	}
+}
+
+#ifdef SEQ_MCAST_LINUX_READ
+/* Opens the B line's socket, joined to RsslSeqMCastOpts.lineBAddress, and an epoll descriptor polling
+ * both lines, which becomes the channel's socketId. Both line sockets are made non-blocking; a
+ * blocking channel waits on the epoll descriptor instead. */
+static RsslRet rsslSeqMcastOpenLineB(RsslSeqMcastChannel *pSeqMcastChannel, RsslConnectOptions *opts, RsslError *error)
+{
+	RsslSeqMcastLine *pLineB = &pSeqMcastChannel->lines[RSSL_SEQ_MCAST_LINE_B];
+	char *serviceName = opts->seqMulticastOpts.lineBServiceName ? opts->seqMulticastOpts.lineBServiceName : opts->connectionInfo.segmented.recvServiceName;
+	struct sockaddr_in bindAddr;
+	struct ip_mreq mreg;
+	struct epoll_event event;
+	RsslInt32 reuse = 1;
+	RsslUInt32 addr;
+	RsslSocket sock;
+	RsslUInt32 i;
+
+	if ((sock = (RsslSocket)socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP)) == -1)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 Call to socket() failed for the B line. System errno: (%d).\n", __FILE__, __LINE__, errno);
+		return RSSL_RET_FAILURE;
+	}
+	pLineB->sock = sock;
+
+	if (opts->sysRecvBufSize && setsockopt(sock, SOL_SOCKET, SO_RCVBUF, (char *)&opts->sysRecvBufSize, sizeof(opts->sysRecvBufSize)) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed. Unable to set SO_RCVBUF on the B line socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, (char *)&reuse, sizeof(reuse)) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed. Unable to set SO_REUSEADDR on the B line socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* As with the A line, bind to the group so only its datagrams are received */
+	if (rsslGetHostByName(opts->seqMulticastOpts.lineBAddress, &addr) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  B line address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->seqMulticastOpts.lineBAddress, errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	memset(&bindAddr, 0, sizeof(bindAddr));
+	bindAddr.sin_family = AF_INET;
+	bindAddr.sin_addr.s_addr = addr;
+	mreg.imr_multiaddr.s_addr = addr;
+
+	if (serviceName == NULL || (bindAddr.sin_port = rsslGetServByName(serviceName)) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getServByName() failed.  B line service (%s) is incorrect.  System errno: (%d)\n", __FILE__, __LINE__, serviceName ? serviceName : "", errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (bind(sock, (struct sockaddr *)&bindAddr, sizeof(bindAddr)) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 Call to system bind() failed for the B line. System errno: (%d).\n", __FILE__, __LINE__, errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (opts->connectionInfo.segmented.interfaceName && opts->connectionInfo.segmented.interfaceName[0] != 0)
+	{
+		if (rsslGetHostByName(opts->connectionInfo.segmented.interfaceName, &addr) < 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Interface address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.interfaceName, errno);
+			return RSSL_RET_FAILURE;
+		}
+		mreg.imr_interface.s_addr = addr;
+	}
+	else
+		mreg.imr_interface.s_addr = INADDR_ANY;
+
+	if (setsockopt(sock, IPPROTO_IP, IP_ADD_MEMBERSHIP, (char *)&mreg, sizeof(struct ip_mreq)) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed.  Unable to add membership to the B line multicast group.  System errno: (%d).\n", __FILE__, __LINE__, errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((pSeqMcastChannel->epollFd = epoll_create1(EPOLL_CLOEXEC)) < 0)
+	{
+		pSeqMcastChannel->epollFd = RSSL_INVALID_SOCKET;
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 epoll_create1() failed.  System errno: (%d).\n", __FILE__, __LINE__, errno);
+		return RSSL_RET_FAILURE;
+	}
+
+	for (i = 0; i < RSSL_SEQ_MCAST_MAX_LINES; ++i)
+	{
+		if (fcntl(pSeqMcastChannel->lines[i].sock, F_SETFL, O_NONBLOCK) < 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 fcntl() failed.  Unable to set non-blocking.  System errno: (%d).\n", __FILE__, __LINE__, errno);
+			return RSSL_RET_FAILURE;
+		}
+
+		memset(&event, 0, sizeof(event));
+		event.events = EPOLLIN;
+		event.data.u32 = i;
+		if (epoll_ctl(pSeqMcastChannel->epollFd, EPOLL_CTL_ADD, pSeqMcastChannel->lines[i].sock, &event) < 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 epoll_ctl() failed.  System errno: (%d).\n", __FILE__, __LINE__, errno);
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+#endif
+
+/* Reads into pLine's ring, replacing the datagrams already processed.
+ * Returns the number of datagrams read, or -1 with errno set. */
+static RsslInt32 rsslSeqMcastFillLine(RsslSeqMcastChannel *pSeqMcastChannel, RsslSeqMcastLine *pLine)
+{
+	socklen_t srcAddrLen = sizeof(struct sockaddr_in);
+	RsslInt32 cc;
+
+#ifdef SEQ_MCAST_LINUX_READ
+	if (pLine->ringSize > 1)
+	{
+		RsslUInt32 i;
+
+		/* The kernel overwrites these with each read */
+		for (i = 0; i < pLine->ringSize; ++i)
+			pLine->ringMsgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+
+		/* MSG_WAITFORONE only waits on a blocking socket, and only for the first datagram */
+		if ((cc = recvmmsg(pLine->sock, pLine->ringMsgs, pLine->ringSize, MSG_WAITFORONE, NULL)) < 0)
+			return -1;
+
+		for (i = 0; i < (RsslUInt32)cc; ++i)
+			pLine->ringLen[i] = (RsslInt32)pLine->ringMsgs[i].msg_len;
+
+		pLine->ringCount = (RsslUInt32)cc;
+		pLine->ringNext = 0;
+		return cc;
+	}
+#endif
+
+	if ((cc = recvfrom(pLine->sock, pLine->ringMem, pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN, 0, (struct sockaddr*)&pLine->ringAddr[0], &srcAddrLen)) < 0)
+		return -1;
+
+	pLine->ringLen[0] = cc;
+	pLine->ringCount = 1;
+	pLine->ringNext = 0;
+	return 1;
+}
+
+/* Points inputBuffer at the next datagram to process and returns its length, or returns -1 with errno
+ * set if none could be read. Each line's ring is drained before the other line is read, so on an
+ * arbitrated channel the copy that wins is the one read first. */
+static RsslInt32 rsslSeqMcastNextDatagram(RsslSeqMcastChannel *pSeqMcastChannel, struct sockaddr_in *srcAddr)
+{
+	RsslUInt32 idleLines = 0;
+
+	for (;;)
+	{
+		RsslUInt32 lineIndex = pSeqMcastChannel->currentLine;
+		RsslSeqMcastLine *pLine = &pSeqMcastChannel->lines[lineIndex];
+		char *datagram;
+		RsslInt32 length;
+		RsslUInt32 slot;
+
+		if (pLine->ringNext == pLine->ringCount)
+		{
+			if (rsslSeqMcastFillLine(pSeqMcastChannel, pLine) < 0)
+			{
+				if (pSeqMcastChannel->lineCount == 1 || (errno != EWOULDBLOCK && errno != EAGAIN))
+					return -1;
+
+				/* Nothing on this line, try the other one */
+				pSeqMcastChannel->currentLine = (lineIndex + 1) % pSeqMcastChannel->lineCount;
+				if (++idleLines < pSeqMcastChannel->lineCount)
+					continue;
+
+#ifdef SEQ_MCAST_LINUX_READ
+				if (pSeqMcastChannel->blocking)
+				{
+					struct epoll_event events[RSSL_SEQ_MCAST_MAX_LINES];
+
+					if (epoll_wait(pSeqMcastChannel->epollFd, events, RSSL_SEQ_MCAST_MAX_LINES, -1) < 0)
+						return -1;
+
+					idleLines = 0;
+					continue;
+				}
+#endif
+				return -1;
+			}
+		}
+
+		slot = pLine->ringNext++;
+		datagram = pLine->ringMem + slot * pLine->slotSize;
+		length = pLine->ringLen[slot];
+
+		if (pSeqMcastChannel->lineCount > 1)
+		{
+			RsslUInt32 seqNum;
+
+			if (pLine->ringNext == pLine->ringCount)
+				pSeqMcastChannel->currentLine = (lineIndex + 1) % pSeqMcastChannel->lineCount;
+
+			pSeqMcastChannel->arb.lines[lineIndex].stats.pktsRcvd++;
+
+			/* Pings, retransmissions and malformed datagrams are passed through */
+			if (length > SEQ_MCAST_PING_LEN && (RsslUInt8)datagram[0] == SEQ_MCAST_MAX_VERSION
+					&& !((RsslUInt8)datagram[SEQ_MCAST_VERSION_LEN] & SEQ_MCAST_FLAGS_RETRANSMIT))
+			{
+				RTR_GET_32(seqNum, &datagram[SEQ_MCAST_SEQUENCE_NUM_OFFSET]);
+				if (!rsslSeqMcastArbitrate(&pSeqMcastChannel->arb, lineIndex, seqNum))
+					continue;
+			}
+		}
+
+		pSeqMcastChannel->inputBuffer.data = datagram;
+		*srcAddr = pLine->ringAddr[slot];
+		return length;
+	}
+}
+
 /* Contains code necessary for accepting inbound Sequence Multicast connections to a Sequence Multicast network */
 /* Not implemented */
 rsslChannelImpl* rsslSeqMcastAccept(rsslServerImpl *rsslSrvrImpl, RsslAcceptOptions *opts, RsslError *error)
@@ -240,7 +583,8 @@ RsslRet rsslSeqMcastCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error
 	if (chnlLocking)
 		seqMcastGetLock(&pSeqMcastChannel->lock);
 
-	sock_close(rsslChnlImpl->Channel.socketId);
+	/* closes socketId, which is either the A line's socket or the descriptor polling both lines */
+	rsslSeqMcastCloseLines(pSeqMcastChannel);
 
 	rsslChnlImpl->Channel.state = RSSL_CH_STATE_INACTIVE;
 
@@ -275,12 +619,31 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
     RsslInt32 reuse=1;
 	RsslSeqMcastChannel *pSeqMcastChannel = NULL;
 	RsslUInt32 addr;
+	RsslUInt32 ringSize, slotSize, lineCount, i;
 #ifdef _WIN32
 	RsslUInt32 ifaddr;
 #else
 	struct in_addr ifaddr;
 #endif
 
+#ifdef SEQ_MCAST_LINUX_READ
+	ringSize = opts->seqMulticastOpts.readBatchSize;
+	if (ringSize == 0)
+		ringSize = 1;
+	else if (ringSize > SEQ_MCAST_MAX_READ_BATCH)
+		ringSize = SEQ_MCAST_MAX_READ_BATCH;
+#else
+	ringSize = 1;
+
+	if (opts->seqMulticastOpts.lineBAddress)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0006 B line arbitration is not supported by the sequenced multicast transport on this platform.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+#endif
+	lineCount = opts->seqMulticastOpts.lineBAddress ? RSSL_SEQ_MCAST_MAX_LINES : 1;
+
 	/* Create transport info. */
 	if (!(pSeqMcastChannel = (RsslSeqMcastChannel*)_rsslMalloc(sizeof(RsslSeqMcastChannel))))
 	{
@@ -305,7 +668,9 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
-	if (!(pSeqMcastChannel->inputBufferMem = (char*)_rsslMalloc(opts->seqMulticastOpts.maxMsgSize + SEQ_MCAST_MAX_HDR_LEN + 7)))
+	/* Each line reads into a ring of ringSize slots. Add 7 to each slot, as above, and keep the slots aligned */
+	slotSize = (pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN + 7 + 7) & ~7U;
+	if (!(pSeqMcastChannel->inputBufferMem = (char*)_rsslMalloc(slotSize * ringSize * lineCount)))
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 Failed to allocate the sequenced multicast input buffer.\n", __FILE__, __LINE__);
@@ -327,6 +692,14 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 	memset(&pSeqMcastChannel->sendAddr, 0, sizeof(pSeqMcastChannel->sendAddr));
 	memset(&pSeqMcastChannel->recvAddr, 0, sizeof(pSeqMcastChannel->recvAddr));
 	memset(&pSeqMcastChannel->writeBuffer, 0, sizeof(pSeqMcastChannel->writeBuffer));
+	memset(pSeqMcastChannel->lines, 0, sizeof(pSeqMcastChannel->lines));
+	for (i = 0; i < RSSL_SEQ_MCAST_MAX_LINES; ++i)
+		pSeqMcastChannel->lines[i].sock = RSSL_INVALID_SOCKET;
+	pSeqMcastChannel->lineCount = lineCount;
+	pSeqMcastChannel->currentLine = RSSL_SEQ_MCAST_LINE_A;
+	pSeqMcastChannel->blocking = opts->blocking;
+	pSeqMcastChannel->epollFd = RSSL_INVALID_SOCKET;
+	rsslSeqMcastArbClear(&pSeqMcastChannel->arb);
 
 	if (opts->connectionInfo.unified.address == NULL)
 	{
@@ -599,6 +972,40 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 		pSeqMcastChannel->sendAddr.sin_port = rsslGetServByName(opts->connectionInfo.segmented.recvServiceName);
 	}
 
+	/* Set up the lines' rings; the A line's socket is now owned by the line */
+	for (i = 0; i < lineCount; ++i)
+	{
+		if (rsslSeqMcastInitLine(&pSeqMcastChannel->lines[i], (i == RSSL_SEQ_MCAST_LINE_A ? socketId : RSSL_INVALID_SOCKET),
+					pSeqMcastChannel->inputBufferMem + i * ringSize * slotSize, ringSize, slotSize,
+					pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN) != RSSL_RET_SUCCESS)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 Failed to allocate the sequenced multicast read ring.\n", __FILE__, __LINE__);
+			rsslSeqMcastCloseLines(pSeqMcastChannel);
+			_rsslFree(pSeqMcastChannel->inputBufferMem);
+			_rsslFree(pSeqMcastChannel->bufferMem);
+			_rsslFree(pSeqMcastChannel);
+			return RSSL_RET_FAILURE;
+		}
+	}
+
+#ifdef SEQ_MCAST_LINUX_READ
+	if (lineCount > 1)
+	{
+		if (rsslSeqMcastOpenLineB(pSeqMcastChannel, opts, error) != RSSL_RET_SUCCESS)
+		{
+			rsslSeqMcastCloseLines(pSeqMcastChannel);
+			_rsslFree(pSeqMcastChannel->inputBufferMem);
+			_rsslFree(pSeqMcastChannel->bufferMem);
+			_rsslFree(pSeqMcastChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		/* The application waits on the descriptor polling both lines */
+		socketId = pSeqMcastChannel->epollFd;
+	}
+#endif
+
 	/* Update Channel information */
 	rsslChnlImpl->Channel.socketId = socketId;
 	rsslChnlImpl->Channel.state = RSSL_CH_STATE_ACTIVE;
@@ -696,11 +1103,18 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastGetChannelInfo(rsslChannelImp
 	info->serverToClientPings = RSSL_FALSE;
 	info->multicastStats.mcastRcvd = pSeqMcastChannel->pktRecvCount;
 	info->multicastStats.mcastSent = pSeqMcastChannel->pktSentCount;
+
+	if (pSeqMcastChannel->lineCount > 1)
+	{
+		info->multicastStats.gapsDetected = pSeqMcastChannel->arb.gaps;
+		info->seqMcastLineStats[RSSL_SEQ_MCAST_LINE_A] = pSeqMcastChannel->arb.lines[RSSL_SEQ_MCAST_LINE_A].stats;
+		info->seqMcastLineStats[RSSL_SEQ_MCAST_LINE_B] = pSeqMcastChannel->arb.lines[RSSL_SEQ_MCAST_LINE_B].stats;
+	}
 	
 	info->encryptionProtocol = RSSL_ENC_NONE;
 
 	optlen = sizeof(info->sysSendBufSize);
-	if (getsockopt(rsslChnlImpl->Channel.socketId, SOL_SOCKET, SO_SNDBUF, (char *)&info->sysSendBufSize, &optlen) < 0)
+	if (getsockopt(pSeqMcastChannel->lines[RSSL_SEQ_MCAST_LINE_A].sock, SOL_SOCKET, SO_SNDBUF, (char *)&info->sysSendBufSize, &optlen) < 0)
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetChannelInfo() Error: 1002 getsockopt() failed.  System errno: (%d)\n", __FILE__, __LINE__, errno);
@@ -710,7 +1124,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastGetChannelInfo(rsslChannelImp
 	}
 
 	optlen = sizeof(info->sysRecvBufSize);
-	if (getsockopt(rsslChnlImpl->Channel.socketId, SOL_SOCKET, SO_RCVBUF, (char *)&info->sysRecvBufSize, &optlen) < 0)
+	if (getsockopt(pSeqMcastChannel->lines[RSSL_SEQ_MCAST_LINE_A].sock, SOL_SOCKET, SO_RCVBUF, (char *)&info->sysRecvBufSize, &optlen) < 0)
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetChannelInfo() Error: 1002 getsockopt() failed.  System errno: (%d)\n", __FILE__, __LINE__, errno);
@@ -744,23 +1158,27 @@ RsslRet rsslSeqMcastInitChannel(rsslChannelImpl* rsslChnlImpl, RsslInProgInfo *i
 RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastIoctl(rsslChannelImpl *rsslChnlImpl, RsslIoctlCodes code, void *value, RsslError *error)
 {
 	RsslSeqMcastChannel *pSeqMcastChannel = (RsslSeqMcastChannel*)rsslChnlImpl->transportInfo;
+	RsslUInt32 i;
 
 	if (chnlLocking) seqMcastGetLock(&pSeqMcastChannel->lock);
 	/* component info is handled above in rsslImpl */
 	switch(code)
 	{
 		case RSSL_SYSTEM_READ_BUFFERS:
-			if (setsockopt(rsslChnlImpl->Channel.socketId, SOL_SOCKET, SO_RCVBUF, value, sizeof(RsslInt32)) < 0)
+			for (i = 0; i < pSeqMcastChannel->lineCount; ++i)
 			{
-				_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
-				snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoctrl()  Error: 1002 setsockopt() failed. Unable to set SO_RCVBUF on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
-				if (chnlLocking)
-					seqMcastUnlock(&pSeqMcastChannel->lock);
-				return RSSL_RET_FAILURE;
+				if (setsockopt(pSeqMcastChannel->lines[i].sock, SOL_SOCKET, SO_RCVBUF, value, sizeof(RsslInt32)) < 0)
+				{
+					_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+					snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoctrl()  Error: 1002 setsockopt() failed. Unable to set SO_RCVBUF on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
+					if (chnlLocking)
+						seqMcastUnlock(&pSeqMcastChannel->lock);
+					return RSSL_RET_FAILURE;
+				}
 			}
 			break;
 		case RSSL_SYSTEM_WRITE_BUFFERS:
-			if (setsockopt(rsslChnlImpl->Channel.socketId, SOL_SOCKET, SO_SNDBUF, value, sizeof(RsslInt32)) < 0)
+			if (setsockopt(pSeqMcastChannel->lines[RSSL_SEQ_MCAST_LINE_A].sock, SOL_SOCKET, SO_SNDBUF, value, sizeof(RsslInt32)) < 0)
 			{
 				_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 				snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslIoctrl()  Error: 1002 setsockopt() failed. Unable to set SO_SNDBUF on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
@@ -846,7 +1264,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastPing(rsslChannelImpl *rsslChn
 	/* send packet */
 	do
 	{
-		if ((ret = sendto(rsslChnlImpl->Channel.socketId, sendBuf,
+		if ((ret = sendto(pSeqMcastChannel->lines[RSSL_SEQ_MCAST_LINE_A].sock, sendBuf,
 						SEQ_MCAST_PING_LEN, 
 						0, (struct sockaddr*)&pSeqMcastChannel->sendAddr, sizeof(pSeqMcastChannel->sendAddr))) < 0)
 		{
@@ -886,7 +1304,6 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 	RsslSeqMcastChannel *pSeqMcastChannel = (RsslSeqMcastChannel*)rsslChnlImpl->transportInfo;
 	RsslInt32 cc, remainingLen;
 	struct sockaddr_in srcAddr;
-	RsslInt32 srcAddrLen = sizeof(struct sockaddr_in);
 	RsslUInt8 tmpChar;
 	RsslInt32 hdrLen;
 	RsslInt32 readFlags;
@@ -895,9 +1312,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 	{
 		if (pSeqMcastChannel->stillProcessingPacket == RSSL_FALSE) /* process a new packet from network */
 		{
-			pSeqMcastChannel->inputBuffer.data = pSeqMcastChannel->inputBufferMem;
-
-			if ((cc = recvfrom(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->inputBuffer.data, pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN, 0, (struct sockaddr*)&srcAddr, (socklen_t*)&srcAddrLen)) < 0)
+			if ((cc = rsslSeqMcastNextDatagram(pSeqMcastChannel, &srcAddr)) < 0)
 			{
 				if(errno == EINTR || errno == EWOULDBLOCK || errno == EAGAIN)
 				{
@@ -1279,7 +1694,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastWrite(rsslChannelImpl *rsslCh
 	/* send packet */
 	do
 	{
-		if ((ret = sendto(rsslChnlImpl->Channel.socketId, seqMcastBuffer->buffer + hdrOffset,
+		if ((ret = sendto(pSeqMcastChannel->lines[RSSL_SEQ_MCAST_LINE_A].sock, seqMcastBuffer->buffer + hdrOffset,
 						  pktLength, 0, (struct sockaddr*)&pSeqMcastChannel->sendAddr, sizeof(pSeqMcastChannel->sendAddr))) < 0)
 		{
 			if(errno == EWOULDBLOCK || errno == EAGAIN)
@@ -1346,7 +1761,9 @@ RsslRet rsslSeqMcastSetChannelFunctions()
 	funcs.channelRead = rsslSeqMcastRead;
 	funcs.channelReconnect = rsslSeqMcastReconnect;
 	funcs.channelReleaseBuffer = rsslSeqMcastReleaseBuffer;
+	funcs.channelReleaseReadBuffers = 0;
 	funcs.channelWrite = rsslSeqMcastWrite;
+	funcs.channelWriteBatch = 0;
 	funcs.initChannel = rsslSeqMcastInitChannel;
 	
 	return(rsslSetTransportChannelFunc(RSSL_SEQ_MCAST_TRANSPORT,&funcs));
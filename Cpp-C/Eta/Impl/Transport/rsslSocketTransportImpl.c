@@ -14,6 +14,7 @@
 #include "rtr/rsslErrors.h"
 #include "rtr/ripcflip.h"
 #include "rtr/ripcutils.h"
+#include "rtr/ripcuring.h"
 #include "rtr/rtratomic.h"
 #include "rtr/rsslQueue.h"
 #include "lz4.h"
@@ -96,6 +97,8 @@ static ripcSessInit ipcClientAccept(RsslSocketChannel *rsslSocketChannel, ripcSe
 static ripcSessInit ipcReconnectSocket(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *inPr, RsslError *error);
 ripcSessInit ipcWaitProxyAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *inPr, RsslError *error);
 RsslRet ipcIntWrtHeader(RsslSocketChannel *rssl, RsslError *error);
+RsslRet ipcIntWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rsslBufferImpl, RsslInt32 wFlags, RsslInt32 *bytesWritten,
+	RsslInt32 *uncompBytesWritten, RsslInt32 forceFlush, RsslBool deferFlush, RsslError *error);
 ripcSessInit ipcSessionInit(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *inPr, RsslError *error);
 RsslRet ipcShutdownSockectChannel(RsslSocketChannel* rsslSocketChannel, RsslError *error);
 RsslRet ipcSessDropRef(RsslSocketChannel *rsslSocketChannel, RsslError *error);
@@ -106,6 +109,8 @@ static RsslRet ipcGetSocketRow(RsslSocketChannel *rsslSocketChannel, RsslError *
 
 RsslRet ripcInitZlibComp();
 RsslRet ripcInitLz4Comp();
+RsslRet ripcInitZstdComp();
+void ripcUninitZstdComp();
 
 // used to assign global sessionID's for each session. Will need to optimize to reuse session ID
 static RsslUInt32					g_sessionID = 0;
@@ -143,6 +148,8 @@ static ripcCompFuncs	compressFuncs[RSSL_COMP_MAX_TYPE + 1];
 
 static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_ZLIB = 30;
 static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_LZ4 = 300;
+static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM = 30;	/* small messages compress well against earlier ones */
+static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_ZSTD = 30;
 
 static RsslInitializeExOpts  transOpts = RSSL_INIT_INITIALIZE_EX_OPTS;
 
@@ -151,6 +158,10 @@ static ripcTransportFuncs   transFuncs[RIPC_MAX_TRANSPORTS];
 
 static ripcTransportFuncs 	encryptedSSLTransFuncs[RIPC_MAX_SSL_PROTOCOLS];
 
+#ifdef RIPC_URING_SUPPORTED
+static ripcTransportFuncs	uringTransFuncs;	/* socket functions with io_uring reads and writes */
+#endif
+
 static ripcSSLFuncs		SSLTransFuncs;
 
 static RsslUInt16		numInitCalls = 0;
@@ -159,7 +170,9 @@ static rtr_atomic_val		gblmutexinit = 0;
 
 static u8 ripccompressions[][3]	=	{	{ 0, 0x00, RSSL_COMP_NONE  },	/* no compression	*/
 										{ 0, 0x01, RSSL_COMP_ZLIB  },	/* zlib compression	*/
-										{ 0, 0x02, RSSL_COMP_LZ4 } };	/* LZ4 compression	*/
+										{ 0, 0x02, RSSL_COMP_LZ4 },		/* LZ4 compression	*/
+										{ 0, 0x00, RSSL_COMP_NONE  },	/* unused, rows are indexed by compression type */
+										{ 0, 0x04, RSSL_COMP_ZSTD } };	/* Zstandard compression	*/
 
 /* winInet tunneling */
 #include "rtr/ripcinetutils.h"
@@ -293,6 +306,15 @@ ripcCompFuncs *ipcGetCompFunc(RsslInt32 compressionType)
 	return(funcs);
 }
 
+/* The second compressInit and decompressInit argument: the largest message an LZ4 stream needs room for,
+ * or the dictionary a zstd channel negotiated.  0 compresses each LZ4 message on its own, or zstd as one stream. */
+static int ipcCompInitArg(RsslSocketChannel *rsslSocketChannel, RsslUInt32 maxMsgSize)
+{
+	if (rsslSocketChannel->zstdDictId)
+		return (int)rsslSocketChannel->zstdDictId;
+	return (rsslSocketChannel->lz4Stream ? (int)maxMsgSize : 0);
+}
+
 RsslRet ipcSetSocketChannelProtocolHdrFuncs(RsslSocketChannel * rsslSocketChannel, RsslInt32 type)
 {
 
@@ -628,9 +650,24 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 
 	inputBufferLength = rsslSocketChannel->inputBuffer->length; /* Keeps the initial input buffer length */
 
-	if (rsslSocketChannel->inputBuffer->length == 0)
+	/* Messages pinned by the application stay in front of the cursor, so read in after them */
+	if (rsslSocketChannel->inputBuffer->length == 0 ||
+		(rsslSocketChannel->inputBufPinEnd && rsslSocketChannel->inputBufCursor == rsslSocketChannel->inputBuffer->length))
 	{
-		cc = (*(rsslSocketChannel->protocolFuncs->readTransportMsg))((void*)rsslSocketChannel, rsslSocketChannel->inputBuffer->buffer, rsslSocketChannel->readSize, rwflags, error);
+		if (rsslSocketChannel->inputBuffer->length >= (size_t)rsslSocketChannel->readSize)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_BUFFER_NO_BUFFERS, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+				"<%s:%d> Error: 1009 ipcReadSession() failed, the input buffer is full of pinned messages. Pinned read buffers need to be released.\n",
+				__FILE__, __LINE__);
+
+			*readret = RSSL_RET_BUFFER_NO_BUFFERS;
+
+			return 0;
+		}
+
+		cc = (*(rsslSocketChannel->protocolFuncs->readTransportMsg))((void*)rsslSocketChannel, rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBuffer->length,
+			rsslSocketChannel->readSize - (RsslInt32)rsslSocketChannel->inputBuffer->length, rwflags, error);
 
 		if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
 		{
@@ -1194,8 +1231,11 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 			If we have more in our buffer, then return RSSL_RET_SUCCESS so the client calls read again */
 			if ((size_t)(rsslSocketChannel->inputBufCursor) == rsslSocketChannel->inputBuffer->length)
 			{
-				rsslSocketChannel->inputBuffer->length = 0;
-				rsslSocketChannel->inputBufCursor = 0;
+				if (!rsslSocketChannel->inputBufPinEnd)
+				{
+					rsslSocketChannel->inputBuffer->length = 0;
+					rsslSocketChannel->inputBufCursor = 0;
+				}
 				*readret = RSSL_RET_READ_WOULD_BLOCK;
 			}
 			else
@@ -1226,8 +1266,11 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 
 		if ((size_t)(rsslSocketChannel->inputBufCursor) == rsslSocketChannel->inputBuffer->length)
 		{
-			rsslSocketChannel->inputBuffer->length = 0;
-			rsslSocketChannel->inputBufCursor = 0;
+			if (!rsslSocketChannel->inputBufPinEnd)
+			{
+				rsslSocketChannel->inputBuffer->length = 0;
+				rsslSocketChannel->inputBufCursor = 0;
+			}
 			/* need to reset this - all the flags we set in here
 			make the app think there is more data to read */
 			*moreData = 0;
@@ -1369,13 +1412,23 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 		(*ripcDumpInFunc)(__FUNCTION__,rsslSocketChannel->curInputBuf->buffer - cHdrLen,
 		(RsslUInt32)(rsslSocketChannel->curInputBuf->length + cHdrLen), rsslSocketChannel->stream);
 
+	/* Pin whole messages returned straight from the input buffer; decompressed and fragmented
+	* messages are returned from buffers that the next read reuses anyway */
+	if (rsslSocketChannel->pinInputBuf && !(ipcFlags & (IPC_FRAG_HEADER | IPC_FRAG)) &&
+		rsslSocketChannel->curInputBuf->buffer > rsslSocketChannel->inputBuffer->buffer &&
+		rsslSocketChannel->curInputBuf->buffer <= rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufCursor)
+		rsslSocketChannel->inputBufPinEnd = rsslSocketChannel->inputBufCursor;
+
 	/* Reset the read information
 	* when complete with message.
 	*/
 	if ((size_t)(rsslSocketChannel->inputBufCursor) == rsslSocketChannel->inputBuffer->length)
 	{
-		rsslSocketChannel->inputBuffer->length = 0;
-		rsslSocketChannel->inputBufCursor = 0;
+		if (!rsslSocketChannel->inputBufPinEnd)
+		{
+			rsslSocketChannel->inputBuffer->length = 0;
+			rsslSocketChannel->inputBufCursor = 0;
+		}
 	}
 	else
 	{
@@ -1824,6 +1877,7 @@ RsslInt32 ipcIntWrtHeader(RsslSocketChannel *rsslSocketChannel, RsslError *error
 	else
 	{
 		/* pings are always assumed high priority */
+		buffer->queueTime = ipcQueueTime(rsslSocketChannel);
 		rsslQueueAddLinkToBack(&(rsslSocketChannel->priorityQueues[0].priorityQueue), &(buffer->link));
 	}
 
@@ -1838,6 +1892,27 @@ RsslInt32 ipcIntWrtHeader(RsslSocketChannel *rsslSocketChannel, RsslError *error
 
 RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rsslBufferImpl, RsslInt32 wFlags, RsslInt32 *bytesWritten,
 	RsslInt32 *uncompBytesWritten, RsslInt32 forceFlush, RsslError *error)
+{
+	RsslRet			retval;
+
+	_DEBUG_TRACE_WRITE("called\n")
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "ipcWriteSession", "rsslSocketChannel", error))
+		return RSSL_RET_FAILURE;
+
+	IPC_MUTEX_LOCK(rsslSocketChannel);
+
+	retval = ipcIntWriteSession(rsslSocketChannel, rsslBufferImpl, wFlags, bytesWritten, uncompBytesWritten, forceFlush, RSSL_FALSE, error);
+
+	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+	return(retval);
+}
+
+/* Queues the buffer for writing, the caller holds the session mutex.
+ * When deferFlush is set, the high water mark is not checked and the caller is expected to flush. */
+RsslRet ipcIntWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rsslBufferImpl, RsslInt32 wFlags, RsslInt32 *bytesWritten,
+	RsslInt32 *uncompBytesWritten, RsslInt32 forceFlush, RsslBool deferFlush, RsslError *error)
 {
 	RsslRet			retval = RSSL_RET_SUCCESS;
 	RsslInt32		i = 0;
@@ -1861,13 +1936,6 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 	RsslUInt32		fragId = rsslBufferImpl->fragId;
 	RsslQueueLink	*pLink = 0;
 
-	_DEBUG_TRACE_WRITE("called\n")
-
-	if (IPC_NULL_PTR(rsslSocketChannel, "ipcWriteSession", "rsslSocketChannel", error))
-		return RSSL_RET_FAILURE;
-
-	IPC_MUTEX_LOCK(rsslSocketChannel);
-
 	if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -1875,8 +1943,6 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 			"<%s:%d> Error: 1003 ipcIntWrtSess() failed due to channel shutting down.\n",
 			__FILE__, __LINE__);
 
-		IPC_MUTEX_UNLOCK(rsslSocketChannel);
-
 		return RSSL_RET_FAILURE;
 	}
 
@@ -1887,8 +1953,6 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
                         "<%s:%d> Error: 1007 ipcIntWrtSess() failed due the buffer has been released.\n",
                         __FILE__, __LINE__);
 
-                IPC_MUTEX_UNLOCK(rsslSocketChannel);
-
                 return RSSL_RET_FAILURE;
         }
 
@@ -2458,6 +2522,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 						{
 							/* put it in the correct priority out list */
 							rsslSocketChannel->priorityQueues[compressedmb1->priority].queueLength += totalSize;
+							compressedmb1->queueTime = ipcQueueTime(rsslSocketChannel);
 							rsslQueueAddLinkToBack(&(rsslSocketChannel->priorityQueues[compressedmb1->priority].priorityQueue), &(compressedmb1->link));
 						}
 
@@ -2822,6 +2887,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 					_DEBUG_TRACE_WRITE("#2 Queuing %d bytes (forceFlush=%d, queueLength=%d)\n", totalSize, forceFlush, rsslSocketChannel->priorityQueues[msgb->priority].queueLength)
 
 
+					msgb->queueTime = ipcQueueTime(rsslSocketChannel);
 					rsslQueueAddLinkToBack(&(rsslSocketChannel->priorityQueues[msgb->priority].priorityQueue), &(msgb->link));
 					rsslSocketChannel->bytesOutLastMsg += (RsslUInt32)(msgb->length);
 				}
@@ -2890,17 +2956,116 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 		for (i = 0; i < RIPC_MAX_PRIORITY_QUEUE; i++)
 			retval += rsslSocketChannel->priorityQueues[i].queueLength;
 
-		if ((forceFlush == RSSL_WRITE_DIRECT_SOCKET_WRITE) || (retval >(RsslInt32)rsslSocketChannel->high_water_mark))
+		if ((forceFlush == RSSL_WRITE_DIRECT_SOCKET_WRITE) || (!deferFlush && retval >(RsslInt32)rsslSocketChannel->high_water_mark))
 		{
 			retval = ipcFlushSession(rsslSocketChannel, error);
 		}
 	}
 
-	IPC_MUTEX_UNLOCK(rsslSocketChannel);
-
 	return(retval);
 }
 
+/* Returns the next buffer in a priority queue that the current write vector has not taken yet */
+static rtr_msgb_t *ipcPeekUntaken(RsslSocketChannel *rsslSocketChannel, RsslInt32 queue)
+{
+	RIPC_PRIORITY_WRITE	*pQueue = &rsslSocketChannel->priorityQueues[queue];
+	RsslQueueLink		*pLink;
+
+	if (pQueue->tempIndex > -1)
+		pLink = rsslQueuePeekNext(&pQueue->priorityQueue, &(pQueue->tempList[pQueue->tempIndex]->link));
+	else
+		pLink = rsslQueuePeekFront(&pQueue->priorityQueue);
+
+	return (pLink ? RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink) : 0);
+}
+
+/* Bytes of a queued buffer that are still to be written */
+static RsslInt64 ipcUnwrittenLength(rtr_msgb_t *msgb)
+{
+	return (RsslInt64)(msgb->length - ((caddr_t)msgb->local - msgb->buffer));
+}
+
+/* Chooses the next buffer to flush by byte-weighted deficit round robin.
+ * Each visit to a queue adds its quantum to its deficit, and the queue sends
+ * while its deficit covers the next buffer.  The chosen buffer is charged to
+ * its queue.  Returns 0 when there is nothing left to take. */
+static rtr_msgb_t *ipcDrrTake(RsslSocketChannel *rsslSocketChannel, RsslInt32 *iovPriority, RsslInt32 iovIndex)
+{
+	rtr_msgb_t	*msgb;
+	RsslInt64	rounds;
+	RsslInt64	needed;
+	RsslInt32	queue;
+	RsslInt32	visited;
+
+	for (;;)
+	{
+		rounds = 0;
+		for (visited = 0; visited < RIPC_MAX_PRIORITY_QUEUE; visited++)
+		{
+			queue = rsslSocketChannel->drrCurrent;
+			if ((msgb = ipcPeekUntaken(rsslSocketChannel, queue)) != 0)
+			{
+				if (!rsslSocketChannel->drrQuantumAdded)
+				{
+					rsslSocketChannel->flushDeficit[queue] += rsslSocketChannel->flushQuantum[queue];
+					rsslSocketChannel->drrQuantumAdded = 1;
+				}
+
+				if (rsslSocketChannel->flushDeficit[queue] >= ipcUnwrittenLength(msgb))
+				{
+					rsslSocketChannel->flushDeficit[queue] -= ipcUnwrittenLength(msgb);
+					iovPriority[iovIndex] = queue;
+					rsslSocketChannel->priorityQueues[queue].tempIndex++;
+					rsslSocketChannel->priorityQueues[queue].tempList[rsslSocketChannel->priorityQueues[queue].tempIndex] = msgb;
+					return msgb;
+				}
+
+				needed = (ipcUnwrittenLength(msgb) - rsslSocketChannel->flushDeficit[queue] + rsslSocketChannel->flushQuantum[queue] - 1)
+					/ rsslSocketChannel->flushQuantum[queue];
+				if (rounds == 0 || needed < rounds)
+					rounds = needed;
+			}
+			else
+			{
+				/* an idle queue does not save up credit */
+				rsslSocketChannel->flushDeficit[queue] = 0;
+			}
+
+			rsslSocketChannel->drrQuantumAdded = 0;
+			if (++rsslSocketChannel->drrCurrent == RIPC_MAX_PRIORITY_QUEUE)
+				rsslSocketChannel->drrCurrent = 0;
+		}
+
+		if (rounds == 0)
+			return 0;
+
+		/* no queue could send this round; skip ahead to the round where one can */
+		for (queue = 0; queue < RIPC_MAX_PRIORITY_QUEUE; queue++)
+		{
+			if (ipcPeekUntaken(rsslSocketChannel, queue))
+				rsslSocketChannel->flushDeficit[queue] += (rounds - 1) * rsslSocketChannel->flushQuantum[queue];
+		}
+	}
+}
+
+/* Adds the time a flushed buffer spent in its priority queue to the channel statistics */
+static void ipcCountQueueDelay(RsslSocketChannel *rsslSocketChannel, RsslInt32 queue, rtr_msgb_t *msgb, RsslTimeValue *pNow)
+{
+	RsslUInt64 delay;
+
+	rsslSocketChannel->flushedBufCount[queue]++;
+	if (msgb->queueTime == 0)
+		return;
+
+	if (*pNow == 0)
+		*pNow = rsslGetTimeMicro();
+
+	delay = (*pNow > msgb->queueTime) ? (*pNow - msgb->queueTime) : 0;
+	rsslSocketChannel->queueDelayUsec[queue] += delay;
+	if (delay > rsslSocketChannel->maxQueueDelayUsec[queue])
+		rsslSocketChannel->maxQueueDelayUsec[queue] = delay;
+}
+
 RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 {
 	rtr_msgb_t			*curmsgb = 0;
@@ -2917,6 +3082,8 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 	RsslInt32			iovLength = RIPC_MAXIOVLEN;
 	RsslInt32			reducedIovLen = 0;
 	RsslQueueLink		*pLink = 0;
+	RsslInt32			drrUncharged = 0;
+	RsslTimeValue		now = 0;
 
 	if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
 	{
@@ -2935,7 +3102,10 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 
 	iovPriority[0] = -1;
 	for (i = 0; i < RIPC_MAX_PRIORITY_QUEUE; i++)
+	{
 		rsslSocketChannel->priorityQueues[i].tempList[0] = 0;
+		rsslSocketChannel->priorityQueues[i].tempIndex = -1;
+	}
 
 	/* If there is no writev, then write one at a time. */
 	if (rsslSocketChannel->transportFuncs->writeVTransport == 0) {
@@ -2947,6 +3117,25 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 			/* while we have a buffer, or we do not have a buffer and have gone through
 			the entire flush strategy we want to exit the while */
 
+			/* with deficit round robin, a partly written buffer was charged when it was
+			first chosen, so it is finished before the next one is picked */
+			if (rsslSocketChannel->flushQuantum[0])
+			{
+				for (i = 0; (i < RIPC_MAX_PRIORITY_QUEUE) && (!curmsgb); i++)
+				{
+					pLink = rsslQueuePeekFront(&rsslSocketChannel->priorityQueues[i].priorityQueue);
+					if (pLink)
+					{
+						curmsgb = RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink);
+						if (curmsgb->local == curmsgb->buffer)
+							curmsgb = 0;
+					}
+				}
+
+				if ((!curmsgb) && ((curmsgb = ipcDrrTake(rsslSocketChannel, iovPriority, 0)) != 0))
+					rsslSocketChannel->priorityQueues[curmsgb->priority].tempIndex = -1;
+			}
+
 			/* this should get a msgb from the output queue that should be flushed */
 			while (!curmsgb)
 			{
@@ -3058,6 +3247,7 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 				else
 					lenToWrite = (RsslInt32)(curmsgb->length - ((caddr_t)curmsgb->local - curmsgb->buffer));
 
+				rsslSocketChannel->writeCallCount++;
 				if (rsslSocketChannel->httpHeaders)
 					cc = (*(rsslSocketChannel->transportFuncs->writeTransport))(rsslSocketChannel->tunnelTransportInfo, curmsgb->local, lenToWrite, rwflags, error);
 				else
@@ -3099,6 +3289,10 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 				/* now update the particular output buffers length */
 				rsslSocketChannel->priorityQueues[curmsgb->priority].queueLength -= cc;
 
+				/* a buffer that was not written at all will be chosen again, so give back what it was charged */
+				if ((cc == 0) && (rsslSocketChannel->blocking == 0) && rsslSocketChannel->flushQuantum[0] && (curmsgb->local == curmsgb->buffer))
+					rsslSocketChannel->flushDeficit[curmsgb->priority] += lenToWrite;
+
 				if (cc == lenToWrite) /* check if we wrote out everything we expected to */
 				{
 					/* now actually remove the buffer from the queue */
@@ -3110,6 +3304,7 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 						curmsgb = 0;
 
 					RIPC_ASSERT(curmsgb);
+					ipcCountQueueDelay(rsslSocketChannel, curmsgb->priority, curmsgb, &now);
 					rtr_dfltcFreeMsg(curmsgb);
 					curmsgb = 0;
 
@@ -3198,6 +3393,7 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 	{
 		lenToWrite = 0;
 		wrtveclen = 0;
+		drrUncharged = 0;
 		for (i = 0; i < RIPC_MAX_PRIORITY_QUEUE; i++)
 			rsslSocketChannel->priorityQueues[i].tempIndex = -1;
 
@@ -3217,12 +3413,16 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 				curmsgb = RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink);
 
 			if (curmsgb) {
+				drrUncharged = 1;
 				iovPriority[wrtveclen] = rsslSocketChannel->nextOutBuf;
 				rsslSocketChannel->priorityQueues[rsslSocketChannel->nextOutBuf].tempIndex++;
 				rsslSocketChannel->priorityQueues[rsslSocketChannel->nextOutBuf].tempList[rsslSocketChannel->priorityQueues[rsslSocketChannel->nextOutBuf].tempIndex] = curmsgb;
 			}
 		}
 
+		if ((!curmsgb) && rsslSocketChannel->flushQuantum[0])
+			curmsgb = ipcDrrTake(rsslSocketChannel, iovPriority, wrtveclen);
+
 		while (!curmsgb)
 		{
 			/* do work to get buffer here */
@@ -3300,6 +3500,9 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 			/* set this to 0 */
 			curmsgb = 0;
 
+			if ((wrtveclen < iovLength) && rsslSocketChannel->flushQuantum[0])
+				curmsgb = ipcDrrTake(rsslSocketChannel, iovPriority, wrtveclen);
+
 			/* now here get the buffer - this is instead of doing it in each of the if/else statements above */
 			while ((!curmsgb) && (wrtveclen < iovLength))
 			{
@@ -3366,6 +3569,7 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 
 		if (wrtveclen > 0)
 		{
+			rsslSocketChannel->writeCallCount++;
 			if (rsslSocketChannel->httpHeaders)
 				cc = (*(rsslSocketChannel->transportFuncs->writeVTransport))(rsslSocketChannel->tunnelTransportInfo, wrtvec, wrtveclen, lenToWrite, rwflags, error);
 			else
@@ -3423,9 +3627,10 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 						curmsgb = RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink);
 
 					rsslSocketChannel->priorityQueues[iovPriority[wrtveclen]].queueLength -= (RsslInt32)curmsgb->length;
+					RIPC_ASSERT(curmsgb);
+					ipcCountQueueDelay(rsslSocketChannel, iovPriority[wrtveclen], curmsgb, &now);
 					iovPriority[wrtveclen] = -1;
 					rsslSocketChannel->nextOutBuf = -1;
-					RIPC_ASSERT(curmsgb);
 					rtr_dfltcFreeMsg(curmsgb);
 					curmsgb = 0;
 				}
@@ -3508,11 +3713,12 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 							curmsgb = RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink);
 
 						rsslSocketChannel->priorityQueues[iovPriority[curpos]].queueLength -= (RsslInt32)curmsgb->length;
+						RIPC_ASSERT(curmsgb);
+						ipcCountQueueDelay(rsslSocketChannel, iovPriority[curpos], curmsgb, &now);
 						iovPriority[curpos] = -1;
 
 						rsslSocketChannel->nextOutBuf = -1;
 
-						RIPC_ASSERT(curmsgb);
 						rtr_dfltcFreeMsg(curmsgb);
 
 						curmsgb = 0;
@@ -3544,6 +3750,17 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 						curpos++;
 					}
 				}
+
+				/* buffers that were not written at all will be chosen again, so give back what they were charged */
+				if (rsslSocketChannel->flushQuantum[0])
+				{
+					for (; curpos < wrtveclen; curpos++)
+					{
+						if ((iovPriority[curpos] != -1) && !(curpos == 0 && drrUncharged))
+							rsslSocketChannel->flushDeficit[iovPriority[curpos]] += RIPC_IOV_GETLEN(&wrtvec[curpos]);
+						iovPriority[curpos] = -1;
+					}
+				}
 			}
 
 			if (rsslSocketChannel->blocking == 0)
@@ -4226,11 +4443,24 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							rsslSocketChannel->inDecompress = 0;
 							rsslSocketChannel->inDecompFuncs = 0;
 						}
+						/* use an LZ4 stream when the client says it can decompress one */
+						if ((rsslSocketChannel->outCompression == RSSL_COMP_LZ4) && rsslSocketChannel->inDecompFuncs &&
+							(compbitmapsize > 0) && (hdrStart[10] & RIPC_COMP_LZ4_STREAM_BIT))
+							rsslSocketChannel->lz4Stream = 1;
+						/* compress zstd against the dictionary when the client has the same one */
+						if ((rsslSocketChannel->outCompression == RSSL_COMP_ZSTD) && rsslSocketChannel->inDecompFuncs &&
+							(compbitmapsize >= RIPC_COMP_ZSTD_DICT_BITMAP_SIZE) && (hdrStart[10] & RIPC_COMP_ZSTD_DICT_BIT))
+						{
+							RsslUInt32 dictId;
+							_move_u32_swap(&dictId, (hdrStart + 11));
+							if ((dictId != 0) && (dictId == ripcZstdDictionaryId()))
+								rsslSocketChannel->zstdDictId = dictId;
+						}
 						if (rsslSocketChannel->outCompFuncs)
 						{
 								_DEBUG_TRACE_CONN("about to initialize compression = %d\n", rsslSocketChannel->outCompression)
 							rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(
-								rsslSocketChannel->server->zlibCompressionLevel, 0, error);
+								rsslSocketChannel->server->zlibCompressionLevel, ipcCompInitArg(rsslSocketChannel, rsslSocketChannel->maxMsgSize), error);
 							if (rsslSocketChannel->c_stream_out == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -4241,7 +4471,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						if (rsslSocketChannel->inDecompFuncs)
 						{
 								_DEBUG_TRACE_CONN("about to initialize decompression = %d\n", rsslSocketChannel->inDecompress)
-								rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(0, error);
+								rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(ipcCompInitArg(rsslSocketChannel, rsslSocketChannel->maxMsgSize), error);
 							if (rsslSocketChannel->c_stream_in == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -4375,11 +4605,24 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							rsslSocketChannel->inDecompress = 0;
 							rsslSocketChannel->inDecompFuncs = 0;
 						}
+						/* use an LZ4 stream when the client says it can decompress one */
+						if ((rsslSocketChannel->outCompression == RSSL_COMP_LZ4) && rsslSocketChannel->inDecompFuncs &&
+							(compbitmapsize > 0) && (hdrStart[10] & RIPC_COMP_LZ4_STREAM_BIT))
+							rsslSocketChannel->lz4Stream = 1;
+						/* compress zstd against the dictionary when the client has the same one */
+						if ((rsslSocketChannel->outCompression == RSSL_COMP_ZSTD) && rsslSocketChannel->inDecompFuncs &&
+							(compbitmapsize >= RIPC_COMP_ZSTD_DICT_BITMAP_SIZE) && (hdrStart[10] & RIPC_COMP_ZSTD_DICT_BIT))
+						{
+							RsslUInt32 dictId;
+							_move_u32_swap(&dictId, (hdrStart + 11));
+							if ((dictId != 0) && (dictId == ripcZstdDictionaryId()))
+								rsslSocketChannel->zstdDictId = dictId;
+						}
 						if (rsslSocketChannel->outCompFuncs)
 						{
 								_DEBUG_TRACE_CONN("about to initialize compression = %d\n", rsslSocketChannel->outCompression)
 							rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(
-								rsslSocketChannel->server->zlibCompressionLevel, 0, error);
+								rsslSocketChannel->server->zlibCompressionLevel, ipcCompInitArg(rsslSocketChannel, rsslSocketChannel->maxMsgSize), error);
 							if (rsslSocketChannel->c_stream_out == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -4390,7 +4633,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						if (rsslSocketChannel->inDecompFuncs)
 						{
 								_DEBUG_TRACE_CONN("about to initialize decompression = %d\n", rsslSocketChannel->inDecompress)
-								rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(0, error);
+								rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(ipcCompInitArg(rsslSocketChannel, rsslSocketChannel->maxMsgSize), error);
 							if (rsslSocketChannel->c_stream_in == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -5534,7 +5777,8 @@ static ripcSessInit ipcFinishSess(RsslSocketChannel *rsslSocketChannel, ripcSess
 	conMsg[iterator++] = (RsslUInt8)rsslSocketChannel->majorVersion;
 	conMsg[iterator++] = (RsslUInt8)rsslSocketChannel->minorVersion;
 	{
-		RsslUInt16 outCompression = rsslSocketChannel->outCompression;
+		RsslUInt16 outCompression = (rsslSocketChannel->lz4Stream ? RIPC_COMP_LZ4_STREAM :
+									(rsslSocketChannel->zstdDictId ? RIPC_COMP_ZSTD_DICT : rsslSocketChannel->outCompression));
 		_move_u16_swap((conMsg + iterator), &outCompression);	/* make sure to use a 16 bit data type */
 	}
 	iterator += 2;
@@ -5679,7 +5923,10 @@ static ripcSessInit ipcFinishSess(RsslSocketChannel *rsslSocketChannel, ripcSess
 				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZLIB;
 				break;
 			case RSSL_COMP_LZ4:
-				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
+				rsslSocketChannel->lowerCompressionThreshold = (rsslSocketChannel->lz4Stream ? RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM : RSSL_COMP_DFLT_THRESHOLD_LZ4);
+				break;
+			case RSSL_COMP_ZSTD:
+				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
 				break;
 			default:
 				break;
@@ -5963,7 +6210,10 @@ static ripcSessInit ipcWaitClientKey(RsslSocketChannel *rsslSocketChannel, ripcS
 			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZLIB;
 			break;
 		case RSSL_COMP_LZ4:
-			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
+			rsslSocketChannel->lowerCompressionThreshold = (rsslSocketChannel->lz4Stream ? RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM : RSSL_COMP_DFLT_THRESHOLD_LZ4);
+			break;
+		case RSSL_COMP_ZSTD:
+			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
 			break;
 		default:
 			break;
@@ -6201,15 +6451,28 @@ ripcSessInit ipcConnecting(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 			}
 			else
 			{
-				ripcHeaderSize = V10_MIN_CONN_HDR + RSSL_COMP_BITMAP_SIZE +
+				RsslUInt8 compBitmapSize = RSSL_COMP_BITMAP_SIZE;
+
+				MemCopyByInt((ripcHead + 10), (char*)rsslSocketChannel->compressionBitmap, RSSL_COMP_BITMAP_SIZE);
+
+				/* offer to compress zstd against our dictionary; servers without the same one use a stream */
+				rsslSocketChannel->zstdDictId = 0;
+				if ((rsslSocketChannel->inDecompress == RSSL_COMP_ZSTD) && (rsslSocketChannel->version->connVersion > CONN_VERSION_11) &&
+					((rsslSocketChannel->zstdDictId = ripcZstdDictionaryId()) != 0))
+				{
+					ripcHead[10] |= RIPC_COMP_ZSTD_DICT_BIT;
+					_move_u32_swap((ripcHead + 11), &rsslSocketChannel->zstdDictId);
+					compBitmapSize = RIPC_COMP_ZSTD_DICT_BITMAP_SIZE;
+				}
+
+				ripcHeaderSize = V10_MIN_CONN_HDR + compBitmapSize +
 					hostnameLen + addrLen + 2;
 				if (rsslSocketChannel->version->connVersion > CONN_VERSION_11)
 					++ripcHeaderSize;
 				ripcHead[8] = (char)ripcHeaderSize;
-				ripcHead[9] = RSSL_COMP_BITMAP_SIZE;
-				MemCopyByInt((ripcHead + 10), (char*)rsslSocketChannel->compressionBitmap, RSSL_COMP_BITMAP_SIZE);
+				ripcHead[9] = compBitmapSize;
 				/* set len to the next element for the variable portion */
-				len = 10 + RSSL_COMP_BITMAP_SIZE;
+				len = 10 + compBitmapSize;
 			}
 			/* add the ping interval in */
 			ripcHead[len++] = (RsslUInt8)rsslSocketChannel->pingTimeout;
@@ -7017,6 +7280,18 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 		}
 
 		/* set up compression */
+		if ((comp == RIPC_COMP_LZ4_STREAM) && (rsslSocketChannel->compressionBitmap[0] & RIPC_COMP_LZ4_STREAM_BIT))
+		{
+			comp = RSSL_COMP_LZ4;
+			rsslSocketChannel->lz4Stream = 1;
+		}
+
+		/* the server compresses zstd against the dictionary we offered, or as one stream */
+		if ((comp == RIPC_COMP_ZSTD_DICT) && rsslSocketChannel->zstdDictId)
+			comp = RSSL_COMP_ZSTD;
+		else
+			rsslSocketChannel->zstdDictId = 0;
+
 		if (comp > RSSL_COMP_MAX_TYPE)
 		{
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -7151,7 +7426,8 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			{
 				_DEBUG_TRACE_CONN("about to initialize decompression\n")
 
-				rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(0, error);
+				rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(
+						ipcCompInitArg(rsslSocketChannel, maxMsgSize + rsslSocketChannel->version->dataHeaderLen + RWS_MAX_HEADER_SIZE), error);
 				if (rsslSocketChannel->c_stream_in == 0)
 				{
 					_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -7162,7 +7438,8 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			if (rsslSocketChannel->outCompFuncs)
 			{
 				_DEBUG_TRACE_CONN("about to initialize compression\n")
-				rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(rsslSocketChannel->zlibCompLevel, 0, error);
+				rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(rsslSocketChannel->zlibCompLevel,
+						ipcCompInitArg(rsslSocketChannel, maxMsgSize + rsslSocketChannel->version->dataHeaderLen + RWS_MAX_HEADER_SIZE), error);
 				if (rsslSocketChannel->c_stream_out == 0)
 				{
 					_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -7298,7 +7575,10 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZLIB;
 				break;
 			case RSSL_COMP_LZ4:
-				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
+				rsslSocketChannel->lowerCompressionThreshold = (rsslSocketChannel->lz4Stream ? RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM : RSSL_COMP_DFLT_THRESHOLD_LZ4);
+				break;
+			case RSSL_COMP_ZSTD:
+				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
 				break;
 			default:
 				break;
@@ -7457,6 +7737,8 @@ RsslRet rsslSocketBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rssl
 	else
 		rsslServerSocketChannel->tcp_nodelay = 0;
 
+	rsslServerSocketChannel->io_uring = opts->tcpOpts.io_uring ? RSSL_TRUE : RSSL_FALSE;
+
 	if (opts->maxOutputBuffers < opts->guaranteedOutputBuffers)
 		rsslServerSocketChannel->maxNumMsgs = opts->guaranteedOutputBuffers;
 	else
@@ -7919,6 +8201,8 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 	else
 		rsslSocketChannel->tcp_nodelay = 0;
 
+	rsslSocketChannel->io_uring = opts->tcpOpts.io_uring ? 1 : 0;
+
 	rsslSocketChannel->numInputBufs = opts->numInputBuffers;
 
 	rsslSocketChannel->encryptionProtocolFlags = opts->encryptionOpts.encryptionProtocolFlags;
@@ -8226,6 +8510,10 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 		RsslInt16 idx = ripccompressions[rsslSocketChannel->compression][RSSL_COMP_BYTEINDEX];
 		if (idx < RSSL_COMP_BITMAP_SIZE)
 			rsslSocketChannel->compressionBitmap[idx] |= ripccompressions[rsslSocketChannel->compression][RSSL_COMP_BYTEBIT];
+
+		/* offer to compress LZ4 as a stream; older servers ignore this */
+		if (rsslSocketChannel->compression == RSSL_COMP_LZ4)
+			rsslSocketChannel->compressionBitmap[0] |= RIPC_COMP_LZ4_STREAM_BIT;
 	}
 
 	/* Set Proxy options, if present */
@@ -8604,6 +8892,7 @@ static RsslSocketChannel *ipcClientChannel(rsslServerImpl* serverImpl, RsslError
 
 	rsslSocketChannel->blocking = (rsslServerSocketChannel->session_blocking ? 1 : 0);
 	rsslSocketChannel->tcp_nodelay = (rsslServerSocketChannel->tcp_nodelay ? 1 : 0);
+	rsslSocketChannel->io_uring = (rsslServerSocketChannel->io_uring ? 1 : 0);
 	rsslSocketChannel->maxMsgSize = rsslServerSocketChannel->maxMsgSize;
 	rsslSocketChannel->maxUserMsgSize = rsslServerSocketChannel->maxUserMsgSize;
 	rsslSocketChannel->srvrcomp = rsslServerSocketChannel->compressionSupported;
@@ -8874,6 +9163,29 @@ RsslRet rsslSocketReconnect(rsslChannelImpl *rsslChnlImpl, RsslError *error)
 		return RSSL_RET_SUCCESS;
 }
 
+#ifdef RIPC_URING_SUPPORTED
+/* Moves the writes of a channel that asked for io_uring onto its ring, once the handshake is
+ * done. Reads stay on the socket, which stays RsslChannel::socketId. Channels that cannot
+ * use a ring keep using the socket; this is only tried once. */
+static void _rsslSocketStartUring(RsslSocketChannel *rsslSocketChannel)
+{
+	void *session;
+
+	rsslSocketChannel->io_uring = 0;
+
+	if (rsslSocketChannel->blocking || rsslSocketChannel->curlHandle || rsslSocketChannel->httpHeaders ||
+			rsslSocketChannel->transportFuncs != &transFuncs[RSSL_CONN_TYPE_SOCKET])
+		return;
+
+	if ((session = ipcUringNewSession(rsslSocketChannel->uringRing, rsslSocketChannel->stream)) == 0)
+		return;
+
+	/* stream stays the TCP socket, for socket options and channel info */
+	rsslSocketChannel->transportInfo = session;
+	rsslSocketChannel->transportFuncs = &uringTransFuncs;
+}
+#endif
+
 /* rssl Socket InitChannel function */
 RsslRet rsslSocketInitChannel(rsslChannelImpl* rsslChnlImpl, RsslInProgInfo *inProg, RsslError *error)
 {
@@ -8991,6 +9303,11 @@ RsslRet rsslSocketInitChannel(rsslChannelImpl* rsslChnlImpl, RsslInProgInfo *inP
 
 			/* set shared key */
 			rsslChnlImpl->shared_key = rsslSocketChannel->shared_key;
+
+#ifdef RIPC_URING_SUPPORTED
+			if (rsslSocketChannel->io_uring)
+				_rsslSocketStartUring(rsslSocketChannel);
+#endif
 			IPC_MUTEX_UNLOCK(rsslSocketChannel);
 
 			retVal = RSSL_RET_SUCCESS;
@@ -9061,6 +9378,27 @@ RsslRet rsslSocketCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error)
 }
 
 /* rssl Socket Read */
+/* Releases the input buffer region pinned by RSSL_READ_IN_PIN_BUFFER reads */
+static void _rsslSocketReleaseInputBufPins(RsslSocketChannel *rsslSocketChannel)
+{
+	rsslSocketChannel->inputBufPinEnd = 0;
+
+	if ((size_t)(rsslSocketChannel->inputBufCursor) == rsslSocketChannel->inputBuffer->length)
+	{
+		rsslSocketChannel->inputBuffer->length = 0;
+		rsslSocketChannel->inputBufCursor = 0;
+	}
+}
+
+/* Flags the returned buffer when it points into the pinned region of the input buffer */
+static void _rsslSocketSetPinnedReadOut(RsslSocketChannel *rsslSocketChannel, rsslChannelImpl *rsslChnlImpl, RsslReadOutArgs *readOutArgs)
+{
+	if (readOutArgs != NULL && rsslSocketChannel->inputBufPinEnd &&
+		rsslChnlImpl->returnBuffer.data >= rsslSocketChannel->inputBuffer->buffer &&
+		rsslChnlImpl->returnBuffer.data + rsslChnlImpl->returnBuffer.length <= rsslSocketChannel->inputBuffer->buffer + rsslSocketChannel->inputBufPinEnd)
+		readOutArgs->readOutFlags |= RSSL_READ_OUT_PINNED_BUFFER;
+}
+
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
 {
 	rtr_msgb_t     *ripcBuffer = 0;
@@ -9104,6 +9442,14 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 		rsslChnlImpl->returnBufferOwner = 0;
 	}
 
+	/* WebSocket and HTTP tunneling frame the input buffer differently, so only plain socket reads are pinned.
+	 * A read without RSSL_READ_IN_PIN_BUFFER releases what earlier reads pinned. */
+	rsslSocketChannel->pinInputBuf = ((rsslChnlImpl->readInFlags & RSSL_READ_IN_PIN_BUFFER) &&
+		!rsslSocketChannel->httpHeaders && !rsslSocketChannel->rwsSession) ? RSSL_TRUE : RSSL_FALSE;
+
+	if (!rsslSocketChannel->pinInputBuf && rsslSocketChannel->inputBufPinEnd)
+		_rsslSocketReleaseInputBufPins(rsslSocketChannel);
+
 	/* packed */
 	if ((rsslChnlImpl->packedBuffer))
 	{
@@ -9149,6 +9495,8 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 		if ((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_IN) && (rsslChnlImpl->returnBuffer.length))
 			(*(rsslSocketDumpInFunc))(__FUNCTION__, rsslChnlImpl->returnBuffer.data, rsslChnlImpl->returnBuffer.length, rsslChnlImpl->Channel.socketId);
 
+		_rsslSocketSetPinnedReadOut(rsslSocketChannel, rsslChnlImpl, readOutArgs);
+
 		return &(rsslChnlImpl->returnBuffer);
 	}
 
@@ -9420,7 +9768,10 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				(*(rsslSocketDumpInFunc))(__FUNCTION__, rsslChnlImpl->returnBuffer.data, rsslChnlImpl->returnBuffer.length, rsslChnlImpl->Channel.socketId);
 
 			if (!returnNull)
+			{
+				_rsslSocketSetPinnedReadOut(rsslSocketChannel, rsslChnlImpl, readOutArgs);
 				return &(rsslChnlImpl->returnBuffer);
+			}
 			else
 				return NULL;
 		}
@@ -9438,6 +9789,7 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 
 				if (!returnNull)
 				{
+					_rsslSocketSetPinnedReadOut(rsslSocketChannel, rsslChnlImpl, readOutArgs);
 					*readRet = RSSL_RET_SUCCESS;
 					return &(rsslChnlImpl->returnBuffer);
 				}
@@ -9498,6 +9850,17 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 				*readRet = 1;
 				return NULL;
 
+			case RSSL_RET_BUFFER_NO_BUFFERS:
+				/* the input buffer is full of pinned messages, the channel stays up */
+				if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+				{
+				  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+					_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
+				}
+				error->channel = &rsslChnlImpl->Channel;
+				*readRet = ipcReadRet;
+				return NULL;
+
 			case RSSL_RET_READ_WOULD_BLOCK:
 				if(readOutArgs != NULL)
 				{
@@ -9527,66 +9890,326 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 	return NULL;
 }
 
-/* rssl Socket Write */
-RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs,
-	RsslWriteOutArgs *writeOutArgs, RsslError *error)
+/* Sets the length of an unfragmented buffer to write, including everything packed into it */
+static void _rsslSocketSetWriteLength(rsslBufferImpl *rsslBufImpl, rtr_msgb_t *ripcBuffer)
 {
-	RsslInt32 retVal = RSSL_RET_FAILURE;
-	RsslUInt32 outBytes = 0;
-	RsslUInt32 uncompOutBytes = 0;
-	RsslUInt32 totalOutBytes = 0;
-	RsslUInt32 totalUncompOutBytes = 0;
-	RsslUInt32 writeFlags = writeInArgs->writeInFlags;
-	rtr_msgb_t	*ripcBuffer;
-	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+	/* packed case */
+	if (rsslBufImpl->packingOffset > 0)
+	{
+		RsslUInt16 bufLength;
 
-	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketWrite", "rsslSocketChannel", error))
-		return RSSL_RET_FAILURE;
+		/* if the length is zero, then there is no message at the end. */
+		/* We can take out the space we allocated for its length */
+		if (rsslBufImpl->buffer.length == 0)
+		{
+			rsslBufImpl->packingOffset -= 2;
+		}
+		else
+		{
+			bufLength = rsslBufImpl->buffer.length;
+			rwfPut16((ripcBuffer->buffer + rsslBufImpl->packingOffset - 2), bufLength);	/* fill in the length of the last message */
+			rsslBufImpl->packingOffset += rsslBufImpl->buffer.length;						/* advance the packing offset to include this last message */
+		}
+		ripcBuffer->length = rsslBufImpl->packingOffset;		/* the packing offset is the entire length of everything in the buffer we want to send */
+	}
+	else
+	{
+		/* standard case - buffer is within size bounds */
+		/* make sure rssl buffer matches ripcbuffer size */
+		ripcBuffer->length = rsslBufImpl->buffer.length;
+	}
 
-	// Set ripcBuffer to bufferInfo on rsslBufImpl.  When this changes, we will update rsslBufImpl->bufferInfo at the same time.
-	ripcBuffer = (rtr_msgb_t*)(rsslBufImpl->bufferInfo);
+	ripcBuffer->priority = rsslBufImpl->priority;
+}
 
+/* Moves written buffers from the active buffer list to the free buffer list */
+static void _rsslSocketFreeWrittenBuffers(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl **rsslBufImpls, RsslUInt32 bufferCount)
+{
+	RsslUInt32 i;
 
-	/* check if we are doing fragmentation */
-	if (ripcBuffer && (!(rsslBufImpl->fragmentationFlag)) && (rsslBufImpl->writeCursor == 0))
+	if (bufferCount == 0)
+		return;
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
 	{
-		/* no fragmentation */
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+		_DEBUG_MUTEX_TRACE("RSSL_MUTEX_LOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
+	}
 
-		/* packed case */
-		if (rsslBufImpl->packingOffset > 0)
-		{
-			RsslUInt16 bufLength;
+	for (i = 0; i < bufferCount; i++)
+	{
+		rsslBufferImpl *rsslBufImpl = rsslBufImpls[i];
 
-			/* if the length is zero, then there is no message at the end. */
-			/* We can take out the space we allocated for its length */
-			if (rsslBufImpl->buffer.length == 0)
-			{
-				rsslBufImpl->packingOffset -= 2;
-			}
-			else
-			{
-				bufLength = rsslBufImpl->buffer.length;
-				rwfPut16((ripcBuffer->buffer + rsslBufImpl->packingOffset - 2), bufLength);	/* fill in the length of the last message */
-				rsslBufImpl->packingOffset += rsslBufImpl->buffer.length;						/* advance the packing offset to include this last message */
-			}
-			ripcBuffer->length = rsslBufImpl->packingOffset;		/* the packing offset is the entire length of everything in the buffer we want to send */
+		/* first remove it from the list */
+		if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
+		{
+			rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
+			_DEBUG_TRACE_BUFFER("removing from activeBufferList\n")
 		}
-		else
+
+		if (rsslBufImpl->writeCursor > 0)
 		{
-			/* standard case - buffer is within size bounds */
-			/* make sure rssl buffer matches ripcbuffer size */
-			ripcBuffer->length = rsslBufImpl->buffer.length;
+			/* if we get here, the message has been written fully so reset writeCursor and fragId */
+			/* this means I allocated the data portion */
+			rsslBufImpl->writeCursor = 0;
+			rsslBufImpl->fragId = 0;
+			rsslBufImpl->owner = 0;
+			_rsslFree(rsslBufImpl->buffer.data);
+			rsslBufImpl->buffer.length = 0;
 		}
 
-		ripcBuffer->priority = rsslBufImpl->priority;
+		/* now add to free buffer list */
+		_rsslCleanBuffer(rsslBufImpl);
+		_DEBUG_TRACE_BUFFER("adding to freeBufferList\n")
 
-		/* Queue the buffer for writing */
-		retVal = ipcWriteSession(rsslSocketChannel, rsslBufImpl, writeFlags, (RsslInt32*)&outBytes, (RsslInt32*)&uncompOutBytes, (writeFlags & RSSL_WRITE_DIRECT_SOCKET_WRITE) != 0, error);
+		rsslInitQueueLink(&(rsslBufImpl->link1));
+		rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+	}
 
-		totalOutBytes += outBytes;
-		outBytes = 0;
-		totalUncompOutBytes += uncompOutBytes;
-		uncompOutBytes = 0;
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+		_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
+	}
+}
+
+/* A queued buffer was taken but the flush that followed failed; the channel is closed unless the socket would only block */
+static RsslRet _rsslSocketFlushFailed(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	if ((errno != EINTR) && (errno != EAGAIN) && (errno != _IPC_WOULD_BLOCK))
+	{
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		error->channel = &rsslChnlImpl->Channel;
+	}
+
+	return RSSL_RET_WRITE_FLUSH_FAILED;
+}
+
+/* Queues the open auto-packed buffer for writing, the caller holds the session mutex.
+ * Returns the number of bytes left to be written, RSSL_RET_WRITE_FLUSH_FAILED if the buffer was queued
+ * but the flush that followed failed, or RSSL_RET_FAILURE if the buffer could not be queued. */
+static RsslRet _rsslSocketQueueAutoPack(rsslChannelImpl *rsslChnlImpl, RsslInt32 *bytesWritten, RsslInt32 *uncompBytesWritten, RsslError *error)
+{
+	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+	rtr_msgb_t *packBuf = rsslSocketChannel->autoPackBuf;
+	rsslBufferImpl packBufImpl;
+	RsslRet retVal;
+
+	*bytesWritten = 0;
+	*uncompBytesWritten = 0;
+
+	if (packBuf == 0)
+		return RSSL_RET_SUCCESS;
+
+	/* every message waited from when it was added until now */
+	rsslSocketChannel->autoPackWaitUsec += rsslGetTimeMicro() * rsslSocketChannel->autoPackMsgs - rsslSocketChannel->autoPackAddTimeSum;
+	rsslSocketChannel->autoPackedMsgCount += rsslSocketChannel->autoPackMsgs;
+	rsslSocketChannel->autoPackedBufCount++;
+
+	rsslSocketChannel->autoPackBuf = 0;
+	rsslSocketChannel->autoPackMsgs = 0;
+	rsslSocketChannel->autoPackAddTimeSum = 0;
+
+	/* the buffer already holds each message behind its length, so it goes out as an ordinary packed buffer */
+	memset(&packBufImpl, 0, sizeof(rsslBufferImpl));
+	packBufImpl.bufferInfo = (void*)packBuf;
+	packBufImpl.buffer.data = packBuf->buffer;
+	packBufImpl.buffer.length = (RsslUInt32)packBuf->length;
+	packBufImpl.packingOffset = (RsslUInt32)packBuf->length;
+	packBufImpl.priority = rsslSocketChannel->autoPackPriority;
+	packBuf->priority = rsslSocketChannel->autoPackPriority;
+
+	retVal = ipcIntWriteSession(rsslSocketChannel, &packBufImpl, 0, bytesWritten, uncompBytesWritten, 0, RSSL_FALSE, error);
+
+	if (retVal == RSSL_RET_FAILURE)
+	{
+		if (packBufImpl.bufferInfo)
+		{
+			/* not queued, keep it so closing the channel frees it */
+			rsslSocketChannel->autoPackBuf = (rtr_msgb_t*)packBufImpl.bufferInfo;
+			return RSSL_RET_FAILURE;
+		}
+
+		return _rsslSocketFlushFailed(rsslChnlImpl, error);
+	}
+
+	return retVal;
+}
+
+/* Copies a small unfragmented message into the open auto-packed buffer, opening one if needed, and
+ * frees the user's buffer. The open buffer is queued first if the message does not fit, has another
+ * priority or the buffer is older than the auto-pack delay, and is queued after if it is now full.
+ * Returns RSSL_RET_BUFFER_NO_BUFFERS, having done nothing, if no buffer could be opened. */
+static RsslRet _rsslSocketAutoPackWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteOutArgs *writeOutArgs, RsslError *error)
+{
+	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+	RsslUInt32 msgLength = rsslBufImpl->buffer.length;
+	RsslTimeValue now = rsslGetTimeMicro();
+	rtr_msgb_t *packBuf;
+	RsslInt32 outBytes = 0;
+	RsslInt32 uncompOutBytes = 0;
+	RsslRet queueRet = RSSL_RET_SUCCESS;
+	RsslRet retVal;
+	int i;
+
+	IPC_MUTEX_LOCK(rsslSocketChannel);
+
+	if (((packBuf = rsslSocketChannel->autoPackBuf) != 0) &&
+		((rsslSocketChannel->autoPackPriority != rsslBufImpl->priority) ||
+		(packBuf->length + 2 + msgLength > packBuf->maxLength) ||
+		((rsslSocketChannel->autoPackDelay > 0) && (now - rsslSocketChannel->autoPackOpenTime >= rsslSocketChannel->autoPackDelay))))
+	{
+		queueRet = _rsslSocketQueueAutoPack(rsslChnlImpl, &outBytes, &uncompOutBytes, error);
+		writeOutArgs->bytesWritten += outBytes;
+		writeOutArgs->uncompressedBytesWritten += uncompOutBytes;
+	}
+
+	if (queueRet == RSSL_RET_FAILURE || rsslChnlImpl->Channel.state == RSSL_CH_STATE_CLOSED)
+	{
+		IPC_MUTEX_UNLOCK(rsslSocketChannel);
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		error->channel = &rsslChnlImpl->Channel;
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rsslSocketChannel->autoPackBuf == 0)
+	{
+		/* ipcDataBuffer takes the session mutex itself */
+		IPC_MUTEX_UNLOCK(rsslSocketChannel);
+		if ((packBuf = ipcDataBuffer(rsslSocketChannel, rsslSocketChannel->autoPackSize, error)) == 0)
+			return RSSL_RET_BUFFER_NO_BUFFERS;
+		IPC_MUTEX_LOCK(rsslSocketChannel);
+
+		/* another thread may have opened a buffer in the meantime */
+		if (rsslSocketChannel->autoPackBuf)
+		{
+			queueRet = _rsslSocketQueueAutoPack(rsslChnlImpl, &outBytes, &uncompOutBytes, error);
+			writeOutArgs->bytesWritten += outBytes;
+			writeOutArgs->uncompressedBytesWritten += uncompOutBytes;
+
+			if (queueRet == RSSL_RET_FAILURE)
+			{
+				/* that buffer stays open for closing the channel to free; this one was never used */
+				packBuf->buffer -= rsslSocketChannel->version->dataHeaderLen;
+				rtr_dfltcFreeMsg(packBuf);
+				IPC_MUTEX_UNLOCK(rsslSocketChannel);
+				rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+				error->channel = &rsslChnlImpl->Channel;
+				return RSSL_RET_FAILURE;
+			}
+		}
+
+		packBuf->length = 0;
+		rsslSocketChannel->autoPackBuf = packBuf;
+		rsslSocketChannel->autoPackPriority = rsslBufImpl->priority;
+		rsslSocketChannel->autoPackOpenTime = now;
+	}
+
+	packBuf = rsslSocketChannel->autoPackBuf;
+	rwfPut16((packBuf->buffer + packBuf->length), (RsslUInt16)msgLength);
+	MemCopyByInt(packBuf->buffer + packBuf->length + 2, rsslBufImpl->buffer.data, msgLength);
+	packBuf->length += 2 + msgLength;
+	rsslSocketChannel->autoPackMsgs++;
+	rsslSocketChannel->autoPackAddTimeSum += now;
+
+	/* send it once another small message would not fit */
+	if ((queueRet >= RSSL_RET_SUCCESS) && (packBuf->length + 3 > packBuf->maxLength))
+	{
+		queueRet = _rsslSocketQueueAutoPack(rsslChnlImpl, &outBytes, &uncompOutBytes, error);
+		writeOutArgs->bytesWritten += outBytes;
+		writeOutArgs->uncompressedBytesWritten += uncompOutBytes;
+	}
+
+	retVal = rsslSocketChannel->autoPackBuf ? (RsslRet)rsslSocketChannel->autoPackBuf->length : 0;
+	for (i = 0; i < RIPC_MAX_PRIORITY_QUEUE; i++)
+		retVal += rsslSocketChannel->priorityQueues[i].queueLength;
+
+	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+	if (queueRet == RSSL_RET_FAILURE)
+	{
+		/* the message is in the unqueued buffer, which is freed when the channel closes */
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		error->channel = &rsslChnlImpl->Channel;
+		return RSSL_RET_FAILURE;
+	}
+
+	/* the message was copied, so the user's buffer goes back to the pool */
+	rsslSocketReleaseBuffer(rsslChnlImpl, rsslBufImpl, error);
+	_rsslSocketFreeWrittenBuffers(rsslChnlImpl, &rsslBufImpl, 1);
+
+	return (queueRet == RSSL_RET_WRITE_FLUSH_FAILED) ? RSSL_RET_WRITE_FLUSH_FAILED : retVal;
+}
+
+/* rssl Socket Write */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs,
+	RsslWriteOutArgs *writeOutArgs, RsslError *error)
+{
+	RsslInt32 retVal = RSSL_RET_FAILURE;
+	RsslUInt32 outBytes = 0;
+	RsslUInt32 uncompOutBytes = 0;
+	RsslUInt32 totalOutBytes = 0;
+	RsslUInt32 totalUncompOutBytes = 0;
+	RsslUInt32 writeFlags = writeInArgs->writeInFlags;
+	rtr_msgb_t	*ripcBuffer;
+	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketWrite", "rsslSocketChannel", error))
+		return RSSL_RET_FAILURE;
+
+	// Set ripcBuffer to bufferInfo on rsslBufImpl.  When this changes, we will update rsslBufImpl->bufferInfo at the same time.
+	ripcBuffer = (rtr_msgb_t*)(rsslBufImpl->bufferInfo);
+
+	if (rsslSocketChannel->autoPackSize > 0)
+	{
+		/* small messages are copied into an auto-packed buffer */
+		if (ripcBuffer && !rsslBufImpl->fragmentationFlag && (rsslBufImpl->writeCursor == 0) && (rsslBufImpl->packingOffset == 0) &&
+			!(writeFlags & (RSSL_WRITE_DIRECT_SOCKET_WRITE | RSSL_WRITE_DO_NOT_COMPRESS)) &&
+			(rsslBufImpl->buffer.length + 2 <= rsslSocketChannel->autoPackSize))
+		{
+			writeOutArgs->bytesWritten = 0;
+			writeOutArgs->uncompressedBytesWritten = 0;
+			if ((retVal = _rsslSocketAutoPackWrite(rsslChnlImpl, rsslBufImpl, writeOutArgs, error)) != RSSL_RET_BUFFER_NO_BUFFERS)
+				return retVal;
+		}
+
+		/* anything else goes out after what is already packed */
+		if (rsslSocketChannel->autoPackBuf)
+		{
+			IPC_MUTEX_LOCK(rsslSocketChannel);
+			retVal = _rsslSocketQueueAutoPack(rsslChnlImpl, (RsslInt32*)&outBytes, (RsslInt32*)&uncompOutBytes, error);
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+			if (retVal == RSSL_RET_FAILURE)
+			{
+				rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+				error->channel = &rsslChnlImpl->Channel;
+				return RSSL_RET_FAILURE;
+			}
+
+			totalOutBytes += outBytes;
+			outBytes = 0;
+			totalUncompOutBytes += uncompOutBytes;
+			uncompOutBytes = 0;
+			retVal = RSSL_RET_FAILURE;
+		}
+	}
+
+
+	/* check if we are doing fragmentation */
+	if (ripcBuffer && (!(rsslBufImpl->fragmentationFlag)) && (rsslBufImpl->writeCursor == 0))
+	{
+		/* no fragmentation */
+
+		_rsslSocketSetWriteLength(rsslBufImpl, ripcBuffer);
+
+		/* Queue the buffer for writing */
+		retVal = ipcWriteSession(rsslSocketChannel, rsslBufImpl, writeFlags, (RsslInt32*)&outBytes, (RsslInt32*)&uncompOutBytes, (writeFlags & RSSL_WRITE_DIRECT_SOCKET_WRITE) != 0, error);
+
+		totalOutBytes += outBytes;
+		outBytes = 0;
+		totalUncompOutBytes += uncompOutBytes;
+		uncompOutBytes = 0;
 	}
 	else
 	{	/* fragmentation */
@@ -9750,58 +10373,140 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImp
 	{
 		/* if its a successful write ripc should have freed its buffer so we
 			should follow suit and free the RsslBuffer here */
-		/* first remove it from the list */
-		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-		{
-		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
-			_DEBUG_MUTEX_TRACE("RSSL_MUTEX_LOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-		}
-		if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
-		{
-			rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
-			_DEBUG_TRACE_BUFFER("removing from activeBufferList\n")
-		}
-		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
-		{
-		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-			_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
-		}
+		_rsslSocketFreeWrittenBuffers(rsslChnlImpl, &rsslBufImpl, 1);
 
-		if (rsslBufImpl->writeCursor > 0)
+		/* Write was either 0 or number of bytes left to be written */
+		/* if it was 0, we should have -2 returned which corresponds to a blocked socket */
+		writeOutArgs->bytesWritten = totalOutBytes;
+		writeOutArgs->uncompressedBytesWritten = totalUncompOutBytes;
+		/* retVal should be number of bytes left to be written */
+		return retVal;
+	}
+}
+
+/* rssl Socket Write Batch */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWriteBatch(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl **rsslBufImpls, RsslUInt32 bufferCount,
+	RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslUInt32 *buffersWritten, RsslError *error)
+{
+	RsslRet retVal = RSSL_RET_SUCCESS;
+	RsslUInt32 outBytes = 0;
+	RsslUInt32 uncompOutBytes = 0;
+	RsslUInt32 firstQueued;
+	RsslUInt32 i = 0;
+	RsslBool flushFailed = RSSL_FALSE;
+	rtr_msgb_t *ripcBuffer;
+	RsslWriteInArgs fragWriteInArgs;
+	RsslWriteOutArgs fragWriteOutArgs;
+	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketWriteBatch", "rsslSocketChannel", error))
+		return RSSL_RET_FAILURE;
+
+	/* the whole batch is flushed once at the end, so direct socket writes do not apply */
+	fragWriteInArgs = *writeInArgs;
+	fragWriteInArgs.writeInFlags &= ~RSSL_WRITE_DIRECT_SOCKET_WRITE;
+
+	/* batched buffers are not auto-packed, but they go out after what already is */
+	IPC_MUTEX_LOCK(rsslSocketChannel);
+	retVal = _rsslSocketQueueAutoPack(rsslChnlImpl, (RsslInt32*)&outBytes, (RsslInt32*)&uncompOutBytes, error);
+	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+	if (retVal == RSSL_RET_FAILURE)
+	{
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		error->channel = &rsslChnlImpl->Channel;
+		return RSSL_RET_FAILURE;
+	}
+
+	writeOutArgs->bytesWritten += outBytes;
+	writeOutArgs->uncompressedBytesWritten += uncompOutBytes;
+	retVal = RSSL_RET_SUCCESS;
+
+	while (i < bufferCount)
+	{
+		/* Queue the unfragmented buffers under one session lock, without checking the high water mark */
+		firstQueued = i;
+
+		IPC_MUTEX_LOCK(rsslSocketChannel);
+
+		for (; i < bufferCount; i++)
 		{
-			/* if we get here, the message has been written fully so reset writeCursor and fragId */
-			/* this means I allocated the data portion */
-			rsslBufImpl->writeCursor = 0;
-			rsslBufImpl->fragId = 0;
-			rsslBufImpl->owner = 0;
-			_rsslFree(rsslBufImpl->buffer.data);
-			rsslBufImpl->buffer.length = 0;
+			ripcBuffer = (rtr_msgb_t*)(rsslBufImpls[i]->bufferInfo);
+
+			if (!ripcBuffer || rsslBufImpls[i]->fragmentationFlag || rsslBufImpls[i]->writeCursor != 0)
+				break;
+
+			_rsslSocketSetWriteLength(rsslBufImpls[i], ripcBuffer);
+
+			retVal = ipcIntWriteSession(rsslSocketChannel, rsslBufImpls[i], fragWriteInArgs.writeInFlags, (RsslInt32*)&outBytes, (RsslInt32*)&uncompOutBytes, 0, RSSL_TRUE, error);
+
+			if (retVal == RSSL_RET_FAILURE)
+				break;
+
+			writeOutArgs->bytesWritten += outBytes;
+			writeOutArgs->uncompressedBytesWritten += uncompOutBytes;
 		}
 
-		/* now add to free buffer list */
-		_rsslCleanBuffer(rsslBufImpl);
-		_DEBUG_TRACE_BUFFER("adding to freeBufferList\n")
+		IPC_MUTEX_UNLOCK(rsslSocketChannel);
 
-		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		_rsslSocketFreeWrittenBuffers(rsslChnlImpl, rsslBufImpls + firstQueued, i - firstQueued);
+		*buffersWritten = i;
+
+		if (retVal == RSSL_RET_FAILURE)
 		{
-		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
-			_DEBUG_MUTEX_TRACE("RSSL_MUTEX_LOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
+			/* in this case the failed buffer is not freed, same as rsslSocketWrite */
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			error->channel = &rsslChnlImpl->Channel;
+			return RSSL_RET_FAILURE;
 		}
-		rsslInitQueueLink(&(rsslBufImpl->link1));
-		rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
-		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+
+		if (i == bufferCount)
+			break;
+
+		/* fragmented buffers are copied into chained messages by rsslSocketWrite */
+		fragWriteOutArgs.bytesWritten = 0;
+		fragWriteOutArgs.uncompressedBytesWritten = 0;
+
+		if ((retVal = rsslSocketWrite(rsslChnlImpl, rsslBufImpls[i], &fragWriteInArgs, &fragWriteOutArgs, error)) < RSSL_RET_SUCCESS)
 		{
-		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
-			_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
+			if (retVal != RSSL_RET_WRITE_FLUSH_FAILED)
+				return retVal;
+
+			/* The buffer was taken and only the flush failed, so the rest of the batch is still queued.
+			 * If the failure closed the channel, the remaining buffers are left with the caller instead. */
+			flushFailed = RSSL_TRUE;
+			if (rsslChnlImpl->Channel.state == RSSL_CH_STATE_CLOSED && i + 1 < bufferCount)
+			{
+				*buffersWritten = i + 1;
+				_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, errno);
+				snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWriteBatch() Error: 1002 Flush failed and closed the channel after %u of %u buffers were written.\n",
+					__FILE__, __LINE__, i + 1, bufferCount);
+				return RSSL_RET_FAILURE;
+			}
 		}
 
-		/* Write was either 0 or number of bytes left to be written */
-		/* if it was 0, we should have -2 returned which corresponds to a blocked socket */
-		writeOutArgs->bytesWritten = totalOutBytes;
-		writeOutArgs->uncompressedBytesWritten = totalUncompOutBytes;
-		/* retVal should be number of bytes left to be written */
-		return retVal;
+		writeOutArgs->bytesWritten += fragWriteOutArgs.bytesWritten;
+		writeOutArgs->uncompressedBytesWritten += fragWriteOutArgs.uncompressedBytesWritten;
+		*buffersWritten = ++i;
+	}
+
+	/* One flush for the whole batch */
+	IPC_MUTEX_LOCK(rsslSocketChannel);
+	retVal = ipcFlushSession(rsslSocketChannel, error);
+	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+	if (retVal < RSSL_RET_SUCCESS || (flushFailed && rsslChnlImpl->Channel.state == RSSL_CH_STATE_CLOSED))
+	{
+		/* the buffers were all taken, but the flush failed */
+		if ((errno != EINTR) && (errno != EAGAIN) && (errno != _IPC_WOULD_BLOCK))
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+
+		error->channel = &rsslChnlImpl->Channel;
+		return RSSL_RET_WRITE_FLUSH_FAILED;
 	}
+
+	/* retVal is the number of bytes left to be written */
+	return retVal;
 }
 
 /* rssl Socket GetBuffer */
@@ -9995,6 +10700,32 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketPackBuffer(rsslChannelImpl *rs
 	return (&(rsslBufImpl->buffer));
 }
 
+/* rssl Socket Release Read Buffers */
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketReleaseReadBuffers(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketReleaseReadBuffers", "rsslSocketChannel", error))
+		return RSSL_RET_FAILURE;
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+		(void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+		_DEBUG_MUTEX_TRACE("RSSL_MUTEX_LOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
+	}
+
+	if (rsslSocketChannel->inputBufPinEnd)
+		_rsslSocketReleaseInputBufPins(rsslSocketChannel);
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+		(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+		_DEBUG_MUTEX_TRACE("RSSL_MUTEX_UNLOCK", rsslChnlImpl, rsslChnlImpl->chanMutex)
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 /* rssl Socket Flush */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error)
 {
@@ -10005,6 +10736,21 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketFlush(rsslChannelImpl *rsslChnlImp
 		return RSSL_RET_FAILURE;
 
 	IPC_MUTEX_LOCK(rsslSocketChannel);
+
+	/* an auto-packed buffer goes out no later than the next flush */
+	if (rsslSocketChannel->autoPackBuf)
+	{
+		RsslInt32 outBytes, uncompOutBytes;
+
+		if (_rsslSocketQueueAutoPack(rsslChnlImpl, &outBytes, &uncompOutBytes, error) == RSSL_RET_FAILURE)
+		{
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			error->channel = &rsslChnlImpl->Channel;
+			return RSSL_RET_FAILURE;
+		}
+	}
+
 	retVal = ipcFlushSession(rsslSocketChannel, error);
 	IPC_MUTEX_UNLOCK(rsslSocketChannel);
 
@@ -10237,6 +10983,21 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketGetChannelStats(rsslChannelImpl *r
 		return RSSL_RET_FAILURE;
 	}
 
+	stats->tcpStats.flags |= RSSL_TCP_STATS_WRITE;
+	stats->tcpStats.writeCallCount = rsslSocketChannel->writeCallCount;
+	stats->tcpStats.autoPackedMsgCount = rsslSocketChannel->autoPackedMsgCount;
+	stats->tcpStats.autoPackedBufferCount = rsslSocketChannel->autoPackedBufCount;
+	stats->tcpStats.autoPackDelayUsec = rsslSocketChannel->autoPackWaitUsec;
+
+	stats->tcpStats.flags |= RSSL_TCP_STATS_PRIORITY_QUEUES;
+	for (i = 0; i < RIPC_MAX_PRIORITY_QUEUE; i++)
+	{
+		stats->tcpStats.priorityQueuedBytes[i] = rsslSocketChannel->priorityQueues[i].queueLength;
+		stats->tcpStats.priorityFlushedBufferCount[i] = rsslSocketChannel->flushedBufCount[i];
+		stats->tcpStats.priorityQueueDelayUsec[i] = rsslSocketChannel->queueDelayUsec[i];
+		stats->tcpStats.priorityMaxQueueDelayUsec[i] = rsslSocketChannel->maxQueueDelayUsec[i];
+	}
+
 #ifdef Linux
 	len = sizeof(struct tcp_info);
 	if (getsockopt(rsslSocketChannel->stream, IPPROTO_TCP, TCP_INFO, (char*)&value, &len) != 0)
@@ -10556,6 +11317,95 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 		}
 		break;
 
+	case RSSL_AUTO_PACK_SIZE:
+	case RSSL_AUTO_PACK_DELAY:
+		if (rsslSocketChannel->rwsSession)
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, auto-packing is not supported on WebSocket connections.\n",
+					__FILE__, __LINE__);
+
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		if (iValue < 0)
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, could not set the auto-pack %s to <%d>, must be a postive number.\n",
+					__FILE__, __LINE__, code == RSSL_AUTO_PACK_SIZE ? "size" : "delay", iValue);
+
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		/* the open buffer was sized and timed with the old values */
+		if (rsslSocketChannel->autoPackBuf)
+		{
+			RsslInt32 outBytes, uncompOutBytes;
+
+			if (_rsslSocketQueueAutoPack(rsslChnlImpl, &outBytes, &uncompOutBytes, error) == RSSL_RET_FAILURE)
+			{
+				IPC_MUTEX_UNLOCK(rsslSocketChannel);
+				return RSSL_RET_FAILURE;
+			}
+		}
+
+		if (code == RSSL_AUTO_PACK_SIZE)
+		{
+			/* a packed buffer cannot be larger than a message */
+			if ((RsslUInt32)iValue > rsslChnlImpl->maxMsgSize)
+				iValue = (RsslInt32)rsslChnlImpl->maxMsgSize;
+			rsslSocketChannel->autoPackSize = iValue;
+		}
+		else
+			rsslSocketChannel->autoPackDelay = iValue;
+		break;
+
+	case RSSL_IO_URING:
+		/* only used when the channel goes active, so it cannot change once it has */
+		if (rsslSocketChannel->intState == RIPC_INT_ST_ACTIVE)
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, the io_uring must be set before the channel is active.\n",
+					__FILE__, __LINE__);
+
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		rsslSocketChannel->uringRing = *(RsslIoUring**)value;
+		break;
+
+	case RSSL_PRIORITY_FLUSH_QUANTA:
+	{
+		RsslUInt32 *quanta = (RsslUInt32*)value;
+
+		/* all zeros goes back to the flush strategy; otherwise every queue needs a quantum */
+		if ((quanta[0] || quanta[1] || quanta[2]) && (!quanta[0] || !quanta[1] || !quanta[2]))
+		{
+			_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 rsslSocketIoctl() failed, could not set the flush quanta to <%u, %u, %u>, each must be a positive number, or all must be 0.\n",
+					__FILE__, __LINE__, quanta[0], quanta[1], quanta[2]);
+
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		for (i = 0; i < RIPC_MAX_PRIORITY_QUEUE; i++)
+		{
+			rsslSocketChannel->flushQuantum[i] = quanta[i];
+			rsslSocketChannel->flushDeficit[i] = 0;
+		}
+		rsslSocketChannel->drrCurrent = 0;
+		rsslSocketChannel->drrQuantumAdded = 0;
+	}
+		break;
+
 	case RSSL_SYSTEM_READ_BUFFERS:
 		opts.code = RIPC_SOPT_RD_BUF_SIZE;
 		opts.options.buffer_size = iValue;
@@ -10621,8 +11471,9 @@ RSSL_RSSL_SOCKET_FAST(RsslRet) rsslSocketIoctl(rsslChannelImpl *rsslChnlImpl, Rs
 	    if (rsslSocketChannel->outCompression == RSSL_COMP_NONE)
 		  break;
 
-		lowerThreshold = (rsslSocketChannel->outCompression == RSSL_COMP_ZLIB ?
-									RSSL_COMP_DFLT_THRESHOLD_ZLIB : RSSL_COMP_DFLT_THRESHOLD_LZ4);
+		lowerThreshold = (rsslSocketChannel->outCompression == RSSL_COMP_LZ4 ?
+									(rsslSocketChannel->lz4Stream ? RSSL_COMP_DFLT_THRESHOLD_LZ4_STREAM : RSSL_COMP_DFLT_THRESHOLD_LZ4) :
+									rsslSocketChannel->outCompression == RSSL_COMP_ZSTD ? RSSL_COMP_DFLT_THRESHOLD_ZSTD : RSSL_COMP_DFLT_THRESHOLD_ZLIB);
 		if(iValue >= lowerThreshold)
 			rsslSocketChannel->lowerCompressionThreshold = iValue;
 		else
@@ -10953,6 +11804,11 @@ RsslInt32 ipcInitialize(RsslInt32 numServers, RsslInt32 numClients, RsslInitiali
 
 		ipcSetSockFuncs();
 
+#ifdef RIPC_URING_SUPPORTED
+		uringTransFuncs = transFuncs[RSSL_CONN_TYPE_SOCKET];
+		ipcSetUringFuncs(&uringTransFuncs);
+#endif
+
 		for (i = 0; i <= RSSL_COMP_MAX_TYPE; i++)
 		{
 			compressFuncs[i].compressInit = 0;
@@ -10965,6 +11821,7 @@ RsslInt32 ipcInitialize(RsslInt32 numServers, RsslInt32 numClients, RsslInitiali
 
 		ripcInitZlibComp();
 		ripcInitLz4Comp();
+		ripcInitZstdComp();
 
 		/* initialize open SSL library */
 		/* Copy the ssl and crypto lib name config */
@@ -11211,6 +12068,8 @@ RsslInt32 ipcCleanup()
 
 		rssl_socket_shutdown();
 
+		ripcUninitZstdComp();
+
 		initialized = 0;
 
 		/* kill/cleanup threads - they should do this themselves when initialized is changed */
@@ -11332,7 +12191,9 @@ RsslRet rsslSocketSetChannelFunctions()
 	funcs.channelRead = rsslSocketRead;
 	funcs.channelReconnect = rsslSocketReconnect;
 	funcs.channelReleaseBuffer = rsslSocketReleaseBuffer;
+	funcs.channelReleaseReadBuffers = rsslSocketReleaseReadBuffers;
 	funcs.channelWrite = rsslSocketWrite;
+	funcs.channelWriteBatch = rsslSocketWriteBatch;
 	funcs.initChannel = rsslSocketInitChannel;
 
 	return(rsslSetTransportChannelFunc(RSSL_SOCKET_TRANSPORT,&funcs));
@@ -11356,7 +12217,9 @@ RsslRet rsslWebSocketSetChannelFunctions()
 	funcs.channelRead = rsslWebSocketRead;
 	funcs.channelReconnect = rsslSocketReconnect;
 	funcs.channelReleaseBuffer = rsslSocketReleaseBuffer;
+	funcs.channelReleaseReadBuffers = 0;
 	funcs.channelWrite = rsslWebSocketWrite;
+	funcs.channelWriteBatch = 0;
 	funcs.initChannel = rsslSocketInitChannel;
 
 	return(rsslSetTransportChannelFunc(RSSL_WEBSOCKET_TRANSPORT,&funcs));
@@ -11795,6 +12658,13 @@ RSSL_RSSL_SOCKET_IMPL_FAST(void) ripcRelSocketChannel(RsslSocketChannel *rsslSoc
 			}
 		}
 
+		if (rsslSocketChannel->autoPackBuf)
+		{
+			rsslSocketChannel->autoPackBuf->buffer -= rsslSocketChannel->version->dataHeaderLen;
+			rtr_dfltcFreeMsg(rsslSocketChannel->autoPackBuf);
+			rsslSocketChannel->autoPackBuf = 0;
+		}
+
 		rtr_dfltcDropRef(&(rsslSocketChannel->guarBufPool->bufpool));
 		rsslSocketChannel->guarBufPool = 0;
 	}
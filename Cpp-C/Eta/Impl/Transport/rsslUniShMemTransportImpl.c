@@ -111,6 +111,8 @@ RsslRet rsslUniShMemBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rs
 
 	shMemOpts.maxBufSize = opts->maxFragmentSize;
 	shMemOpts.userSpecPtr = opts->userSpecPtr;
+	shMemOpts.variableLengthRing = opts->shmemOpts.variableLengthRing;
+	shMemOpts.futexWakeup = opts->shmemOpts.futexWakeup;
 
 	/* Now create shared memory segment */
 	/* do shared memory segment creation */
@@ -603,7 +605,7 @@ RSSL_RSSL_UNIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslUniShMemWrite(rsslChannelImp
 	}
 	shmBuffer->length = rsslBufImpl->buffer.length;
 
-	rtrShmTransServerWrite(channelShMemServer);
+	rtrShmTransServerWrite(channelShMemServer, shmBuffer);
 
 	writeOutArgs->bytesWritten = shmBuffer->length;
 	writeOutArgs->uncompressedBytesWritten = shmBuffer->length;
@@ -707,7 +709,7 @@ RSSL_RSSL_UNIDIRECTION_SHMEM_IMPL_FAST(rsslBufferImpl*) rsslUniShMemGetBuffer(rs
 		return NULL;
 	}
 
-	shmBuffer = rtrShmTransGetFreeBuffer(channelShMemServer);
+	shmBuffer = rtrShmTransGetFreeBuffer(channelShMemServer, size);
 
 	/* successful - now allocate rsslbuffer */
 	rsslBufImpl = _rsslUniShMemNewBuffer(rsslChnlImpl);
@@ -782,10 +784,10 @@ RSSL_RSSL_UNIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslUniShMemPing(rsslChannelImpl
 		return RSSL_RET_FAILURE;
 	}
 
-	shmBuffer = rtrShmTransGetFreeBuffer(channelShMemServer);
+	shmBuffer = rtrShmTransGetFreeBuffer(channelShMemServer, 0);
 	shmBuffer->flags = RSSL_SHMBUF_PING;
 	shmBuffer->length = 0;
-	rtrShmTransServerWrite(channelShMemServer);
+	rtrShmTransServerWrite(channelShMemServer, shmBuffer);
 			
 	return RSSL_RET_SUCCESS;
 }
@@ -981,7 +983,9 @@ RsslRet rsslUniShMemSetChannelFunctions()
 	funcs.channelRead = rsslUniShMemRead;
 	funcs.channelReconnect = rsslUniShMemReconnect;
 	funcs.channelReleaseBuffer = rsslUniShMemReleaseBuffer;
+	funcs.channelReleaseReadBuffers = 0;
 	funcs.channelWrite = rsslUniShMemWrite;
+	funcs.channelWriteBatch = 0;
 	funcs.initChannel = rsslUniShMemInitChannel;
 	
 	return(rsslSetTransportChannelFunc(RSSL_UNIDIRECTION_SHMEM_TRANSPORT,&funcs));
@@ -178,6 +178,21 @@ static const u32 _conn_version_14	=	CONN_VERSION_14;
 /* Current number of bytes in the compression bitmap */
 #define RSSL_COMP_BITMAP_SIZE 1
 
+/* Set in the connect request bitmap, along with the LZ4 bit, by clients that can also decompress an LZ4 stream.
+ * Servers that support it send RIPC_COMP_LZ4_STREAM as the compression type in the connect ack.
+ * Older servers ignore the bit and use per-message LZ4, and older clients never set it. */
+#define RIPC_COMP_LZ4_STREAM_BIT 0x08
+#define RIPC_COMP_LZ4_STREAM 0x0102
+
+/* Set in the connect request bitmap, along with the zstd bit, by clients that have a compression dictionary.
+ * The 4 byte id of the dictionary follows the first bitmap byte, so the bitmap is RIPC_COMP_ZSTD_DICT_BITMAP_SIZE long.
+ * A server with a dictionary of the same id sends RIPC_COMP_ZSTD_DICT as the compression type in the connect ack,
+ * and both sides compress each message against the dictionary.  Otherwise it sends RSSL_COMP_ZSTD and both sides
+ * compress one stream without the dictionary. */
+#define RIPC_COMP_ZSTD_DICT_BIT 0x10
+#define RIPC_COMP_ZSTD_DICT 0x0104
+#define RIPC_COMP_ZSTD_DICT_BITMAP_SIZE (RSSL_COMP_BITMAP_SIZE + 4)
+
 
 #define IPC_100_OTHER_HEADER_SIZE	8	/* Non Data opcode header size */
 #define IPC_100_CONN_ACK		    10	
@@ -97,8 +97,8 @@ typedef struct {
 	RsslUInt64	shared_key;  /* used for encryption/decryption - 0 when not available */
 } RIPC_SOCKET;
 
-#define RSSL_COMP_ALL_TYPE ((unsigned)RSSL_COMP_ZLIB | (unsigned)RSSL_COMP_LZ4)
-#define RSSL_COMP_MAX_TYPE 0x02		/* set to the highest ripcCompressType enum value */
+#define RSSL_COMP_ALL_TYPE ((unsigned)RSSL_COMP_ZLIB | (unsigned)RSSL_COMP_LZ4 | (unsigned)RSSL_COMP_ZSTD)
+#define RSSL_COMP_MAX_TYPE 0x04		/* set to the highest ripcCompressType enum value */
 #define ZLIB_COMP_MAX_LEVEL 9
 #define ZLIB_COMP_MIN_LEVEL 0
 
@@ -0,0 +1,74 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __ripcuring_h
+#define __ripcuring_h
+
+/* io_uring based socket writes for active, non-blocking socket and WebSocket channels.
+ *
+ * A channel's writes are copied into a send buffer registered with a ring, and nothing
+ * goes to the kernel until the ring is submitted. Channels given a shared ring with
+ * RSSL_IO_URING (one per Reactor) send everything written since the last submit in one
+ * io_uring_enter; other channels get a ring of their own, submitted on each write.
+ *
+ * Each channel has at most one send outstanding, and refuses more data until it
+ * completes, so the channel's own socket stays the descriptor to select on: it is
+ * writable only when the send has room to go. Reads are plain socket reads.
+ */
+
+#if defined(LINUX) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#if defined(IORING_RECVSEND_FIXED_BUF) && defined(IORING_RSRC_REGISTER_SPARSE)
+#define RIPC_URING_SUPPORTED
+#endif
+#endif
+#endif
+
+#ifdef RIPC_URING_SUPPORTED
+
+#include "rtr/rsslSocketTransportImpl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Fills in the io_uring read, write and shutdown functions. The rest of funcs
+ * should already hold the socket transport's functions. */
+extern void ipcSetUringFuncs(ripcTransportFuncs *funcs);
+
+/* Sets up a ring that channels can share. Returns 0 if the kernel cannot provide one. */
+extern RsslIoUring *ipcUringNewRing();
+
+/* Frees the ring once the last channel using it is closed */
+extern void ipcUringFreeRing(RsslIoUring *ring);
+
+/* Sends everything written to the ring's channels since the last submit, in one system
+ * call. Returns the number of sends started, or -1 if the kernel refused them. */
+extern int ipcUringSubmit(RsslIoUring *ring);
+
+/* Moves a connected, non-blocking socket's writes onto ring, or onto a ring of its own
+ * if ring is 0. Returns the session to use as the channel's transportInfo, or 0 if the
+ * kernel cannot provide one, in which case the socket is left as it was. */
+extern void *ipcUringNewSession(RsslIoUring *ring, RsslSocket fd);
+
+extern int ipcUringRead(void *transport, char *buf, int max_len, ripcRWFlags flags, RsslError *error);
+
+extern int ipcUringWrite(void *transport, char *buf, int outLen, ripcRWFlags flags, RsslError *error);
+
+extern int ipcUringWriteV(void *transport, ripcIovType *iov, int iovcnt, int outLen, ripcRWFlags flags, RsslError *error);
+
+extern int ipcUringShutdown(void *transport);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
+
+#endif
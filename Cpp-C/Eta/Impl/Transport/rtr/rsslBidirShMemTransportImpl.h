@@ -0,0 +1,209 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RTR_RSSL_BIDIRECTION_SHMEM_TRANSPORT_IMPL_H
+#define __RTR_RSSL_BIDIRECTION_SHMEM_TRANSPORT_IMPL_H
+
+/* Contains function declarations necessary for the
+ * bidirectional shared memory connection type.
+ *
+ * Each accepted connection gets its own shared memory segment holding two flow controlled
+ * rings, one per direction. A Unix domain socket connects the two processes: it carries the
+ * handshake, gives both sides a descriptor to select on, wakes a reader that found its ring
+ * empty, and reports the other side going away.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslChanManagement.h"
+#include "rtr/shmemtrans.h"
+#include <stdio.h>
+
+#define 	RSSL_BIDIRECTION_SHMEM_IMPL_FAST(ret)		ret RTR_FASTCALL
+
+#define RSSL_BIDIR_SHM_MAGIC			0x42534D31	/* "BSM1" */
+#define RSSL_BIDIR_SHM_VERSION			1
+
+/* rsslBidirShmMsgHdr.flags, along with RSSL_SHMBUF_PING */
+#define RSSL_BIDIR_SHM_FRAGMENT			0x10	/* more of the message follows in the next record */
+
+/* rsslBidirShmCtrl.closed */
+#define RSSL_BIDIR_SHM_SERVER_CLOSED	0x01
+#define RSSL_BIDIR_SHM_CLIENT_CLOSED	0x02
+
+/* Start of each connection's segment, followed by the two rings */
+typedef struct
+{
+	RsslUInt32			magic;
+	RsslUInt32			version;
+	RsslUInt32			maxMsgSize;			/* largest message either side may write */
+	RsslUInt32			pingTimeout;
+	RsslUInt32			majorVersion;
+	RsslUInt32			minorVersion;
+	RsslUInt32			protocolType;
+	volatile RsslUInt32	closed;				/* RSSL_BIDIR_SHM_SERVER_CLOSED, RSSL_BIDIR_SHM_CLIENT_CLOSED */
+	RTR_SHM_OFFSET		toClient;			/* ring written by the server */
+	RTR_SHM_OFFSET		toServer;			/* ring written by the client */
+	RsslUInt8			serverComponentVersionLen;
+	char				serverComponentVersion[RSSL_SHM_COMPONENT_VERSION_SIZE];
+	RsslUInt8			clientComponentVersionLen;
+	char				clientComponentVersion[RSSL_SHM_COMPONENT_VERSION_SIZE];
+} rsslBidirShmCtrl;
+
+/* Sent by the server over the socket once the segment is ready */
+typedef struct
+{
+	RsslUInt32			magic;
+	RsslUInt32			version;
+	char				segKey[SHMKEY_SIZE];
+} rsslBidirShmHandshake;
+
+/* Start of every message in the rings */
+typedef struct
+{
+	RsslUInt32			length;
+	RsslUInt32			flags;				/* RSSL_SHMBUF_PING, RSSL_BIDIR_SHM_FRAGMENT */
+} rsslBidirShmMsgHdr;
+
+/* An output buffer. Written messages are copied into the ring, or queued until it has room.
+ * Messages larger than maxMsgSize get a block of their own and go into the ring in pieces. */
+typedef struct rsslBidirShmBlock
+{
+	struct rsslBidirShmBlock	*next;
+	RsslUInt32					capacity;
+	RsslUInt32					length;
+	RsslUInt32					sent;			/* bytes already copied into the ring */
+	RsslUInt32					flags;
+	char						data[1];
+} rsslBidirShmBlock;
+
+/* Channel handshake progress */
+typedef enum
+{
+	RSSL_BIDIR_SHM_WAIT_HANDSHAKE = 0,	/* client: waiting for the segment key */
+	RSSL_BIDIR_SHM_WAIT_ACK = 1,		/* server: waiting for the client to attach */
+	RSSL_BIDIR_SHM_ACTIVE = 2
+} rsslBidirShmInitState;
+
+/* Not in shared memory - one per channel */
+typedef struct
+{
+	rtrShmSeg				shMemSeg;
+	RsslSocket				fd;
+	RsslBool				isServer;
+	RsslBool				blocking;
+	rsslBidirShmInitState	initState;
+	rsslBidirShmHandshake	handshake;
+	RsslUInt32				handshakeLen;		/* bytes of the handshake received so far */
+	rsslBidirShmCtrl		*ctrl;
+	rtrShmByteRing			*outRing;
+	rtrShmByteRing			*inRing;
+	rtrShmByteRingReader	inReader;			/* only readPos and readOffset are used */
+	RsslUInt32				peerClosedFlag;		/* the other side's RSSL_BIDIR_SHM_*_CLOSED flag */
+	RsslUInt32				maxMsgSize;
+	rsslBidirShmBlock		*freeBlocks;
+	RsslUInt32				numBlocks;			/* output buffers allocated */
+	RsslUInt32				maxBlocks;			/* output buffers allowed */
+	RsslUInt32				blocksInUse;		/* output buffers held by the application or queued */
+	RsslUInt32				peakBlocksInUse;
+	rsslBidirShmBlock		*pendingHead;		/* written messages waiting for room in the ring */
+	rsslBidirShmBlock		*pendingTail;
+	RsslUInt32				pendingBytes;
+	char					*fragBuf;			/* reassembles messages that arrive in pieces */
+	RsslUInt32				fragBufSize;
+	RsslUInt32				fragLen;
+} rsslBidirShMemChannel;
+
+/* Not in shared memory - one per server */
+typedef struct
+{
+	RsslSocket			fd;
+	char				shMemKey[SHMKEY_SIZE];
+	RsslUInt32			connectionCount;		/* makes each connection's segment key unique */
+	RsslUInt32			maxMsgSize;
+	RsslUInt32			numOutputBuffers;		/* sizes the ring to the client */
+	RsslUInt32			maxOutputBuffers;
+	RsslUInt32			numInputBuffers;		/* sizes the ring to the server */
+	RsslUInt32			pingTimeout;
+	RsslUInt32			majorVersion;
+	RsslUInt32			minorVersion;
+	RsslUInt32			protocolType;
+	RsslBool			serverToClientPings;
+	RsslBool			clientToServerPings;
+	RsslBool			channelsBlocking;
+} rsslBidirShMemServer;
+
+/* Contains code necessary for binding a Unix domain socket that accepts shared memory connections */
+RsslRet rsslBidirShMemBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, RsslError *error );
+
+/* Contains code necessary for accepting an inbound connection and creating its shared memory segment */
+rsslChannelImpl* rsslBidirShMemAccept(rsslServerImpl *rsslSrvrImpl, RsslAcceptOptions *opts, RsslError *error);
+
+/* Contains code necessary for connecting to a bidirectional shared memory server */
+RsslRet rsslBidirShMemConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opts, RsslError *error);
+
+/* Contains code necessary to reconnect shmem connections and bridge data flow (no-op) */
+RsslRet rsslBidirShMemReconnect(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to exchange the segment key and attach to the segment (client or server side) */
+RsslRet rsslBidirShMemInitChannel(rsslChannelImpl* rsslChnlImpl, RsslInProgInfo *inProg, RsslError *error);
+
+/* Contains code necessary to disconnect from the segment (client or server side) */
+RsslRet rsslBidirShMemCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to read the next message from the inbound ring */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBidirShMemRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error);
+
+/* Contains code necessary to write a message to the outbound ring */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error);
+
+/* Contains code necessary to move queued messages into the outbound ring */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to obtain an output buffer */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(rsslBufferImpl*) rsslBidirShMemGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error);
+
+/* Contains code necessary to release an unused/unsuccessfully written output buffer */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemReleaseBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error);
+
+/* Contains code necessary to query number of used output buffers */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBidirShMemBufferUsage(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to query number of used buffers by the server (no shared pool) */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBidirShMemSrvrBufferUsage(rsslServerImpl *rsslSrvrImpl, RsslError *error);
+
+/* Contains code necessary for buffer packing (not supported) */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBidirShMemPackBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error);
+
+/* Contains code necessary to send a ping message */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemPing(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to query the channel for more detailed connection info */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemGetChannelInfo(rsslChannelImpl *rsslChnlImpl, RsslChannelInfo *info, RsslError *error);
+
+/* Contains code necessary to query the server for more detailed info */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemGetSrvrInfo(rsslServerImpl *rsslSrvrImpl, RsslServerInfo *info, RsslError *error);
+
+/* Contains code necessary to do an ioctl on a channel (no-op) */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemIoctl(rsslChannelImpl *rsslChnlImpl, RsslIoctlCodes code, void *value, RsslError *error);
+
+/* Contains code necessary to do an ioctl on a server (no-op) */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemSrvrIoctl(rsslServerImpl *rsslSrvrImpl, RsslIoctlCodes code, void *value, RsslError *error);
+
+/* Contains code necessary to close the server's socket */
+RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBidirShMemCloseServer(rsslServerImpl *rsslSrvrImpl, RsslError *error);
+
+#ifdef __cplusplus
+};
+#endif
+
+
+#endif
@@ -37,7 +37,8 @@ typedef struct RsslTransServerFuncs RsslTransServerFuncs;
 #define RSSL_RRCP_TRANSPORT 2
 #define RSSL_SEQ_MCAST_TRANSPORT 3
 #define RSSL_WEBSOCKET_TRANSPORT   4
-#define RSSL_MAX_TRANSPORTS     RSSL_WEBSOCKET_TRANSPORT + 1
+#define RSSL_BIDIRECTION_SHMEM_TRANSPORT  5
+#define RSSL_MAX_TRANSPORTS     RSSL_BIDIRECTION_SHMEM_TRANSPORT + 1
 
 /* used for all connection types to control locking */
 extern RsslLockingTypes multiThread;  /* 0 == No Locking; 1 == All locking; 2 == Only global locking */
@@ -90,6 +91,7 @@ typedef struct {
 	rtr_msgb_t		*packedBuffer;		/* used to keep track of packed buffer if present */
 	int				returnBufferOwner;	/* 1 if I own return buffer, 0 if not */
 	RsslBuffer		returnBuffer;		/* this is used as the return buffer */
+	RsslUInt32		readInFlags;		/* RsslReadFlagsIn of the read in progress */
 	void*			transportClientInfo;		
 	void*			transportServerInfo;	/* This variable keeps pointer to a server of specific transrpot type*/
 	RsslHashTable 		assemblyBuffers;		/* hash table of assembly buffers */
@@ -226,6 +228,8 @@ typedef struct RsslTransChannelFuncs {
 	RsslBuffer*  (RTR_FASTCALL *channelRead)( rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error );
 	/* Writes to the transport */
 	RsslRet     (RTR_FASTCALL *channelWrite)( rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error );
+	/* Writes an array of buffers to the transport, flushing once */
+	RsslRet     (RTR_FASTCALL *channelWriteBatch)( rsslChannelImpl *rsslChnlImpl, rsslBufferImpl **rsslBufImpls, RsslUInt32 bufferCount, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslUInt32 *buffersWritten, RsslError *error );
 	/* Flush data written to transport */
 	RsslRet   (RTR_FASTCALL *channelFlush)( rsslChannelImpl *rsslChnlImpl, RsslError *error );					
 	/* Gets buffer used for writing to transport */
@@ -244,6 +248,8 @@ typedef struct RsslTransChannelFuncs {
 	RsslRet(RTR_FASTCALL *channelGetStats)(rsslChannelImpl *rsslChnlImpl, RsslChannelStats *info, RsslError *error);
 	/* Allows for changing channel options */
 	RsslRet  (RTR_FASTCALL *channelIoctl)( rsslChannelImpl *rsslChnlImpl, RsslIoctlCodes code, void *value, RsslError *error );
+	/* Releases read buffers pinned with RSSL_READ_IN_PIN_BUFFER, 0 if the transport does not pin */
+	RsslRet  (RTR_FASTCALL *channelReleaseReadBuffers)( rsslChannelImpl *rsslChnlImpl, RsslError *error );
 } RsslTransportChannelFuncs;
 
 
@@ -395,6 +401,7 @@ RTR_C_ALWAYS_INLINE void _rsslCleanChan(rsslChannelImpl *chnl)
 	chnl->returnBuffer.data = 0;
 	chnl->returnBuffer.length = 0;
 	chnl->returnBufferOwner = 0;
+	chnl->readInFlags = RSSL_READ_IN_NO_FLAGS;
 
 	/* set this to the typical value.  If ripc allows for more (e.g. greater than conn version 13) it will be increased when we connect */
 	chnl->fragIdMax = 255;
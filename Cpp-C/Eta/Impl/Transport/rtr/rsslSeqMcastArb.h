@@ -0,0 +1,62 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RTR_SEQ_MCAST_ARB_H
+#define __RTR_SEQ_MCAST_ARB_H
+
+/* Arbitration between the A and B lines of a sequenced multicast channel.
+ *
+ * Both lines carry the same publisher's datagrams. The first copy of each sequence number
+ * read from either line is delivered, and later copies are dropped. The arbiter only sees
+ * sequence numbers, so it can be driven without sockets.
+ */
+
+#include "rtr/rsslTransport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of sequence numbers, counting back from the highest one delivered, that arbitration
+ * remembers. A copy of an older sequence number is dropped, unless its line has restarted. */
+#define RSSL_SEQ_MCAST_ARB_WINDOW 64
+
+typedef struct
+{
+	RsslBool				seqStarted;
+	RsslUInt32				lastSeqNum;			/* Highest sequence number read on this line */
+	RsslUInt32				restartCount;		/* Number of times this line's sequence started over */
+	RsslSeqMcastLineStats	stats;
+} RsslSeqMcastArbLine;
+
+typedef struct
+{
+	RsslSeqMcastArbLine		lines[RSSL_SEQ_MCAST_MAX_LINES];
+	RsslBool				started;
+	RsslUInt32				restartCount;		/* Highest restartCount of the lines */
+	RsslUInt32				highestSeqNum;		/* Highest sequence number delivered */
+	RsslUInt64				delivered;			/* Bit n is set if highestSeqNum - n was delivered */
+	RsslUInt32				span;				/* Number of bits of delivered that stand for sequence numbers read since the start */
+	RsslUInt64				gaps;				/* Sequence numbers that neither line delivered */
+} RsslSeqMcastArb;
+
+/* Starts arbitration over, and clears the statistics */
+void rsslSeqMcastArbClear(RsslSeqMcastArb *pArb);
+
+/* Decides whether a data datagram with seqNum, read from line lineIndex, is delivered.
+ * Returns RSSL_FALSE for a copy of a sequence number that was already delivered, or that is too
+ * old to tell. Sequence numbers leaving the window without being delivered are counted as gaps.
+ * When the publisher starts over, the first line to show it restarts arbitration, and the other
+ * line's datagrams are dropped until it shows the restart too. */
+RsslBool rsslSeqMcastArbitrate(RsslSeqMcastArb *pArb, RsslUInt32 lineIndex, RsslUInt32 seqNum);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -31,6 +31,7 @@ extern "C" {
 #include "rtr/application_signing.h"
 #include "rtr/cutilsmplcbuffer.h"
 #include "rtr/rsslQueue.h"
+#include "rtr/rsslGetTime.h"
 #include "rtr/debugPrint.h"
 #include <stdio.h>
 #include "curl/curl.h"
@@ -302,6 +303,7 @@ typedef struct {
 	RsslBool	server_blocking;	/* Perform server blocking operations */
 	RsslBool	session_blocking;	/* Perform session blocking operations */
 	RsslBool	tcp_nodelay;		/* Disable Nagle Algorithm */
+	RsslBool	io_uring;			/* Move accepted channels' writes onto an io_uring once active */
 	RsslInt32	connType;			/* Controls the connection type */
 	RsslUInt32	rsslFlags;			/* this flag keeps track of client to server and server to client ping*/
 	RsslUInt8	pingTimeout; 		/* ping timeout */
@@ -409,6 +411,8 @@ typedef struct
 	char				*curlOptProxyDomain;	/* domain used for tunneling connection */
 	RsslBool			blocking : 1;			/* Perform blocking operations */
 	RsslBool			tcp_nodelay : 1;		/* Disable Nagle Algorithm */
+	RsslBool			io_uring : 1;			/* Move socket writes onto an io_uring once active */
+	RsslIoUring			*uringRing;				/* ring shared with other channels (RSSL_IO_URING), or 0 for one of its own */
 	RsslUInt32			compression;			/* Use compression defined by server, otherwise none */
 	RsslUInt32			numConnections;			/* Number of concurrent connections for an extended line connection */
 	RsslUInt32			numGuarOutputBufs;		/* Number of guaranteed output buffers */
@@ -464,6 +468,20 @@ typedef struct
 	RsslUInt32			upperCompressionThreshold;			/* dont compress any buffers larger than this */
 	RsslUInt32			high_water_mark;		/* used for the upper buffer usage threshold for this channel */
 	RsslUInt32			safeLZ4 : 1;			/* limits LZ4 compression to only packets that wont span multiple buffers */
+	RsslUInt32			lz4Stream : 1;			/* LZ4 compresses each direction as one stream, so messages can reference earlier ones */
+	RsslUInt32			zstdDictId;				/* id of the dictionary zstd compresses against, or 0 to compress one stream */
+
+	RsslUInt32			autoPackSize;			/* size of auto-packed buffers; 0 means rsslWrite does not auto-pack */
+	RsslUInt32			autoPackDelay;			/* longest time, in microseconds, a message may wait in autoPackBuf */
+	rtr_msgb_t			*autoPackBuf;			/* the open auto-packed buffer, if any */
+	RsslUInt8			autoPackPriority;		/* write priority of the messages in autoPackBuf */
+	RsslUInt32			autoPackMsgs;			/* number of messages in autoPackBuf */
+	RsslTimeValue		autoPackOpenTime;		/* when the first message was added to autoPackBuf */
+	RsslTimeValue		autoPackAddTimeSum;		/* sum of the times each message was added to autoPackBuf */
+	RsslUInt64			writeCallCount;			/* number of socket write calls */
+	RsslUInt64			autoPackedMsgCount;		/* number of messages sent in auto-packed buffers */
+	RsslUInt64			autoPackedBufCount;		/* number of auto-packed buffers sent */
+	RsslUInt64			autoPackWaitUsec;		/* total time auto-packed messages waited for their buffer to be sent */
 
 	ripcTransportFuncs	*transportFuncs; /* The transport functions to use */
 
@@ -484,6 +502,13 @@ typedef struct
 												to avoid potential zlib dictionary issues, we keep track of the first
 												queue compression was done on and only allow it on that queue */
 	RsslInt8			nextOutBuf;		/* used to keep track of next out buffer in case of partial write */
+	RsslUInt32			flushQuantum[RIPC_MAX_PRIORITY_QUEUE];	/* deficit round robin byte quanta; all 0 uses flushStrategy instead */
+	RsslInt64			flushDeficit[RIPC_MAX_PRIORITY_QUEUE];	/* bytes each queue may still send in the current round */
+	RsslInt8			drrCurrent;			/* queue the deficit round robin is visiting */
+	RsslInt8			drrQuantumAdded;	/* drrCurrent has had its quantum added for this visit */
+	RsslUInt64			flushedBufCount[RIPC_MAX_PRIORITY_QUEUE];	/* number of queued buffers flushed */
+	RsslUInt64			queueDelayUsec[RIPC_MAX_PRIORITY_QUEUE];	/* total time flushed buffers waited in their queue */
+	RsslUInt64			maxQueueDelayUsec[RIPC_MAX_PRIORITY_QUEUE];	/* longest time a flushed buffer waited in its queue */
 
 	rtr_msgb_t			*decompressBuf;		/* decompress buffer */
 	rtr_msgb_t			*tempDecompressBuf;	/* temporary buffer to use when decompressing with compression types that dont effectively handle data growth (LZ4) */
@@ -495,6 +520,8 @@ typedef struct
 	rtr_msgb_t			*curInputBuf;
 	RsslUInt32			inputBufCursor;
 	RsslUInt32			inBufProtOffset;    /* # of bytes in the inputBuffer related to the WebSocket protocol header length total */
+	RsslUInt32			inputBufPinEnd;		/* end of the inputBuffer region holding messages pinned by RSSL_READ_IN_PIN_BUFFER reads, 0 if none */
+	RsslBool			pinInputBuf;		/* set while reading for an RSSL_READ_IN_PIN_BUFFER read */
 	RsslInt32			readSize;
 	RsslUInt32			bytesOutLastMsg;	/* # of bytes in the last sent message */
 	RIPC_SESS_VERS		*version;			/* Session version information */
@@ -549,6 +576,8 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 
 	rsslSocketChannel->mutex = 0;
 	rsslSocketChannel->blocking = 0;
+	rsslSocketChannel->io_uring = 0;
+	rsslSocketChannel->uringRing = 0;
 	rsslSocketChannel->mountNak = 0;
 	rsslSocketChannel->inDecompress = 0;
 	rsslSocketChannel->outCompression = (RsslCompTypes)0;
@@ -567,6 +596,19 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	rsslSocketChannel->upperCompressionThreshold = 10000000;
 	rsslSocketChannel->high_water_mark = 6000;
 	rsslSocketChannel->safeLZ4 = 0;
+	rsslSocketChannel->lz4Stream = 0;
+	rsslSocketChannel->zstdDictId = 0;
+	rsslSocketChannel->autoPackSize = 0;
+	rsslSocketChannel->autoPackDelay = 0;
+	rsslSocketChannel->autoPackBuf = 0;
+	rsslSocketChannel->autoPackPriority = 0;
+	rsslSocketChannel->autoPackMsgs = 0;
+	rsslSocketChannel->autoPackOpenTime = 0;
+	rsslSocketChannel->autoPackAddTimeSum = 0;
+	rsslSocketChannel->writeCallCount = 0;
+	rsslSocketChannel->autoPackedMsgCount = 0;
+	rsslSocketChannel->autoPackedBufCount = 0;
+	rsslSocketChannel->autoPackWaitUsec = 0;
 	rsslSocketChannel->keyExchange = 0;
 	rsslSocketChannel->transportFuncs = 0; 
 	rsslSocketChannel->protocolFuncs = 0; 
@@ -586,7 +628,14 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	{
 		rsslInitQueue(&rsslSocketChannel->priorityQueues[i].priorityQueue);
 		rsslSocketChannel->priorityQueues[i].queueLength = 0;
+		rsslSocketChannel->flushQuantum[i] = 0;
+		rsslSocketChannel->flushDeficit[i] = 0;
+		rsslSocketChannel->flushedBufCount[i] = 0;
+		rsslSocketChannel->queueDelayUsec[i] = 0;
+		rsslSocketChannel->maxQueueDelayUsec[i] = 0;
 	}
+	rsslSocketChannel->drrCurrent = 0;
+	rsslSocketChannel->drrQuantumAdded = 0;
 
 	rsslSocketChannel->flushStrategy[0] = 0;
 	rsslSocketChannel->flushStrategy[1] = 1;
@@ -625,6 +674,8 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	rsslSocketChannel->inputBuffer = 0;
 	rsslSocketChannel->inputBufCursor = 0;
 	rsslSocketChannel->inBufProtOffset = 0;
+	rsslSocketChannel->inputBufPinEnd = 0;
+	rsslSocketChannel->pinInputBuf = RSSL_FALSE;
 	rsslSocketChannel->curInputBuf = 0;
 	rsslSocketChannel->readSize = 0;
 	rsslSocketChannel->bytesOutLastMsg = 0;
@@ -677,6 +728,13 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 #endif
 }
 
+/* When a buffer joins a priority queue. Queueing delay is only measured while flush quanta are
+ * set, so the write path does not read the clock otherwise; 0 means the buffer is not measured. */
+RTR_C_INLINE RsslUInt64 ipcQueueTime(RsslSocketChannel *rsslSocketChannel)
+{
+	return rsslSocketChannel->flushQuantum[0] ? rsslGetTimeMicro() : 0;
+}
+
 
 RSSL_RSSL_SOCKET_IMPL_FAST(void) ripcRelSocketChannel(RsslSocketChannel *rsslSocketChannel);
 
@@ -706,9 +764,11 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslBuffer*) rsslSocketRead(rsslChannelImpl* rsslChnl
 
 /* Contains code necessary to write/queue data going to a socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error);
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWriteBatch(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl **rsslBufImpls, RsslUInt32 bufferCount, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslUInt32 *buffersWritten, RsslError *error);
 
 /* Contains code necessary to flush queued data to socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketReleaseReadBuffers(rsslChannelImpl *rsslChnlImpl, RsslError *error);
 
 /* Contains code necessary to obtain a buffer to put data in for writing to socket connection (client or server side) */
 RSSL_RSSL_SOCKET_IMPL_FAST(rsslBufferImpl*) rsslSocketGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error);
@@ -808,6 +868,10 @@ extern RsslRet ipcShutdownServer(RsslServerSocketChannel* socket, RsslError *err
 extern RsslRet ipcSrvrDropRef(RsslServerSocketChannel *rsslServerSocketChannel, RsslError *error);
 extern void ipcCloseActiveSrvr(RsslServerSocketChannel *rsslServerSocketChannel);
 
+// Sets the dictionary used by Zstandard compression and gets its id (0 when none is set), implemented in ripccomp.c
+RsslRet ripcSetZstdDictionary(RsslBuffer *pDictionary, RsslError *error);
+RsslUInt32 ripcZstdDictionaryId();
+
 // Contains code necessary to set the debug func pointers for Socket transport
 RsslRet rsslSetSocketDebugFunctions(
 	void(*dumpIpcIn)(const char *functionName, char *buffer, RsslUInt32 length, RsslUInt64 opaque), 
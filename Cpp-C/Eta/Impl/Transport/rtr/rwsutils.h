@@ -28,6 +28,10 @@
 	#endif
 #endif
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*
  *       0                   1                   2                   3
  *       0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
@@ -443,6 +447,19 @@ RsslInt32 rwsSendWsPing( RsslSocketChannel *, RsslBuffer *, RsslError *);
 RsslInt32 rwsSendWsPong(RsslSocketChannel *, RsslBuffer *, RsslError *);
 RsslInt32 rwsSendWsClose(RsslSocketChannel *, rwsCFStatusCodes_t, RsslError *);
 
+/* WebSocket payload masking kernels, widest one the CPU supports is picked on first use */
+typedef enum {
+	RWS_MASK_KERNEL_SCALAR	= 0,	/* 8 byte lanes */
+	RWS_MASK_KERNEL_SSE2	= 1,	/* 16 byte lanes */
+	RWS_MASK_KERNEL_AVX2	= 2		/* 32 byte lanes */
+} rwsMaskKernel_t;
+
+/* XORs length bytes of ptrBuf with the 4 byte mask key */
+RSSL_API void rwsMaskDataBlock(char *mask, char *ptrBuf, RsslUInt64 length);
+/* Returns RSSL_RET_FAILURE if the kernel is not supported by this build or CPU */
+RSSL_API RsslRet rwsSetMaskKernel(rwsMaskKernel_t kernel);
+RSSL_API rwsMaskKernel_t rwsGetMaskKernel();
+
 RsslInt32 URLdecode(char *, RsslInt32 , char *);
 RsslInt32 getIntValue(RsslInt32 *, RsslInt32 , char *);
 
@@ -551,5 +568,9 @@ RTR_C_INLINE RsslRet rwsInitialize()
 	return (ipcSetTransFunc(RSSL_CONN_TYPE_WEBSOCKET, &rwsFuncs));
 }
 
+#ifdef __cplusplus
+};
+#endif
+
 #endif  /* __rwsutils_h */
 
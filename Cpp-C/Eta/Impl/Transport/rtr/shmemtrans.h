@@ -72,6 +72,7 @@ typedef struct
 	rtr_atomic_val64*	seqNumServer;	// server sequence number, 32 bit platform does not do native atomic 64 load/store */
 #endif
 	rtrShmCirBuf*		circularBufferServer;
+	rtrShmByteRing*		byteRing;		// variable-length ring, replaces the buffers of circularBufferServer when set
 } rtrShmTransServer;
 
 
@@ -89,6 +90,12 @@ typedef struct
 #define RSSL_SHM_SERVER_PING_ENABLED	0x01
 #define RSSL_SHM_SERVER_SHUTDOWN		0x02	// the server has shutdown and destroyed the shmem segment
 #define RSSL_SHM_SERVER_INITIALIZED		0x04	// the shmem segment is ready to accept connections 
+#define RSSL_SHM_SERVER_FUTEX_WAKEUP	0x08	// the server wakes blocking readers through a futex on the byte ring
+
+#define RSSL_SHM_VERSION				1		// shmem segment with one maxBufSize buffer per message
+#define RSSL_SHM_VERSION_BYTE_RING		2		// shmem segment with a variable-length ring
+#define RSSL_SHM_FUTEX_SPIN_COUNT		1000	// empty reads a blocking reader polls before it sleeps
+#define RSSL_SHM_FUTEX_WAIT_USEC		100000	// longest a blocking reader sleeps before checking the channel again
 
 typedef struct
 {
@@ -108,6 +115,9 @@ typedef struct
 	rtrShmCirBuf*		circularBufferServer;
 	rtrShmBuffer*		readBuffer;				// not stored in shared memory - pointer to last read buffer
 	rtrShmCirBuf		circularBufferClient;	// not stored in shared memory
+	rtrShmByteRing*		byteRing;				// variable-length ring, if the server created one
+	rtrShmByteRingReader ringReader;			// not stored in shared memory - our position in byteRing
+	RsslUInt64			seqNumBatch;			/* not stored in shared memory - server sequence number when the last batch was read */
 	RsslUInt64			seqNumClient;			/* not stored in shared memory - client sequence number */
 	RsslUInt64			readRetries;			/* the number of consecutive times the reader recevied nothing from a read attempt */
 	RsslUInt64			maxReaderRetryThreshhold;/* maximum number of read retries before the client waits for a notification */
@@ -140,6 +150,8 @@ typedef struct
 	void		   *userSpecPtr;  
 	RsslBool		serverBlocking;			/*!< If RSSL_TRUE, the server will be allowed to block. */
 	RsslBool		channelsBlocking;		/*!< If RSSL_TRUE, the channels will be allowed to block. */
+	RsslBool		variableLengthRing;		/*!< If RSSL_TRUE, messages take only their written length in a byte ring. */
+	RsslBool		futexWakeup;			/*!< If RSSL_TRUE, the server wakes blocking readers of the byte ring through a futex. */
 } rtrShmCreateOpts;
 
 typedef struct
@@ -172,8 +184,16 @@ rtrShmBuffer* rtrShmTransClientRead(rtrShmTransClient *trans, RsslChannel *chnl,
 	/* Retrieve an empty output buffer. */
 
 /* server uses to get a buffer to write into */
-RTR_C_ALWAYS_INLINE rtrShmBuffer* rtrShmTransGetFreeBuffer(rtrShmTransServer *trans)
+RTR_C_ALWAYS_INLINE rtrShmBuffer* rtrShmTransGetFreeBuffer(rtrShmTransServer *trans, RsslUInt32 size)
 {
+	rtrShmBuffer *shmBuffer;
+
+	if (trans->byteRing)
+	{
+		shmBuffer = (rtrShmBuffer*)RTRShmByteRingGetWriteBuf(trans->byteRing, &trans->shMemSeg, (rtrUInt32)(sizeof(rtrShmBuffer) + size));
+		shmBuffer->maxLength = (RsslUInt16)size;
+		return shmBuffer;
+	}
 	return (rtrShmBuffer*)RTRShmCirBufGetWriteBuf(trans->circularBufferServer, &trans->shMemSeg);
 }
 
@@ -206,7 +226,7 @@ RTR_C_ALWAYS_INLINE rtr_atomic_val64 _rsslInterExch64(volatile rtr_atomic_val64
 #endif
 
 /* server uses to write to each client */
-RTR_C_ALWAYS_INLINE void rtrShmTransServerWrite(rtrShmTransServer *trans)
+RTR_C_ALWAYS_INLINE void rtrShmTransServerWrite(rtrShmTransServer *trans, rtrShmBuffer *shmBuffer)
 {
 	RTR_SHTRANS_LOCK(trans->userLock);
 #if defined (COMPILE_64BITS)
@@ -214,8 +234,14 @@ RTR_C_ALWAYS_INLINE void rtrShmTransServerWrite(rtrShmTransServer *trans)
 #else
 	RTR_ATOMIC_INCREMENT64(*trans->seqNumServer);
 #endif
-	RTRShmCirBufWritten(trans->circularBufferServer);
+	if (trans->byteRing)
+		RTRShmByteRingWritten(trans->byteRing, &trans->shMemSeg, (rtrUInt32)(sizeof(rtrShmBuffer) + shmBuffer->length));
+	else
+		RTRShmCirBufWritten(trans->circularBufferServer);
 	RTR_SHTRANS_UNLOCK(trans->userLock);
+
+	if (rtrUnlikely(*trans->flags & RSSL_SHM_SERVER_FUTEX_WAKEUP))
+		RTRShmByteRingNotify(trans->byteRing);
 //	printf("seqNumServer = %llu writeoffset = %llu\n", *trans->seqNumServer, trans->circularBufferServer->write);
 	return;
 }
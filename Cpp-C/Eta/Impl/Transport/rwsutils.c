@@ -7,12 +7,31 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "rtr/tr_sha_1.h"
 
 #include "rtr/ripc_int.h"
 #include "rtr/rwsutils.h"
 
+/* SSE2 is always there on x64; AVX2 is compiled in when the compiler can target it per function and
+ * is only used after checking the CPU at run time */
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__x86_64__) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RWS_MASK_SSE2
+#include <emmintrin.h>
+
+#if defined(_MSC_VER) && _MSC_VER >= 1700
+#define RWS_MASK_AVX2
+#define RWS_MASK_AVX2_FUNC
+#include <immintrin.h>
+#include <intrin.h>
+#elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define RWS_MASK_AVX2
+#define RWS_MASK_AVX2_FUNC __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+#endif
+
 /* Per RFC7230 & RFC6455, The WebSocket HTTP header fields and values are parsed with
  * the following definitions */
 /*token = 1*tchar (tchar - token characters)
@@ -407,16 +426,140 @@ static RsslUInt32 _getMaskKey(char *mask, char *buffer)
 	return mVal;
 }
 
-static void _maskDataBlock(char *mask, char *ptrBuf, RsslUInt64 length)
+/* Masking kernels. Byte i of the payload is XORed with mask[i%4]; every kernel works in lanes that are
+ * a multiple of 4 bytes so the key stays in phase, and hands the remainder to the next smaller lane. */
+static void _maskDataBlockScalar(char *mask, char *ptrBuf, RsslUInt64 length)
 {
-	RsslUInt64 i;
+	RsslUInt32 mask32;
+	RsslUInt64 mask64, word, i = 0;
+
+	memcpy(&mask32, mask, 4);
+	mask64 = ((RsslUInt64)mask32 << 32) | mask32;
+
+	for (; i + 8 <= length; i += 8)
+	{
+		memcpy(&word, ptrBuf + i, 8);
+		word ^= mask64;
+		memcpy(ptrBuf + i, &word, 8);
+	}
+
+	for (; i < length; i++)
+		ptrBuf[i] ^= mask[i % 4];
 
-	for (i = 0 ; i < length; i++, ptrBuf++)
-		*ptrBuf = *ptrBuf ^ mask[i%4];
-	
 	return;
 }
 
+#ifdef RWS_MASK_SSE2
+static void _maskDataBlockSSE2(char *mask, char *ptrBuf, RsslUInt64 length)
+{
+	RsslUInt32 mask32;
+	__m128i mask128;
+	RsslUInt64 i = 0;
+
+	memcpy(&mask32, mask, 4);
+	mask128 = _mm_set1_epi32((int)mask32);
+
+	for (; i + 16 <= length; i += 16)
+		_mm_storeu_si128((__m128i*)(ptrBuf + i), _mm_xor_si128(_mm_loadu_si128((const __m128i*)(ptrBuf + i)), mask128));
+
+	_maskDataBlockScalar(mask, ptrBuf + i, length - i);
+
+	return;
+}
+#endif
+
+#ifdef RWS_MASK_AVX2
+static RWS_MASK_AVX2_FUNC void _maskDataBlockAVX2(char *mask, char *ptrBuf, RsslUInt64 length)
+{
+	RsslUInt32 mask32;
+	__m256i mask256;
+	RsslUInt64 i = 0;
+
+	memcpy(&mask32, mask, 4);
+	mask256 = _mm256_set1_epi32((int)mask32);
+
+	for (; i + 32 <= length; i += 32)
+		_mm256_storeu_si256((__m256i*)(ptrBuf + i), _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(ptrBuf + i)), mask256));
+
+	_maskDataBlockSSE2(mask, ptrBuf + i, length - i);
+
+	return;
+}
+
+static RsslBool _cpuSupportsAVX2()
+{
+#ifdef _MSC_VER
+	int info[4];
+
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return RSSL_FALSE;
+
+	/* The OS must save the YMM registers (OSXSAVE, AVX and XCR0 bits 1 and 2) */
+	__cpuid(info, 1);
+	if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+		return RSSL_FALSE;
+
+	__cpuidex(info, 7, 0);
+	return ((info[1] & (1 << 5)) != 0 ? RSSL_TRUE : RSSL_FALSE);
+#else
+	__builtin_cpu_init();
+	return (__builtin_cpu_supports("avx2") ? RSSL_TRUE : RSSL_FALSE);
+#endif
+}
+#endif
+
+static void (*_maskDataBlockFunc)(char *, char *, RsslUInt64) = 0;
+static rwsMaskKernel_t _maskKernel = RWS_MASK_KERNEL_SCALAR;
+
+RsslRet rwsSetMaskKernel(rwsMaskKernel_t kernel)
+{
+	switch (kernel)
+	{
+		case RWS_MASK_KERNEL_SCALAR:
+			_maskDataBlockFunc = _maskDataBlockScalar;
+			break;
+#ifdef RWS_MASK_SSE2
+		case RWS_MASK_KERNEL_SSE2:
+			_maskDataBlockFunc = _maskDataBlockSSE2;
+			break;
+#endif
+#ifdef RWS_MASK_AVX2
+		case RWS_MASK_KERNEL_AVX2:
+			if (!_cpuSupportsAVX2())
+				return RSSL_RET_FAILURE;
+			_maskDataBlockFunc = _maskDataBlockAVX2;
+			break;
+#endif
+		default:
+			return RSSL_RET_FAILURE;
+	}
+
+	_maskKernel = kernel;
+	return RSSL_RET_SUCCESS;
+}
+
+rwsMaskKernel_t rwsGetMaskKernel()
+{
+	if (!_maskDataBlockFunc)
+	{
+		/* Picks the widest kernel this CPU runs; racing threads all pick the same one */
+		if (rwsSetMaskKernel(RWS_MASK_KERNEL_AVX2) != RSSL_RET_SUCCESS &&
+			rwsSetMaskKernel(RWS_MASK_KERNEL_SSE2) != RSSL_RET_SUCCESS)
+			rwsSetMaskKernel(RWS_MASK_KERNEL_SCALAR);
+	}
+
+	return _maskKernel;
+}
+
+void rwsMaskDataBlock(char *mask, char *ptrBuf, RsslUInt64 length)
+{
+	if (!_maskDataBlockFunc)
+		rwsGetMaskKernel();
+
+	_maskDataBlockFunc(mask, ptrBuf, length);
+}
+
 static int _addNewHeaderLine(rwsHttpHdr_t *httpHdr)
 {
 	headerLine_t *hdrLn;
@@ -2802,7 +2945,7 @@ RsslRet rwsProcessWsOpCodes(RsslSocketChannel	*rsslSocketChannel, RsslError *err
 					frame->cursor,
 					frame->hdrLen,
 					frame->payloadLen)
-					_maskDataBlock(frame->mask, frame->payload, frame->payloadLen);
+					rwsMaskDataBlock(frame->mask, frame->payload, frame->payloadLen);
 			}
 			_DEBUG_TRACE_WS_FRAME(((char*)frame->pCtlHdr))
 
@@ -3707,7 +3850,7 @@ RsslInt32 rwsReadWsConnMsg(void *transport, char *buf, int bufLen, ripcRWFlags r
 		if (frame->maskSet && bytesRead >= frame->payloadLen)
 		{
 			_DEBUG_TRACE_WS_READ(" Unmasking %d byte payload of %d bytes read\n", frame->payloadLen, bytesRead)
-			_maskDataBlock(frame->mask, buf, frame->payloadLen);
+			rwsMaskDataBlock(frame->mask, buf, frame->payloadLen);
 		}
 	}
 	return bytesRead;
@@ -3899,7 +4042,7 @@ RsslInt32 rwsReadTransportMsg(void *transport, char * buffer, int bufferLen, rip
 																		frame->cursor,
 																		frame->hdrLen,
 																		frame->payloadLen)
-				_maskDataBlock(frame->mask, frame->payload, frame->payloadLen);
+				rwsMaskDataBlock(frame->mask, frame->payload, frame->payloadLen);
 			}
 			_DEBUG_TRACE_WS_FRAME(((char*)frame->pCtlHdr))
 
@@ -4509,6 +4652,7 @@ RsslInt32 rwsWriteAndFlush(RsslSocketChannel *rsslSocketChannel, rtr_msgb_t *msg
 			/* figure out which priority list to put this in */
 			_DEBUG_TRACE_WS_WRITE("#2 Queuing %u bytes (forceFlush=%u, queueLength=%u)\n", msgb->length, *forceFlush, rsslSocketChannel->priorityQueues[msgb->priority].queueLength)
 
+			msgb->queueTime = ipcQueueTime(rsslSocketChannel);
 			rsslQueueAddLinkToBack(&(rsslSocketChannel->priorityQueues[msgb->priority].priorityQueue), &(msgb->link));
 			rsslSocketChannel->bytesOutLastMsg += (RsslUInt32)(msgb->length);
 		}
@@ -4621,7 +4765,7 @@ RsslUInt8 rwsWriteWsHdrBuffer(char * buffer, RsslUInt64 dataLen, rwsSession_t *w
 
 		memset (mask, 0, 4);
 		_setMaskKeyBuff(mask, maskVal);
-		_maskDataBlock(mask, (ptrHdr + hdrLen), dataLen); 	
+		rwsMaskDataBlock(mask, (ptrHdr + hdrLen), dataLen); 	
 	}
 	_DEBUG_TRACE_WS_FRAME(ptrHdr)
 
@@ -38,6 +38,12 @@ rtrShmTransServer *rtrShmTransCreate(rtrShmCreateOpts *createOpts, RsslError *er
 							 RTR_SHM_ALIGNBYTES(sizeof(rtrInt64)) +												/* seqNumServer */
 							 RTR_SHM_ALIGNBYTES(sizeof(rtrShmCirBuf)));											/* circularBufferServer */
 
+	if (createOpts->variableLengthRing)
+		segSize += (rtrUInt32)(RTR_SHM_ALIGNBYTES(sizeof(rtrShmByteRing) + RTR_SHM_CACHE_LINE_SIZE) +			/* byteRing, aligned to a cache line */
+							   RTRShmByteRingSize(createOpts->numBuffers, bufSize));
+	else
+		segSize += bufSize * createOpts->numBuffers;
+
 	trans = (rtrShmTransServer*)_rsslMalloc(sizeof(rtrShmTransServer));
 
 	if (!trans)
@@ -117,10 +123,10 @@ rtrShmTransServer *rtrShmTransCreate(rtrShmCreateOpts *createOpts, RsslError *er
 	/* the control mutex is used for segment control (attach/create/destroy) */
 	rtrWaitForMutex(trans->controlMutex);
 
-	if (rtrShmSegCreate(&trans->shMemSeg,createOpts->shMemKey,segSize + (bufSize * createOpts->numBuffers), errBuff) < 0)
+	if (rtrShmSegCreate(&trans->shMemSeg,createOpts->shMemKey,segSize, errBuff) < 0)
 	{
 		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
-		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rtrShmTransCreate unable to create shared memory segment with key %s and size %d (%s).\n", __FILE__, __LINE__, createOpts->shMemKey, (segSize + (bufSize * createOpts->numBuffers)), errBuff);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rtrShmTransCreate unable to create shared memory segment with key %s and size %d (%s).\n", __FILE__, __LINE__, createOpts->shMemKey, segSize, errBuff);
 		rssl_pipe_close(&trans->_bindPipe);
 		rtrReleaseMutex(trans->controlMutex);
 		free(trans);
@@ -146,8 +152,13 @@ rtrShmTransServer *rtrShmTransCreate(rtrShmCreateOpts *createOpts, RsslError *er
 	trans->userLock = (rtrSpinLock*)rtrShmBytesReserve( &trans->shMemSeg, RTR_SHM_ALIGNBYTES(sizeof(rtrSpinLock)));		/* spinlock is 4 bytes on windows and linux */
 	trans->seqNumServer = (RsslUInt64*)rtrShmBytesReserve(&trans->shMemSeg, sizeof(rtrInt64));
 	trans->circularBufferServer = (rtrShmCirBuf*)rtrShmBytesReserve( &trans->shMemSeg, sizeof(rtrShmCirBuf) );
+	if (createOpts->variableLengthRing)
+		trans->byteRing = RTRShmByteRingAlign(rtrShmBytesReserve( &trans->shMemSeg, sizeof(rtrShmByteRing) + RTR_SHM_CACHE_LINE_SIZE ));
+	else
+		trans->byteRing = 0;
 
-	*trans->shmemVersion = 1;	/* the version of this transport */
+	/* the version of this transport. Readers that only know version 1 refuse the byte ring */
+	*trans->shmemVersion = (trans->byteRing ? RSSL_SHM_VERSION_BYTE_RING : RSSL_SHM_VERSION);
 	*trans->flags = 0;
 	*trans->pingTimeout  = createOpts->pingTimeout;
 	*trans->protocolType = createOpts->protocolType;
@@ -160,16 +171,31 @@ rtrShmTransServer *rtrShmTransCreate(rtrShmCreateOpts *createOpts, RsslError *er
 	if (createOpts->serverToClientPing)
 		*trans->flags |= RSSL_SHM_SERVER_PING_ENABLED;
 
+	if (createOpts->futexWakeup && trans->byteRing)
+		*trans->flags |= RSSL_SHM_SERVER_FUTEX_WAKEUP;
+
 	*trans->seqNumServer = RSSL_SHM_MIN_SEQ_NUM;
 
-	RTRShmCirBufServerInit(trans->circularBufferServer, createOpts->numBuffers, bufSize, &trans->shMemSeg);
-	
-	/* initialize buffer maxLength here */
-	for (i = 0; i < createOpts->numBuffers; i++)
+	if (trans->byteRing)
+	{
+		/* buffers are carved out of the ring as they are written, so it only needs the buffer sizes */
+		RTRShmByteRingServerInit(trans->byteRing, createOpts->numBuffers, bufSize, &trans->shMemSeg);
+		trans->circularBufferServer->start = trans->circularBufferServer->write = trans->circularBufferServer->read = trans->byteRing->start;
+		trans->circularBufferServer->end = trans->byteRing->start + trans->byteRing->size;
+		trans->circularBufferServer->maxBufSize = bufSize;
+		trans->circularBufferServer->numBuffers = createOpts->numBuffers;
+	}
+	else
 	{
-		bufPtr = (rtrShmBuffer *)RTRShmCirBufGetWriteBuf(trans->circularBufferServer, &trans->shMemSeg);
-		bufPtr->maxLength = (RsslUInt16)(bufSize - sizeof(rtrShmBuffer));		/* don't count the header */
-		RTRShmCirBufWritten(trans->circularBufferServer);
+		RTRShmCirBufServerInit(trans->circularBufferServer, createOpts->numBuffers, bufSize, &trans->shMemSeg);
+
+		/* initialize buffer maxLength here */
+		for (i = 0; i < createOpts->numBuffers; i++)
+		{
+			bufPtr = (rtrShmBuffer *)RTRShmCirBufGetWriteBuf(trans->circularBufferServer, &trans->shMemSeg);
+			bufPtr->maxLength = (RsslUInt16)(bufSize - sizeof(rtrShmBuffer));		/* don't count the header */
+			RTRShmCirBufWritten(trans->circularBufferServer);
+		}
 	}
 
 	RTR_SLOCK_INIT(trans->userLock);
@@ -285,6 +311,8 @@ int rtrShmTransDestroy( void *trans, RsslError *error )
 	}
 
 	*shmTransServerns->flags |= RSSL_SHM_SERVER_SHUTDOWN;	/* let the consumers know that the server is shutting down */
+	if (*shmTransServerns->flags & RSSL_SHM_SERVER_FUTEX_WAKEUP)
+		RTRShmByteRingWake(shmTransServerns->byteRing);
 	rtrShmSegDestroy(&shmTransServerns->shMemSeg);
 
 	rtrReleaseMutex(shmTransServerns->controlMutex);
@@ -319,6 +347,8 @@ rtrShmTransClient* rtrShmTransAttach( rtrShmAttachOpts *attachOpts, RsslError *e
 	trans->seqNumServer = 0;
 	trans->readBuffer = 0;
 	trans->namedPipe = 0;
+	trans->byteRing = 0;
+	trans->ringReader.batch = 0;
 
 	if ((trans->controlMutex = rtrShmSegAttachMutex(&trans->shMemSeg,attachOpts->shMemKey,0, errBuff)) == 0)
 	{
@@ -411,7 +441,9 @@ rtrShmTransClient* rtrShmTransAttach( rtrShmAttachOpts *attachOpts, RsslError *e
 
 	/*make sure the shmem seg we are reading is the right version */
 	/* if its a newer version, then we shouldnt try to read it */
-	if (*trans->shmemVersion != 1)
+	if (*trans->shmemVersion == RSSL_SHM_VERSION_BYTE_RING)
+		trans->byteRing = RTRShmByteRingAlign(rtrShmBytesAttach(&curLoc, sizeof(rtrShmByteRing) + RTR_SHM_CACHE_LINE_SIZE));
+	else if (*trans->shmemVersion != RSSL_SHM_VERSION)
 	{
 		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rtrShmTransAttach incompatible with newer shmem segment (version = %d).\n", __FILE__, __LINE__, *trans->shmemVersion);
@@ -423,7 +455,19 @@ rtrShmTransClient* rtrShmTransAttach( rtrShmAttachOpts *attachOpts, RsslError *e
 	/* do this malloc before the RTRShmCirBufClientInit. */
 	/* if we did it after RTRShmCirBufClientInit, we would delay the return back to the client (and maybe cause them to get too far behind) */
 	/* Do this outside of the userLock region so we dont hold up the writer */
-	if ((trans->currentBuffer = (char *)_rsslMalloc(trans->circularBufferServer->maxBufSize+8)) == NULL)
+	if (trans->byteRing)
+	{
+		/* the byte ring is read in batches, which replace the copy buffer */
+		if (RTRShmByteRingClientInit(&trans->ringReader, trans->byteRing) < 0)
+		{
+			rtrReleaseMutex(trans->controlMutex);
+			_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rtrShmTransAttach failed to malloc batch buffer.\n", __FILE__, __LINE__);
+			_rsslFree(trans);
+			return NULL;
+		}
+	}
+	else if ((trans->currentBuffer = (char *)_rsslMalloc(trans->circularBufferServer->maxBufSize+8)) == NULL)
 	{
 		rtrReleaseMutex(trans->controlMutex);
 		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
@@ -440,6 +484,11 @@ rtrShmTransClient* rtrShmTransAttach( rtrShmAttachOpts *attachOpts, RsslError *e
 	RTR_SHTRANS_LOCK(trans->userLock);
 	trans->seqNumClient = *trans->seqNumServer;
 	RTRShmCirBufClientInit(&trans->circularBufferClient, trans->circularBufferServer);
+	if (trans->byteRing)
+	{
+		RTRShmByteRingClientStart(&trans->ringReader, trans->byteRing);
+		trans->seqNumBatch = trans->seqNumClient;
+	}
 	RTR_SHTRANS_UNLOCK(trans->userLock);
 
 	rtrReleaseMutex(trans->controlMutex);
@@ -499,6 +548,10 @@ rtrShmTransClient* rtrShmTransAttach( rtrShmAttachOpts *attachOpts, RsslError *e
 		trans->maxReaderSeqNumLag = (trans->circularBufferClient.numBuffers * 3)/4;
 	}
 
+	/* the byte ring counts the lag in bytes, as many as the lagging messages would take at their largest */
+	if (trans->byteRing)
+		RTRShmByteRingSetMaxLag(&trans->ringReader, trans->byteRing, trans->maxReaderSeqNumLag * trans->byteRing->maxRecordSize);
+
 	if (*trans->protocolType != attachOpts->protocolType)
 	{
 		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
@@ -524,6 +577,7 @@ int rtrShmTransDetach( rtrShmTransClient *trans, RsslError *error )
 
 	trans->userLock = 0;
 	trans->circularBufferServer = 0;
+	trans->byteRing = 0;
 	trans->readBuffer = 0;
 
 	rtrShmSegDetach(&trans->shMemSeg);
@@ -538,6 +592,7 @@ int rtrShmTransDetach( rtrShmTransClient *trans, RsslError *error )
 		_rsslFree (trans->currentBuffer);
 		trans->currentBuffer = 0;
 	}
+	RTRShmByteRingClientCleanup(&trans->ringReader);
 
 #ifdef SHM_NAMEDPIPE
 	rtrShmSegDetachNamedPipe(trans->namedPipe);
@@ -550,11 +605,77 @@ int rtrShmTransDetach( rtrShmTransClient *trans, RsslError *error )
 }
 
 
+/* client uses to read from the byte ring */
+static rtrShmBuffer* rtrShmTransClientReadRing(rtrShmTransClient *trans, RsslChannel *chnl, RsslRet *readRet, RsslError *error)
+{
+	rtrShmBuffer *shmBuffer;
+	RsslUInt32 emptyReads = 0;
+	int ret;
+
+	/* records are handed out of the batch until it is used up, then the next batch is copied out of shmem */
+	while ((shmBuffer = (rtrShmBuffer*)RTRShmByteRingNextRecord(&trans->ringReader, trans->byteRing)) == 0)
+	{
+		ret = RTRShmByteRingReadBatch(&trans->ringReader, trans->byteRing, &trans->shMemSeg);
+		if (rtrLikely(ret > 0))
+		{
+			/* every record in the batch was written by now, so this tells the client how many are left */
+			trans->seqNumBatch = RTR_ATOMIC_READ64(trans->seqNumServer);
+			continue;
+		}
+
+		trans->readBuffer = 0;
+		if (rtrUnlikely(ret < 0))
+		{
+			_rsslSetError(error, 0, RSSL_RET_SLOW_READER, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rtrShmTransClientRead disconnected from shared memory because reader lags writer by %llu bytes.\n", __FILE__, __LINE__, (RsslUInt64)(trans->byteRing->writePos - trans->ringReader.readPos));
+			chnl->state = RSSL_CH_STATE_CLOSED;
+			return 0;
+		}
+
+		/* nothing to read */
+		if (rtrUnlikely(*trans->flags & RSSL_SHM_SERVER_SHUTDOWN))
+		{
+			_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rtrShmTransClientRead disconnected from shared memory because the provider terminated.\n", __FILE__, __LINE__);
+			chnl->state = RSSL_CH_STATE_CLOSED;
+			return 0;
+		}
+
+		if (rtrLikely(!trans->blockingIO))
+		{
+			_rsslSetError(error, chnl, RSSL_RET_READ_WOULD_BLOCK, 0);
+			return 0;
+		}
+
+		if (chnl->state != RSSL_CH_STATE_ACTIVE)
+		{
+			_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rtrShmTransClientRead failed due to channel is no longer active.\n", __FILE__, __LINE__);
+			return 0;
+		}
+
+		/* blocking readers poll for a while, then sleep until the writer wakes them */
+		if ((*trans->flags & RSSL_SHM_SERVER_FUTEX_WAKEUP) && ++emptyReads > RSSL_SHM_FUTEX_SPIN_COUNT)
+		{
+			RTRShmByteRingWait(trans->byteRing, trans->ringReader.readPos, RSSL_SHM_FUTEX_WAIT_USEC);
+			emptyReads = 0;
+		}
+	}
+
+	trans->seqNumClient++;
+	*readRet = (RsslRet)(trans->seqNumBatch - trans->seqNumClient);
+	trans->readBuffer = shmBuffer;
+	return shmBuffer;
+}
+
 /* client uses to read */
 rtrShmBuffer* rtrShmTransClientRead(rtrShmTransClient *trans, RsslChannel *chnl, RsslRet *readRet, RsslError *error)
 {
 	RsslUInt64 reader_seqnum_lag;
 
+	if (trans->byteRing)
+		return rtrShmTransClientReadRing(trans, chnl, readRet, error);
+
 	if (rtrLikely(trans->readBuffer != 0))
 	{
 		/* we must release the last read buffer first */
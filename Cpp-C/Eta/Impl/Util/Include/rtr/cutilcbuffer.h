@@ -108,6 +108,7 @@ typedef struct rtr_msgb {
 	void			*local;		/* Local storage for however owns the rtr_msgb_t */
 	unsigned short	protocolHdr;
 	unsigned short	protocolHdrLength;		/* Maximum length of data block */
+	RsslUInt64		queueTime;	/* When the owner queued this block, for measuring queueing delay */
 } rtr_msgb_t;
 
 
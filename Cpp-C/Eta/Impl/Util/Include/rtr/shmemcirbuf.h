@@ -15,6 +15,10 @@ extern "C" {
 
 #include "shmem.h"
 
+#ifdef WIN32
+#include <intrin.h>
+#endif
+
 
 typedef struct
 {
@@ -57,6 +61,241 @@ RTR_C_ALWAYS_INLINE void RTRShmCirBufReadComplete( rtrShmCirBuf* cBuf )
 }
 
 
+
+/* Variable-length ring.
+ * Each record is an rtrShmRingHdr followed by the bytes written, rounded up to RTR_SHM_ALIGNBYTES.
+ * A record never straddles the end of the ring; when the space left at the end is too short the
+ * writer fills it with a wrap record and continues at the start.
+ * writePos counts every byte the writer has published since the ring was created, so readers
+ * detect being overrun by comparing their own position against it.
+ * A ring with a single reader can instead be flow controlled: the reader publishes readPos once it
+ * is done with a record, and the writer does not reuse the bytes before it. */
+
+/* writePos is stored with release semantics once the records before it are complete, and loaded
+ * with acquire semantics before they are read; readPos orders the reader's last use of a record
+ * before the writer reuses it the same way. MSVC builds are assumed to target x86 or x64, where
+ * plain loads and stores already have these semantics and only the compiler has to be held back. */
+#ifdef WIN32
+#define RTR_SHM_ACQUIRE_FENCE() _ReadWriteBarrier()
+#else
+#define RTR_SHM_ACQUIRE_FENCE() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#endif
+
+RTR_C_ALWAYS_INLINE rtrUInt64 RTRShmLoadAcquire( volatile rtrUInt64* pos )
+{
+#ifdef WIN32
+	rtrUInt64 value = *pos;
+	_ReadWriteBarrier();
+	return value;
+#else
+	return __atomic_load_n(pos, __ATOMIC_ACQUIRE);
+#endif
+}
+
+RTR_C_ALWAYS_INLINE void RTRShmStoreRelease( volatile rtrUInt64* pos, rtrUInt64 value )
+{
+#ifdef WIN32
+	_ReadWriteBarrier();
+	*pos = value;
+#else
+	__atomic_store_n(pos, value, __ATOMIC_RELEASE);
+#endif
+}
+
+#define RTR_SHM_CACHE_LINE_SIZE		64
+#define RTR_SHM_RING_WRAP			0x01	/* the rest of the ring is unused, continue at the start */
+#define RTR_SHM_RING_BATCH_SIZE		65536	/* bytes a reader copies out of the ring at a time */
+
+typedef struct
+{
+	rtrUInt32		length;		/* length of the record, including this header and padding */
+	rtrUInt32		flags;
+} rtrShmRingHdr;
+
+typedef struct
+{
+	/* set when the ring is created, read-only afterwards */
+	RTR_SHM_OFFSET	start;			/* Start of the ring */
+	rtrUInt64		size;			/* Size of the ring in bytes */
+	rtrUInt32		maxRecordSize;	/* Largest record, including its header */
+	rtrUInt32		numBuffers;		/* number of maxBufSize buffers the ring was sized for */
+	char			_pad0[RTR_SHM_CACHE_LINE_SIZE - sizeof(RTR_SHM_OFFSET) - sizeof(rtrUInt64) - 2*sizeof(rtrUInt32)];
+
+	/* written by the writer only */
+	volatile rtrUInt64	writePos;		/* bytes published to readers */
+	rtrUInt64		writeOffset;	/* offset of the record being written */
+	rtrUInt64		pendingWrap;	/* bytes skipped by a wrap record that is not yet published */
+	char			_pad1[RTR_SHM_CACHE_LINE_SIZE - 3*sizeof(rtrUInt64)];
+
+	/* futex wakeup for blocking readers */
+	volatile rtrUInt32	wakeSeq;		/* bumped by the writer when readers are waiting */
+	volatile rtrUInt32	waiters;		/* number of readers waiting on wakeSeq */
+	char			_pad2[RTR_SHM_CACHE_LINE_SIZE - 2*sizeof(rtrUInt32)];
+
+	/* written by the reader only, on flow controlled rings */
+	volatile rtrUInt64	readPos;		/* bytes the reader is done with */
+	char			_pad3[RTR_SHM_CACHE_LINE_SIZE - sizeof(rtrUInt64)];
+} rtrShmByteRing;
+
+/* Not in shared memory - each reader keeps its own cursor */
+typedef struct
+{
+	rtrUInt64		readPos;		/* position of the next record to read */
+	rtrUInt64		readOffset;		/* offset of readPos into the ring */
+	rtrUInt64		maxLag;			/* readers further behind than this are overrun */
+	char*			batch;			/* records copied out of the ring */
+	rtrUInt32		batchSize;		/* size of batch */
+	rtrUInt32		batchLen;		/* bytes copied into batch */
+	rtrUInt32		batchNext;		/* offset of the next record in batch */
+	char			_pad0[RTR_SHM_CACHE_LINE_SIZE - 3*sizeof(rtrUInt64) - sizeof(char*) - 3*sizeof(rtrUInt32)];
+} rtrShmByteRingReader;
+
+/* Bytes to reserve in the segment for a ring of numBuffers records of up to maxBufSize bytes */
+rtrUInt64 RTRShmByteRingSize( rtrUInt32 numBuffers, rtrUInt32 maxBufSize );
+
+/* Returns the ring control block inside a reservation of sizeof(rtrShmByteRing) + RTR_SHM_CACHE_LINE_SIZE bytes */
+RTR_C_ALWAYS_INLINE rtrShmByteRing* RTRShmByteRingAlign( char* reserved )
+{
+	return (rtrShmByteRing*)(((size_t)reserved + RTR_SHM_CACHE_LINE_SIZE - 1) & ~((size_t)RTR_SHM_CACHE_LINE_SIZE - 1));
+}
+
+void RTRShmByteRingServerInit( rtrShmByteRing* ring, rtrUInt32 numBuffers, rtrUInt32 maxBufSize, rtrShmSeg* shMemSeg );
+int RTRShmByteRingClientInit( rtrShmByteRingReader* reader, rtrShmByteRing* ring );
+void RTRShmByteRingClientStart( rtrShmByteRingReader* reader, rtrShmByteRing* ring );
+void RTRShmByteRingClientCleanup( rtrShmByteRingReader* reader );
+
+/* Sets how far the reader may trail the writer, in bytes. Limited to what the writer cannot overwrite. */
+RTR_C_ALWAYS_INLINE void RTRShmByteRingSetMaxLag( rtrShmByteRingReader* reader, rtrShmByteRing* ring, rtrUInt64 maxLag )
+{
+	/* the writer may be filling a wrap record and a record past writePos */
+	rtrUInt64 lagLimit = ring->size - 2 * (rtrUInt64)ring->maxRecordSize;
+
+	reader->maxLag = (maxLag == 0 || maxLag > lagLimit) ? lagLimit : maxLag;
+}
+
+/* Copies the published records that follow the reader's position into its batch.
+ * Returns the number of bytes copied, 0 when there is nothing new, or -1 when the writer has overrun the reader. */
+int RTRShmByteRingReadBatch( rtrShmByteRingReader* reader, rtrShmByteRing* ring, rtrShmSeg* shMemSeg );
+
+/* Returns space for a record of up to len bytes. The writer must call RTRShmByteRingWritten before the next record. */
+RTR_C_ALWAYS_INLINE char* RTRShmByteRingGetWriteBuf( rtrShmByteRing* ring, rtrShmSeg* shMemSeg, rtrUInt32 len )
+{
+	char *base = (char*)RTR_SHM_MAKE_PTR(shMemSeg->base,ring->start);
+
+	if (rtrUnlikely(ring->writeOffset + RTR_SHM_ALIGNBYTES(sizeof(rtrShmRingHdr) + len) > ring->size))
+	{
+		rtrShmRingHdr *wrap = (rtrShmRingHdr*)(base + ring->writeOffset);
+
+		wrap->length = (rtrUInt32)(ring->size - ring->writeOffset);
+		wrap->flags = RTR_SHM_RING_WRAP;
+		ring->pendingWrap += wrap->length;
+		ring->writeOffset = 0;
+	}
+	return base + ring->writeOffset + sizeof(rtrShmRingHdr);
+}
+
+/* Publishes the record returned by RTRShmByteRingGetWriteBuf, along with any wrap record in front of it */
+RTR_C_ALWAYS_INLINE void RTRShmByteRingWritten( rtrShmByteRing* ring, rtrShmSeg* shMemSeg, rtrUInt32 len )
+{
+	rtrShmRingHdr *hdr = (rtrShmRingHdr*)((char*)RTR_SHM_MAKE_PTR(shMemSeg->base,ring->start) + ring->writeOffset);
+
+	hdr->length = (rtrUInt32)RTR_SHM_ALIGNBYTES(sizeof(rtrShmRingHdr) + len);
+	hdr->flags = 0;
+	ring->writeOffset += hdr->length;
+	if (rtrUnlikely(ring->writeOffset == ring->size))
+		ring->writeOffset = 0;
+	RTRShmStoreRelease(&ring->writePos, ring->writePos + ring->pendingWrap + hdr->length);
+	ring->pendingWrap = 0;
+}
+
+/* Flow controlled rings: returns space for a record of up to len bytes, or 0 until the reader
+ * has released enough of the ring. The ring must hold at least two records of maxRecordSize. */
+RTR_C_ALWAYS_INLINE char* RTRShmByteRingTryGetWriteBuf( rtrShmByteRing* ring, rtrShmSeg* shMemSeg, rtrUInt32 len )
+{
+	rtrUInt64 needed = RTR_SHM_ALIGNBYTES(sizeof(rtrShmRingHdr) + len);
+
+	/* a record that does not fit at the end also uses up the rest of the ring */
+	if (ring->writeOffset + needed > ring->size)
+		needed += ring->size - ring->writeOffset;
+
+	/* the acquire keeps the writes to the space after the reader's last use of it */
+	if (ring->writePos + ring->pendingWrap + needed > RTRShmLoadAcquire(&ring->readPos) + ring->size)
+		return 0;
+
+	return RTRShmByteRingGetWriteBuf(ring, shMemSeg, len);
+}
+
+/* Wakes readers waiting in RTRShmByteRingWait. Call after RTRShmByteRingWritten. */
+void RTRShmByteRingWake( rtrShmByteRing* ring );
+
+RTR_C_ALWAYS_INLINE void RTRShmByteRingNotify( rtrShmByteRing* ring )
+{
+#if defined(LINUX)
+	/* the store to writePos must be visible before waiters is checked; RTRShmByteRingWait does the reverse */
+	__sync_synchronize();
+	if (rtrUnlikely(ring->waiters != 0))
+		RTRShmByteRingWake(ring);
+#endif
+}
+
+/* Waits up to timeoutUsec for the writer to publish past readPos. Returns immediately on platforms without futexes. */
+void RTRShmByteRingWait( rtrShmByteRing* ring, rtrUInt64 readPos, rtrUInt32 timeoutUsec );
+
+/* Returns the next record in the reader's batch, or 0 when the batch has to be read again */
+RTR_C_ALWAYS_INLINE char* RTRShmByteRingNextRecord( rtrShmByteRingReader* reader, rtrShmByteRing* ring )
+{
+	rtrShmRingHdr *hdr;
+
+	while (reader->batchNext + sizeof(rtrShmRingHdr) <= reader->batchLen)
+	{
+		hdr = (rtrShmRingHdr*)(reader->batch + reader->batchNext);
+
+		/* a record cut off by the end of the batch is read again with the next batch */
+		if (rtrUnlikely(reader->batchNext + hdr->length > reader->batchLen))
+			break;
+
+		reader->batchNext += hdr->length;
+		reader->readPos += hdr->length;
+		reader->readOffset += hdr->length;
+		if (reader->readOffset == ring->size)
+			reader->readOffset = 0;
+
+		if (rtrLikely(!(hdr->flags & RTR_SHM_RING_WRAP)))
+			return (char*)(hdr + 1);
+	}
+
+	reader->batchLen = reader->batchNext = 0;
+	return 0;
+}
+
+/* Flow controlled rings: returns the next record where it is in the ring, or 0 when the ring is empty.
+ * The record stays in place until RTRShmByteRingRelease. */
+RTR_C_ALWAYS_INLINE rtrShmRingHdr* RTRShmByteRingPeekRecord( rtrShmByteRingReader* reader, rtrShmByteRing* ring, rtrShmSeg* shMemSeg )
+{
+	rtrShmRingHdr *hdr;
+
+	while (reader->readPos != RTRShmLoadAcquire(&ring->writePos))
+	{
+		hdr = (rtrShmRingHdr*)((char*)RTR_SHM_MAKE_PTR(shMemSeg->base,ring->start) + reader->readOffset);
+
+		reader->readPos += hdr->length;
+		reader->readOffset += hdr->length;
+		if (reader->readOffset == ring->size)
+			reader->readOffset = 0;
+
+		if (rtrLikely(!(hdr->flags & RTR_SHM_RING_WRAP)))
+			return hdr;
+	}
+	return 0;
+}
+
+/* Flow controlled rings: hands every record returned by RTRShmByteRingPeekRecord back to the writer */
+RTR_C_ALWAYS_INLINE void RTRShmByteRingRelease( rtrShmByteRingReader* reader, rtrShmByteRing* ring )
+{
+	RTRShmStoreRelease(&ring->readPos, reader->readPos);
+}
+
+
 #ifdef __cplusplus
 };
 #endif
@@ -7,6 +7,7 @@
  */
 
 #include "rtr/rsslHashTable.h"
+#include <string.h>
 
 /* U16 */
 
@@ -34,19 +35,47 @@ RSSL_API RsslBool rsslHashU64Compare(void *pKey1, void *pKey2)
 
 /* RsslBuffer */
 
+/* Mixes the bits of a 64-bit value so that each input bit affects every output bit. */
+#define RSSL_HASH_MIX64(__h) \
+	(__h) ^= (__h) >> 33; \
+	(__h) *= RTR_ULL(0xFF51AFD7ED558CCD); \
+	(__h) ^= (__h) >> 33; \
+	(__h) *= RTR_ULL(0xC4CEB9FE1A85EC53); \
+	(__h) ^= (__h) >> 33
+
+/* Hashes the buffer eight bytes at a time and mixes the result, so similar names (such as RICs that
+ * differ in only a few characters) still spread evenly. */
 RSSL_API RsslUInt32 rsslHashBufferSum(void *pKey)
 {
-	RsslUInt32 i;
-	RsslUInt32 hashSum = 0;
 	RsslBuffer *pBuffer = (RsslBuffer*)pKey;
+	const unsigned char *pData = (const unsigned char*)pBuffer->data;
+	RsslUInt32 length = pBuffer->length;
+	RsslUInt64 hashSum = RTR_ULL(0x9E3779B97F4A7C15) ^ ((RsslUInt64)length * RTR_ULL(0x87C37B91114253D5));
+	RsslUInt64 block;
 
-	for(i = 0; i < pBuffer->length; ++i)
+	for(; length >= 8; length -= 8, pData += 8)
 	{
-		hashSum = (hashSum << 4) + (RsslUInt32)pBuffer->data[i];
-		hashSum ^= (hashSum >> 12);
+		memcpy(&block, pData, 8);
+		block *= RTR_ULL(0x87C37B91114253D5);
+		block = (block << 31) | (block >> 33);
+		block *= RTR_ULL(0x4CF5AD432745937F);
+		hashSum ^= block;
+		hashSum = ((hashSum << 27) | (hashSum >> 37)) * 5 + 0x52DCE729;
 	}
 
-	return hashSum;
+	if (length)
+	{
+		block = 0;
+		memcpy(&block, pData, length);
+		block *= RTR_ULL(0x87C37B91114253D5);
+		block = (block << 31) | (block >> 33);
+		block *= RTR_ULL(0x4CF5AD432745937F);
+		hashSum ^= block;
+	}
+
+	RSSL_HASH_MIX64(hashSum);
+
+	return (RsslUInt32)(hashSum ^ (hashSum >> 32));
 }
 
 RSSL_API RsslBool rsslHashBufferCompare(void *pKey1, void *pKey2)
@@ -10,12 +10,14 @@
 #include <stdlib.h>
 
 /* On windows, select is used for notification.
- * Otherwise poll is used. */
+ * Otherwise poll is used, unless the notifier was created with one of the epoll types (Linux only). */
 #if defined(WIN32)
 #define FD_SETSIZE 6400
 #include <winsock2.h>
 #else
 #include <poll.h>
+#include <errno.h>
+#include <unistd.h>
 #endif
 
 typedef struct
@@ -24,11 +26,16 @@ typedef struct
 
 	int _registeredFlags; /* RsslNotifierEvent flags set on this event. */
 	void *_object;
+	RsslSocket _fd;
 
 #ifndef WIN32
-	int _pollFdIndex; /* Array index of the pollfd associated with this event */
-#else
-	SOCKET _fd;
+	int _pollFdIndex; /* Array index of the pollfd associated with this event (also its index in the events array) */
+#endif
+
+#ifdef RSSL_NOTIFIER_EPOLL
+	unsigned int _epollFlags;	/* Events currently registered with epoll for this descriptor; 0 if it is not in the epoll set. */
+	RsslBool _isNotified;		/* Event is currently in the notifiedEvents array. */
+	RsslBool _isFdBad;			/* epoll refused the descriptor; report RSSL_NESF_BAD_FD on the next wait. */
 #endif
 
 } RsslNotifierEventImpl;
@@ -39,8 +46,14 @@ typedef struct
 	RsslNotifierEventImpl **_events; /* RsslNotifierEvents associated with this notifier */
 	int _maxEvents; /* Maximum number of events the array can currently hold */
 	int _eventCount; /* Number of events in the array */
+	RsslNotifierType _type; /* Notification mechanism in use. */
 #ifndef WIN32
 	struct pollfd *_pollFds; /* Array of pollfds associated with events in this notifier. */
+#ifdef RSSL_NOTIFIER_EPOLL
+	int _epollFd; /* epoll instance; -1 when poll is used. */
+	struct epoll_event *_epollEvents; /* Output array for epoll_wait. */
+	int _badFdCount; /* Number of events whose descriptor epoll refused. */
+#endif
 #else
 	fd_set _readFds; /* Read fd_set */
 	fd_set _writeFds; /* Write fd_set */
@@ -48,6 +61,218 @@ typedef struct
 #endif
 } RsslNotifierImpl;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+
+#define RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl) ((pNotifierImpl)->_epollFd != -1)
+
+/* Checks whether another event on this notifier has the same descriptor number. This can happen if the event's
+ * descriptor was closed without updating or removing the event, and the number was then reused; in that case
+ * the epoll registration for the number belongs to the other event. */
+static RsslBool _epollFdIsShared(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	int i;
+
+	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
+	{
+		if (pNotifierImpl->_events[i] != pNotifierEventImpl && pNotifierImpl->_events[i]->_fd == pNotifierEventImpl->_fd
+				&& pNotifierImpl->_events[i]->_epollFlags != 0)
+			return RSSL_TRUE;
+	}
+
+	return RSSL_FALSE;
+}
+
+static void _epollSetFdBad(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl, RsslBool isFdBad)
+{
+	if (pNotifierEventImpl->_isFdBad == isFdBad)
+		return;
+
+	pNotifierEventImpl->_isFdBad = isFdBad;
+	if (isFdBad)
+		++pNotifierImpl->_badFdCount;
+	else
+		--pNotifierImpl->_badFdCount;
+}
+
+/* Removes the event's descriptor from the epoll set. */
+static void _epollRemoveFd(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	struct epoll_event epollEvent;
+
+	if (pNotifierEventImpl->_epollFlags == 0)
+		return;
+
+	/* Errors are ignored; a descriptor that was already closed is no longer in the set. */
+	if (!_epollFdIsShared(pNotifierImpl, pNotifierEventImpl))
+		epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_DEL, pNotifierEventImpl->_fd, &epollEvent);
+
+	pNotifierEventImpl->_epollFlags = 0;
+}
+
+/* Brings the epoll registration of the event's descriptor in line with its registered flags.
+ * Descriptors with no registered flags are kept out of the set, so that hangups on them do not trigger wakeups. */
+static int _epollUpdateFd(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	struct epoll_event epollEvent;
+	unsigned int epollFlags = 0;
+	int ret;
+
+	if (pNotifierEventImpl->_registeredFlags & RSSL_NESF_READ)
+		epollFlags |= EPOLLIN | EPOLLPRI;
+
+	if (pNotifierEventImpl->_registeredFlags & RSSL_NESF_WRITE)
+		epollFlags |= EPOLLOUT;
+
+	if (epollFlags == 0)
+	{
+		_epollRemoveFd(pNotifierImpl, pNotifierEventImpl);
+		return 0;
+	}
+
+	if (pNotifierImpl->_type == RSSL_NOTIFIER_TYPE_EPOLL_EDGE)
+		epollFlags |= EPOLLET;
+
+	if (epollFlags == pNotifierEventImpl->_epollFlags)
+		return 0;
+
+	memset(&epollEvent, 0, sizeof(epollEvent));
+	epollEvent.events = epollFlags;
+	epollEvent.data.ptr = pNotifierEventImpl;
+
+	if (pNotifierEventImpl->_epollFlags == 0)
+	{
+		if ((ret = epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_ADD, pNotifierEventImpl->_fd, &epollEvent)) < 0 && errno == EEXIST)
+			ret = epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_MOD, pNotifierEventImpl->_fd, &epollEvent);
+	}
+	else
+	{
+		if ((ret = epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_MOD, pNotifierEventImpl->_fd, &epollEvent)) < 0 && errno == ENOENT)
+			ret = epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_ADD, pNotifierEventImpl->_fd, &epollEvent);
+	}
+
+	if (ret < 0)
+	{
+		pNotifierEventImpl->_epollFlags = 0;
+
+		/* poll() reports an invalid descriptor through POLLNVAL rather than failing, so do the same. */
+		if (errno == EBADF)
+		{
+			_epollSetFdBad(pNotifierImpl, pNotifierEventImpl, RSSL_TRUE);
+			return 0;
+		}
+
+		return -1;
+	}
+
+	pNotifierEventImpl->_epollFlags = epollFlags;
+	_epollSetFdBad(pNotifierImpl, pNotifierEventImpl, RSSL_FALSE);
+	return 0;
+}
+
+/* Adds the event to the notifiedEvents array, unless it is already there. */
+static void _epollAddNotified(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	if (pNotifierEventImpl->_isNotified)
+		return;
+
+	pNotifierEventImpl->_isNotified = RSSL_TRUE;
+	pNotifierImpl->base.notifiedEvents[pNotifierImpl->base.notifiedEventCount] = &pNotifierEventImpl->base;
+	++pNotifierImpl->base.notifiedEventCount;
+}
+
+/* Takes the event out of the notifiedEvents array. */
+static void _epollRemoveNotified(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	int i;
+
+	if (!pNotifierEventImpl->_isNotified)
+		return;
+
+	for (i = 0; i < pNotifierImpl->base.notifiedEventCount; ++i)
+	{
+		if (pNotifierImpl->base.notifiedEvents[i] == &pNotifierEventImpl->base)
+		{
+			pNotifierImpl->base.notifiedEvents[i] = pNotifierImpl->base.notifiedEvents[pNotifierImpl->base.notifiedEventCount - 1];
+			--pNotifierImpl->base.notifiedEventCount;
+			break;
+		}
+	}
+
+	pNotifierEventImpl->_isNotified = RSSL_FALSE;
+}
+
+static int _epollWait(RsslNotifierImpl *pNotifierImpl, long timeoutUsec)
+{
+	int i, ret;
+	int notifiedCount = 0;
+
+	/* Reset the events notified by the previous wait. Only those events need to be touched, so the cost of a wait
+	 * does not depend on the number of associated events. With edge-triggering, events whose flags have not been 
+	 * cleared by the application are kept, since epoll will not report them again. */
+	for (i = 0; i < pNotifierImpl->base.notifiedEventCount; ++i)
+	{
+		RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pNotifierImpl->base.notifiedEvents[i];
+
+		if (pNotifierImpl->_type == RSSL_NOTIFIER_TYPE_EPOLL_EDGE
+				&& (pNotifierEventImpl->base.notifiedFlags & pNotifierEventImpl->_registeredFlags))
+		{
+			pNotifierEventImpl->base.notifiedFlags &= pNotifierEventImpl->_registeredFlags;
+			pNotifierImpl->base.notifiedEvents[notifiedCount++] = &pNotifierEventImpl->base;
+		}
+		else
+		{
+			pNotifierEventImpl->base.notifiedFlags = 0;
+			pNotifierEventImpl->_isNotified = RSSL_FALSE;
+		}
+	}
+	pNotifierImpl->base.notifiedEventCount = notifiedCount;
+
+	/* Don't block if there is still something to report. */
+	if (notifiedCount > 0 || pNotifierImpl->_badFdCount > 0)
+		timeoutUsec = 0;
+
+	ret = epoll_wait(pNotifierImpl->_epollFd, pNotifierImpl->_epollEvents, pNotifierImpl->_maxEvents, timeoutUsec/1000);
+	if (ret < 0)
+		return ret;
+
+	for (i = 0; i < ret; ++i)
+	{
+		RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pNotifierImpl->_epollEvents[i].data.ptr;
+		unsigned int epollFlags = pNotifierImpl->_epollEvents[i].events;
+
+		if (epollFlags & (EPOLLIN | EPOLLPRI))
+			pNotifierEventImpl->base.notifiedFlags |= RSSL_NESF_READ;
+
+		if (epollFlags & EPOLLOUT)
+			pNotifierEventImpl->base.notifiedFlags |= RSSL_NESF_WRITE;
+
+		/* Errors and hangups are always reported by epoll; let the owner discover them through whatever it is waiting for. */
+		if (epollFlags & (EPOLLERR | EPOLLHUP))
+			pNotifierEventImpl->base.notifiedFlags |= pNotifierEventImpl->_registeredFlags & (RSSL_NESF_READ | RSSL_NESF_WRITE);
+
+		if (pNotifierEventImpl->base.notifiedFlags)
+			_epollAddNotified(pNotifierImpl, pNotifierEventImpl);
+	}
+
+	if (pNotifierImpl->_badFdCount > 0)
+	{
+		for (i = 0; i < pNotifierImpl->_eventCount; ++i)
+		{
+			RsslNotifierEventImpl *pNotifierEventImpl = pNotifierImpl->_events[i];
+
+			if (pNotifierEventImpl->_isFdBad)
+			{
+				pNotifierEventImpl->base.notifiedFlags |= RSSL_NESF_BAD_FD;
+				_epollAddNotified(pNotifierImpl, pNotifierEventImpl);
+			}
+		}
+	}
+
+	return pNotifierImpl->base.notifiedEventCount;
+}
+
+#endif
+
 RSSL_API RsslNotifierEvent *rsslCreateNotifierEvent()
 {
 	return (RsslNotifierEvent*)calloc(sizeof(RsslNotifierEventImpl), 1);
@@ -64,12 +289,33 @@ RSSL_API void *rsslNotifierEventGetObject(RsslNotifierEvent *pEvent)
 	return pNotifierEventImpl->_object;
 }
 
+RSSL_API RsslSocket rsslNotifierEventGetFd(RsslNotifierEvent *pEvent)
+{
+	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
+	return pNotifierEventImpl->_fd;
+}
+
 
 RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint)
+{
+	return rsslCreateNotifierEx(maxEventsHint, RSSL_NOTIFIER_TYPE_DEFAULT);
+}
+
+RSSL_API RsslNotifier *rsslCreateNotifierEx(int maxEventsHint, RsslNotifierType notifierType)
 {
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)malloc(sizeof(RsslNotifierImpl));
+	if (pNotifierImpl == NULL)
+		return NULL;
+
 	memset(pNotifierImpl, 0, sizeof(RsslNotifierImpl));
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	pNotifierImpl->_epollFd = -1;
+#endif
+
+	if (maxEventsHint <= 0)
+		maxEventsHint = 1;
+
 	pNotifierImpl->_maxEvents = maxEventsHint;
 	pNotifierImpl->_events = (RsslNotifierEventImpl**)malloc(maxEventsHint * sizeof(RsslNotifierEventImpl**));
 	if (pNotifierImpl->_events == NULL)
@@ -94,9 +340,35 @@ RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint)
 	}
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (notifierType == RSSL_NOTIFIER_TYPE_EPOLL || notifierType == RSSL_NOTIFIER_TYPE_EPOLL_EDGE)
+	{
+		pNotifierImpl->_type = notifierType;
+
+		if ((pNotifierImpl->_epollFd = epoll_create1(EPOLL_CLOEXEC)) < 0)
+		{
+			rsslDestroyNotifier(&pNotifierImpl->base);
+			return NULL;
+		}
+
+		pNotifierImpl->_epollEvents = (struct epoll_event*)malloc(maxEventsHint * sizeof(struct epoll_event));
+		if (pNotifierImpl->_epollEvents == NULL)
+		{
+			rsslDestroyNotifier(&pNotifierImpl->base);
+			return NULL;
+		}
+	}
+#endif
+
 	return &pNotifierImpl->base;
 }
 
+RSSL_API RsslNotifierType rsslNotifierGetType(RsslNotifier *pNotifier)
+{
+	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
+	return pNotifierImpl->_type;
+}
+
 RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier)
 {
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
@@ -111,6 +383,14 @@ RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier)
 	pNotifierImpl->_pollFds = NULL;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (pNotifierImpl->_epollFd != -1)
+		close(pNotifierImpl->_epollFd);
+
+	free(pNotifierImpl->_epollEvents);
+	pNotifierImpl->_epollEvents = NULL;
+#endif
+
 	free(pNotifierImpl);
 }
 
@@ -131,6 +411,9 @@ RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pE
 		/* Event arrays are full; double their sizes before adding the new event. */
 #ifndef WIN32
 		struct pollfd *pollFds;
+#endif
+#ifdef RSSL_NOTIFIER_EPOLL
+		struct epoll_event *epollEvents;
 #endif
 		RsslNotifierEvent **notifiedEvents;
 		RsslNotifierEventImpl **events = (RsslNotifierEventImpl**)realloc(pNotifierImpl->_events, pNotifierImpl->_maxEvents * 2 * sizeof(RsslNotifierEventImpl**));
@@ -147,6 +430,16 @@ RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pE
 			return -1;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+		if (pNotifierImpl->_epollEvents != NULL)
+		{
+			epollEvents = (struct epoll_event*)realloc(pNotifierImpl->_epollEvents, pNotifierImpl->_maxEvents * 2 * sizeof(struct epoll_event));
+			if (epollEvents == NULL)
+				return -1;
+			pNotifierImpl->_epollEvents = epollEvents;
+		}
+#endif
+
 		pNotifierImpl->_maxEvents *= 2;
 		pNotifierImpl->_events = events;
 		pNotifierImpl->base.notifiedEvents = notifiedEvents;
@@ -159,8 +452,15 @@ RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pE
 	memset(&pNotifierImpl->_pollFds[pNotifierImpl->_eventCount], 0, sizeof(struct pollfd));
 	pNotifierImpl->_pollFds[pNotifierImpl->_eventCount].fd = fd;
 	pNotifierEventImpl->_pollFdIndex = pNotifierImpl->_eventCount;
-#else
+#endif
 	pNotifierEventImpl->_fd = fd;
+
+#ifdef RSSL_NOTIFIER_EPOLL
+	/* The descriptor is added to the epoll set once read or write notification is registered. */
+	pNotifierEventImpl->_epollFlags = 0;
+	pNotifierEventImpl->_isNotified = RSSL_FALSE;
+	pNotifierEventImpl->_isFdBad = RSSL_FALSE;
+	pNotifierEventImpl->base.notifiedFlags = 0;
 #endif
 
 	pNotifierEventImpl->_object = object;
@@ -178,6 +478,22 @@ RSSL_API int rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEven
 
 	pNotifierEventImpl->_registeredFlags = 0;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+	{
+		/* The event's index is maintained, so no need to search for it. */
+		if (pNotifierEventImpl->_pollFdIndex >= pNotifierImpl->_eventCount 
+				|| pNotifierImpl->_events[pNotifierEventImpl->_pollFdIndex] != pNotifierEventImpl)
+			return -1; /* Not found. */
+
+		_epollRemoveFd(pNotifierImpl, pNotifierEventImpl);
+		_epollSetFdBad(pNotifierImpl, pNotifierEventImpl, RSSL_FALSE);
+		pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].fd = fd;
+		pNotifierEventImpl->_fd = fd;
+		return 0;
+	}
+#endif
+
 	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
 	{
 		if (pNotifierImpl->_events[i] == pNotifierEventImpl)
@@ -185,9 +501,8 @@ RSSL_API int rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEven
 
 #ifndef WIN32
 			pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].fd = fd;
-#else
-			pNotifierEventImpl->_fd = fd;
 #endif
+			pNotifierEventImpl->_fd = fd;
 			return 0;
 		}
 	}
@@ -204,6 +519,32 @@ RSSL_API int rsslNotifierRemoveEvent(RsslNotifier *pNotifier, RsslNotifierEvent
 
 	pNotifierEventImpl->_registeredFlags = 0;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+	{
+		if (pNotifierEventImpl->_pollFdIndex >= pNotifierImpl->_eventCount 
+				|| pNotifierImpl->_events[pNotifierEventImpl->_pollFdIndex] != pNotifierEventImpl)
+			return 0; /* Not found. */
+
+		_epollRemoveFd(pNotifierImpl, pNotifierEventImpl);
+		_epollSetFdBad(pNotifierImpl, pNotifierEventImpl, RSSL_FALSE);
+		_epollRemoveNotified(pNotifierImpl, pNotifierEventImpl);
+		pNotifierEventImpl->base.notifiedFlags = 0;
+
+		/* Swap in last event */
+		i = pNotifierEventImpl->_pollFdIndex;
+		if (pNotifierImpl->_eventCount > 1)
+		{
+			pNotifierImpl->_events[pNotifierImpl->_eventCount - 1]->_pollFdIndex = i;
+			pNotifierImpl->_pollFds[i] = pNotifierImpl->_pollFds[pNotifierImpl->_eventCount - 1];
+			pNotifierImpl->_events[i] = pNotifierImpl->_events[pNotifierImpl->_eventCount - 1];
+		}
+
+		--pNotifierImpl->_eventCount;
+		return 0;
+	}
+#endif
+
 	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
 	{
 		if (pNotifierImpl->_events[i] == pNotifierEventImpl)
@@ -233,6 +574,10 @@ RSSL_API int rsslNotifierRegisterRead(RsslNotifier *pNotifier, RsslNotifierEvent
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags |= RSSL_NESF_READ;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _epollUpdateFd(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events |= POLLIN | POLLPRI;
 #endif
@@ -244,6 +589,10 @@ RSSL_API int rsslNotifierUnregisterRead(RsslNotifier *pNotifier, RsslNotifierEve
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags &= ~RSSL_NESF_READ;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _epollUpdateFd(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events &= ~(POLLIN | POLLPRI);
 #endif
@@ -256,6 +605,10 @@ RSSL_API int rsslNotifierRegisterWrite(RsslNotifier *pNotifier, RsslNotifierEven
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags |= RSSL_NESF_WRITE;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _epollUpdateFd(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events |= POLLOUT;
 #endif
@@ -267,6 +620,10 @@ RSSL_API int rsslNotifierUnregisterWrite(RsslNotifier *pNotifier, RsslNotifierEv
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags &= ~RSSL_NESF_WRITE;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _epollUpdateFd(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events &= ~POLLOUT;
 #endif
@@ -279,6 +636,11 @@ RSSL_API int rsslNotifierWait(RsslNotifier *pNotifier, long timeoutUsec)
 	int i;
 	int ret;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_USES_EPOLL(pNotifierImpl))
+		return _epollWait(pNotifierImpl, timeoutUsec);
+#endif
+
 #ifndef WIN32
 	pNotifierImpl->base.notifiedEventCount = 0;
 	ret = poll(pNotifierImpl->_pollFds, pNotifierImpl->_eventCount, timeoutUsec/1000);
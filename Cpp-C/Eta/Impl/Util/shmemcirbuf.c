@@ -7,6 +7,15 @@
  */
  
 #include "rtr/shmemcirbuf.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(LINUX)
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <time.h>
+#endif
 
 
 void RTRShmCirBufServerInit( rtrShmCirBuf* cBuf,
@@ -35,3 +44,113 @@ void RTRShmCirBufClientInit( rtrShmCirBuf* circBufClient, rtrShmCirBuf* circBufS
 };
 
 
+
+
+rtrUInt64 RTRShmByteRingSize( rtrUInt32 numBuffers, rtrUInt32 maxBufSize )
+{
+	rtrUInt64 maxRecordSize = RTR_SHM_ALIGNBYTES(sizeof(rtrShmRingHdr) + maxBufSize);
+
+	/* leave room for the readers to trail the writer by at least two maximum sized records */
+	if (numBuffers < 4)
+		numBuffers = 4;
+	return maxRecordSize * numBuffers;
+}
+
+void RTRShmByteRingServerInit( rtrShmByteRing* ring,
+							   rtrUInt32 numBuffers,
+							   rtrUInt32 maxBufSize,
+							   rtrShmSeg* shMemSeg )
+{
+	rtrUInt64 size = RTRShmByteRingSize(numBuffers, maxBufSize);
+
+	memset(ring, 0, sizeof(rtrShmByteRing));
+	ring->start = RTR_SHM_MAKE_OFFSET(shMemSeg->base,rtrShmBytesReserve( shMemSeg, (size_t)size ));
+	ring->size = size;
+	ring->maxRecordSize = (rtrUInt32)RTR_SHM_ALIGNBYTES(sizeof(rtrShmRingHdr) + maxBufSize);
+	ring->numBuffers = numBuffers;
+}
+
+int RTRShmByteRingClientInit( rtrShmByteRingReader* reader, rtrShmByteRing* ring )
+{
+	reader->batchSize = RTR_SHM_RING_BATCH_SIZE;
+	if (reader->batchSize < ring->maxRecordSize)
+		reader->batchSize = ring->maxRecordSize;
+	if ((reader->batch = (char*)malloc(reader->batchSize)) == 0)
+		return -1;
+
+	RTRShmByteRingSetMaxLag(reader, ring, 0);
+	reader->batchLen = reader->batchNext = 0;
+	return 0;
+}
+
+void RTRShmByteRingClientStart( rtrShmByteRingReader* reader, rtrShmByteRing* ring )
+{
+	/* every record ends where the next one starts, so offsets are positions modulo the size */
+	reader->readPos = ring->writePos;
+	reader->readOffset = reader->readPos % ring->size;
+}
+
+void RTRShmByteRingClientCleanup( rtrShmByteRingReader* reader )
+{
+	if (reader->batch != 0)
+	{
+		free(reader->batch);
+		reader->batch = 0;
+	}
+}
+
+int RTRShmByteRingReadBatch( rtrShmByteRingReader* reader, rtrShmByteRing* ring, rtrShmSeg* shMemSeg )
+{
+	rtrUInt64 writePos = RTRShmLoadAcquire(&ring->writePos);
+	rtrUInt64 copyLen;
+
+	if (writePos == reader->readPos)
+		return 0;
+
+	if (rtrUnlikely(writePos - reader->readPos > reader->maxLag))
+		return -1;
+
+	/* copy everything up to the end of the ring in one go */
+	copyLen = ring->size - reader->readOffset;
+	if (copyLen > writePos - reader->readPos)
+		copyLen = writePos - reader->readPos;
+	if (copyLen > reader->batchSize)
+		copyLen = reader->batchSize;
+
+	memcpy(reader->batch, (char*)RTR_SHM_MAKE_PTR(shMemSeg->base,ring->start) + reader->readOffset, (size_t)copyLen);
+	RTR_SHM_ACQUIRE_FENCE();
+
+	/* check that the writer did not reach what we copied while we were copying it */
+	writePos = ring->writePos;
+	if (rtrUnlikely(writePos + 2 * (rtrUInt64)ring->maxRecordSize > reader->readPos + ring->size))
+		return -1;
+
+	reader->batchLen = (rtrUInt32)copyLen;
+	reader->batchNext = 0;
+	return (int)copyLen;
+}
+
+void RTRShmByteRingWake( rtrShmByteRing* ring )
+{
+#if defined(LINUX)
+	++ring->wakeSeq;
+	/* the ring is shared between processes, so this cannot use FUTEX_PRIVATE_FLAG */
+	syscall(SYS_futex, &ring->wakeSeq, FUTEX_WAKE, 0x7fffffff, NULL, NULL, 0);
+#endif
+}
+
+void RTRShmByteRingWait( rtrShmByteRing* ring, rtrUInt64 readPos, rtrUInt32 timeoutUsec )
+{
+#if defined(LINUX)
+	rtrUInt32 wakeSeq = ring->wakeSeq;
+	struct timespec timeout;
+
+	timeout.tv_sec = timeoutUsec / 1000000;
+	timeout.tv_nsec = (timeoutUsec % 1000000) * 1000;
+
+	__sync_fetch_and_add(&ring->waiters, 1);
+	if (ring->writePos == readPos)
+		syscall(SYS_futex, &ring->wakeSeq, FUTEX_WAIT, wakeSeq, &timeout, NULL, 0);
+	__sync_fetch_and_sub(&ring->waiters, 1);
+#endif
+}
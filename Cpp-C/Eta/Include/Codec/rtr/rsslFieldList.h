@@ -141,6 +141,107 @@ RTR_C_INLINE void rsslClearFieldEntry(RsslFieldEntry *pField)
 	pField->encData.length = 0;
 }
 
+/**
+ * @brief Where one RsslFieldEntry sits in an indexed RsslFieldList.  Filled in by rsslIndexFieldList().
+ * @see RsslFieldListIndex
+ */
+typedef struct {
+	RsslFieldId			fieldId;	/*!< @brief The entry's field identifier */
+	RsslUInt8			dataType;	/*!< @brief The entry's RsslFieldEntry::dataType, as rsslDecodeFieldEntry() would report it */
+	RsslUInt32			_offset;	/* Offset of the entry's content from the start of the list's entries */
+	RsslUInt32			_length;	/* Length of the entry's content */
+	RsslUInt32			_nextOffset;	/* Offset of the entry that follows it */
+	RsslUInt32			_nextInBucket;	/* Number of the next entry in the same hash bucket, plus one; 0 ends the chain */
+} RsslFieldIndexEntry;
+
+/**
+ * @brief An index of the entries in one RsslFieldList, so that entries can be found by field identifier without decoding the entries ahead of them.
+ * The application provides the storage: RsslFieldListIndex::entries needs room for every entry in the list, and RsslFieldListIndex::buckets 
+ * should have a power of two number of buckets, ideally at least twice the number of entries.
+ * @see RSSL_INIT_FIELD_LIST_INDEX, rsslClearFieldListIndex, rsslIndexFieldList, rsslDecodeFieldEntryByFid
+ */
+typedef struct {
+	RsslFieldIndexEntry	*entries;		/*!< @brief Storage for the index entries, in the order they appear in the list */
+	RsslUInt32			maxEntries;		/*!< @brief Number of entries that RsslFieldListIndex::entries can hold */
+	RsslUInt32			*buckets;		/*!< @brief Storage for the hash buckets */
+	RsslUInt32			bucketCount;	/*!< @brief Number of buckets in RsslFieldListIndex::buckets; must be a power of two */
+	RsslUInt32			entryCount;		/*!< @brief Number of entries in the indexed list.  If rsslIndexFieldList() returns ::RSSL_RET_BUFFER_TOO_SMALL, this is the number of entries needed. */
+	char				*_base;			/* Start of the indexed list's entries */
+} RsslFieldListIndex;
+
+/**
+ * @brief RsslFieldListIndex static initializer
+ * @see RsslFieldListIndex, rsslClearFieldListIndex
+ */
+#define RSSL_INIT_FIELD_LIST_INDEX { 0, 0, 0, 0, 0, 0 }
+
+/**
+ * @brief Clears an RsslFieldListIndex
+ * @see RsslFieldListIndex, RSSL_INIT_FIELD_LIST_INDEX
+ */
+RTR_C_INLINE void rsslClearFieldListIndex(RsslFieldListIndex *pIndex)
+{
+	pIndex->entries = 0;
+	pIndex->maxEntries = 0;
+	pIndex->buckets = 0;
+	pIndex->bucketCount = 0;
+	pIndex->entryCount = 0;
+	pIndex->_base = 0;
+}
+
+/**
+ * @brief Decoding status of one row of an RsslFieldColumn
+ * @see RsslFieldColumn, rsslDecodeFieldListColumns
+ */
+typedef enum {
+	RSSL_FCS_ABSENT		= 0,	/*!< (0) The field was not in the row's RsslFieldList */
+	RSSL_FCS_PRESENT	= 1,	/*!< (1) The field was decoded into the row */
+	RSSL_FCS_BLANK		= 2,	/*!< (2) The field was present but blank */
+	RSSL_FCS_INVALID	= 3		/*!< (3) The field was present but could not be decoded as the column's type */
+} RsslFieldColumnStatus;
+
+/**
+ * @brief One field to extract with rsslDecodeFieldListColumns(), and the arrays its values are written to, one element per row.
+ * @see RsslFieldColumnBatch, rsslDecodeFieldListColumns
+ */
+typedef struct {
+	RsslFieldId		fieldId;		/*!< @brief Field identifier of the column */
+	RsslUInt8		dataType;		/*!< @brief ::RSSL_DT_INT, ::RSSL_DT_UINT or ::RSSL_DT_REAL; normally the field's RsslDictionaryEntry::rwfType */
+	RsslInt64		*intValues;		/*!< @brief Values of an ::RSSL_DT_INT column, or the RsslReal::value of an ::RSSL_DT_REAL column */
+	RsslUInt64		*uintValues;	/*!< @brief Values of an ::RSSL_DT_UINT column */
+	RsslUInt8		*hints;			/*!< @brief RsslReal::hint of an ::RSSL_DT_REAL column; optional */
+	RsslUInt8		*status;		/*!< @brief RsslFieldColumnStatus of each row */
+} RsslFieldColumn;
+
+/**
+ * @brief A set of columns filled one row per RsslFieldList by rsslDecodeFieldListColumns().
+ * @see RsslFieldColumn, RSSL_INIT_FIELD_COLUMN_BATCH, rsslClearFieldColumnBatch
+ */
+typedef struct {
+	RsslFieldColumn	*columns;		/*!< @brief The columns to fill */
+	RsslUInt32		columnCount;	/*!< @brief Number of columns */
+	RsslUInt32		maxRows;		/*!< @brief Number of rows each column's arrays can hold */
+	RsslUInt32		rowCount;		/*!< @brief Number of rows filled so far */
+} RsslFieldColumnBatch;
+
+/**
+ * @brief RsslFieldColumnBatch static initializer
+ * @see RsslFieldColumnBatch, rsslClearFieldColumnBatch
+ */
+#define RSSL_INIT_FIELD_COLUMN_BATCH { 0, 0, 0, 0 }
+
+/**
+ * @brief Clears an RsslFieldColumnBatch
+ * @see RsslFieldColumnBatch, RSSL_INIT_FIELD_COLUMN_BATCH
+ */
+RTR_C_INLINE void rsslClearFieldColumnBatch(RsslFieldColumnBatch *pBatch)
+{
+	pBatch->columns = 0;
+	pBatch->columnCount = 0;
+	pBatch->maxRows = 0;
+	pBatch->rowCount = 0;
+}
+
 /**
  *	@}
  */
@@ -250,6 +351,24 @@ RSSL_API RsslRet rsslEncodeFieldEntryComplete(
 							RsslEncodeIterator	*pIter,
 							RsslBool			success );
 
+/** 
+ * @brief 	Encodes an RsslFieldEntry with fixed-width content, so that its value can later be patched in place with the RsslMsgTemplate functions.
+ *
+ * In standard data, RSSL_DT_INT and RSSL_DT_UINT values are encoded with eight bytes of content, and RSSL_DT_REAL values with a 
+ * format byte and an eight byte mantissa.  In set defined data, the entry is encoded as by rsslEncodeFieldEntry(); it is only 
+ * fixed-width if its set type is RSSL_DT_INT_8 or RSSL_DT_UINT_8.
+ *
+ * @param pIter	Pointer to the encode iterator.
+ * @param pField populated RsslFieldEntry to encode.
+ * @param pData Pointer to the RsslInt, RsslUInt, or RsslReal value of the entry.  A blank RsslReal is encoded as a blank slot of full width.
+ * @see RsslEncodeIterator, RsslFieldEntry, RsslMsgTemplate
+ * @return Returns an RsslRet to provide success or failure information.  RSSL_RET_UNSUPPORTED_DATA_TYPE is returned for other types.
+ */
+RSSL_API RsslRet rsslEncodeFieldEntrySlot(
+							RsslEncodeIterator	*pIter,
+							RsslFieldEntry		*pField,
+							const void			*pData );
+
 
 /** 
  * @}
@@ -299,6 +418,99 @@ RSSL_API RsslRet rsslDecodeFieldList(
 RSSL_API RsslRet rsslDecodeFieldEntry(
 							RsslDecodeIterator	*pIter,
 							RsslFieldEntry		*pField );
+
+/**
+ * @brief Indexes every RsslFieldEntry in the RsslFieldList being decoded, in one pass, so they can then be found by field identifier.
+ *
+ * This may be called at any point after rsslDecodeFieldList(); the iterator is left where it was, so sequential decoding can carry on.
+ * Set defined entries are indexed when the set definition was available to rsslDecodeFieldList().
+ *
+ * Typical use:<BR>
+ *  1. Call rsslDecodeFieldList()<BR>
+ *  2. Call rsslIndexFieldList()<BR>
+ *  3. Call rsslDecodeFieldEntryByFid() for each field of interest, decoding its content after each call<BR>
+ *
+ * @param pIter Decode iterator that was passed to rsslDecodeFieldList()
+ * @param pIndex Index to fill in.  RsslFieldListIndex::entries and RsslFieldListIndex::buckets must be set up by the caller.
+ * @see RsslFieldListIndex, rsslDecodeFieldEntryByFid, rsslFindFieldIndexEntry
+ * @return Returns an RsslRet to provide success or failure information.  ::RSSL_RET_BUFFER_TOO_SMALL means RsslFieldListIndex::entries was too small; RsslFieldListIndex::entryCount gives the size needed.
+ */
+RSSL_API RsslRet rsslIndexFieldList(
+							RsslDecodeIterator	*pIter,
+							RsslFieldListIndex	*pIndex );
+
+/**
+ * @brief Finds the first entry in an indexed RsslFieldList that has the given field identifier and is at or after an entry number.
+ *
+ * @param pIndex Index filled in by rsslIndexFieldList()
+ * @param fieldId Field identifier to find
+ * @param startEntry Number of the first entry to consider, counting from 0 in the order of the list
+ * @see rsslIndexFieldList, rsslDecodeFieldEntryFromIndex
+ * @return Returns the entry number, or -1 if there is no such entry
+ */
+RSSL_API RsslInt32 rsslFindFieldIndexEntry(
+							const RsslFieldListIndex	*pIndex,
+							RsslFieldId					fieldId,
+							RsslUInt32					startEntry );
+
+/**
+ * @brief Decodes the RsslFieldEntry with the given entry number from an indexed RsslFieldList.
+ *
+ * The iterator is left as rsslDecodeFieldEntry() would leave it after that entry: its content can be decoded next, and a following 
+ * call to rsslDecodeFieldEntry() returns the entry after it.
+ *
+ * @param pIter Decode iterator that was passed to rsslIndexFieldList()
+ * @param pIndex Index filled in by rsslIndexFieldList()
+ * @param entryNum Entry number, as returned by rsslFindFieldIndexEntry()
+ * @param pField RsslFieldEntry to decode content into
+ * @see rsslIndexFieldList, rsslFindFieldIndexEntry, rsslDecodeFieldEntryByFid
+ * @return Returns an RsslRet to provide success or failure information
+ */
+RSSL_API RsslRet rsslDecodeFieldEntryFromIndex(
+							RsslDecodeIterator			*pIter,
+							const RsslFieldListIndex	*pIndex,
+							RsslUInt32					entryNum,
+							RsslFieldEntry				*pField );
+
+/**
+ * @brief Decodes the first RsslFieldEntry with the given field identifier from an indexed RsslFieldList.  Fields may be looked up in any order.
+ *
+ * The iterator is left as rsslDecodeFieldEntry() would leave it after that entry, so its content can be decoded next.
+ *
+ * @param pIter Decode iterator that was passed to rsslIndexFieldList()
+ * @param pIndex Index filled in by rsslIndexFieldList()
+ * @param fieldId Field identifier to find
+ * @param pField RsslFieldEntry to decode content into
+ * @see rsslIndexFieldList, rsslDecodeFieldEntryFromIndex
+ * @return Returns an RsslRet to provide success or failure information.  ::RSSL_RET_END_OF_CONTAINER means the list has no entry with this field identifier; the iterator is not changed.
+ */
+RSSL_API RsslRet rsslDecodeFieldEntryByFid(
+							RsslDecodeIterator			*pIter,
+							const RsslFieldListIndex	*pIndex,
+							RsslFieldId					fieldId,
+							RsslFieldEntry				*pField );
+
+/**
+ * @brief Decodes a sequence of encoded RsslFieldLists into columns, one row per RsslFieldList, without decoding the fields that have no column.
+ *
+ * Each RsslFieldList adds a row at RsslFieldColumnBatch::rowCount.  Columns whose field is not in the list are marked ::RSSL_FCS_ABSENT for
+ * that row; if a field appears more than once, the last one is kept.  Standard entries are decoded straight from the buffer; lists that 
+ * carry set defined data are decoded through the iterator functions.  This is meant for a handful of columns, such as the price fields of
+ * a stream of updates.
+ *
+ * @param pBatch Columns to fill
+ * @param pEncFieldLists Encoded RsslFieldLists, such as the RsslMsgBase::encDataBody of a sequence of messages
+ * @param fieldListCount Number of RsslFieldLists
+ * @param pLocalSetDb Local set definitions used by set defined data, if any
+ * @see RsslFieldColumnBatch, RsslFieldColumn
+ * @return Returns an RsslRet to provide success or failure information.  ::RSSL_RET_BUFFER_TOO_SMALL means there are not enough rows left and nothing was decoded.
+ * If an RsslFieldList cannot be decoded, rows up to it are kept and its error is returned.
+ */
+RSSL_API RsslRet rsslDecodeFieldListColumns(
+							RsslFieldColumnBatch	*pBatch,
+							const RsslBuffer		*pEncFieldLists,
+							RsslUInt32				fieldListCount,
+							RsslLocalFieldSetDefDb	*pLocalSetDb );
 				 
 
 /**
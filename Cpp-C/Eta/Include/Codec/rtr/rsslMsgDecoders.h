@@ -65,6 +65,41 @@ RSSL_API RsslRet rsslDecodeMsg(RsslDecodeIterator * pIter, RsslMsg * pMsg);
 RSSL_API RsslRet rsslDecodeMsgKeyAttrib(RsslDecodeIterator *pIter, const RsslMsgKey *pKey);
 
 
+/**
+ * @brief Decodes only the fixed portion of an RsslMsg header, deferring the rest until rsslCompleteLazyMsg() is called.
+ *
+ * Populates RsslMsgBase::msgClass, RsslMsgBase::domainType, RsslMsgBase::streamId, RsslMsgBase::containerType, the class-specific flags
+ * (and RsslUpdateMsg::updateType for update messages), RsslMsgBase::encMsgBuffer and RsslMsgBase::encDataBody. The iterator is left positioned
+ * on the payload exactly as rsslDecodeMsg() leaves it, so container decoding can continue directly.
+ *
+ * The message key, sequence numbers, permission data, extended header, state, group id and other optional members are NOT populated.
+ * Call rsslCompleteLazyMsg() before accessing them.
+ *
+ * Typical use:<BR>
+ *  1. Call rsslDecodeMsgLazy()<BR>
+ *  2. Route or filter on class, domain, stream id and flags<BR>
+ *  3. If any remaining header member is needed, call rsslCompleteLazyMsg()<BR>
+ *
+ * @param pIter Decode iterator to use for decode process
+ * @param pMsg RsslMsg structure to populate with the fixed header members.
+ * @see rsslDecodeMsg, rsslCompleteLazyMsg
+ * @return Returns an RsslRet to provide success or failure information
+ */
+RSSL_API RsslRet rsslDecodeMsgLazy(RsslDecodeIterator * pIter, RsslMsg * pMsg);
+
+/**
+ * @brief Decodes the remaining header members of an RsslMsg populated by rsslDecodeMsgLazy().
+ *
+ * The header is re-read from RsslMsgBase::encMsgBuffer, so no iterator is needed and the payload position of the iterator used
+ * for rsslDecodeMsgLazy() is unaffected. After this call the RsslMsg is identical to one populated by rsslDecodeMsg().
+ *
+ * @param pMsg RsslMsg structure previously populated by rsslDecodeMsgLazy().
+ * @see rsslDecodeMsgLazy
+ * @return Returns an RsslRet to provide success or failure information
+ */
+RSSL_API RsslRet rsslCompleteLazyMsg(RsslMsg * pMsg);
+
+
 /**
  * @}
  */
@@ -325,6 +325,161 @@ RSSL_API RsslRet rsslReplacePostId(
 
 
 
+/**
+ * @brief A patchable field in an \ref RsslMsgTemplate.
+ * @see RsslMsgTemplate, rsslInitMsgTemplate
+ */
+typedef struct
+{
+	RsslFieldId		fieldId;	/*!< @brief The field Id of the entry to patch.  Set by the user before calling rsslInitMsgTemplate(). */
+	RsslUInt8		dataType;	/*!< @brief The type of the slot, RSSL_DT_INT, RSSL_DT_UINT, or RSSL_DT_REAL.  Set by the user before calling rsslInitMsgTemplate(). */
+	RsslUInt32		_offset;	/*!< @brief Offset of the slot's content in the template. */
+} RsslMsgTemplateSlot;
+
+/**
+ * @brief An encoded message whose stream Id, sequence number and chosen field values can be patched in place.
+ *
+ * Message templates let a publisher encode a message once and send many messages from it, changing only the values
+ * that differ.  Each slot must hold a fixed-width value, so the content of a slot never changes size:<BR>
+ *  1. Encode the message as usual, encoding each slot's field entry with rsslEncodeFieldEntrySlot().  Entries in set
+ *     defined data whose set type is RSSL_DT_INT_8 or RSSL_DT_UINT_8 are also fixed-width and may be used as slots.<BR>
+ *  2. Populate \ref RsslMsgTemplate::slots with the field Ids and types to patch and call rsslInitMsgTemplate().<BR>
+ *  3. For each message, call rsslMsgTemplateCopy() to copy the template to the outbound buffer, then the
+ *     rsslMsgTemplateSet functions to patch it.<BR>
+ *
+ * @see RSSL_INIT_MSG_TEMPLATE, rsslClearMsgTemplate, rsslInitMsgTemplate
+ */
+typedef struct
+{
+	RsslBuffer				encMsg;			/*!< @brief The encoded message.  Set by rsslInitMsgTemplate(); the application owns the memory. */
+	RsslMsgTemplateSlot		*slots;			/*!< @brief Slots to patch, populated with field Ids and types by the user. */
+	RsslUInt32				slotCount;		/*!< @brief Number of slots. */
+	RsslInt32				_seqNumOffset;	/*!< @brief Offset of the sequence number in the template, or -1 if the message has none. */
+} RsslMsgTemplate;
+
+/**
+ * @brief Static initializer for the RsslMsgTemplate
+ *
+ * @warning On larger structures, like messages, the clear functions tend to outperform the static initializer.  It is recommended to use the clear function when initializing any messages.
+ *
+ * @see RsslMsgTemplate, rsslClearMsgTemplate
+ */
+#define RSSL_INIT_MSG_TEMPLATE { RSSL_INIT_BUFFER, 0, 0, -1 }
+
+/**
+ * @brief Clears an RsslMsgTemplate
+ * @see RsslMsgTemplate, RSSL_INIT_MSG_TEMPLATE
+ */
+RTR_C_INLINE void rsslClearMsgTemplate(RsslMsgTemplate *pTemplate)
+{
+	rsslClearBuffer(&pTemplate->encMsg);
+	pTemplate->slots = 0;
+	pTemplate->slotCount = 0;
+	pTemplate->_seqNumOffset = -1;
+}
+
+/**
+ * @brief Prepares a message template from an encoded message, finding the position of the sequence number and of each slot.
+ *
+ * @param pTemplate		\ref RsslMsgTemplate with its slots populated with the field Ids and types to patch.
+ * @param pEncMsg		The encoded message, which must have an \ref RsslFieldList payload.  The template refers to this memory.
+ * @param majorVersion	RWF major version of the encoded message.
+ * @param minorVersion	RWF minor version of the encoded message.
+ * @param pLocalSetDb	Set definitions used by the field list, if it contains set defined data.  May be NULL.
+ * @return If RSSL_RET_SUCCESS, the template is ready.  If RSSL_RET_INVALID_DATA, a slot's field was not found or does not
+ *		   hold a fixed-width value.  Other failures are returned from decoding the message.
+ */
+RSSL_API RsslRet rsslInitMsgTemplate(
+                     RsslMsgTemplate		*pTemplate,
+                     RsslBuffer				*pEncMsg,
+                     RsslUInt8				majorVersion,
+                     RsslUInt8				minorVersion,
+                     RsslLocalFieldSetDefDb	*pLocalSetDb );
+
+/**
+ * @brief Copies a message template to a buffer, such as one from rsslGetBuffer(), so that it can be patched.
+ *
+ * @param pTemplate		The \ref RsslMsgTemplate.
+ * @param pMsgBuffer	The buffer to copy to.  Its length is set to the length of the message.
+ * @return If RSSL_RET_SUCCESS, the message was copied.  If RSSL_RET_BUFFER_TOO_SMALL, the buffer cannot hold the message.
+ */
+RSSL_API RsslRet rsslMsgTemplateCopy(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer );
+
+/**
+ * @brief Sets the stream Id in a copy of a message template.
+ *
+ * @param pTemplate		The \ref RsslMsgTemplate the message was copied from.
+ * @param pMsgBuffer	The copied message.
+ * @param streamId		The new stream Id.
+ * @return RSSL_RET_SUCCESS
+ */
+RSSL_API RsslRet rsslMsgTemplateSetStreamId(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslInt32				streamId );
+
+/**
+ * @brief Sets the sequence number in a copy of a message template.
+ *
+ * @param pTemplate		The \ref RsslMsgTemplate the message was copied from.
+ * @param pMsgBuffer	The copied message.
+ * @param seqNum		The new sequence number.
+ * @return If RSSL_RET_SUCCESS, the sequence number was set.  If RSSL_RET_FAILURE, the template has no sequence number.
+ */
+RSSL_API RsslRet rsslMsgTemplateSetSeqNum(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslUInt32				seqNum );
+
+/**
+ * @brief Sets the value of an RSSL_DT_INT slot in a copy of a message template.
+ *
+ * @param pTemplate		The \ref RsslMsgTemplate the message was copied from.
+ * @param pMsgBuffer	The copied message.
+ * @param slot			Index of the slot in \ref RsslMsgTemplate::slots.
+ * @param value			The new value.
+ * @return If RSSL_RET_SUCCESS, the value was set.  If RSSL_RET_INVALID_ARGUMENT, the slot does not exist or is not an RSSL_DT_INT.
+ */
+RSSL_API RsslRet rsslMsgTemplateSetInt(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslUInt32				slot,
+                     RsslInt64				value );
+
+/**
+ * @brief Sets the value of an RSSL_DT_UINT slot in a copy of a message template.
+ *
+ * @param pTemplate		The \ref RsslMsgTemplate the message was copied from.
+ * @param pMsgBuffer	The copied message.
+ * @param slot			Index of the slot in \ref RsslMsgTemplate::slots.
+ * @param value			The new value.
+ * @return If RSSL_RET_SUCCESS, the value was set.  If RSSL_RET_INVALID_ARGUMENT, the slot does not exist or is not an RSSL_DT_UINT.
+ */
+RSSL_API RsslRet rsslMsgTemplateSetUInt(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslUInt32				slot,
+                     RsslUInt64				value );
+
+/**
+ * @brief Sets the value of an RSSL_DT_REAL slot in a copy of a message template.  A blank \ref RsslReal leaves the slot blank.
+ *
+ * @param pTemplate		The \ref RsslMsgTemplate the message was copied from.
+ * @param pMsgBuffer	The copied message.
+ * @param slot			Index of the slot in \ref RsslMsgTemplate::slots.
+ * @param pReal			The new value.
+ * @return If RSSL_RET_SUCCESS, the value was set.  If RSSL_RET_INVALID_ARGUMENT, the slot does not exist or is not an RSSL_DT_REAL.
+ */
+RSSL_API RsslRet rsslMsgTemplateSetReal(
+                     const RsslMsgTemplate	*pTemplate,
+                     RsslBuffer				*pMsgBuffer,
+                     RsslUInt32				slot,
+                     const RsslReal			*pReal );
+
+
+
 /**
  * @}
  */
@@ -123,6 +123,8 @@ typedef struct
 	RsslReactorChannelRoleType		roleType;				/*!< Type indicating the role. Populated by RsslReactorChannelRoleType. */
 	RsslReactorChannelEventCallback	*channelEventCallback;	/*!< Callback function that handles RsslReactorChannelEvents.  Must be provided for all roles. */
 	RsslDefaultMsgCallback			*defaultMsgCallback;	/*!< Callback function that handles RsslMsg events that aren't handled by a specific domain callback. Must be provided for all roles. */
+	RsslBool						lazyMsgDecode;			/*!< When set, messages given to the defaultMsgCallback only have their fixed header decoded (see rsslDecodeMsgLazy() and RsslMsgEvent::lazyMsg).
+															 * Messages handled by the watchlist, tunnel streams, or a domain-specific callback are always fully decoded. */
 } RsslReactorChannelRoleBase;
 
 /**
@@ -284,6 +286,17 @@ RTR_C_INLINE void rsslClearReactorChannelRole(RsslReactorChannelRole *pRole)
 }
 
 
+/**
+ * @brief Mechanism that the RsslReactor and its worker thread use to wait for notification on their channels.
+ * @see RsslCreateReactorOptions
+ */
+typedef enum
+{
+	RSSL_RC_NT_DEFAULT	= 0,	/*!< Uses poll() (select() on Windows). The cost of each wakeup grows with the number of channels. */
+	RSSL_RC_NT_EPOLL	= 1		/*!< Uses level-triggered epoll. The cost of each wakeup depends only on the number of channels that are ready. 
+								 * Available on Linux only; other platforms use RSSL_RC_NT_DEFAULT. */
+} RsslReactorNotifierType;
+
 /**
  * @brief Configuration options for creating an RsslReactor.
  * @see rsslCreateReactor
@@ -302,6 +315,7 @@ typedef struct {
 	RsslInt32	reissueTokenAttemptInterval;	/*!< The interval time for the RsslReactor will wait before attempting to reissue the token, in milliseconds. The minimum interval is 1000 milliseconds */
 	RsslUInt32	restRequestTimeOut;				/*!< Specifies maximum time the request is allowed to take for token service and service discovery, in seconds. If set to 0, there is no timeout */
 	int			port;							/*!< @deprecated DEPRECATED: This parameter no longer has any effect. It was a port used for creating the eventFd descriptor on the RsslReactor. It was never used on Linux or Solaris platforms. */
+	RsslReactorNotifierType	notifierType;	/*!< Specifies the mechanism used to wait for notification on the RsslReactor's channels. Defaults to RSSL_RC_NT_DEFAULT. */
 } RsslCreateReactorOptions;
 
 /**
@@ -630,6 +644,26 @@ RTR_C_INLINE void rsslClearReactorSubmitOptions(RsslReactorSubmitOptions *pOpts)
  */
 RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer *pBuffer, RsslReactorSubmitOptions *pSubmitOptions, RsslErrorInfo *pError);
 
+/**
+ * @brief Sends an array of RsslBuffers to the given RsslReactorChannel, flushing them once.
+ * The buffers are written in order under a single reactor lock with rsslWriteBatch, which suits
+ * providers that send many messages per publishing cycle.  The submit options apply to every buffer; 
+ * pBytesWritten and pUncompressedBytesWritten return the totals for the batch.
+ * Not supported on channels using the JSON protocol or with the watchlist enabled.
+ * @param pReactor The reactor handling the channel to submit the messages to.
+ * @param pChannel The channel to send the messages to.
+ * @param pBuffers The buffers to send.
+ * @param bufferCount Number of buffers in pBuffers.
+ * @param pSubmitOptions Options for how to send the messages.
+ * @param pBuffersSubmitted Returns the number of buffers, from the start of pBuffers, that were taken by the reactor and must not be used again.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return RSSL_RET_SUCCESS, if all buffers were submitted.
+ * @return RSSL_WRITE_CALL_AGAIN, if the buffer at pBuffersSubmitted cannot be written at this time. Submit the remaining buffers again later.
+ * @return failure codes, if the batch could not be written, for example because the channel failed. The buffers from pBuffersSubmitted on are still owned by the application.
+ * @see rsslReactorSubmit, rsslWriteBatch
+ */
+RSSL_VA_API RsslRet rsslReactorSubmitBatch(RsslReactor *pReactor, RsslReactorChannel *pChannel, RsslBuffer **pBuffers, RsslUInt32 bufferCount, RsslReactorSubmitOptions *pSubmitOptions, RsslUInt32 *pBuffersSubmitted, RsslErrorInfo *pError);
+
 /**
   * @brief Options when using rsslReactorSubmitMsg. 
   * Provides simple methods of performing advanced item request behaviors such as batch requests and requesting views(the application may also request these behaviors by encoding them
@@ -151,6 +151,8 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pReactorChanne
 
 /**
  * @brief Changes some aspects of the RsslReactorChannel.
+ * When RSSL_AUTO_PACK_DELAY is set, the Reactor waits up to that long before flushing the channel, so that
+ * auto-packed buffers can fill.
  * @param pReactorChannel The channel to be modified.
  * @param code Code indicating the option to change. See RsslIoctlCodes.
  * @param value Value to change the option to.
@@ -158,13 +160,7 @@ RSSL_VA_API RsslBuffer* rsslReactorPackBuffer(RsslReactorChannel *pReactorChanne
  * @return RsslRet return codes
  * @see RsslReactor, RsslReactorChannel, RsslIoctlCodes, RsslErrorInfo
  */
-RTR_C_INLINE RsslRet rsslReactorChannelIoctl(RsslReactorChannel *pReactorChannel, int code, void *value, RsslErrorInfo *pError)
-{
-	RsslRet ret = rsslIoctl(pReactorChannel->pRsslChannel, (RsslIoctlCodes)code, value, &pError->rsslError);
-	if (ret != RSSL_RET_SUCCESS)
-		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
-	return ret;
-}
+RSSL_VA_API RsslRet rsslReactorChannelIoctl(RsslReactorChannel *pReactorChannel, int code, void *value, RsslErrorInfo *pError);
 
 /**
  *	@}
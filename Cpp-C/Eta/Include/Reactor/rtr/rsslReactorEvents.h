@@ -79,6 +79,7 @@ typedef struct
 	RsslErrorInfo	*pErrorInfo;		/*!< Error information. Present if a problem was encountered, and provides information about the error and its location in the source code. */
 	RsslUInt32		*pSeqNum;			/*!< Sequence number associated with this message. */
 	RsslUInt8		*pFTGroupId;		/*!< FTGroupId associated with this message. */
+	RsslBool		lazyMsg;			/*!< Set when pRsslMsg was decoded with rsslDecodeMsgLazy() (see RsslReactorChannelRoleBase::lazyMsgDecode). Call rsslCompleteLazyMsg() before accessing anything beyond the fixed header. */
 } RsslMsgEvent;
 
 /**
@@ -93,6 +94,7 @@ RTR_C_INLINE void rsslClearMsgEvent(RsslMsgEvent *pEvent)
 	pEvent->pStreamInfo = NULL;
 	pEvent->pSeqNum = NULL;
 	pEvent->pFTGroupId = NULL;
+	pEvent->lazyMsg = RSSL_FALSE;
 }
 
 typedef enum
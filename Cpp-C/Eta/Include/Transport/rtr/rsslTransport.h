@@ -59,7 +59,8 @@ typedef enum {
 typedef enum {
 	RSSL_COMP_NONE	= 0x00,  /*!< (0) No compression will be negotiated. */
 	RSSL_COMP_ZLIB	= 0x01,	 /*!< (1) RSSL will attempt to use Zlib compression. */
-	RSSL_COMP_LZ4	= 0x02	 /*!< (2) RSSL will attempt to use LZ4 compression */
+	RSSL_COMP_LZ4	= 0x02,	 /*!< (2) RSSL will attempt to use LZ4 compression. When both sides support it, each direction is compressed as a stream, so messages can refer to recent ones. */
+	RSSL_COMP_ZSTD	= 0x04	 /*!< (4) RSSL will attempt to use Zstandard compression. If both sides set the same dictionary with rsslSetCompressionDictionary, each message is compressed against it. */
 } RsslCompTypes;
 
 /**
@@ -82,7 +83,11 @@ typedef enum {
 										 /*!< (12) Reserved */
 										 /*!< (13) Reserved */
 	RSSL_REGISTER_HASH_ID			= 14, /*!< (14) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Registers a hash so that a filtering-enabled channel allows it. */
-	RSSL_UNREGISTER_HASH_ID			= 15 /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_UNREGISTER_HASH_ID			= 15, /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_AUTO_PACK_SIZE				= 16, /*!< (16) Channel: Used with ::RSSL_CONN_TYPE_SOCKET connections. When non-zero, messages that fit are packed together by rsslWrite into buffers of up to this many bytes (0 turns auto-packing off, the default). */
+	RSSL_AUTO_PACK_DELAY			= 17, /*!< (17) Channel: Used with ::RSSL_CONN_TYPE_SOCKET connections. The longest time, in microseconds, that a message may wait in an auto-packed buffer. The next rsslWrite or rsslFlush after this time sends the buffer; the Reactor calls rsslFlush by this time on its own. */
+	RSSL_PRIORITY_FLUSH_QUANTA		= 18, /*!< (18) Channel: Used with ::RSSL_CONN_TYPE_SOCKET connections. Takes an array of three RsslUInt32 byte quanta, indexed by ::RsslWritePriorities. When set, queued buffers are flushed by byte-weighted deficit round robin instead of the ::RSSL_PRIORITY_FLUSH_ORDER pattern, so each priority gets a share of the bandwidth in proportion to its quantum. All zeros goes back to the flush order (the default). */
+	RSSL_IO_URING					= 19  /*!< (19) Channel: Used with channels connected or accepted with RsslTcpOpts::io_uring. Takes a pointer to an RsslIoUring* from rsslCreateIoUring, and must be set before the channel becomes active. The channel's writes then wait for rsslIoUringSubmit, which sends them together with those of every other channel on the same ring. Other channels ignore it. */
 } RsslIoctlCodes;
 
 /**
@@ -97,7 +102,8 @@ typedef enum {
 	RSSL_CONN_TYPE_RELIABLE_MCAST	= 4,   /*!< (4) Channel is a reliable multicast based connection. This can be on a unified/mesh network where send and receive networks are the same or a segmented network where send and receive networks are different */
 	RSSL_CONN_TYPE_EXT_LINE_SOCKET  = 5,   /*!< (5) Channel is using an extended line socket transport */	
 	RSSL_CONN_TYPE_SEQ_MCAST		= 6,   /*!< (6) Channel is an unreliable, sequenced multicast connection for reading from an Elektron Direct Feed system. This is a client-only, read-only transport. This transport is supported on Linux only. */
-	RSSL_CONN_TYPE_WEBSOCKET		= 7    /*!< (7) Channel is a WebSocket connection type. */
+	RSSL_CONN_TYPE_WEBSOCKET		= 7,   /*!< (7) Channel is a WebSocket connection type. */
+	RSSL_CONN_TYPE_BIDIR_SHMEM		= 8    /*!< (8) Channel is a two-way shared memory connection between processes on the same host. This transport is supported on Linux only. */
 } RsslConnectionTypes;
 
 /**
@@ -298,6 +304,38 @@ typedef struct {
 	RsslUInt64		retransPktsRcvd;	/*!< @brief This is the number of retransmitted packets received by this channel, populated only for reliable multicast connection types.  This value includes retransmit packets for both multicast and unicast data.  Positive values indicate a possible network problem, more severe as value is larger */
 } RsslMCastStats;
 
+/**
+ * @brief Index of the A line in RsslChannelInfo::seqMcastLineStats.
+ * @see RsslSeqMcastLineStats
+ */
+#define RSSL_SEQ_MCAST_LINE_A 0
+
+/**
+ * @brief Index of the B line in RsslChannelInfo::seqMcastLineStats.
+ * @see RsslSeqMcastLineStats
+ */
+#define RSSL_SEQ_MCAST_LINE_B 1
+
+/**
+ * @brief Number of lines an arbitrated sequenced multicast channel reads from.
+ * @see RsslSeqMcastLineStats
+ */
+#define RSSL_SEQ_MCAST_MAX_LINES 2
+
+/**
+ * @brief Per-line statistics of an arbitrated sequenced multicast channel, returned by the rsslGetChannelInfo call.
+ * Only populated when RsslSeqMCastOpts::lineBAddress was set on rsslConnect.
+ * @see rsslGetChannelInfo
+ * @see RsslChannelInfo
+ * @see RsslSeqMCastOpts
+ */
+typedef struct {
+	RsslUInt64		pktsRcvd;			/*!< @brief This is the number of packets received on this line */
+	RsslUInt64		wins;				/*!< @brief This is the number of sequence numbers whose copy from this line was delivered, because it was read before the other line's copy */
+	RsslUInt64		losses;				/*!< @brief This is the number of packets from this line that were dropped, because the other line's copy of the sequence number was already delivered */
+	RsslUInt64		gaps;				/*!< @brief This is the number of sequence numbers that were skipped on this line.  Positive values indicate packet loss on this line, but not necessarily on the channel */
+} RsslSeqMcastLineStats;
+
 
 /**
 * @brief Options of which locks are enabled in RSSL.
@@ -306,7 +344,9 @@ typedef struct {
 typedef enum
 {
 	RSSL_TCP_STATS_NONE = 0,					/*!< (0x00) Initialization value, nothing has been set to this flag set */
-	RSSL_TCP_STATS_RETRANSMIT = 0x01			/*!< (0x01) TCP Retransmission count has been set */
+	RSSL_TCP_STATS_RETRANSMIT = 0x01,			/*!< (0x01) TCP Retransmission count has been set */
+	RSSL_TCP_STATS_WRITE = 0x02,				/*!< (0x02) Write call and auto-packing counts have been set */
+	RSSL_TCP_STATS_PRIORITY_QUEUES = 0x04		/*!< (0x04) Per-priority output queue figures have been set */
 } RsslStatFlags;
 
 /**
@@ -317,6 +357,14 @@ typedef enum
 typedef struct {
 	RsslUInt	flags;						/*!< @brief Flags indicating set figures in these statistics */
 	RsslInt64 tcpRetransmitCount;			/*!< @brief This is number of TCP retransmissions for the current TCP connection. */
+	RsslUInt64 writeCallCount;				/*!< @brief This is the number of socket write calls made on this channel. */
+	RsslUInt64 autoPackedMsgCount;			/*!< @brief This is the number of messages sent in auto-packed buffers. */
+	RsslUInt64 autoPackedBufferCount;		/*!< @brief This is the number of auto-packed buffers sent. */
+	RsslUInt64 autoPackDelayUsec;			/*!< @brief This is the total time, in microseconds, that auto-packed messages waited before their buffer was sent. */
+	RsslUInt64 priorityQueuedBytes[3];		/*!< @brief This is the number of bytes waiting to be flushed, indexed by ::RsslWritePriorities. */
+	RsslUInt64 priorityFlushedBufferCount[3];	/*!< @brief This is the number of queued buffers that have since been flushed, indexed by ::RsslWritePriorities. */
+	RsslUInt64 priorityQueueDelayUsec[3];	/*!< @brief This is the total time, in microseconds, that the flushed buffers waited in their queue, indexed by ::RsslWritePriorities. Only buffers queued while ::RSSL_PRIORITY_FLUSH_QUANTA are set are measured. */
+	RsslUInt64 priorityMaxQueueDelayUsec[3];	/*!< @brief This is the longest time, in microseconds, that a flushed buffer waited in its queue, indexed by ::RsslWritePriorities. Only buffers queued while ::RSSL_PRIORITY_FLUSH_QUANTA are set are measured. */
 } RsslTCPStats;
 
 /**
@@ -366,6 +414,7 @@ typedef struct {
 	RsslUInt32			componentInfoCount;		 /*!< @brief Number of RsslComponentInfo structures contained in the dynamic componentInfo array */
 	RsslComponentInfo**	componentInfo;			 /*!< @brief A variable length array that contains product version information for the component(s) that this RsslChannel is connected to. The number of RsslComponentInfo structures present in array is indicated by componentInfoCount.  */
 	RsslUInt64			encryptionProtocol;		 /*!< @brief Current encryption protocol used. */
+	RsslSeqMcastLineStats	seqMcastLineStats[RSSL_SEQ_MCAST_MAX_LINES]; /*!< @brief When using an arbitrated sequenced multicast connection, this will be populated with statistics for each line, indexed by RSSL_SEQ_MCAST_LINE_A and RSSL_SEQ_MCAST_LINE_B */
 } RsslChannelInfo;
 
 /**
@@ -452,9 +501,10 @@ RSSL_API RsslInt32 rsslBufferUsage(RsslChannel *chnl,
  */
 typedef struct {
 	RsslBool			tcp_nodelay;			/*!< @brief Only used with connectionType of ::RSSL_CONN_TYPE_SOCKET.  If RSSL_TRUE, disables Nagle's Algorithm. */
+	RsslBool			io_uring;				/*!< @brief Only used on Linux with non-blocking ::RSSL_CONN_TYPE_SOCKET and ::RSSL_CONN_TYPE_WEBSOCKET channels.  If RSSL_TRUE, the channel sends through an io_uring once it is active: one shared with other channels if set with ::RSSL_IO_URING, otherwise one of its own.  RsslChannel::socketId stays the socket, and is only writable when the channel can take more data.  The channel keeps using normal socket calls if the kernel does not support it. */
 } RsslTcpOpts;
 
-#define RSSL_INIT_TCP_OPTS { RSSL_FALSE }
+#define RSSL_INIT_TCP_OPTS { RSSL_FALSE, RSSL_FALSE }
 
 typedef enum {
 	RSSL_MCAST_NO_FLAGS				= 0x00, /*!< @brief None. */
@@ -511,9 +561,12 @@ typedef struct {
 typedef struct {
 	RsslUInt32		maxMsgSize;			/*!<  @brief Maximum size of messages that the SEQ_MCAST transport will read. */
 	RsslUInt16		instanceId;			/*!<  @brief This is used, when combined with the origin IP address and port, to uniquely identify a sequenced multicast channel. */
+	RsslUInt32		readBatchSize;		/*!<  @brief Maximum number of packets read from the network with one system call (Linux only).  rsslRead returns the messages of each packet in turn before reading again.  0 or 1 reads one packet at a time. */
+	char*			lineBAddress;		/*!<  @brief Multicast group of a redundant B line (Linux only).  When set, the channel also joins this group and delivers whichever copy of each sequence number it reads first from the A line (RsslConnectOptions::connectionInfo::segmented::recvAddress) or the B line, dropping the other.  Both lines must carry the same publisher's packets.  Retransmitted packets are not arbitrated. */
+	char*			lineBServiceName;	/*!<  @brief Port or service name of the B line.  If not set, the A line's recvServiceName is used. */
 } RsslSeqMCastOpts;
 
-#define RSSL_INIT_SEQ_MCAST_OPTS { 3000, 0 }
+#define RSSL_INIT_SEQ_MCAST_OPTS { 3000, 0, 0, 0, 0 }
 typedef struct {
 	char* proxyHostName;				/*!<  @brief Proxy host name. */
 	char* proxyPort;					/*!<  @brief Proxy port. */
@@ -694,6 +747,7 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.io_uring = RSSL_FALSE;
 	opts->multicastOpts.flags = RSSL_MCAST_NO_FLAGS;
 	opts->multicastOpts.disconnectOnGaps = RSSL_FALSE;
 	opts->multicastOpts.packetTTL = 5;
@@ -719,6 +773,9 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->sysRecvBufSize = 0;
 	opts->seqMulticastOpts.maxMsgSize = 3000;
 	opts->seqMulticastOpts.instanceId = 0;
+	opts->seqMulticastOpts.readBatchSize = 0;
+	opts->seqMulticastOpts.lineBAddress = 0;
+	opts->seqMulticastOpts.lineBServiceName = 0;
 	opts->proxyOpts.proxyHostName = 0;
 	opts->proxyOpts.proxyPort = 0;
 	opts->componentVersion = NULL;
@@ -885,6 +942,18 @@ typedef struct {
 
 
 #define RSSL_INIT_BIND_ENCRYPTION_OPTS { RSSL_ENC_TLSV1_2, NULL, NULL, NULL, NULL}
+
+/**
+ * @brief Options used for configuring the shared memory segment created by a server (::RSSL_CONN_TYPE_UNIDIR_SHMEM).
+ * @see rsslBind
+ * @see RsslBindOptions
+ */
+typedef struct {
+	RsslBool		variableLengthRing;		/*!< @brief If RSSL_TRUE, each message takes only its written length in the shared memory segment instead of a buffer of maxFragmentSize. The segment holds as many bytes as maxOutputBuffers buffers of maxFragmentSize, so it holds many more small messages. Clients built before this option was added cannot connect to such a segment. */
+	RsslBool		futexWakeup;			/*!< @brief If RSSL_TRUE, blocking clients sleep until the server writes instead of polling the segment. Only used with variableLengthRing, and only on Linux. */
+} RsslBindShmemOpts;
+
+#define RSSL_INIT_BIND_SHMEM_OPTS { RSSL_FALSE, RSSL_FALSE }
  
 /**
  * @brief RSSL Bind Options used in the rsslBind call.
@@ -922,6 +991,7 @@ typedef struct {
 	char*			componentVersion;		/*!< @brief User defined component version information */
 	RsslWSocketOpts	wsOpts;					/*!< @brief WebSocket transport options for RSSL_CONN_TYPE_WEBSOCKET */
 	RsslBindEncryptionOpts encryptionOpts;	/*!< @brief Encryption options. */
+	RsslBindShmemOpts shmemOpts;			/*!< @brief Shared memory transport options (used by ::RSSL_CONN_TYPE_UNIDIR_SHMEM). */
 } RsslBindOptions;
 
 
@@ -929,7 +999,7 @@ typedef struct {
  * @brief RSSL Bind Options initialization
  * @see RsslBindOptions
  */
-#define RSSL_INIT_BIND_OPTS { 0, 0, RSSL_COMP_NONE, 0, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_TRUE, RSSL_TRUE, RSSL_CONN_TYPE_SOCKET, 60, 20, 6144, 50, 50, 10, 0, RSSL_FALSE, 0, 0, 0, 0, 0, 0, RSSL_INIT_TCP_OPTS, 0, RSSL_INIT_WEBSOCKET_OPTS, RSSL_INIT_BIND_ENCRYPTION_OPTS }
+#define RSSL_INIT_BIND_OPTS { 0, 0, RSSL_COMP_NONE, 0, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_TRUE, RSSL_TRUE, RSSL_CONN_TYPE_SOCKET, 60, 20, 6144, 50, 50, 10, 0, RSSL_FALSE, 0, 0, 0, 0, 0, 0, RSSL_INIT_TCP_OPTS, 0, RSSL_INIT_WEBSOCKET_OPTS, RSSL_INIT_BIND_ENCRYPTION_OPTS, RSSL_INIT_BIND_SHMEM_OPTS }
 
 /**
  * @brief Clears RSSL Bind Options 
@@ -966,6 +1036,7 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.io_uring = RSSL_FALSE;
 	opts->sysSendBufSize = 0;
 	opts->sysRecvBufSize = 0;
 	opts->componentVersion = NULL;
@@ -976,6 +1047,8 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->encryptionOpts.encryptionProtocolFlags = RSSL_ENC_TLSV1_2;
 	opts->encryptionOpts.serverCert = NULL;
 	opts->encryptionOpts.serverPrivateKey = NULL;
+	opts->shmemOpts.variableLengthRing = RSSL_FALSE;
+	opts->shmemOpts.futexWakeup = RSSL_FALSE;
 }
 
 /**
@@ -1180,7 +1253,9 @@ RSSL_API RsslRet rsslCloseChannel(RsslChannel *chnl,
  * @see rsslReadEx
  */
 typedef enum {
-	RSSL_READ_IN_NO_FLAGS		= 0x00	/*!< (0x00) No read flags*/
+	RSSL_READ_IN_NO_FLAGS		= 0x00,	/*!< (0x00) No read flags*/
+	RSSL_READ_IN_PIN_BUFFER		= 0x01	/*!< (0x01) Keep the returned buffer valid across later reads, until rsslReleaseReadBuffers is called or a read is done without this flag. 
+										 * Only buffers returned with ::RSSL_READ_OUT_PINNED_BUFFER set are pinned. */
 } RsslReadFlagsIn;
 
 
@@ -1208,7 +1283,9 @@ typedef enum {
 	RSSL_READ_OUT_HASH_ID		= 0x0008,	/*!< (0x08) set when a hash ID is returned */
 	RSSL_READ_OUT_UNICAST		= 0x0010,	/*!< (0x10) set when the message was sent unicast to this node */
 	RSSL_READ_OUT_INSTANCE_ID	= 0x0020,	/*!< (0x20) set when the message has an instance ID set */
-	RSSL_READ_OUT_RETRANSMIT     = 0x0040  	/*!< (0x40) indicates that this message is a retransmission of previous content*/
+	RSSL_READ_OUT_RETRANSMIT     = 0x0040,  	/*!< (0x40) indicates that this message is a retransmission of previous content*/
+	RSSL_READ_OUT_PINNED_BUFFER	= 0x0080	/*!< (0x80) set when the returned buffer points into the channel's input buffer and stays valid until rsslReleaseReadBuffers is called. 
+											 * Only uncompressed, unfragmented messages read with ::RSSL_READ_IN_PIN_BUFFER on RSSL_CONN_TYPE_SOCKET or RSSL_CONN_TYPE_ENCRYPTED channels are pinned. */
 } RsslReadOutFlags;
 
 typedef struct {
@@ -1312,6 +1389,25 @@ RSSL_API RsslBuffer* rsslReadEx(	RsslChannel *chnl,
 											RsslRet *readRet,
 											RsslError *error);
 
+/**
+ * @brief Releases buffers pinned by rsslReadEx
+ *
+ * Typical use:<BR>
+ * When rsslReadEx is called with ::RSSL_READ_IN_PIN_BUFFER, buffers returned with 
+ * ::RSSL_READ_OUT_PINNED_BUFFER point directly into the channel's input buffer and 
+ * stay valid across later reads, so the application can keep several messages without copying them. 
+ * The application must copy the RsslBuffer structure itself, as the same structure is returned by every read.
+ * rsslReleaseReadBuffers makes the input buffer space they occupy available again. Pinned buffers are also 
+ * released by a read done without ::RSSL_READ_IN_PIN_BUFFER. If pinned buffers fill the input buffer, 
+ * rsslReadEx returns ::RSSL_RET_BUFFER_NO_BUFFERS until they are released.
+ *
+ * @param chnl RSSL Channel whose pinned read buffers are released
+ * @param error RSSL Error, to be populated in event of an error
+ * @return RsslRet RSSL return value
+ */
+RSSL_API RsslRet rsslReleaseReadBuffers(	RsslChannel *chnl,
+											RsslError *error);
+
 /**
  *	@}
  */
@@ -1530,6 +1626,42 @@ RSSL_API RsslRet rsslWriteEx(RsslChannel *chnl,
 									 RsslWriteOutArgs *writeOutArgs,
 									 RsslError	*error);
 
+/**
+ * @brief Writes an array of buffers on a given channel and flushes them once
+ *
+ * Typical use:<BR>
+ * rsslWriteBatch is called after a number of buffers are obtained with rsslGetBuffer and 
+ * populated, for example the updates of one publishing cycle.  The buffers are queued in order
+ * with the flags and priority in writeInArgs, then everything queued on the channel is flushed once.
+ * This saves the per message locking and flushing that calling rsslWrite for each buffer incurs.
+ * The bytes written for all buffers are summed in writeOutArgs.
+ *
+ * @note buffersWritten returns how many buffers, from the start of the array, were taken by RSSL and
+ * must not be used or released again.  If RSSL_RET_WRITE_CALL_AGAIN is returned, the buffer at
+ * buffersWritten was partially written; call rsslWriteBatch again starting with that buffer.
+ * RSSL_RET_WRITE_FLUSH_FAILED means every buffer was taken but flushing failed.  If a flush fails and
+ * closes the channel before the whole batch is taken, RSSL_RET_FAILURE is returned and the buffers from
+ * buffersWritten on are still owned by the caller.
+ * Channels that do not support batching write each buffer in turn and flush once.
+ *
+ * @param chnl RSSL Channel to write to
+ * @param buffers Array of buffers to write
+ * @param bufferCount Number of buffers in the array
+ * @param writeInArgs RSSL Write Input Arguments, applied to every buffer
+ * @param writeOutArgs RSSL Write Output Arguments
+ * @param buffersWritten Returns the number of buffers taken by RSSL
+ * @param error RSSL Error, to be populated in event of an error
+ * @return RsslRet RSSL return value or the number of bytes pending flush
+ * @see rsslWriteEx
+ */
+RSSL_API RsslRet rsslWriteBatch(RsslChannel *chnl,
+									 RsslBuffer **buffers,
+									 RsslUInt32 bufferCount,
+									 RsslWriteInArgs *writeInArgs,
+									 RsslWriteOutArgs *writeOutArgs,
+									 RsslUInt32 *buffersWritten,
+									 RsslError	*error);
+
 
 /**
  * @brief Flushes data waiting to be written on a given channel
@@ -1758,6 +1890,79 @@ typedef enum {
 	RSSL_DEBUG_RSSL_DUMP_OUT = 0x0020, /*!<(0x0020) Dump outgoing RSSL messages as they are passed to the transport */
 } RsslDebugFlags;
 
+/**
+* @brief Sets the dictionary used by Zstandard (RSSL_COMP_ZSTD) compression
+*
+* Typical use:<BR>
+* Small messages compress poorly on their own.  A dictionary trained from
+* captured RWF traffic (see the ZstdDictTrainer tool) gives each message the
+* field ids, enumerations and item names it is likely to contain, so even a
+* short update compresses well.<BR>
+* The client sends the id of its dictionary when it connects.  When the server
+* has a dictionary with the same id, both sides of the channel compress each
+* message against it.  Otherwise, or when either side has no dictionary, the
+* channel compresses a continuous stream, as zlib does.<BR>
+* The dictionary is global and applies to channels that are connected or
+* accepted after this call.  Passing NULL, or a buffer with a length of zero,
+* removes the dictionary.  The contents are copied, so the buffer can be
+* released once this returns.
+* @param pDictionary Dictionary contents, or NULL to remove the dictionary
+* @param error	Rssl Error, to be populated in event of an error
+* @return RsslRet RSSL return value
+* @see RsslCompTypes
+*/
+RSSL_API RsslRet rsslSetCompressionDictionary(RsslBuffer *pDictionary, RsslError *error);
+
+/**
+ * @brief An io_uring that channels can share to send their writes together
+ * @see rsslCreateIoUring
+ */
+typedef struct RsslIoUring RsslIoUring;
+
+/**
+ * @brief Creates an io_uring for channels to share
+ *
+ * Typical use:<BR>
+ * An application that services many channels from one thread creates one
+ * RsslIoUring and gives it to each channel with rsslIoctl(::RSSL_IO_URING)
+ * while the channel is initializing.  Writes and flushes on those channels
+ * are then copied into registered send buffers, and rsslIoUringSubmit hands
+ * all of them to the kernel in a single system call.  The Reactor does this
+ * for its channels that set RsslTcpOpts::io_uring.<BR>
+ * Only available on Linux kernels that support io_uring.
+ *
+ * @param error Rssl Error, to be populated in event of an error
+ * @return The ring, or NULL if io_uring is not available
+ * @see rsslIoUringSubmit
+ * @see rsslDestroyIoUring
+ */
+RSSL_API RsslIoUring* rsslCreateIoUring(RsslError *error);
+
+/**
+ * @brief Sends what was written to the ring's channels since the last submit
+ *
+ * Typical use:<BR>
+ * Called once after each pass over the channels that write or flush, and
+ * after any write made outside such a pass, since written data is not sent
+ * until then.  Costs no system call when there is nothing to send.
+ *
+ * @param pIoUring Ring from rsslCreateIoUring
+ * @param error Rssl Error, to be populated in event of an error
+ * @return The number of channels that started a send, or RSSL_RET_FAILURE
+ */
+RSSL_API RsslInt32 rsslIoUringSubmit(RsslIoUring *pIoUring, RsslError *error);
+
+/**
+ * @brief Destroys a ring from rsslCreateIoUring
+ *
+ * The ring is freed once the last channel using it is closed.
+ *
+ * @param pIoUring Ring from rsslCreateIoUring
+ * @param error Rssl Error, to be populated in event of an error
+ * @return RsslRet RSSL return value
+ */
+RSSL_API RsslRet rsslDestroyIoUring(RsslIoUring *pIoUring, RsslError *error);
+
 /**
 * @brief Sets the debug functions for RSSL
 *
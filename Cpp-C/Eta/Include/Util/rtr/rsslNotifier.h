@@ -12,6 +12,7 @@
   * 
   * Overview of usage:
   * - rsslCreateNotifier creates an RsslNotifier that can wait on file descriptors.
+  *     rsslCreateNotifierEx does the same, but lets the caller choose the notification mechanism (see RsslNotifierType).
   * - rsslCreateNotifierEvent creates an RsslNotifierEvent, associated with a file descriptor.
   * - rsslNotifierAddEvent adds the RsslNotifierEvent to the RsslNotifier.
   * - rsslNotifierRegisterRead/rsslNotifierRegisterWrite enable read/write notification for the RsslNotifierEvent.
@@ -67,7 +68,8 @@ RTR_C_INLINE int rsslNotifierEventIsWritable(RsslNotifierEvent *pEvent)
 
 /* Indicates whether the event's file descriptor may be invalid.  The event may need its associated FD to be updated.
  *   Note: When the notifier uses select for notification, this will be set on every descriptor when
- *   it sees the EBADF error. When the notifier uses poll, it will be set only on appropriate events. */
+ *   it sees the EBADF error. When the notifier uses poll, it will be set only on appropriate events.
+ *   When the notifier uses epoll, it will be set on events whose descriptor could not be registered with epoll. */
 RTR_C_INLINE int rsslNotifierEventIsFdBad(RsslNotifierEvent *pEvent)
 {
 	return pEvent->notifiedFlags & RSSL_NESF_BAD_FD;
@@ -88,6 +90,21 @@ RSSL_API void rsslDestroyNotifierEvent(RsslNotifierEvent *pEvent);
 /* Returns the object associated with this event. */
 RSSL_API void *rsslNotifierEventGetObject(RsslNotifierEvent *pEvent);
 
+/* Returns the file descriptor currently associated with this event. */
+RSSL_API RsslSocket rsslNotifierEventGetFd(RsslNotifierEvent *pEvent);
+
+/* Notification mechanisms that an RsslNotifier may use. */
+typedef enum
+{
+	RSSL_NOTIFIER_TYPE_DEFAULT = 0,		/* poll() (select() on Windows). Each wait scans every associated event. */
+	RSSL_NOTIFIER_TYPE_EPOLL = 1,		/* Level-triggered epoll. The cost of a wait depends only on the number of events that were 
+										 * triggered. Linux only; other platforms use RSSL_NOTIFIER_TYPE_DEFAULT. */
+	RSSL_NOTIFIER_TYPE_EPOLL_EDGE = 2	/* Edge-triggered epoll. A triggered event keeps its notified flags, and stays in the 
+										 * notifiedEvents array on subsequent waits, until rsslNotifierEventClearNotifiedFlags is called on it. 
+										 * The application should only clear the flags once it has read (or written) until the call would block.
+										 * Linux only; other platforms use RSSL_NOTIFIER_TYPE_DEFAULT. */
+} RsslNotifierType;
+
 /* Used to wait for notification.
  * Triggers on any of the RsslNotifierEvents associated with it. */
 typedef struct
@@ -100,6 +117,14 @@ typedef struct
  * - maxEventsHint: The likely max number of associated events. Setting appropriately may improve performance. */
 RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint);
 
+/* Initializes an RsslNotifier that uses the specified notification mechanism.
+ * - maxEventsHint: The likely max number of associated events. Setting appropriately may improve performance.
+ * - notifierType: The notification mechanism to use. See RsslNotifierType. */
+RSSL_API RsslNotifier *rsslCreateNotifierEx(int maxEventsHint, RsslNotifierType notifierType);
+
+/* Returns the notification mechanism that the RsslNotifier is using. */
+RSSL_API RsslNotifierType rsslNotifierGetType(RsslNotifier *pNotifier);
+
 /* Cleans up resources associated with an RsslNotifier. */
 RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier);
 
@@ -0,0 +1,232 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+/* Implements an open-addressing hash table for the same intrusive RsslHashLink used by the RsslHashTable.
+ * Links are stored in a single array of slots (Robin Hood hashing with backward-shift deletion), so a lookup
+ * walks a few adjacent slots instead of a linked list.  Each slot keeps the link's hash sum, so keys are
+ * only compared (and links only dereferenced) when the sums match.
+ *
+ * Unlike the RsslHashTable, links cannot be visited by walking queues; the RsslHashLink's queueLink is unused. */
+
+#ifndef RSSL_OPEN_HASH_TABLE_H
+#define RSSL_OPEN_HASH_TABLE_H
+
+#include "rtr/rsslHashTable.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Open hash table slot. */
+typedef struct
+{
+	RsslUInt32		hashSum;		/* Hash sum of the link. */
+	RsslUInt32		probeLength;	/* Distance of the slot from the link's home slot, plus one. Zero if the slot is empty. */
+	RsslHashLink	*pLink;
+} RsslOpenHashSlot;
+
+/* Open Hash Table structure. */
+typedef struct {
+	RsslUInt32				slotCount;			/* Number of slots. Always a power of two. */
+	RsslUInt32				slotShift;			/* Shift that maps a scrambled hash sum to a slot. */
+	RsslUInt32				elementCount;
+	RsslUInt32				thresholdCapacity;	/* Element count at which the table grows. */
+	RsslOpenHashSlot		*slots;
+	RsslHashSumFunction		*keyHashFunction;
+	RsslHashCompareFunction	*keyCompareFunction;
+} RsslOpenHashTable;
+
+/* Tables grow when they are more than 80% full. */
+#define RSSL_OPEN_HASH_TABLE_THRESHOLD(__slotCount) ((__slotCount) / 5 * 4)
+
+/* Hash sums are scrambled before being mapped to a slot, so simple sums (such as the integer hash functions)
+ * still spread across the table. */
+#define RSSL_OPEN_HASH_TABLE_HOME(__pTable, __hashSum) ((RsslUInt32)((__hashSum) * 2654435769U) >> (__pTable)->slotShift)
+
+/* Initializes an open hash table, sized to hold elementCount links before it needs to grow.
+ * Since an open table cannot hold more links than it has slots, it always grows when needed;
+ * dynamicSize is accepted for compatibility with rsslHashTableInit. */
+RTR_C_INLINE RsslRet rsslOpenHashTableInit(RsslOpenHashTable *pTable, RsslUInt32 elementCount,
+		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
+		RsslBool dynamicSize, RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 slotCount = 8, slotShift = 29;
+
+	while (RSSL_OPEN_HASH_TABLE_THRESHOLD(slotCount) < elementCount && slotShift > 1)
+	{
+		slotCount *= 2;
+		--slotShift;
+	}
+
+	pTable->slots = (RsslOpenHashSlot*)calloc(slotCount, sizeof(RsslOpenHashSlot));
+	if (!pTable->slots)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Failed to allocate open hash table slots.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pTable->slotCount = slotCount;
+	pTable->slotShift = slotShift;
+	pTable->elementCount = 0;
+	pTable->thresholdCapacity = RSSL_OPEN_HASH_TABLE_THRESHOLD(slotCount);
+	pTable->keyHashFunction = keyHashFunction;
+	pTable->keyCompareFunction = keyCompareFunction;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Cleans up an open hash table. */
+RTR_C_INLINE RsslRet rsslOpenHashTableCleanup(RsslOpenHashTable *pTable)
+{
+	free(pTable->slots);
+	pTable->slots = NULL;
+	pTable->elementCount = 0;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Places a link in its slot, displacing links that are closer to their home slot. */
+RTR_C_INLINE void rsslOpenHashTablePlaceLink(RsslOpenHashTable *pTable, RsslHashLink *pLink)
+{
+	RsslUInt32 slotMask = pTable->slotCount - 1;
+	RsslUInt32 index = RSSL_OPEN_HASH_TABLE_HOME(pTable, pLink->hashSum);
+	RsslOpenHashSlot entry, swap;
+
+	entry.hashSum = pLink->hashSum;
+	entry.probeLength = 1;
+	entry.pLink = pLink;
+
+	for(;;)
+	{
+		RsslOpenHashSlot *pSlot = &pTable->slots[index];
+
+		if (pSlot->probeLength == 0)
+		{
+			*pSlot = entry;
+			return;
+		}
+
+		if (pSlot->probeLength < entry.probeLength)
+		{
+			swap = *pSlot;
+			*pSlot = entry;
+			entry = swap;
+		}
+
+		index = (index + 1) & slotMask;
+		++entry.probeLength;
+	}
+}
+
+/* Doubles the number of slots. */
+RTR_C_INLINE RsslRet rsslOpenHashTableResize(RsslOpenHashTable *pTable)
+{
+	RsslOpenHashSlot *pOldSlots = pTable->slots;
+	RsslUInt32 oldSlotCount = pTable->slotCount;
+	RsslUInt32 i;
+
+	if (pTable->slotShift <= 1)
+		return RSSL_RET_FAILURE;
+
+	if (!(pTable->slots = (RsslOpenHashSlot*)calloc((size_t)oldSlotCount * 2, sizeof(RsslOpenHashSlot))))
+	{
+		pTable->slots = pOldSlots;
+		return RSSL_RET_FAILURE;
+	}
+
+	pTable->slotCount = oldSlotCount * 2;
+	--pTable->slotShift;
+	pTable->thresholdCapacity = RSSL_OPEN_HASH_TABLE_THRESHOLD(pTable->slotCount);
+
+	for (i = 0; i < oldSlotCount; ++i)
+	{
+		if (pOldSlots[i].probeLength)
+			rsslOpenHashTablePlaceLink(pTable, pOldSlots[i].pLink);
+	}
+
+	free(pOldSlots);
+	return RSSL_RET_SUCCESS;
+}
+
+/* Add an element to the open hash table.  Fails only if the table needs to grow and cannot. */
+RTR_C_INLINE RsslRet rsslOpenHashTableInsertLink(RsslOpenHashTable *pTable, RsslHashLink *pLink,
+		void *pKey, RsslUInt32 *pSum)
+{
+	pLink->hashSum = (pSum ? *pSum : pTable->keyHashFunction(pKey));
+	pLink->pKey = pKey;
+
+	if (pTable->elementCount >= pTable->thresholdCapacity
+			&& rsslOpenHashTableResize(pTable) != RSSL_RET_SUCCESS
+			&& pTable->elementCount == pTable->slotCount)
+		return RSSL_RET_FAILURE;
+
+	rsslOpenHashTablePlaceLink(pTable, pLink);
+	pTable->elementCount++;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Remove an element from an open hash table. Does nothing if the link is not in the table. */
+RTR_C_INLINE void rsslOpenHashTableRemoveLink(RsslOpenHashTable *pTable, RsslHashLink *pLink)
+{
+	RsslUInt32 slotMask = pTable->slotCount - 1;
+	RsslUInt32 index = RSSL_OPEN_HASH_TABLE_HOME(pTable, pLink->hashSum);
+	RsslUInt32 probeLength = 1;
+	RsslUInt32 nextIndex;
+
+	while (pTable->slots[index].pLink != pLink)
+	{
+		if (pTable->slots[index].probeLength < probeLength)
+			return;
+
+		index = (index + 1) & slotMask;
+		++probeLength;
+	}
+
+	/* Shift following links back a slot, until reaching one that is empty or already in its home slot. */
+	nextIndex = (index + 1) & slotMask;
+	while (pTable->slots[nextIndex].probeLength > 1)
+	{
+		pTable->slots[index] = pTable->slots[nextIndex];
+		--pTable->slots[index].probeLength;
+		index = nextIndex;
+		nextIndex = (nextIndex + 1) & slotMask;
+	}
+
+	pTable->slots[index].probeLength = 0;
+	pTable->slots[index].pLink = NULL;
+	pTable->elementCount--;
+}
+
+/* Find an element in the open hash table that matches the given key. */
+RTR_C_INLINE RsslHashLink *rsslOpenHashTableFind(RsslOpenHashTable *pTable, void *pKey, RsslUInt32 *pSum)
+{
+	RsslUInt32 hashSum = (pSum ? *pSum : pTable->keyHashFunction(pKey));
+	RsslUInt32 slotMask = pTable->slotCount - 1;
+	RsslUInt32 index = RSSL_OPEN_HASH_TABLE_HOME(pTable, hashSum);
+	RsslUInt32 probeLength = 1;
+
+	for(;;)
+	{
+		RsslOpenHashSlot *pSlot = &pTable->slots[index];
+
+		/* Robin Hood ordering means the key can't be further along than a link that is closer to its home slot. */
+		if (pSlot->probeLength < probeLength)
+			return NULL;
+
+		if (pSlot->hashSum == hashSum && pTable->keyCompareFunction(pKey, pSlot->pLink->pKey))
+			return pSlot->pLink;
+
+		index = (index + 1) & slotMask;
+		++probeLength;
+	}
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
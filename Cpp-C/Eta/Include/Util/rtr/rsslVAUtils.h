@@ -291,6 +291,32 @@ RTR_C_INLINE RsslRet rsslDeepCopyConnectOpts(RsslConnectOptions *destOpts, RsslC
 
 		strncpy(destOpts->wsOpts.protocols, sourceOpts->wsOpts.protocols, tempLen);
 	}
+
+	if (sourceOpts->seqMulticastOpts.lineBAddress != 0)
+	{
+		tempLen = (strlen(sourceOpts->seqMulticastOpts.lineBAddress) + 1) * sizeof(char);
+		destOpts->seqMulticastOpts.lineBAddress = (char*)malloc(tempLen);
+
+		if (destOpts->seqMulticastOpts.lineBAddress == 0)
+		{
+			return RSSL_RET_FAILURE;
+		}
+
+		strncpy(destOpts->seqMulticastOpts.lineBAddress, sourceOpts->seqMulticastOpts.lineBAddress, tempLen);
+	}
+
+	if (sourceOpts->seqMulticastOpts.lineBServiceName != 0)
+	{
+		tempLen = (strlen(sourceOpts->seqMulticastOpts.lineBServiceName) + 1) * sizeof(char);
+		destOpts->seqMulticastOpts.lineBServiceName = (char*)malloc(tempLen);
+
+		if (destOpts->seqMulticastOpts.lineBServiceName == 0)
+		{
+			return RSSL_RET_FAILURE;
+		}
+
+		strncpy(destOpts->seqMulticastOpts.lineBServiceName, sourceOpts->seqMulticastOpts.lineBServiceName, tempLen);
+	}
 	
 	return RSSL_RET_SUCCESS;
 }
@@ -402,6 +428,16 @@ RTR_C_INLINE void rsslFreeConnectOpts(RsslConnectOptions *connOpts)
 		free(connOpts->wsOpts.protocols);
 	}
 
+	if (connOpts->seqMulticastOpts.lineBAddress != 0)
+	{
+		free(connOpts->seqMulticastOpts.lineBAddress);
+	}
+
+	if (connOpts->seqMulticastOpts.lineBServiceName != 0)
+	{
+		free(connOpts->seqMulticastOpts.lineBServiceName);
+	}
+
 	memset(connOpts, 0, sizeof(RsslConnectOptions));
 }
 
@@ -27,6 +27,13 @@
 #include "rtr/ripcutils.h"
 #include "rtr/rsslEventSignal.h"
 #include "rtr/ripcsslutils.h"
+#include "rtr/rsslNotifier.h"
+#include "rtr/rsslGetTime.h"
+#include "rtr/rwsutils.h"
+#include "rtr/rsslOpenHashTable.h"
+#include "rtr/shmemtrans.h"
+#include "rtr/rsslSeqMcastArb.h"
+#include "rtr/ripcuring.h"
 
 
 #if defined(_WIN32)
@@ -42,6 +49,14 @@
 #include <signal.h>
 #endif
 
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <arpa/inet.h>
+#include <linux/perf_event.h>
+#endif
+
 void time_sleep(int millisec)
 {
 #ifdef WIN32
@@ -279,11 +294,13 @@ class ClientChannel
 public:
 	RsslThreadId* pThreadId;		/* Current Thread Id.  Useful for debugging */
 	RsslChannel* pChnl;				/* Channel to be created.  This should be NULL when calling startServerChannel */
+	RsslCompTypes compressionType;	/* Compression to request */
 
 	ClientChannel()
 	{
 		pThreadId = NULL;
 		pChnl = NULL;
+		compressionType = RSSL_COMP_NONE;
 	}
 
 	/* If blocking is set to RSSL_TRUE, attempt to connect using rsslConnect.  This will either return an active channel or error out.
@@ -303,6 +320,7 @@ public:
 		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
 		connectOpts.tcp_nodelay = true;
 		connectOpts.blocking = blocking;
+		connectOpts.compressionType = compressionType;
 
 		pClientChnl = rsslConnect(&connectOpts, &err);
 
@@ -778,7 +796,7 @@ public:
 };
 
 /* This function starts up the RsslServer. */
-RsslServer* startupServer(RsslBool blocking)
+RsslServer* startupServer(RsslBool blocking, RsslUInt32 compressionType = RSSL_COMP_NONE)
 {
 	RsslError err;
 	RsslBindOptions bindOpts;
@@ -789,6 +807,7 @@ RsslServer* startupServer(RsslBool blocking)
 	bindOpts.protocolType = TEST_PROTOCOL_TYPE;  /* These tests are just sending a pre-set string across the wire, so protocol type should not be RWF */
 	bindOpts.channelsBlocking = blocking;
 	bindOpts.serverBlocking = blocking;
+	bindOpts.compressionType = compressionType;
 
 	server = rsslBind(&bindOpts, &err);
 
@@ -921,15 +940,16 @@ protected:
 		resetDeadlockTimer();
 	}
 
-	void startupServerAndConections(RsslBool blocking)
+	void startupServerAndConections(RsslBool blocking, RsslCompTypes compressionType = RSSL_COMP_NONE)
 	{
 		RsslThreadId serverThread, clientThread;
 		ClientChannel clientOpts;
 		ServerChannel serverChnl;
 		serverChnl.pThreadId = &serverThread;
 		clientOpts.pThreadId = &clientThread;
+		clientOpts.compressionType = compressionType;
 
-		server = startupServer(blocking);
+		server = startupServer(blocking, compressionType);
 		
 		ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
 
@@ -1068,1955 +1088,4905 @@ TEST_F(GlobalLockTests, BlockingTwoWayClientServer)
 
 }
 
-class AllLockTests : public ::testing::Test {
+/* Tests of rsslReadEx with RSSL_READ_IN_PIN_BUFFER, reading the server side of a blocking connection. */
+class PinnedReadTests : public GlobalLockTests {
 protected:
-	RsslChannel* serverChannel;
-	RsslChannel* clientChannel;
-	RsslServer* server;
-	int msgsRead;
-	RsslMutex readLock;
-	RsslError err;
+	static const int batchSize = 5;
 
-	virtual void SetUp()
+	void writeBatch(const char *prefix)
 	{
-		shutdownTest = false;
-		failTest = false;
-		server = NULL;
-		serverChannel = NULL;
-		clientChannel = NULL;
-
-		RSSL_MUTEX_INIT(&readLock);
+		RsslError err;
+		RsslBuffer *writeBuf;
+		RsslUInt32 bytesWritten, uncompBytesWritten;
 
-		msgsRead = 0;
+		for (int i = 0; i < batchSize; ++i)
+		{
+			writeBuf = rsslGetBuffer(clientChannel, 100, RSSL_FALSE, &err);
+			ASSERT_NE(writeBuf, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
 
-		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
-	}
+			writeBuf->length = snprintf(writeBuf->data, 100, "%s message %d", prefix, i);
+			ASSERT_GE(rsslWrite(clientChannel, writeBuf, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err), RSSL_RET_SUCCESS);
+		}
 
-	virtual void TearDown()
-	{
-		rsslCloseServer(server, &err);
-		rsslUninitialize();
-		server = NULL;
-		serverChannel = NULL;
-		clientChannel = NULL;
-		RSSL_MUTEX_DESTROY(&readLock);
-		resetDeadlockTimer();
+		while (rsslFlush(clientChannel, &err) > RSSL_RET_SUCCESS);
 	}
 
-	void startupServerAndConections(RsslBool blocking)
+	/* Reads one batch, keeping a copy of each RsslBuffer and the readOutFlags it came with */
+	void readBatch(RsslUInt32 readInFlags, RsslBuffer *buffers, RsslUInt32 *readOutFlags)
 	{
-		RsslThreadId serverThread, clientThread;
-		ClientChannel clientOpts;
-		ServerChannel serverChnl;
-		serverChnl.pThreadId = &serverThread;
-		clientOpts.pThreadId = &clientThread;
+		RsslError err;
+		RsslReadInArgs readInArgs;
+		RsslReadOutArgs readOutArgs;
+		RsslBuffer *readBuf;
+		RsslRet readRet;
+		int count = 0;
 
-		server = startupServer(blocking);
-		ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
-		serverChnl.pServer = server;
-		if (blocking == RSSL_FALSE)
-		{
-			RSSL_THREAD_START(&serverThread, nonBlockingServerConnectThread, &serverChnl);
-			RSSL_THREAD_START(&clientThread, nonBlockingClientConnectThread, &clientOpts);
-		}
-		else
+		while (count < batchSize)
 		{
-			RSSL_THREAD_START(&serverThread, blockingServerConnectThread, &serverChnl);
-			RSSL_THREAD_START(&clientThread, blockingClientConnectThread, &clientOpts);
-		}
+			rsslClearReadInArgs(&readInArgs);
+			rsslClearReadOutArgs(&readOutArgs);
+			readInArgs.readInFlags = readInFlags;
 
-		RSSL_THREAD_JOIN(serverThread);
-		RSSL_THREAD_JOIN(clientThread);
+			readBuf = rsslReadEx(serverChannel, &readInArgs, &readOutArgs, &readRet, &err);
+			ASSERT_TRUE(readBuf != NULL || readRet >= RSSL_RET_SUCCESS || readRet == RSSL_RET_READ_WOULD_BLOCK) << "rsslReadEx failed. Error text: " << err.text;
 
-		serverChannel = serverChnl.pChnl;
-		clientChannel = clientOpts.pChnl;
+			if (readBuf)
+			{
+				buffers[count] = *readBuf;
+				readOutFlags[count] = readOutArgs.readOutFlags;
+				++count;
+			}
+		}
+	}
 
-		if (!serverChannel || !clientChannel || serverChannel->state != RSSL_CH_STATE_ACTIVE || clientChannel->state != RSSL_CH_STATE_ACTIVE)
+	void checkBatch(const char *prefix, RsslBuffer *buffers)
+	{
+		char expected[100];
+
+		for (int i = 0; i < batchSize; ++i)
 		{
-			ASSERT_TRUE(false) << "Channel creation failed!";
+			snprintf(expected, sizeof(expected), "%s message %d", prefix, i);
+			ASSERT_EQ(buffers[i].length, strlen(expected));
+			ASSERT_EQ(memcmp(buffers[i].data, expected, buffers[i].length), 0) << "Expected: " << expected;
 		}
 	}
 };
 
-/*	Test kicks off one writer and one reader thread for the client and server each.  Once
-	the writer threads have each written their full data, sets the shutdown boolean and
-	waits for the reader threads to finish. */
-TEST_F(AllLockTests, NonBlockingTwoWayClientServer)
+TEST_F(PinnedReadTests, PinnedBuffersSurviveLaterReads)
 {
+	RsslError err;
+	RsslBuffer first[batchSize], second[batchSize], third[batchSize];
+	RsslUInt32 firstFlags[batchSize], secondFlags[batchSize], thirdFlags[batchSize];
 
-	RsslThreadId serverReadThread, serverWriteThread, clientReadThread, clientWriteThread;
-	ReadChannel serverReadOpts, clientReadOpts;
-	WriteChannel serverWriteOpts, clientWriteOpts;
-	int readCount;
-
-	startupServerAndConections(RSSL_FALSE);
+	startupServerAndConections(RSSL_TRUE);
 
-	serverReadOpts.pThreadId = &serverReadThread;
-	serverReadOpts.pChnl = serverChannel;
-	serverReadOpts.readCount = &msgsRead;
-	serverReadOpts.lock = &readLock;
-	serverWriteOpts.pThreadId = &serverWriteThread;
-	serverWriteOpts.pChnl = serverChannel;
+	writeBatch("first");
+	readBatch(RSSL_READ_IN_PIN_BUFFER, first, firstFlags);
+	checkBatch("first", first);
 
-	clientReadOpts.pThreadId = &clientReadThread;
-	clientReadOpts.pChnl = clientChannel;
-	clientReadOpts.readCount = &msgsRead;
-	clientReadOpts.lock = &readLock;
-	clientWriteOpts.pThreadId = &clientWriteThread;
-	clientWriteOpts.pChnl = clientChannel;
+	writeBatch("second");
+	readBatch(RSSL_READ_IN_PIN_BUFFER, second, secondFlags);
+	checkBatch("second", second);
 
-	RSSL_THREAD_START(&serverReadThread, nonBlockingReadThread, (void*)&serverReadOpts);
-	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
+	/* The first batch is still intact and the second was read in after it */
+	checkBatch("first", first);
+	ASSERT_GT(second[0].data, first[batchSize - 1].data);
 
-	RSSL_THREAD_START(&clientReadThread, nonBlockingReadThread, (void*)&clientReadOpts);
-	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
-	do
+	for (int i = 0; i < batchSize; ++i)
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
-	
-	ASSERT_FALSE(failTest) << "Test Failed!";
-	
-	shutdownTest = true;
+		ASSERT_TRUE(firstFlags[i] & RSSL_READ_OUT_PINNED_BUFFER);
+		ASSERT_TRUE(secondFlags[i] & RSSL_READ_OUT_PINNED_BUFFER);
+	}
 
-	RSSL_THREAD_JOIN(clientWriteThread);
-	RSSL_THREAD_JOIN(serverWriteThread);
-	RSSL_THREAD_JOIN(clientReadThread);
-	RSSL_THREAD_JOIN(serverReadThread);
+	/* Once released, the input buffer is reused from the start */
+	ASSERT_EQ(rsslReleaseReadBuffers(serverChannel, &err), RSSL_RET_SUCCESS);
+
+	writeBatch("third");
+	readBatch(RSSL_READ_IN_PIN_BUFFER, third, thirdFlags);
+	checkBatch("third", third);
+	ASSERT_EQ(third[0].data, first[0].data);
 
 	rsslCloseChannel(serverChannel, &err);
 	rsslCloseChannel(clientChannel, &err);
-
 }
 
-/*	Test kicks off one writer and one reader thread for the client and server each. Also 
-	starts a thread for pinging both the client and server connections.  Once
-	the writer threads have each written their full data, sets the shutdown boolean and
-	waits for the reader threads to finish. */
-TEST_F(AllLockTests, NonBlockingTwoWayClientServerPing)
+TEST_F(PinnedReadTests, UnpinnedReadReleasesPins)
 {
+	RsslError err;
+	RsslBuffer first[batchSize], second[batchSize];
+	RsslUInt32 firstFlags[batchSize], secondFlags[batchSize];
 
-	RsslThreadId serverReadThread, serverWriteThread, serverPingThread, clientReadThread, clientWriteThread, clientPingThread;
-	ReadChannel serverReadOpts, clientReadOpts;
-	WriteChannel serverWriteOpts, clientWriteOpts;
-	PingChannel serverPingOpts, clientPingOpts;
-	int readCount;
+	startupServerAndConections(RSSL_TRUE);
 
-	startupServerAndConections(RSSL_FALSE);
+	writeBatch("first");
+	readBatch(RSSL_READ_IN_PIN_BUFFER, first, firstFlags);
+	checkBatch("first", first);
 
-	serverReadOpts.pThreadId = &serverReadThread;
-	serverReadOpts.pChnl = serverChannel;
-	serverReadOpts.readCount = &msgsRead;
-	serverReadOpts.lock = &readLock;
-	serverWriteOpts.pThreadId = &serverWriteThread;
-	serverWriteOpts.pChnl = serverChannel;
-	serverPingOpts.pThreadId = &serverPingThread;
-	serverPingOpts.pChnl = serverChannel;
+	writeBatch("second");
+	readBatch(RSSL_READ_IN_NO_FLAGS, second, secondFlags);
+	checkBatch("second", second);
+	ASSERT_EQ(second[0].data, first[0].data);
 
-	clientReadOpts.pThreadId = &clientReadThread;
-	clientReadOpts.pChnl = clientChannel;
-	clientReadOpts.readCount = &msgsRead;
-	clientReadOpts.lock = &readLock;
-	clientWriteOpts.pThreadId = &clientWriteThread;
-	clientWriteOpts.pChnl = clientChannel;
-	clientPingOpts.pThreadId = &clientPingThread;
-	clientPingOpts.pChnl = clientChannel;
+	for (int i = 0; i < batchSize; ++i)
+		ASSERT_FALSE(secondFlags[i] & RSSL_READ_OUT_PINNED_BUFFER);
 
-	RSSL_THREAD_START(&serverReadThread, nonBlockingReadThread, (void*)&serverReadOpts);
-	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
-	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+	/* Releasing with nothing pinned is harmless */
+	ASSERT_EQ(rsslReleaseReadBuffers(serverChannel, &err), RSSL_RET_SUCCESS);
 
-	RSSL_THREAD_START(&clientReadThread, nonBlockingReadThread, (void*)&clientReadOpts);
-	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
-	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
-	do
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/* Tests of rsslWriteBatch, writing from the client side of a blocking connection. */
+class WriteBatchTests : public GlobalLockTests {
+protected:
+	static const int batchSize = 8;
+
+	/* Gets a buffer from the client channel and fills it with a pattern based on index */
+	RsslBuffer *getFilledBuffer(RsslUInt32 length, int index)
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+		RsslError err;
+		RsslBuffer *writeBuf = rsslGetBuffer(clientChannel, length, RSSL_FALSE, &err);
 
-	ASSERT_FALSE(failTest) << "Test Failed!";
+		if (writeBuf)
+		{
+			for (RsslUInt32 j = 0; j < length; ++j)
+				writeBuf->data[j] = (char)('a' + (index + j) % 26);
+			writeBuf->length = length;
+		}
 
-	shutdownTest = true;
+		return writeBuf;
+	}
 
-	RSSL_THREAD_JOIN(clientWriteThread);
-	RSSL_THREAD_JOIN(serverWriteThread);
-	RSSL_THREAD_JOIN(serverPingThread);
-	RSSL_THREAD_JOIN(clientPingThread);
-	RSSL_THREAD_JOIN(clientReadThread);
-	RSSL_THREAD_JOIN(serverReadThread);
+	/* Reads count messages on the server, checking each against the pattern and lengths that were written */
+	void readAndCheck(RsslUInt32 *lengths, int count)
+	{
+		RsslError err;
+		RsslBuffer *readBuf;
+		RsslRet readRet;
+		int readCount = 0;
+
+		while (readCount < count)
+		{
+			readBuf = rsslRead(serverChannel, &readRet, &err);
+			ASSERT_TRUE(readBuf != NULL || readRet >= RSSL_RET_SUCCESS || readRet == RSSL_RET_READ_WOULD_BLOCK) << "rsslRead failed. Error text: " << err.text;
+
+			if (readBuf)
+			{
+				ASSERT_EQ(readBuf->length, lengths[readCount]);
+				for (RsslUInt32 j = 0; j < readBuf->length; ++j)
+					ASSERT_EQ(readBuf->data[j], (char)('a' + (readCount + j) % 26)) << "Message " << readCount << " differs at " << j;
+				++readCount;
+			}
+		}
+	}
+};
+
+TEST_F(WriteBatchTests, WritesAllBuffersInOrder)
+{
+	RsslError err;
+	RsslBuffer *buffers[batchSize];
+	RsslUInt32 lengths[batchSize];
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslUInt32 buffersWritten;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	/* One buffer is larger than the maximum message size, so it is fragmented in the middle of the batch */
+	for (int i = 0; i < batchSize; ++i)
+	{
+		lengths[i] = (i == 3) ? 10000 : 100 + i;
+		buffers[i] = getFilledBuffer(lengths[i], i);
+		ASSERT_NE(buffers[i], (RsslBuffer*)NULL) << "rsslGetBuffer failed.";
+	}
+
+	rsslClearWriteInArgs(&writeInArgs);
+	rsslClearWriteOutArgs(&writeOutArgs);
+	writeInArgs.rsslPriority = RSSL_HIGH_PRIORITY;
+
+	ASSERT_GE(rsslWriteBatch(clientChannel, buffers, batchSize, &writeInArgs, &writeOutArgs, &buffersWritten, &err), RSSL_RET_SUCCESS) << "rsslWriteBatch failed. Error text: " << err.text;
+	ASSERT_EQ(buffersWritten, (RsslUInt32)batchSize);
+	ASSERT_GT(writeOutArgs.bytesWritten, lengths[3]);
+
+	while (rsslFlush(clientChannel, &err) > RSSL_RET_SUCCESS);
+
+	readAndCheck(lengths, batchSize);
 
 	rsslCloseChannel(serverChannel, &err);
 	rsslCloseChannel(clientChannel, &err);
-
 }
 
-/*	Test kicks off two writer threads on the client and two reader threads on the server. Once
-	the writer threads have each written their full data, sets the shutdown boolean and
-	waits for the reader threads to finish. */
-TEST_F(AllLockTests, NonBlockingClientTwoWriterServerTwoReader)
+TEST_F(WriteBatchTests, InvalidBufferWritesNothing)
 {
-	RsslThreadId serverReadThread1, serverReadThread2, clientWriteThread1, clientWriteThread2;
-	ReadChannel serverReadOpts1, serverReadOpts2;
-	WriteChannel clientWriteOpts1, clientWriteOpts2;
-	int readCount;
+	RsslError err;
+	RsslBuffer *buffers[2];
+	RsslUInt32 lengths[2];
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslUInt32 buffersWritten = 5;
 
-	startupServerAndConections(RSSL_FALSE);
+	startupServerAndConections(RSSL_TRUE);
 
-	serverReadOpts1.pThreadId = &serverReadThread1;
-	serverReadOpts1.pChnl = serverChannel;
-	serverReadOpts1.readCount = &msgsRead;
-	serverReadOpts1.lock = &readLock;
-	serverReadOpts2.pThreadId = &serverReadThread2;
-	serverReadOpts2.pChnl = serverChannel;
-	serverReadOpts2.readCount = &msgsRead;
-	serverReadOpts2.lock = &readLock;
+	lengths[0] = lengths[1] = 100;
+	buffers[0] = getFilledBuffer(lengths[0], 0);
+	ASSERT_NE(buffers[0], (RsslBuffer*)NULL) << "rsslGetBuffer failed.";
 
-	clientWriteOpts1.pThreadId = &clientWriteThread1;
-	clientWriteOpts1.pChnl = clientChannel;
-	clientWriteOpts2.pThreadId = &clientWriteThread2;
-	clientWriteOpts2.pChnl = clientChannel;
+	/* The second buffer belongs to the other channel, so the whole batch is rejected */
+	buffers[1] = rsslGetBuffer(serverChannel, 100, RSSL_FALSE, &err);
+	ASSERT_NE(buffers[1], (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
 
-	RSSL_THREAD_START(&serverReadThread1, nonBlockingReadThread, (void*)&serverReadOpts1);
-	RSSL_THREAD_START(&serverReadThread2, nonBlockingReadThread, (void*)&serverReadOpts2);
+	rsslClearWriteInArgs(&writeInArgs);
+	rsslClearWriteOutArgs(&writeOutArgs);
 
-	RSSL_THREAD_START(&clientWriteThread1, nonBlockingWriteThread, (void*)&clientWriteOpts1);
-	RSSL_THREAD_START(&clientWriteThread2, nonBlockingWriteThread, (void*)&clientWriteOpts2);
+	ASSERT_EQ(rsslWriteBatch(clientChannel, buffers, 2, &writeInArgs, &writeOutArgs, &buffersWritten, &err), RSSL_RET_FAILURE);
+	ASSERT_EQ(buffersWritten, 0u);
+	ASSERT_EQ(rsslReleaseBuffer(buffers[1], &err), RSSL_RET_SUCCESS);
 
-	do
-	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+	/* The buffers are still owned by the caller and can be written again */
+	ASSERT_GE(rsslWriteBatch(clientChannel, buffers, 1, &writeInArgs, &writeOutArgs, &buffersWritten, &err), RSSL_RET_SUCCESS) << "rsslWriteBatch failed. Error text: " << err.text;
+	ASSERT_EQ(buffersWritten, 1u);
 
-	ASSERT_FALSE(failTest) << "Test failed.";
-	
-	shutdownTest = true;
+	while (rsslFlush(clientChannel, &err) > RSSL_RET_SUCCESS);
 
-	RSSL_THREAD_JOIN(clientWriteThread1);
-	RSSL_THREAD_JOIN(clientWriteThread2);
+	readAndCheck(lengths, 1);
 
+	rsslCloseChannel(serverChannel, &err);
 	rsslCloseChannel(clientChannel, &err);
-	
-	RSSL_THREAD_JOIN(serverReadThread1);
-	RSSL_THREAD_JOIN(serverReadThread2);
+}
+
+/* Closes the server side and writes to the client until the connection reset is seen, so the next flush fails */
+static void resetClientConnection(RsslChannel *clientChannel, RsslChannel *serverChannel)
+{
+	RsslError err;
+	RsslBuffer *writeBuf;
+	RsslUInt32 bytes, uncompBytes;
+	RsslRet ret;
 
 	rsslCloseChannel(serverChannel, &err);
 
+	writeBuf = rsslGetBuffer(clientChannel, 100, RSSL_FALSE, &err);
+	ASSERT_NE(writeBuf, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
+	memset(writeBuf->data, 'x', 100);
+	writeBuf->length = 100;
+	ret = rsslWrite(clientChannel, writeBuf, RSSL_HIGH_PRIORITY, RSSL_WRITE_DIRECT_SOCKET_WRITE, &bytes, &uncompBytes, &err);
+	ASSERT_GE(ret, RSSL_RET_SUCCESS) << "rsslWrite failed. Error text: " << err.text;
+
+	/* Give the peer time to answer with a reset */
+	time_sleep(200);
 }
 
-/*  Test runs two writer threads on the server, and two reader threads on the client. Once
-	the writer threads have each written their full data, sets the shutdown boolean and
-	waits for the reader threads to finish.*/
-TEST_F(AllLockTests, NonBlockingClientTwoReaderServerTwoWriter)
+TEST_F(WriteBatchTests, FlushFailureAfterFragmentedBufferReturnsFailure)
 {
-	RsslThreadId serverWriteThread1, serverWriteThread2, clientReadThread1, clientReadThread2;
+	RsslError err;
+	RsslBuffer *buffers[4];
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslUInt32 buffersWritten = 0;
+	RsslUInt32 i;
 
-	ReadChannel clientReadOpts1, clientReadOpts2;
-	WriteChannel serverWriteOpts1, serverWriteOpts2;
-	int readCount;
+	startupServerAndConections(RSSL_TRUE);
 
-	startupServerAndConections(RSSL_FALSE);
+	/* The fragmented buffer is flushed as it is queued; that flush fails and closes the channel */
+	for (i = 0; i < 4; ++i)
+	{
+		buffers[i] = getFilledBuffer(i == 1 ? 10000 : 100, i);
+		ASSERT_NE(buffers[i], (RsslBuffer*)NULL) << "rsslGetBuffer failed.";
+	}
 
-	serverWriteOpts1.pThreadId = &serverWriteThread1;
-	serverWriteOpts1.pChnl = serverChannel;
-	serverWriteOpts2.pThreadId = &serverWriteThread2;
-	serverWriteOpts2.pChnl = serverChannel;
+	resetClientConnection(clientChannel, serverChannel);
 
-	clientReadOpts1.pThreadId = &clientReadThread1;
-	clientReadOpts1.pChnl = clientChannel;
-	clientReadOpts1.readCount = &msgsRead;
-	clientReadOpts1.lock = &readLock;
-	clientReadOpts2.pThreadId = &clientReadThread2;
-	clientReadOpts2.pChnl = clientChannel;
-	clientReadOpts2.readCount = &msgsRead;
-	clientReadOpts2.lock = &readLock;
+	rsslClearWriteInArgs(&writeInArgs);
+	rsslClearWriteOutArgs(&writeOutArgs);
 
-	RSSL_THREAD_START(&serverWriteThread1, nonBlockingWriteThread, (void*)&serverWriteOpts1);
-	RSSL_THREAD_START(&serverWriteThread2, nonBlockingWriteThread, (void*)&serverWriteOpts2);
+	ASSERT_EQ(rsslWriteBatch(clientChannel, buffers, 4, &writeInArgs, &writeOutArgs, &buffersWritten, &err), RSSL_RET_FAILURE);
+	ASSERT_EQ(buffersWritten, 2u);
+	ASSERT_EQ(clientChannel->state, RSSL_CH_STATE_CLOSED);
 
-	RSSL_THREAD_START(&clientReadThread1, nonBlockingReadThread, (void*)&clientReadOpts1);
-	RSSL_THREAD_START(&clientReadThread2, nonBlockingReadThread, (void*)&clientReadOpts2);
+	/* The buffers that were not taken are still the caller's to release */
+	ASSERT_EQ(rsslReleaseBuffer(buffers[2], &err), RSSL_RET_SUCCESS);
+	ASSERT_EQ(rsslReleaseBuffer(buffers[3], &err), RSSL_RET_SUCCESS);
 
-	do
+	rsslCloseChannel(clientChannel, &err);
+}
+
+TEST_F(WriteBatchTests, FlushFailureOnLastFragmentedBufferTakesWholeBatch)
+{
+	RsslError err;
+	RsslBuffer *buffers[3];
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslUInt32 buffersWritten = 0;
+	RsslUInt32 i;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	for (i = 0; i < 3; ++i)
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
-	
-	shutdownTest = true;
-	
-	rsslCloseChannel(serverChannel, &err);
-	
-	RSSL_THREAD_JOIN(serverWriteThread1);
-	RSSL_THREAD_JOIN(serverWriteThread2);
-	RSSL_THREAD_JOIN(clientReadThread1);
-	RSSL_THREAD_JOIN(clientReadThread2);
+		buffers[i] = getFilledBuffer(i == 2 ? 10000 : 100, i);
+		ASSERT_NE(buffers[i], (RsslBuffer*)NULL) << "rsslGetBuffer failed.";
+	}
+
+	resetClientConnection(clientChannel, serverChannel);
+
+	rsslClearWriteInArgs(&writeInArgs);
+	rsslClearWriteOutArgs(&writeOutArgs);
+
+	/* Every buffer was taken, so only the flush is reported as failed */
+	ASSERT_EQ(rsslWriteBatch(clientChannel, buffers, 3, &writeInArgs, &writeOutArgs, &buffersWritten, &err), RSSL_RET_WRITE_FLUSH_FAILED);
+	ASSERT_EQ(buffersWritten, 3u);
+	ASSERT_EQ(clientChannel->state, RSSL_CH_STATE_CLOSED);
 
 	rsslCloseChannel(clientChannel, &err);
 }
 
-/*  Test runs two writer threads on the server, and two reader threads on the client, and 
-	a pinging thread on the client channel. Once the writer threads have each written their 
-	full data, sets the shutdown boolean and waits for the reader threads to finish.*/
-TEST_F(AllLockTests, NonBlockingClientTwoWriterServerTwoReaderPing)
-{
-	RsslThreadId serverReadThread1, serverReadThread2, clientWriteThread1, clientWriteThread2, clientPingThread;
-	ReadChannel serverReadOpts1, serverReadOpts2;
-	WriteChannel clientWriteOpts1, clientWriteOpts2;
-	PingChannel clientPingOpts;
-	int readCount;
+/* Tests of Zstandard compression, writing from the client side of a blocking connection. */
+class CompressionTests : public WriteBatchTests {
+protected:
+	/* Sample of the kind of content that is sent repeatedly on a channel, used as a dictionary */
+	static const char *sampleUpdate()
+	{
+		return "UPDATE TRDPRC_1 BID ASK ACVOL_1 NETCHNG_1 TRDTIM_1 SALTIM IBM.N MSFT.O TRI.N VOD.L";
+	}
 
-	startupServerAndConections(RSSL_FALSE);
+	virtual void TearDown()
+	{
+		RsslError err;
+		rsslSetCompressionDictionary(NULL, &err);
+		WriteBatchTests::TearDown();
+	}
 
-	serverReadOpts1.pThreadId = &serverReadThread1;
-	serverReadOpts1.pChnl = serverChannel;
-	serverReadOpts1.readCount = &msgsRead;
-	serverReadOpts1.lock = &readLock;
-	serverReadOpts2.pThreadId = &serverReadThread2;
-	serverReadOpts2.pChnl = serverChannel;
-	serverReadOpts2.readCount = &msgsRead;
-	serverReadOpts2.lock = &readLock;
+	/* Writes one message made of repeated sample updates and returns the number of bytes written to the network */
+	RsslUInt32 writeSample(RsslUInt32 length, RsslChannel *channel = NULL)
+	{
+		RsslError err;
+		RsslBuffer *writeBuf;
+		RsslUInt32 bytesWritten = 0, uncompBytesWritten = 0;
+		const char *sample = sampleUpdate();
+		size_t sampleLength = strlen(sample);
 
-	clientWriteOpts1.pThreadId = &clientWriteThread1;
-	clientWriteOpts1.pChnl = clientChannel;
-	clientWriteOpts2.pThreadId = &clientWriteThread2;
-	clientWriteOpts2.pChnl = clientChannel;
-	clientPingOpts.pThreadId = &clientPingThread;
-	clientPingOpts.pChnl = clientChannel;
+		if (!channel)
+			channel = clientChannel;
 
-	RSSL_THREAD_START(&serverReadThread1, nonBlockingReadThread, (void*)&serverReadOpts1);
-	RSSL_THREAD_START(&serverReadThread2, nonBlockingReadThread, (void*)&serverReadOpts2);
+		writeBuf = rsslGetBuffer(channel, length, RSSL_FALSE, &err);
+		EXPECT_NE(writeBuf, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
+		if (!writeBuf)
+			return 0;
 
-	RSSL_THREAD_START(&clientWriteThread1, nonBlockingWriteThread, (void*)&clientWriteOpts1);
-	RSSL_THREAD_START(&clientWriteThread2, nonBlockingWriteThread, (void*)&clientWriteOpts2);
-	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+		for (RsslUInt32 j = 0; j < length; ++j)
+			writeBuf->data[j] = sample[(j + length) % sampleLength];
+		writeBuf->length = length;
 
-	do
+		EXPECT_GE(rsslWrite(channel, writeBuf, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err), RSSL_RET_SUCCESS) << "rsslWrite failed. Error text: " << err.text;
+		while (rsslFlush(channel, &err) > RSSL_RET_SUCCESS);
+
+		return bytesWritten;
+	}
+
+	void readSample(RsslUInt32 length, RsslChannel *channel = NULL)
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+		RsslError err;
+		RsslBuffer *readBuf = NULL;
+		RsslRet readRet;
+		const char *sample = sampleUpdate();
+		size_t sampleLength = strlen(sample);
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+		while (readBuf == NULL)
+		{
+			readBuf = rsslRead(channel ? channel : serverChannel, &readRet, &err);
+			ASSERT_TRUE(readBuf != NULL || readRet >= RSSL_RET_SUCCESS || readRet == RSSL_RET_READ_WOULD_BLOCK) << "rsslRead failed. Error text: " << err.text;
+		}
 
-	shutdownTest = true;
+		ASSERT_EQ(readBuf->length, length);
+		for (RsslUInt32 j = 0; j < length; ++j)
+			ASSERT_EQ(readBuf->data[j], sample[(j + length) % sampleLength]) << "Message differs at " << j;
+	}
 
-	RSSL_THREAD_JOIN(clientWriteThread1);
-	RSSL_THREAD_JOIN(clientWriteThread2);
-	RSSL_THREAD_JOIN(clientPingThread);
+	void closeConnections()
+	{
+		RsslError err;
+		rsslCloseChannel(serverChannel, &err);
+		rsslCloseChannel(clientChannel, &err);
+		rsslCloseServer(server, &err);
+		server = NULL;
+	}
 
-	rsslCloseChannel(clientChannel, &err);
+	/* Sets a dictionary of sample updates that starts with prefix, or removes the dictionary if prefix is NULL */
+	void setDictionary(const char *prefix)
+	{
+		RsslError err;
+		RsslBuffer dictionary;
+		char dictionaryData[1024];
 
-	RSSL_THREAD_JOIN(serverReadThread1);
-	RSSL_THREAD_JOIN(serverReadThread2);
+		if (prefix == NULL)
+		{
+			ASSERT_EQ(rsslSetCompressionDictionary(NULL, &err), RSSL_RET_SUCCESS);
+			return;
+		}
 
-	rsslCloseChannel(serverChannel, &err);
+		dictionary.data = dictionaryData;
+		dictionary.length = snprintf(dictionaryData, sizeof(dictionaryData), "%s", prefix);
+		while (dictionary.length + strlen(sampleUpdate()) < sizeof(dictionaryData))
+			dictionary.length += snprintf(dictionaryData + dictionary.length, sizeof(dictionaryData) - dictionary.length, "%s", sampleUpdate());
+		ASSERT_EQ(rsslSetCompressionDictionary(&dictionary, &err), RSSL_RET_SUCCESS) << "rsslSetCompressionDictionary failed. Error text: " << err.text;
+	}
 
-}
+	/* Connects a non-blocking zstd channel, replacing the dictionary after the connect request reaches the server,
+	 * so the client offers the dictionary it had when connecting and the server compares it to serverDictionary */
+	void connectWithServerDictionary(const char *serverDictionary)
+	{
+		RsslConnectOptions connectOpts;
+		RsslError err;
+		RsslInProgInfo inProg;
+		RsslAcceptOptions acceptOpts;
+		int pending = 0;
 
-/*  Test runs two reader threads on the server, and two writer threads on the client, and a pinging thread
-	on the server channel. Once the writer threads have each written their full data, sets 
-	the shutdown boolean and waits for the reader threads to finish.*/
-TEST_F(AllLockTests, NonBlockingClientTwoReaderServerTwoWriterPing)
+		server = startupServer(RSSL_FALSE, RSSL_COMP_ZSTD);
+		ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+		rsslClearConnectOpts(&connectOpts);
+		connectOpts.connectionType = RSSL_CONN_TYPE_SOCKET;
+		connectOpts.connectionInfo.unified.address = (char*)"localhost";
+		connectOpts.connectionInfo.unified.serviceName = (char*)"15000";
+		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
+		connectOpts.tcp_nodelay = true;
+		connectOpts.blocking = RSSL_FALSE;
+		connectOpts.compressionType = RSSL_COMP_ZSTD;
+		clientChannel = rsslConnect(&connectOpts, &err);
+		ASSERT_NE(clientChannel, (RsslChannel*)NULL) << "rsslConnect failed. Error text: " << err.text;
+
+		rsslClearAcceptOpts(&acceptOpts);
+		while ((serverChannel = rsslAccept(server, &acceptOpts, &err)) == NULL)
+			time_sleep(1);
+
+		/* the server has not read the connect request yet */
+		while (pending == 0)
+		{
+			rsslClearInProgInfo(&inProg);
+			ASSERT_GE(rsslInitChannel(clientChannel, &inProg, &err), RSSL_RET_SUCCESS) << "rsslInitChannel failed. Error text: " << err.text;
+			ASSERT_EQ(ioctl(serverChannel->socketId, FIONREAD, &pending), 0);
+		}
+
+		setDictionary(serverDictionary);
+
+		while (clientChannel->state != RSSL_CH_STATE_ACTIVE || serverChannel->state != RSSL_CH_STATE_ACTIVE)
+		{
+			rsslClearInProgInfo(&inProg);
+			if (serverChannel->state != RSSL_CH_STATE_ACTIVE)
+				ASSERT_GE(rsslInitChannel(serverChannel, &inProg, &err), RSSL_RET_SUCCESS) << "Server rsslInitChannel failed. Error text: " << err.text;
+			rsslClearInProgInfo(&inProg);
+			if (clientChannel->state != RSSL_CH_STATE_ACTIVE)
+				ASSERT_GE(rsslInitChannel(clientChannel, &inProg, &err), RSSL_RET_SUCCESS) << "Client rsslInitChannel failed. Error text: " << err.text;
+		}
+	}
+};
+
+TEST_F(CompressionTests, ZstdStreamRoundTrip)
 {
-	RsslThreadId serverWriteThread1, serverWriteThread2, serverPingThread, clientReadThread1, clientReadThread2;
+	RsslError err;
+	RsslChannelInfo channelInfo;
+	RsslBuffer *buffers[batchSize];
+	RsslUInt32 lengths[batchSize];
+	RsslWriteInArgs writeInArgs;
+	RsslWriteOutArgs writeOutArgs;
+	RsslUInt32 buffersWritten;
+	RsslBuffer *readBuf;
+	RsslRet readRet;
+	int readCount = 0;
+
+	startupServerAndConections(RSSL_TRUE, RSSL_COMP_ZSTD);
+
+	ASSERT_EQ(rsslGetChannelInfo(clientChannel, &channelInfo, &err), RSSL_RET_SUCCESS);
+	ASSERT_EQ(channelInfo.compressionType, RSSL_COMP_ZSTD);
+
+	/* Includes a message that is fragmented, and full sized ones that compress poorly, so they span two buffers */
+	for (int i = 0; i < batchSize; ++i)
+	{
+		lengths[i] = (i == 3) ? 10000 : (i % 2) ? channelInfo.maxFragmentSize : 100 + i;
+		buffers[i] = getFilledBuffer(lengths[i], i);
+		ASSERT_NE(buffers[i], (RsslBuffer*)NULL) << "rsslGetBuffer failed.";
 
-	ReadChannel clientReadOpts1, clientReadOpts2;
-	WriteChannel serverWriteOpts1, serverWriteOpts2;
-	PingChannel serverPingOpts;
-	int readCount;
+		if (lengths[i] == channelInfo.maxFragmentSize)
+		{
+			srand(i);
+			for (RsslUInt32 j = 0; j < lengths[i]; ++j)
+				buffers[i]->data[j] = (char)('a' + (i + j) % 26) ^ (char)(rand() & 0x1f);
+		}
+	}
 
-	startupServerAndConections(RSSL_FALSE);
+	rsslClearWriteInArgs(&writeInArgs);
+	rsslClearWriteOutArgs(&writeOutArgs);
+	writeInArgs.rsslPriority = RSSL_HIGH_PRIORITY;
 
-	serverWriteOpts1.pThreadId = &serverWriteThread1;
-	serverWriteOpts1.pChnl = serverChannel;
-	serverWriteOpts2.pThreadId = &serverWriteThread2;
-	serverWriteOpts2.pChnl = serverChannel;
-	serverPingOpts.pThreadId = &serverPingThread;
-	serverPingOpts.pChnl = serverChannel;
+	ASSERT_GE(rsslWriteBatch(clientChannel, buffers, batchSize, &writeInArgs, &writeOutArgs, &buffersWritten, &err), RSSL_RET_SUCCESS) << "rsslWriteBatch failed. Error text: " << err.text;
+	ASSERT_EQ(buffersWritten, (RsslUInt32)batchSize);
+	while (rsslFlush(clientChannel, &err) > RSSL_RET_SUCCESS);
 
-	clientReadOpts1.pThreadId = &clientReadThread1;
-	clientReadOpts1.pChnl = clientChannel;
-	clientReadOpts1.readCount = &msgsRead;
-	clientReadOpts1.lock = &readLock;
-	clientReadOpts2.pThreadId = &clientReadThread2;
-	clientReadOpts2.pChnl = clientChannel;
-	clientReadOpts2.readCount = &msgsRead;
-	clientReadOpts2.lock = &readLock;
+	while (readCount < batchSize)
+	{
+		readBuf = rsslRead(serverChannel, &readRet, &err);
+		ASSERT_TRUE(readBuf != NULL || readRet >= RSSL_RET_SUCCESS || readRet == RSSL_RET_READ_WOULD_BLOCK) << "rsslRead failed. Error text: " << err.text;
 
-	RSSL_THREAD_START(&serverWriteThread1, nonBlockingWriteThread, (void*)&serverWriteOpts1);
-	RSSL_THREAD_START(&serverWriteThread2, nonBlockingWriteThread, (void*)&serverWriteOpts2);
-	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+		if (readBuf)
+		{
+			ASSERT_EQ(readBuf->length, lengths[readCount]);
+			srand(readCount);
+			for (RsslUInt32 j = 0; j < readBuf->length; ++j)
+			{
+				char expected = (char)('a' + (readCount + j) % 26);
+				if (lengths[readCount] == channelInfo.maxFragmentSize)
+					expected ^= (char)(rand() & 0x1f);
+				ASSERT_EQ(readBuf->data[j], expected) << "Message " << readCount << " differs at " << j;
+			}
+			++readCount;
+		}
+	}
 
-	RSSL_THREAD_START(&clientReadThread1, nonBlockingReadThread, (void*)&clientReadOpts1);
-	RSSL_THREAD_START(&clientReadThread2, nonBlockingReadThread, (void*)&clientReadOpts2);
+	closeConnections();
+}
 
-	do
+TEST_F(CompressionTests, ZstdDictionaryShrinksSmallMessages)
+{
+	RsslError err;
+	RsslBuffer dictionary;
+	RsslUInt32 streamBytes, dictionaryBytes;
+	char dictionaryData[1024];
+
+	/* the first message on a stream has no history to refer to */
+	startupServerAndConections(RSSL_TRUE, RSSL_COMP_ZSTD);
+	streamBytes = writeSample(200);
+	readSample(200);
+	closeConnections();
+
+	dictionary.data = dictionaryData;
+	dictionary.length = 0;
+	while (dictionary.length + strlen(sampleUpdate()) < sizeof(dictionaryData))
+		dictionary.length += snprintf(dictionaryData + dictionary.length, sizeof(dictionaryData) - dictionary.length, "%s", sampleUpdate());
+	ASSERT_EQ(rsslSetCompressionDictionary(&dictionary, &err), RSSL_RET_SUCCESS) << "rsslSetCompressionDictionary failed. Error text: " << err.text;
+
+	/* the dictionary is copied */
+	memset(dictionaryData, 0, sizeof(dictionaryData));
+
+	startupServerAndConections(RSSL_TRUE, RSSL_COMP_ZSTD);
+	dictionaryBytes = writeSample(200);
+	readSample(200);
+
+	/* each message refers to the dictionary, so later messages keep the benefit */
+	for (int i = 0; i < 20; ++i)
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+		ASSERT_LT(writeSample(300 + i), streamBytes);
+		readSample(300 + i);
+	}
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+	ASSERT_LT(dictionaryBytes, streamBytes);
 
-	shutdownTest = true;
+	/* removing the dictionary does not affect open channels */
+	ASSERT_EQ(rsslSetCompressionDictionary(NULL, &err), RSSL_RET_SUCCESS);
+	writeSample(5000);
+	readSample(5000);
 
-	rsslCloseChannel(serverChannel, &err);
+	closeConnections();
+}
 
-	RSSL_THREAD_JOIN(serverWriteThread1);
-	RSSL_THREAD_JOIN(serverWriteThread2);
-	RSSL_THREAD_JOIN(serverPingThread);
-	RSSL_THREAD_JOIN(clientReadThread1);
-	RSSL_THREAD_JOIN(clientReadThread2);
+#ifndef WIN32
+/* When the two sides do not have the same dictionary, the channel compresses zstd as a stream in both directions */
+TEST_F(CompressionTests, ZstdDictionaryMismatchFallsBackToStream)
+{
+	/* dictionary the client connects with, and the one the server has when it reads the connect request */
+	const char *dictionaries[][2] = { { "", "DIFFERENT" }, { "", NULL }, { NULL, "" } };
+	RsslUInt32 streamBytes;
 
-	rsslCloseChannel(clientChannel, &err);
+	startupServerAndConections(RSSL_TRUE, RSSL_COMP_ZSTD);
+	streamBytes = writeSample(200);
+	readSample(200);
+	closeConnections();
+
+	for (int i = 0; i < 3; ++i)
+	{
+		setDictionary(dictionaries[i][0]);
+		connectWithServerDictionary(dictionaries[i][1]);
+
+		ASSERT_EQ(writeSample(200), streamBytes) << "Case " << i;
+		readSample(200);
+		for (int j = 0; j < 5; ++j)
+		{
+			writeSample(300 + j, serverChannel);
+			readSample(300 + j, clientChannel);
+			writeSample(300 + j);
+			readSample(300 + j);
+		}
+
+		closeConnections();
+	}
 }
+#endif
 
-/*  Multiple reader client threads from a single writer server. Once the writer threads 
-	have each written their full data, sets the shutdown boolean and waits for the 
-	reader threads to finish.*/
-TEST_F(AllLockTests, NonBlockingClientTwoReaderServerWriter)
+TEST_F(CompressionTests, Lz4StreamRoundTrip)
 {
-	RsslThreadId serverWriteThread, clientReadThread1, clientReadThread2;
+	RsslError err;
+	RsslChannelInfo channelInfo;
+	RsslUInt32 totalLength = 0, length;
 
-	ReadChannel clientReadOpts1, clientReadOpts2;
-	WriteChannel serverWriteOpts;
-	int readCount;
+	startupServerAndConections(RSSL_TRUE, RSSL_COMP_LZ4);
 
-	startupServerAndConections(RSSL_FALSE);
+	ASSERT_EQ(rsslGetChannelInfo(clientChannel, &channelInfo, &err), RSSL_RET_SUCCESS);
+	ASSERT_EQ(channelInfo.compressionType, RSSL_COMP_LZ4);
 
-	serverWriteOpts.pThreadId = &serverWriteThread;
-	serverWriteOpts.pChnl = serverChannel;
+	/* sends several times the stream window in each direction, so both sides wrap their buffers many times,
+	 * including full sized messages that are split across two buffers and messages that are fragmented */
+	for (int i = 0; totalLength < 1000000; ++i)
+	{
+		length = (i % 7 == 0) ? channelInfo.maxFragmentSize : (i % 31 == 0) ? 20000 : 50 + (i * 97) % 3000;
+		totalLength += length;
 
-	clientReadOpts1.pThreadId = &clientReadThread1;
-	clientReadOpts1.pChnl = clientChannel;
-	clientReadOpts1.readCount = &msgsRead;
-	clientReadOpts1.lock = &readLock;
-	clientReadOpts2.pThreadId = &clientReadThread2;
-	clientReadOpts2.pChnl = clientChannel;
-	clientReadOpts2.readCount = &msgsRead;
-	clientReadOpts2.lock = &readLock;
+		writeSample(length);
+		readSample(length);
+		writeSample(length, serverChannel);
+		readSample(length, clientChannel);
+	}
 
-	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
+	closeConnections();
+}
 
-	RSSL_THREAD_START(&clientReadThread1, nonBlockingReadThread, (void*)&clientReadOpts1);
-	RSSL_THREAD_START(&clientReadThread2, nonBlockingReadThread, (void*)&clientReadOpts1);
+TEST_F(CompressionTests, Lz4StreamShrinksRepeatedMessages)
+{
+	RsslUInt32 firstBytes;
 
-	do
+	startupServerAndConections(RSSL_TRUE, RSSL_COMP_LZ4);
+
+	/* the first message has no history to refer to; later ones can refer to it */
+	firstBytes = writeSample(300);
+	readSample(300);
+
+	for (int i = 0; i < 20; ++i)
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
-	
-	shutdownTest = true;
+		ASSERT_LT(writeSample(300), firstBytes / 2);
+		readSample(300);
+	}
 
-	RSSL_THREAD_JOIN(serverWriteThread);
+	closeConnections();
+}
 
-	rsslCloseChannel(serverChannel, &err);
+class AllLockTests : public ::testing::Test {
+protected:
+	RsslChannel* serverChannel;
+	RsslChannel* clientChannel;
+	RsslServer* server;
+	int msgsRead;
+	RsslMutex readLock;
+	RsslError err;
+
+	virtual void SetUp()
+	{
+		shutdownTest = false;
+		failTest = false;
+		server = NULL;
+		serverChannel = NULL;
+		clientChannel = NULL;
+
+		RSSL_MUTEX_INIT(&readLock);
+
+		msgsRead = 0;
+
+		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+	}
+
+	virtual void TearDown()
+	{
+		rsslCloseServer(server, &err);
+		rsslUninitialize();
+		server = NULL;
+		serverChannel = NULL;
+		clientChannel = NULL;
+		RSSL_MUTEX_DESTROY(&readLock);
+		resetDeadlockTimer();
+	}
+
+	void startupServerAndConections(RsslBool blocking)
+	{
+		RsslThreadId serverThread, clientThread;
+		ClientChannel clientOpts;
+		ServerChannel serverChnl;
+		serverChnl.pThreadId = &serverThread;
+		clientOpts.pThreadId = &clientThread;
+
+		server = startupServer(blocking);
+		ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+		serverChnl.pServer = server;
+		if (blocking == RSSL_FALSE)
+		{
+			RSSL_THREAD_START(&serverThread, nonBlockingServerConnectThread, &serverChnl);
+			RSSL_THREAD_START(&clientThread, nonBlockingClientConnectThread, &clientOpts);
+		}
+		else
+		{
+			RSSL_THREAD_START(&serverThread, blockingServerConnectThread, &serverChnl);
+			RSSL_THREAD_START(&clientThread, blockingClientConnectThread, &clientOpts);
+		}
+
+		RSSL_THREAD_JOIN(serverThread);
+		RSSL_THREAD_JOIN(clientThread);
+
+		serverChannel = serverChnl.pChnl;
+		clientChannel = clientOpts.pChnl;
+
+		if (!serverChannel || !clientChannel || serverChannel->state != RSSL_CH_STATE_ACTIVE || clientChannel->state != RSSL_CH_STATE_ACTIVE)
+		{
+			ASSERT_TRUE(false) << "Channel creation failed!";
+		}
+	}
+};
+
+/*	Test kicks off one writer and one reader thread for the client and server each.  Once
+	the writer threads have each written their full data, sets the shutdown boolean and
+	waits for the reader threads to finish. */
+TEST_F(AllLockTests, NonBlockingTwoWayClientServer)
+{
+
+	RsslThreadId serverReadThread, serverWriteThread, clientReadThread, clientWriteThread;
+	ReadChannel serverReadOpts, clientReadOpts;
+	WriteChannel serverWriteOpts, clientWriteOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	serverReadOpts.pThreadId = &serverReadThread;
+	serverReadOpts.pChnl = serverChannel;
+	serverReadOpts.readCount = &msgsRead;
+	serverReadOpts.lock = &readLock;
+	serverWriteOpts.pThreadId = &serverWriteThread;
+	serverWriteOpts.pChnl = serverChannel;
+
+	clientReadOpts.pThreadId = &clientReadThread;
+	clientReadOpts.pChnl = clientChannel;
+	clientReadOpts.readCount = &msgsRead;
+	clientReadOpts.lock = &readLock;
+	clientWriteOpts.pThreadId = &clientWriteThread;
+	clientWriteOpts.pChnl = clientChannel;
+
+	RSSL_THREAD_START(&serverReadThread, nonBlockingReadThread, (void*)&serverReadOpts);
+	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
+
+	RSSL_THREAD_START(&clientReadThread, nonBlockingReadThread, (void*)&clientReadOpts);
+	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+	
+	ASSERT_FALSE(failTest) << "Test Failed!";
+	
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread);
+	RSSL_THREAD_JOIN(serverWriteThread);
+	RSSL_THREAD_JOIN(clientReadThread);
+	RSSL_THREAD_JOIN(serverReadThread);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+
+}
+
+/*	Test kicks off one writer and one reader thread for the client and server each. Also 
+	starts a thread for pinging both the client and server connections.  Once
+	the writer threads have each written their full data, sets the shutdown boolean and
+	waits for the reader threads to finish. */
+TEST_F(AllLockTests, NonBlockingTwoWayClientServerPing)
+{
+
+	RsslThreadId serverReadThread, serverWriteThread, serverPingThread, clientReadThread, clientWriteThread, clientPingThread;
+	ReadChannel serverReadOpts, clientReadOpts;
+	WriteChannel serverWriteOpts, clientWriteOpts;
+	PingChannel serverPingOpts, clientPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	serverReadOpts.pThreadId = &serverReadThread;
+	serverReadOpts.pChnl = serverChannel;
+	serverReadOpts.readCount = &msgsRead;
+	serverReadOpts.lock = &readLock;
+	serverWriteOpts.pThreadId = &serverWriteThread;
+	serverWriteOpts.pChnl = serverChannel;
+	serverPingOpts.pThreadId = &serverPingThread;
+	serverPingOpts.pChnl = serverChannel;
+
+	clientReadOpts.pThreadId = &clientReadThread;
+	clientReadOpts.pChnl = clientChannel;
+	clientReadOpts.readCount = &msgsRead;
+	clientReadOpts.lock = &readLock;
+	clientWriteOpts.pThreadId = &clientWriteThread;
+	clientWriteOpts.pChnl = clientChannel;
+	clientPingOpts.pThreadId = &clientPingThread;
+	clientPingOpts.pChnl = clientChannel;
+
+	RSSL_THREAD_START(&serverReadThread, nonBlockingReadThread, (void*)&serverReadOpts);
+	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
+	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+
+	RSSL_THREAD_START(&clientReadThread, nonBlockingReadThread, (void*)&clientReadOpts);
+	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
+	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test Failed!";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread);
+	RSSL_THREAD_JOIN(serverWriteThread);
+	RSSL_THREAD_JOIN(serverPingThread);
+	RSSL_THREAD_JOIN(clientPingThread);
+	RSSL_THREAD_JOIN(clientReadThread);
+	RSSL_THREAD_JOIN(serverReadThread);
+
+	rsslCloseChannel(serverChannel, &err);
+	rsslCloseChannel(clientChannel, &err);
+
+}
+
+/*	Test kicks off two writer threads on the client and two reader threads on the server. Once
+	the writer threads have each written their full data, sets the shutdown boolean and
+	waits for the reader threads to finish. */
+TEST_F(AllLockTests, NonBlockingClientTwoWriterServerTwoReader)
+{
+	RsslThreadId serverReadThread1, serverReadThread2, clientWriteThread1, clientWriteThread2;
+	ReadChannel serverReadOpts1, serverReadOpts2;
+	WriteChannel clientWriteOpts1, clientWriteOpts2;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	serverReadOpts1.pThreadId = &serverReadThread1;
+	serverReadOpts1.pChnl = serverChannel;
+	serverReadOpts1.readCount = &msgsRead;
+	serverReadOpts1.lock = &readLock;
+	serverReadOpts2.pThreadId = &serverReadThread2;
+	serverReadOpts2.pChnl = serverChannel;
+	serverReadOpts2.readCount = &msgsRead;
+	serverReadOpts2.lock = &readLock;
+
+	clientWriteOpts1.pThreadId = &clientWriteThread1;
+	clientWriteOpts1.pChnl = clientChannel;
+	clientWriteOpts2.pThreadId = &clientWriteThread2;
+	clientWriteOpts2.pChnl = clientChannel;
+
+	RSSL_THREAD_START(&serverReadThread1, nonBlockingReadThread, (void*)&serverReadOpts1);
+	RSSL_THREAD_START(&serverReadThread2, nonBlockingReadThread, (void*)&serverReadOpts2);
+
+	RSSL_THREAD_START(&clientWriteThread1, nonBlockingWriteThread, (void*)&clientWriteOpts1);
+	RSSL_THREAD_START(&clientWriteThread2, nonBlockingWriteThread, (void*)&clientWriteOpts2);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+	
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread1);
+	RSSL_THREAD_JOIN(clientWriteThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+	
+	RSSL_THREAD_JOIN(serverReadThread1);
+	RSSL_THREAD_JOIN(serverReadThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+
+}
+
+/*  Test runs two writer threads on the server, and two reader threads on the client. Once
+	the writer threads have each written their full data, sets the shutdown boolean and
+	waits for the reader threads to finish.*/
+TEST_F(AllLockTests, NonBlockingClientTwoReaderServerTwoWriter)
+{
+	RsslThreadId serverWriteThread1, serverWriteThread2, clientReadThread1, clientReadThread2;
+
+	ReadChannel clientReadOpts1, clientReadOpts2;
+	WriteChannel serverWriteOpts1, serverWriteOpts2;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	serverWriteOpts1.pThreadId = &serverWriteThread1;
+	serverWriteOpts1.pChnl = serverChannel;
+	serverWriteOpts2.pThreadId = &serverWriteThread2;
+	serverWriteOpts2.pChnl = serverChannel;
+
+	clientReadOpts1.pThreadId = &clientReadThread1;
+	clientReadOpts1.pChnl = clientChannel;
+	clientReadOpts1.readCount = &msgsRead;
+	clientReadOpts1.lock = &readLock;
+	clientReadOpts2.pThreadId = &clientReadThread2;
+	clientReadOpts2.pChnl = clientChannel;
+	clientReadOpts2.readCount = &msgsRead;
+	clientReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&serverWriteThread1, nonBlockingWriteThread, (void*)&serverWriteOpts1);
+	RSSL_THREAD_START(&serverWriteThread2, nonBlockingWriteThread, (void*)&serverWriteOpts2);
+
+	RSSL_THREAD_START(&clientReadThread1, nonBlockingReadThread, (void*)&clientReadOpts1);
+	RSSL_THREAD_START(&clientReadThread2, nonBlockingReadThread, (void*)&clientReadOpts2);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+	
+	shutdownTest = true;
+	
+	rsslCloseChannel(serverChannel, &err);
+	
+	RSSL_THREAD_JOIN(serverWriteThread1);
+	RSSL_THREAD_JOIN(serverWriteThread2);
+	RSSL_THREAD_JOIN(clientReadThread1);
+	RSSL_THREAD_JOIN(clientReadThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*  Test runs two writer threads on the server, and two reader threads on the client, and 
+	a pinging thread on the client channel. Once the writer threads have each written their 
+	full data, sets the shutdown boolean and waits for the reader threads to finish.*/
+TEST_F(AllLockTests, NonBlockingClientTwoWriterServerTwoReaderPing)
+{
+	RsslThreadId serverReadThread1, serverReadThread2, clientWriteThread1, clientWriteThread2, clientPingThread;
+	ReadChannel serverReadOpts1, serverReadOpts2;
+	WriteChannel clientWriteOpts1, clientWriteOpts2;
+	PingChannel clientPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	serverReadOpts1.pThreadId = &serverReadThread1;
+	serverReadOpts1.pChnl = serverChannel;
+	serverReadOpts1.readCount = &msgsRead;
+	serverReadOpts1.lock = &readLock;
+	serverReadOpts2.pThreadId = &serverReadThread2;
+	serverReadOpts2.pChnl = serverChannel;
+	serverReadOpts2.readCount = &msgsRead;
+	serverReadOpts2.lock = &readLock;
+
+	clientWriteOpts1.pThreadId = &clientWriteThread1;
+	clientWriteOpts1.pChnl = clientChannel;
+	clientWriteOpts2.pThreadId = &clientWriteThread2;
+	clientWriteOpts2.pChnl = clientChannel;
+	clientPingOpts.pThreadId = &clientPingThread;
+	clientPingOpts.pChnl = clientChannel;
+
+	RSSL_THREAD_START(&serverReadThread1, nonBlockingReadThread, (void*)&serverReadOpts1);
+	RSSL_THREAD_START(&serverReadThread2, nonBlockingReadThread, (void*)&serverReadOpts2);
+
+	RSSL_THREAD_START(&clientWriteThread1, nonBlockingWriteThread, (void*)&clientWriteOpts1);
+	RSSL_THREAD_START(&clientWriteThread2, nonBlockingWriteThread, (void*)&clientWriteOpts2);
+	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread1);
+	RSSL_THREAD_JOIN(clientWriteThread2);
+	RSSL_THREAD_JOIN(clientPingThread);
+
+	rsslCloseChannel(clientChannel, &err);
+
+	RSSL_THREAD_JOIN(serverReadThread1);
+	RSSL_THREAD_JOIN(serverReadThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+
+}
+
+/*  Test runs two reader threads on the server, and two writer threads on the client, and a pinging thread
+	on the server channel. Once the writer threads have each written their full data, sets 
+	the shutdown boolean and waits for the reader threads to finish.*/
+TEST_F(AllLockTests, NonBlockingClientTwoReaderServerTwoWriterPing)
+{
+	RsslThreadId serverWriteThread1, serverWriteThread2, serverPingThread, clientReadThread1, clientReadThread2;
+
+	ReadChannel clientReadOpts1, clientReadOpts2;
+	WriteChannel serverWriteOpts1, serverWriteOpts2;
+	PingChannel serverPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	serverWriteOpts1.pThreadId = &serverWriteThread1;
+	serverWriteOpts1.pChnl = serverChannel;
+	serverWriteOpts2.pThreadId = &serverWriteThread2;
+	serverWriteOpts2.pChnl = serverChannel;
+	serverPingOpts.pThreadId = &serverPingThread;
+	serverPingOpts.pChnl = serverChannel;
+
+	clientReadOpts1.pThreadId = &clientReadThread1;
+	clientReadOpts1.pChnl = clientChannel;
+	clientReadOpts1.readCount = &msgsRead;
+	clientReadOpts1.lock = &readLock;
+	clientReadOpts2.pThreadId = &clientReadThread2;
+	clientReadOpts2.pChnl = clientChannel;
+	clientReadOpts2.readCount = &msgsRead;
+	clientReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&serverWriteThread1, nonBlockingWriteThread, (void*)&serverWriteOpts1);
+	RSSL_THREAD_START(&serverWriteThread2, nonBlockingWriteThread, (void*)&serverWriteOpts2);
+	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+
+	RSSL_THREAD_START(&clientReadThread1, nonBlockingReadThread, (void*)&clientReadOpts1);
+	RSSL_THREAD_START(&clientReadThread2, nonBlockingReadThread, (void*)&clientReadOpts2);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	rsslCloseChannel(serverChannel, &err);
+
+	RSSL_THREAD_JOIN(serverWriteThread1);
+	RSSL_THREAD_JOIN(serverWriteThread2);
+	RSSL_THREAD_JOIN(serverPingThread);
+	RSSL_THREAD_JOIN(clientReadThread1);
+	RSSL_THREAD_JOIN(clientReadThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*  Multiple reader client threads from a single writer server. Once the writer threads 
+	have each written their full data, sets the shutdown boolean and waits for the 
+	reader threads to finish.*/
+TEST_F(AllLockTests, NonBlockingClientTwoReaderServerWriter)
+{
+	RsslThreadId serverWriteThread, clientReadThread1, clientReadThread2;
+
+	ReadChannel clientReadOpts1, clientReadOpts2;
+	WriteChannel serverWriteOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	serverWriteOpts.pThreadId = &serverWriteThread;
+	serverWriteOpts.pChnl = serverChannel;
+
+	clientReadOpts1.pThreadId = &clientReadThread1;
+	clientReadOpts1.pChnl = clientChannel;
+	clientReadOpts1.readCount = &msgsRead;
+	clientReadOpts1.lock = &readLock;
+	clientReadOpts2.pThreadId = &clientReadThread2;
+	clientReadOpts2.pChnl = clientChannel;
+	clientReadOpts2.readCount = &msgsRead;
+	clientReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
+
+	RSSL_THREAD_START(&clientReadThread1, nonBlockingReadThread, (void*)&clientReadOpts1);
+	RSSL_THREAD_START(&clientReadThread2, nonBlockingReadThread, (void*)&clientReadOpts1);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+	
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(serverWriteThread);
+
+	rsslCloseChannel(serverChannel, &err);
+
+	RSSL_THREAD_JOIN(clientReadThread1);
+	RSSL_THREAD_JOIN(clientReadThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/* Multiple reader server threads from a single writer client. Once the writer threads 
+	have each written their full data, sets the shutdown boolean and waits for the 
+	reader threads to finish.*/
+TEST_F(AllLockTests, NonBlockingClientWriterServerTwoReader)
+{
+	RsslThreadId clientWriteThread, serverReadThread1, serverReadThread2;
+
+	ReadChannel serverReadOpts1, serverReadOpts2;
+	WriteChannel clientWriteOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	clientWriteOpts.pThreadId = &clientWriteThread;
+	clientWriteOpts.pChnl = clientChannel;
+
+	serverReadOpts1.pThreadId = &serverReadThread1;
+	serverReadOpts1.pChnl = serverChannel;
+	serverReadOpts1.readCount = &msgsRead;
+	serverReadOpts1.lock = &readLock;
+	serverReadOpts2.pThreadId = &serverReadThread2;
+	serverReadOpts2.pChnl = serverChannel;
+	serverReadOpts2.readCount = &msgsRead;
+	serverReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
+
+	RSSL_THREAD_START(&serverReadThread1, nonBlockingReadThread, (void*)&serverReadOpts1);
+	RSSL_THREAD_START(&serverReadThread2, nonBlockingReadThread, (void*)&serverReadOpts2);
+
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+	
+	shutdownTest = true;
+	
+	RSSL_THREAD_JOIN(clientWriteThread);
+
+	rsslCloseChannel(clientChannel, &err);
+	
+	RSSL_THREAD_JOIN(serverReadThread1);
+	RSSL_THREAD_JOIN(serverReadThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+
+}
+
+/*  Multiple reader client threads from a single writer server, and with a pinging thread.
+	Once the writer threads have each written their full data, sets the shutdown boolean 
+	and waits for the reader threads to finish.*/
+TEST_F(AllLockTests, NonBlockingClientTwoReaderServerWriterPing)
+{
+	RsslThreadId serverWriteThread, serverPingThread, clientReadThread1, clientReadThread2;
+
+	ReadChannel clientReadOpts1, clientReadOpts2;
+	WriteChannel serverWriteOpts;
+	PingChannel serverPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	serverWriteOpts.pThreadId = &serverWriteThread;
+	serverWriteOpts.pChnl = serverChannel;
+	serverPingOpts.pThreadId = &serverPingThread;
+	serverPingOpts.pChnl = serverChannel;
+
+	clientReadOpts1.pThreadId = &clientReadThread1;
+	clientReadOpts1.pChnl = clientChannel;
+	clientReadOpts1.readCount = &msgsRead;
+	clientReadOpts1.lock = &readLock;
+	clientReadOpts2.pThreadId = &clientReadThread2;
+	clientReadOpts2.pChnl = clientChannel;
+	clientReadOpts2.readCount = &msgsRead;
+	clientReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
+	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+
+	RSSL_THREAD_START(&clientReadThread1, nonBlockingReadThread, (void*)&clientReadOpts1);
+	RSSL_THREAD_START(&clientReadThread2, nonBlockingReadThread, (void*)&clientReadOpts1);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(serverWriteThread);
+	RSSL_THREAD_JOIN(serverPingThread);
+
+	rsslCloseChannel(serverChannel, &err);
+
+	RSSL_THREAD_JOIN(clientReadThread1);
+	RSSL_THREAD_JOIN(clientReadThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*  Multiple reader server threads from a single writer client, and with a pinging thread.
+	Once the writer threads have each written their full data, sets the shutdown boolean
+	and waits for the reader threads to finish.*/
+TEST_F(AllLockTests, NonBlockingClientWriterServerTwoReaderPing)
+{
+	RsslThreadId clientWriteThread, clientPingThread, serverReadThread1, serverReadThread2;
+
+
+	ReadChannel serverReadOpts1, serverReadOpts2;
+	WriteChannel clientWriteOpts;
+	PingChannel clientPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_FALSE);
+
+	clientWriteOpts.pThreadId = &clientWriteThread;
+	clientWriteOpts.pChnl = clientChannel;
+	clientPingOpts.pThreadId = &clientPingThread;
+	clientPingOpts.pChnl = clientChannel;
+
+	serverReadOpts1.pThreadId = &serverReadThread1;
+	serverReadOpts1.pChnl = serverChannel;
+	serverReadOpts1.readCount = &msgsRead;
+	serverReadOpts1.lock = &readLock;
+	serverReadOpts2.pThreadId = &serverReadThread2;
+	serverReadOpts2.pChnl = serverChannel;
+	serverReadOpts2.readCount = &msgsRead;
+	serverReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
+	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+
+	RSSL_THREAD_START(&serverReadThread1, nonBlockingReadThread, (void*)&serverReadOpts1);
+	RSSL_THREAD_START(&serverReadThread2, nonBlockingReadThread, (void*)&serverReadOpts2);
+
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread);
+	RSSL_THREAD_JOIN(clientPingThread);
+
+	rsslCloseChannel(clientChannel, &err);
+
+	RSSL_THREAD_JOIN(serverReadThread1);
+	RSSL_THREAD_JOIN(serverReadThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+
+}
+
+/*	Test kicks off one writer and one reader thread for the client and server. Also
+	starts a thread for pinging both the client and server connections.  Once
+	the writer threads have each written their full data, sets the shutdown boolean and
+	waits for the reader threads to finish. */
+TEST_F(AllLockTests, BlockingClientTwoWriterServerTwoReader)
+{
+	RsslThreadId serverReadThread1, serverReadThread2, clientWriteThread1, clientWriteThread2;
+
+	ReadChannel serverReadOpts1, serverReadOpts2;
+	WriteChannel clientWriteOpts1, clientWriteOpts2;
+	int readCount;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	serverReadOpts1.pThreadId = &serverReadThread1;
+	serverReadOpts1.pChnl = serverChannel;
+	serverReadOpts1.readCount = &msgsRead;
+	serverReadOpts1.lock = &readLock;
+	serverReadOpts2.pThreadId = &serverReadThread2;
+	serverReadOpts2.pChnl = serverChannel;
+	serverReadOpts2.readCount = &msgsRead;
+	serverReadOpts2.lock = &readLock;
+
+	clientWriteOpts1.pThreadId = &clientWriteThread1;
+	clientWriteOpts1.pChnl = clientChannel;
+	clientWriteOpts2.pThreadId = &clientWriteThread2;
+	clientWriteOpts2.pChnl = clientChannel;
+
+	RSSL_THREAD_START(&serverReadThread1, blockingReadThread, (void*)&serverReadOpts1);
+	RSSL_THREAD_START(&serverReadThread2, blockingReadThread, (void*)&serverReadOpts2);
+
+	RSSL_THREAD_START(&clientWriteThread1, blockingWriteThread, (void*)&clientWriteOpts1);
+	RSSL_THREAD_START(&clientWriteThread2, blockingWriteThread, (void*)&clientWriteOpts2);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread1);
+	RSSL_THREAD_JOIN(clientWriteThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+	
+	RSSL_THREAD_JOIN(serverReadThread1);
+	RSSL_THREAD_JOIN(serverReadThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+}
+
+/*	Test kicks off two writer threads on the client and two reader threads on the server. Once
+	the writer threads have each written their full data, sets the shutdown boolean and
+	waits for the reader threads to finish. */
+TEST_F(AllLockTests, BlockingClientTwoReaderServerTwoWriter)
+{
+	RsslThreadId serverWriteThread1, serverWriteThread2, clientReadThread1, clientReadThread2;
+
+	ReadChannel clientReadOpts1, clientReadOpts2;
+	WriteChannel serverWriteOpts1, serverWriteOpts2;
+	int readCount;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	serverWriteOpts1.pThreadId = &serverWriteThread1;
+	serverWriteOpts1.pChnl = serverChannel;
+	serverWriteOpts2.pThreadId = &serverWriteThread2;
+	serverWriteOpts2.pChnl = serverChannel;
+
+	clientReadOpts1.pThreadId = &clientReadThread1;
+	clientReadOpts1.pChnl = clientChannel;
+	clientReadOpts1.readCount = &msgsRead;
+	clientReadOpts1.lock = &readLock;
+	clientReadOpts2.pThreadId = &clientReadThread2;
+	clientReadOpts2.pChnl = clientChannel;
+	clientReadOpts2.readCount = &msgsRead;
+	clientReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&serverWriteThread1, blockingWriteThread, (void*)&serverWriteOpts1);
+	RSSL_THREAD_START(&serverWriteThread2, blockingWriteThread, (void*)&serverWriteOpts2);
+
+	RSSL_THREAD_START(&clientReadThread1, blockingReadThread, (void*)&clientReadOpts1);
+	RSSL_THREAD_START(&clientReadThread2, blockingReadThread, (void*)&clientReadOpts2);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+	
+	RSSL_THREAD_JOIN(serverWriteThread1);
+	RSSL_THREAD_JOIN(serverWriteThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+	
+	RSSL_THREAD_JOIN(clientReadThread1);
+	RSSL_THREAD_JOIN(clientReadThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*  Test runs two writer threads on the server, and two reader threads on the client, and
+	a pinging thread on the server channel. Once the writer threads have each written their
+	full data, sets the shutdown boolean and waits for the reader threads to finish.*/
+TEST_F(AllLockTests, BlockingClientTwoWriterServerTwoReaderPing)
+{
+	RsslThreadId serverReadThread1, serverReadThread2, clientWriteThread1, clientWriteThread2, clientPingThread;
+	ReadChannel serverReadOpts1, serverReadOpts2;
+	WriteChannel clientWriteOpts1, clientWriteOpts2;
+	PingChannel clientPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	serverReadOpts1.pThreadId = &serverReadThread1;
+	serverReadOpts1.pChnl = serverChannel;
+	serverReadOpts1.readCount = &msgsRead;
+	serverReadOpts1.lock = &readLock;
+	serverReadOpts2.pThreadId = &serverReadThread2;
+	serverReadOpts2.pChnl = serverChannel;
+	serverReadOpts2.readCount = &msgsRead;
+	serverReadOpts2.lock = &readLock;
+
+	clientWriteOpts1.pThreadId = &clientWriteThread1;
+	clientWriteOpts1.pChnl = clientChannel;
+	clientWriteOpts2.pThreadId = &clientWriteThread2;
+	clientWriteOpts2.pChnl = clientChannel;
+	clientPingOpts.pThreadId = &clientPingThread;
+	clientPingOpts.pChnl = clientChannel;
+
+	RSSL_THREAD_START(&serverReadThread1, blockingReadThread, (void*)&serverReadOpts1);
+	RSSL_THREAD_START(&serverReadThread2, blockingReadThread, (void*)&serverReadOpts2);
+
+	RSSL_THREAD_START(&clientWriteThread1, blockingWriteThread, (void*)&clientWriteOpts1);
+	RSSL_THREAD_START(&clientWriteThread2, blockingWriteThread, (void*)&clientWriteOpts2);
+	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread1);
+	RSSL_THREAD_JOIN(clientWriteThread2);
+	RSSL_THREAD_JOIN(clientPingThread);
+
+	rsslCloseChannel(clientChannel, &err);
+
+	RSSL_THREAD_JOIN(serverReadThread1);
+	RSSL_THREAD_JOIN(serverReadThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+
+}
+
+/*  Test runs two reader threads on the server, and two writer threads on the client, and a pinging thread
+	on the client channel. Once the writer threads have each written their full data, sets
+	the shutdown boolean and waits for the reader threads to finish.*/
+TEST_F(AllLockTests, BlockingClientTwoReaderServerTwoWriterPing)
+{
+	RsslThreadId serverWriteThread1, serverWriteThread2, serverPingThread, clientReadThread1, clientReadThread2;
+
+	ReadChannel clientReadOpts1, clientReadOpts2;
+	WriteChannel serverWriteOpts1, serverWriteOpts2;
+	PingChannel serverPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	serverWriteOpts1.pThreadId = &serverWriteThread1;
+	serverWriteOpts1.pChnl = serverChannel;
+	serverWriteOpts2.pThreadId = &serverWriteThread2;
+	serverWriteOpts2.pChnl = serverChannel;
+	serverPingOpts.pThreadId = &serverPingThread;
+	serverPingOpts.pChnl = serverChannel;
+
+	clientReadOpts1.pThreadId = &clientReadThread1;
+	clientReadOpts1.pChnl = clientChannel;
+	clientReadOpts1.readCount = &msgsRead;
+	clientReadOpts1.lock = &readLock;
+	clientReadOpts2.pThreadId = &clientReadThread2;
+	clientReadOpts2.pChnl = clientChannel;
+	clientReadOpts2.readCount = &msgsRead;
+	clientReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&serverWriteThread1, blockingWriteThread, (void*)&serverWriteOpts1);
+	RSSL_THREAD_START(&serverWriteThread2, blockingWriteThread, (void*)&serverWriteOpts2);
+	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+
+	RSSL_THREAD_START(&clientReadThread1, blockingReadThread, (void*)&clientReadOpts1);
+	RSSL_THREAD_START(&clientReadThread2, blockingReadThread, (void*)&clientReadOpts2);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	rsslCloseChannel(serverChannel, &err);
+
+	RSSL_THREAD_JOIN(serverWriteThread1);
+	RSSL_THREAD_JOIN(serverWriteThread2);
+	RSSL_THREAD_JOIN(serverPingThread);
+	RSSL_THREAD_JOIN(clientReadThread1);
+	RSSL_THREAD_JOIN(clientReadThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*  Multiple reader client threads from a single writer server. Once the writer threads
+	have each written their full data, sets the shutdown boolean and waits for the
+	reader threads to finish.*/
+TEST_F(AllLockTests, BlockingClientTwoReaderServerWriter)
+{
+	RsslThreadId serverWriteThread, clientReadThread1, clientReadThread2;
+
+	ReadChannel clientReadOpts1, clientReadOpts2;
+	WriteChannel serverWriteOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	serverWriteOpts.pThreadId = &serverWriteThread;
+	serverWriteOpts.pChnl = serverChannel;
+
+	clientReadOpts1.pThreadId = &clientReadThread1;
+	clientReadOpts1.pChnl = clientChannel;
+	clientReadOpts1.readCount = &msgsRead;
+	clientReadOpts1.lock = &readLock;
+	clientReadOpts2.pThreadId = &clientReadThread2;
+	clientReadOpts2.pChnl = clientChannel;
+	clientReadOpts2.readCount = &msgsRead;
+	clientReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&serverWriteThread, blockingWriteThread, (void*)&serverWriteOpts);
+
+	RSSL_THREAD_START(&clientReadThread1, blockingReadThread, (void*)&clientReadOpts1);
+	RSSL_THREAD_START(&clientReadThread2, blockingReadThread, (void*)&clientReadOpts1);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(serverWriteThread);
+
+	rsslCloseChannel(serverChannel, &err);
+
+	RSSL_THREAD_JOIN(clientReadThread1);
+	RSSL_THREAD_JOIN(clientReadThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*  Multiple reader server threads from a single writer client. Once the writer threads
+	have each written their full data, sets the shutdown boolean and waits for the
+	reader threads to finish.*/
+TEST_F(AllLockTests, BlockingClientWriterServerTwoReader)
+{
+	RsslThreadId clientWriteThread, serverReadThread1, serverReadThread2;
+
+	ReadChannel serverReadOpts1, serverReadOpts2;
+	WriteChannel clientWriteOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	clientWriteOpts.pThreadId = &clientWriteThread;
+	clientWriteOpts.pChnl = clientChannel;
+
+	serverReadOpts1.pThreadId = &serverReadThread1;
+	serverReadOpts1.pChnl = serverChannel;
+	serverReadOpts1.readCount = &msgsRead;
+	serverReadOpts1.lock = &readLock;
+	serverReadOpts2.pThreadId = &serverReadThread2;
+	serverReadOpts2.pChnl = serverChannel;
+	serverReadOpts2.readCount = &msgsRead;
+	serverReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&clientWriteThread, blockingWriteThread, (void*)&clientWriteOpts);
+
+	RSSL_THREAD_START(&serverReadThread1, blockingReadThread, (void*)&serverReadOpts1);
+	RSSL_THREAD_START(&serverReadThread2, blockingReadThread, (void*)&serverReadOpts2);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+	
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread);
+
+	rsslCloseChannel(clientChannel, &err);
+
+	RSSL_THREAD_JOIN(serverReadThread1);
+	RSSL_THREAD_JOIN(serverReadThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+}
+
+/*  Multiple reader client threads from a single writer server, and with a pinging thread.
+	Once the writer threads have each written their full data, sets the shutdown boolean
+	and waits for the reader threads to finish.*/
+TEST_F(AllLockTests, BlockingClientTwoReaderServerWriterPing)
+{
+	RsslThreadId serverWriteThread, serverPingThread, clientReadThread1, clientReadThread2;
+
+	ReadChannel clientReadOpts1, clientReadOpts2;
+	WriteChannel serverWriteOpts;
+	PingChannel serverPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	serverWriteOpts.pThreadId = &serverWriteThread;
+	serverWriteOpts.pChnl = serverChannel;
+	serverPingOpts.pThreadId = &serverPingThread;
+	serverPingOpts.pChnl = serverChannel;
+
+	clientReadOpts1.pThreadId = &clientReadThread1;
+	clientReadOpts1.pChnl = clientChannel;
+	clientReadOpts1.readCount = &msgsRead;
+	clientReadOpts1.lock = &readLock;
+	clientReadOpts2.pThreadId = &clientReadThread2;
+	clientReadOpts2.pChnl = clientChannel;
+	clientReadOpts2.readCount = &msgsRead;
+	clientReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&serverWriteThread, blockingWriteThread, (void*)&serverWriteOpts);
+	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+
+	RSSL_THREAD_START(&clientReadThread1, blockingReadThread, (void*)&clientReadOpts1);
+	RSSL_THREAD_START(&clientReadThread2, blockingReadThread, (void*)&clientReadOpts1);
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(serverWriteThread);
+	RSSL_THREAD_JOIN(serverPingThread);
+
+	rsslCloseChannel(serverChannel, &err);
+
+	RSSL_THREAD_JOIN(clientReadThread1);
+	RSSL_THREAD_JOIN(clientReadThread2);
+
+	rsslCloseChannel(clientChannel, &err);
+}
+
+/*  Multiple reader server threads from a single writer client, and with a pinging thread.
+	Once the writer threads have each written their full data, sets the shutdown boolean
+	and waits for the reader threads to finish.*/
+TEST_F(AllLockTests, BlockingClientWriterServerTwoReaderPing)
+{
+	RsslThreadId clientWriteThread, clientPingThread, serverReadThread1, serverReadThread2;
+
+
+	ReadChannel serverReadOpts1, serverReadOpts2;
+	WriteChannel clientWriteOpts;
+	PingChannel clientPingOpts;
+	int readCount;
+
+	startupServerAndConections(RSSL_TRUE);
+
+	clientWriteOpts.pThreadId = &clientWriteThread;
+	clientWriteOpts.pChnl = clientChannel;
+	clientPingOpts.pThreadId = &clientPingThread;
+	clientPingOpts.pChnl = clientChannel;
+
+	serverReadOpts1.pThreadId = &serverReadThread1;
+	serverReadOpts1.pChnl = serverChannel;
+	serverReadOpts1.readCount = &msgsRead;
+	serverReadOpts1.lock = &readLock;
+	serverReadOpts2.pThreadId = &serverReadThread2;
+	serverReadOpts2.pChnl = serverChannel;
+	serverReadOpts2.readCount = &msgsRead;
+	serverReadOpts2.lock = &readLock;
+
+	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
+	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+
+	RSSL_THREAD_START(&serverReadThread1, blockingReadThread, (void*)&serverReadOpts1);
+	RSSL_THREAD_START(&serverReadThread2, blockingReadThread, (void*)&serverReadOpts2);
+
+
+	do
+	{
+		time_sleep(500);
+		RSSL_MUTEX_LOCK(&readLock);
+		readCount = msgsRead;
+		RSSL_MUTEX_UNLOCK(&readLock);
+	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	shutdownTest = true;
+
+	RSSL_THREAD_JOIN(clientWriteThread);
+	RSSL_THREAD_JOIN(clientPingThread);
+
+	rsslCloseChannel(clientChannel, &err);
+
+	RSSL_THREAD_JOIN(serverReadThread1);
+	RSSL_THREAD_JOIN(serverReadThread2);
+
+	rsslCloseChannel(serverChannel, &err);
+
+}
+
+class ManyThreadConnectionTests : public ::testing::Test {
+protected:
+	RsslServer* server;
+	int writeMsgs;
+	RsslError err;
+	bool threadsCreated;
+
+	RsslThreadId clientThreads[MAX_THREADS];
+	RsslThreadId serverThreads[MAX_THREADS];
+	ManyThreadChannel clientOpts[MAX_THREADS];
+	ManyThreadChannel serverOpts[MAX_THREADS];
+	int threadReadCount[MAX_THREADS];
+	RsslMutex readLock[MAX_THREADS];
+
+	virtual void SetUp()
+	{
+		writeMsgs = 1;
+		threadsCreated = false;
+		shutdownTest = false;
+		failTest = false;
+
+		for (int i = 0; i < MAX_THREADS; ++i)
+		{
+			RSSL_MUTEX_INIT(&readLock[i]);
+			threadReadCount[i] = 0;
+		}
+	}
+
+	virtual void TearDown()
+	{
+
+		if(failTest && threadsCreated)
+		{
+			for (int i = 0; i < MAX_THREADS; i++)
+			{
+				RSSL_THREAD_KILL(&clientThreads[i]);
+				RSSL_THREAD_KILL(&serverThreads[i]);
+			}
+		} 
+		rsslUninitialize();
+		server = NULL;
+		resetDeadlockTimer();
+	}
+};
+
+/*  Starts up a nonblocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.  
+	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
+TEST_F(ManyThreadConnectionTests, NonBlockingAllLockClientReadServerWrite)
+{
+
+	RsslServer* server = NULL;
+	int i;
+	int readMax = 0;
+	int threadsDone = 0;
+
+	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+
+	server = startupServer(RSSL_FALSE);
+	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		clientOpts[i].pThreadId = &clientThreads[i];
+		clientOpts[i].serverChannel = false;
+		clientOpts[i].readCount = &(threadReadCount[i]);
+		clientOpts[i].lock = &readLock[i];
+		RSSL_THREAD_START(&clientThreads[i], nonBlockingManyChannelReadThread, (void*)&clientOpts[i]);
+
+		serverOpts[i].pThreadId = &serverThreads[i];
+		serverOpts[i].serverChannel = true;
+		serverOpts[i].pServer = server;
+		serverOpts[i].msgCount = writeMsgs;
+		RSSL_THREAD_START(&serverThreads[i], nonBlockingManyChannelWriteThread, (void*)&serverOpts[i]);
+	}
+
+	threadsCreated = true;
+
+	while (!shutdownTest && !failTest)
+	{
+		time_sleep(500);
+		threadsDone = 0;
+		for (i = 0; i < MAX_THREADS; i++)
+		{
+			RSSL_MUTEX_LOCK(&readLock[i]);
+			if (threadReadCount[i] == writeMsgs)
+				++threadsDone;
+			RSSL_MUTEX_UNLOCK(&readLock[i]);
+		}
+
+		if (threadsDone == MAX_THREADS)
+		{
+			shutdownTest = true;
+		}
+	}	
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(serverThreads[i]);
+	}
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(clientThreads[i]);
+	}
+
+	rsslCloseServer(server, &err);
+	
+
+}
+
+/*  Starts up a nonblocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
+	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
+TEST_F(ManyThreadConnectionTests, NonBlockingAllLockClientWriteServerRead)
+{
+
+	RsslServer* server = NULL;
+	int i;
+	int readMax = 0;
+	int threadsDone = 0;
+
+	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+
+	server = startupServer(RSSL_FALSE);
+	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		clientOpts[i].pThreadId = &clientThreads[i];
+		clientOpts[i].serverChannel = false;
+		clientOpts[i].msgCount = writeMsgs;
+		RSSL_THREAD_START(&clientThreads[i], nonBlockingManyChannelWriteThread, (void*)&clientOpts[i]);
+
+		serverOpts[i].pThreadId = &serverThreads[i];
+		serverOpts[i].serverChannel = true;
+		serverOpts[i].pServer = server;
+		serverOpts[i].lock = &readLock[i];
+		serverOpts[i].readCount = &(threadReadCount[i]);
+		RSSL_THREAD_START(&serverThreads[i], nonBlockingManyChannelReadThread, (void*)&serverOpts[i]);
+	}
+
+	threadsCreated = true;
+
+	while (!shutdownTest && !failTest)
+	{
+		time_sleep(500);
+		threadsDone = 0;
+		for (i = 0; i < MAX_THREADS; i++)
+		{
+			RSSL_MUTEX_LOCK(&readLock[i]);
+			if (threadReadCount[i] == writeMsgs)
+				++threadsDone;
+			RSSL_MUTEX_UNLOCK(&readLock[i]);
+		}
+
+		if (threadsDone == MAX_THREADS)
+		{
+			shutdownTest = true;
+		}
+	}
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(serverThreads[i]);
+	}
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(clientThreads[i]);
+	}
+
+	rsslCloseServer(server, &err);
+}
+
+/*  Starts up a nonblocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
+	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
+TEST_F(ManyThreadConnectionTests, NonBlockingGlobalLockClientReadServerWrite)
+{
+
+	RsslServer* server = NULL;
+	int i;
+	int readMax = 0;
+	int threadsDone = 0;
+
+	rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+
+	server = startupServer(RSSL_FALSE);
+	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		clientOpts[i].pThreadId = &clientThreads[i];
+		clientOpts[i].serverChannel = false;
+		clientOpts[i].readCount = &(threadReadCount[i]);
+		clientOpts[i].lock = &readLock[i];
+		RSSL_THREAD_START(&clientThreads[i], nonBlockingManyChannelReadThread, (void*)&clientOpts[i]);
+
+		serverOpts[i].pThreadId = &serverThreads[i];
+		serverOpts[i].serverChannel = true;
+		serverOpts[i].pServer = server;
+		serverOpts[i].msgCount = writeMsgs;
+		RSSL_THREAD_START(&serverThreads[i], nonBlockingManyChannelWriteThread, (void*)&serverOpts[i]);
+	}
+
+	threadsCreated = true;
+
+	while (!shutdownTest && !failTest)
+	{
+		time_sleep(500);
+		threadsDone = 0;
+		for (i = 0; i < MAX_THREADS; i++)
+		{
+			RSSL_MUTEX_LOCK(&readLock[i]);
+			if (threadReadCount[i] == writeMsgs)
+				++threadsDone;
+			RSSL_MUTEX_UNLOCK(&readLock[i]);
+		}
+
+		if (threadsDone == MAX_THREADS)
+		{
+			shutdownTest = true;
+		}
+	}
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(serverThreads[i]);
+	}
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(clientThreads[i]);
+	}
+
+	rsslCloseServer(server, &err);
+}
+
+/*  Starts up a nonblocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
+	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
+TEST_F(ManyThreadConnectionTests, NonBlockingGlobalLockClientWriteServerRead)
+{
+
+	RsslServer* server = NULL;
+	int i;
+	int readMax = 0;
+	int threadsDone = 0;
+
+	rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+
+	server = startupServer(RSSL_FALSE);
+	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		clientOpts[i].pThreadId = &clientThreads[i];
+		clientOpts[i].serverChannel = false;
+		clientOpts[i].msgCount = writeMsgs;
+		RSSL_THREAD_START(&clientThreads[i], nonBlockingManyChannelWriteThread, (void*)&clientOpts[i]);
+
+		serverOpts[i].pThreadId = &serverThreads[i];
+		serverOpts[i].serverChannel = true;
+		serverOpts[i].pServer = server;
+		serverOpts[i].lock = &readLock[i];
+		serverOpts[i].readCount = &(threadReadCount[i]);
+		RSSL_THREAD_START(&serverThreads[i], nonBlockingManyChannelReadThread, (void*)&serverOpts[i]);
+	}
+
+	threadsCreated = true;
+
+	while (!shutdownTest && !failTest)
+	{
+		time_sleep(500);
+		threadsDone = 0;
+		for (i = 0; i < MAX_THREADS; i++)
+		{
+			RSSL_MUTEX_LOCK(&readLock[i]);
+			if (threadReadCount[i] == writeMsgs)
+				++threadsDone;
+			RSSL_MUTEX_UNLOCK(&readLock[i]);
+		}
+
+		if (threadsDone == MAX_THREADS)
+		{
+			shutdownTest = true;
+		}
+	}
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(serverThreads[i]);
+	}
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(clientThreads[i]);
+	}
+
+	rsslCloseServer(server, &err);
+}
+
+/*  Starts up a blocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
+	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
+TEST_F(ManyThreadConnectionTests, BlockingAllLockClientReadServerWrite)
+{
+
+	RsslServer* server = NULL;
+	int i;
+	int readMax = 0;
+	int threadsDone = 0;
+
+	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+
+	server = startupServer(RSSL_TRUE);
+	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		clientOpts[i].pThreadId = &clientThreads[i];
+		clientOpts[i].serverChannel = false;
+		clientOpts[i].readCount = &(threadReadCount[i]);
+		clientOpts[i].lock = &readLock[i];
+		RSSL_THREAD_START(&clientThreads[i], blockingManyChannelReadThread, (void*)&clientOpts[i]);
+
+		serverOpts[i].pThreadId = &serverThreads[i];
+		serverOpts[i].serverChannel = true;
+		serverOpts[i].pServer = server;
+		serverOpts[i].msgCount = writeMsgs;
+		RSSL_THREAD_START(&serverThreads[i], blockingManyChannelWriteThread, (void*)&serverOpts[i]);
+	}
+
+	threadsCreated = true;
+
+	while (!shutdownTest && !failTest)
+	{
+		time_sleep(500);
+		threadsDone = 0;
+		for (i = 0; i < MAX_THREADS; i++)
+		{
+			RSSL_MUTEX_LOCK(&readLock[i]);
+			if (threadReadCount[i] == writeMsgs)
+				++threadsDone;
+			RSSL_MUTEX_UNLOCK(&readLock[i]);
+		}
+
+		if (threadsDone == MAX_THREADS)
+		{
+			shutdownTest = true;
+		}
+	}
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(serverThreads[i]);
+	}
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(clientThreads[i]);
+	}
+
+	rsslCloseServer(server, &err);
+}
+
+/*  Starts up a blocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
+	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
+TEST_F(ManyThreadConnectionTests, BlockingAllLockClientWriteServerRead)
+{
+
+	RsslServer* server = NULL;
+	int i;
+	int readMax = 0;
+	int threadsDone = 0;
+
+	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+
+	server = startupServer(RSSL_TRUE);
+	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		clientOpts[i].pThreadId = &clientThreads[i];
+		clientOpts[i].serverChannel = false;
+		clientOpts[i].msgCount = writeMsgs;
+		RSSL_THREAD_START(&clientThreads[i], blockingManyChannelWriteThread, (void*)&clientOpts[i]);
+
+		serverOpts[i].pThreadId = &serverThreads[i];
+		serverOpts[i].serverChannel = true;
+		serverOpts[i].pServer = server;
+		serverOpts[i].lock = &readLock[i];
+		serverOpts[i].readCount = &(threadReadCount[i]);
+		RSSL_THREAD_START(&serverThreads[i], blockingManyChannelReadThread, (void*)&serverOpts[i]);
+	}
+
+	threadsCreated = true;
+
+	while (!shutdownTest && !failTest)
+	{
+		time_sleep(500);
+		threadsDone = 0;
+		for (i = 0; i < MAX_THREADS; i++)
+		{
+			RSSL_MUTEX_LOCK(&readLock[i]);
+			if (threadReadCount[i] == writeMsgs)
+				++threadsDone;
+			RSSL_MUTEX_UNLOCK(&readLock[i]);
+		}
+
+		if (threadsDone == MAX_THREADS)
+		{
+			shutdownTest = true;
+		}
+	}
+
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(serverThreads[i]);
+	}
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(clientThreads[i]);
+	}
+
+	rsslCloseServer(server, &err);
+}
+
+/*  Starts up a blocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
+	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
+TEST_F(ManyThreadConnectionTests, BlockingGlobalLockClientReadServerWrite)
+{
+
+	RsslServer* server = NULL;
+	int i;
+	int readMax = 0;
+	int threadsDone = 0;
+
+	rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+
+	server = startupServer(RSSL_TRUE);
+	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		clientOpts[i].pThreadId = &clientThreads[i];
+		clientOpts[i].serverChannel = false;
+		clientOpts[i].readCount = &(threadReadCount[i]);
+		clientOpts[i].lock = &readLock[i];
+		RSSL_THREAD_START(&clientThreads[i], blockingManyChannelReadThread, (void*)&clientOpts[i]);
+
+		serverOpts[i].pThreadId = &serverThreads[i];
+		serverOpts[i].serverChannel = true;
+		serverOpts[i].pServer = server;
+		serverOpts[i].msgCount = writeMsgs;
+		RSSL_THREAD_START(&serverThreads[i], blockingManyChannelWriteThread, (void*)&serverOpts[i]);
+	}
+
+	threadsCreated = true;
+
+	while (!shutdownTest && !failTest)
+	{
+		time_sleep(500);
+		threadsDone = 0;
+		for (i = 0; i < MAX_THREADS; i++)
+		{
+			RSSL_MUTEX_LOCK(&readLock[i]);
+			if (threadReadCount[i] == writeMsgs)
+				++threadsDone;
+			RSSL_MUTEX_UNLOCK(&readLock[i]);
+		}
+
+		if (threadsDone == MAX_THREADS)
+		{
+			shutdownTest = true;
+		}
+	}
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+	
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(serverThreads[i]);
+	}
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(clientThreads[i]);
+	}
+
+	rsslCloseServer(server, &err);
+}
+
+/*  Starts up a blocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
+	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
+TEST_F(ManyThreadConnectionTests, BlockingGlobalLockClientWriteServerRead)
+{
+
+	RsslServer* server = NULL;
+	int i;
+	int readMax = 0;
+
+	int threadsDone = 0;
+
+	rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+
+	server = startupServer(RSSL_TRUE);
+	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		clientOpts[i].pThreadId = &clientThreads[i];
+		clientOpts[i].serverChannel = false;
+		clientOpts[i].msgCount = writeMsgs;
+		RSSL_THREAD_START(&clientThreads[i], blockingManyChannelWriteThread, (void*)&clientOpts[i]);
+
+		serverOpts[i].pThreadId = &serverThreads[i];
+		serverOpts[i].serverChannel = true;
+		serverOpts[i].pServer = server;
+		serverOpts[i].lock = &readLock[i];
+		serverOpts[i].readCount = &(threadReadCount[i]);
+		RSSL_THREAD_START(&serverThreads[i], blockingManyChannelReadThread, (void*)&serverOpts[i]);
+	}
+
+	threadsCreated = true;
+
+	while (!shutdownTest && !failTest)
+	{
+		time_sleep(500);
+		threadsDone = 0;
+		for (i = 0; i < MAX_THREADS; i++)
+		{
+			RSSL_MUTEX_LOCK(&readLock[i]);
+			if (threadReadCount[i] == writeMsgs)
+				++threadsDone;
+			RSSL_MUTEX_UNLOCK(&readLock[i]);
+		}
+
+		if (threadsDone == MAX_THREADS)
+		{
+			shutdownTest = true;
+		}
+	}
+	
+	ASSERT_FALSE(failTest) << "Test failed.";
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(serverThreads[i]);
+	}
+
+	for (i = 0; i < MAX_THREADS; i++)
+	{
+		RSSL_THREAD_JOIN(clientThreads[i]);
+	}
+
+	rsslCloseServer(server, &err);
+}
+
+/* Testing the host name validation functions */
+
+TEST(OpenSSLHostNameValidation, HostNameValidation)
+{
+	char pattern[16];
+	char hostName[16];
+	RsslBool output = RSSL_TRUE;
+	RsslError err;
+
+	/* No wildcard success */
+	strcpy(pattern, "www.foo.com");
+	strcpy(hostName, "www.foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_TRUE);
+
+	/* No wildcard failure */
+	strcpy(pattern, "www.foo.com");
+	strcpy(hostName, "www.bar.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard success */
+	strcpy(pattern, "*.foo.com");
+	strcpy(hostName, "www.foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_TRUE);
+
+	/* Wildcard success, many tokens */
+	strcpy(pattern, "*.foo.bar.com");
+	strcpy(hostName, "www.foo.bar.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_TRUE);
+
+	/* Wildcard failure */
+	strcpy(pattern, "*.foo.com");
+	strcpy(hostName, "www.bar.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard failure, additional tokens */
+	strcpy(pattern, "*.foo.com");
+	strcpy(hostName, "www.bar.foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard failure, no leftmost token */
+	strcpy(pattern, "*.foo.com");
+	strcpy(hostName, "foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard failure, no leftmost token */
+	strcpy(pattern, "*.foo.com");
+	strcpy(hostName, ".foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard parse failure, too broad of a wildcard */
+	strcpy(pattern, "*.com");
+	strcpy(hostName, "foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard parse failure, partial wildcard */
+	strcpy(pattern, "a*.foo.com");
+	strcpy(hostName, "a.foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard parse failure, partial wildcard */
+	strcpy(pattern, "*a.foo.com");
+	strcpy(hostName, "a.foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard parse failure, partial wildcard */
+	strcpy(pattern, "b*r.foo.com");
+	strcpy(hostName, "bar.foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+
+	/* Wildcard parse failure, non-first wildcard */
+	strcpy(pattern, "bar.*.com");
+	strcpy(hostName, "bar.foo.com");
+	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
+	EXPECT_TRUE(output == RSSL_FALSE);
+}
+
+
+class BindSharedServerSocketOpt : public ::testing::Test {
+protected:
+	RsslServer* pServer;
+
+	virtual void SetUp()
+	{
+		RsslError err;
+
+		pServer = NULL;
+
+		rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+	}
+
+	virtual void TearDown()
+	{
+		RsslError err;
+		rsslCloseServer(pServer, &err);
+		rsslUninitialize();
+		pServer = NULL;
+	}
+
+	void runRsslBind(RsslBindOptions& bindOpts)
+	{
+		RsslError err;
+
+		bindOpts.serviceName = (char*)"15000";
+		bindOpts.protocolType = TEST_PROTOCOL_TYPE;  /* These tests are just sending a pre-set string across the wire, so protocol type should not be RWF */
+
+		pServer = rsslBind(&bindOpts, &err);
+
+		ASSERT_NE(pServer, (RsslServer*)NULL) << "Server creation failed!";
+		ASSERT_NE(pServer->socketId, 0) << "The server socket should be not Null";
+	}
+
+	void testSocketOpt(int optname, bool isExpectedResultTrue, const char* sockOptName)
+	{
+		int optVal;
+		socklen_t lenVal = sizeof(int);
+		int iResult = getsockopt(pServer->socketId, SOL_SOCKET, optname, (char*)&optVal, &lenVal);
+		ASSERT_EQ(iResult, 0) << "getsockopt " << sockOptName << ":  failed";
+		ASSERT_EQ(lenVal, sizeof(int)) << "getsockopt " << sockOptName << ":  invalid length = " << lenVal;
+
+		if (isExpectedResultTrue) {
+			EXPECT_NE(optVal, 0) << "getsockopt " << sockOptName << ": should be True";
+		}
+		else {
+			EXPECT_EQ(optVal, 0) << "getsockopt " << sockOptName << ": should be False";
+		}
+	}
+};
+
+/* Testing setup of the socket options for server call Bind */
+#if defined(_WIN32) || defined(SO_REUSEPORT)
+TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenDefaultInitValues)
+{
+	// Tests default init-values
+	RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+
+	runRsslBind(bindOpts);
+
+	// Tests the socket options: the server socket does not permit sharing
+#if defined(_WIN32)
+	testSocketOpt(SO_REUSEADDR,			false,	"SO_REUSEADDR");
+	testSocketOpt(SO_EXCLUSIVEADDRUSE,	true,	"SO_EXCLUSIVEADDRUSE");
+#else  // Linux
+	testSocketOpt(SO_REUSEADDR,			true,	"SO_REUSEADDR");
+	testSocketOpt(SO_REUSEPORT,			false,	"SO_REUSEPORT");
+#endif
+}
+
+TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenClearBindOpts)
+{
+	// Tests rsslClearBindOpts
+	RsslBindOptions bindOpts;
+	rsslClearBindOpts(&bindOpts);
+
+	runRsslBind(bindOpts);
+
+	// Tests the socket options: the server socket does not permit sharing
+#if defined(_WIN32)
+	testSocketOpt(SO_REUSEADDR, false, "SO_REUSEADDR");
+	testSocketOpt(SO_EXCLUSIVEADDRUSE, true, "SO_EXCLUSIVEADDRUSE");
+#else  // Linux
+	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+	testSocketOpt(SO_REUSEPORT, false, "SO_REUSEPORT");
+#endif
+}
+
+TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenSetFalse)
+{
+	// Tests serverSharedSocket off
+	RsslBindOptions bindOpts;
+	rsslClearBindOpts(&bindOpts);
+	bindOpts.serverSharedSocket = RSSL_FALSE;
 
-	RSSL_THREAD_JOIN(clientReadThread1);
-	RSSL_THREAD_JOIN(clientReadThread2);
+	runRsslBind(bindOpts);
 
-	rsslCloseChannel(clientChannel, &err);
+	// Tests the socket options: the server socket does not permit sharing
+#if defined(_WIN32)
+	testSocketOpt(SO_REUSEADDR, false, "SO_REUSEADDR");
+	testSocketOpt(SO_EXCLUSIVEADDRUSE, true, "SO_EXCLUSIVEADDRUSE");
+#else  // Linux
+	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+	testSocketOpt(SO_REUSEPORT, false, "SO_REUSEPORT");
+#endif
 }
 
-/* Multiple reader server threads from a single writer client. Once the writer threads 
-	have each written their full data, sets the shutdown boolean and waits for the 
-	reader threads to finish.*/
-TEST_F(AllLockTests, NonBlockingClientWriterServerTwoReader)
+TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOnWhenSetTrue)
 {
-	RsslThreadId clientWriteThread, serverReadThread1, serverReadThread2;
+	// Tests serverSharedSocket on
+	RsslBindOptions bindOpts;
+	rsslClearBindOpts(&bindOpts);
+	bindOpts.serverSharedSocket = RSSL_TRUE;
 
-	ReadChannel serverReadOpts1, serverReadOpts2;
-	WriteChannel clientWriteOpts;
-	int readCount;
+	runRsslBind(bindOpts);
 
-	startupServerAndConections(RSSL_FALSE);
+	// Tests the socket options: the server socket permits sharing
+#if defined(_WIN32)
+	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+	testSocketOpt(SO_EXCLUSIVEADDRUSE, false, "SO_EXCLUSIVEADDRUSE");
+#else  // Linux
+	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+	testSocketOpt(SO_REUSEPORT, true, "SO_REUSEPORT");
+#endif
+}
 
-	clientWriteOpts.pThreadId = &clientWriteThread;
-	clientWriteOpts.pChnl = clientChannel;
+#else  // Linux && !defined(SO_REUSEPORT)  // LUP - Linux Unsopported SO_REUSEPORT
 
-	serverReadOpts1.pThreadId = &serverReadThread1;
-	serverReadOpts1.pChnl = serverChannel;
-	serverReadOpts1.readCount = &msgsRead;
-	serverReadOpts1.lock = &readLock;
-	serverReadOpts2.pThreadId = &serverReadThread2;
-	serverReadOpts2.pChnl = serverChannel;
-	serverReadOpts2.readCount = &msgsRead;
-	serverReadOpts2.lock = &readLock;
+TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenDefaultInitValuesLUP)
+{
+	// Tests default init-values
+	RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
 
-	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
+	runRsslBind(bindOpts);
 
-	RSSL_THREAD_START(&serverReadThread1, nonBlockingReadThread, (void*)&serverReadOpts1);
-	RSSL_THREAD_START(&serverReadThread2, nonBlockingReadThread, (void*)&serverReadOpts2);
+	// Tests the socket options: the server socket does not permit sharing
+	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+}
+
+TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenClearBindOptsLUP)
+{
+	// Tests rsslClearBindOpts
+	RsslBindOptions bindOpts;
+	rsslClearBindOpts(&bindOpts);
 
+	runRsslBind(bindOpts);
 
-	do
-	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
-	
-	shutdownTest = true;
-	
-	RSSL_THREAD_JOIN(clientWriteThread);
+	// Tests the socket options: the server socket does not permit sharing
+	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+}
 
-	rsslCloseChannel(clientChannel, &err);
-	
-	RSSL_THREAD_JOIN(serverReadThread1);
-	RSSL_THREAD_JOIN(serverReadThread2);
+TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenSetFalseLUP)
+{
+	// Tests serverSharedSocket off
+	RsslBindOptions bindOpts;
+	rsslClearBindOpts(&bindOpts);
+	bindOpts.serverSharedSocket = RSSL_FALSE;
 
-	rsslCloseChannel(serverChannel, &err);
+	runRsslBind(bindOpts);
 
+	// Tests the socket options: the server socket does not permit sharing
+	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
 }
 
-/*  Multiple reader client threads from a single writer server, and with a pinging thread.
-	Once the writer threads have each written their full data, sets the shutdown boolean 
-	and waits for the reader threads to finish.*/
-TEST_F(AllLockTests, NonBlockingClientTwoReaderServerWriterPing)
+TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeErrorOnRsslBindLUP)
 {
-	RsslThreadId serverWriteThread, serverPingThread, clientReadThread1, clientReadThread2;
-
-	ReadChannel clientReadOpts1, clientReadOpts2;
-	WriteChannel serverWriteOpts;
-	PingChannel serverPingOpts;
-	int readCount;
+	// Tests serverSharedSocket on
+	RsslBindOptions bindOpts;
+	RsslError err;
+	rsslClearBindOpts(&bindOpts);
+	bindOpts.serverSharedSocket = RSSL_TRUE;
 
-	startupServerAndConections(RSSL_FALSE);
+	bindOpts.serviceName = (char*)"15000";
+	bindOpts.protocolType = TEST_PROTOCOL_TYPE;  /* These tests are just sending a pre-set string across the wire, so protocol type should not be RWF */
 
-	serverWriteOpts.pThreadId = &serverWriteThread;
-	serverWriteOpts.pChnl = serverChannel;
-	serverPingOpts.pThreadId = &serverPingThread;
-	serverPingOpts.pChnl = serverChannel;
+	// Tests rsslBind returns NULL because SO_REUSEPORT option is unsupported
+	pServer = rsslBind(&bindOpts, &err);
 
-	clientReadOpts1.pThreadId = &clientReadThread1;
-	clientReadOpts1.pChnl = clientChannel;
-	clientReadOpts1.readCount = &msgsRead;
-	clientReadOpts1.lock = &readLock;
-	clientReadOpts2.pThreadId = &clientReadThread2;
-	clientReadOpts2.pChnl = clientChannel;
-	clientReadOpts2.readCount = &msgsRead;
-	clientReadOpts2.lock = &readLock;
+	ASSERT_EQ(pServer, (RsslServer*)NULL) << "rsslBind should return NULL when required set unsupported option SO_REUSEPORT";
+	ASSERT_EQ(err.rsslErrorId, RSSL_RET_FAILURE) << "Error ccode should set to General Failure";
+	ASSERT_EQ(err.sysError, 0) << "SysError should be equal to 0";
+}
 
-	RSSL_THREAD_START(&serverWriteThread, nonBlockingWriteThread, (void*)&serverWriteOpts);
-	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+#endif
 
-	RSSL_THREAD_START(&clientReadThread1, nonBlockingReadThread, (void*)&clientReadOpts1);
-	RSSL_THREAD_START(&clientReadThread2, nonBlockingReadThread, (void*)&clientReadOpts1);
 
-	do
-	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+#ifdef RSSL_NOTIFIER_EPOLL
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+#include <unistd.h>
+#include <sys/resource.h>
 
-	shutdownTest = true;
+/* Tests of the epoll backend of the RsslNotifier. Pipes stand in for channel descriptors. */
+class NotifierTests : public ::testing::Test {
+protected:
+	RsslNotifier *pNotifier;
+	RsslNotifierEvent *pEvent;
+	int fds[2];
 
-	RSSL_THREAD_JOIN(serverWriteThread);
-	RSSL_THREAD_JOIN(serverPingThread);
+	virtual void SetUp()
+	{
+		pNotifier = NULL;
+		pEvent = rsslCreateNotifierEvent();
+		ASSERT_NE(pEvent, (RsslNotifierEvent*)NULL);
+		ASSERT_EQ(pipe(fds), 0);
+	}
 
-	rsslCloseChannel(serverChannel, &err);
+	virtual void TearDown()
+	{
+		if (pNotifier != NULL)
+			rsslDestroyNotifier(pNotifier);
+		rsslDestroyNotifierEvent(pEvent);
+		close(fds[0]);
+		close(fds[1]);
+		resetDeadlockTimer();
+	}
 
-	RSSL_THREAD_JOIN(clientReadThread1);
-	RSSL_THREAD_JOIN(clientReadThread2);
+	void createNotifier(RsslNotifierType notifierType)
+	{
+		pNotifier = rsslCreateNotifierEx(2, notifierType);
+		ASSERT_NE(pNotifier, (RsslNotifier*)NULL);
+		ASSERT_EQ(rsslNotifierGetType(pNotifier), notifierType);
+		ASSERT_EQ(rsslNotifierAddEvent(pNotifier, pEvent, fds[0], this), 0);
+		ASSERT_EQ(rsslNotifierEventGetFd(pEvent), fds[0]);
+	}
+};
 
-	rsslCloseChannel(clientChannel, &err);
+TEST_F(NotifierTests, EpollReadNotification)
+{
+	char byte = 'x';
+
+	createNotifier(RSSL_NOTIFIER_TYPE_EPOLL);
+
+	/* Nothing registered yet. */
+	ASSERT_EQ(write(fds[1], &byte, 1), 1);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 0);
+	ASSERT_EQ(pNotifier->notifiedEventCount, 0);
+
+	ASSERT_EQ(rsslNotifierRegisterRead(pNotifier, pEvent), 0);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_EQ(pNotifier->notifiedEventCount, 1);
+	ASSERT_EQ(pNotifier->notifiedEvents[0], pEvent);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvent) != 0);
+	ASSERT_EQ(rsslNotifierEventGetObject(pEvent), (void*)this);
+
+	/* Level-triggered: still readable until the data is consumed. */
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvent) != 0);
+
+	ASSERT_EQ(read(fds[0], &byte, 1), 1);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 0);
+	ASSERT_EQ(pNotifier->notifiedEventCount, 0);
+	ASSERT_FALSE(rsslNotifierEventIsReadable(pEvent) != 0);
+
+	/* Unregistering stops notification. */
+	ASSERT_EQ(write(fds[1], &byte, 1), 1);
+	ASSERT_EQ(rsslNotifierUnregisterRead(pNotifier, pEvent), 0);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 0);
 }
 
-/*  Multiple reader server threads from a single writer client, and with a pinging thread.
-	Once the writer threads have each written their full data, sets the shutdown boolean
-	and waits for the reader threads to finish.*/
-TEST_F(AllLockTests, NonBlockingClientWriterServerTwoReaderPing)
+TEST_F(NotifierTests, EpollWriteNotification)
 {
-	RsslThreadId clientWriteThread, clientPingThread, serverReadThread1, serverReadThread2;
+	RsslNotifierEvent *pWriteEvent = rsslCreateNotifierEvent();
 
+	createNotifier(RSSL_NOTIFIER_TYPE_EPOLL);
+	ASSERT_EQ(rsslNotifierAddEvent(pNotifier, pWriteEvent, fds[1], NULL), 0);
 
-	ReadChannel serverReadOpts1, serverReadOpts2;
-	WriteChannel clientWriteOpts;
-	PingChannel clientPingOpts;
-	int readCount;
+	ASSERT_EQ(rsslNotifierRegisterWrite(pNotifier, pWriteEvent), 0);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_TRUE(rsslNotifierEventIsWritable(pWriteEvent) != 0);
+	ASSERT_FALSE(rsslNotifierEventIsWritable(pEvent) != 0);
 
-	startupServerAndConections(RSSL_FALSE);
+	ASSERT_EQ(rsslNotifierUnregisterWrite(pNotifier, pWriteEvent), 0);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 0);
+	ASSERT_FALSE(rsslNotifierEventIsWritable(pWriteEvent) != 0);
 
-	clientWriteOpts.pThreadId = &clientWriteThread;
-	clientWriteOpts.pChnl = clientChannel;
-	clientPingOpts.pThreadId = &clientPingThread;
-	clientPingOpts.pChnl = clientChannel;
+	ASSERT_EQ(rsslNotifierRemoveEvent(pNotifier, pWriteEvent), 0);
+	rsslDestroyNotifierEvent(pWriteEvent);
+}
 
-	serverReadOpts1.pThreadId = &serverReadThread1;
-	serverReadOpts1.pChnl = serverChannel;
-	serverReadOpts1.readCount = &msgsRead;
-	serverReadOpts1.lock = &readLock;
-	serverReadOpts2.pThreadId = &serverReadThread2;
-	serverReadOpts2.pChnl = serverChannel;
-	serverReadOpts2.readCount = &msgsRead;
-	serverReadOpts2.lock = &readLock;
+TEST_F(NotifierTests, EpollEdgeFlagsPersistUntilCleared)
+{
+	char byte = 'x';
 
-	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
-	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+	createNotifier(RSSL_NOTIFIER_TYPE_EPOLL_EDGE);
+	ASSERT_EQ(rsslNotifierRegisterRead(pNotifier, pEvent), 0);
 
-	RSSL_THREAD_START(&serverReadThread1, nonBlockingReadThread, (void*)&serverReadOpts1);
-	RSSL_THREAD_START(&serverReadThread2, nonBlockingReadThread, (void*)&serverReadOpts2);
+	ASSERT_EQ(write(fds[1], &byte, 1), 1);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvent) != 0);
 
+	/* epoll does not report the edge again, but the event is kept until the application clears it. */
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_EQ(pNotifier->notifiedEvents[0], pEvent);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvent) != 0);
 
-	do
-	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+	rsslNotifierEventClearNotifiedFlags(pEvent);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 0);
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+	/* New data is a new edge. */
+	ASSERT_EQ(write(fds[1], &byte, 1), 1);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_TRUE(rsslNotifierEventIsReadable(pEvent) != 0);
+}
 
-	shutdownTest = true;
+TEST_F(NotifierTests, EpollRemoveAndUpdateEvent)
+{
+	char byte = 'x';
+	int newFds[2];
+	RsslNotifierEvent *pOtherEvent = rsslCreateNotifierEvent();
+
+	createNotifier(RSSL_NOTIFIER_TYPE_EPOLL);
+	ASSERT_EQ(pipe(newFds), 0);
+	ASSERT_EQ(rsslNotifierAddEvent(pNotifier, pOtherEvent, newFds[0], NULL), 0);
+	ASSERT_EQ(rsslNotifierRegisterRead(pNotifier, pEvent), 0);
+	ASSERT_EQ(rsslNotifierRegisterRead(pNotifier, pOtherEvent), 0);
+
+	ASSERT_EQ(write(fds[1], &byte, 1), 1);
+	ASSERT_EQ(write(newFds[1], &byte, 1), 1);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 2);
+
+	/* A removed event is no longer reported, even if it was notified before. */
+	ASSERT_EQ(rsslNotifierRemoveEvent(pNotifier, pOtherEvent), 0);
+	ASSERT_EQ(pNotifier->notifiedEventCount, 1);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_EQ(pNotifier->notifiedEvents[0], pEvent);
+
+	/* Move the remaining event to the other pipe. Updating clears its registration. */
+	ASSERT_EQ(rsslNotifierUpdateEventFd(pNotifier, pEvent, newFds[0]), 0);
+	ASSERT_EQ(rsslNotifierEventGetFd(pEvent), newFds[0]);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 0);
+	ASSERT_EQ(rsslNotifierRegisterRead(pNotifier, pEvent), 0);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_EQ(pNotifier->notifiedEvents[0], pEvent);
+
+	ASSERT_EQ(rsslNotifierUpdateEventFd(pNotifier, pOtherEvent, fds[0]), -1) << "Event is not in the notifier.";
+
+	rsslDestroyNotifierEvent(pOtherEvent);
+	close(newFds[0]);
+	close(newFds[1]);
+}
 
-	RSSL_THREAD_JOIN(clientWriteThread);
-	RSSL_THREAD_JOIN(clientPingThread);
+TEST_F(NotifierTests, EpollBadFd)
+{
+	int badFds[2];
+	RsslNotifierEvent *pBadEvent = rsslCreateNotifierEvent();
 
-	rsslCloseChannel(clientChannel, &err);
+	createNotifier(RSSL_NOTIFIER_TYPE_EPOLL);
+	ASSERT_EQ(pipe(badFds), 0);
+	close(badFds[0]);
+	close(badFds[1]);
 
-	RSSL_THREAD_JOIN(serverReadThread1);
-	RSSL_THREAD_JOIN(serverReadThread2);
+	/* Like poll, an invalid descriptor is reported on the event rather than failing the registration. */
+	ASSERT_EQ(rsslNotifierAddEvent(pNotifier, pBadEvent, badFds[0], NULL), 0);
+	ASSERT_EQ(rsslNotifierRegisterRead(pNotifier, pBadEvent), 0);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 1);
+	ASSERT_TRUE(rsslNotifierEventIsFdBad(pBadEvent) != 0);
 
-	rsslCloseChannel(serverChannel, &err);
+	ASSERT_EQ(rsslNotifierUpdateEventFd(pNotifier, pBadEvent, fds[0]), 0);
+	ASSERT_EQ(rsslNotifierWait(pNotifier, 0), 0);
 
+	ASSERT_EQ(rsslNotifierRemoveEvent(pNotifier, pBadEvent), 0);
+	rsslDestroyNotifierEvent(pBadEvent);
 }
 
-/*	Test kicks off one writer and one reader thread for the client and server. Also
-	starts a thread for pinging both the client and server connections.  Once
-	the writer threads have each written their full data, sets the shutdown boolean and
-	waits for the reader threads to finish. */
-TEST_F(AllLockTests, BlockingClientTwoWriterServerTwoReader)
+/* Measures the cost of a wakeup as the number of associated descriptors grows, with one descriptor ready. 
+ * Not run by default; use --gtest_also_run_disabled_tests --gtest_filter=NotifierTests.DISABLED_* */
+TEST_F(NotifierTests, DISABLED_WakeupCostByEventCount)
 {
-	RsslThreadId serverReadThread1, serverReadThread2, clientWriteThread1, clientWriteThread2;
-
-	ReadChannel serverReadOpts1, serverReadOpts2;
-	WriteChannel clientWriteOpts1, clientWriteOpts2;
-	int readCount;
-
-	startupServerAndConections(RSSL_TRUE);
-
-	serverReadOpts1.pThreadId = &serverReadThread1;
-	serverReadOpts1.pChnl = serverChannel;
-	serverReadOpts1.readCount = &msgsRead;
-	serverReadOpts1.lock = &readLock;
-	serverReadOpts2.pThreadId = &serverReadThread2;
-	serverReadOpts2.pChnl = serverChannel;
-	serverReadOpts2.readCount = &msgsRead;
-	serverReadOpts2.lock = &readLock;
-
-	clientWriteOpts1.pThreadId = &clientWriteThread1;
-	clientWriteOpts1.pChnl = clientChannel;
-	clientWriteOpts2.pThreadId = &clientWriteThread2;
-	clientWriteOpts2.pChnl = clientChannel;
+	const int eventCounts[] = { 16, 128, 1024, 4096, 16384 };
+	const int waitCount = 20000;
+	RsslNotifierType notifierTypes[] = { RSSL_NOTIFIER_TYPE_DEFAULT, RSSL_NOTIFIER_TYPE_EPOLL };
+	const char *notifierNames[] = { "poll", "epoll" };
+	struct rlimit fileLimit;
+	char byte = 'x';
 
-	RSSL_THREAD_START(&serverReadThread1, blockingReadThread, (void*)&serverReadOpts1);
-	RSSL_THREAD_START(&serverReadThread2, blockingReadThread, (void*)&serverReadOpts2);
+	/* Each event uses a pipe. */
+	getrlimit(RLIMIT_NOFILE, &fileLimit);
+	fileLimit.rlim_cur = fileLimit.rlim_max;
+	setrlimit(RLIMIT_NOFILE, &fileLimit);
 
-	RSSL_THREAD_START(&clientWriteThread1, blockingWriteThread, (void*)&clientWriteOpts1);
-	RSSL_THREAD_START(&clientWriteThread2, blockingWriteThread, (void*)&clientWriteOpts2);
+	std::cout << "  Events   Notifier   Usec/Wait" << std::endl;
 
-	do
+	for (unsigned int i = 0; i < sizeof(eventCounts) / sizeof(int); ++i)
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+		int eventCount = eventCounts[i];
+		int (*pipes)[2];
+		RsslNotifierEvent **events;
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+		if ((rlim_t)(eventCount * 2 + 64) > fileLimit.rlim_cur)
+		{
+			std::cout << "  " << eventCount << " events exceed the descriptor limit; skipped." << std::endl;
+			continue;
+		}
 
-	shutdownTest = true;
+		pipes = new int[eventCount][2];
+		events = new RsslNotifierEvent*[eventCount];
 
-	RSSL_THREAD_JOIN(clientWriteThread1);
-	RSSL_THREAD_JOIN(clientWriteThread2);
+		for (int j = 0; j < eventCount; ++j)
+		{
+			ASSERT_EQ(pipe(pipes[j]), 0);
+			events[j] = rsslCreateNotifierEvent();
+		}
 
-	rsslCloseChannel(clientChannel, &err);
-	
-	RSSL_THREAD_JOIN(serverReadThread1);
-	RSSL_THREAD_JOIN(serverReadThread2);
+		/* Only the first descriptor is ready. */
+		ASSERT_EQ(write(pipes[0][1], &byte, 1), 1);
 
-	rsslCloseChannel(serverChannel, &err);
-}
+		for (unsigned int t = 0; t < sizeof(notifierTypes) / sizeof(RsslNotifierType); ++t)
+		{
+			RsslNotifier *pBenchNotifier = rsslCreateNotifierEx(1024, notifierTypes[t]);
+			RsslUInt64 startTime, endTime;
 
-/*	Test kicks off two writer threads on the client and two reader threads on the server. Once
-	the writer threads have each written their full data, sets the shutdown boolean and
-	waits for the reader threads to finish. */
-TEST_F(AllLockTests, BlockingClientTwoReaderServerTwoWriter)
-{
-	RsslThreadId serverWriteThread1, serverWriteThread2, clientReadThread1, clientReadThread2;
+			for (int j = 0; j < eventCount; ++j)
+			{
+				ASSERT_EQ(rsslNotifierAddEvent(pBenchNotifier, events[j], pipes[j][0], NULL), 0);
+				ASSERT_EQ(rsslNotifierRegisterRead(pBenchNotifier, events[j]), 0);
+			}
 
-	ReadChannel clientReadOpts1, clientReadOpts2;
-	WriteChannel serverWriteOpts1, serverWriteOpts2;
-	int readCount;
+			startTime = rsslGetTimeMicro();
+			for (int w = 0; w < waitCount; ++w)
+				ASSERT_EQ(rsslNotifierWait(pBenchNotifier, 0), 1);
+			endTime = rsslGetTimeMicro();
 
-	startupServerAndConections(RSSL_TRUE);
+			printf("  %6d   %8s   %9.3f\n", eventCount, notifierNames[t], (double)(endTime - startTime) / waitCount);
 
-	serverWriteOpts1.pThreadId = &serverWriteThread1;
-	serverWriteOpts1.pChnl = serverChannel;
-	serverWriteOpts2.pThreadId = &serverWriteThread2;
-	serverWriteOpts2.pChnl = serverChannel;
+			for (int j = 0; j < eventCount; ++j)
+				ASSERT_EQ(rsslNotifierRemoveEvent(pBenchNotifier, events[j]), 0);
+			rsslDestroyNotifier(pBenchNotifier);
+			resetDeadlockTimer();
+		}
 
-	clientReadOpts1.pThreadId = &clientReadThread1;
-	clientReadOpts1.pChnl = clientChannel;
-	clientReadOpts1.readCount = &msgsRead;
-	clientReadOpts1.lock = &readLock;
-	clientReadOpts2.pThreadId = &clientReadThread2;
-	clientReadOpts2.pChnl = clientChannel;
-	clientReadOpts2.readCount = &msgsRead;
-	clientReadOpts2.lock = &readLock;
+		for (int j = 0; j < eventCount; ++j)
+		{
+			close(pipes[j][0]);
+			close(pipes[j][1]);
+			rsslDestroyNotifierEvent(events[j]);
+		}
+		delete[] pipes;
+		delete[] events;
+	}
+}
 
-	RSSL_THREAD_START(&serverWriteThread1, blockingWriteThread, (void*)&serverWriteOpts1);
-	RSSL_THREAD_START(&serverWriteThread2, blockingWriteThread, (void*)&serverWriteOpts2);
+#endif
 
-	RSSL_THREAD_START(&clientReadThread1, blockingReadThread, (void*)&clientReadOpts1);
-	RSSL_THREAD_START(&clientReadThread2, blockingReadThread, (void*)&clientReadOpts2);
+/* Tests of the WebSocket payload masking kernels against a byte at a time reference. */
+class WebSocketMaskTests : public ::testing::Test {
+protected:
+	rwsMaskKernel_t defaultKernel;
 
-	do
+	virtual void SetUp()
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
-
-	shutdownTest = true;
-	
-	RSSL_THREAD_JOIN(serverWriteThread1);
-	RSSL_THREAD_JOIN(serverWriteThread2);
+		defaultKernel = rwsGetMaskKernel();
+	}
 
-	rsslCloseChannel(serverChannel, &err);
-	
-	RSSL_THREAD_JOIN(clientReadThread1);
-	RSSL_THREAD_JOIN(clientReadThread2);
+	virtual void TearDown()
+	{
+		ASSERT_EQ(rwsSetMaskKernel(defaultKernel), RSSL_RET_SUCCESS);
+	}
 
-	rsslCloseChannel(clientChannel, &err);
-}
+	static void maskReference(char *mask, char *buf, RsslUInt64 length)
+	{
+		for (RsslUInt64 i = 0; i < length; i++)
+			buf[i] ^= mask[i % 4];
+	}
+};
 
-/*  Test runs two writer threads on the server, and two reader threads on the client, and
-	a pinging thread on the server channel. Once the writer threads have each written their
-	full data, sets the shutdown boolean and waits for the reader threads to finish.*/
-TEST_F(AllLockTests, BlockingClientTwoWriterServerTwoReaderPing)
+TEST_F(WebSocketMaskTests, KernelsMatchReference)
 {
-	RsslThreadId serverReadThread1, serverReadThread2, clientWriteThread1, clientWriteThread2, clientPingThread;
-	ReadChannel serverReadOpts1, serverReadOpts2;
-	WriteChannel clientWriteOpts1, clientWriteOpts2;
-	PingChannel clientPingOpts;
-	int readCount;
+	rwsMaskKernel_t kernels[] = { RWS_MASK_KERNEL_SCALAR, RWS_MASK_KERNEL_SSE2, RWS_MASK_KERNEL_AVX2 };
+	char mask[4] = { (char)0x37, (char)0xfa, (char)0x21, (char)0x3d };
+	char source[300 + 3], expected[300 + 3], masked[300 + 3];
 
-	startupServerAndConections(RSSL_TRUE);
+	for (unsigned int i = 0; i < sizeof(source); i++)
+		source[i] = (char)(i * 7 + 1);
 
-	serverReadOpts1.pThreadId = &serverReadThread1;
-	serverReadOpts1.pChnl = serverChannel;
-	serverReadOpts1.readCount = &msgsRead;
-	serverReadOpts1.lock = &readLock;
-	serverReadOpts2.pThreadId = &serverReadThread2;
-	serverReadOpts2.pChnl = serverChannel;
-	serverReadOpts2.readCount = &msgsRead;
-	serverReadOpts2.lock = &readLock;
+	ASSERT_EQ(rwsSetMaskKernel(RWS_MASK_KERNEL_SCALAR), RSSL_RET_SUCCESS);
 
-	clientWriteOpts1.pThreadId = &clientWriteThread1;
-	clientWriteOpts1.pChnl = clientChannel;
-	clientWriteOpts2.pThreadId = &clientWriteThread2;
-	clientWriteOpts2.pChnl = clientChannel;
-	clientPingOpts.pThreadId = &clientPingThread;
-	clientPingOpts.pChnl = clientChannel;
+	for (unsigned int k = 0; k < sizeof(kernels) / sizeof(rwsMaskKernel_t); ++k)
+	{
+		if (rwsSetMaskKernel(kernels[k]) != RSSL_RET_SUCCESS)
+			continue;
+		ASSERT_EQ(rwsGetMaskKernel(), kernels[k]);
 
-	RSSL_THREAD_START(&serverReadThread1, blockingReadThread, (void*)&serverReadOpts1);
-	RSSL_THREAD_START(&serverReadThread2, blockingReadThread, (void*)&serverReadOpts2);
+		/* Every length around the lane sizes, from unaligned starting addresses. */
+		for (unsigned int offset = 0; offset < 4; ++offset)
+		{
+			for (RsslUInt64 length = 0; length <= 300; ++length)
+			{
+				memcpy(expected, source, sizeof(source));
+				memcpy(masked, source, sizeof(source));
 
-	RSSL_THREAD_START(&clientWriteThread1, blockingWriteThread, (void*)&clientWriteOpts1);
-	RSSL_THREAD_START(&clientWriteThread2, blockingWriteThread, (void*)&clientWriteOpts2);
-	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+				maskReference(mask, expected + offset, length);
+				rwsMaskDataBlock(mask, masked + offset, length);
+				ASSERT_EQ(memcmp(expected, masked, sizeof(source)), 0) << "kernel " << kernels[k] << " offset " << offset << " length " << length;
 
-	do
-	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+				/* Masking again restores the payload. */
+				rwsMaskDataBlock(mask, masked + offset, length);
+				ASSERT_EQ(memcmp(source, masked, sizeof(source)), 0);
+			}
+		}
+	}
+}
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+TEST_F(WebSocketMaskTests, UnsupportedKernel)
+{
+	ASSERT_EQ(rwsSetMaskKernel((rwsMaskKernel_t)99), RSSL_RET_FAILURE);
+	ASSERT_EQ(rwsGetMaskKernel(), defaultKernel);
+}
 
-	shutdownTest = true;
+/* Measures the masking throughput of each kernel over several payload sizes.
+ * Not run by default; use --gtest_also_run_disabled_tests --gtest_filter=WebSocketMaskTests.DISABLED_* */
+TEST_F(WebSocketMaskTests, DISABLED_Throughput)
+{
+	rwsMaskKernel_t kernels[] = { RWS_MASK_KERNEL_SCALAR, RWS_MASK_KERNEL_SSE2, RWS_MASK_KERNEL_AVX2 };
+	const char *kernelNames[] = { "scalar", "sse2", "avx2" };
+	const RsslUInt64 payloadSizes[] = { 64, 256, 1500, 6144, 65536 };
+	const RsslUInt64 totalBytes = 1024 * 1024 * 1024;
+	char mask[4] = { (char)0x37, (char)0xfa, (char)0x21, (char)0x3d };
+	char *buf = new char[65536 + 1];
 
-	RSSL_THREAD_JOIN(clientWriteThread1);
-	RSSL_THREAD_JOIN(clientWriteThread2);
-	RSSL_THREAD_JOIN(clientPingThread);
+	memset(buf, 'x', 65536 + 1);
 
-	rsslCloseChannel(clientChannel, &err);
+	printf("  payload   kernel       MB/s\n");
+	for (unsigned int p = 0; p < sizeof(payloadSizes) / sizeof(RsslUInt64); ++p)
+	{
+		for (unsigned int k = 0; k < sizeof(kernels) / sizeof(rwsMaskKernel_t); ++k)
+		{
+			RsslUInt64 startTime, endTime, count = totalBytes / payloadSizes[p];
 
-	RSSL_THREAD_JOIN(serverReadThread1);
-	RSSL_THREAD_JOIN(serverReadThread2);
+			if (rwsSetMaskKernel(kernels[k]) != RSSL_RET_SUCCESS)
+				continue;
 
-	rsslCloseChannel(serverChannel, &err);
+			/* Offset by one byte, as payloads follow a header of 2 to 14 bytes. */
+			startTime = rsslGetTimeMicro();
+			for (RsslUInt64 i = 0; i < count; ++i)
+				rwsMaskDataBlock(mask, buf + 1, payloadSizes[p]);
+			endTime = rsslGetTimeMicro();
 
+			printf("  %7llu   %6s   %8.1f\n", (unsigned long long)payloadSizes[p], kernelNames[k],
+				(double)(count * payloadSizes[p]) / (double)(endTime - startTime + 1));
+			resetDeadlockTimer();
+		}
+	}
+
+	delete[] buf;
 }
 
-/*  Test runs two reader threads on the server, and two writer threads on the client, and a pinging thread
-	on the client channel. Once the writer threads have each written their full data, sets
-	the shutdown boolean and waits for the reader threads to finish.*/
-TEST_F(AllLockTests, BlockingClientTwoReaderServerTwoWriterPing)
-{
-	RsslThreadId serverWriteThread1, serverWriteThread2, serverPingThread, clientReadThread1, clientReadThread2;
+/* Tests of the open-addressing hash table. */
+class OpenHashTableTests : public ::testing::Test {
+protected:
+	struct Item
+	{
+		RsslHashLink	link;
+		RsslBuffer		name;
+		char			nameData[16];
+	};
 
-	ReadChannel clientReadOpts1, clientReadOpts2;
-	WriteChannel serverWriteOpts1, serverWriteOpts2;
-	PingChannel serverPingOpts;
-	int readCount;
+	static void setItemName(Item *pItem, unsigned int i)
+	{
+		/* RIC-like names, e.g. "A1234.L", so keys only differ in a few characters. */
+		pItem->name.length = (RsslUInt32)snprintf(pItem->nameData, sizeof(pItem->nameData), "%c%u.%c",
+				'A' + (i % 26), i, "LNOTK"[i % 5]);
+		pItem->name.data = pItem->nameData;
+	}
 
-	startupServerAndConections(RSSL_TRUE);
+	static RsslUInt32 intHashSum(void *pKey)
+	{
+		return *(RsslUInt32*)pKey;
+	}
 
-	serverWriteOpts1.pThreadId = &serverWriteThread1;
-	serverWriteOpts1.pChnl = serverChannel;
-	serverWriteOpts2.pThreadId = &serverWriteThread2;
-	serverWriteOpts2.pChnl = serverChannel;
-	serverPingOpts.pThreadId = &serverPingThread;
-	serverPingOpts.pChnl = serverChannel;
+	static RsslBool intHashCompare(void *pKey1, void *pKey2)
+	{
+		return *(RsslUInt32*)pKey1 == *(RsslUInt32*)pKey2;
+	}
+};
 
-	clientReadOpts1.pThreadId = &clientReadThread1;
-	clientReadOpts1.pChnl = clientChannel;
-	clientReadOpts1.readCount = &msgsRead;
-	clientReadOpts1.lock = &readLock;
-	clientReadOpts2.pThreadId = &clientReadThread2;
-	clientReadOpts2.pChnl = clientChannel;
-	clientReadOpts2.readCount = &msgsRead;
-	clientReadOpts2.lock = &readLock;
+TEST_F(OpenHashTableTests, InsertFindRemove)
+{
+	const unsigned int itemCount = 5000;
+	Item *items = new Item[itemCount];
+	RsslOpenHashTable table;
+	RsslErrorInfo errorInfo;
+	RsslBuffer missing = { 5, (char*)"NONE." };
 
-	RSSL_THREAD_START(&serverWriteThread1, blockingWriteThread, (void*)&serverWriteOpts1);
-	RSSL_THREAD_START(&serverWriteThread2, blockingWriteThread, (void*)&serverWriteOpts2);
-	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+	/* Start small so the table grows several times. */
+	ASSERT_EQ(rsslOpenHashTableInit(&table, 10, rsslHashBufferSum, rsslHashBufferCompare, RSSL_TRUE, &errorInfo), RSSL_RET_SUCCESS);
 
-	RSSL_THREAD_START(&clientReadThread1, blockingReadThread, (void*)&clientReadOpts1);
-	RSSL_THREAD_START(&clientReadThread2, blockingReadThread, (void*)&clientReadOpts2);
+	for (unsigned int i = 0; i < itemCount; ++i)
+	{
+		setItemName(&items[i], i);
+		ASSERT_EQ(rsslOpenHashTableInsertLink(&table, &items[i].link, &items[i].name, NULL), RSSL_RET_SUCCESS);
+	}
+	ASSERT_EQ(table.elementCount, itemCount);
+	ASSERT_GE(table.slotCount, itemCount);
 
-	do
+	for (unsigned int i = 0; i < itemCount; ++i)
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < (MAX_MSG_WRITE_COUNT * 2) && !failTest);
+		RsslBuffer name = items[i].name;
+		ASSERT_EQ(rsslOpenHashTableFind(&table, &name, NULL), &items[i].link);
+	}
+	ASSERT_EQ(rsslOpenHashTableFind(&table, &missing, NULL), (RsslHashLink*)NULL);
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+	/* Remove every other item; the rest must still be found. */
+	for (unsigned int i = 0; i < itemCount; i += 2)
+		rsslOpenHashTableRemoveLink(&table, &items[i].link);
+	ASSERT_EQ(table.elementCount, itemCount / 2);
 
-	shutdownTest = true;
+	for (unsigned int i = 0; i < itemCount; ++i)
+		ASSERT_EQ(rsslOpenHashTableFind(&table, &items[i].name, NULL), (i % 2) ? &items[i].link : (RsslHashLink*)NULL);
 
-	rsslCloseChannel(serverChannel, &err);
+	/* Removing a link that is no longer in the table does nothing. */
+	rsslOpenHashTableRemoveLink(&table, &items[0].link);
+	ASSERT_EQ(table.elementCount, itemCount / 2);
 
-	RSSL_THREAD_JOIN(serverWriteThread1);
-	RSSL_THREAD_JOIN(serverWriteThread2);
-	RSSL_THREAD_JOIN(serverPingThread);
-	RSSL_THREAD_JOIN(clientReadThread1);
-	RSSL_THREAD_JOIN(clientReadThread2);
+	/* Reinsert using a precomputed sum. */
+	for (unsigned int i = 0; i < itemCount; i += 2)
+	{
+		RsslUInt32 sum = rsslHashBufferSum(&items[i].name);
+		ASSERT_EQ(rsslOpenHashTableInsertLink(&table, &items[i].link, &items[i].name, &sum), RSSL_RET_SUCCESS);
+	}
+	for (unsigned int i = 0; i < itemCount; ++i)
+		ASSERT_EQ(rsslOpenHashTableFind(&table, &items[i].name, NULL), &items[i].link);
 
-	rsslCloseChannel(clientChannel, &err);
+	rsslOpenHashTableCleanup(&table);
+	delete[] items;
 }
 
-/*  Multiple reader client threads from a single writer server. Once the writer threads
-	have each written their full data, sets the shutdown boolean and waits for the
-	reader threads to finish.*/
-TEST_F(AllLockTests, BlockingClientTwoReaderServerWriter)
+TEST_F(OpenHashTableTests, DuplicateKeysAndCollidingSums)
 {
-	RsslThreadId serverWriteThread, clientReadThread1, clientReadThread2;
-
-	ReadChannel clientReadOpts1, clientReadOpts2;
-	WriteChannel serverWriteOpts;
-	int readCount;
+	RsslOpenHashTable table;
+	RsslErrorInfo errorInfo;
+	RsslHashLink links[64];
+	RsslUInt32 keys[64];
+	RsslUInt32 sum = 7;
 
-	startupServerAndConections(RSSL_TRUE);
+	ASSERT_EQ(rsslOpenHashTableInit(&table, 8, intHashSum, intHashCompare, RSSL_FALSE, &errorInfo), RSSL_RET_SUCCESS);
 
-	serverWriteOpts.pThreadId = &serverWriteThread;
-	serverWriteOpts.pChnl = serverChannel;
+	/* Every link has the same sum, so all of them share one probe run. */
+	for (RsslUInt32 i = 0; i < 64; ++i)
+	{
+		keys[i] = i;
+		ASSERT_EQ(rsslOpenHashTableInsertLink(&table, &links[i], &keys[i], &sum), RSSL_RET_SUCCESS);
+	}
 
-	clientReadOpts1.pThreadId = &clientReadThread1;
-	clientReadOpts1.pChnl = clientChannel;
-	clientReadOpts1.readCount = &msgsRead;
-	clientReadOpts1.lock = &readLock;
-	clientReadOpts2.pThreadId = &clientReadThread2;
-	clientReadOpts2.pChnl = clientChannel;
-	clientReadOpts2.readCount = &msgsRead;
-	clientReadOpts2.lock = &readLock;
+	for (RsslUInt32 i = 0; i < 64; ++i)
+		ASSERT_EQ(rsslOpenHashTableFind(&table, &keys[i], &sum), &links[i]);
 
-	RSSL_THREAD_START(&serverWriteThread, blockingWriteThread, (void*)&serverWriteOpts);
+	for (RsslUInt32 i = 0; i < 64; i += 3)
+		rsslOpenHashTableRemoveLink(&table, &links[i]);
 
-	RSSL_THREAD_START(&clientReadThread1, blockingReadThread, (void*)&clientReadOpts1);
-	RSSL_THREAD_START(&clientReadThread2, blockingReadThread, (void*)&clientReadOpts1);
+	for (RsslUInt32 i = 0; i < 64; ++i)
+		ASSERT_EQ(rsslOpenHashTableFind(&table, &keys[i], &sum), (i % 3) ? &links[i] : (RsslHashLink*)NULL);
 
-	do
-	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
+	rsslOpenHashTableCleanup(&table);
 
-	shutdownTest = true;
+	/* As with the RsslHashTable, a duplicate key may be inserted; either link may be found for it. */
+	ASSERT_EQ(rsslOpenHashTableInit(&table, 8, intHashSum, intHashCompare, RSSL_FALSE, &errorInfo), RSSL_RET_SUCCESS);
+	keys[0] = keys[1] = 42;
+	ASSERT_EQ(rsslOpenHashTableInsertLink(&table, &links[0], &keys[0], NULL), RSSL_RET_SUCCESS);
+	ASSERT_EQ(rsslOpenHashTableInsertLink(&table, &links[1], &keys[1], NULL), RSSL_RET_SUCCESS);
+	rsslOpenHashTableRemoveLink(&table, &links[0]);
+	ASSERT_EQ(rsslOpenHashTableFind(&table, &keys[0], NULL), &links[1]);
+	rsslOpenHashTableRemoveLink(&table, &links[1]);
+	ASSERT_EQ(rsslOpenHashTableFind(&table, &keys[0], NULL), (RsslHashLink*)NULL);
+	ASSERT_EQ(table.elementCount, 0u);
+	rsslOpenHashTableCleanup(&table);
+}
 
-	RSSL_THREAD_JOIN(serverWriteThread);
+#if defined(__linux__)
+/* Counts hardware cache misses of the calling thread, if the kernel allows it. */
+static int openCacheMissCounter()
+{
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CACHE_MISSES;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
 
-	rsslCloseChannel(serverChannel, &err);
+static void startCacheMissCounter(int fd)
+{
+	if (fd < 0) return;
+	ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+	ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+}
 
-	RSSL_THREAD_JOIN(clientReadThread1);
-	RSSL_THREAD_JOIN(clientReadThread2);
+static long long stopCacheMissCounter(int fd)
+{
+	long long count;
 
-	rsslCloseChannel(clientChannel, &err);
+	if (fd < 0) return -1;
+	ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+	if (read(fd, &count, sizeof(count)) != sizeof(count))
+		return -1;
+	return count;
 }
+#else
+static int openCacheMissCounter() { return -1; }
+static void startCacheMissCounter(int fd) { }
+static long long stopCacheMissCounter(int fd) { return -1; }
+#endif
 
-/*  Multiple reader server threads from a single writer client. Once the writer threads
-	have each written their full data, sets the shutdown boolean and waits for the
-	reader threads to finish.*/
-TEST_F(AllLockTests, BlockingClientWriterServerTwoReader)
+/* Compares lookups of one million symbol names in the RsslHashTable and the RsslOpenHashTable.
+ * Not run by default; use --gtest_also_run_disabled_tests --gtest_filter=OpenHashTableTests.DISABLED_* */
+TEST_F(OpenHashTableTests, DISABLED_SymbolLookupRate)
 {
-	RsslThreadId clientWriteThread, serverReadThread1, serverReadThread2;
+	const unsigned int itemCount = 1000000, lookupCount = 10000000;
+	Item *items = new Item[itemCount];
+	Item *openItems = new Item[itemCount];
+	unsigned int *order = new unsigned int[lookupCount];
+	RsslHashTable chainedTable;
+	RsslOpenHashTable openTable;
+	RsslErrorInfo errorInfo;
+	RsslUInt64 startTime, endTime;
+	long long misses;
+	unsigned int found, i;
+	int missCounter = openCacheMissCounter();
+
+	for (i = 0; i < itemCount; ++i)
+	{
+		setItemName(&items[i], i);
+		setItemName(&openItems[i], i);
+	}
 
-	ReadChannel serverReadOpts1, serverReadOpts2;
-	WriteChannel clientWriteOpts;
-	int readCount;
+	/* Look up names in a random order, so each lookup is likely to miss the cache. */
+	srand(1);
+	for (i = 0; i < lookupCount; ++i)
+		order[i] = (unsigned int)(((unsigned long long)rand() * (RAND_MAX + 1ULL) + rand()) % itemCount);
+
+	ASSERT_EQ(rsslHashTableInit(&chainedTable, itemCount, rsslHashBufferSum, rsslHashBufferCompare, RSSL_TRUE, &errorInfo), RSSL_RET_SUCCESS);
+	ASSERT_EQ(rsslOpenHashTableInit(&openTable, itemCount, rsslHashBufferSum, rsslHashBufferCompare, RSSL_TRUE, &errorInfo), RSSL_RET_SUCCESS);
+
+	for (i = 0; i < itemCount; ++i)
+	{
+		rsslHashTableInsertLink(&chainedTable, &items[i].link, &items[i].name, NULL);
+		ASSERT_EQ(rsslOpenHashTableInsertLink(&openTable, &openItems[i].link, &openItems[i].name, NULL), RSSL_RET_SUCCESS);
+	}
+
+	printf("  table      lookups/sec   cache misses/lookup\n");
+
+	found = 0;
+	startCacheMissCounter(missCounter);
+	startTime = rsslGetTimeMicro();
+	for (i = 0; i < lookupCount; ++i)
+		found += (rsslHashTableFind(&chainedTable, &items[order[i]].name, NULL) != NULL);
+	endTime = rsslGetTimeMicro();
+	misses = stopCacheMissCounter(missCounter);
+	ASSERT_EQ(found, lookupCount);
+	printf("  chained   %12.0f   ", (double)lookupCount * 1000000.0 / (double)(endTime - startTime + 1));
+	if (misses >= 0) printf("%.2f\n", (double)misses / lookupCount); else printf("n/a\n");
+	resetDeadlockTimer();
+
+	found = 0;
+	startCacheMissCounter(missCounter);
+	startTime = rsslGetTimeMicro();
+	for (i = 0; i < lookupCount; ++i)
+		found += (rsslOpenHashTableFind(&openTable, &openItems[order[i]].name, NULL) != NULL);
+	endTime = rsslGetTimeMicro();
+	misses = stopCacheMissCounter(missCounter);
+	ASSERT_EQ(found, lookupCount);
+	printf("  open      %12.0f   ", (double)lookupCount * 1000000.0 / (double)(endTime - startTime + 1));
+	if (misses >= 0) printf("%.2f\n", (double)misses / lookupCount); else printf("n/a\n");
+	resetDeadlockTimer();
 
-	startupServerAndConections(RSSL_TRUE);
+#if defined(__linux__)
+	if (missCounter >= 0)
+		close(missCounter);
+#endif
+	rsslHashTableCleanup(&chainedTable);
+	rsslOpenHashTableCleanup(&openTable);
+	delete[] order;
+	delete[] openItems;
+	delete[] items;
+}
 
-	clientWriteOpts.pThreadId = &clientWriteThread;
-	clientWriteOpts.pChnl = clientChannel;
 
-	serverReadOpts1.pThreadId = &serverReadThread1;
-	serverReadOpts1.pChnl = serverChannel;
-	serverReadOpts1.readCount = &msgsRead;
-	serverReadOpts1.lock = &readLock;
-	serverReadOpts2.pThreadId = &serverReadThread2;
-	serverReadOpts2.pChnl = serverChannel;
-	serverReadOpts2.readCount = &msgsRead;
-	serverReadOpts2.lock = &readLock;
+/* Tests of the shared memory transport with one buffer per message and with the variable-length ring. */
+class ShmemRingTests : public ::testing::Test {
+protected:
+	RsslServer *pServer;
+	RsslChannel *pServerChannel;
+	RsslChannel *pClientChannel;
 
-	RSSL_THREAD_START(&clientWriteThread, blockingWriteThread, (void*)&clientWriteOpts);
+	virtual void SetUp()
+	{
+		RsslError err;
 
-	RSSL_THREAD_START(&serverReadThread1, blockingReadThread, (void*)&serverReadOpts1);
-	RSSL_THREAD_START(&serverReadThread2, blockingReadThread, (void*)&serverReadOpts2);
+		pServer = NULL;
+		pServerChannel = NULL;
+		pClientChannel = NULL;
+		rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+	}
 
-	do
+	virtual void TearDown()
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
-	
-	shutdownTest = true;
+		RsslError err;
 
-	RSSL_THREAD_JOIN(clientWriteThread);
+		if (pClientChannel != NULL)
+			rsslCloseChannel(pClientChannel, &err);
+		if (pServerChannel != NULL)
+			rsslCloseChannel(pServerChannel, &err);
+		if (pServer != NULL)
+			rsslCloseServer(pServer, &err);
+		rsslUninitialize();
+		resetDeadlockTimer();
+	}
 
-	rsslCloseChannel(clientChannel, &err);
+	void connect(RsslBool variableLengthRing, RsslUInt32 numBuffers, RsslUInt32 maxFragmentSize, RsslBool blocking = RSSL_FALSE, RsslBool futexWakeup = RSSL_FALSE)
+	{
+		RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+		RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+		RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+		RsslInProgInfo inProg;
+		RsslError err;
 
-	RSSL_THREAD_JOIN(serverReadThread1);
-	RSSL_THREAD_JOIN(serverReadThread2);
+		bindOpts.serviceName = (char*)"shmemRingTest";
+		bindOpts.connectionType = RSSL_CONN_TYPE_UNIDIR_SHMEM;
+		bindOpts.protocolType = TEST_PROTOCOL_TYPE;
+		bindOpts.maxOutputBuffers = bindOpts.guaranteedOutputBuffers = numBuffers;
+		bindOpts.maxFragmentSize = maxFragmentSize;
+		bindOpts.shmemOpts.variableLengthRing = variableLengthRing;
+		bindOpts.shmemOpts.futexWakeup = futexWakeup;
 
-	rsslCloseChannel(serverChannel, &err);
-}
+		pServer = rsslBind(&bindOpts, &err);
+		ASSERT_NE(pServer, (RsslServer*)NULL) << "rsslBind failed. Error text: " << err.text;
 
-/*  Multiple reader client threads from a single writer server, and with a pinging thread.
-	Once the writer threads have each written their full data, sets the shutdown boolean
-	and waits for the reader threads to finish.*/
-TEST_F(AllLockTests, BlockingClientTwoReaderServerWriterPing)
-{
-	RsslThreadId serverWriteThread, serverPingThread, clientReadThread1, clientReadThread2;
+		pServerChannel = rsslAccept(pServer, &acceptOpts, &err);
+		ASSERT_NE(pServerChannel, (RsslChannel*)NULL) << "rsslAccept failed. Error text: " << err.text;
+		ASSERT_EQ(rsslInitChannel(pServerChannel, &inProg, &err), RSSL_RET_SUCCESS);
+		ASSERT_EQ(pServerChannel->state, RSSL_CH_STATE_ACTIVE);
 
-	ReadChannel clientReadOpts1, clientReadOpts2;
-	WriteChannel serverWriteOpts;
-	PingChannel serverPingOpts;
-	int readCount;
+		connectOpts.connectionType = RSSL_CONN_TYPE_UNIDIR_SHMEM;
+		connectOpts.connectionInfo.unified.serviceName = (char*)"shmemRingTest";
+		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
+		connectOpts.blocking = blocking;
 
-	startupServerAndConections(RSSL_TRUE);
+		pClientChannel = rsslConnect(&connectOpts, &err);
+		ASSERT_NE(pClientChannel, (RsslChannel*)NULL) << "rsslConnect failed. Error text: " << err.text;
+		if (pClientChannel->state == RSSL_CH_STATE_INITIALIZING)
+			ASSERT_EQ(rsslInitChannel(pClientChannel, &inProg, &err), RSSL_RET_SUCCESS);
+		ASSERT_EQ(pClientChannel->state, RSSL_CH_STATE_ACTIVE);
+	}
 
-	serverWriteOpts.pThreadId = &serverWriteThread;
-	serverWriteOpts.pChnl = serverChannel;
-	serverPingOpts.pThreadId = &serverPingThread;
-	serverPingOpts.pChnl = serverChannel;
+	/* Writes a message of length bytes whose contents depend on seqNum */
+	void writeMessage(RsslUInt32 seqNum, RsslUInt32 length)
+	{
+		RsslBuffer *pBuffer;
+		RsslUInt32 bytesWritten, uncompBytesWritten;
+		RsslError err;
 
-	clientReadOpts1.pThreadId = &clientReadThread1;
-	clientReadOpts1.pChnl = clientChannel;
-	clientReadOpts1.readCount = &msgsRead;
-	clientReadOpts1.lock = &readLock;
-	clientReadOpts2.pThreadId = &clientReadThread2;
-	clientReadOpts2.pChnl = clientChannel;
-	clientReadOpts2.readCount = &msgsRead;
-	clientReadOpts2.lock = &readLock;
+		pBuffer = rsslGetBuffer(pServerChannel, length, RSSL_FALSE, &err);
+		ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
+		for (RsslUInt32 i = 0; i < length; ++i)
+			pBuffer->data[i] = (char)(seqNum + i);
+		pBuffer->length = length;
+		ASSERT_EQ(rsslWrite(pServerChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err), RSSL_RET_SUCCESS) << "rsslWrite failed. Error text: " << err.text;
+	}
 
-	RSSL_THREAD_START(&serverWriteThread, blockingWriteThread, (void*)&serverWriteOpts);
-	RSSL_THREAD_START(&serverPingThread, pingThread, (void*)&serverPingOpts);
+	/* Reads the next message and checks it against writeMessage */
+	void readMessage(RsslUInt32 seqNum, RsslUInt32 length)
+	{
+		RsslBuffer *pBuffer;
+		RsslRet readRet;
+		RsslError err;
 
-	RSSL_THREAD_START(&clientReadThread1, blockingReadThread, (void*)&clientReadOpts1);
-	RSSL_THREAD_START(&clientReadThread2, blockingReadThread, (void*)&clientReadOpts1);
+		pBuffer = rsslRead(pClientChannel, &readRet, &err);
+		ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslRead failed for message " << seqNum << ". Error text: " << err.text;
+		ASSERT_EQ(pBuffer->length, length) << "Message " << seqNum;
+		for (RsslUInt32 i = 0; i < length; ++i)
+			ASSERT_EQ(pBuffer->data[i], (char)(seqNum + i)) << "Message " << seqNum << " differs at " << i;
+	}
 
-	do
+	/* Reads until nothing is left and returns the result of the last read */
+	RsslRet readNothing()
 	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+		RsslRet readRet;
+		RsslError err;
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+		EXPECT_EQ(rsslRead(pClientChannel, &readRet, &err), (RsslBuffer*)NULL);
+		return (readRet == RSSL_RET_FAILURE) ? err.rsslErrorId : readRet;
+	}
+};
 
-	shutdownTest = true;
+TEST_F(ShmemRingTests, VariableLengthRoundTrip)
+{
+	const RsslUInt32 messageCount = 20000;
 
-	RSSL_THREAD_JOIN(serverWriteThread);
-	RSSL_THREAD_JOIN(serverPingThread);
+	/* The ring is about 16KB, so the messages wrap around it several hundred times */
+	connect(RSSL_TRUE, 16, 1000);
 
-	rsslCloseChannel(serverChannel, &err);
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; seqNum += 5)
+	{
+		for (RsslUInt32 i = seqNum; i < seqNum + 5; ++i)
+			writeMessage(i, 1 + (i * 37) % 1000);
+		for (RsslUInt32 i = seqNum; i < seqNum + 5; ++i)
+			readMessage(i, 1 + (i * 37) % 1000);
+		ASSERT_NE(readNothing(), RSSL_RET_SLOW_READER);
+	}
+}
 
-	RSSL_THREAD_JOIN(clientReadThread1);
-	RSSL_THREAD_JOIN(clientReadThread2);
+TEST_F(ShmemRingTests, VariableLengthHoldsMoreSmallMessages)
+{
+	const RsslUInt32 messageCount = 200;
+
+	/* Sixteen buffers overrun the reader when it falls more than twelve messages behind */
+	connect(RSSL_FALSE, 16, 1000);
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+		writeMessage(seqNum, 20);
+	EXPECT_EQ(readNothing(), RSSL_RET_SLOW_READER);
+	TearDown();
+	SetUp();
+
+	/* The same memory holds all of them when each takes only its length */
+	connect(RSSL_TRUE, 16, 1000);
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+		writeMessage(seqNum, 20);
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+		readMessage(seqNum, 20);
+}
 
-	rsslCloseChannel(clientChannel, &err);
+TEST_F(ShmemRingTests, VariableLengthSlowReader)
+{
+	connect(RSSL_TRUE, 16, 1000);
+
+	for (RsslUInt32 seqNum = 0; seqNum < 16; ++seqNum)
+		writeMessage(seqNum, 1000);
+	EXPECT_EQ(readNothing(), RSSL_RET_SLOW_READER);
+	EXPECT_EQ(pClientChannel->state, RSSL_CH_STATE_CLOSED);
 }
 
-/*  Multiple reader server threads from a single writer client, and with a pinging thread.
-	Once the writer threads have each written their full data, sets the shutdown boolean
-	and waits for the reader threads to finish.*/
-TEST_F(AllLockTests, BlockingClientWriterServerTwoReaderPing)
+TEST_F(ShmemRingTests, VariableLengthPing)
 {
-	RsslThreadId clientWriteThread, clientPingThread, serverReadThread1, serverReadThread2;
+	RsslError err;
 
+	connect(RSSL_TRUE, 16, 1000);
 
-	ReadChannel serverReadOpts1, serverReadOpts2;
-	WriteChannel clientWriteOpts;
-	PingChannel clientPingOpts;
-	int readCount;
+	writeMessage(0, 10);
+	ASSERT_EQ(rsslPing(pServerChannel, &err), RSSL_RET_SUCCESS);
+	writeMessage(1, 10);
 
-	startupServerAndConections(RSSL_TRUE);
+	readMessage(0, 10);
+	EXPECT_EQ(readNothing(), RSSL_RET_READ_PING);
+	readMessage(1, 10);
+}
 
-	clientWriteOpts.pThreadId = &clientWriteThread;
-	clientWriteOpts.pChnl = clientChannel;
-	clientPingOpts.pThreadId = &clientPingThread;
-	clientPingOpts.pChnl = clientChannel;
+#if defined(LINUX)
+RSSL_THREAD_DECLARE(shmemBlockingReaderThread, pArg)
+{
+	RsslChannel *pChannel = (RsslChannel*)pArg;
+	RsslBuffer *pBuffer;
+	RsslRet readRet;
+	RsslError err;
 
-	serverReadOpts1.pThreadId = &serverReadThread1;
-	serverReadOpts1.pChnl = serverChannel;
-	serverReadOpts1.readCount = &msgsRead;
-	serverReadOpts1.lock = &readLock;
-	serverReadOpts2.pThreadId = &serverReadThread2;
-	serverReadOpts2.pChnl = serverChannel;
-	serverReadOpts2.readCount = &msgsRead;
-	serverReadOpts2.lock = &readLock;
+	pBuffer = rsslRead(pChannel, &readRet, &err);
+	return (void*)(size_t)(pBuffer != NULL ? pBuffer->length : 0);
+}
 
-	RSSL_THREAD_START(&clientWriteThread, nonBlockingWriteThread, (void*)&clientWriteOpts);
-	RSSL_THREAD_START(&clientPingThread, pingThread, (void*)&clientPingOpts);
+TEST_F(ShmemRingTests, FutexWakesBlockingReader)
+{
+	RsslThreadId readerThread;
+	void *readLength;
+	struct timespec sleepTime = { 0, 200000000 };
 
-	RSSL_THREAD_START(&serverReadThread1, blockingReadThread, (void*)&serverReadOpts1);
-	RSSL_THREAD_START(&serverReadThread2, blockingReadThread, (void*)&serverReadOpts2);
+	connect(RSSL_TRUE, 16, 1000, RSSL_TRUE, RSSL_TRUE);
 
+	RSSL_THREAD_START(&readerThread, shmemBlockingReaderThread, pClientChannel);
 
-	do
-	{
-		time_sleep(500);
-		RSSL_MUTEX_LOCK(&readLock);
-		readCount = msgsRead;
-		RSSL_MUTEX_UNLOCK(&readLock);
-	} while (readCount < MAX_MSG_WRITE_COUNT && !failTest);
+	/* give the reader time to go to sleep */
+	nanosleep(&sleepTime, NULL);
+	writeMessage(0, 123);
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+	pthread_join(readerThread, &readLength);
+	EXPECT_EQ((size_t)readLength, (size_t)123);
+}
+#endif
 
-	shutdownTest = true;
+/* Compares messages per second and shared memory used by one buffer per message and the variable-length ring.
+ * The messages are written and read in bursts on one thread, so this measures the cost of the transport rather than of scheduling.
+ * Not run by default; use --gtest_also_run_disabled_tests --gtest_filter=ShmemRingTests.DISABLED_* */
+TEST_F(ShmemRingTests, DISABLED_Throughput)
+{
+	const RsslUInt32 messageCount = 5000000, messageLength = 200, maxFragmentSize = 6144, burstCount = 2000;
+	const RsslBool variableLength[] = { RSSL_FALSE, RSSL_TRUE };
+	const RsslUInt32 numBuffers[] = { 5000, 200 };
+	const char *ringNames[] = { "buffers", "byte ring" };
+	RsslUInt32 bufSize = (RsslUInt32)RTR_SHM_ALIGNBYTES(sizeof(rtrShmBuffer) + maxFragmentSize);
+	RsslBuffer *pBuffer;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslRet readRet;
+	RsslError err;
 
-	RSSL_THREAD_JOIN(clientWriteThread);
-	RSSL_THREAD_JOIN(clientPingThread);
+	printf("  Ring        Shmem bytes   Msgs/sec\n");
 
-	rsslCloseChannel(clientChannel, &err);
+	for (int r = 0; r < 2; ++r)
+	{
+		RsslUInt64 startTime, endTime, ringBytes;
 
-	RSSL_THREAD_JOIN(serverReadThread1);
-	RSSL_THREAD_JOIN(serverReadThread2);
+		connect(variableLength[r], numBuffers[r], maxFragmentSize);
+		ringBytes = variableLength[r] ? RTRShmByteRingSize(numBuffers[r], bufSize) : (RsslUInt64)numBuffers[r] * bufSize;
 
-	rsslCloseChannel(serverChannel, &err);
+		startTime = rsslGetTimeNano();
+		for (RsslUInt32 seqNum = 0; seqNum < messageCount; seqNum += burstCount)
+		{
+			for (RsslUInt32 i = 0; i < burstCount; ++i)
+			{
+				pBuffer = rsslGetBuffer(pServerChannel, messageLength, RSSL_FALSE, &err);
+				ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
+				memset(pBuffer->data, (int)i, messageLength);
+				ASSERT_EQ(rsslWrite(pServerChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err), RSSL_RET_SUCCESS);
+			}
+			for (RsslUInt32 i = 0; i < burstCount; ++i)
+				ASSERT_NE(rsslRead(pClientChannel, &readRet, &err), (RsslBuffer*)NULL) << "rsslRead failed. Error text: " << err.text;
+		}
+		endTime = rsslGetTimeNano();
+
+		printf("  %-10s  %11llu   %8.0f\n", ringNames[r], ringBytes, (double)messageCount * 1000000000.0 / (double)(endTime - startTime));
 
+		TearDown();
+		SetUp();
+	}
 }
 
-class ManyThreadConnectionTests : public ::testing::Test {
+/* Tests of the bidirectional shared memory transport. */
+class BidirShmemTests : public ::testing::Test {
 protected:
-	RsslServer* server;
-	int writeMsgs;
-	RsslError err;
-	bool threadsCreated;
-
-	RsslThreadId clientThreads[MAX_THREADS];
-	RsslThreadId serverThreads[MAX_THREADS];
-	ManyThreadChannel clientOpts[MAX_THREADS];
-	ManyThreadChannel serverOpts[MAX_THREADS];
-	int threadReadCount[MAX_THREADS];
-	RsslMutex readLock[MAX_THREADS];
+	RsslServer *pServer;
+	RsslChannel *pServerChannel;
+	RsslChannel *pClientChannel;
 
 	virtual void SetUp()
 	{
-		writeMsgs = 1;
-		threadsCreated = false;
-		shutdownTest = false;
-		failTest = false;
+		RsslError err;
 
-		for (int i = 0; i < MAX_THREADS; ++i)
-		{
-			RSSL_MUTEX_INIT(&readLock[i]);
-			threadReadCount[i] = 0;
-		}
+		pServer = NULL;
+		pServerChannel = NULL;
+		pClientChannel = NULL;
+		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
 	}
 
 	virtual void TearDown()
 	{
+		RsslError err;
 
-		if(failTest && threadsCreated)
-		{
-			for (int i = 0; i < MAX_THREADS; i++)
-			{
-				RSSL_THREAD_KILL(&clientThreads[i]);
-				RSSL_THREAD_KILL(&serverThreads[i]);
-			}
-		} 
+		if (pClientChannel != NULL)
+			rsslCloseChannel(pClientChannel, &err);
+		if (pServerChannel != NULL)
+			rsslCloseChannel(pServerChannel, &err);
+		if (pServer != NULL)
+			rsslCloseServer(pServer, &err);
 		rsslUninitialize();
-		server = NULL;
 		resetDeadlockTimer();
 	}
-};
 
-/*  Starts up a nonblocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.  
-	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
-TEST_F(ManyThreadConnectionTests, NonBlockingAllLockClientReadServerWrite)
-{
+	void connect(RsslUInt32 numBuffers, RsslUInt32 maxFragmentSize)
+	{
+		RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+		RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+		RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+		RsslInProgInfo inProg;
+		RsslError err;
 
-	RsslServer* server = NULL;
-	int i;
-	int readMax = 0;
-	int threadsDone = 0;
+		bindOpts.serviceName = (char*)"bidirShmemTest";
+		bindOpts.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+		bindOpts.protocolType = TEST_PROTOCOL_TYPE;
+		bindOpts.maxOutputBuffers = bindOpts.guaranteedOutputBuffers = numBuffers;
+		bindOpts.numInputBuffers = numBuffers;
+		bindOpts.maxFragmentSize = maxFragmentSize;
 
-	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+		pServer = rsslBind(&bindOpts, &err);
+		ASSERT_NE(pServer, (RsslServer*)NULL) << "rsslBind failed. Error text: " << err.text;
 
-	server = startupServer(RSSL_FALSE);
-	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+		connectOpts.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+		connectOpts.connectionInfo.unified.serviceName = (char*)"bidirShmemTest";
+		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
+		connectOpts.guaranteedOutputBuffers = numBuffers;
 
+		pClientChannel = rsslConnect(&connectOpts, &err);
+		ASSERT_NE(pClientChannel, (RsslChannel*)NULL) << "rsslConnect failed. Error text: " << err.text;
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		clientOpts[i].pThreadId = &clientThreads[i];
-		clientOpts[i].serverChannel = false;
-		clientOpts[i].readCount = &(threadReadCount[i]);
-		clientOpts[i].lock = &readLock[i];
-		RSSL_THREAD_START(&clientThreads[i], nonBlockingManyChannelReadThread, (void*)&clientOpts[i]);
+		pServerChannel = rsslAccept(pServer, &acceptOpts, &err);
+		ASSERT_NE(pServerChannel, (RsslChannel*)NULL) << "rsslAccept failed. Error text: " << err.text;
 
-		serverOpts[i].pThreadId = &serverThreads[i];
-		serverOpts[i].serverChannel = true;
-		serverOpts[i].pServer = server;
-		serverOpts[i].msgCount = writeMsgs;
-		RSSL_THREAD_START(&serverThreads[i], nonBlockingManyChannelWriteThread, (void*)&serverOpts[i]);
+		/* the server waits for the client to attach to the segment it created */
+		ASSERT_EQ(rsslInitChannel(pServerChannel, &inProg, &err), RSSL_RET_CHAN_INIT_IN_PROGRESS);
+		ASSERT_EQ(rsslInitChannel(pClientChannel, &inProg, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+		ASSERT_EQ(rsslInitChannel(pServerChannel, &inProg, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+		ASSERT_EQ(pClientChannel->state, RSSL_CH_STATE_ACTIVE);
+		ASSERT_EQ(pServerChannel->state, RSSL_CH_STATE_ACTIVE);
 	}
 
-	threadsCreated = true;
-
-	while (!shutdownTest && !failTest)
+	/* Writes a message of length bytes whose contents depend on seqNum. Returns the result of rsslWrite. */
+	RsslRet writeMessage(RsslChannel *pChannel, RsslUInt32 seqNum, RsslUInt32 length)
 	{
-		time_sleep(500);
-		threadsDone = 0;
-		for (i = 0; i < MAX_THREADS; i++)
-		{
-			RSSL_MUTEX_LOCK(&readLock[i]);
-			if (threadReadCount[i] == writeMsgs)
-				++threadsDone;
-			RSSL_MUTEX_UNLOCK(&readLock[i]);
-		}
+		RsslBuffer *pBuffer;
+		RsslUInt32 bytesWritten, uncompBytesWritten;
+		RsslError err;
 
-		if (threadsDone == MAX_THREADS)
-		{
-			shutdownTest = true;
-		}
-	}	
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
+		pBuffer = rsslGetBuffer(pChannel, length, RSSL_FALSE, &err);
+		EXPECT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
+		if (pBuffer == NULL)
+			return err.rsslErrorId;
+		for (RsslUInt32 i = 0; i < length; ++i)
+			pBuffer->data[i] = (char)(seqNum + i);
+		pBuffer->length = length;
+		return rsslWrite(pChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err);
+	}
+
+	/* Reads the next message and checks it against writeMessage */
+	void readMessage(RsslChannel *pChannel, RsslUInt32 seqNum, RsslUInt32 length)
+	{
+		RsslBuffer *pBuffer;
+		RsslRet readRet;
+		RsslError err;
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		RSSL_THREAD_JOIN(serverThreads[i]);
+		pBuffer = rsslRead(pChannel, &readRet, &err);
+		ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslRead failed for message " << seqNum << ". Error text: " << err.text;
+		ASSERT_EQ(pBuffer->length, length) << "Message " << seqNum;
+		for (RsslUInt32 i = 0; i < length; ++i)
+			ASSERT_EQ(pBuffer->data[i], (char)(seqNum + i)) << "Message " << seqNum << " differs at " << i;
 	}
 
-	for (i = 0; i < MAX_THREADS; i++)
+	/* Reads once, expecting no message, and returns the read result */
+	RsslRet readNothing(RsslChannel *pChannel)
 	{
-		RSSL_THREAD_JOIN(clientThreads[i]);
+		RsslRet readRet;
+		RsslError err;
+
+		EXPECT_EQ(rsslRead(pChannel, &readRet, &err), (RsslBuffer*)NULL);
+		return readRet;
 	}
+};
 
-	rsslCloseServer(server, &err);
-	
+TEST_F(BidirShmemTests, TwoWayRoundTrip)
+{
+	const RsslUInt32 messageCount = 5000;
 
+	connect(16, 1000);
+
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+	{
+		ASSERT_EQ(writeMessage(pClientChannel, seqNum, 1 + (seqNum * 37) % 1000), RSSL_RET_SUCCESS);
+		readMessage(pServerChannel, seqNum, 1 + (seqNum * 37) % 1000);
+		ASSERT_EQ(writeMessage(pServerChannel, seqNum, 1 + (seqNum * 53) % 1000), RSSL_RET_SUCCESS);
+		readMessage(pClientChannel, seqNum, 1 + (seqNum * 53) % 1000);
+	}
+	EXPECT_EQ(readNothing(pServerChannel), RSSL_RET_READ_WOULD_BLOCK);
+	EXPECT_EQ(readNothing(pClientChannel), RSSL_RET_READ_WOULD_BLOCK);
 }
 
-/*  Starts up a nonblocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
-	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
-TEST_F(ManyThreadConnectionTests, NonBlockingAllLockClientWriteServerRead)
+TEST_F(BidirShmemTests, Ping)
 {
+	RsslError err;
 
-	RsslServer* server = NULL;
-	int i;
-	int readMax = 0;
-	int threadsDone = 0;
+	connect(16, 1000);
 
-	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+	ASSERT_EQ(writeMessage(pClientChannel, 0, 10), RSSL_RET_SUCCESS);
+	ASSERT_EQ(rsslPing(pClientChannel, &err), RSSL_RET_SUCCESS);
+	ASSERT_EQ(writeMessage(pClientChannel, 1, 10), RSSL_RET_SUCCESS);
 
-	server = startupServer(RSSL_FALSE);
-	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+	readMessage(pServerChannel, 0, 10);
+	EXPECT_EQ(readNothing(pServerChannel), RSSL_RET_READ_PING);
+	readMessage(pServerChannel, 1, 10);
+}
 
+TEST_F(BidirShmemTests, FullRingQueuesUntilFlushed)
+{
+	const RsslUInt32 messageCount = 8;
+	RsslInt32 pendingWrites = 0;
+	RsslRet ret;
+	RsslError err;
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		clientOpts[i].pThreadId = &clientThreads[i];
-		clientOpts[i].serverChannel = false;
-		clientOpts[i].msgCount = writeMsgs;
-		RSSL_THREAD_START(&clientThreads[i], nonBlockingManyChannelWriteThread, (void*)&clientOpts[i]);
+	/* the smallest ring holds four maximum sized messages; the reader never overruns, the writer waits */
+	connect(4, 1000);
 
-		serverOpts[i].pThreadId = &serverThreads[i];
-		serverOpts[i].serverChannel = true;
-		serverOpts[i].pServer = server;
-		serverOpts[i].lock = &readLock[i];
-		serverOpts[i].readCount = &(threadReadCount[i]);
-		RSSL_THREAD_START(&serverThreads[i], nonBlockingManyChannelReadThread, (void*)&serverOpts[i]);
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+	{
+		ret = writeMessage(pServerChannel, seqNum, 1000);
+		ASSERT_GE(ret, RSSL_RET_SUCCESS);
+		if (ret > RSSL_RET_SUCCESS)
+			++pendingWrites;
 	}
+	EXPECT_GT(pendingWrites, 0);
 
-	threadsCreated = true;
+	/* all four output buffers are queued */
+	EXPECT_EQ(rsslGetBuffer(pServerChannel, 10, RSSL_FALSE, &err), (RsslBuffer*)NULL);
+	EXPECT_EQ(err.rsslErrorId, RSSL_RET_BUFFER_NO_BUFFERS);
 
-	while (!shutdownTest && !failTest)
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
 	{
-		time_sleep(500);
-		threadsDone = 0;
-		for (i = 0; i < MAX_THREADS; i++)
-		{
-			RSSL_MUTEX_LOCK(&readLock[i]);
-			if (threadReadCount[i] == writeMsgs)
-				++threadsDone;
-			RSSL_MUTEX_UNLOCK(&readLock[i]);
-		}
-
-		if (threadsDone == MAX_THREADS)
-		{
-			shutdownTest = true;
-		}
+		readMessage(pClientChannel, seqNum, 1000);
+		ASSERT_GE(rsslFlush(pServerChannel, &err), RSSL_RET_SUCCESS);
 	}
+	EXPECT_EQ(rsslFlush(pServerChannel, &err), RSSL_RET_SUCCESS);
+	EXPECT_EQ(readNothing(pClientChannel), RSSL_RET_READ_WOULD_BLOCK);
+}
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+TEST_F(BidirShmemTests, LargeMessagesFragmented)
+{
+	RsslBuffer *pBuffer;
+	RsslRet ret, readRet;
+	RsslError err;
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		RSSL_THREAD_JOIN(serverThreads[i]);
-	}
+	connect(4, 1000);
 
-	for (i = 0; i < MAX_THREADS; i++)
+	/* fits in the ring in pieces */
+	ASSERT_EQ(writeMessage(pClientChannel, 0, 2500), RSSL_RET_SUCCESS);
+	ASSERT_EQ(writeMessage(pClientChannel, 1, 10), RSSL_RET_SUCCESS);
+	readMessage(pServerChannel, 0, 2500);
+	readMessage(pServerChannel, 1, 10);
+
+	/* larger than the ring, so the rest is queued until the reader makes room */
+	ret = writeMessage(pServerChannel, 2, 10000);
+	ASSERT_GT(ret, RSSL_RET_SUCCESS);
+	ASSERT_GT(writeMessage(pServerChannel, 3, 10), RSSL_RET_SUCCESS);
+
+	while ((pBuffer = rsslRead(pClientChannel, &readRet, &err)) == NULL)
 	{
-		RSSL_THREAD_JOIN(clientThreads[i]);
+		ASSERT_EQ(readRet, RSSL_RET_READ_WOULD_BLOCK) << "Error text: " << err.text;
+		ASSERT_GT(ret, RSSL_RET_SUCCESS) << "Message not received after the queue was flushed";
+		ASSERT_GE(ret = rsslFlush(pServerChannel, &err), RSSL_RET_SUCCESS);
 	}
+	ASSERT_EQ(pBuffer->length, 10000u);
+	for (RsslUInt32 i = 0; i < 10000; ++i)
+		ASSERT_EQ(pBuffer->data[i], (char)(2 + i)) << "Message differs at " << i;
 
-	rsslCloseServer(server, &err);
+	EXPECT_EQ(rsslFlush(pServerChannel, &err), RSSL_RET_SUCCESS);
+	readMessage(pClientChannel, 3, 10);
+	EXPECT_EQ(readNothing(pClientChannel), RSSL_RET_READ_WOULD_BLOCK);
 }
 
-/*  Starts up a nonblocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
-	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
-TEST_F(ManyThreadConnectionTests, NonBlockingGlobalLockClientReadServerWrite)
+TEST_F(BidirShmemTests, PeerCloseDetected)
 {
+	RsslError err;
 
-	RsslServer* server = NULL;
-	int i;
-	int readMax = 0;
-	int threadsDone = 0;
+	connect(16, 1000);
 
-	rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+	/* messages written before the close are still delivered */
+	ASSERT_EQ(writeMessage(pClientChannel, 0, 10), RSSL_RET_SUCCESS);
+	rsslCloseChannel(pClientChannel, &err);
+	pClientChannel = NULL;
 
-	server = startupServer(RSSL_FALSE);
-	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+	readMessage(pServerChannel, 0, 10);
+	EXPECT_EQ(readNothing(pServerChannel), RSSL_RET_FAILURE);
+	EXPECT_EQ(pServerChannel->state, RSSL_CH_STATE_CLOSED);
+}
 
+TEST_F(BidirShmemTests, ProtocolTypeMismatchRefused)
+{
+	RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+	RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+	RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+	RsslInProgInfo inProg;
+	RsslError err;
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		clientOpts[i].pThreadId = &clientThreads[i];
-		clientOpts[i].serverChannel = false;
-		clientOpts[i].readCount = &(threadReadCount[i]);
-		clientOpts[i].lock = &readLock[i];
-		RSSL_THREAD_START(&clientThreads[i], nonBlockingManyChannelReadThread, (void*)&clientOpts[i]);
+	bindOpts.serviceName = (char*)"bidirShmemTest";
+	bindOpts.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+	bindOpts.protocolType = TEST_PROTOCOL_TYPE;
+	pServer = rsslBind(&bindOpts, &err);
+	ASSERT_NE(pServer, (RsslServer*)NULL) << "rsslBind failed. Error text: " << err.text;
 
-		serverOpts[i].pThreadId = &serverThreads[i];
-		serverOpts[i].serverChannel = true;
-		serverOpts[i].pServer = server;
-		serverOpts[i].msgCount = writeMsgs;
-		RSSL_THREAD_START(&serverThreads[i], nonBlockingManyChannelWriteThread, (void*)&serverOpts[i]);
-	}
+	connectOpts.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+	connectOpts.connectionInfo.unified.serviceName = (char*)"bidirShmemTest";
+	connectOpts.protocolType = TEST_PROTOCOL_TYPE + 1;
+	pClientChannel = rsslConnect(&connectOpts, &err);
+	ASSERT_NE(pClientChannel, (RsslChannel*)NULL) << "rsslConnect failed. Error text: " << err.text;
+	pServerChannel = rsslAccept(pServer, &acceptOpts, &err);
+	ASSERT_NE(pServerChannel, (RsslChannel*)NULL) << "rsslAccept failed. Error text: " << err.text;
 
-	threadsCreated = true;
+	EXPECT_EQ(rsslInitChannel(pClientChannel, &inProg, &err), RSSL_RET_CHAN_INIT_REFUSED);
+}
 
-	while (!shutdownTest && !failTest)
+/* Compares round trip latency of the bidirectional shared memory transport and loopback TCP.
+ * Each message is written by the client, read and echoed by the server, and read back on one thread,
+ * so this measures the cost of the transport rather than of scheduling.
+ * Not run by default; use --gtest_also_run_disabled_tests --gtest_filter=BidirShmemTests.DISABLED_* */
+TEST_F(BidirShmemTests, DISABLED_RoundTripLatency)
+{
+	const RsslUInt32 messageCount = 200000, messageLength = 200;
+	const RsslConnectionTypes connTypes[] = { RSSL_CONN_TYPE_SOCKET, RSSL_CONN_TYPE_BIDIR_SHMEM };
+	const char *connNames[] = { "tcp", "shmem" };
+	RsslBuffer *pBuffer;
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslInProgInfo inProg;
+	RsslRet readRet;
+	RsslError err;
+
+	printf("  Transport   usec/round trip\n");
+
+	for (int t = 0; t < 2; ++t)
 	{
-		time_sleep(500);
-		threadsDone = 0;
-		for (i = 0; i < MAX_THREADS; i++)
+		RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+		RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+		RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+		RsslUInt64 startTime, endTime;
+
+		bindOpts.serviceName = (char*)"15100";
+		bindOpts.connectionType = connTypes[t];
+		bindOpts.protocolType = TEST_PROTOCOL_TYPE;
+		bindOpts.tcpOpts.tcp_nodelay = RSSL_TRUE;
+		pServer = rsslBind(&bindOpts, &err);
+		ASSERT_NE(pServer, (RsslServer*)NULL) << "rsslBind failed. Error text: " << err.text;
+
+		connectOpts.connectionType = connTypes[t];
+		connectOpts.connectionInfo.unified.address = (char*)"localhost";
+		connectOpts.connectionInfo.unified.serviceName = (char*)"15100";
+		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
+		connectOpts.tcpOpts.tcp_nodelay = RSSL_TRUE;
+		pClientChannel = rsslConnect(&connectOpts, &err);
+		ASSERT_NE(pClientChannel, (RsslChannel*)NULL) << "rsslConnect failed. Error text: " << err.text;
+
+		/* wait for the accept so a TCP connect has something to finish with */
+		while ((pServerChannel = rsslAccept(pServer, &acceptOpts, &err)) == NULL)
+			time_sleep(1);
+		while (pClientChannel->state != RSSL_CH_STATE_ACTIVE || pServerChannel->state != RSSL_CH_STATE_ACTIVE)
 		{
-			RSSL_MUTEX_LOCK(&readLock[i]);
-			if (threadReadCount[i] == writeMsgs)
-				++threadsDone;
-			RSSL_MUTEX_UNLOCK(&readLock[i]);
+			if (pClientChannel->state != RSSL_CH_STATE_ACTIVE)
+				ASSERT_GE(rsslInitChannel(pClientChannel, &inProg, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+			if (pServerChannel->state != RSSL_CH_STATE_ACTIVE)
+				ASSERT_GE(rsslInitChannel(pServerChannel, &inProg, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 		}
 
-		if (threadsDone == MAX_THREADS)
+		startTime = rsslGetTimeNano();
+		for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
 		{
-			shutdownTest = true;
-		}
-	}
+			RsslBuffer *pEcho;
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+			pBuffer = rsslGetBuffer(pClientChannel, messageLength, RSSL_FALSE, &err);
+			ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
+			memset(pBuffer->data, (int)seqNum, messageLength);
+			ASSERT_GE(rsslWrite(pClientChannel, pBuffer, RSSL_HIGH_PRIORITY, RSSL_WRITE_DIRECT_SOCKET_WRITE, &bytesWritten, &uncompBytesWritten, &err), RSSL_RET_SUCCESS);
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		RSSL_THREAD_JOIN(serverThreads[i]);
-	}
+			while ((pEcho = rsslRead(pServerChannel, &readRet, &err)) == NULL)
+				ASSERT_NE(readRet, RSSL_RET_FAILURE) << "rsslRead failed. Error text: " << err.text;
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		RSSL_THREAD_JOIN(clientThreads[i]);
-	}
+			pBuffer = rsslGetBuffer(pServerChannel, pEcho->length, RSSL_FALSE, &err);
+			ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "rsslGetBuffer failed. Error text: " << err.text;
+			memcpy(pBuffer->data, pEcho->data, pEcho->length);
+			ASSERT_GE(rsslWrite(pServerChannel, pBuffer, RSSL_HIGH_PRIORITY, RSSL_WRITE_DIRECT_SOCKET_WRITE, &bytesWritten, &uncompBytesWritten, &err), RSSL_RET_SUCCESS);
 
-	rsslCloseServer(server, &err);
+			while (rsslRead(pClientChannel, &readRet, &err) == NULL)
+				ASSERT_NE(readRet, RSSL_RET_FAILURE) << "rsslRead failed. Error text: " << err.text;
+		}
+		endTime = rsslGetTimeNano();
+
+		printf("  %-10s  %15.2f\n", connNames[t], (double)(endTime - startTime) / 1000.0 / messageCount);
+
+		TearDown();
+		SetUp();
+	}
 }
 
-/*  Starts up a nonblocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
-	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
-TEST_F(ManyThreadConnectionTests, NonBlockingGlobalLockClientWriteServerRead)
-{
+#ifdef RIPC_URING_SUPPORTED
+class IoUringTests : public ::testing::Test {
+protected:
+	enum { MAX_PAIRS = 4 };
 
-	RsslServer* server = NULL;
-	int i;
-	int readMax = 0;
-	int threadsDone = 0;
+	RsslServer *pServer;
+	RsslChannel *pServerChannel;
+	RsslChannel *pClientChannel;
+	RsslChannel *pairClients[MAX_PAIRS];
+	RsslChannel *pairServers[MAX_PAIRS];
+	RsslIoUring *pIoUring;
+	RsslSocket clientSocket, serverSocket;
+	bool uringAvailable;
 
-	rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+	virtual void SetUp()
+	{
+		RsslError err;
+		int fds[2];
+		void *session;
 
-	server = startupServer(RSSL_FALSE);
-	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+		pServer = NULL;
+		pServerChannel = NULL;
+		pClientChannel = NULL;
+		pIoUring = NULL;
+		for (int i = 0; i < MAX_PAIRS; ++i)
+			pairClients[i] = pairServers[i] = NULL;
+		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
 
+		/* the kernel or its settings may not allow io_uring, in which case channels stay on the socket */
+		uringAvailable = false;
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0)
+		{
+			if ((session = ipcUringNewSession(NULL, fds[0])) != NULL)
+			{
+				uringAvailable = true;
+				ipcUringShutdown(session);
+			}
+			else
+				close(fds[0]);
+			close(fds[1]);
+		}
+	}
 
-	for (i = 0; i < MAX_THREADS; i++)
+	virtual void TearDown()
 	{
-		clientOpts[i].pThreadId = &clientThreads[i];
-		clientOpts[i].serverChannel = false;
-		clientOpts[i].msgCount = writeMsgs;
-		RSSL_THREAD_START(&clientThreads[i], nonBlockingManyChannelWriteThread, (void*)&clientOpts[i]);
+		RsslError err;
 
-		serverOpts[i].pThreadId = &serverThreads[i];
-		serverOpts[i].serverChannel = true;
-		serverOpts[i].pServer = server;
-		serverOpts[i].lock = &readLock[i];
-		serverOpts[i].readCount = &(threadReadCount[i]);
-		RSSL_THREAD_START(&serverThreads[i], nonBlockingManyChannelReadThread, (void*)&serverOpts[i]);
+		if (pClientChannel != NULL)
+			rsslCloseChannel(pClientChannel, &err);
+		if (pServerChannel != NULL)
+			rsslCloseChannel(pServerChannel, &err);
+		for (int i = 0; i < MAX_PAIRS; ++i)
+		{
+			if (pairClients[i] != NULL)
+				rsslCloseChannel(pairClients[i], &err);
+			if (pairServers[i] != NULL)
+				rsslCloseChannel(pairServers[i], &err);
+		}
+		if (pIoUring != NULL)
+			rsslDestroyIoUring(pIoUring, &err);
+		if (pServer != NULL)
+			rsslCloseServer(pServer, &err);
+		rsslUninitialize();
+		resetDeadlockTimer();
 	}
 
-	threadsCreated = true;
+	void bind(RsslConnectionTypes connType)
+	{
+		RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+		RsslError err;
 
-	while (!shutdownTest && !failTest)
+		bindOpts.serviceName = (char*)"15101";
+		bindOpts.connectionType = RSSL_CONN_TYPE_SOCKET;
+		bindOpts.protocolType = TEST_PROTOCOL_TYPE;
+		bindOpts.tcpOpts.tcp_nodelay = RSSL_TRUE;
+		bindOpts.tcpOpts.io_uring = RSSL_TRUE;
+		if (connType == RSSL_CONN_TYPE_WEBSOCKET)
+			bindOpts.wsOpts.protocols = (char*)"rssl.rwf";
+		pServer = rsslBind(&bindOpts, &err);
+		ASSERT_NE(pServer, (RsslServer*)NULL) << "rsslBind failed. Error text: " << err.text;
+	}
+
+	/* Connects a client to pServer, giving both channels pRing if set */
+	void connectPair(RsslConnectionTypes connType, RsslIoUring *pRing, RsslChannel **ppClient, RsslChannel **ppServer)
 	{
-		time_sleep(500);
-		threadsDone = 0;
-		for (i = 0; i < MAX_THREADS; i++)
+		RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+		RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+		RsslInProgInfo inProg;
+		RsslError err;
+
+		connectOpts.connectionType = connType;
+		connectOpts.connectionInfo.unified.address = (char*)"localhost";
+		connectOpts.connectionInfo.unified.serviceName = (char*)"15101";
+		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
+		connectOpts.tcpOpts.tcp_nodelay = RSSL_TRUE;
+		connectOpts.tcpOpts.io_uring = RSSL_TRUE;
+		if (connType == RSSL_CONN_TYPE_WEBSOCKET)
+			connectOpts.wsOpts.protocols = (char*)"rssl.rwf";
+		*ppClient = rsslConnect(&connectOpts, &err);
+		ASSERT_NE(*ppClient, (RsslChannel*)NULL) << "rsslConnect failed. Error text: " << err.text;
+
+		while ((*ppServer = rsslAccept(pServer, &acceptOpts, &err)) == NULL)
+			time_sleep(1);
+
+		if (pRing != NULL)
 		{
-			RSSL_MUTEX_LOCK(&readLock[i]);
-			if (threadReadCount[i] == writeMsgs)
-				++threadsDone;
-			RSSL_MUTEX_UNLOCK(&readLock[i]);
+			ASSERT_EQ(rsslIoctl(*ppClient, RSSL_IO_URING, &pRing, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+			ASSERT_EQ(rsslIoctl(*ppServer, RSSL_IO_URING, &pRing, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 		}
 
-		if (threadsDone == MAX_THREADS)
+		while ((*ppClient)->state != RSSL_CH_STATE_ACTIVE || (*ppServer)->state != RSSL_CH_STATE_ACTIVE)
 		{
-			shutdownTest = true;
+			if ((*ppClient)->state != RSSL_CH_STATE_ACTIVE)
+				ASSERT_GE(rsslInitChannel(*ppClient, &inProg, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+			if ((*ppServer)->state != RSSL_CH_STATE_ACTIVE)
+				ASSERT_GE(rsslInitChannel(*ppServer, &inProg, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 		}
 	}
 
-	ASSERT_FALSE(failTest) << "Test failed.";
-
-	for (i = 0; i < MAX_THREADS; i++)
+	void connect(RsslConnectionTypes connType)
 	{
-		RSSL_THREAD_JOIN(serverThreads[i]);
+		bind(connType);
+		ASSERT_FALSE(HasFatalFailure());
+		connectPair(connType, NULL, &pClientChannel, &pServerChannel);
+		ASSERT_FALSE(HasFatalFailure());
+
+		clientSocket = pClientChannel->socketId;
+		serverSocket = pServerChannel->socketId;
 	}
 
-	for (i = 0; i < MAX_THREADS; i++)
+	/* Whether the channel's writes go through a ring */
+	bool onRing(RsslChannel *pChannel)
 	{
-		RSSL_THREAD_JOIN(clientThreads[i]);
+		RsslSocketChannel *pSocketChannel = (RsslSocketChannel*)((rsslChannelImpl*)pChannel)->transportInfo;
+		return pSocketChannel->transportFuncs->writeVTransport == ipcUringWriteV;
 	}
 
-	rsslCloseServer(server, &err);
-}
-
-/*  Starts up a blocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
-	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
-TEST_F(ManyThreadConnectionTests, BlockingAllLockClientReadServerWrite)
-{
+	/* Waits up to timeoutMs for the channel's descriptor to be readable or writable */
+	bool waitFor(RsslChannel *pChannel, bool write, int timeoutMs)
+	{
+		fd_set fds;
+		struct timeval selectTime;
 
-	RsslServer* server = NULL;
-	int i;
-	int readMax = 0;
-	int threadsDone = 0;
+		FD_ZERO(&fds);
+		FD_SET(pChannel->socketId, &fds);
+		selectTime.tv_sec = timeoutMs / 1000;
+		selectTime.tv_usec = (timeoutMs % 1000) * 1000;
+		return select((int)pChannel->socketId + 1, write ? NULL : &fds, write ? &fds : NULL, NULL, &selectTime) > 0;
+	}
 
-	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+	/* Reads until a message arrives, waiting on the channel's descriptor as an application would.
+	 * Returns NULL and the read result if the channel fails or nothing arrives. */
+	RsslBuffer *readNext(RsslChannel *pChannel, RsslRet *readRet)
+	{
+		RsslBuffer *pBuffer;
+		RsslError err;
 
-	server = startupServer(RSSL_TRUE);
-	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+		for (int tries = 0; tries < 10000; ++tries)
+		{
+			if ((pBuffer = rsslRead(pChannel, readRet, &err)) != NULL)
+				return pBuffer;
 
+			if (*readRet == RSSL_RET_READ_WOULD_BLOCK)
+				waitFor(pChannel, false, 1000);
+			else if (*readRet < RSSL_RET_SUCCESS && *readRet != RSSL_RET_READ_FD_CHANGE && *readRet != RSSL_RET_READ_PING)
+				return NULL;
+		}
+		return NULL;
+	}
 
-	for (i = 0; i < MAX_THREADS; i++)
+	/* Writes a message of length bytes whose contents depend on seqNum. Returns what rsslWrite returned. */
+	RsslRet writeOnly(RsslChannel *pChannel, RsslUInt32 seqNum, RsslUInt32 length)
 	{
-		clientOpts[i].pThreadId = &clientThreads[i];
-		clientOpts[i].serverChannel = false;
-		clientOpts[i].readCount = &(threadReadCount[i]);
-		clientOpts[i].lock = &readLock[i];
-		RSSL_THREAD_START(&clientThreads[i], blockingManyChannelReadThread, (void*)&clientOpts[i]);
+		RsslBuffer *pBuffer;
+		RsslUInt32 bytesWritten, uncompBytesWritten;
+		RsslRet ret;
+		RsslError err;
 
-		serverOpts[i].pThreadId = &serverThreads[i];
-		serverOpts[i].serverChannel = true;
-		serverOpts[i].pServer = server;
-		serverOpts[i].msgCount = writeMsgs;
-		RSSL_THREAD_START(&serverThreads[i], blockingManyChannelWriteThread, (void*)&serverOpts[i]);
+		while ((pBuffer = rsslGetBuffer(pChannel, length, RSSL_FALSE, &err)) == NULL)
+		{
+			EXPECT_EQ(err.rsslErrorId, RSSL_RET_BUFFER_NO_BUFFERS) << "rsslGetBuffer failed. Error text: " << err.text;
+			if (err.rsslErrorId != RSSL_RET_BUFFER_NO_BUFFERS || rsslFlush(pChannel, &err) < RSSL_RET_SUCCESS)
+				return RSSL_RET_FAILURE;
+			waitFor(pChannel, true, 1000);
+		}
+		for (RsslUInt32 i = 0; i < length; ++i)
+			pBuffer->data[i] = (char)(seqNum + i);
+		pBuffer->length = length;
+		ret = rsslWrite(pChannel, pBuffer, RSSL_HIGH_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, &err);
+		EXPECT_GE(ret, RSSL_RET_SUCCESS) << "Error text: " << err.text;
+		return ret;
 	}
 
-	threadsCreated = true;
-
-	while (!shutdownTest && !failTest)
+	/* Writes a message and flushes it, waiting for the socket to be writable as an application would */
+	void writeMessage(RsslChannel *pChannel, RsslUInt32 seqNum, RsslUInt32 length)
 	{
-		time_sleep(500);
-		threadsDone = 0;
-		for (i = 0; i < MAX_THREADS; i++)
+		RsslRet ret;
+		RsslError err;
+
+		ASSERT_GE(ret = writeOnly(pChannel, seqNum, length), RSSL_RET_SUCCESS);
+		while (ret > RSSL_RET_SUCCESS)
 		{
-			RSSL_MUTEX_LOCK(&readLock[i]);
-			if (threadReadCount[i] == writeMsgs)
-				++threadsDone;
-			RSSL_MUTEX_UNLOCK(&readLock[i]);
+			waitFor(pChannel, true, 1000);
+			ASSERT_GE(ret = rsslFlush(pChannel, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 		}
+	}
+
+	/* Reads the next message and checks it against writeMessage */
+	void readMessage(RsslChannel *pChannel, RsslUInt32 seqNum, RsslUInt32 length)
+	{
+		RsslBuffer *pBuffer;
+		RsslRet readRet;
 
-		if (threadsDone == MAX_THREADS)
+		pBuffer = readNext(pChannel, &readRet);
+		ASSERT_NE(pBuffer, (RsslBuffer*)NULL) << "No message " << seqNum << ", read returned " << readRet;
+		ASSERT_EQ(pBuffer->length, length) << "Message " << seqNum;
+		for (RsslUInt32 i = 0; i < length; ++i)
+			ASSERT_EQ(pBuffer->data[i], (char)(seqNum + i)) << "Message " << seqNum << " differs at " << i;
+	}
+
+	void twoWay(RsslConnectionTypes connType)
+	{
+		const RsslUInt32 messageCount = 2000;
+
+		connect(connType);
+		ASSERT_FALSE(HasFatalFailure());
+
+		for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
 		{
-			shutdownTest = true;
+			writeMessage(pClientChannel, seqNum, 1 + (seqNum * 37) % 6000);
+			readMessage(pServerChannel, seqNum, 1 + (seqNum * 37) % 6000);
+			writeMessage(pServerChannel, seqNum, 1 + (seqNum * 53) % 6000);
+			readMessage(pClientChannel, seqNum, 1 + (seqNum * 53) % 6000);
+			ASSERT_FALSE(HasFatalFailure());
 		}
+
+		/* the application keeps selecting on the socket either way */
+		EXPECT_EQ(pClientChannel->socketId, clientSocket);
+		EXPECT_EQ(pServerChannel->socketId, serverSocket);
+		EXPECT_EQ(onRing(pClientChannel), uringAvailable);
+		EXPECT_EQ(onRing(pServerChannel), uringAvailable);
 	}
+};
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+TEST_F(IoUringTests, SocketTwoWay)
+{
+	twoWay(RSSL_CONN_TYPE_SOCKET);
+}
 
-	for (i = 0; i < MAX_THREADS; i++)
+TEST_F(IoUringTests, WebSocketTwoWay)
+{
+	twoWay(RSSL_CONN_TYPE_WEBSOCKET);
+}
+
+TEST_F(IoUringTests, BurstsAndLargeMessages)
+{
+	const RsslUInt32 burstCount = 500, largeLength = 200000;
+
+	connect(RSSL_CONN_TYPE_SOCKET);
+	ASSERT_FALSE(HasFatalFailure());
+
+	/* more than the send buffer holds, so writes come back partial and are flushed */
+	for (RsslUInt32 seqNum = 0; seqNum < burstCount; ++seqNum)
 	{
-		RSSL_THREAD_JOIN(serverThreads[i]);
+		writeMessage(pServerChannel, seqNum, 1000);
+		ASSERT_FALSE(HasFatalFailure());
 	}
+	writeMessage(pServerChannel, burstCount, largeLength);
+	ASSERT_FALSE(HasFatalFailure());
 
-	for (i = 0; i < MAX_THREADS; i++)
+	for (RsslUInt32 seqNum = 0; seqNum < burstCount; ++seqNum)
 	{
-		RSSL_THREAD_JOIN(clientThreads[i]);
+		readMessage(pClientChannel, seqNum, 1000);
+		ASSERT_FALSE(HasFatalFailure());
 	}
-
-	rsslCloseServer(server, &err);
+	readMessage(pClientChannel, burstCount, largeLength);
+	EXPECT_EQ(onRing(pServerChannel), uringAvailable);
 }
 
-/*  Starts up a blocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
-	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
-TEST_F(ManyThreadConnectionTests, BlockingAllLockClientWriteServerRead)
+TEST_F(IoUringTests, PeerCloseDetected)
 {
+	RsslRet readRet;
+	RsslError err;
 
-	RsslServer* server = NULL;
-	int i;
-	int readMax = 0;
-	int threadsDone = 0;
+	connect(RSSL_CONN_TYPE_SOCKET);
+	ASSERT_FALSE(HasFatalFailure());
 
-	rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+	writeMessage(pClientChannel, 0, 10);
+	readMessage(pServerChannel, 0, 10);
 
-	server = startupServer(RSSL_TRUE);
-	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+	/* messages written just before the close are still delivered */
+	writeMessage(pClientChannel, 1, 10);
+	rsslCloseChannel(pClientChannel, &err);
+	pClientChannel = NULL;
 
+	readMessage(pServerChannel, 1, 10);
+	EXPECT_EQ(readNext(pServerChannel, &readRet), (RsslBuffer*)NULL);
+	EXPECT_EQ(readRet, RSSL_RET_FAILURE);
+	EXPECT_EQ(pServerChannel->state, RSSL_CH_STATE_CLOSED);
+}
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		clientOpts[i].pThreadId = &clientThreads[i];
-		clientOpts[i].serverChannel = false;
-		clientOpts[i].msgCount = writeMsgs;
-		RSSL_THREAD_START(&clientThreads[i], blockingManyChannelWriteThread, (void*)&clientOpts[i]);
+/* Channels on a shared ring send nothing until it is submitted, and one submit sends for all of them */
+TEST_F(IoUringTests, SharedRingSubmitsAllChannelsAtOnce)
+{
+	RsslError err;
+	RsslRet ret;
 
-		serverOpts[i].pThreadId = &serverThreads[i];
-		serverOpts[i].serverChannel = true;
-		serverOpts[i].pServer = server;
-		serverOpts[i].lock = &readLock[i];
-		serverOpts[i].readCount = &(threadReadCount[i]);
-		RSSL_THREAD_START(&serverThreads[i], blockingManyChannelReadThread, (void*)&serverOpts[i]);
-	}
+	if (!uringAvailable)
+		return;
 
-	threadsCreated = true;
+	ASSERT_NE(pIoUring = rsslCreateIoUring(&err), (RsslIoUring*)NULL) << "Error text: " << err.text;
 
-	while (!shutdownTest && !failTest)
+	bind(RSSL_CONN_TYPE_SOCKET);
+	ASSERT_FALSE(HasFatalFailure());
+	for (int i = 0; i < MAX_PAIRS; ++i)
 	{
-		time_sleep(500);
-		threadsDone = 0;
-		for (i = 0; i < MAX_THREADS; i++)
-		{
-			RSSL_MUTEX_LOCK(&readLock[i]);
-			if (threadReadCount[i] == writeMsgs)
-				++threadsDone;
-			RSSL_MUTEX_UNLOCK(&readLock[i]);
-		}
+		connectPair(RSSL_CONN_TYPE_SOCKET, pIoUring, &pairClients[i], &pairServers[i]);
+		ASSERT_FALSE(HasFatalFailure());
+		EXPECT_TRUE(onRing(pairClients[i]));
+		EXPECT_TRUE(onRing(pairServers[i]));
+	}
 
-		if (threadsDone == MAX_THREADS)
+	for (RsslUInt32 round = 0; round < 100; ++round)
+	{
+		for (int i = 0; i < MAX_PAIRS; ++i)
 		{
-			shutdownTest = true;
+			ASSERT_GE(ret = writeOnly(pairClients[i], round * MAX_PAIRS + i, 100), RSSL_RET_SUCCESS);
+			ASSERT_EQ(rsslFlush(pairClients[i], &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 		}
-	}
 
-	ASSERT_FALSE(failTest) << "Test failed.";
+		/* taken by the channels, but still waiting for the submit */
+		if (round == 0)
+			EXPECT_FALSE(waitFor(pairServers[0], false, 50));
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		RSSL_THREAD_JOIN(serverThreads[i]);
-	}
+		ASSERT_EQ(rsslIoUringSubmit(pIoUring, &err), MAX_PAIRS) << "Error text: " << err.text;
+		EXPECT_EQ(rsslIoUringSubmit(pIoUring, &err), 0);
 
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		RSSL_THREAD_JOIN(clientThreads[i]);
+		for (int i = 0; i < MAX_PAIRS; ++i)
+		{
+			readMessage(pairServers[i], round * MAX_PAIRS + i, 100);
+			ASSERT_FALSE(HasFatalFailure());
+		}
 	}
-
-	rsslCloseServer(server, &err);
 }
 
-/*  Starts up a blocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
-	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
-TEST_F(ManyThreadConnectionTests, BlockingGlobalLockClientReadServerWrite)
+/* Writes gathered between submits go in one send, even when they fill the channel's send buffer */
+TEST_F(IoUringTests, SharedRingLargeBatches)
 {
+	const RsslUInt32 messageCount = 50;
+	RsslRet ret = RSSL_RET_SUCCESS;
+	RsslError err;
 
-	RsslServer* server = NULL;
-	int i;
-	int readMax = 0;
-	int threadsDone = 0;
-
-	rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+	if (!uringAvailable)
+		return;
 
-	server = startupServer(RSSL_TRUE);
-	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+	ASSERT_NE(pIoUring = rsslCreateIoUring(&err), (RsslIoUring*)NULL) << "Error text: " << err.text;
 
+	bind(RSSL_CONN_TYPE_SOCKET);
+	ASSERT_FALSE(HasFatalFailure());
+	connectPair(RSSL_CONN_TYPE_SOCKET, pIoUring, &pairClients[0], &pairServers[0]);
+	ASSERT_FALSE(HasFatalFailure());
 
-	for (i = 0; i < MAX_THREADS; i++)
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
 	{
-		clientOpts[i].pThreadId = &clientThreads[i];
-		clientOpts[i].serverChannel = false;
-		clientOpts[i].readCount = &(threadReadCount[i]);
-		clientOpts[i].lock = &readLock[i];
-		RSSL_THREAD_START(&clientThreads[i], blockingManyChannelReadThread, (void*)&clientOpts[i]);
-
-		serverOpts[i].pThreadId = &serverThreads[i];
-		serverOpts[i].serverChannel = true;
-		serverOpts[i].pServer = server;
-		serverOpts[i].msgCount = writeMsgs;
-		RSSL_THREAD_START(&serverThreads[i], blockingManyChannelWriteThread, (void*)&serverOpts[i]);
+		ASSERT_GE(ret = writeOnly(pairClients[0], seqNum, 6000), RSSL_RET_SUCCESS);
+		ASSERT_GE(ret = rsslFlush(pairClients[0], &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 	}
 
-	threadsCreated = true;
-
-	while (!shutdownTest && !failTest)
+	for (RsslUInt32 i = 0, tries = 0; i < messageCount && tries < 100000; ++tries)
 	{
-		time_sleep(500);
-		threadsDone = 0;
-		for (i = 0; i < MAX_THREADS; i++)
-		{
-			RSSL_MUTEX_LOCK(&readLock[i]);
-			if (threadReadCount[i] == writeMsgs)
-				++threadsDone;
-			RSSL_MUTEX_UNLOCK(&readLock[i]);
-		}
+		RsslBuffer *pBuffer;
+		RsslRet readRet;
 
-		if (threadsDone == MAX_THREADS)
+		ASSERT_GE(rsslIoUringSubmit(pIoUring, &err), 0) << "Error text: " << err.text;
+		if (ret > RSSL_RET_SUCCESS)
+			ASSERT_GE(ret = rsslFlush(pairClients[0], &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+
+		if ((pBuffer = rsslRead(pairServers[0], &readRet, &err)) != NULL)
 		{
-			shutdownTest = true;
+			ASSERT_EQ(pBuffer->length, 6000u) << "Message " << i;
+			for (RsslUInt32 j = 0; j < pBuffer->length; ++j)
+				ASSERT_EQ(pBuffer->data[j], (char)(i + j)) << "Message " << i << " differs at " << j;
+			++i;
 		}
+		else if (readRet == RSSL_RET_READ_WOULD_BLOCK)
+			waitFor(pairServers[0], false, 10);
+		else
+			ASSERT_TRUE(readRet >= RSSL_RET_SUCCESS || readRet == RSSL_RET_READ_PING) << "Read returned " << readRet;
 	}
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
-	
-	for (i = 0; i < MAX_THREADS; i++)
-	{
-		RSSL_THREAD_JOIN(serverThreads[i]);
-	}
+	EXPECT_EQ(ret, RSSL_RET_SUCCESS);
+}
 
-	for (i = 0; i < MAX_THREADS; i++)
+/* While the peer is not reading, the socket is not reported writable, so an application waiting
+ * to flush sleeps instead of spinning. */
+TEST_F(IoUringTests, SocketNotWritableWhileSendBlocked)
+{
+	RsslUInt32 seqNum = 0;
+	RsslRet ret = RSSL_RET_SUCCESS;
+	RsslError err;
+
+	connect(RSSL_CONN_TYPE_SOCKET);
+	ASSERT_FALSE(HasFatalFailure());
+	if (!uringAvailable)
+		return;
+
+	/* write until the channel holds data it cannot send */
+	while (ret == RSSL_RET_SUCCESS && seqNum < 100000)
 	{
-		RSSL_THREAD_JOIN(clientThreads[i]);
+		ASSERT_GE(ret = writeOnly(pServerChannel, seqNum++, 6000), RSSL_RET_SUCCESS);
+		if (ret == RSSL_RET_SUCCESS)
+			ASSERT_GE(ret = rsslFlush(pServerChannel, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 	}
+	ASSERT_GT(ret, RSSL_RET_SUCCESS);
 
-	rsslCloseServer(server, &err);
-}
+	EXPECT_FALSE(waitFor(pServerChannel, true, 200));
+	EXPECT_GT(rsslFlush(pServerChannel, &err), RSSL_RET_SUCCESS);
 
-/*  Starts up a blocking server, and then creates MAX_THREADS reader and MAX_THREADS writer threads.
-	Each thread creates a new RsslChannel and either reads or sends a message, then quits. */
-TEST_F(ManyThreadConnectionTests, BlockingGlobalLockClientWriteServerRead)
-{
+	/* once the client reads, everything goes out */
+	for (RsslUInt32 i = 0, tries = 0; i < seqNum && tries < 100000; ++tries)
+	{
+		RsslBuffer *pBuffer;
+		RsslRet readRet;
 
-	RsslServer* server = NULL;
-	int i;
-	int readMax = 0;
+		if (ret > RSSL_RET_SUCCESS)
+			ASSERT_GE(ret = rsslFlush(pServerChannel, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 
-	int threadsDone = 0;
+		if ((pBuffer = rsslRead(pClientChannel, &readRet, &err)) != NULL)
+		{
+			ASSERT_EQ(pBuffer->length, 6000u) << "Message " << i;
+			for (RsslUInt32 j = 0; j < pBuffer->length; ++j)
+				ASSERT_EQ(pBuffer->data[j], (char)(i + j)) << "Message " << i << " differs at " << j;
+			++i;
+		}
+		else if (readRet == RSSL_RET_READ_WOULD_BLOCK)
+			waitFor(pClientChannel, false, 10);
+		else
+			ASSERT_TRUE(readRet >= RSSL_RET_SUCCESS || readRet == RSSL_RET_READ_PING) << "Read returned " << readRet;
+	}
+	EXPECT_EQ(ret, RSSL_RET_SUCCESS);
+}
+#endif
 
-	rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+class AutoPackTests : public ::testing::Test {
+protected:
+	RsslServer *pServer;
+	RsslChannel *pServerChannel;
+	RsslChannel *pClientChannel;
 
-	server = startupServer(RSSL_TRUE);
-	ASSERT_NE(server, (RsslServer*)NULL) << "Server creation failed!";
+	virtual void SetUp()
+	{
+		RsslError err;
 
+		pServer = NULL;
+		pServerChannel = NULL;
+		pClientChannel = NULL;
+		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+	}
 
-	for (i = 0; i < MAX_THREADS; i++)
+	virtual void TearDown()
 	{
-		clientOpts[i].pThreadId = &clientThreads[i];
-		clientOpts[i].serverChannel = false;
-		clientOpts[i].msgCount = writeMsgs;
-		RSSL_THREAD_START(&clientThreads[i], blockingManyChannelWriteThread, (void*)&clientOpts[i]);
+		RsslError err;
 
-		serverOpts[i].pThreadId = &serverThreads[i];
-		serverOpts[i].serverChannel = true;
-		serverOpts[i].pServer = server;
-		serverOpts[i].lock = &readLock[i];
-		serverOpts[i].readCount = &(threadReadCount[i]);
-		RSSL_THREAD_START(&serverThreads[i], blockingManyChannelReadThread, (void*)&serverOpts[i]);
+		if (pClientChannel != NULL)
+			rsslCloseChannel(pClientChannel, &err);
+		if (pServerChannel != NULL)
+			rsslCloseChannel(pServerChannel, &err);
+		if (pServer != NULL)
+			rsslCloseServer(pServer, &err);
+		rsslUninitialize();
+		resetDeadlockTimer();
 	}
 
-	threadsCreated = true;
-
-	while (!shutdownTest && !failTest)
+	void connect(RsslConnectionTypes connType, RsslInt32 autoPackSize, RsslInt32 autoPackDelay)
 	{
-		time_sleep(500);
-		threadsDone = 0;
-		for (i = 0; i < MAX_THREADS; i++)
+		RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+		RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+		RsslAcceptOptions acceptOpts = RSSL_INIT_ACCEPT_OPTS;
+		RsslInProgInfo inProg;
+		RsslError err;
+
+		bindOpts.serviceName = (char*)"15102";
+		bindOpts.connectionType = RSSL_CONN_TYPE_SOCKET;
+		bindOpts.protocolType = TEST_PROTOCOL_TYPE;
+		bindOpts.tcpOpts.tcp_nodelay = RSSL_TRUE;
+		if (connType == RSSL_CONN_TYPE_WEBSOCKET)
+			bindOpts.wsOpts.protocols = (char*)"rssl.rwf";
+		pServer = rsslBind(&bindOpts, &err);
+		ASSERT_NE(pServer, (RsslServer*)NULL) << "rsslBind failed. Error text: " << err.text;
+
+		connectOpts.connectionType = connType;
+		connectOpts.connectionInfo.unified.address = (char*)"localhost";
+		connectOpts.connectionInfo.unified.serviceName = (char*)"15102";
+		connectOpts.protocolType = TEST_PROTOCOL_TYPE;
+		connectOpts.tcpOpts.tcp_nodelay = RSSL_TRUE;
+		if (connType == RSSL_CONN_TYPE_WEBSOCKET)
+			connectOpts.wsOpts.protocols = (char*)"rssl.rwf";
+		pClientChannel = rsslConnect(&connectOpts, &err);
+		ASSERT_NE(pClientChannel, (RsslChannel*)NULL) << "rsslConnect failed. Error text: " << err.text;
+
+		while ((pServerChannel = rsslAccept(pServer, &acceptOpts, &err)) == NULL)
+			time_sleep(1);
+		while (pClientChannel->state != RSSL_CH_STATE_ACTIVE || pServerChannel->state != RSSL_CH_STATE_ACTIVE)
 		{
-			RSSL_MUTEX_LOCK(&readLock[i]);
-			if (threadReadCount[i] == writeMsgs)
-				++threadsDone;
-			RSSL_MUTEX_UNLOCK(&readLock[i]);
+			if (pClientChannel->state != RSSL_CH_STATE_ACTIVE)
+				ASSERT_GE(rsslInitChannel(pClientChannel, &inProg, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+			if (pServerChannel->state != RSSL_CH_STATE_ACTIVE)
+				ASSERT_GE(rsslInitChannel(pServerChannel, &inProg, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 		}
 
-		if (threadsDone == MAX_THREADS)
+		if (connType == RSSL_CONN_TYPE_SOCKET)
 		{
-			shutdownTest = true;
+			ASSERT_EQ(rsslIoctl(pClientChannel, RSSL_AUTO_PACK_SIZE, &autoPackSize, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+			ASSERT_EQ(rsslIoctl(pClientChannel, RSSL_AUTO_PACK_DELAY, &autoPackDelay, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 		}
 	}
-	
-	ASSERT_FALSE(failTest) << "Test failed.";
 
-	for (i = 0; i < MAX_THREADS; i++)
+	/* Writes a message of length bytes whose contents depend on seqNum, without flushing */
+	void writeMessage(RsslUInt32 seqNum, RsslUInt32 length, RsslWritePriorities priority = RSSL_HIGH_PRIORITY)
 	{
-		RSSL_THREAD_JOIN(serverThreads[i]);
+		RsslBuffer *pBuffer;
+		RsslUInt32 bytesWritten, uncompBytesWritten;
+		RsslError err;
+
+		while ((pBuffer = rsslGetBuffer(pClientChannel, length, RSSL_FALSE, &err)) == NULL)
+		{
+			ASSERT_EQ(err.rsslErrorId, RSSL_RET_BUFFER_NO_BUFFERS) << "rsslGetBuffer failed. Error text: " << err.text;
+			ASSERT_GE(rsslFlush(pClientChannel, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+		}
+		for (RsslUInt32 i = 0; i < length; ++i)
+			pBuffer->data[i] = (char)(seqNum + i);
+		pBuffer->length = length;
+		ASSERT_GE(rsslWrite(pClientChannel, pBuffer, priority, 0, &bytesWritten, &uncompBytesWritten, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 	}
 
-	for (i = 0; i < MAX_THREADS; i++)
+	void flush()
 	{
-		RSSL_THREAD_JOIN(clientThreads[i]);
-	}
+		RsslRet ret;
+		RsslError err;
 
-	rsslCloseServer(server, &err);
-}
+		while ((ret = rsslFlush(pClientChannel, &err)) > RSSL_RET_SUCCESS)
+			;
+		ASSERT_EQ(ret, RSSL_RET_SUCCESS) << "Error text: " << err.text;
+	}
 
-/* Testing the host name validation functions */
+	/* Reads the next message on the server and checks it against writeMessage */
+	void readMessage(RsslUInt32 seqNum, RsslUInt32 length)
+	{
+		RsslBuffer *pBuffer;
+		RsslRet readRet;
+		RsslError err;
 
-TEST(OpenSSLHostNameValidation, HostNameValidation)
-{
-	char pattern[16];
-	char hostName[16];
-	RsslBool output = RSSL_TRUE;
-	RsslError err;
+		while ((pBuffer = rsslRead(pServerChannel, &readRet, &err)) == NULL)
+			ASSERT_NE(readRet, RSSL_RET_FAILURE) << "rsslRead failed. Error text: " << err.text;
+		ASSERT_EQ(pBuffer->length, length) << "Message " << seqNum;
+		for (RsslUInt32 i = 0; i < length; ++i)
+			ASSERT_EQ(pBuffer->data[i], (char)(seqNum + i)) << "Message " << seqNum << " differs at " << i;
+	}
 
-	/* No wildcard success */
-	strcpy(pattern, "www.foo.com");
-	strcpy(hostName, "www.foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_TRUE);
+	void getStats(RsslChannelStats *pStats)
+	{
+		RsslError err;
 
-	/* No wildcard failure */
-	strcpy(pattern, "www.foo.com");
-	strcpy(hostName, "www.bar.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+		ASSERT_EQ(rsslGetChannelStats(pClientChannel, pStats, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
+		ASSERT_TRUE(pStats->tcpStats.flags & RSSL_TCP_STATS_WRITE);
+	}
+};
 
-	/* Wildcard success */
-	strcpy(pattern, "*.foo.com");
-	strcpy(hostName, "www.foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_TRUE);
+TEST_F(AutoPackTests, SmallWritesShareBuffers)
+{
+	const RsslUInt32 messageCount = 1000;
+	RsslChannelStats stats;
 
-	/* Wildcard success, many tokens */
-	strcpy(pattern, "*.foo.bar.com");
-	strcpy(hostName, "www.foo.bar.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_TRUE);
+	connect(RSSL_CONN_TYPE_SOCKET, 6000, 0);
+	ASSERT_FALSE(HasFatalFailure());
 
-	/* Wildcard failure */
-	strcpy(pattern, "*.foo.com");
-	strcpy(hostName, "www.bar.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+	{
+		writeMessage(seqNum, 50);
+		ASSERT_FALSE(HasFatalFailure());
+	}
+	flush();
+	ASSERT_FALSE(HasFatalFailure());
 
-	/* Wildcard failure, additional tokens */
-	strcpy(pattern, "*.foo.com");
-	strcpy(hostName, "www.bar.foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+	{
+		readMessage(seqNum, 50);
+		ASSERT_FALSE(HasFatalFailure());
+	}
 
-	/* Wildcard failure, no leftmost token */
-	strcpy(pattern, "*.foo.com");
-	strcpy(hostName, "foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+	/* 52 bytes each, so about 115 messages to a 6000 byte buffer */
+	getStats(&stats);
+	ASSERT_FALSE(HasFatalFailure());
+	EXPECT_EQ(stats.tcpStats.autoPackedMsgCount, messageCount);
+	EXPECT_LE(stats.tcpStats.autoPackedBufferCount, messageCount / 100);
+	EXPECT_LT(stats.tcpStats.writeCallCount, stats.tcpStats.autoPackedMsgCount);
+}
 
-	/* Wildcard failure, no leftmost token */
-	strcpy(pattern, "*.foo.com");
-	strcpy(hostName, ".foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+TEST_F(AutoPackTests, LargerMessagesKeepOrder)
+{
+	const RsslUInt32 messageCount = 300;
+	RsslChannelStats stats;
+	RsslUInt32 packedCount = 0;
 
-	/* Wildcard parse failure, too broad of a wildcard */
-	strcpy(pattern, "*.com");
-	strcpy(hostName, "foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+	connect(RSSL_CONN_TYPE_SOCKET, 1000, 0);
+	ASSERT_FALSE(HasFatalFailure());
 
-	/* Wildcard parse failure, partial wildcard */
-	strcpy(pattern, "a*.foo.com");
-	strcpy(hostName, "a.foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+	/* messages that do not fit go out after what was packed before them */
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+	{
+		RsslUInt32 length = (seqNum % 50 == 49) ? 20000 : (seqNum % 7 == 6) ? 3000 : 1 + seqNum % 200;
 
-	/* Wildcard parse failure, partial wildcard */
-	strcpy(pattern, "*a.foo.com");
-	strcpy(hostName, "a.foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+		if (length + 2 <= 1000)
+			++packedCount;
+		writeMessage(seqNum, length);
+		ASSERT_FALSE(HasFatalFailure());
+		if (seqNum % 20 == 19)
+		{
+			flush();
+			ASSERT_FALSE(HasFatalFailure());
+		}
+	}
+	flush();
+	ASSERT_FALSE(HasFatalFailure());
 
-	/* Wildcard parse failure, partial wildcard */
-	strcpy(pattern, "b*r.foo.com");
-	strcpy(hostName, "bar.foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+	for (RsslUInt32 seqNum = 0; seqNum < messageCount; ++seqNum)
+	{
+		readMessage(seqNum, (seqNum % 50 == 49) ? 20000 : (seqNum % 7 == 6) ? 3000 : 1 + seqNum % 200);
+		ASSERT_FALSE(HasFatalFailure());
+	}
 
-	/* Wildcard parse failure, non-first wildcard */
-	strcpy(pattern, "bar.*.com");
-	strcpy(hostName, "bar.foo.com");
-	output = ripcVerifyCertHost(pattern, (unsigned int)strlen(pattern), hostName, &err);
-	EXPECT_TRUE(output == RSSL_FALSE);
+	getStats(&stats);
+	ASSERT_FALSE(HasFatalFailure());
+	EXPECT_EQ(stats.tcpStats.autoPackedMsgCount, packedCount);
 }
 
+TEST_F(AutoPackTests, DelayClosesBuffer)
+{
+	RsslChannelStats stats;
+
+	connect(RSSL_CONN_TYPE_SOCKET, 6000, 1000);
+	ASSERT_FALSE(HasFatalFailure());
+
+	writeMessage(0, 10);
+	writeMessage(1, 10);
+	ASSERT_FALSE(HasFatalFailure());
+	getStats(&stats);
+	EXPECT_EQ(stats.tcpStats.autoPackedBufferCount, 0U);
+
+	/* the open buffer is older than the delay, so the next write sends it on */
+	time_sleep(5);
+	writeMessage(2, 10);
+	ASSERT_FALSE(HasFatalFailure());
+	getStats(&stats);
+	EXPECT_EQ(stats.tcpStats.autoPackedBufferCount, 1U);
+	EXPECT_EQ(stats.tcpStats.autoPackedMsgCount, 2U);
+	EXPECT_GE(stats.tcpStats.autoPackDelayUsec, 2 * 1000U);
+
+	flush();
+	ASSERT_FALSE(HasFatalFailure());
+	for (RsslUInt32 seqNum = 0; seqNum < 3; ++seqNum)
+		readMessage(seqNum, 10);
+}
 
-class BindSharedServerSocketOpt : public ::testing::Test {
-protected:
-	RsslServer* pServer;
+TEST_F(AutoPackTests, InvalidSettingsRejected)
+{
+	RsslInt32 value = -1;
+	RsslError err;
 
-	virtual void SetUp()
+	connect(RSSL_CONN_TYPE_SOCKET, 0, 0);
+	ASSERT_FALSE(HasFatalFailure());
+	EXPECT_EQ(rsslIoctl(pClientChannel, RSSL_AUTO_PACK_SIZE, &value, &err), RSSL_RET_FAILURE);
+	EXPECT_EQ(rsslIoctl(pClientChannel, RSSL_AUTO_PACK_DELAY, &value, &err), RSSL_RET_FAILURE);
+	TearDown();
+	SetUp();
+
+	/* WebSocket frames are built by rsslWrite, so they are not auto-packed */
+	connect(RSSL_CONN_TYPE_WEBSOCKET, 0, 0);
+	ASSERT_FALSE(HasFatalFailure());
+	value = 6000;
+	EXPECT_EQ(rsslIoctl(pClientChannel, RSSL_AUTO_PACK_SIZE, &value, &err), RSSL_RET_FAILURE);
+}
+
+class FlushQuantaTests : public AutoPackTests {
+protected:
+	/* Connects without auto-packing, and keeps rsslWrite from flushing so that only the scheduler orders the queued messages */
+	void connectAndQueue()
 	{
+		RsslInt32 highWaterMark = 1000000;
 		RsslError err;
 
-		pServer = NULL;
-
-		rsslInitialize(RSSL_LOCK_GLOBAL, &err);
+		connect(RSSL_CONN_TYPE_SOCKET, 0, 0);
+		ASSERT_FALSE(HasFatalFailure());
+		ASSERT_EQ(rsslIoctl(pClientChannel, RSSL_HIGH_WATER_MARK, &highWaterMark, &err), RSSL_RET_SUCCESS) << "Error text: " << err.text;
 	}
 
-	virtual void TearDown()
+	RsslRet setQuanta(RsslUInt32 high, RsslUInt32 medium, RsslUInt32 low)
 	{
+		RsslUInt32 quanta[3] = { high, medium, low };
 		RsslError err;
-		rsslCloseServer(pServer, &err);
-		rsslUninitialize();
-		pServer = NULL;
+
+		return rsslIoctl(pClientChannel, RSSL_PRIORITY_FLUSH_QUANTA, quanta, &err);
 	}
 
-	void runRsslBind(RsslBindOptions& bindOpts)
+	/* Reads the next 1000 byte message, where high priority messages have even sequence numbers and low priority ones odd,
+	 * and checks that it is the next one of its priority */
+	void readEither(RsslUInt32 &nextHigh, RsslUInt32 &nextLow, bool &isHigh)
 	{
+		RsslBuffer *pBuffer;
+		RsslRet readRet;
 		RsslError err;
 
-		bindOpts.serviceName = (char*)"15000";
-		bindOpts.protocolType = TEST_PROTOCOL_TYPE;  /* These tests are just sending a pre-set string across the wire, so protocol type should not be RWF */
+		while ((pBuffer = rsslRead(pServerChannel, &readRet, &err)) == NULL)
+			ASSERT_NE(readRet, RSSL_RET_FAILURE) << "rsslRead failed. Error text: " << err.text;
+		ASSERT_EQ(pBuffer->length, 1000U);
+		isHigh = (pBuffer->data[0] == (char)nextHigh);
+		if (!isHigh)
+			ASSERT_EQ(pBuffer->data[0], (char)nextLow);
+		for (RsslUInt32 i = 0; i < pBuffer->length; ++i)
+			ASSERT_EQ(pBuffer->data[i], (char)((isHigh ? nextHigh : nextLow) + i));
+		(isHigh ? nextHigh : nextLow) += 2;
+	}
+};
 
-		pServer = rsslBind(&bindOpts, &err);
+TEST_F(FlushQuantaTests, EqualQuantaShareEvenly)
+{
+	RsslChannelStats stats;
+	RsslUInt32 nextHigh = 0, nextLow = 1;
 
-		ASSERT_NE(pServer, (RsslServer*)NULL) << "Server creation failed!";
-		ASSERT_NE(pServer->socketId, 0) << "The server socket should be not Null";
+	connectAndQueue();
+	ASSERT_FALSE(HasFatalFailure());
+	ASSERT_EQ(setQuanta(1200, 1200, 1200), RSSL_RET_SUCCESS);
+
+	/* the default "HMHLHM" order would send three high priority messages for each low one */
+	for (RsslUInt32 seqNum = 0; seqNum < 20; seqNum += 2)
+	{
+		writeMessage(seqNum + 1, 1000, RSSL_LOW_PRIORITY);
+		writeMessage(seqNum, 1000, RSSL_HIGH_PRIORITY);
+		ASSERT_FALSE(HasFatalFailure());
 	}
 
-	void testSocketOpt(int optname, bool isExpectedResultTrue, const char* sockOptName)
+	getStats(&stats);
+	ASSERT_FALSE(HasFatalFailure());
+	ASSERT_TRUE(stats.tcpStats.flags & RSSL_TCP_STATS_PRIORITY_QUEUES);
+	EXPECT_GE(stats.tcpStats.priorityQueuedBytes[RSSL_HIGH_PRIORITY], 10 * 1000U);
+	EXPECT_EQ(stats.tcpStats.priorityQueuedBytes[RSSL_MEDIUM_PRIORITY], 0U);
+	EXPECT_GE(stats.tcpStats.priorityQueuedBytes[RSSL_LOW_PRIORITY], 10 * 1000U);
+
+	flush();
+	ASSERT_FALSE(HasFatalFailure());
+	for (RsslUInt32 i = 0; i < 20; ++i)
 	{
-		int optVal;
-		socklen_t lenVal = sizeof(int);
-		int iResult = getsockopt(pServer->socketId, SOL_SOCKET, optname, (char*)&optVal, &lenVal);
-		ASSERT_EQ(iResult, 0) << "getsockopt " << sockOptName << ":  failed";
-		ASSERT_EQ(lenVal, sizeof(int)) << "getsockopt " << sockOptName << ":  invalid length = " << lenVal;
+		bool isHigh;
 
-		if (isExpectedResultTrue) {
-			EXPECT_NE(optVal, 0) << "getsockopt " << sockOptName << ": should be True";
-		}
-		else {
-			EXPECT_EQ(optVal, 0) << "getsockopt " << sockOptName << ": should be False";
-		}
+		/* neither queue gets more than a message ahead */
+		readEither(nextHigh, nextLow, isHigh);
+		ASSERT_FALSE(HasFatalFailure());
+		ASSERT_LE(nextHigh > nextLow ? nextHigh - nextLow : nextLow - nextHigh, 3U) << "Message " << i;
 	}
-};
 
-/* Testing setup of the socket options for server call Bind */
-#if defined(_WIN32) || defined(SO_REUSEPORT)
-TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenDefaultInitValues)
+	getStats(&stats);
+	ASSERT_FALSE(HasFatalFailure());
+	EXPECT_EQ(stats.tcpStats.priorityQueuedBytes[RSSL_HIGH_PRIORITY], 0U);
+	EXPECT_EQ(stats.tcpStats.priorityQueuedBytes[RSSL_LOW_PRIORITY], 0U);
+	EXPECT_EQ(stats.tcpStats.priorityFlushedBufferCount[RSSL_HIGH_PRIORITY], 10U);
+	EXPECT_EQ(stats.tcpStats.priorityFlushedBufferCount[RSSL_LOW_PRIORITY], 10U);
+	EXPECT_LE(stats.tcpStats.priorityMaxQueueDelayUsec[RSSL_LOW_PRIORITY], stats.tcpStats.priorityQueueDelayUsec[RSSL_LOW_PRIORITY]);
+}
+
+TEST_F(FlushQuantaTests, QuantaShareBandwidth)
 {
-	// Tests default init-values
-	RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+	RsslUInt32 lowCount = 0;
+	RsslUInt32 nextHigh = 0, nextLow = 1;
 
-	runRsslBind(bindOpts);
+	connectAndQueue();
+	ASSERT_FALSE(HasFatalFailure());
+	ASSERT_EQ(setQuanta(1000, 1000, 4000), RSSL_RET_SUCCESS);
 
-	// Tests the socket options: the server socket does not permit sharing
-#if defined(_WIN32)
-	testSocketOpt(SO_REUSEADDR,			false,	"SO_REUSEADDR");
-	testSocketOpt(SO_EXCLUSIVEADDRUSE,	true,	"SO_EXCLUSIVEADDRUSE");
-#else  // Linux
-	testSocketOpt(SO_REUSEADDR,			true,	"SO_REUSEADDR");
-	testSocketOpt(SO_REUSEPORT,			false,	"SO_REUSEPORT");
-#endif
+	for (RsslUInt32 seqNum = 0; seqNum < 40; seqNum += 2)
+	{
+		writeMessage(seqNum, 1000, RSSL_HIGH_PRIORITY);
+		writeMessage(seqNum + 1, 1000, RSSL_LOW_PRIORITY);
+		ASSERT_FALSE(HasFatalFailure());
+	}
+	flush();
+	ASSERT_FALSE(HasFatalFailure());
+
+	/* low priority has four times the quantum, so it gets about four times the bytes while both queues have data */
+	for (RsslUInt32 i = 0; i < 40; ++i)
+	{
+		bool isHigh;
+
+		readEither(nextHigh, nextLow, isHigh);
+		ASSERT_FALSE(HasFatalFailure());
+		if (!isHigh && i < 10)
+			++lowCount;
+	}
+	EXPECT_GE(lowCount, 7U);
 }
 
-TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenClearBindOpts)
+TEST_F(FlushQuantaTests, LargeMessagesNeedSeveralRounds)
 {
-	// Tests rsslClearBindOpts
-	RsslBindOptions bindOpts;
-	rsslClearBindOpts(&bindOpts);
-
-	runRsslBind(bindOpts);
+	connectAndQueue();
+	ASSERT_FALSE(HasFatalFailure());
+	ASSERT_EQ(setQuanta(100, 100, 400), RSSL_RET_SUCCESS);
+
+	/* neither queue can send in the first round, and low priority gets there first */
+	writeMessage(0, 1000, RSSL_HIGH_PRIORITY);
+	writeMessage(1, 1000, RSSL_LOW_PRIORITY);
+	writeMessage(2, 1000, RSSL_HIGH_PRIORITY);
+	writeMessage(3, 1000, RSSL_LOW_PRIORITY);
+	ASSERT_FALSE(HasFatalFailure());
+	flush();
+	ASSERT_FALSE(HasFatalFailure());
+
+	readMessage(1, 1000);
+	readMessage(3, 1000);
+	readMessage(0, 1000);
+	readMessage(2, 1000);
+}
 
-	// Tests the socket options: the server socket does not permit sharing
-#if defined(_WIN32)
-	testSocketOpt(SO_REUSEADDR, false, "SO_REUSEADDR");
-	testSocketOpt(SO_EXCLUSIVEADDRUSE, true, "SO_EXCLUSIVEADDRUSE");
-#else  // Linux
-	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
-	testSocketOpt(SO_REUSEPORT, false, "SO_REUSEPORT");
-#endif
+TEST_F(FlushQuantaTests, InvalidQuantaRejected)
+{
+	connectAndQueue();
+	ASSERT_FALSE(HasFatalFailure());
+	EXPECT_EQ(setQuanta(1000, 0, 1000), RSSL_RET_FAILURE);
+	EXPECT_EQ(setQuanta(1000, 1000, 1000), RSSL_RET_SUCCESS);
+
+	/* all zeros goes back to the flush order */
+	EXPECT_EQ(setQuanta(0, 0, 0), RSSL_RET_SUCCESS);
+	writeMessage(0, 10, RSSL_HIGH_PRIORITY);
+	ASSERT_FALSE(HasFatalFailure());
+	flush();
+	ASSERT_FALSE(HasFatalFailure());
+	readMessage(0, 10);
 }
 
-TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenSetFalse)
+/* Tests of A/B line arbitration for sequenced multicast channels. */
+class SeqMcastArbTests : public ::testing::Test {
+protected:
+	RsslSeqMcastArb arb;
+
+	virtual void SetUp()
+	{
+		rsslSeqMcastArbClear(&arb);
+	}
+
+	/* Passes seqNum through the arbiter once for each line in lines, such as "AB", and returns
+	 * which copies were delivered, such as "A-" */
+	std::string arbitrate(const char *lines, RsslUInt32 seqNum)
+	{
+		std::string delivered;
+
+		for (const char *line = lines; *line; ++line)
+		{
+			RsslUInt32 lineIndex = (*line == 'A' ? RSSL_SEQ_MCAST_LINE_A : RSSL_SEQ_MCAST_LINE_B);
+			delivered += (rsslSeqMcastArbitrate(&arb, lineIndex, seqNum) ? *line : '-');
+		}
+
+		return delivered;
+	}
+
+	void expectStats(RsslUInt32 lineIndex, RsslUInt64 wins, RsslUInt64 losses, RsslUInt64 gaps)
+	{
+		EXPECT_EQ(arb.lines[lineIndex].stats.wins, wins) << "Line " << lineIndex;
+		EXPECT_EQ(arb.lines[lineIndex].stats.losses, losses) << "Line " << lineIndex;
+		EXPECT_EQ(arb.lines[lineIndex].stats.gaps, gaps) << "Line " << lineIndex;
+	}
+};
+
+TEST_F(SeqMcastArbTests, DuplicatesDropped)
 {
-	// Tests serverSharedSocket off
-	RsslBindOptions bindOpts;
-	rsslClearBindOpts(&bindOpts);
-	bindOpts.serverSharedSocket = RSSL_FALSE;
+	EXPECT_EQ(arbitrate("AB", 1), "A-");
+	EXPECT_EQ(arbitrate("BA", 2), "B-");
 
-	runRsslBind(bindOpts);
+	/* a copy repeated on the same line */
+	EXPECT_EQ(arbitrate("AA", 3), "A-");
+	EXPECT_EQ(arbitrate("B", 3), "-");
 
-	// Tests the socket options: the server socket does not permit sharing
-#if defined(_WIN32)
-	testSocketOpt(SO_REUSEADDR, false, "SO_REUSEADDR");
-	testSocketOpt(SO_EXCLUSIVEADDRUSE, true, "SO_EXCLUSIVEADDRUSE");
-#else  // Linux
-	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
-	testSocketOpt(SO_REUSEPORT, false, "SO_REUSEPORT");
-#endif
+	expectStats(RSSL_SEQ_MCAST_LINE_A, 2, 2, 0);
+	expectStats(RSSL_SEQ_MCAST_LINE_B, 1, 2, 0);
+	EXPECT_EQ(arb.gaps, 0u);
 }
 
-TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOnWhenSetTrue)
+TEST_F(SeqMcastArbTests, OutOfOrderWithinWindow)
 {
-	// Tests serverSharedSocket on
-	RsslBindOptions bindOpts;
-	rsslClearBindOpts(&bindOpts);
-	bindOpts.serverSharedSocket = RSSL_TRUE;
+	EXPECT_EQ(arbitrate("A", 10), "A");
+	EXPECT_EQ(arbitrate("A", 13), "A");
 
-	runRsslBind(bindOpts);
+	/* 11 and 12 are still in the window, so whichever line has them first delivers them */
+	EXPECT_EQ(arbitrate("B", 12), "B");
+	EXPECT_EQ(arbitrate("BA", 11), "B-");
+	EXPECT_EQ(arbitrate("A", 12), "-");
 
-	// Tests the socket options: the server socket permits sharing
-#if defined(_WIN32)
-	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
-	testSocketOpt(SO_EXCLUSIVEADDRUSE, false, "SO_EXCLUSIVEADDRUSE");
-#else  // Linux
-	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
-	testSocketOpt(SO_REUSEPORT, true, "SO_REUSEPORT");
-#endif
-}
+	/* the oldest sequence number the window remembers */
+	EXPECT_EQ(arbitrate("A", 14 + RSSL_SEQ_MCAST_ARB_WINDOW - 1), "A");
+	EXPECT_EQ(arbitrate("B", 14), "B");
 
-#else  // Linux && !defined(SO_REUSEPORT)  // LUP - Linux Unsopported SO_REUSEPORT
+	expectStats(RSSL_SEQ_MCAST_LINE_A, 3, 2, 2 + RSSL_SEQ_MCAST_ARB_WINDOW - 1);
+	expectStats(RSSL_SEQ_MCAST_LINE_B, 3, 0, 1);
+	EXPECT_EQ(arb.gaps, 0u);
+}
 
-TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenDefaultInitValuesLUP)
+TEST_F(SeqMcastArbTests, TooOldDropped)
 {
-	// Tests default init-values
-	RsslBindOptions bindOpts = RSSL_INIT_BIND_OPTS;
+	EXPECT_EQ(arbitrate("A", 100), "A");
 
-	runRsslBind(bindOpts);
+	/* just out of the window, so it cannot be told from a copy that was delivered */
+	EXPECT_EQ(arbitrate("B", 100 - RSSL_SEQ_MCAST_ARB_WINDOW), "-");
+	EXPECT_EQ(arbitrate("B", 101 - RSSL_SEQ_MCAST_ARB_WINDOW), "B");
 
-	// Tests the socket options: the server socket does not permit sharing
-	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+	expectStats(RSSL_SEQ_MCAST_LINE_A, 1, 0, 0);
+	expectStats(RSSL_SEQ_MCAST_LINE_B, 1, 1, 0);
 }
 
-TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenClearBindOptsLUP)
+TEST_F(SeqMcastArbTests, GapLargerThanWindow)
 {
-	// Tests rsslClearBindOpts
-	RsslBindOptions bindOpts;
-	rsslClearBindOpts(&bindOpts);
+	EXPECT_EQ(arbitrate("A", 1), "A");
+	EXPECT_EQ(arbitrate("A", 200), "A");
 
-	runRsslBind(bindOpts);
+	/* 2 to 200 - RSSL_SEQ_MCAST_ARB_WINDOW left the window at once */
+	EXPECT_EQ(arb.gaps, (RsslUInt64)(199 - RSSL_SEQ_MCAST_ARB_WINDOW));
+	EXPECT_EQ(arbitrate("B", 150), "B");
+	EXPECT_EQ(arbitrate("B", 100), "-");
 
-	// Tests the socket options: the server socket does not permit sharing
-	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+	/* the rest of 137 to 199, except 150, leave the window now, as do 201 to 236 */
+	EXPECT_EQ(arbitrate("A", 300), "A");
+	EXPECT_EQ(arb.gaps, (RsslUInt64)(199 - RSSL_SEQ_MCAST_ARB_WINDOW + 62 + 36));
+
+	expectStats(RSSL_SEQ_MCAST_LINE_A, 3, 0, 198 + 99);
+	expectStats(RSSL_SEQ_MCAST_LINE_B, 1, 1, 0);
 }
 
-TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeOffWhenSetFalseLUP)
+TEST_F(SeqMcastArbTests, SequenceWrap)
 {
-	// Tests serverSharedSocket off
-	RsslBindOptions bindOpts;
-	rsslClearBindOpts(&bindOpts);
-	bindOpts.serverSharedSocket = RSSL_FALSE;
+	EXPECT_EQ(arbitrate("AB", 0xFFFFFFFE), "A-");
+	EXPECT_EQ(arbitrate("BA", 0xFFFFFFFF), "B-");
+	EXPECT_EQ(arbitrate("AB", 0), "A-");
+	EXPECT_EQ(arbitrate("A", 2), "A");
+	EXPECT_EQ(arbitrate("BA", 1), "B-");
+	EXPECT_EQ(arbitrate("B", 0xFFFFFFFF), "-");
+
+	expectStats(RSSL_SEQ_MCAST_LINE_A, 3, 2, 1);
+	expectStats(RSSL_SEQ_MCAST_LINE_B, 2, 3, 0);
+	EXPECT_EQ(arb.lines[RSSL_SEQ_MCAST_LINE_A].restartCount, 0u);
+	EXPECT_EQ(arb.lines[RSSL_SEQ_MCAST_LINE_B].restartCount, 0u);
+	EXPECT_EQ(arb.gaps, 0u);
+}
 
-	runRsslBind(bindOpts);
+TEST_F(SeqMcastArbTests, PublisherRestart)
+{
+	EXPECT_EQ(arbitrate("AB", 1000), "A-");
+	EXPECT_EQ(arbitrate("AB", 1001), "A-");
+
+	/* the A line shows the restart first, so the B line's old sequence is dropped */
+	EXPECT_EQ(arbitrate("A", 1), "A");
+	EXPECT_EQ(arbitrate("B", 1002), "-");
+	EXPECT_EQ(arbitrate("A", 2), "A");
+
+	/* then the B line shows it too, and both lines are arbitrated again */
+	EXPECT_EQ(arbitrate("B", 1), "-");
+	EXPECT_EQ(arbitrate("B", 2), "-");
+	EXPECT_EQ(arbitrate("BA", 3), "B-");
+	EXPECT_EQ(arbitrate("AB", 4), "A-");
+
+	EXPECT_EQ(arb.lines[RSSL_SEQ_MCAST_LINE_A].restartCount, 1u);
+	EXPECT_EQ(arb.lines[RSSL_SEQ_MCAST_LINE_B].restartCount, 1u);
+	expectStats(RSSL_SEQ_MCAST_LINE_A, 5, 1, 0);
+	expectStats(RSSL_SEQ_MCAST_LINE_B, 1, 6, 0);
+	EXPECT_EQ(arb.gaps, 0u);
+
+	/* a restart on both lines, B first this time; a restart is only seen once the sequence
+	 * falls a full window behind what the line carried */
+	EXPECT_EQ(arbitrate("AB", 500), "A-");
+	EXPECT_EQ(arbitrate("BA", 1), "B-");
+	EXPECT_EQ(arbitrate("AB", 2), "A-");
+	EXPECT_EQ(arb.restartCount, 2u);
+}
 
-	// Tests the socket options: the server socket does not permit sharing
-	testSocketOpt(SO_REUSEADDR, true, "SO_REUSEADDR");
+TEST_F(SeqMcastArbTests, LineStartsAfterRestart)
+{
+	EXPECT_EQ(arbitrate("A", 1000), "A");
+	EXPECT_EQ(arbitrate("A", 1), "A");
+
+	/* the B line never carried the old sequence, so it is already on the new one */
+	EXPECT_EQ(arbitrate("B", 2), "B");
+	EXPECT_EQ(arbitrate("AB", 3), "A-");
+
+	expectStats(RSSL_SEQ_MCAST_LINE_A, 3, 0, 1);
+	expectStats(RSSL_SEQ_MCAST_LINE_B, 1, 1, 0);
 }
 
-TEST_F(BindSharedServerSocketOpt, ServerSharedSocketShouldBeErrorOnRsslBindLUP)
+#if defined(__linux__)
+/* Tests the line statistics an arbitrated channel reports, with datagrams sent to both of its multicast groups. */
+class SeqMcastChannelTests : public ::testing::Test {
+protected:
+	RsslChannel *pChannel;
+	RsslSocket sendSock;
+
+	virtual void SetUp()
+	{
+		RsslError err;
+
+		pChannel = NULL;
+		sendSock = RSSL_INVALID_SOCKET;
+		rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &err);
+	}
+
+	virtual void TearDown()
+	{
+		RsslError err;
+
+		if (pChannel != NULL)
+			rsslCloseChannel(pChannel, &err);
+		if (sendSock != RSSL_INVALID_SOCKET)
+			close(sendSock);
+		rsslUninitialize();
+		resetDeadlockTimer();
+	}
+
+	/* Sends a data datagram with seqNum to a line's group, carrying a message with seqNum as its content */
+	void send(const char *group, RsslUInt16 port, RsslUInt32 seqNum)
+	{
+		struct sockaddr_in addr;
+		char datagram[18];
+
+		datagram[0] = 1;						/* version */
+		datagram[1] = 0;						/* flags */
+		datagram[2] = TEST_PROTOCOL_TYPE;
+		datagram[3] = 12;						/* header length */
+		datagram[4] = datagram[5] = 0;			/* instance id */
+		datagram[6] = datagram[7] = 0;			/* protocol version */
+		datagram[8] = (char)(seqNum >> 24);
+		datagram[9] = (char)(seqNum >> 16);
+		datagram[10] = (char)(seqNum >> 8);
+		datagram[11] = (char)seqNum;
+		datagram[12] = 0;						/* message length */
+		datagram[13] = 4;
+		memcpy(datagram + 14, datagram + 8, 4);
+
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = inet_addr(group);
+		addr.sin_port = htons(port);
+		ASSERT_EQ(sendto(sendSock, datagram, sizeof(datagram), 0, (struct sockaddr*)&addr, sizeof(addr)), (ssize_t)sizeof(datagram));
+	}
+};
+
+TEST_F(SeqMcastChannelTests, LineStats)
 {
-	// Tests serverSharedSocket on
-	RsslBindOptions bindOpts;
+	RsslConnectOptions connectOpts = RSSL_INIT_CONNECT_OPTS;
+	RsslChannelInfo channelInfo;
 	RsslError err;
-	rsslClearBindOpts(&bindOpts);
-	bindOpts.serverSharedSocket = RSSL_TRUE;
-
-	bindOpts.serviceName = (char*)"15000";
-	bindOpts.protocolType = TEST_PROTOCOL_TYPE;  /* These tests are just sending a pre-set string across the wire, so protocol type should not be RWF */
+	RsslBuffer *pBuffer;
+	RsslRet ret;
+	unsigned char loop = 1;
+	std::string delivered;
+	int idleReads = 0;
+
+	connectOpts.connectionType = RSSL_CONN_TYPE_SEQ_MCAST;
+	connectOpts.connectionInfo.unified.address = (char*)"239.255.18.1";
+	connectOpts.connectionInfo.unified.serviceName = (char*)"16018";
+	connectOpts.seqMulticastOpts.lineBAddress = (char*)"239.255.18.2";
+	connectOpts.seqMulticastOpts.lineBServiceName = (char*)"16019";
+	connectOpts.seqMulticastOpts.readBatchSize = 16;
+	connectOpts.protocolType = TEST_PROTOCOL_TYPE;
+	connectOpts.blocking = RSSL_FALSE;
+	pChannel = rsslConnect(&connectOpts, &err);
+	ASSERT_NE(pChannel, (RsslChannel*)NULL) << "rsslConnect failed. Error text: " << err.text;
+
+	ASSERT_NE(sendSock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP), RSSL_INVALID_SOCKET);
+	ASSERT_EQ(setsockopt(sendSock, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)), 0);
+
+	/* the A line skips 4, which the B line has; both are queued before the channel reads, so the A line is read first */
+	send("239.255.18.1", 16018, 1);
+	send("239.255.18.1", 16018, 2);
+	send("239.255.18.1", 16018, 3);
+	send("239.255.18.1", 16018, 5);
+	for (RsslUInt32 seqNum = 1; seqNum <= 5; ++seqNum)
+		send("239.255.18.2", 16019, seqNum);
+	time_sleep(100);
+
+	while (idleReads < 20)
+	{
+		if ((pBuffer = rsslRead(pChannel, &ret, &err)) != NULL)
+		{
+			ASSERT_EQ(pBuffer->length, 4u);
+			delivered += (char)('0' + (unsigned char)pBuffer->data[3]);
+			idleReads = 0;
+		}
+		else
+		{
+			ASSERT_TRUE(ret >= RSSL_RET_SUCCESS || ret == RSSL_RET_READ_WOULD_BLOCK) << "rsslRead failed. Error text: " << err.text;
+			if (ret == RSSL_RET_READ_WOULD_BLOCK)
+			{
+				++idleReads;
+				time_sleep(10);
+			}
+		}
+	}
 
-	// Tests rsslBind returns NULL because SO_REUSEPORT option is unsupported
-	pServer = rsslBind(&bindOpts, &err);
+	/* the network may not route multicast back to this host */
+	if (delivered.empty())
+	{
+		std::cout << "No multicast datagrams were received; skipping the line statistics checks." << std::endl;
+		return;
+	}
 
-	ASSERT_EQ(pServer, (RsslServer*)NULL) << "rsslBind should return NULL when required set unsupported option SO_REUSEPORT";
-	ASSERT_EQ(err.rsslErrorId, RSSL_RET_FAILURE) << "Error ccode should set to General Failure";
-	ASSERT_EQ(err.sysError, 0) << "SysError should be equal to 0";
+	EXPECT_EQ(delivered, "12354");
+
+	ASSERT_EQ(rsslGetChannelInfo(pChannel, &channelInfo, &err), RSSL_RET_SUCCESS) << "rsslGetChannelInfo failed. Error text: " << err.text;
+	EXPECT_EQ(channelInfo.seqMcastLineStats[RSSL_SEQ_MCAST_LINE_A].pktsRcvd, 4u);
+	EXPECT_EQ(channelInfo.seqMcastLineStats[RSSL_SEQ_MCAST_LINE_A].wins, 4u);
+	EXPECT_EQ(channelInfo.seqMcastLineStats[RSSL_SEQ_MCAST_LINE_A].losses, 0u);
+	EXPECT_EQ(channelInfo.seqMcastLineStats[RSSL_SEQ_MCAST_LINE_A].gaps, 1u);
+	EXPECT_EQ(channelInfo.seqMcastLineStats[RSSL_SEQ_MCAST_LINE_B].pktsRcvd, 5u);
+	EXPECT_EQ(channelInfo.seqMcastLineStats[RSSL_SEQ_MCAST_LINE_B].wins, 1u);
+	EXPECT_EQ(channelInfo.seqMcastLineStats[RSSL_SEQ_MCAST_LINE_B].losses, 4u);
+	EXPECT_EQ(channelInfo.seqMcastLineStats[RSSL_SEQ_MCAST_LINE_B].gaps, 0u);
+	EXPECT_EQ(channelInfo.multicastStats.gapsDetected, 0u);
 }
-
 #endif
 
-
 int main(int argc, char* argv[])
 {
 	int ret;
@@ -0,0 +1,802 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/************************************************************************
+ *	Payload Cache Unit Test
+ *
+ *  Unit testing for the ETA Value Add payload cache.
+ *  Includes a (disabled) apply/retrieve benchmark.
+ *
+ /**********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslGetTime.h"
+#include "rtr/rsslPayloadCache.h"
+#include "rtr/rsslPayloadEntry.h"
+#include "rtr/rsslPayloadCursor.h"
+
+#define FID_DSPLY_NAME	3
+#define FID_TRDPRC_1	6
+#define FID_BID			22
+#define FID_ASK			25
+#define FID_ACVOL_1		32
+#define FID_ORDER_PRC	3427
+#define FID_ORDER_SIDE	3428
+#define FID_ORDER_SIZE	3429
+#define FID_UNKNOWN		9999
+
+static const char fieldDictionaryText[] =
+	"!tag Filename  RWF.DAT\n"
+	"!tag Desc      RDFD RWF field set\n"
+	"!tag Type      1\n"
+	"!tag Version   4.00.11\n"
+	"!tag Build     002\n"
+	"!tag Date      17-Sep-2010\n"
+	"DSPLY_NAME \"DISPLAY NAME\"           3  NULL        ALPHANUMERIC       16  RMTES_STRING    16\n"
+	"TRDPRC_1   \"LAST\"                   6  TRDPRC_2    PRICE              17  REAL64           7\n"
+	"BID        \"BID\"                   22  BID_1       PRICE              17  REAL64           7\n"
+	"ASK        \"ASK\"                   25  ASK_1       PRICE              17  REAL64           7\n"
+	"ACVOL_1    \"VOL ACCUMULATED\"       32  NULL        INTEGER            15  REAL64           7\n"
+	"ORDER_PRC  \"ORDER PRICE\"         3427  NULL        PRICE              17  REAL64           7\n"
+	"ORDER_SIDE \"ORDER SIDE\"          3428  NULL        INTEGER             3  UINT64           1\n"
+	"ORDER_SIZE \"ORDER SIZE\"          3429  NULL        INTEGER            15  REAL64           7\n";
+
+/* A field for the test messages. REAL fields use the value with a two-decimal hint; blank fields have no data. */
+struct TestField
+{
+	RsslFieldId fieldId;
+	RsslInt64 value;
+	const char *string;
+	bool blank;
+};
+
+static TestField realField(RsslFieldId fieldId, RsslInt64 value) { TestField f = { fieldId, value, NULL, false }; return f; }
+static TestField uintField(RsslFieldId fieldId, RsslInt64 value) { TestField f = { fieldId, value, NULL, false }; return f; }
+static TestField stringField(RsslFieldId fieldId, const char *string) { TestField f = { fieldId, 0, string, false }; return f; }
+static TestField blankField(RsslFieldId fieldId) { TestField f = { fieldId, 0, NULL, true }; return f; }
+
+/* An entry for the test map messages. */
+struct TestMapEntry
+{
+	const char *key;
+	RsslMapEntryActions action;
+	std::vector<TestField> fields;
+};
+
+class PayloadCacheTest : public ::testing::Test
+{
+protected:
+	static RsslDataDictionary dictionary;
+
+	RsslPayloadCacheHandle cacheHandle;
+	RsslCacheError cacheError;
+	std::vector<char> msgStorage;
+	std::vector<char> retrieveStorage;
+	RsslBuffer msgBuffer;			/* Encode iterators keep a pointer to their buffer. */
+
+	static void SetUpTestCase()
+	{
+		char errorTextData[255];
+		RsslBuffer errorText = { sizeof(errorTextData), errorTextData };
+		FILE *pFile;
+
+		ASSERT_TRUE((pFile = fopen("tmp_cacheDictionary.txt", "w")) != NULL);
+		fputs(fieldDictionaryText, pFile);
+		fclose(pFile);
+
+		rsslClearDataDictionary(&dictionary);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslLoadFieldDictionary("tmp_cacheDictionary.txt", &dictionary, &errorText));
+		remove("tmp_cacheDictionary.txt");
+	}
+
+	static void TearDownTestCase()
+	{
+		rsslDeleteDataDictionary(&dictionary);
+	}
+
+	virtual void SetUp()
+	{
+		RsslPayloadCacheConfigOptions configOptions;
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheInitialize());
+
+		configOptions.maxItems = 0;
+		rsslCacheErrorClear(&cacheError);
+		ASSERT_TRUE((cacheHandle = rsslPayloadCacheCreate(&configOptions, &cacheError)) != NULL);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheSetDictionary(cacheHandle, &dictionary, "cacheTestDictionary", &cacheError));
+
+		msgStorage.resize(65536);
+		retrieveStorage.resize(65536);
+	}
+
+	virtual void TearDown()
+	{
+		rsslPayloadCacheDestroy(cacheHandle);
+		rsslPayloadCacheUninitialize();
+	}
+
+	static void encodeFields(RsslEncodeIterator *pIter, const std::vector<TestField> &fields)
+	{
+		RsslFieldList fieldList;
+		RsslFieldEntry fieldEntry;
+
+		rsslClearFieldList(&fieldList);
+		fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0));
+
+		for (size_t i = 0; i < fields.size(); ++i)
+		{
+			const TestField &field = fields[i];
+
+			rsslClearFieldEntry(&fieldEntry);
+			fieldEntry.fieldId = field.fieldId;
+			fieldEntry.dataType = dictionary.entriesArray[field.fieldId] ? dictionary.entriesArray[field.fieldId]->rwfType
+				: RSSL_DT_UINT;
+
+			if (field.blank)
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(pIter, &fieldEntry, NULL));
+			else if (fieldEntry.dataType == RSSL_DT_REAL)
+			{
+				RsslReal real;
+				rsslClearReal(&real);
+				real.hint = RSSL_RH_EXPONENT_2;
+				real.value = field.value;
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(pIter, &fieldEntry, &real));
+			}
+			else if (fieldEntry.dataType == RSSL_DT_RMTES_STRING)
+			{
+				RsslBuffer string;
+				string.data = const_cast<char*>(field.string);
+				string.length = (RsslUInt32)strlen(field.string);
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(pIter, &fieldEntry, &string));
+			}
+			else
+			{
+				RsslUInt uintValue = (RsslUInt)field.value;
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldEntry(pIter, &fieldEntry, &uintValue));
+			}
+		}
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeFieldListComplete(pIter, RSSL_TRUE));
+	}
+
+	static void encodeMap(RsslEncodeIterator *pIter, const std::vector<TestField> *pSummary, const std::vector<TestMapEntry> &entries)
+	{
+		RsslMap map;
+		RsslMapEntry mapEntry;
+
+		rsslClearMap(&map);
+		map.containerType = RSSL_DT_FIELD_LIST;
+		map.keyPrimitiveType = RSSL_DT_BUFFER;
+		if (pSummary)
+			map.flags |= RSSL_MPF_HAS_SUMMARY_DATA;
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapInit(pIter, &map, 0, 0));
+
+		if (pSummary)
+		{
+			encodeFields(pIter, *pSummary);
+			ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapSummaryDataComplete(pIter, RSSL_TRUE));
+		}
+
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			RsslBuffer key;
+
+			key.data = const_cast<char*>(entries[i].key);
+			key.length = (RsslUInt32)strlen(entries[i].key);
+
+			rsslClearMapEntry(&mapEntry);
+			mapEntry.action = entries[i].action;
+
+			if (mapEntry.action == RSSL_MPEA_DELETE_ENTRY)
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntry(pIter, &mapEntry, &key));
+			else
+			{
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntryInit(pIter, &mapEntry, &key, 0));
+				encodeFields(pIter, entries[i].fields);
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapEntryComplete(pIter, RSSL_TRUE));
+			}
+		}
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMapComplete(pIter, RSSL_TRUE));
+	}
+
+	/* Encodes a refresh or update message header, leaving the iterator ready for the payload. */
+	void encodeMsgInit(RsslEncodeIterator *pIter, RsslMsgClasses msgClass, RsslContainerType containerType,
+			RsslUInt16 flags = 0)
+	{
+		RsslMsg msg;
+
+		msgBuffer.data = &msgStorage[0];
+		msgBuffer.length = (RsslUInt32)msgStorage.size();
+		rsslClearEncodeIterator(pIter);
+		rsslSetEncodeIteratorRWFVersion(pIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetEncodeIteratorBuffer(pIter, &msgBuffer);
+
+		rsslClearMsg(&msg);
+		msg.msgBase.msgClass = msgClass;
+		msg.msgBase.streamId = 5;
+		msg.msgBase.domainType = (containerType == RSSL_DT_MAP) ? RSSL_DMT_MARKET_BY_ORDER : RSSL_DMT_MARKET_PRICE;
+		msg.msgBase.containerType = containerType;
+
+		if (msgClass == RSSL_MC_REFRESH)
+		{
+			msg.refreshMsg.flags = RSSL_RFMF_REFRESH_COMPLETE | flags;
+			msg.refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+			msg.refreshMsg.state.dataState = RSSL_DATA_OK;
+		}
+
+		ASSERT_EQ(RSSL_RET_ENCODE_CONTAINER, rsslEncodeMsgInit(pIter, &msg, 0));
+	}
+
+	/* Completes the message and applies it to the entry. */
+	RsslRet applyMsg(RsslEncodeIterator *pIter, RsslPayloadEntryHandle entryHandle)
+	{
+		RsslDecodeIterator dIter;
+		RsslBuffer buffer;
+		RsslMsg msg;
+
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslEncodeMsgComplete(pIter, RSSL_TRUE));
+
+		buffer.data = &msgStorage[0];
+		buffer.length = rsslGetEncodedBufferLength(pIter);
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetDecodeIteratorBuffer(&dIter, &buffer);
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslDecodeMsg(&dIter, &msg));
+
+		rsslCacheErrorClear(&cacheError);
+		return rsslPayloadEntryApply(entryHandle, &dIter, &msg, &cacheError);
+	}
+
+	RsslRet applyFieldList(RsslPayloadEntryHandle entryHandle, RsslMsgClasses msgClass, const std::vector<TestField> &fields,
+			RsslUInt16 flags = 0)
+	{
+		RsslEncodeIterator eIter;
+
+		encodeMsgInit(&eIter, msgClass, RSSL_DT_FIELD_LIST, flags);
+		encodeFields(&eIter, fields);
+		return applyMsg(&eIter, entryHandle);
+	}
+
+	RsslRet applyMap(RsslPayloadEntryHandle entryHandle, RsslMsgClasses msgClass, const std::vector<TestField> *pSummary,
+			const std::vector<TestMapEntry> &entries)
+	{
+		RsslEncodeIterator eIter;
+
+		encodeMsgInit(&eIter, msgClass, RSSL_DT_MAP);
+		encodeMap(&eIter, pSummary, entries);
+		return applyMsg(&eIter, entryHandle);
+	}
+
+	/* Retrieves the entry into a buffer of the given size. */
+	RsslRet retrieve(RsslPayloadEntryHandle entryHandle, RsslUInt32 bufferSize, RsslPayloadCursorHandle cursorHandle,
+			RsslBuffer *pOutput)
+	{
+		RsslEncodeIterator eIter;
+		RsslRet ret;
+
+		pOutput->data = &retrieveStorage[0];
+		pOutput->length = bufferSize;
+		rsslClearEncodeIterator(&eIter);
+		rsslSetEncodeIteratorRWFVersion(&eIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetEncodeIteratorBuffer(&eIter, pOutput);
+
+		rsslCacheErrorClear(&cacheError);
+		if ((ret = rsslPayloadEntryRetrieve(entryHandle, &eIter, cursorHandle, &cacheError)) == RSSL_RET_SUCCESS)
+			pOutput->length = rsslGetEncodedBufferLength(&eIter);
+		return ret;
+	}
+
+	/* Decodes a field list into the fields it contains, in order. */
+	static void decodeFields(RsslDecodeIterator *pIter, std::vector<TestField> &fields)
+	{
+		RsslFieldList fieldList;
+		RsslFieldEntry fieldEntry;
+		RsslRet ret;
+
+		fields.clear();
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeFieldList(pIter, &fieldList, NULL));
+
+		while ((ret = rsslDecodeFieldEntry(pIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			TestField field = { fieldEntry.fieldId, 0, NULL, false };
+			RsslDataType dataType = dictionary.entriesArray[fieldEntry.fieldId]->rwfType;
+			RsslReal real;
+			RsslUInt uintValue;
+
+			ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+
+			if (dataType == RSSL_DT_REAL)
+			{
+				if ((ret = rsslDecodeReal(pIter, &real)) == RSSL_RET_BLANK_DATA)
+					field.blank = true;
+				else
+				{
+					ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+					field.value = real.value;
+				}
+			}
+			else if (dataType == RSSL_DT_UINT)
+			{
+				ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeUInt(pIter, &uintValue));
+				field.value = (RsslInt64)uintValue;
+			}
+			else if (fieldEntry.encData.length == 0)
+				field.blank = true;
+
+			fields.push_back(field);
+		}
+	}
+
+	static void decodeFieldList(RsslBuffer *pBuffer, std::vector<TestField> &fields)
+	{
+		RsslDecodeIterator dIter;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetDecodeIteratorBuffer(&dIter, pBuffer);
+		decodeFields(&dIter, fields);
+	}
+
+	/* Decodes a retrieved map part, appending its keys and entries. */
+	static void decodeMapPart(RsslBuffer *pBuffer, RsslMap *pMap, std::vector<TestField> *pSummary, std::vector<std::string> &keys,
+			std::vector<std::vector<TestField> > &entries)
+	{
+		RsslDecodeIterator dIter;
+		RsslMapEntry mapEntry;
+		RsslRet ret;
+
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetDecodeIteratorBuffer(&dIter, pBuffer);
+
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeMap(&dIter, pMap));
+		ASSERT_EQ(RSSL_DT_FIELD_LIST, pMap->containerType);
+
+		if (pMap->flags & RSSL_MPF_HAS_SUMMARY_DATA)
+		{
+			ASSERT_TRUE(pSummary != NULL);
+			decodeFields(&dIter, *pSummary);
+		}
+
+		while ((ret = rsslDecodeMapEntry(&dIter, &mapEntry, NULL)) != RSSL_RET_END_OF_CONTAINER)
+		{
+			ASSERT_EQ(RSSL_RET_SUCCESS, ret);
+			ASSERT_EQ(RSSL_MPEA_ADD_ENTRY, mapEntry.action);
+
+			keys.push_back(std::string(mapEntry.encKey.data, mapEntry.encKey.length));
+			entries.push_back(std::vector<TestField>());
+			decodeFields(&dIter, entries.back());
+		}
+	}
+
+	static TestMapEntry order(const char *key, RsslMapEntryActions action, RsslInt64 price, RsslInt64 size, RsslInt64 side)
+	{
+		TestMapEntry entry;
+
+		entry.key = key;
+		entry.action = action;
+		if (action != RSSL_MPEA_DELETE_ENTRY)
+		{
+			entry.fields.push_back(realField(FID_ORDER_PRC, price));
+			entry.fields.push_back(uintField(FID_ORDER_SIDE, side));
+			entry.fields.push_back(realField(FID_ORDER_SIZE, size));
+		}
+		return entry;
+	}
+};
+
+RsslDataDictionary PayloadCacheTest::dictionary;
+
+TEST_F(PayloadCacheTest, FieldListApplyAndRetrieve)
+{
+	RsslPayloadEntryHandle entryHandle;
+	std::vector<TestField> fields, retrieved;
+	RsslBuffer output;
+
+	ASSERT_TRUE((entryHandle = rsslPayloadEntryCreate(cacheHandle, &cacheError)) != NULL);
+	EXPECT_EQ(RSSL_DT_UNKNOWN, rsslPayloadEntryGetDataType(entryHandle));
+	EXPECT_EQ(1u, rsslPayloadCacheGetEntryCount(cacheHandle));
+
+	/* Fields arrive out of order; they are retrieved sorted by FieldId. */
+	fields.push_back(realField(FID_ASK, 1100));
+	fields.push_back(realField(FID_BID, 1050));
+	fields.push_back(stringField(FID_DSPLY_NAME, "TRI"));
+	fields.push_back(realField(FID_ACVOL_1, 100000));
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyFieldList(entryHandle, RSSL_MC_REFRESH, fields));
+	EXPECT_EQ(RSSL_DT_FIELD_LIST, rsslPayloadEntryGetDataType(entryHandle));
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entryHandle, (RsslUInt32)retrieveStorage.size(), NULL, &output));
+	decodeFieldList(&output, retrieved);
+
+	ASSERT_EQ(4u, retrieved.size());
+	EXPECT_EQ(FID_DSPLY_NAME, retrieved[0].fieldId);
+	EXPECT_EQ(FID_BID, retrieved[1].fieldId);
+	EXPECT_EQ(1050, retrieved[1].value);
+	EXPECT_EQ(FID_ASK, retrieved[2].fieldId);
+	EXPECT_EQ(1100, retrieved[2].value);
+	EXPECT_EQ(FID_ACVOL_1, retrieved[3].fieldId);
+	EXPECT_EQ(100000, retrieved[3].value);
+
+	/* Field lists can't be fragmented. */
+	EXPECT_EQ(RSSL_RET_BUFFER_TOO_SMALL, retrieve(entryHandle, 8, NULL, &output));
+
+	FILE *pTraceFile = tmpfile();
+	ASSERT_TRUE(pTraceFile != NULL);
+	EXPECT_EQ(RSSL_RET_SUCCESS, rsslPayloadEntryTrace(entryHandle, PAYLOAD_ENTRY_TRACE_OPTION_XML, pTraceFile, &dictionary));
+	EXPECT_GT(ftell(pTraceFile), 0);
+	fclose(pTraceFile);
+
+	rsslPayloadEntryDestroy(entryHandle);
+	EXPECT_EQ(0u, rsslPayloadCacheGetEntryCount(cacheHandle));
+}
+
+TEST_F(PayloadCacheTest, FieldListUpdateMerge)
+{
+	RsslPayloadEntryHandle entryHandle;
+	std::vector<TestField> fields, retrieved;
+	RsslPayloadCursorHandle cursorHandle;
+	RsslBuffer output;
+	char name[64];
+	int i;
+
+	ASSERT_TRUE((entryHandle = rsslPayloadEntryCreate(cacheHandle, &cacheError)) != NULL);
+	ASSERT_TRUE((cursorHandle = rsslPayloadCursorCreate()) != NULL);
+
+	fields.push_back(stringField(FID_DSPLY_NAME, "A"));
+	fields.push_back(realField(FID_TRDPRC_1, 1000));
+	fields.push_back(realField(FID_BID, 990));
+	fields.push_back(realField(FID_ASK, 1010));
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyFieldList(entryHandle, RSSL_MC_REFRESH, fields));
+
+	/* Update some fields, blank one, and add one. Names of growing length force the stored data to move. */
+	for (i = 0; i < 50; ++i)
+	{
+		snprintf(name, sizeof(name), "%.*s", i + 1, "NAME_OF_GROWING_LENGTH_NAME_OF_GROWING_LENGTH_NAME");
+		fields.clear();
+		fields.push_back(realField(FID_BID, 991 + i));
+		fields.push_back(blankField(FID_TRDPRC_1));
+		fields.push_back(realField(FID_ACVOL_1, 200 + i));
+		fields.push_back(stringField(FID_DSPLY_NAME, name));
+		ASSERT_EQ(RSSL_RET_SUCCESS, applyFieldList(entryHandle, RSSL_MC_UPDATE, fields));
+	}
+
+	rsslPayloadCursorClear(cursorHandle);
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entryHandle, (RsslUInt32)retrieveStorage.size(), cursorHandle, &output));
+	EXPECT_TRUE(rsslPayloadCursorIsComplete(cursorHandle));
+	decodeFieldList(&output, retrieved);
+
+	ASSERT_EQ(5u, retrieved.size());
+	EXPECT_EQ(FID_DSPLY_NAME, retrieved[0].fieldId);
+	EXPECT_EQ(FID_TRDPRC_1, retrieved[1].fieldId);
+	EXPECT_TRUE(retrieved[1].blank);
+	EXPECT_EQ(FID_BID, retrieved[2].fieldId);
+	EXPECT_EQ(991 + 49, retrieved[2].value);
+	EXPECT_EQ(FID_ASK, retrieved[3].fieldId);
+	EXPECT_EQ(1010, retrieved[3].value);
+	EXPECT_EQ(FID_ACVOL_1, retrieved[4].fieldId);
+	EXPECT_EQ(200 + 49, retrieved[4].value);
+
+	/* A refresh that clears the cache replaces the contents. */
+	fields.clear();
+	fields.push_back(realField(FID_ASK, 1020));
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyFieldList(entryHandle, RSSL_MC_REFRESH, fields, RSSL_RFMF_CLEAR_CACHE));
+
+	rsslPayloadCursorClear(cursorHandle);
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entryHandle, (RsslUInt32)retrieveStorage.size(), cursorHandle, &output));
+	decodeFieldList(&output, retrieved);
+	ASSERT_EQ(1u, retrieved.size());
+	EXPECT_EQ(FID_ASK, retrieved[0].fieldId);
+	EXPECT_EQ(1020, retrieved[0].value);
+
+	rsslPayloadCursorDestroy(cursorHandle);
+}
+
+TEST_F(PayloadCacheTest, FieldNotInDictionaryIsWarning)
+{
+	RsslPayloadEntryHandle entryHandle;
+	std::vector<TestField> fields, retrieved;
+	RsslBuffer output;
+
+	ASSERT_TRUE((entryHandle = rsslPayloadEntryCreate(cacheHandle, &cacheError)) != NULL);
+
+	fields.push_back(realField(FID_BID, 990));
+	fields.push_back(uintField(FID_UNKNOWN, 5));
+	EXPECT_EQ(RSSL_RET_FAILURE, applyFieldList(entryHandle, RSSL_MC_REFRESH, fields));
+	EXPECT_EQ(RSSL_RET_SUCCESS, cacheError.rsslErrorId);
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entryHandle, (RsslUInt32)retrieveStorage.size(), NULL, &output));
+	decodeFieldList(&output, retrieved);
+	ASSERT_EQ(1u, retrieved.size());
+	EXPECT_EQ(FID_BID, retrieved[0].fieldId);
+
+	/* Container type can't change without clearing the entry. */
+	std::vector<TestMapEntry> entries;
+	EXPECT_EQ(RSSL_RET_INVALID_DATA, applyMap(entryHandle, RSSL_MC_UPDATE, NULL, entries));
+	EXPECT_EQ(RSSL_RET_INVALID_DATA, cacheError.rsslErrorId);
+}
+
+TEST_F(PayloadCacheTest, MapMultiPartRetrieve)
+{
+	RsslPayloadEntryHandle entryHandle;
+	RsslPayloadCursorHandle cursorHandle;
+	std::vector<TestField> summary, retrievedSummary;
+	std::vector<TestMapEntry> orders;
+	std::vector<std::string> keys;
+	std::vector<std::vector<TestField> > entries;
+	char keyStorage[200][48];
+	RsslBuffer output;
+	RsslMap map;
+	int i, partCount = 0;
+
+	ASSERT_TRUE((entryHandle = rsslPayloadEntryCreate(cacheHandle, &cacheError)) != NULL);
+	ASSERT_TRUE((cursorHandle = rsslPayloadCursorCreate()) != NULL);
+
+	/* Some keys are longer than fit inside the map entry. */
+	for (i = 0; i < 200; ++i)
+	{
+		if (i % 10 == 0)
+			snprintf(keyStorage[i], sizeof(keyStorage[i]), "ORDER-WITH-A-RATHER-LONG-IDENTIFIER-%04d", i);
+		else
+			snprintf(keyStorage[i], sizeof(keyStorage[i]), "ORD%04d", i);
+		orders.push_back(order(keyStorage[i], RSSL_MPEA_ADD_ENTRY, 1000 + i, 100 * i, i % 2));
+	}
+
+	summary.push_back(stringField(FID_DSPLY_NAME, "TRI"));
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyMap(entryHandle, RSSL_MC_REFRESH, &summary, orders));
+	EXPECT_EQ(RSSL_DT_MAP, rsslPayloadEntryGetDataType(entryHandle));
+
+	/* Too small for even one entry. */
+	rsslPayloadCursorClear(cursorHandle);
+	EXPECT_EQ(RSSL_RET_BUFFER_TOO_SMALL, retrieve(entryHandle, 16, cursorHandle, &output));
+	EXPECT_FALSE(rsslPayloadCursorIsComplete(cursorHandle));
+
+	/* Not enough room for the whole map without a cursor. */
+	EXPECT_EQ(RSSL_RET_BUFFER_TOO_SMALL, retrieve(entryHandle, 512, NULL, &output));
+
+	rsslPayloadCursorClear(cursorHandle);
+	while (!rsslPayloadCursorIsComplete(cursorHandle))
+	{
+		ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entryHandle, 512, cursorHandle, &output));
+		rsslClearMap(&map);
+		decodeMapPart(&output, &map, &retrievedSummary, keys, entries);
+
+		if (partCount == 0)
+		{
+			EXPECT_TRUE(map.flags & RSSL_MPF_HAS_SUMMARY_DATA);
+			EXPECT_TRUE(map.flags & RSSL_MPF_HAS_TOTAL_COUNT_HINT);
+			EXPECT_EQ(200u, map.totalCountHint);
+		}
+		else
+			EXPECT_FALSE(map.flags & RSSL_MPF_HAS_SUMMARY_DATA);
+
+		ASSERT_LT(++partCount, 200);
+	}
+
+	EXPECT_GT(partCount, 1);
+	ASSERT_EQ(1u, retrievedSummary.size());
+	EXPECT_EQ(FID_DSPLY_NAME, retrievedSummary[0].fieldId);
+
+	ASSERT_EQ(200u, keys.size());
+	for (i = 0; i < 200; ++i)
+	{
+		EXPECT_EQ(std::string(keyStorage[i]), keys[i]);
+		ASSERT_EQ(3u, entries[i].size());
+		EXPECT_EQ(FID_ORDER_PRC, entries[i][0].fieldId);
+		EXPECT_EQ(1000 + i, entries[i][0].value);
+	}
+
+	rsslPayloadCursorDestroy(cursorHandle);
+}
+
+TEST_F(PayloadCacheTest, MapEntryActions)
+{
+	RsslPayloadEntryHandle entryHandle;
+	std::vector<TestMapEntry> orders;
+	std::vector<std::string> keys;
+	std::vector<std::vector<TestField> > entries;
+	RsslBuffer output;
+	RsslMap map;
+
+	ASSERT_TRUE((entryHandle = rsslPayloadEntryCreate(cacheHandle, &cacheError)) != NULL);
+
+	orders.push_back(order("1", RSSL_MPEA_ADD_ENTRY, 1000, 10, 0));
+	orders.push_back(order("2", RSSL_MPEA_ADD_ENTRY, 1001, 20, 1));
+	orders.push_back(order("3", RSSL_MPEA_ADD_ENTRY, 1002, 30, 0));
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyMap(entryHandle, RSSL_MC_REFRESH, NULL, orders));
+
+	orders.clear();
+	orders.push_back(order("2", RSSL_MPEA_DELETE_ENTRY, 0, 0, 0));
+	orders.push_back(order("9", RSSL_MPEA_DELETE_ENTRY, 0, 0, 0));
+	orders.push_back(order("4", RSSL_MPEA_ADD_ENTRY, 1003, 40, 1));
+	orders.push_back(order("1", RSSL_MPEA_UPDATE_ENTRY, 1004, 15, 0));
+	orders.back().fields.pop_back(); /* Update only price and side; size stays. */
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyMap(entryHandle, RSSL_MC_UPDATE, NULL, orders));
+
+	ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entryHandle, (RsslUInt32)retrieveStorage.size(), NULL, &output));
+	rsslClearMap(&map);
+	decodeMapPart(&output, &map, NULL, keys, entries);
+
+	ASSERT_EQ(3u, keys.size());
+	EXPECT_EQ("1", keys[0]);
+	EXPECT_EQ("3", keys[1]);
+	EXPECT_EQ("4", keys[2]);
+
+	ASSERT_EQ(3u, entries[0].size());
+	EXPECT_EQ(1004, entries[0][0].value);
+	EXPECT_EQ(10, entries[0][2].value);
+
+	/* A status message that clears the cache empties the entry. */
+	RsslEncodeIterator eIter;
+	RsslDecodeIterator dIter;
+	RsslBuffer buffer;
+	RsslMsg msg;
+
+	buffer.data = &msgStorage[0];
+	buffer.length = (RsslUInt32)msgStorage.size();
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetEncodeIteratorBuffer(&eIter, &buffer);
+	rsslClearMsg(&msg);
+	msg.msgBase.msgClass = RSSL_MC_STATUS;
+	msg.msgBase.streamId = 5;
+	msg.msgBase.domainType = RSSL_DMT_MARKET_BY_ORDER;
+	msg.msgBase.containerType = RSSL_DT_NO_DATA;
+	msg.statusMsg.flags = RSSL_STMF_CLEAR_CACHE;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMsg(&eIter, &msg));
+
+	buffer.length = rsslGetEncodedBufferLength(&eIter);
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetDecodeIteratorBuffer(&dIter, &buffer);
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslDecodeMsg(&dIter, &msg));
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadEntryApply(entryHandle, &dIter, &msg, &cacheError));
+	EXPECT_EQ(RSSL_DT_UNKNOWN, rsslPayloadEntryGetDataType(entryHandle));
+}
+
+TEST_F(PayloadCacheTest, CacheLimitsAndDictionaryKeys)
+{
+	RsslPayloadCacheConfigOptions configOptions;
+	RsslPayloadCacheHandle limitedCacheHandle;
+	RsslPayloadEntryHandle entryHandles[3];
+
+	configOptions.maxItems = 2;
+	ASSERT_TRUE((limitedCacheHandle = rsslPayloadCacheCreate(&configOptions, &cacheError)) != NULL);
+
+	/* A second cache can share the dictionary loaded by the first. */
+	EXPECT_EQ(RSSL_RET_FAILURE, rsslPayloadCacheSetSharedDictionaryKey(limitedCacheHandle, "unknownKey", &cacheError));
+	EXPECT_EQ(RSSL_RET_SUCCESS, rsslPayloadCacheSetSharedDictionaryKey(limitedCacheHandle, "cacheTestDictionary", &cacheError));
+
+	ASSERT_TRUE((entryHandles[0] = rsslPayloadEntryCreate(limitedCacheHandle, &cacheError)) != NULL);
+	ASSERT_TRUE((entryHandles[1] = rsslPayloadEntryCreate(limitedCacheHandle, &cacheError)) != NULL);
+	EXPECT_TRUE(rsslPayloadEntryCreate(limitedCacheHandle, &cacheError) == NULL);
+
+	EXPECT_EQ(2u, rsslPayloadCacheGetEntryList(limitedCacheHandle, entryHandles, 3));
+	rsslPayloadCacheClearAll(limitedCacheHandle);
+	EXPECT_EQ(0u, rsslPayloadCacheGetEntryCount(limitedCacheHandle));
+
+	/* Entries still in the cache are destroyed with it. */
+	ASSERT_TRUE(rsslPayloadEntryCreate(limitedCacheHandle, &cacheError) != NULL);
+	rsslPayloadCacheDestroy(limitedCacheHandle);
+}
+
+/* Measures apply and retrieve rates for a MarketPrice and MarketByOrder update stream.
+ * Run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*. */
+TEST_F(PayloadCacheTest, DISABLED_ApplyRetrieveBenchmark)
+{
+	const int itemCount = 1000, updateCount = 200000, orderCount = 500;
+	std::vector<RsslPayloadEntryHandle> entryHandles(itemCount);
+	std::vector<char> updateStorage;
+	std::vector<TestField> fields;
+	std::vector<TestMapEntry> orders;
+	char keyStorage[orderCount][16];
+	RsslEncodeIterator eIter;
+	RsslDecodeIterator dIter;
+	RsslBuffer updateBuffer, output;
+	RsslMsg msg;
+	RsslTimeValue startTime, endTime;
+	RsslPayloadCursorHandle cursorHandle;
+	int i, partCount;
+
+	/* MarketPrice: refresh each item, then apply a stream of updates across them. */
+	for (i = 0; i < itemCount; ++i)
+	{
+		ASSERT_TRUE((entryHandles[i] = rsslPayloadEntryCreate(cacheHandle, &cacheError)) != NULL);
+		fields.clear();
+		fields.push_back(stringField(FID_DSPLY_NAME, "MARKET PRICE ITEM"));
+		fields.push_back(realField(FID_TRDPRC_1, 1000 + i));
+		fields.push_back(realField(FID_BID, 999 + i));
+		fields.push_back(realField(FID_ASK, 1001 + i));
+		fields.push_back(realField(FID_ACVOL_1, 100 * i));
+		ASSERT_EQ(RSSL_RET_SUCCESS, applyFieldList(entryHandles[i], RSSL_MC_REFRESH, fields));
+	}
+
+	fields.clear();
+	fields.push_back(realField(FID_TRDPRC_1, 1005));
+	fields.push_back(realField(FID_BID, 1004));
+	fields.push_back(realField(FID_ASK, 1006));
+	encodeMsgInit(&eIter, RSSL_MC_UPDATE, RSSL_DT_FIELD_LIST);
+	encodeFields(&eIter, fields);
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslEncodeMsgComplete(&eIter, RSSL_TRUE));
+	updateStorage.assign(msgStorage.begin(), msgStorage.begin() + rsslGetEncodedBufferLength(&eIter));
+	updateBuffer.data = &updateStorage[0];
+	updateBuffer.length = (RsslUInt32)updateStorage.size();
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < updateCount; ++i)
+	{
+		rsslClearDecodeIterator(&dIter);
+		rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+		rsslSetDecodeIteratorBuffer(&dIter, &updateBuffer);
+		rsslDecodeMsg(&dIter, &msg);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslPayloadEntryApply(entryHandles[i % itemCount], &dIter, &msg, &cacheError));
+	}
+	endTime = rsslGetTimeNano();
+	printf("MarketPrice apply:       %10.0f updates/sec\n", (double)updateCount * 1e9 / (double)(endTime - startTime));
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < updateCount; ++i)
+		ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entryHandles[i % itemCount], 1024, NULL, &output));
+	endTime = rsslGetTimeNano();
+	printf("MarketPrice retrieve:    %10.0f retrievals/sec\n", (double)updateCount * 1e9 / (double)(endTime - startTime));
+
+	rsslPayloadCacheClearAll(cacheHandle);
+
+	/* MarketByOrder: one book, with updates that modify, delete and re-add orders. */
+	ASSERT_TRUE((entryHandles[0] = rsslPayloadEntryCreate(cacheHandle, &cacheError)) != NULL);
+	ASSERT_TRUE((cursorHandle = rsslPayloadCursorCreate()) != NULL);
+	for (i = 0; i < orderCount; ++i)
+	{
+		snprintf(keyStorage[i], sizeof(keyStorage[i]), "ORD%08d", i);
+		orders.push_back(order(keyStorage[i], RSSL_MPEA_ADD_ENTRY, 1000 + i, 100, i % 2));
+	}
+	ASSERT_EQ(RSSL_RET_SUCCESS, applyMap(entryHandles[0], RSSL_MC_REFRESH, NULL, orders));
+
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < updateCount / 10; ++i)
+	{
+		const char *key = keyStorage[i % orderCount];
+
+		orders.clear();
+		orders.push_back(order(key, RSSL_MPEA_UPDATE_ENTRY, 1000 + i, 200, 0));
+		orders.push_back(order(keyStorage[(i + 7) % orderCount], RSSL_MPEA_DELETE_ENTRY, 0, 0, 0));
+		orders.push_back(order(keyStorage[(i + 7) % orderCount], RSSL_MPEA_ADD_ENTRY, 1000 + i, 100, 1));
+		ASSERT_EQ(RSSL_RET_SUCCESS, applyMap(entryHandles[0], RSSL_MC_UPDATE, NULL, orders));
+	}
+	endTime = rsslGetTimeNano();
+	printf("MarketByOrder apply:     %10.0f updates/sec (including encoding)\n",
+			(double)(updateCount / 10) * 1e9 / (double)(endTime - startTime));
+
+	partCount = 0;
+	startTime = rsslGetTimeNano();
+	for (i = 0; i < 1000; ++i)
+	{
+		rsslPayloadCursorClear(cursorHandle);
+		while (!rsslPayloadCursorIsComplete(cursorHandle))
+		{
+			ASSERT_EQ(RSSL_RET_SUCCESS, retrieve(entryHandles[0], 6144, cursorHandle, &output));
+			++partCount;
+		}
+	}
+	endTime = rsslGetTimeNano();
+	printf("MarketByOrder retrieve:  %10.0f books/sec (%d parts each)\n",
+			1000 * 1e9 / (double)(endTime - startTime), partCount / 1000);
+
+	rsslPayloadCursorDestroy(cursorHandle);
+}
@@ -0,0 +1,367 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2020 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/* Tests for the reactor's internal event queue, in both its locked-queue and ring forms. */
+
+#include "gtest/gtest.h"
+#include "rtr/rsslReactor.h"
+#include "rtr/rsslReactorEventQueue.h"
+#include "rtr/rsslThread.h"
+#include "rtr/rsslGetTime.h"
+
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/select.h>
+#include <unistd.h>
+#endif
+
+/* Ring size used for the ring form of the queue(0 uses the locked queue). 
+ * The small ring size makes the ring overflow often. */
+class ReactorEventQueueTest : public ::testing::TestWithParam<RsslUInt32> {
+public:
+
+	virtual void SetUp()
+	{
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueueGroup(&eventQueueGroup));
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslInitReactorEventQueueEx(&eventQueue, 10, GetParam(), &eventQueueGroup));
+	}
+
+	virtual void TearDown()
+	{
+		rsslCleanupReactorEventQueue(&eventQueue);
+		rsslCleanupReactorEventQueueGroup(&eventQueueGroup);
+	}
+
+protected:
+	RsslReactorEventQueueGroup eventQueueGroup;
+	RsslReactorEventQueue eventQueue;
+};
+
+/* Returns whether the group's event signal is triggered, waiting up to timeoutUsec for it. */
+static bool reactorEventQueueTest_isSignaled(RsslReactorEventQueueGroup *pGroup, long timeoutUsec)
+{
+	fd_set readFds;
+	struct timeval time;
+	int fd = rsslGetEventQueueGroupSignalFD(pGroup);
+
+	FD_ZERO(&readFds);
+	FD_SET(fd, &readFds);
+	time.tv_sec = timeoutUsec / 1000000;
+	time.tv_usec = timeoutUsec % 1000000;
+
+	return select(fd + 1, &readFds, NULL, NULL, &time) > 0;
+}
+
+static void reactorEventQueueTest_put(RsslReactorEventQueue *pQueue, RsslInt64 value)
+{
+	RsslReactorEventImpl *pEvent = rsslReactorEventQueueGetFromPool(pQueue);
+	ASSERT_TRUE(pEvent != NULL);
+	rsslInitTimerEvent(&pEvent->timerEvent);
+	pEvent->timerEvent.expireTime = value;
+	ASSERT_EQ(RSSL_RET_SUCCESS, rsslReactorEventQueuePut(pQueue, pEvent));
+}
+
+TEST_P(ReactorEventQueueTest, SignalOnNonEmpty)
+{
+	RsslReactorEventImpl *pEvent;
+	RsslRet ret;
+
+	EXPECT_FALSE(reactorEventQueueTest_isSignaled(&eventQueueGroup, 0));
+	EXPECT_TRUE(rsslReactorEventQueueGroupShift(&eventQueueGroup) == NULL);
+
+	/* Getting from an empty queue leaves the group signal untouched. */
+	EXPECT_TRUE(rsslReactorEventQueueGet(&eventQueue, -1, &ret) == NULL);
+	EXPECT_EQ(0, ret);
+	EXPECT_FALSE(reactorEventQueueTest_isSignaled(&eventQueueGroup, 0));
+
+	reactorEventQueueTest_put(&eventQueue, 1);
+	EXPECT_TRUE(reactorEventQueueTest_isSignaled(&eventQueueGroup, 0));
+	reactorEventQueueTest_put(&eventQueue, 2);
+	reactorEventQueueTest_put(&eventQueue, 3);
+	EXPECT_TRUE(rsslReactorEventQueueGroupShift(&eventQueueGroup) == &eventQueue);
+
+	ASSERT_TRUE((pEvent = rsslReactorEventQueueGet(&eventQueue, -1, &ret)) != NULL);
+	EXPECT_EQ(1, pEvent->timerEvent.expireTime);
+	EXPECT_EQ(2, ret);
+	EXPECT_TRUE(reactorEventQueueTest_isSignaled(&eventQueueGroup, 0));
+
+	ASSERT_TRUE((pEvent = rsslReactorEventQueueGet(&eventQueue, -1, &ret)) != NULL);
+	EXPECT_EQ(2, pEvent->timerEvent.expireTime);
+	EXPECT_EQ(1, ret);
+
+	ASSERT_TRUE((pEvent = rsslReactorEventQueueGet(&eventQueue, -1, &ret)) != NULL);
+	EXPECT_EQ(3, pEvent->timerEvent.expireTime);
+	EXPECT_EQ(0, ret);
+
+	/* Queue is empty, so it leaves the group and the group signal is reset. */
+	EXPECT_FALSE(reactorEventQueueTest_isSignaled(&eventQueueGroup, 0));
+	EXPECT_TRUE(rsslReactorEventQueueGroupShift(&eventQueueGroup) == NULL);
+
+	reactorEventQueueTest_put(&eventQueue, 4);
+	EXPECT_TRUE(reactorEventQueueTest_isSignaled(&eventQueueGroup, 0));
+	ASSERT_TRUE((pEvent = rsslReactorEventQueueGet(&eventQueue, -1, &ret)) != NULL);
+	EXPECT_EQ(4, pEvent->timerEvent.expireTime);
+	EXPECT_FALSE(reactorEventQueueTest_isSignaled(&eventQueueGroup, 0));
+}
+
+TEST_P(ReactorEventQueueTest, PoolSize)
+{
+	RsslReactorEventImpl *pEvents[20];
+	RsslRet ret;
+	int i;
+
+	EXPECT_EQ(10u, rsslReactorEventQueueGetPoolCount(&eventQueue));
+
+	/* Take more events than were preallocated. */
+	for (i = 0; i < 20; ++i)
+		ASSERT_TRUE((pEvents[i] = rsslReactorEventQueueGetFromPool(&eventQueue)) != NULL);
+	EXPECT_EQ(0u, rsslReactorEventQueueGetPoolCount(&eventQueue));
+
+	/* Pool keeps no more than the given size. */
+	for (i = 0; i < 10; ++i)
+		rsslReactorEventQueueReturnToPool(pEvents[i], &eventQueue, 5);
+	EXPECT_EQ(5u, rsslReactorEventQueueGetPoolCount(&eventQueue));
+
+	/* Events passed through the queue return to the pool on the next get. */
+	for (i = 10; i < 20; ++i)
+	{
+		rsslInitTimerEvent(&pEvents[i]->timerEvent);
+		ASSERT_EQ(RSSL_RET_SUCCESS, rsslReactorEventQueuePut(&eventQueue, pEvents[i]));
+	}
+
+	for (i = 10; i < 20; ++i)
+		ASSERT_TRUE(rsslReactorEventQueueGet(&eventQueue, 6, &ret) != NULL);
+	EXPECT_TRUE(rsslReactorEventQueueGet(&eventQueue, 6, &ret) == NULL);
+	EXPECT_EQ(6u, rsslReactorEventQueueGetPoolCount(&eventQueue));
+}
+
+TEST_P(ReactorEventQueueTest, OrderBeyondRingSize)
+{
+	RsslReactorEventImpl *pEvent;
+	RsslRet ret;
+	RsslInt64 i, count = 3 * (GetParam() ? GetParam() : 64);
+
+	/* With a ring, events that do not fit are held in the overflow queue, which must not reorder them. */
+	for (i = 0; i < count; ++i)
+	{
+		reactorEventQueueTest_put(&eventQueue, i);
+
+		/* Drain some as we go, so the ring has room while the overflow queue still has events. */
+		if (i % 3 == 2)
+		{
+			ASSERT_TRUE((pEvent = rsslReactorEventQueueGet(&eventQueue, -1, &ret)) != NULL);
+			EXPECT_EQ(i / 3, pEvent->timerEvent.expireTime);
+		}
+	}
+
+	for (i = count / 3; i < count; ++i)
+	{
+		ASSERT_TRUE((pEvent = rsslReactorEventQueueGet(&eventQueue, -1, &ret)) != NULL);
+		EXPECT_EQ(i, pEvent->timerEvent.expireTime);
+		EXPECT_EQ(count - i - 1, ret);
+	}
+
+	EXPECT_TRUE(rsslReactorEventQueueGet(&eventQueue, -1, &ret) == NULL);
+	EXPECT_FALSE(reactorEventQueueTest_isSignaled(&eventQueueGroup, 0));
+}
+
+typedef struct
+{
+	RsslReactorEventQueue *pQueue;
+	RsslInt64 producerId;
+	RsslInt64 eventCount;
+	bool timestamp;		/* Sends the put time instead of a sequence number. */
+	bool paced;			/* Waits for each event to be consumed before sending the next. */
+	volatile RsslInt64 consumedCount;
+} ReactorEventQueueTestProducer;
+
+#define REACTOR_EVENT_QUEUE_TEST_SEQ_BITS 40
+
+RSSL_THREAD_DECLARE(reactorEventQueueTest_producerThread, pArg)
+{
+	ReactorEventQueueTestProducer *pProducer = (ReactorEventQueueTestProducer*)pArg;
+	RsslInt64 i;
+
+	for (i = 0; i < pProducer->eventCount; ++i)
+	{
+		RsslReactorEventImpl *pEvent;
+		
+		while (pProducer->paced && pProducer->consumedCount < i);
+
+		pEvent = rsslReactorEventQueueGetFromPool(pProducer->pQueue);
+		rsslInitTimerEvent(&pEvent->timerEvent);
+		pEvent->timerEvent.pReactorChannel = (RsslReactorChannel*)pProducer;
+		pEvent->timerEvent.expireTime = pProducer->timestamp ? (RsslInt64)rsslGetTimeNano()
+			: (pProducer->producerId << REACTOR_EVENT_QUEUE_TEST_SEQ_BITS) | i;
+		rsslReactorEventQueuePut(pProducer->pQueue, pEvent);
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+/* Starts the producers and dispatches their events the way the reactor does: wait on the group signal,
+ * then take events from the queues in the group. Calls the given function with each event. */
+template <class Consumer> static void reactorEventQueueTest_run(RsslReactorEventQueueGroup *pGroup,
+		ReactorEventQueueTestProducer *pProducers, int producerCount, Consumer &consumer)
+{
+	RsslThreadId threadIds[16];
+	RsslInt64 received = 0, total = 0;
+	int i;
+
+	for (i = 0; i < producerCount; ++i)
+	{
+		total += pProducers[i].eventCount;
+		RSSL_THREAD_START(&threadIds[i], reactorEventQueueTest_producerThread, &pProducers[i]);
+	}
+
+	while (received < total)
+	{
+		RsslReactorEventQueue *pQueue;
+
+		if (!reactorEventQueueTest_isSignaled(pGroup, 1000000))
+		{
+			ADD_FAILURE() << "Timed out waiting for event queue signal.";
+			break;
+		}
+
+		while ((pQueue = rsslReactorEventQueueGroupShift(pGroup)))
+		{
+			RsslReactorEventImpl *pEvent;
+			RsslRet ret;
+
+			if (!(pEvent = rsslReactorEventQueueGet(pQueue, -1, &ret)))
+				break;
+
+			consumer(pEvent);
+			++((ReactorEventQueueTestProducer*)pEvent->timerEvent.pReactorChannel)->consumedCount;
+			++received;
+		}
+	}
+
+	for (i = 0; i < producerCount; ++i)
+		RSSL_THREAD_JOIN(threadIds[i]);
+
+	EXPECT_EQ(total, received);
+}
+
+struct ReactorEventQueueTestSequenceCheck
+{
+	RsslInt64 nextSeq[16];
+
+	ReactorEventQueueTestSequenceCheck() { memset(nextSeq, 0, sizeof(nextSeq)); }
+
+	void operator()(RsslReactorEventImpl *pEvent)
+	{
+		RsslInt64 producerId = pEvent->timerEvent.expireTime >> REACTOR_EVENT_QUEUE_TEST_SEQ_BITS;
+		RsslInt64 seq = pEvent->timerEvent.expireTime & (((RsslInt64)1 << REACTOR_EVENT_QUEUE_TEST_SEQ_BITS) - 1);
+
+		ASSERT_EQ(nextSeq[producerId], seq);
+		++nextSeq[producerId];
+	}
+};
+
+TEST_P(ReactorEventQueueTest, MultipleProducers)
+{
+	ReactorEventQueueTestProducer producers[4];
+	ReactorEventQueueTestSequenceCheck sequenceCheck;
+	int i;
+
+	for (i = 0; i < 4; ++i)
+	{
+		producers[i].pQueue = &eventQueue;
+		producers[i].producerId = i;
+		producers[i].eventCount = 100000;
+		producers[i].timestamp = false;
+		producers[i].paced = false;
+		producers[i].consumedCount = 0;
+	}
+
+	reactorEventQueueTest_run(&eventQueueGroup, producers, 4, sequenceCheck);
+
+	for (i = 0; i < 4; ++i)
+		EXPECT_EQ(100000, sequenceCheck.nextSeq[i]);
+}
+
+struct ReactorEventQueueTestLatency
+{
+	std::vector<RsslInt64> latencies;
+
+	void operator()(RsslReactorEventImpl *pEvent)
+	{
+		latencies.push_back((RsslInt64)rsslGetTimeNano() - pEvent->timerEvent.expireTime);
+	}
+};
+
+/* Compares the locked queue with the ring. 
+ * Throughput is measured with producers putting events as fast as they can. 
+ * Handoff latency(from put to get) is measured with each producer waiting for its previous event to be consumed,
+ * so that it does not include time spent waiting behind other events. */
+TEST_P(ReactorEventQueueTest, DISABLED_HandoffPerformance)
+{
+	int producerCounts[] = { 1, 4 };
+	RsslInt64 throughputEvents = 2000000, latencyEvents = 200000;
+	unsigned int test;
+
+	for (test = 0; test < sizeof(producerCounts)/sizeof(int); ++test)
+	{
+		ReactorEventQueueTestProducer producers[4];
+		ReactorEventQueueTestLatency latency;
+		RsslTimeValue startTime, endTime;
+		double eventsPerSec;
+		int i, producerCount = producerCounts[test];
+
+		latency.latencies.reserve((size_t)throughputEvents);
+
+		for (i = 0; i < producerCount; ++i)
+		{
+			producers[i].pQueue = &eventQueue;
+			producers[i].producerId = i;
+			producers[i].eventCount = throughputEvents / producerCount;
+			producers[i].timestamp = true;
+			producers[i].paced = false;
+			producers[i].consumedCount = 0;
+		}
+
+		startTime = rsslGetTimeNano();
+		reactorEventQueueTest_run(&eventQueueGroup, producers, producerCount, latency);
+		endTime = rsslGetTimeNano();
+		eventsPerSec = (double)latency.latencies.size() * 1000000000.0 / (double)(endTime - startTime);
+
+		latency.latencies.clear();
+
+		for (i = 0; i < producerCount; ++i)
+		{
+			producers[i].eventCount = latencyEvents / producerCount;
+			producers[i].paced = true;
+			producers[i].consumedCount = 0;
+		}
+
+		reactorEventQueueTest_run(&eventQueueGroup, producers, producerCount, latency);
+
+		std::sort(latency.latencies.begin(), latency.latencies.end());
+
+		printf("%s, %d producer(s): %.0f events/sec, handoff latency p50 %lld ns, p99 %lld ns\n",
+				GetParam() ? "Ring" : "Locked queue", producerCount, eventsPerSec,
+				(long long)latency.latencies[latency.latencies.size() / 2],
+				(long long)latency.latencies[latency.latencies.size() * 99 / 100]);
+	}
+}
+
+INSTANTIATE_TEST_CASE_P(
+	TestingReactorEventQueueTests,
+	ReactorEventQueueTest,
+	::testing::Values(
+		(RsslUInt32)0, (RsslUInt32)16, (RsslUInt32)RSSL_REACTOR_EVENT_RING_SIZE
+	));
@@ -14,6 +14,7 @@
 
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslEventSignal.h"
+#include "rtr/rsslReactorEventQueue.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -131,24 +132,9 @@ typedef struct
 @ATTENTION! 
 @These structures would be modified if the original (from Reactor) structures were modified!
 */
-typedef struct 
-{
-	RsslQueue eventPool;
-	RsslQueue eventQueue;
-	RsslMutex eventPoolLock;
-	RsslMutex eventQueueLock;
-	void *pLastEvent;
-	void *pParentGroup;
-	RsslQueueLink readyEventQueueLink;
-	RsslBool isInActiveEventQueueGroup;
-}MyReactorEventQueue;
+typedef RsslReactorEventQueue MyReactorEventQueue;
 
-typedef struct 
-{
-	RsslQueue readyEventQueueGroup;
-	RsslMutex lock;
-	RsslEventSignal eventSignal;
-}MyReactorEventQueueGroup;
+typedef RsslReactorEventQueueGroup MyReactorEventQueueGroup;
 
 typedef struct 
 {
@@ -178,6 +164,8 @@ typedef struct
 	MyReactorEventQueue reactorEventQueue; 
 	RsslNotifier *pNotifier; 
 	RsslNotifierEvent *pQueueNotifierEvent; 
+	RsslNotifierType notifierType;
+	RsslIoUring *pIoUring;
 	RsslBuffer memoryBuffer;
 	RsslInt64 lastRecordedTimeMs;
 	RsslInt32 channelCount;			
@@ -2512,6 +2500,15 @@ static RsslReactorCallbackRet defaultMsgCallback(RsslReactor* pReactor, RsslReac
 	EXPECT_TRUE(pInfo->pRsslMsgBuffer);
 	EXPECT_TRUE(!pInfo->pErrorInfo);
 
+	if (pInfo->lazyMsg)
+	{
+		/* The reactor always completes messages for the domains it decodes itself. */
+		EXPECT_TRUE(pInfo->pRsslMsg->msgBase.domainType != RSSL_DMT_LOGIN
+				&& pInfo->pRsslMsg->msgBase.domainType != RSSL_DMT_SOURCE
+				&& pInfo->pRsslMsg->msgBase.domainType != RSSL_DMT_DICTIONARY);
+		EXPECT_EQ(RSSL_RET_SUCCESS, rsslCompleteLazyMsg(pInfo->pRsslMsg));
+	}
+
 	copyMutRsslMsg(pMutMsg, pInfo->pRsslMsg, pReactorChannel);
 	return RSSL_RC_CRET_SUCCESS;
 }
@@ -3385,6 +3382,45 @@ static void reactorUnitTests_AutoMsgs(RsslConnectionTypes connectionType)
 	ommConsumerRole.dictionaryMsgCallback = dictionaryMsgCallback;
 	reactorUnitTests_AutoMsgsInt(connectionType);
 
+	/* Lazy message decode; login, directory and dictionary messages must still arrive fully decoded */
+	clearObjects();
+	ommConsumerRole.pLoginRequest = &loginRequest;
+	ommConsumerRole.pDirectoryRequest = &directoryRequest;
+	ommConsumerRole.dictionaryDownloadMode = RSSL_RC_DICTIONARY_DOWNLOAD_FIRST_AVAILABLE;
+	ommConsumerRole.base.lazyMsgDecode = RSSL_TRUE;
+	ommProviderRole.base.lazyMsgDecode = RSSL_TRUE;
+	reactorUnitTests_AutoMsgsInt(connectionType);
+
+	/* Lazy message decode with domain callbacks */
+	clearObjects();
+	ommConsumerRole.pLoginRequest = &loginRequest;
+	ommProviderRole.loginMsgCallback = loginMsgCallback;
+	ommConsumerRole.loginMsgCallback = loginMsgCallback;
+	ommConsumerRole.pDirectoryRequest = &directoryRequest;
+	ommProviderRole.directoryMsgCallback = directoryMsgCallback;
+	ommConsumerRole.directoryMsgCallback = directoryMsgCallback;
+	ommConsumerRole.dictionaryDownloadMode = RSSL_RC_DICTIONARY_DOWNLOAD_FIRST_AVAILABLE;
+	ommProviderRole.dictionaryMsgCallback = dictionaryMsgCallback;
+	ommConsumerRole.dictionaryMsgCallback = dictionaryMsgCallback;
+	ommConsumerRole.base.lazyMsgDecode = RSSL_TRUE;
+	ommProviderRole.base.lazyMsgDecode = RSSL_TRUE;
+	reactorUnitTests_AutoMsgsInt(connectionType);
+
+	/* Consumer writes go through the reactor's io_uring, so each is sent only when a dispatch ends */
+	clearObjects();
+	ommConsumerRole.pLoginRequest = &loginRequest;
+	ommProviderRole.loginMsgCallback = loginMsgCallback;
+	ommConsumerRole.loginMsgCallback = loginMsgCallback;
+	ommConsumerRole.pDirectoryRequest = &directoryRequest;
+	ommProviderRole.directoryMsgCallback = directoryMsgCallback;
+	ommConsumerRole.directoryMsgCallback = directoryMsgCallback;
+	ommConsumerRole.dictionaryDownloadMode = RSSL_RC_DICTIONARY_DOWNLOAD_FIRST_AVAILABLE;
+	ommProviderRole.dictionaryMsgCallback = dictionaryMsgCallback;
+	ommConsumerRole.dictionaryMsgCallback = dictionaryMsgCallback;
+	connectOpts[0].rsslConnectOptions.tcpOpts.io_uring = RSSL_TRUE;
+	connectOpts[1].rsslConnectOptions.tcpOpts.io_uring = RSSL_TRUE;
+	reactorUnitTests_AutoMsgsInt(connectionType);
+
 
 	/* Test NonInteractive Provider */
 	clearObjects();
@@ -5125,10 +5161,10 @@ void reactorUnitTests_EventPoolSize(RsslConnectionTypes connectionType)
 
 	MyReactorImpl *pMyConsReactorImpl = (MyReactorImpl*)pConsMon->pReactor;
 	MyRsslReactorWorker *myConsReacotrWorker = &(pMyConsReactorImpl->reactorWorker);
-	RsslQueue *evtPoolCons = &(myConsReacotrWorker->workerQueue.eventPool);
+	MyReactorEventQueue *evtQueueCons = &(myConsReacotrWorker->workerQueue);
 
 	/*Check pool size before connection*/
-	ASSERT_TRUE((RsslInt32)evtPoolCons->count > mOpts.maxEventsInPool);
+	ASSERT_TRUE((RsslInt32)rsslReactorEventQueueGetPoolCount(evtQueueCons) > mOpts.maxEventsInPool);
 
 	/* Open connections */
 	for (i = 0; i < numConnections; ++i)
@@ -5155,7 +5191,7 @@ void reactorUnitTests_EventPoolSize(RsslConnectionTypes connectionType)
 	}
 
 	/*Check pool size after connection*/
-	ASSERT_TRUE((RsslInt32)evtPoolCons->count <= mOpts.maxEventsInPool);
+	ASSERT_TRUE((RsslInt32)rsslReactorEventQueueGetPoolCount(evtQueueCons) <= mOpts.maxEventsInPool);
 
 	/* Close connections */
 	for (i = 0; i < numConnections; ++i)
@@ -5164,7 +5200,7 @@ void reactorUnitTests_EventPoolSize(RsslConnectionTypes connectionType)
 	}
 
 	/*Check pool size after disconnection*/
-	ASSERT_TRUE((RsslInt32)evtPoolCons->count <= mOpts.maxEventsInPool);
+	ASSERT_TRUE((RsslInt32)rsslReactorEventQueueGetPoolCount(evtQueueCons) <= mOpts.maxEventsInPool);
 
 	do { rsslRet = dispatchEvents(pProvMon, 200, 1000); } while (rsslRet == RSSL_RET_READ_WOULD_BLOCK);
 	ASSERT_TRUE(rsslRet >= RSSL_RET_SUCCESS);
@@ -5175,7 +5211,7 @@ void reactorUnitTests_EventPoolSize(RsslConnectionTypes connectionType)
 	ASSERT_TRUE(pConsMon->mutMsg.mutMsgType == MUT_MSG_CONN && pConsMon->mutMsg.channelEvent.channelEventType == RSSL_RC_CET_CHANNEL_DOWN);
 
 	/*Check pool size after dispaticing*/
-	ASSERT_TRUE((RsslInt32)evtPoolCons->count <= mOpts.maxEventsInPool);
+	ASSERT_TRUE((RsslInt32)rsslReactorEventQueueGetPoolCount(evtQueueCons) <= mOpts.maxEventsInPool);
 
 	rsslNotifierRemoveEvent(pConsMon->pNotifier, pConsMon->pReactorNotifierEvent);
 	rsslNotifierRemoveEvent(pProvMon->pNotifier, pProvMon->pReactorNotifierEvent);
@@ -216,7 +216,7 @@ INSTANTIATE_TEST_CASE_P(
 	TestingWatchlistAggregationTests,
 	WatchlistAggregationTest,
 	::testing::Values(
-		RSSL_CONN_TYPE_SOCKET, RSSL_CONN_TYPE_WEBSOCKET
+		RSSL_CONN_TYPE_SOCKET, RSSL_CONN_TYPE_WEBSOCKET, RSSL_CONN_TYPE_BIDIR_SHMEM
 	));
 
 
@@ -4687,7 +4687,7 @@ void watchlistAggregationTest_ThreeItemsInMsgBuffer_Batch(RsslConnectionTypes co
 	wtfClearSetupConnectionOpts(&csOpts);
 	csOpts.consumerDictionaryCallback = (WtfCallbackAction)RSSL_FALSE;
 	csOpts.providerDictionaryCallback = (WtfCallbackAction)RSSL_FALSE;
-	wtfSetupConnection(&csOpts);
+	wtfSetupConnection(&csOpts, connectionType);
 
 	for (ui = 0; ui < domainCount; ++ui)
 	{
@@ -4906,7 +4906,8 @@ void watchlistAggregationTest_ThreeItemsInMsgBuffer_BatchWithView(RsslConnection
 	wtfClearSetupConnectionOpts(&csOpts);
 	csOpts.consumerDictionaryCallback = (WtfCallbackAction)RSSL_FALSE;
 	csOpts.providerDictionaryCallback = (WtfCallbackAction)RSSL_FALSE;
-	wtfSetupConnection(&csOpts);
+	/* The conversion library doesn't support the view in the message buffer, so the websocket variant stays on a socket. */
+	wtfSetupConnection(&csOpts, connectionType == RSSL_CONN_TYPE_WEBSOCKET ? RSSL_CONN_TYPE_SOCKET : connectionType);
 
 	for (ui = 0; ui < domainCount; ++ui)
 	{
@@ -72,7 +72,7 @@ INSTANTIATE_TEST_CASE_P(
 	TestingWatchlistMiscUnitTests,
 	WatchlistMiscUnitTest,
 	::testing::Values(
-		RSSL_CONN_TYPE_SOCKET, RSSL_CONN_TYPE_WEBSOCKET
+		RSSL_CONN_TYPE_SOCKET, RSSL_CONN_TYPE_WEBSOCKET, RSSL_CONN_TYPE_BIDIR_SHMEM
 	));
 
 void watchlistMiscTest_BigGenericMsg(RsslConnectionTypes connectionType)
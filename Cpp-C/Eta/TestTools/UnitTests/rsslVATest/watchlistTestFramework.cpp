@@ -519,6 +519,8 @@ void wtfBindServer(RsslConnectionTypes connectionType)
 
 	if(connectionType == RSSL_CONN_TYPE_WEBSOCKET)
 		bindOpts.wsOpts.protocols = const_cast<char*>("rssl.json.v2");
+	else if (connectionType == RSSL_CONN_TYPE_BIDIR_SHMEM)
+		bindOpts.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
 
 	wtf.pServer = rsslBind(&bindOpts, &rsslErrorInfo.rsslError);
 	bindOpts.pingTimeout = bindOpts.minPingTimeout = 30;